@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+#
+# Generate src/signal/rta_fft_static_tables.h: the sine and bit
+# reversal tables of the power of 2 FFT sizes from 256 to 8192, as
+# computed by tables_new in rta_fft.c, for float and double.
+#
+# Usage: python3 rta_fft_static_tables.py > ../src/signal/rta_fft_static_tables.h
+#
+# Copyright (C) 2007 by IRCAM-Centre Georges Pompidou, Paris, France.
+# All rights reserved. License (BSD 3-clause), see rta_fft.c.
+
+import math
+import struct
+
+MIN_LOG2 = 8
+MAX_LOG2 = 13
+
+HEADER = '''/**
+ * @file   rta_fft_static_tables.h
+ * @author Jean-Philippe Lambert
+ * @ingroup rta_signal
+ *
+ * @brief  Precomputed FFT tables (private)
+ *
+ * Sine and bit reversal tables of the power of 2 FFT sizes from
+ * FFT_STATIC_MIN_SIZE to FFT_STATIC_MAX_SIZE, in the layout of
+ * tables_new in rta_fft.c: the sine from 0 to 2pi inclusive, plus a
+ * quarter for the cosine (5/4 * size + 1 values). Only included by
+ * rta_fft.c, unless RTA_FFT_NO_STATIC_TABLES is defined.
+ *
+ * Generated by build/rta_fft_static_tables.py. Do not edit.
+ *
+ * @copyright
+ * Copyright (C) 2007 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_FFT_STATIC_TABLES_H_
+#define _RTA_FFT_STATIC_TABLES_H_ 1
+
+#include "rta.h"
+'''
+
+
+def sine(i, size):
+    """sin(2 pi i / size), exact at the multiples of pi/2"""
+    quarter = size // 4
+    q, r = divmod(i % size, quarter)
+    x = 0.5 * math.pi * r / quarter
+    return (math.sin(x), math.cos(x), -math.sin(x), -math.cos(x))[q] + 0.
+
+
+def bitrev(i, log2_size):
+    return int(format(i, '0%db' % log2_size)[::-1], 2)
+
+
+def to_float(x):
+    return struct.unpack('f', struct.pack('f', x))[0]
+
+
+def array(declaration, values, per_line):
+    lines = ['%s =' % declaration, '{']
+    for i in range(0, len(values), per_line):
+        lines.append('  ' + ', '.join(values[i:i + per_line]) + ',')
+    lines[-1] = lines[-1][:-1]
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    sizes = [1 << l for l in range(MIN_LOG2, MAX_LOG2 + 1)]
+    out = [HEADER]
+    out.append('#define FFT_STATIC_MIN_SIZE %d' % sizes[0])
+    out.append('#define FFT_STATIC_MAX_SIZE %d\n' % sizes[-1])
+
+    for size in sizes:
+        log2_size = size.bit_length() - 1
+        out.append(array('static const unsigned int fft_static_bitrev_%d[%d]'
+                         % (size, size),
+                         [str(bitrev(i, log2_size)) for i in range(size)],
+                         12))
+
+    out.append('static const unsigned int * const fft_static_bitrev[%d] =\n{'
+               % len(sizes))
+    out.append(',\n'.join('  fft_static_bitrev_%d' % s for s in sizes))
+    out.append('};\n')
+
+    for name, type_name, convert, form, suffix, per_line in (
+            ('FLOAT', 'float', to_float, '%.9g', 'f', 5),
+            ('DOUBLE', 'double', float, '%.17g', '', 3)):
+        out.append('#if (RTA_REAL_TYPE == RTA_%s_TYPE)\n' % name)
+        out.append('#define FFT_STATIC_SIN 1\n')
+        for size in sizes:
+            length = size * 5 // 4 + 1
+            values = []
+            for i in range(length):
+                text = form % convert(sine(i, size))
+                if suffix and ('.' not in text and 'e' not in text):
+                    text += '.'
+                values.append(text + suffix)
+            out.append(array('static const %s fft_static_sin_%d[%d]'
+                             % (type_name, size, length), values, per_line))
+
+        out.append('static const %s * const fft_static_sin[%d] =\n{'
+                   % (type_name, len(sizes)))
+        out.append(',\n'.join('  fft_static_sin_%d' % s for s in sizes))
+        out.append('};\n')
+        out.append('#endif /* RTA_%s_TYPE */\n' % name)
+
+    out.append('#endif /* _RTA_FFT_STATIC_TABLES_H_ */')
+    print('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -43,132 +43,153 @@
 #include "rta_mel.h"
 #include "rta_math.h"
 #include "rta_stdlib.h"
+#include "rta_simd.h"
 
+/* x86 vector products of packed weights, selected according to the */
+/* CPU */
+#if defined(RTA_SIMD_X86) && \
+  (RTA_REAL_TYPE == RTA_FLOAT_TYPE || RTA_REAL_TYPE == RTA_DOUBLE_TYPE)
+#define RTA_BANDS_SIMD 1
+#include <immintrin.h>
+#endif
 
-int rta_spectrum_to_mel_bands_weights(
-  rta_real_t * weights_matrix, unsigned int * weights_bounds,
+
+/* Frequencies of the mel bands weights, in one array of */
+/* 'spectrum_size' + 2 * ('filters_number' + 2) values: the center */
+/* frequency of each FFT bin, the center frequencies of the mel bands */
+/* (with 2 more filters as the actual number, so as to calculate the */
+/* slopes), and these frequencies scaled according to <scale_width>. */
+/* It is NULL if the allocation fails. */
+static rta_real_t * mel_bands_frequencies_new(
   const unsigned int spectrum_size,
   const rta_real_t sample_rate, const unsigned int filters_number,
   const rta_real_t min_freq, const rta_real_t max_freq,
   const rta_real_t scale_width,
   const rta_hz_to_mel_function hz_to_mel,
-  const rta_mel_to_hz_function mel_to_hz,
-  const rta_mel_t mel_type)
+  const rta_mel_to_hz_function mel_to_hz)
 {
   unsigned int i,j;	 /* counters */
-  unsigned int min_weight_index_defined;
-  int ret = 0;
-
-  /* center frequency of each FFT bin */
   rta_real_t * fft_freq = (rta_real_t*) rta_malloc(
-    sizeof(rta_real_t) * spectrum_size);
-
-  const rta_real_t min_mel = (*hz_to_mel)(min_freq);
-  const rta_real_t max_mel = (*hz_to_mel)(max_freq);
-
-/* Center frequencies of mel bands - uniformly spaced between limits */
-  rta_real_t * filter_freq = (rta_real_t*) rta_malloc(sizeof(rta_real_t) * (filters_number + 2));
+    sizeof(rta_real_t) * (spectrum_size + 2 * (filters_number + 2)));
 
-/* scaled filter frequencies according to <scale_width> */
-  rta_real_t * scaled_filter_freq = (rta_real_t*) rta_malloc(sizeof(rta_real_t) * (filters_number + 2));
-
-  if(fft_freq != NULL && filter_freq != NULL && scaled_filter_freq != NULL)
+  if(fft_freq != NULL)
   {
+    rta_real_t * filter_freq = fft_freq + spectrum_size;
+    rta_real_t * scaled_filter_freq = filter_freq + filters_number + 2;
+    const rta_real_t min_mel = (*hz_to_mel)(min_freq);
+    const rta_real_t max_mel = (*hz_to_mel)(max_freq);
     const rta_real_t fft_size = 2. * (spectrum_size - 1.);
+
     for(j=0; j<spectrum_size; j++)
     {
       fft_freq[j] = sample_rate * j / fft_size;
     }
 
-    /* There is 2 more filters as the actual number, so as to calculate */
-    /* the slopes */
+    /* uniformly spaced between limits, in mel */
     for(i=0; i<filters_number + 2; i++)
     {
       filter_freq[i] = (*mel_to_hz)(min_mel + i / (filters_number + 1.) *
                                       (max_mel - min_mel));
     }
-  
+
     for(i=0; i<filters_number + 1; i++)
     {
       scaled_filter_freq[i] = filter_freq[i+1] +
         scale_width * (filter_freq[i] - filter_freq[i+1]);
     }
     scaled_filter_freq[i] = filter_freq[i];
+  }
 
-    for(i=0; i<filters_number; i++)
-    {
-      min_weight_index_defined = 0;
-      /* Do not process the last spectrum component as it will be zeroed */
-      /* later to avoid aliasing */
-      for(j=0; j<spectrum_size-1; j++)
-      {
-        /* Lower slope and upper slope, intersect with each other and zero */
-        weights_matrix[i*spectrum_size+j] = 
-          rta_max(0., rta_min(
-                    (fft_freq[j] - scaled_filter_freq[i]) /
-                    (scaled_filter_freq[i+1] - scaled_filter_freq[i]),
-                    (scaled_filter_freq[i+2] - fft_freq[j]) /
-                    (scaled_filter_freq[i+2] - scaled_filter_freq[i+1])
-                    )
-            );
-
-        /* Define the bounds so as to use an index <i> of the form */
-        /* for(j=weights_bounds[i*2+0]; j<weights_bounds[i*2+1]; j++)) */
-        /* lower bound included, upper bound excluded */
-        if(weights_matrix[i*spectrum_size+j] > 0.)
-        {
-          if(min_weight_index_defined == 0)
-          {
-            min_weight_index_defined = 1;
-            weights_bounds[i*2] = j;
-          }
-          weights_bounds[i*2+1] = j+1;
-        }
-      }
-      /* empty filter */
-      if(min_weight_index_defined == 0)
-      {
-        weights_bounds[i*2] = weights_bounds[i*2+1] = 0;
-      }
-    }
+  return fft_freq;
+}
+
+/* Weights of the mel band 'i', from the frequencies of */
+/* mel_bands_frequencies_new, and their bounds, to use an index <j> */
+/* of the form for(j=*first; j<*end; j++), lower bound included, upper */
+/* bound excluded. */
+static void mel_band_weights(
+  rta_real_t * weights, const int w_stride,
+  unsigned int * first, unsigned int * end,
+  const rta_real_t * frequencies, const unsigned int spectrum_size,
+  const unsigned int filters_number, const unsigned int i,
+  const rta_mel_t mel_type)
+{
+  const rta_real_t * fft_freq = frequencies;
+  const rta_real_t * filter_freq = fft_freq + spectrum_size;
+  const rta_real_t * scaled_filter_freq = filter_freq + filters_number + 2;
+  /* Slaney-style mel is scaled to be approx constant E per channel */
+  const double scale = (mel_type == rta_mel_slaney ?
+                        2. / (filter_freq[i+2] - filter_freq[i]) : 1.);
+  unsigned int min_weight_index_defined = 0;
+  unsigned int j;
+
+  /* Do not process the last spectrum component as it will be zeroed */
+  /* to avoid aliasing */
+  for(j=0; j<spectrum_size-1; j++)
+  {
+    /* Lower slope and upper slope, intersect with each other and zero */
+    const rta_real_t weight =
+      rta_max(0., rta_min(
+                (fft_freq[j] - scaled_filter_freq[i]) /
+                (scaled_filter_freq[i+1] - scaled_filter_freq[i]),
+                (scaled_filter_freq[i+2] - fft_freq[j]) /
+                (scaled_filter_freq[i+2] - scaled_filter_freq[i+1])
+                )
+        );
+
+    weights[j*w_stride] = weight * scale;
 
-    /* Slaney-style mel is scaled to be approx constant E per channel */
-    if(mel_type == rta_mel_slaney)
+    if(weight > 0.)
     {
-      for(i=0; i<filters_number; i++)
+      if(min_weight_index_defined == 0)
       {
-        /* process only non null values */
-        for(j=weights_bounds[i*2]; j<weights_bounds[i*2+1]; j++)
-        {
-          weights_matrix[i*spectrum_size+j] *= 2. / (filter_freq[i+2] - filter_freq[i]);
-        }
+        min_weight_index_defined = 1;
+        *first = j;
       }
+      *end = j+1;
     }
-
-    /* Make sure that 2nd half of FFT is zero */
-    /* (We process only the middle, not the upper part) */
-    /* Seems like a good idea to avoid aliasing */
-    j = spectrum_size-1;
-    for(i=0; i<filters_number; i++)
-    {
-      weights_matrix[i*spectrum_size+j] = 0.;
-    }
-    ret = 1;
-  }
-  
-  if(fft_freq  != NULL)
-  {
-    rta_free(fft_freq);
   }
 
-  if(filter_freq != NULL)
+  /* empty filter */
+  if(min_weight_index_defined == 0)
   {
-    rta_free(filter_freq);
+    *first = *end = 0;
   }
 
-  if(scaled_filter_freq != NULL)
+  /* Make sure that 2nd half of FFT is zero */
+  /* (We process only the middle, not the upper part) */
+  /* Seems like a good idea to avoid aliasing */
+  weights[(spectrum_size-1)*w_stride] = 0.;
+  return;
+}
+
+int rta_spectrum_to_mel_bands_weights(
+  rta_real_t * weights_matrix, unsigned int * weights_bounds,
+  const unsigned int spectrum_size,
+  const rta_real_t sample_rate, const unsigned int filters_number,
+  const rta_real_t min_freq, const rta_real_t max_freq,
+  const rta_real_t scale_width,
+  const rta_hz_to_mel_function hz_to_mel,
+  const rta_mel_to_hz_function mel_to_hz,
+  const rta_mel_t mel_type)
+{
+  unsigned int i;	 /* counter */
+  int ret = 0;
+  rta_real_t * frequencies = mel_bands_frequencies_new(
+    spectrum_size, sample_rate, filters_number, min_freq, max_freq,
+    scale_width, hz_to_mel, mel_to_hz);
+
+  if(frequencies != NULL)
   {
-    rta_free(scaled_filter_freq);
+    for(i=0; i<filters_number; i++)
+    {
+      mel_band_weights(weights_matrix + i*spectrum_size, 1,
+                       weights_bounds + i*2, weights_bounds + i*2+1,
+                       frequencies, spectrum_size, filters_number, i,
+                       mel_type);
+    }
+    rta_free(frequencies);
+    ret = 1;
   }
 
   return ret;
@@ -184,124 +205,29 @@ int rta_spectrum_to_mel_bands_weights_stride(
   const rta_mel_to_hz_function mel_to_hz,
   const rta_mel_t mel_type)
 {
-  unsigned int i,j;	 /* counters */
-  unsigned int min_weight_index_defined;
+  unsigned int i;	 /* counter */
   int ret = 0;
+  rta_real_t * frequencies = mel_bands_frequencies_new(
+    spectrum_size, sample_rate, filters_number, min_freq, max_freq,
+    scale_width, hz_to_mel, mel_to_hz);
 
-/* center frequency of each FFT bin */
-  rta_real_t * fft_freq = (rta_real_t*) rta_malloc(sizeof(rta_real_t) * spectrum_size);
-
-  const rta_real_t min_mel = (*hz_to_mel)(min_freq);
-  const rta_real_t max_mel = (*hz_to_mel)(max_freq);
-
-/* Center frequencies of mel bands - uniformly spaced between limits */
-  rta_real_t * filter_freq = (rta_real_t*) rta_malloc(sizeof(rta_real_t) * (filters_number + 2));
-
-/* scaled filter frequencies according to <scale_width> */
-  rta_real_t * scaled_filter_freq = (rta_real_t*) rta_malloc(sizeof(rta_real_t) * (filters_number + 2));
-
-  if(fft_freq != NULL && filter_freq != NULL && scaled_filter_freq != NULL)
+  if(frequencies != NULL)
   {
-    const rta_real_t fft_size = 2. * (spectrum_size - 1.);
-    for(j=0; j<spectrum_size; j++)
-    {
-      fft_freq[j] = sample_rate * j / fft_size;
-    }
-
-    /* There is 2 more filters as the actual number, so as to calculate */
-    /* the slopes */
-    for(i=0; i<filters_number + 2; i++)
-    {
-      filter_freq[i] = (*mel_to_hz)(min_mel + i / (filters_number + 1.) *
-                                      (max_mel - min_mel));
-    }
-  
-    for(i=0; i<filters_number + 2; i++) //FIXME: shouldn't be filters_number + 1, since i+1 is used in body?
-    {
-      scaled_filter_freq[i] = filter_freq[i+1] +
-        scale_width * (filter_freq[i] - filter_freq[i+1]);
-    }
-  
-    for(i=0; i<filters_number; i++)
-    {
-      min_weight_index_defined = 0;
-      /* Do not process the last spectrum component as it will be zeroed */
-      /* later to avoid aliasing */
-      for(j=0; j<spectrum_size-1; j++)
-      {
-        /* Lower slope and upper slope, intersect with each other and zero */
-        weights_matrix[(i*spectrum_size+j)*wm_stride] = 
-          rta_max(0., rta_min(
-                    (fft_freq[j] - scaled_filter_freq[i]) /
-                    (scaled_filter_freq[i+1] - scaled_filter_freq[i]),
-                    (scaled_filter_freq[i+2] - fft_freq[j]) /
-                    (scaled_filter_freq[i+2] - scaled_filter_freq[i+1])
-                    )
-            );
-
-        /* Define the bounds so as to use an index <i> of the form */
-        /* for(j=weights_bounds[i*2+0]; j<weights_bounds[i*2+1]; j++)) */
-        /* lower bound included, upper bound excluded */
-        if(weights_matrix[(i*spectrum_size+j)*wm_stride] > 0.)
-        {
-          if(min_weight_index_defined == 0)
-          {
-            min_weight_index_defined = 1;
-            weights_bounds[i*2*wb_stride] = j;
-          }
-          weights_bounds[(i*2+1)*wb_stride] = j+1;
-        }
-      }
-      /* empty filter */
-      if(min_weight_index_defined == 0)
-      {
-        weights_bounds[i*2*wb_stride] = weights_bounds[(i*2+1)*wb_stride] = 0;
-      }
-    }
-
-    /* Slaney-style mel is scaled to be approx constant E per channel */
-    if(mel_type == rta_mel_slaney)
-    {
-      for(i=0; i<filters_number; i++)
-      {
-        /* process only non null values */
-        for(j=weights_bounds[i*2]; j<weights_bounds[i*2+1]; j++)
-        {
-          weights_matrix[(i*spectrum_size+j)*wm_stride] *=
-            2. / (filter_freq[i+2] - filter_freq[i]);
-        }
-      }
-    }
-    /* Make sure that 2nd half of FFT is zero */
-    /* (We process only the middle, not the upper part) */
-    /* Seems like a good idea to avoid aliasing */
-    j = spectrum_size-1;
     for(i=0; i<filters_number; i++)
     {
-      weights_matrix[(i*spectrum_size+j)*wm_stride] = 0.;
+      mel_band_weights(weights_matrix + i*spectrum_size*wm_stride, wm_stride,
+                       weights_bounds + i*2*wb_stride,
+                       weights_bounds + (i*2+1)*wb_stride,
+                       frequencies, spectrum_size, filters_number, i,
+                       mel_type);
     }
+    rta_free(frequencies);
     ret = 1;
   }
 
-  if(fft_freq  != NULL)
-  {
-    rta_free(fft_freq);
-  }
-
-  if(filter_freq != NULL)
-  {
-    rta_free(filter_freq);
-  }
-
-  if(scaled_filter_freq != NULL)
-  {
-    rta_free(scaled_filter_freq);
-  }
-
   return ret;
 }
 
-
 int rta_spectrum_to_bands_weights (
   /*out*/ rta_real_t *weights_matrix, unsigned int *weights_bounds,
   /*in*/ float *band_limits, /* filters_number + 1 limits in Hz*/
@@ -433,3 +359,846 @@ void rta_spectrum_to_bands_square_abs_stride(
 
   return;
 }
+
+/* Integrate split FFT bins into bands, in abs domain */
+void rta_spectrum_split_to_bands_abs(
+  rta_real_t * bands,
+  const rta_real_t * spectrum_real, const rta_real_t * spectrum_imag,
+  const rta_real_t nyquist,
+  const rta_real_t * weights_matrix, const unsigned int * weights_bounds,
+  const unsigned int spectrum_size, const unsigned int filters_number)
+{
+  unsigned int i,j;
+
+  for(i=0; i<filters_number; i++)
+  {
+    /* the last point is the nyquist one */
+    const unsigned int end = (weights_bounds[i*2+1] < spectrum_size ?
+                              weights_bounds[i*2+1] : spectrum_size - 1);
+    bands[i] = 0.;
+    for(j=weights_bounds[i*2]; j<end; j++)
+    {
+      bands[i] += weights_matrix[i*spectrum_size+j] *
+        rta_sqrt(spectrum_real[j] * spectrum_real[j] +
+                 spectrum_imag[j] * spectrum_imag[j]);
+    }
+    if(end < weights_bounds[i*2+1])
+    {
+      bands[i] += weights_matrix[i*spectrum_size+end] * rta_abs(nyquist);
+    }
+  }
+
+  return;
+}
+
+/* Integrate split FFT bins into bands, in abs^2 domain */
+void rta_spectrum_split_to_bands_square_abs(
+  rta_real_t * bands,
+  const rta_real_t * spectrum_real, const rta_real_t * spectrum_imag,
+  const rta_real_t nyquist,
+  const rta_real_t * weights_matrix, const unsigned int * weights_bounds,
+  const unsigned int spectrum_size, const unsigned int filters_number)
+{
+  unsigned int i;
+
+  rta_spectrum_split_to_bands_abs(bands, spectrum_real, spectrum_imag,
+                                  nyquist, weights_matrix, weights_bounds,
+                                  spectrum_size, filters_number);
+  for(i=0; i<filters_number; i++)
+  {
+    bands[i] = rta_pow(bands[i], 2);
+  }
+
+  return;
+}
+
+/* ------- packed weights ---------------------------- */
+
+/* product of 'size' weights and spectrum values, or of their square */
+/* roots */
+typedef rta_real_t (*bands_product_function)
+(const rta_real_t * weights, const rta_real_t * spectrum,
+ const unsigned int size);
+
+/* frames of a tile of the functions on several frames */
+#define BANDS_TILE_FRAMES 4
+
+/* products of 'size' weights and the values of BANDS_TILE_FRAMES */
+/* spectra (or their square roots), into 'bands' */
+typedef void (*bands_tile_function)
+(rta_real_t * bands, const rta_real_t * weights,
+ const rta_real_t * spectra, const unsigned int s_stride,
+ const unsigned int size);
+
+struct rta_bands_weights
+{
+  unsigned int spectrum_size;
+  unsigned int filters_number;
+  unsigned int * bounds;  /**< first and end bins, by band */
+  unsigned int * offsets; /**< first weight of each band, and end */
+  rta_real_t * weights;   /**< weights within the bounds, band after band */
+  bands_product_function product;
+  bands_product_function product_sqrt;
+  bands_tile_function tile;
+  bands_tile_function tile_sqrt;
+};
+
+static rta_real_t
+bands_product(const rta_real_t * weights, const rta_real_t * spectrum,
+              const unsigned int size)
+{
+  rta_real_t sum = 0.;
+  unsigned int j;
+
+  for(j=0; j<size; j++)
+  {
+    sum += weights[j] * spectrum[j];
+  }
+  return sum;
+}
+
+static rta_real_t
+bands_product_sqrt(const rta_real_t * weights, const rta_real_t * spectrum,
+                   const unsigned int size)
+{
+  rta_real_t sum = 0.;
+  unsigned int j;
+
+  for(j=0; j<size; j++)
+  {
+    sum += weights[j] * rta_sqrt(spectrum[j]);
+  }
+  return sum;
+}
+
+static void
+bands_tile(rta_real_t * bands, const rta_real_t * weights,
+           const rta_real_t * spectra, const unsigned int s_stride,
+           const unsigned int size)
+{
+  rta_real_t sum0 = 0., sum1 = 0., sum2 = 0., sum3 = 0.;
+  unsigned int j;
+
+  for(j=0; j<size; j++)
+  {
+    sum0 += weights[j] * spectra[j];
+    sum1 += weights[j] * spectra[s_stride+j];
+    sum2 += weights[j] * spectra[2*s_stride+j];
+    sum3 += weights[j] * spectra[3*s_stride+j];
+  }
+  bands[0] = sum0;
+  bands[1] = sum1;
+  bands[2] = sum2;
+  bands[3] = sum3;
+  return;
+}
+
+static void
+bands_tile_sqrt(rta_real_t * bands, const rta_real_t * weights,
+                const rta_real_t * spectra, const unsigned int s_stride,
+                const unsigned int size)
+{
+  rta_real_t sum0 = 0., sum1 = 0., sum2 = 0., sum3 = 0.;
+  unsigned int j;
+
+  for(j=0; j<size; j++)
+  {
+    sum0 += weights[j] * rta_sqrt(spectra[j]);
+    sum1 += weights[j] * rta_sqrt(spectra[s_stride+j]);
+    sum2 += weights[j] * rta_sqrt(spectra[2*s_stride+j]);
+    sum3 += weights[j] * rta_sqrt(spectra[3*s_stride+j]);
+  }
+  bands[0] = sum0;
+  bands[1] = sum1;
+  bands[2] = sum2;
+  bands[3] = sum3;
+  return;
+}
+
+#if defined(RTA_BANDS_SIMD)
+
+#define BANDS_SIMD_IDENTITY(x) (x)
+
+/* see bands_product and bands_product_sqrt */
+#define BANDS_SIMD_PRODUCT(name, isa, vector_t, width, \
+                           loadu, storeu, set1, add, mul, map, scalar_map) \
+static rta_real_t __attribute__((target(isa))) \
+name(const rta_real_t * weights, const rta_real_t * spectrum, \
+     const unsigned int size) \
+{ \
+  vector_t sum0 = set1(0.); \
+  vector_t sum1 = set1(0.); \
+  rta_real_t s[width]; \
+  rta_real_t sum = 0.; \
+  unsigned int j; \
+  \
+  for(j=0; j+2*(width)<=size; j+=2*(width)) \
+  { \
+    sum0 = add(sum0, mul(loadu(weights + j), map(loadu(spectrum + j)))); \
+    sum1 = add(sum1, mul(loadu(weights + j + (width)), \
+                         map(loadu(spectrum + j + (width))))); \
+  } \
+  for(; j<size; j++) \
+  { \
+    sum += weights[j] * scalar_map(spectrum[j]); \
+  } \
+  storeu(s, add(sum0, sum1)); \
+  for(j=0; j<(width); j++) \
+  { \
+    sum += s[j]; \
+  } \
+  return sum; \
+}
+
+/* see bands_tile and bands_tile_sqrt */
+#define BANDS_SIMD_TILE(name, isa, vector_t, width, \
+                        loadu, storeu, set1, add, mul, map, scalar_map) \
+static void __attribute__((target(isa))) \
+name(rta_real_t * bands, const rta_real_t * weights, \
+     const rta_real_t * spectra, const unsigned int s_stride, \
+     const unsigned int size) \
+{ \
+  vector_t sum0 = set1(0.); \
+  vector_t sum1 = set1(0.); \
+  vector_t sum2 = set1(0.); \
+  vector_t sum3 = set1(0.); \
+  rta_real_t s[4][width]; \
+  unsigned int j, f; \
+  \
+  for(j=0; j+(width)<=size; j+=(width)) \
+  { \
+    const vector_t w = loadu(weights + j); \
+    sum0 = add(sum0, mul(w, map(loadu(spectra + j)))); \
+    sum1 = add(sum1, mul(w, map(loadu(spectra + s_stride + j)))); \
+    sum2 = add(sum2, mul(w, map(loadu(spectra + 2 * s_stride + j)))); \
+    sum3 = add(sum3, mul(w, map(loadu(spectra + 3 * s_stride + j)))); \
+  } \
+  storeu(s[0], sum0); \
+  storeu(s[1], sum1); \
+  storeu(s[2], sum2); \
+  storeu(s[3], sum3); \
+  for(f=0; f<4; f++) \
+  { \
+    const rta_real_t * spectrum = spectra + f * s_stride; \
+    unsigned int l; \
+    \
+    bands[f] = 0.; \
+    for(l=j; l<size; l++) \
+    { \
+      bands[f] += weights[l] * scalar_map(spectrum[l]); \
+    } \
+    for(l=0; l<(width); l++) \
+    { \
+      bands[f] += s[f][l]; \
+    } \
+  } \
+  return; \
+}
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE)
+
+BANDS_SIMD_PRODUCT(bands_product_sse2, "sse2", __m128, 4,
+                   _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps,
+                   _mm_add_ps, _mm_mul_ps, BANDS_SIMD_IDENTITY,
+                   BANDS_SIMD_IDENTITY)
+BANDS_SIMD_PRODUCT(bands_product_avx2, "avx2", __m256, 8,
+                   _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps,
+                   _mm256_add_ps, _mm256_mul_ps, BANDS_SIMD_IDENTITY,
+                   BANDS_SIMD_IDENTITY)
+BANDS_SIMD_PRODUCT(bands_product_avx512, "avx512f", __m512, 16,
+                   _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps,
+                   _mm512_add_ps, _mm512_mul_ps, BANDS_SIMD_IDENTITY,
+                   BANDS_SIMD_IDENTITY)
+BANDS_SIMD_PRODUCT(bands_product_sqrt_sse2, "sse2", __m128, 4,
+                   _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps,
+                   _mm_add_ps, _mm_mul_ps, _mm_sqrt_ps, rta_sqrt)
+BANDS_SIMD_PRODUCT(bands_product_sqrt_avx2, "avx2", __m256, 8,
+                   _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps,
+                   _mm256_add_ps, _mm256_mul_ps, _mm256_sqrt_ps, rta_sqrt)
+BANDS_SIMD_PRODUCT(bands_product_sqrt_avx512, "avx512f", __m512, 16,
+                   _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps,
+                   _mm512_add_ps, _mm512_mul_ps, _mm512_sqrt_ps, rta_sqrt)
+
+BANDS_SIMD_TILE(bands_tile_sse2, "sse2", __m128, 4,
+                _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps,
+                _mm_add_ps, _mm_mul_ps, BANDS_SIMD_IDENTITY,
+                BANDS_SIMD_IDENTITY)
+BANDS_SIMD_TILE(bands_tile_avx2, "avx2", __m256, 8,
+                _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps,
+                _mm256_add_ps, _mm256_mul_ps, BANDS_SIMD_IDENTITY,
+                BANDS_SIMD_IDENTITY)
+BANDS_SIMD_TILE(bands_tile_avx512, "avx512f", __m512, 16,
+                _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps,
+                _mm512_add_ps, _mm512_mul_ps, BANDS_SIMD_IDENTITY,
+                BANDS_SIMD_IDENTITY)
+BANDS_SIMD_TILE(bands_tile_sqrt_sse2, "sse2", __m128, 4,
+                _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps,
+                _mm_add_ps, _mm_mul_ps, _mm_sqrt_ps, rta_sqrt)
+BANDS_SIMD_TILE(bands_tile_sqrt_avx2, "avx2", __m256, 8,
+                _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps,
+                _mm256_add_ps, _mm256_mul_ps, _mm256_sqrt_ps, rta_sqrt)
+BANDS_SIMD_TILE(bands_tile_sqrt_avx512, "avx512f", __m512, 16,
+                _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps,
+                _mm512_add_ps, _mm512_mul_ps, _mm512_sqrt_ps, rta_sqrt)
+
+#else /* double */
+
+BANDS_SIMD_PRODUCT(bands_product_sse2, "sse2", __m128d, 2,
+                   _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd,
+                   _mm_add_pd, _mm_mul_pd, BANDS_SIMD_IDENTITY,
+                   BANDS_SIMD_IDENTITY)
+BANDS_SIMD_PRODUCT(bands_product_avx2, "avx2", __m256d, 4,
+                   _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd,
+                   _mm256_add_pd, _mm256_mul_pd, BANDS_SIMD_IDENTITY,
+                   BANDS_SIMD_IDENTITY)
+BANDS_SIMD_PRODUCT(bands_product_avx512, "avx512f", __m512d, 8,
+                   _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd,
+                   _mm512_add_pd, _mm512_mul_pd, BANDS_SIMD_IDENTITY,
+                   BANDS_SIMD_IDENTITY)
+BANDS_SIMD_PRODUCT(bands_product_sqrt_sse2, "sse2", __m128d, 2,
+                   _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd,
+                   _mm_add_pd, _mm_mul_pd, _mm_sqrt_pd, rta_sqrt)
+BANDS_SIMD_PRODUCT(bands_product_sqrt_avx2, "avx2", __m256d, 4,
+                   _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd,
+                   _mm256_add_pd, _mm256_mul_pd, _mm256_sqrt_pd, rta_sqrt)
+BANDS_SIMD_PRODUCT(bands_product_sqrt_avx512, "avx512f", __m512d, 8,
+                   _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd,
+                   _mm512_add_pd, _mm512_mul_pd, _mm512_sqrt_pd, rta_sqrt)
+
+BANDS_SIMD_TILE(bands_tile_sse2, "sse2", __m128d, 2,
+                _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd,
+                _mm_add_pd, _mm_mul_pd, BANDS_SIMD_IDENTITY,
+                BANDS_SIMD_IDENTITY)
+BANDS_SIMD_TILE(bands_tile_avx2, "avx2", __m256d, 4,
+                _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd,
+                _mm256_add_pd, _mm256_mul_pd, BANDS_SIMD_IDENTITY,
+                BANDS_SIMD_IDENTITY)
+BANDS_SIMD_TILE(bands_tile_avx512, "avx512f", __m512d, 8,
+                _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd,
+                _mm512_add_pd, _mm512_mul_pd, BANDS_SIMD_IDENTITY,
+                BANDS_SIMD_IDENTITY)
+BANDS_SIMD_TILE(bands_tile_sqrt_sse2, "sse2", __m128d, 2,
+                _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd,
+                _mm_add_pd, _mm_mul_pd, _mm_sqrt_pd, rta_sqrt)
+BANDS_SIMD_TILE(bands_tile_sqrt_avx2, "avx2", __m256d, 4,
+                _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd,
+                _mm256_add_pd, _mm256_mul_pd, _mm256_sqrt_pd, rta_sqrt)
+BANDS_SIMD_TILE(bands_tile_sqrt_avx512, "avx512f", __m512d, 8,
+                _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd,
+                _mm512_add_pd, _mm512_mul_pd, _mm512_sqrt_pd, rta_sqrt)
+
+#endif /* RTA_REAL_TYPE */
+
+#endif /* RTA_BANDS_SIMD */
+
+/* products and tiles according to the CPU */
+static void
+bands_select(bands_product_function * product,
+             bands_product_function * product_sqrt,
+             bands_tile_function * tile,
+             bands_tile_function * tile_sqrt)
+{
+  *product = bands_product;
+  *product_sqrt = bands_product_sqrt;
+  *tile = bands_tile;
+  *tile_sqrt = bands_tile_sqrt;
+
+#if defined(RTA_BANDS_SIMD)
+  switch(rta_simd_level())
+  {
+    case rta_simd_avx512:
+      *product = bands_product_avx512;
+      *product_sqrt = bands_product_sqrt_avx512;
+      *tile = bands_tile_avx512;
+      *tile_sqrt = bands_tile_sqrt_avx512;
+      break;
+    case rta_simd_avx2:
+      *product = bands_product_avx2;
+      *product_sqrt = bands_product_sqrt_avx2;
+      *tile = bands_tile_avx2;
+      *tile_sqrt = bands_tile_sqrt_avx2;
+      break;
+    case rta_simd_sse2:
+      *product = bands_product_sse2;
+      *product_sqrt = bands_product_sqrt_sse2;
+      *tile = bands_tile_sse2;
+      *tile_sqrt = bands_tile_sqrt_sse2;
+      break;
+    default:
+      break;
+  }
+#endif
+
+  return;
+}
+
+/* allocate the weights, from the bounds, and select the products */
+static int
+bands_weights_new(rta_bands_weights_t ** bands_weights,
+                  const unsigned int spectrum_size,
+                  const unsigned int filters_number,
+                  const unsigned int * weights_bounds)
+{
+  unsigned int i;
+  int ret = 1;
+
+  *bands_weights = (rta_bands_weights_t *)
+    rta_malloc(sizeof(rta_bands_weights_t));
+
+  if(*bands_weights == NULL)
+  {
+    return 0;
+  }
+
+  (*bands_weights)->spectrum_size = spectrum_size;
+  (*bands_weights)->filters_number = filters_number;
+  (*bands_weights)->weights = NULL;
+  bands_select(&((*bands_weights)->product),
+               &((*bands_weights)->product_sqrt),
+               &((*bands_weights)->tile),
+               &((*bands_weights)->tile_sqrt));
+  (*bands_weights)->bounds = (unsigned int *)
+    rta_malloc(2 * filters_number * sizeof(unsigned int));
+  (*bands_weights)->offsets = (unsigned int *)
+    rta_malloc((filters_number + 1) * sizeof(unsigned int));
+
+  if((*bands_weights)->bounds == NULL || (*bands_weights)->offsets == NULL)
+  {
+    ret = 0;
+  }
+  else
+  {
+    (*bands_weights)->offsets[0] = 0;
+    for(i=0; i<filters_number; i++)
+    {
+      unsigned int end = rta_min(weights_bounds[i*2+1], spectrum_size);
+      unsigned int first = rta_min(weights_bounds[i*2], end);
+
+      (*bands_weights)->bounds[i*2] = first;
+      (*bands_weights)->bounds[i*2+1] = end;
+      (*bands_weights)->offsets[i+1] =
+        (*bands_weights)->offsets[i] + end - first;
+    }
+
+    (*bands_weights)->weights = (rta_real_t *) rta_malloc(
+      rta_max((*bands_weights)->offsets[filters_number], 1) *
+      sizeof(rta_real_t));
+
+    if((*bands_weights)->weights == NULL)
+    {
+      ret = 0;
+    }
+  }
+
+  if(ret == 0)
+  {
+    rta_bands_weights_delete(*bands_weights);
+    *bands_weights = NULL;
+  }
+
+  return ret;
+}
+
+int rta_bands_weights_new(
+  rta_bands_weights_t ** bands_weights,
+  const rta_real_t * weights_matrix, const unsigned int * weights_bounds,
+  const unsigned int spectrum_size, const unsigned int filters_number)
+{
+  unsigned int i,j;
+  int ret = bands_weights_new(bands_weights, spectrum_size, filters_number,
+                              weights_bounds);
+
+  if(ret != 0)
+  {
+    rta_real_t * weights = (*bands_weights)->weights;
+    const unsigned int * bounds = (*bands_weights)->bounds;
+
+    for(i=0; i<filters_number; i++)
+    {
+      for(j=bounds[i*2]; j<bounds[i*2+1]; j++)
+      {
+        *(weights++) = weights_matrix[i*spectrum_size+j];
+      }
+    }
+  }
+
+  return ret;
+}
+
+/* same weights as rta_spectrum_to_mel_bands_weights, band after band */
+int rta_spectrum_to_mel_bands_weights_new(
+  rta_bands_weights_t ** bands_weights,
+  const unsigned int spectrum_size,
+  const rta_real_t sample_rate, const unsigned int filters_number,
+  const rta_real_t min_freq, const rta_real_t max_freq,
+  const rta_real_t scale_width,
+  const rta_hz_to_mel_function hz_to_mel,
+  const rta_mel_to_hz_function mel_to_hz,
+  const rta_mel_t mel_type)
+{
+  unsigned int i,j;	 /* counters */
+  int ret = 0;
+  rta_real_t * frequencies = (spectrum_size > 0 ?
+                              mel_bands_frequencies_new(
+                                spectrum_size, sample_rate, filters_number,
+                                min_freq, max_freq, scale_width,
+                                hz_to_mel, mel_to_hz) : NULL);
+
+  /* bounds, then weights of one band */
+  unsigned int * weights_bounds = (unsigned int *) rta_malloc(
+    sizeof(unsigned int) * 2 * rta_max(filters_number, 1));
+  rta_real_t * weights = (rta_real_t*) rta_malloc(
+    sizeof(rta_real_t) * rta_max(spectrum_size, 1));
+
+  *bands_weights = NULL;
+
+  if(frequencies != NULL && weights_bounds != NULL && weights != NULL)
+  {
+    unsigned int pass;
+
+    /* first pass for the bounds, second one for the weights */
+    ret = 1;
+    for(pass=0; pass<2 && ret != 0; pass++)
+    {
+      rta_real_t * packed = (pass == 1 ? (*bands_weights)->weights : NULL);
+
+      for(i=0; i<filters_number; i++)
+      {
+        mel_band_weights(weights, 1, weights_bounds + i*2,
+                         weights_bounds + i*2+1, frequencies, spectrum_size,
+                         filters_number, i, mel_type);
+
+        if(pass == 1)
+        {
+          for(j=weights_bounds[i*2]; j<weights_bounds[i*2+1]; j++)
+          {
+            *(packed++) = weights[j];
+          }
+        }
+      }
+
+      if(pass == 0)
+      {
+        ret = bands_weights_new(bands_weights, spectrum_size, filters_number,
+                                weights_bounds);
+      }
+    }
+  }
+
+  if(frequencies != NULL)
+  {
+    rta_free(frequencies);
+  }
+
+  if(weights_bounds != NULL)
+  {
+    rta_free(weights_bounds);
+  }
+
+  if(weights != NULL)
+  {
+    rta_free(weights);
+  }
+
+  return ret;
+}
+
+/* same weights as rta_spectrum_to_bands_weights, band after band */
+int rta_spectrum_to_bands_weights_new(
+  rta_bands_weights_t ** bands_weights,
+  const float * band_limits,
+  const unsigned int spectrum_size,
+  const rta_real_t sample_rate, const unsigned int filters_number)
+{
+  unsigned int i;
+  int ret = 0;
+  unsigned int * weights_bounds = (unsigned int *) rta_malloc(
+    sizeof(unsigned int) * 2 * rta_max(filters_number, 1));
+
+  *bands_weights = NULL;
+
+  if(weights_bounds != NULL && spectrum_size > 0)
+  {
+    for(i=0; i<filters_number; i++)
+    {
+      weights_bounds[i*2]   = band_limits[i*2]   / sample_rate * spectrum_size;
+      weights_bounds[i*2+1] = band_limits[i*2+1] / sample_rate * spectrum_size;
+
+      /* the last spectrum component is zeroed */
+      if(weights_bounds[i*2+1] > spectrum_size - 1)
+      {
+        weights_bounds[i*2+1] = spectrum_size - 1;
+      }
+    }
+
+    ret = bands_weights_new(bands_weights, spectrum_size, filters_number,
+                            weights_bounds);
+  }
+
+  if(ret != 0)
+  {
+    for(i=0; i<(*bands_weights)->offsets[filters_number]; i++)
+    {
+      (*bands_weights)->weights[i] = 1.;
+    }
+  }
+
+  if(weights_bounds != NULL)
+  {
+    rta_free(weights_bounds);
+  }
+
+  return ret;
+}
+
+void rta_bands_weights_delete(rta_bands_weights_t * bands_weights)
+{
+  if(bands_weights != NULL)
+  {
+    if(bands_weights->bounds != NULL)
+    {
+      rta_free(bands_weights->bounds);
+    }
+
+    if(bands_weights->offsets != NULL)
+    {
+      rta_free(bands_weights->offsets);
+    }
+
+    if(bands_weights->weights != NULL)
+    {
+      rta_free(bands_weights->weights);
+    }
+
+    rta_free(bands_weights);
+  }
+  return;
+}
+
+unsigned int rta_bands_weights_size(const rta_bands_weights_t * bands_weights)
+{
+  return bands_weights->offsets[bands_weights->filters_number];
+}
+
+void rta_spectrum_to_bands_abs_packed(
+  rta_real_t * bands, const rta_real_t * spectrum,
+  const rta_bands_weights_t * bands_weights)
+{
+  const unsigned int * bounds = bands_weights->bounds;
+  const unsigned int * offsets = bands_weights->offsets;
+  unsigned int i;
+
+  for(i=0; i<bands_weights->filters_number; i++)
+  {
+    bands[i] = (*bands_weights->product)(bands_weights->weights + offsets[i],
+                                         spectrum + bounds[i*2],
+                                         offsets[i+1] - offsets[i]);
+  }
+
+  return;
+}
+
+void rta_spectrum_to_bands_square_abs_packed(
+  rta_real_t * bands, const rta_real_t * spectrum,
+  const rta_bands_weights_t * bands_weights)
+{
+  const unsigned int * bounds = bands_weights->bounds;
+  const unsigned int * offsets = bands_weights->offsets;
+  unsigned int i;
+
+  for(i=0; i<bands_weights->filters_number; i++)
+  {
+    const rta_real_t band = (*bands_weights->product_sqrt)(
+      bands_weights->weights + offsets[i], spectrum + bounds[i*2],
+      offsets[i+1] - offsets[i]);
+    bands[i] = band * band;
+  }
+
+  return;
+}
+
+/* arguments of the _frames functions, for the threads of a pool. The */
+/* weights of the band i start at 'weights' + 'offsets'[i] when they */
+/* are packed, or at 'weights' + i * 'spectrum_size' + 'bounds'[i*2] */
+/* for a matrix ('offsets' is NULL) */
+typedef struct bands_frames_arguments
+{
+  rta_real_t * bands;
+  unsigned int b_stride;
+  const rta_real_t * spectra;
+  unsigned int s_stride;
+  unsigned int frames_number;
+  const rta_real_t * weights;
+  const unsigned int * bounds;
+  const unsigned int * offsets;
+  unsigned int spectrum_size;
+  unsigned int filters_number;
+  bands_product_function product;
+  bands_tile_function tile;
+  int square;
+} bands_frames_arguments_t;
+
+/* each band of the blocks of frames from 'begin' to 'end', with the */
+/* same weights in cache, by tiles of BANDS_TILE_FRAMES frames */
+static void
+bands_frames(const bands_frames_arguments_t * a,
+             const unsigned int begin, const unsigned int end)
+{
+  rta_real_t tile_bands[BANDS_TILE_FRAMES];
+  unsigned int block, i, f, t;
+
+  for(block=begin; block<end; block+=RTA_BANDS_FRAMES_BLOCK)
+  {
+    const unsigned int block_end = (block + RTA_BANDS_FRAMES_BLOCK < end ?
+                                    block + RTA_BANDS_FRAMES_BLOCK : end);
+
+    for(i=0; i<a->filters_number; i++)
+    {
+      const rta_real_t * band_weights = a->weights +
+        (a->offsets != NULL ? a->offsets[i] :
+         i * a->spectrum_size + a->bounds[i*2]);
+      const unsigned int size = (a->offsets != NULL ?
+                                 a->offsets[i+1] - a->offsets[i] :
+                                 a->bounds[i*2+1] - a->bounds[i*2]);
+      const rta_real_t * spectrum = a->spectra + a->bounds[i*2];
+
+      for(f=block; f+BANDS_TILE_FRAMES<=block_end; f+=BANDS_TILE_FRAMES)
+      {
+        (*a->tile)(tile_bands, band_weights, spectrum + f * a->s_stride,
+                   a->s_stride, size);
+        for(t=0; t<BANDS_TILE_FRAMES; t++)
+        {
+          a->bands[(f + t) * a->b_stride + i] =
+            (a->square ? tile_bands[t] * tile_bands[t] : tile_bands[t]);
+        }
+      }
+
+      for(; f<block_end; f++)
+      {
+        const rta_real_t band =
+          (*a->product)(band_weights, spectrum + f * a->s_stride, size);
+        a->bands[f * a->b_stride + i] = (a->square ? band * band : band);
+      }
+    }
+  }
+
+  return;
+}
+
+/* the part 'index' of the blocks of frames, run by each thread */
+static void
+bands_frames_part(void * argument, const unsigned int index,
+                  const unsigned int threads_number)
+{
+  const bands_frames_arguments_t * a =
+    (const bands_frames_arguments_t *) argument;
+  const unsigned int blocks_number =
+    (a->frames_number + RTA_BANDS_FRAMES_BLOCK - 1) / RTA_BANDS_FRAMES_BLOCK;
+  const unsigned int begin = RTA_BANDS_FRAMES_BLOCK *
+    rta_thread_part_begin(blocks_number, index, threads_number);
+  const unsigned int end = RTA_BANDS_FRAMES_BLOCK *
+    rta_thread_part_begin(blocks_number, index + 1, threads_number);
+
+  bands_frames(a, begin, (end < a->frames_number ? end : a->frames_number));
+  return;
+}
+
+/* all the frames, on the threads of 'pool' */
+static void
+bands_frames_run(rta_real_t * bands, const unsigned int b_stride,
+                 const rta_real_t * spectra, const unsigned int s_stride,
+                 const unsigned int frames_number,
+                 const rta_real_t * weights, const unsigned int * bounds,
+                 const unsigned int * offsets,
+                 const unsigned int spectrum_size,
+                 const unsigned int filters_number,
+                 const bands_product_function product,
+                 const bands_tile_function tile,
+                 const int square, rta_thread_pool_t * pool)
+{
+  bands_frames_arguments_t arguments;
+
+  arguments.bands = bands;
+  arguments.b_stride = b_stride;
+  arguments.spectra = spectra;
+  arguments.s_stride = s_stride;
+  arguments.frames_number = frames_number;
+  arguments.weights = weights;
+  arguments.bounds = bounds;
+  arguments.offsets = offsets;
+  arguments.spectrum_size = spectrum_size;
+  arguments.filters_number = filters_number;
+  arguments.product = product;
+  arguments.tile = tile;
+  arguments.square = square;
+
+  rta_thread_pool_run(pool, bands_frames_part, &arguments);
+  return;
+}
+
+void rta_spectrum_to_bands_abs_packed_frames(
+  rta_real_t * bands, const unsigned int b_stride,
+  const rta_real_t * spectra, const unsigned int s_stride,
+  const unsigned int frames_number,
+  const rta_bands_weights_t * bands_weights, rta_thread_pool_t * pool)
+{
+  bands_frames_run(bands, b_stride, spectra, s_stride, frames_number,
+                   bands_weights->weights, bands_weights->bounds,
+                   bands_weights->offsets, bands_weights->spectrum_size,
+                   bands_weights->filters_number,
+                   bands_weights->product, bands_weights->tile, 0, pool);
+  return;
+}
+
+void rta_spectrum_to_bands_square_abs_packed_frames(
+  rta_real_t * bands, const unsigned int b_stride,
+  const rta_real_t * spectra, const unsigned int s_stride,
+  const unsigned int frames_number,
+  const rta_bands_weights_t * bands_weights, rta_thread_pool_t * pool)
+{
+  bands_frames_run(bands, b_stride, spectra, s_stride, frames_number,
+                   bands_weights->weights, bands_weights->bounds,
+                   bands_weights->offsets, bands_weights->spectrum_size,
+                   bands_weights->filters_number,
+                   bands_weights->product_sqrt, bands_weights->tile_sqrt, 1,
+                   pool);
+  return;
+}
+
+/* ------- several frames, with a weights matrix ----- */
+
+void rta_spectrum_to_bands_abs_frames(
+  rta_real_t * bands, const unsigned int b_stride,
+  const rta_real_t * spectra, const unsigned int s_stride,
+  const unsigned int frames_number,
+  const rta_real_t * weights_matrix, const unsigned int * weights_bounds,
+  const unsigned int spectrum_size, const unsigned int filters_number,
+  rta_thread_pool_t * pool)
+{
+  bands_product_function product, product_sqrt;
+  bands_tile_function tile, tile_sqrt;
+
+  bands_select(&product, &product_sqrt, &tile, &tile_sqrt);
+  bands_frames_run(bands, b_stride, spectra, s_stride, frames_number,
+                   weights_matrix, weights_bounds, NULL, spectrum_size,
+                   filters_number, product, tile, 0, pool);
+  return;
+}
+
+void rta_spectrum_to_bands_square_abs_frames(
+  rta_real_t * bands, const unsigned int b_stride,
+  const rta_real_t * spectra, const unsigned int s_stride,
+  const unsigned int frames_number,
+  const rta_real_t * weights_matrix, const unsigned int * weights_bounds,
+  const unsigned int spectrum_size, const unsigned int filters_number,
+  rta_thread_pool_t * pool)
+{
+  bands_product_function product, product_sqrt;
+  bands_tile_function tile, tile_sqrt;
+
+  bands_select(&product, &product_sqrt, &tile, &tile_sqrt);
+  bands_frames_run(bands, b_stride, spectra, s_stride, frames_number,
+                   weights_matrix, weights_bounds, NULL, spectrum_size,
+                   filters_number, product_sqrt, tile_sqrt, 1, pool);
+  return;
+}
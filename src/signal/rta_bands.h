@@ -45,6 +45,7 @@
 
 #include "rta.h"
 #include "rta_mel.h"   /**< mel types and functions for mel bands */
+#include "rta_thread.h" /* rta_thread_pool_t */
 
 #ifdef __cplusplus
 extern "C" {
@@ -268,6 +269,56 @@ void rta_spectrum_to_bands_square_abs_stride(
   const unsigned int * weights_bounds, const int wb_stride,
   const unsigned int spectrum_size, const unsigned int filters_number);
 
+/**
+ * Integrate the magnitude of a split complex spectrum into bands, in
+ * abs domain
+ * 'bands' = 'weights_matrix'*abs('spectrum')
+ *
+ * \see rta_fft_split_execute
+ *
+ * @param bands size is 'filters_number'
+ * @param spectrum_real size is 'spectrum_size' - 1
+ * @param spectrum_imag size is 'spectrum_size' - 1
+ * @param nyquist is the real value of the last point of the spectrum
+ * @param weights_matrix size is 'filters_number'*'spectrum_size'
+ * @param weights_bounds size is 'filters_number'*2.
+ * @param spectrum_size points number of the magnitude spectrum, that
+ * is ('fft_size'/2.)+1.
+ * @param filters_number number of output bands
+ *
+ */
+void rta_spectrum_split_to_bands_abs(
+  rta_real_t * bands,
+  const rta_real_t * spectrum_real, const rta_real_t * spectrum_imag,
+  const rta_real_t nyquist,
+  const rta_real_t * weights_matrix, const unsigned int * weights_bounds,
+  const unsigned int spectrum_size, const unsigned int filters_number);
+
+/**
+ * Integrate the magnitude of a split complex spectrum into bands, in
+ * abs^2 domain
+ * 'bands' = ('weights_matrix'*abs('spectrum')).^2
+ *
+ * \see rta_fft_split_execute
+ *
+ * @param bands size is 'filters_number'
+ * @param spectrum_real size is 'spectrum_size' - 1
+ * @param spectrum_imag size is 'spectrum_size' - 1
+ * @param nyquist is the real value of the last point of the spectrum
+ * @param weights_matrix size is 'filters_number'*'spectrum_size'
+ * @param weights_bounds size is 'filters_number'*2.
+ * @param spectrum_size points number of the magnitude spectrum, that
+ * is ('fft_size'/2.)+1.
+ * @param filters_number number of output bands
+ *
+ */
+void rta_spectrum_split_to_bands_square_abs(
+  rta_real_t * bands,
+  const rta_real_t * spectrum_real, const rta_real_t * spectrum_imag,
+  const rta_real_t nyquist,
+  const rta_real_t * weights_matrix, const unsigned int * weights_bounds,
+  const unsigned int spectrum_size, const unsigned int filters_number);
+
 
 int rta_spectrum_to_bands_weights (
   /*out*/ rta_real_t *weights_matrix, unsigned int *weights_bounds,
@@ -276,6 +327,210 @@ int rta_spectrum_to_bands_weights (
   const rta_real_t sample_rate, const unsigned int filters_number);
 
 
+/* rta_bands_weights is private (depends on implementation) */
+typedef struct rta_bands_weights rta_bands_weights_t;
+
+/**
+ * Number of frames integrated together by the functions on several
+ * frames, for each band, to reuse its weights and the spectra in cache.
+ */
+#ifndef RTA_BANDS_FRAMES_BLOCK
+#define RTA_BANDS_FRAMES_BLOCK 8
+#endif
+
+/**
+ * Allocate packed bands weights, from a weights matrix and its
+ * bounds. Only the weights within the bounds are stored, band after
+ * band (compressed sparse rows, whose columns are contiguous), which
+ * is about 'filters_number' / 2 times smaller than the matrix for
+ * overlapping triangular bands.
+ *
+ * \see rta_bands_weights_delete
+ * \see rta_spectrum_to_bands_abs_packed
+ *
+ * @param bands_weights is an address of a pointer to a private
+ * structure, which is allocated and filled by this function.
+ * @param weights_matrix size is 'filters_number'*'spectrum_size'
+ * @param weights_bounds size is 'filters_number'*2.
+ * @param spectrum_size points number of the spectrum
+ * @param filters_number number of bands
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'bands_weights' (even a delete).
+ */
+int rta_bands_weights_new(
+  rta_bands_weights_t ** bands_weights,
+  const rta_real_t * weights_matrix, const unsigned int * weights_bounds,
+  const unsigned int spectrum_size, const unsigned int filters_number);
+
+/**
+ * Allocate packed mel bands weights, without any weights matrix. They
+ * are the same as the ones within the bounds generated by
+ * rta_spectrum_to_mel_bands_weights, with the same parameters.
+ *
+ * \see rta_spectrum_to_mel_bands_weights
+ * \see rta_bands_weights_new
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'bands_weights' (even a delete).
+ */
+int rta_spectrum_to_mel_bands_weights_new(
+  rta_bands_weights_t ** bands_weights,
+  const unsigned int spectrum_size,
+  const rta_real_t sample_rate, const unsigned int filters_number,
+  const rta_real_t min_freq, const rta_real_t max_freq, const rta_real_t scale_width,
+  const rta_hz_to_mel_function hz_to_mel,
+  const rta_mel_to_hz_function mel_to_hz,
+  const rta_mel_t mel_type);
+
+/**
+ * Allocate packed rectangular bands weights, without any weights
+ * matrix. They are the same as the ones within the bounds generated
+ * by rta_spectrum_to_bands_weights, with the same parameters.
+ *
+ * \see rta_spectrum_to_bands_weights
+ * \see rta_bands_weights_new
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'bands_weights' (even a delete).
+ */
+int rta_spectrum_to_bands_weights_new(
+  rta_bands_weights_t ** bands_weights,
+  const float * band_limits,
+  const unsigned int spectrum_size,
+  const rta_real_t sample_rate, const unsigned int filters_number);
+
+/**
+ * Deallocate any (sucessfully) allocated packed bands weights.
+ *
+ * @param bands_weights is a pointer to the memory wich will be released.
+ */
+void rta_bands_weights_delete(rta_bands_weights_t * bands_weights);
+
+/**
+ * Number of weights stored by packed bands weights.
+ *
+ * @param bands_weights are previously allocated packed weights
+ *
+ * @return the number of non-zero weights (within the bounds)
+ */
+unsigned int rta_bands_weights_size(const rta_bands_weights_t * bands_weights);
+
+/**
+ * Integrate amplitude spectrum into bands, in abs domain, with packed
+ * weights, as rta_spectrum_to_bands_abs.
+ * 'bands' = 'weights'*'spectrum'
+ *
+ * The products are computed by vectors (see rta_simd.h).
+ *
+ * @param bands size is 'filters_number'
+ * @param spectrum size is 'spectrum_size'
+ * @param bands_weights are previously allocated packed weights
+ */
+void rta_spectrum_to_bands_abs_packed(
+  rta_real_t * bands, const rta_real_t * spectrum,
+  const rta_bands_weights_t * bands_weights);
+
+/**
+ * Integrate power spectrum into bands, in abs^2 domain, with packed
+ * weights, as rta_spectrum_to_bands_square_abs.
+ * 'bands' = ('weights'*sqrt('spectrum')).^2
+ *
+ * @param bands size is 'filters_number'
+ * @param spectrum size is 'spectrum_size'
+ * @param bands_weights are previously allocated packed weights
+ */
+void rta_spectrum_to_bands_square_abs_packed(
+  rta_real_t * bands, const rta_real_t * spectrum,
+  const rta_bands_weights_t * bands_weights);
+
+/**
+ * Integrate several frames of amplitude spectrum into bands, in abs
+ * domain, with packed weights (sparse matrix by matrix product). The
+ * frames are processed by blocks of RTA_BANDS_FRAMES_BLOCK, and by
+ * tiles of 4 frames that share the loads of the weights. The blocks
+ * can be shared by the threads of a pool.
+ *
+ * \see rta_spectrum_to_bands_abs_packed
+ *
+ * @param bands size is 'frames_number'*'b_stride'
+ * @param b_stride is the distance between the bands of two frames,
+ * not less than 'filters_number'
+ * @param spectra size is 'frames_number'*'s_stride'
+ * @param s_stride is the distance between two spectra, not less than
+ * 'spectrum_size'
+ * @param frames_number is the number of frames
+ * @param bands_weights are previously allocated packed weights
+ * @param pool is a pool of threads which share the blocks of frames,
+ * or NULL to compute them in the calling thread only
+ */
+void rta_spectrum_to_bands_abs_packed_frames(
+  rta_real_t * bands, const unsigned int b_stride,
+  const rta_real_t * spectra, const unsigned int s_stride,
+  const unsigned int frames_number,
+  const rta_bands_weights_t * bands_weights, rta_thread_pool_t * pool);
+
+/**
+ * Integrate several frames of power spectrum into bands, in abs^2
+ * domain, with packed weights.
+ *
+ * \see rta_spectrum_to_bands_square_abs_packed
+ * \see rta_spectrum_to_bands_abs_packed_frames
+ */
+void rta_spectrum_to_bands_square_abs_packed_frames(
+  rta_real_t * bands, const unsigned int b_stride,
+  const rta_real_t * spectra, const unsigned int s_stride,
+  const unsigned int frames_number,
+  const rta_bands_weights_t * bands_weights, rta_thread_pool_t * pool);
+
+/**
+ * Integrate several frames of amplitude spectrum into bands, in abs
+ * domain, with a weights matrix and its bounds. The frames are
+ * processed as by rta_spectrum_to_bands_abs_packed_frames, so that
+ * the weights are read once by block of frames instead of once by
+ * frame.
+ *
+ * \see rta_spectrum_to_bands_abs
+ * \see rta_spectrum_to_bands_abs_packed_frames
+ *
+ * @param bands size is 'frames_number'*'b_stride'
+ * @param b_stride is the distance between the bands of two frames,
+ * not less than 'filters_number'
+ * @param spectra size is 'frames_number'*'s_stride'
+ * @param s_stride is the distance between two spectra, not less than
+ * 'spectrum_size'
+ * @param frames_number is the number of frames
+ * @param weights_matrix size is 'filters_number'*'spectrum_size'
+ * @param weights_bounds size is 'filters_number'*2
+ * @param spectrum_size is the size of each spectrum
+ * @param filters_number is the number of bands of each frame
+ * @param pool is a pool of threads which share the blocks of frames,
+ * or NULL to compute them in the calling thread only
+ */
+void rta_spectrum_to_bands_abs_frames(
+  rta_real_t * bands, const unsigned int b_stride,
+  const rta_real_t * spectra, const unsigned int s_stride,
+  const unsigned int frames_number,
+  const rta_real_t * weights_matrix, const unsigned int * weights_bounds,
+  const unsigned int spectrum_size, const unsigned int filters_number,
+  rta_thread_pool_t * pool);
+
+/**
+ * Integrate several frames of power spectrum into bands, in abs^2
+ * domain, with a weights matrix and its bounds.
+ *
+ * \see rta_spectrum_to_bands_square_abs
+ * \see rta_spectrum_to_bands_abs_frames
+ */
+void rta_spectrum_to_bands_square_abs_frames(
+  rta_real_t * bands, const unsigned int b_stride,
+  const rta_real_t * spectra, const unsigned int s_stride,
+  const unsigned int frames_number,
+  const rta_real_t * weights_matrix, const unsigned int * weights_bounds,
+  const unsigned int spectrum_size, const unsigned int filters_number,
+  rta_thread_pool_t * pool);
+
+
 #ifdef __cplusplus
 }
 #endif
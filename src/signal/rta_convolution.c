@@ -0,0 +1,427 @@
+/**
+ * @file   rta_convolution.c
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 11:48:05 2026
+ *
+ * @brief  Uniformly partitioned FFT convolution (overlap-save)
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_convolution.h"
+#include "rta_fft.h"
+#include "rta_complex.h"
+#include "rta_stdlib.h" /* memory management */
+
+/* -------  private (depends on implementation) ------ */
+
+/* The spectra of 'block_size' + 1 bins are split into real and */
+/* imaginary arrays, so that the multiply-accumulate loop is */
+/* vectorised by the compiler. */
+struct rta_convolution_setup
+{
+  unsigned int filter_size;
+  unsigned int filters_number;
+  unsigned int block_size;
+  unsigned int channels_number;
+  unsigned int partitions_number;
+  unsigned int bins_number;  /**< 'block_size' + 1 */
+  rta_real_t * filters;      /**< spectra, per filter and partition */
+  rta_real_t * delay_line;   /**< spectra, per channel and partition */
+  unsigned int delay_index;  /**< partition of the newest spectrum */
+  rta_real_t * history;      /**< 2 * 'block_size' samples per channel */
+  rta_real_t * accumulator;  /**< one spectrum */
+  rta_real_t * buffer;       /**< 2 * 'block_size' reals */
+  rta_real_t nyquist;
+  rta_real_t forward_scale;
+  rta_real_t inverse_scale;
+  rta_fft_setup_t * forward;
+  rta_fft_setup_t * inverse;
+};
+
+/* real transform of 'buffer' into a split spectrum */
+static void
+spectrum_split(rta_real_t * spectrum_real, rta_real_t * spectrum_imag,
+               const rta_complex_t * buffer, const rta_real_t nyquist,
+               const unsigned int block_size)
+{
+  unsigned int k;
+
+  spectrum_real[0] = rta_creal(buffer[0]);
+  spectrum_imag[0] = 0.;
+  for(k=1; k<block_size; k++)
+  {
+    spectrum_real[k] = rta_creal(buffer[k]);
+    spectrum_imag[k] = rta_cimag(buffer[k]);
+  }
+  spectrum_real[block_size] = nyquist;
+  spectrum_imag[block_size] = 0.;
+  return;
+}
+
+/* split spectrum into 'buffer', for a real inverse transform */
+static void
+spectrum_join(rta_complex_t * buffer, rta_real_t * nyquist,
+              const rta_real_t * spectrum_real,
+              const rta_real_t * spectrum_imag,
+              const unsigned int block_size)
+{
+  unsigned int k;
+
+  for(k=0; k<block_size; k++)
+  {
+    buffer[k] = rta_make_complex(spectrum_real[k], spectrum_imag[k]);
+  }
+  *nyquist = spectrum_real[block_size];
+  return;
+}
+
+/* accumulator += input * filter */
+static void
+complex_multiply_accumulate(rta_real_t * accumulator_real,
+                            rta_real_t * accumulator_imag,
+                            const rta_real_t * input_real,
+                            const rta_real_t * input_imag,
+                            const rta_real_t * filter_real,
+                            const rta_real_t * filter_imag,
+                            const unsigned int size)
+{
+  unsigned int k;
+
+  for(k=0; k<size; k++)
+  {
+    accumulator_real[k] += input_real[k] * filter_real[k]
+      - input_imag[k] * filter_imag[k];
+    accumulator_imag[k] += input_real[k] * filter_imag[k]
+      + input_imag[k] * filter_real[k];
+  }
+  return;
+}
+
+/* ------- end of private ---------------------------- */
+
+/* ------- Public functions -------------------------- */
+
+int
+rta_convolution_setup_new(rta_convolution_setup_t ** convolution_setup,
+                          const rta_real_t * filters,
+                          const unsigned int filter_size,
+                          const unsigned int filters_number,
+                          const unsigned int block_size,
+                          const unsigned int channels_number)
+{
+  int ret = 1;
+  *convolution_setup = (rta_convolution_setup_t *)
+    rta_malloc(sizeof(rta_convolution_setup_t));
+
+  if(*convolution_setup == NULL || filter_size == 0 || block_size == 0 ||
+     channels_number == 0 ||
+     (filters_number != 1 && filters_number != channels_number))
+  {
+    if(*convolution_setup != NULL)
+    {
+      rta_free(*convolution_setup);
+      *convolution_setup = NULL;
+    }
+    ret = 0;
+  }
+  else
+  {
+    (*convolution_setup)->filter_size = filter_size;
+    (*convolution_setup)->filters_number = filters_number;
+    (*convolution_setup)->block_size = block_size;
+    (*convolution_setup)->channels_number = channels_number;
+    (*convolution_setup)->partitions_number =
+      (filter_size + block_size - 1) / block_size;
+    (*convolution_setup)->bins_number = block_size + 1;
+    (*convolution_setup)->forward_scale = 1.;
+    (*convolution_setup)->inverse_scale = 0.5 / block_size;
+
+    (*convolution_setup)->filters = NULL;
+    (*convolution_setup)->delay_line = NULL;
+    (*convolution_setup)->history = NULL;
+    (*convolution_setup)->accumulator = NULL;
+    (*convolution_setup)->buffer = NULL;
+    (*convolution_setup)->forward = NULL;
+    (*convolution_setup)->inverse = NULL;
+  }
+
+  if(ret != 0)
+  {
+    const unsigned int spectrum_size = 2 * (*convolution_setup)->bins_number;
+    const unsigned int partitions_number =
+      (*convolution_setup)->partitions_number;
+
+    (*convolution_setup)->filters = (rta_real_t *) rta_malloc(
+      filters_number * partitions_number * spectrum_size *
+      sizeof(rta_real_t));
+    (*convolution_setup)->delay_line = (rta_real_t *) rta_malloc(
+      channels_number * partitions_number * spectrum_size *
+      sizeof(rta_real_t));
+    (*convolution_setup)->history = (rta_real_t *) rta_malloc(
+      channels_number * 2 * block_size * sizeof(rta_real_t));
+    (*convolution_setup)->accumulator = (rta_real_t *) rta_malloc(
+      spectrum_size * sizeof(rta_real_t));
+    (*convolution_setup)->buffer = (rta_real_t *) rta_malloc(
+      2 * block_size * sizeof(rta_real_t));
+
+    if((*convolution_setup)->filters == NULL ||
+       (*convolution_setup)->delay_line == NULL ||
+       (*convolution_setup)->history == NULL ||
+       (*convolution_setup)->accumulator == NULL ||
+       (*convolution_setup)->buffer == NULL)
+    {
+      ret = 0;
+    }
+  }
+
+  if(ret != 0)
+  {
+    ret = rta_fft_real_setup_new(&((*convolution_setup)->forward),
+                                 rta_fft_real_to_complex_1d,
+                                 &((*convolution_setup)->forward_scale),
+                                 (*convolution_setup)->history,
+                                 2 * block_size,
+                                 (*convolution_setup)->buffer,
+                                 2 * block_size,
+                                 &((*convolution_setup)->nyquist));
+    if(ret == 0)
+    {
+      (*convolution_setup)->forward = NULL;
+    }
+  }
+
+  if(ret != 0)
+  {
+    ret = rta_fft_real_setup_new(&((*convolution_setup)->inverse),
+                                 rta_fft_complex_to_real_1d,
+                                 &((*convolution_setup)->inverse_scale),
+                                 (*convolution_setup)->buffer, block_size,
+                                 (*convolution_setup)->buffer,
+                                 2 * block_size,
+                                 &((*convolution_setup)->nyquist));
+    if(ret == 0)
+    {
+      (*convolution_setup)->inverse = NULL;
+    }
+  }
+
+  if(ret != 0)
+  {
+    rta_convolution_filters_set(*convolution_setup, filters);
+    rta_convolution_reset(*convolution_setup);
+  }
+  else if(*convolution_setup != NULL)
+  {
+    rta_convolution_setup_delete(*convolution_setup);
+    *convolution_setup = NULL;
+  }
+
+  return ret;
+}
+
+void
+rta_convolution_setup_delete(rta_convolution_setup_t * convolution_setup)
+{
+  if(convolution_setup != NULL)
+  {
+    if(convolution_setup->forward != NULL)
+    {
+      rta_fft_setup_delete(convolution_setup->forward);
+    }
+
+    if(convolution_setup->inverse != NULL)
+    {
+      rta_fft_setup_delete(convolution_setup->inverse);
+    }
+
+    if(convolution_setup->filters != NULL)
+    {
+      rta_free(convolution_setup->filters);
+    }
+
+    if(convolution_setup->delay_line != NULL)
+    {
+      rta_free(convolution_setup->delay_line);
+    }
+
+    if(convolution_setup->history != NULL)
+    {
+      rta_free(convolution_setup->history);
+    }
+
+    if(convolution_setup->accumulator != NULL)
+    {
+      rta_free(convolution_setup->accumulator);
+    }
+
+    if(convolution_setup->buffer != NULL)
+    {
+      rta_free(convolution_setup->buffer);
+    }
+
+    rta_free(convolution_setup);
+  }
+
+  return;
+}
+
+void
+rta_convolution_filters_set(rta_convolution_setup_t * convolution_setup,
+                            const rta_real_t * filters)
+{
+  const unsigned int block_size = convolution_setup->block_size;
+  const unsigned int bins_number = convolution_setup->bins_number;
+  const unsigned int filter_size = convolution_setup->filter_size;
+  rta_real_t * spectrum = convolution_setup->filters;
+  unsigned int f, p, i;
+
+  for(f=0; f<convolution_setup->filters_number; f++)
+  {
+    const rta_real_t * filter = filters + f * filter_size;
+
+    for(p=0; p<convolution_setup->partitions_number; p++)
+    {
+      /* partition of 'block_size' taps, zero-padded by the FFT */
+      const unsigned int begin = p * block_size;
+      const unsigned int size = (filter_size - begin < block_size ?
+                                 filter_size - begin : block_size);
+
+      for(i=0; i<size; i++)
+      {
+        convolution_setup->buffer[i] = filter[begin + i];
+      }
+
+      rta_fft_real_execute(convolution_setup->buffer, convolution_setup->buffer,
+                           size, convolution_setup->forward,
+                           &(convolution_setup->nyquist));
+      spectrum_split(spectrum, spectrum + bins_number,
+                     (rta_complex_t *) convolution_setup->buffer,
+                     convolution_setup->nyquist, block_size);
+      spectrum += 2 * bins_number;
+    }
+  }
+  return;
+}
+
+void
+rta_convolution_reset(rta_convolution_setup_t * convolution_setup)
+{
+  const unsigned int channels_number = convolution_setup->channels_number;
+  unsigned int i;
+
+  for(i=0; i<channels_number * convolution_setup->partitions_number
+        * 2 * convolution_setup->bins_number; i++)
+  {
+    convolution_setup->delay_line[i] = 0.;
+  }
+
+  for(i=0; i<channels_number * 2 * convolution_setup->block_size; i++)
+  {
+    convolution_setup->history[i] = 0.;
+  }
+
+  convolution_setup->delay_index = 0;
+  return;
+}
+
+void
+rta_convolution_execute(rta_real_t * output, const rta_real_t * input,
+                        rta_convolution_setup_t * convolution_setup)
+{
+  const unsigned int block_size = convolution_setup->block_size;
+  const unsigned int bins_number = convolution_setup->bins_number;
+  const unsigned int spectrum_size = 2 * bins_number;
+  const unsigned int channels_number = convolution_setup->channels_number;
+  const unsigned int partitions_number = convolution_setup->partitions_number;
+  const unsigned int delay_index = convolution_setup->delay_index;
+  rta_real_t * accumulator = convolution_setup->accumulator;
+  rta_complex_t * spectrum = (rta_complex_t *) convolution_setup->buffer;
+  unsigned int c, p, i;
+
+  for(c=0; c<channels_number; c++)
+  {
+    /* previous and current blocks */
+    rta_real_t * history = convolution_setup->history + c * 2 * block_size;
+    rta_real_t * delay_line = convolution_setup->delay_line
+      + c * partitions_number * spectrum_size;
+    const rta_real_t * filter = convolution_setup->filters
+      + (convolution_setup->filters_number == 1 ? 0 : c)
+      * partitions_number * spectrum_size;
+    rta_real_t * newest = delay_line + delay_index * spectrum_size;
+
+    for(i=0; i<block_size; i++)
+    {
+      history[block_size + i] = input[i * channels_number + c];
+    }
+
+    rta_fft_real_execute(spectrum, history, 2 * block_size,
+                         convolution_setup->forward,
+                         &(convolution_setup->nyquist));
+    spectrum_split(newest, newest + bins_number, spectrum,
+                   convolution_setup->nyquist, block_size);
+
+    for(i=0; i<spectrum_size; i++)
+    {
+      accumulator[i] = 0.;
+    }
+
+    /* partition p of the filter applies to the input delayed by p blocks */
+    for(p=0; p<partitions_number; p++)
+    {
+      const rta_real_t * delayed = delay_line + spectrum_size *
+        ((delay_index + partitions_number - p) % partitions_number);
+
+      complex_multiply_accumulate(accumulator, accumulator + bins_number,
+                                  delayed, delayed + bins_number,
+                                  filter, filter + bins_number,
+                                  bins_number);
+      filter += spectrum_size;
+    }
+
+    spectrum_join(spectrum, &(convolution_setup->nyquist),
+                  accumulator, accumulator + bins_number, block_size);
+    rta_fft_real_execute(spectrum, spectrum, block_size,
+                         convolution_setup->inverse,
+                         &(convolution_setup->nyquist));
+
+    /* overlap-save: the last half is valid */
+    for(i=0; i<block_size; i++)
+    {
+      output[i * channels_number + c] =
+        convolution_setup->buffer[block_size + i];
+      history[i] = history[block_size + i];
+    }
+  }
+
+  convolution_setup->delay_index = (delay_index + 1) % partitions_number;
+  return;
+}
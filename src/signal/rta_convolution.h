@@ -0,0 +1,140 @@
+/**
+ * @file   rta_convolution.h
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 11:48:05 2026
+ * @ingroup rta_signal
+ *
+ * @brief  Uniformly partitioned FFT convolution (overlap-save)
+ *
+ * The filter is split into partitions of 'block_size' taps, whose
+ * spectra are computed at setup. Each input block is transformed once,
+ * with the previous one (overlap-save), and stored into a frequency
+ * domain delay line. The output block is the inverse transform of the
+ * sum of the products of the delayed input spectra by the filter
+ * spectra.
+ *
+ * The latency is 'block_size' samples and the cost per sample is
+ * O(log('block_size') + 'filter_size' / 'block_size'), instead of
+ * O('filter_size') for a direct convolution.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_CONVOLUTION_H_
+#define _RTA_CONVOLUTION_H_ 1
+
+#include "rta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* rta_convolution_setup is private (depends on implementation) */
+typedef struct rta_convolution_setup rta_convolution_setup_t;
+
+/**
+ * Allocate and initialize a partitioned convolution setup.
+ *
+ * \see rta_convolution_setup_delete
+ * \see rta_convolution_execute
+ *
+ * @param convolution_setup is an address of a pointer to a private
+ * structure, which is allocated and filled by this function.
+ * @param filters is an array of 'filters_number' * 'filter_size'
+ * taps. The filter of each channel is contiguous.
+ * @param filter_size is the number of taps of each filter
+ * @param filters_number is 1 to use the same filter for every
+ * channel, or 'channels_number'.
+ * @param block_size is the number of samples per channel processed by
+ * rta_convolution_execute, and the size of a partition.
+ * @param channels_number is the number of interleaved channels
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'convolution_setup' (even a delete).
+ */
+int
+rta_convolution_setup_new(rta_convolution_setup_t ** convolution_setup,
+                          const rta_real_t * filters,
+                          const unsigned int filter_size,
+                          const unsigned int filters_number,
+                          const unsigned int block_size,
+                          const unsigned int channels_number);
+
+/**
+ * Deallocate any (sucessfully) allocated convolution setup.
+ *
+ * \see rta_convolution_setup_new
+ *
+ * @param convolution_setup is a pointer to the memory wich will be
+ * released.
+ */
+void
+rta_convolution_setup_delete(rta_convolution_setup_t * convolution_setup);
+
+/**
+ * Replace the filters, which must have the same size and number as
+ * those of the setup. Nothing is allocated.
+ *
+ * @param convolution_setup is a previously allocated setup
+ * @param filters is an array of 'filters_number' * 'filter_size' taps.
+ */
+void
+rta_convolution_filters_set(rta_convolution_setup_t * convolution_setup,
+                            const rta_real_t * filters);
+
+/**
+ * Forget any previous input.
+ *
+ * @param convolution_setup is a previously allocated setup
+ */
+void
+rta_convolution_reset(rta_convolution_setup_t * convolution_setup);
+
+/**
+ * Convolve a block of input samples with the filters.
+ *
+ * \f$y(n) = \sum_{f=0}^{filter\_size-1} h(f) \cdot x(n-f)\f$
+ *
+ * @param output is an array of 'block_size' * 'channels_number'
+ * samples, with interleaved channels. It may be 'input'.
+ * @param input is an array of 'block_size' * 'channels_number'
+ * samples, with interleaved channels.
+ * @param convolution_setup is a previously allocated setup
+ */
+void
+rta_convolution_execute(rta_real_t * output, const rta_real_t * input,
+                        rta_convolution_setup_t * convolution_setup);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_CONVOLUTION_H_ */
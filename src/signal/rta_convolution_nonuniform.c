@@ -0,0 +1,519 @@
+/**
+ * @file   rta_convolution_nonuniform.c
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 14:20:37 2026
+ *
+ * @brief  Non-uniformly partitioned low-latency FFT convolution
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_convolution_nonuniform.h"
+#include "rta_convolution.h"
+#include "rta_stdlib.h" /* memory management */
+#include "rta_thread.h" /* worker thread */
+
+/* -------  private (depends on implementation) ------ */
+
+/* Tail stage of 'block_size' = 'ratio' * caller block size, starting at */
+/* 2 * 'block_size' in the filter: the block 'b' of the stage is */
+/* submitted when its last input sample is written, at caller block */
+/* ('b' + 1) * 'ratio', and its output is needed from caller block */
+/* ('b' + 2) * 'ratio'. Inputs and outputs are double-buffered, and */
+/* the slot of the block 'b' is ('b' % 2). */
+typedef struct rta_convolution_stage
+{
+  rta_convolution_setup_t * convolution;
+  unsigned int block_size;
+  unsigned int ratio;
+  unsigned int fill;         /**< samples of the block being written */
+  rta_real_t * inputs;       /**< 2 slots of 'block_size' frames */
+  rta_real_t * outputs;      /**< 2 slots of 'block_size' frames */
+  unsigned long submitted;   /**< blocks */
+  unsigned long completed;   /**< blocks */
+} rta_convolution_stage_t;
+
+struct rta_convolution_nonuniform_setup
+{
+  unsigned int block_size;
+  unsigned int channels_number;
+  rta_convolution_setup_t * head;
+  rta_convolution_stage_t * stages;
+  unsigned int stages_number;
+  unsigned long time;             /**< caller blocks */
+  unsigned long missed_deadlines;
+  int background;
+  int running;                    /**< worker thread started */
+  int quit;
+  rta_mutex_t mutex;
+  rta_condition_t work;           /**< to the worker */
+  rta_condition_t done;           /**< to the caller */
+  rta_thread_t worker;
+};
+
+static void
+stage_compute(rta_convolution_stage_t * stage,
+              const unsigned int channels_number)
+{
+  const unsigned int slot = (stage->completed % 2)
+    * stage->block_size * channels_number;
+
+  rta_convolution_execute(stage->outputs + slot, stage->inputs + slot,
+                          stage->convolution);
+  return;
+}
+
+/* earliest deadline first, among the stages with pending blocks */
+static RTA_THREAD_RETURN
+worker_run(void * argument)
+{
+  rta_convolution_nonuniform_setup_t * setup =
+    (rta_convolution_nonuniform_setup_t *) argument;
+  unsigned int s;
+
+  rta_mutex_lock(&setup->mutex);
+  while(setup->quit == 0)
+  {
+    rta_convolution_stage_t * stage = NULL;
+    unsigned long deadline = 0;
+
+    for(s=0; s<setup->stages_number; s++)
+    {
+      rta_convolution_stage_t * candidate = setup->stages + s;
+      if(candidate->completed < candidate->submitted &&
+         (stage == NULL ||
+          (candidate->completed + 2) * candidate->ratio < deadline))
+      {
+        stage = candidate;
+        deadline = (candidate->completed + 2) * candidate->ratio;
+      }
+    }
+
+    if(stage == NULL)
+    {
+      rta_condition_wait(&setup->work, &setup->mutex);
+    }
+    else
+    {
+      /* the caller does not touch the slots of a pending block */
+      rta_mutex_unlock(&setup->mutex);
+      stage_compute(stage, setup->channels_number);
+      rta_mutex_lock(&setup->mutex);
+      stage->completed++;
+      rta_condition_broadcast(&setup->done);
+    }
+  }
+  rta_mutex_unlock(&setup->mutex);
+
+  return 0;
+}
+
+/* wait for every pending block */
+static void
+worker_wait(rta_convolution_nonuniform_setup_t * convolution_setup)
+{
+  unsigned int s;
+
+  rta_mutex_lock(&convolution_setup->mutex);
+  for(s=0; s<convolution_setup->stages_number; s++)
+  {
+    rta_convolution_stage_t * stage = convolution_setup->stages + s;
+    while(stage->completed < stage->submitted)
+    {
+      rta_condition_wait(&convolution_setup->done, &convolution_setup->mutex);
+    }
+  }
+  rta_mutex_unlock(&convolution_setup->mutex);
+  return;
+}
+
+/* ------- end of private ---------------------------- */
+
+/* ------- Public functions -------------------------- */
+
+int
+rta_convolution_nonuniform_setup_new(
+  rta_convolution_nonuniform_setup_t ** convolution_setup,
+  const rta_real_t * filters,
+  const unsigned int filter_size,
+  const unsigned int filters_number,
+  const unsigned int block_size,
+  const unsigned int channels_number,
+  const int background)
+{
+  int ret = 1;
+  unsigned int stage_begin[sizeof(unsigned long) * 8];
+  unsigned int stage_end[sizeof(unsigned long) * 8];
+  unsigned int stage_block_size[sizeof(unsigned long) * 8];
+  unsigned int stages_number = 0;
+  rta_real_t * segment = NULL;
+  unsigned int s;
+
+  *convolution_setup = (rta_convolution_nonuniform_setup_t *)
+    rta_malloc(sizeof(rta_convolution_nonuniform_setup_t));
+
+  if(*convolution_setup == NULL || filter_size == 0 || block_size == 0 ||
+     channels_number == 0 ||
+     (filters_number != 1 && filters_number != channels_number))
+  {
+    if(*convolution_setup != NULL)
+    {
+      rta_free(*convolution_setup);
+      *convolution_setup = NULL;
+    }
+    ret = 0;
+  }
+  else
+  {
+    unsigned int begin = 0;
+    unsigned int size = block_size;
+
+    /* head, then stages of 4 times larger partitions, beginning at */
+    /* twice their partition size, until the end of the filter */
+    while(begin < filter_size)
+    {
+      unsigned int end = filter_size;
+      if(4 * size <= RTA_CONVOLUTION_NONUNIFORM_MAX_BLOCK_SIZE &&
+         8 * size < filter_size)
+      {
+        end = 8 * size;
+      }
+
+      stage_begin[stages_number] = begin;
+      stage_end[stages_number] = end;
+      stage_block_size[stages_number] = size;
+      stages_number++;
+
+      begin = end;
+      size *= 4;
+    }
+
+    (*convolution_setup)->block_size = block_size;
+    (*convolution_setup)->channels_number = channels_number;
+    (*convolution_setup)->head = NULL;
+    (*convolution_setup)->stages_number = stages_number - 1;
+    (*convolution_setup)->background = (background != 0
+                                        && stages_number > 1);
+    (*convolution_setup)->running = 0;
+    (*convolution_setup)->quit = 0;
+    (*convolution_setup)->time = 0;
+    (*convolution_setup)->missed_deadlines = 0;
+
+    (*convolution_setup)->stages = (rta_convolution_stage_t *) rta_malloc(
+      stages_number * sizeof(rta_convolution_stage_t));
+    segment = (rta_real_t *) rta_malloc(
+      filters_number * filter_size * sizeof(rta_real_t));
+
+    if((*convolution_setup)->stages == NULL || segment == NULL)
+    {
+      (*convolution_setup)->stages_number = 0;
+      ret = 0;
+    }
+    else
+    {
+      for(s=0; s<(*convolution_setup)->stages_number; s++)
+      {
+        (*convolution_setup)->stages[s].convolution = NULL;
+        (*convolution_setup)->stages[s].inputs = NULL;
+        (*convolution_setup)->stages[s].outputs = NULL;
+      }
+    }
+  }
+
+  /* the head and the tail stages convolve their segment of the filters */
+  for(s=0; ret != 0 && s<stages_number; s++)
+  {
+    const unsigned int segment_size = stage_end[s] - stage_begin[s];
+    rta_convolution_setup_t ** convolution = (s == 0 ?
+      &((*convolution_setup)->head) :
+      &((*convolution_setup)->stages[s-1].convolution));
+    unsigned int f, i;
+
+    for(f=0; f<filters_number; f++)
+    {
+      for(i=0; i<segment_size; i++)
+      {
+        segment[f * segment_size + i] =
+          filters[f * filter_size + stage_begin[s] + i];
+      }
+    }
+
+    ret = rta_convolution_setup_new(convolution, segment, segment_size,
+                                    filters_number, stage_block_size[s],
+                                    channels_number);
+    if(ret == 0)
+    {
+      *convolution = NULL;
+    }
+    else if(s > 0)
+    {
+      rta_convolution_stage_t * stage = (*convolution_setup)->stages + s-1;
+      stage->block_size = stage_block_size[s];
+      stage->ratio = stage_block_size[s] / block_size;
+      stage->inputs = (rta_real_t *) rta_malloc(
+        2 * stage->block_size * channels_number * sizeof(rta_real_t));
+      stage->outputs = (rta_real_t *) rta_malloc(
+        2 * stage->block_size * channels_number * sizeof(rta_real_t));
+
+      if(stage->inputs == NULL || stage->outputs == NULL)
+      {
+        ret = 0;
+      }
+    }
+  }
+
+  if(segment != NULL)
+  {
+    rta_free(segment);
+  }
+
+  if(ret != 0)
+  {
+    rta_convolution_nonuniform_reset(*convolution_setup);
+  }
+
+  if(ret != 0 && (*convolution_setup)->background != 0)
+  {
+    if(rta_mutex_init(&((*convolution_setup)->mutex)) == 0)
+    {
+      ret = 0;
+    }
+    else if(rta_condition_init(&((*convolution_setup)->work)) == 0)
+    {
+      rta_mutex_destroy(&((*convolution_setup)->mutex));
+      ret = 0;
+    }
+    else if(rta_condition_init(&((*convolution_setup)->done)) == 0)
+    {
+      rta_condition_destroy(&((*convolution_setup)->work));
+      rta_mutex_destroy(&((*convolution_setup)->mutex));
+      ret = 0;
+    }
+    else
+    {
+      (*convolution_setup)->running =
+        rta_thread_create(&((*convolution_setup)->worker), worker_run,
+                          *convolution_setup);
+      if((*convolution_setup)->running == 0)
+      {
+        rta_condition_destroy(&((*convolution_setup)->done));
+        rta_condition_destroy(&((*convolution_setup)->work));
+        rta_mutex_destroy(&((*convolution_setup)->mutex));
+        ret = 0;
+      }
+    }
+  }
+
+  if(ret == 0 && *convolution_setup != NULL)
+  {
+    rta_convolution_nonuniform_setup_delete(*convolution_setup);
+    *convolution_setup = NULL;
+  }
+
+  return ret;
+}
+
+void
+rta_convolution_nonuniform_setup_delete(
+  rta_convolution_nonuniform_setup_t * convolution_setup)
+{
+  unsigned int s;
+
+  if(convolution_setup != NULL)
+  {
+    if(convolution_setup->running != 0)
+    {
+      rta_mutex_lock(&convolution_setup->mutex);
+      convolution_setup->quit = 1;
+      rta_condition_signal(&convolution_setup->work);
+      rta_mutex_unlock(&convolution_setup->mutex);
+
+      rta_thread_join(convolution_setup->worker);
+      rta_condition_destroy(&convolution_setup->done);
+      rta_condition_destroy(&convolution_setup->work);
+      rta_mutex_destroy(&convolution_setup->mutex);
+    }
+
+    if(convolution_setup->head != NULL)
+    {
+      rta_convolution_setup_delete(convolution_setup->head);
+    }
+
+    if(convolution_setup->stages != NULL)
+    {
+      for(s=0; s<convolution_setup->stages_number; s++)
+      {
+        if(convolution_setup->stages[s].convolution != NULL)
+        {
+          rta_convolution_setup_delete(convolution_setup->stages[s].convolution);
+        }
+
+        if(convolution_setup->stages[s].inputs != NULL)
+        {
+          rta_free(convolution_setup->stages[s].inputs);
+        }
+
+        if(convolution_setup->stages[s].outputs != NULL)
+        {
+          rta_free(convolution_setup->stages[s].outputs);
+        }
+      }
+      rta_free(convolution_setup->stages);
+    }
+
+    rta_free(convolution_setup);
+  }
+
+  return;
+}
+
+void
+rta_convolution_nonuniform_reset(
+  rta_convolution_nonuniform_setup_t * convolution_setup)
+{
+  unsigned int s;
+
+  if(convolution_setup->running != 0)
+  {
+    worker_wait(convolution_setup);
+  }
+
+  rta_convolution_reset(convolution_setup->head);
+
+  for(s=0; s<convolution_setup->stages_number; s++)
+  {
+    rta_convolution_stage_t * stage = convolution_setup->stages + s;
+    rta_convolution_reset(stage->convolution);
+    stage->fill = 0;
+    stage->submitted = 0;
+    stage->completed = 0;
+  }
+
+  convolution_setup->time = 0;
+  convolution_setup->missed_deadlines = 0;
+  return;
+}
+
+void
+rta_convolution_nonuniform_execute(
+  rta_real_t * output, const rta_real_t * input,
+  rta_convolution_nonuniform_setup_t * convolution_setup)
+{
+  const unsigned int channels_number = convolution_setup->channels_number;
+  const unsigned int frame_size = convolution_setup->block_size
+    * channels_number;
+  const unsigned long time = convolution_setup->time;
+  unsigned int s, i;
+
+  for(s=0; s<convolution_setup->stages_number; s++)
+  {
+    rta_convolution_stage_t * stage = convolution_setup->stages + s;
+    const unsigned int stage_frame_size = stage->block_size * channels_number;
+    rta_real_t * stage_input;
+
+    /* deadline of the block 'time' / 'ratio' - 2, whose slot is also */
+    /* the one of the next input block */
+    if(convolution_setup->running != 0 && time % stage->ratio == 0 &&
+       time >= 2 * stage->ratio)
+    {
+      const unsigned long needed = time / stage->ratio - 1;
+
+      rta_mutex_lock(&convolution_setup->mutex);
+      if(stage->completed < needed)
+      {
+        convolution_setup->missed_deadlines++;
+        while(stage->completed < needed)
+        {
+          rta_condition_wait(&convolution_setup->done, &convolution_setup->mutex);
+        }
+      }
+      rta_mutex_unlock(&convolution_setup->mutex);
+    }
+
+    /* before the head, as 'output' may be 'input' */
+    stage_input = stage->inputs + (stage->submitted % 2) * stage_frame_size
+      + stage->fill * channels_number;
+    for(i=0; i<frame_size; i++)
+    {
+      stage_input[i] = input[i];
+    }
+    stage->fill += convolution_setup->block_size;
+  }
+
+  rta_convolution_execute(output, input, convolution_setup->head);
+
+  for(s=0; s<convolution_setup->stages_number; s++)
+  {
+    rta_convolution_stage_t * stage = convolution_setup->stages + s;
+
+    if(time >= 2 * stage->ratio)
+    {
+      const unsigned long block = time / stage->ratio - 2;
+      const rta_real_t * stage_output = stage->outputs
+        + (block % 2) * stage->block_size * channels_number
+        + (time % stage->ratio) * frame_size;
+
+      for(i=0; i<frame_size; i++)
+      {
+        output[i] += stage_output[i];
+      }
+    }
+
+    /* submit a complete block, after its slot has been output */
+    if(stage->fill == stage->block_size)
+    {
+      stage->fill = 0;
+      if(convolution_setup->running != 0)
+      {
+        rta_mutex_lock(&convolution_setup->mutex);
+        stage->submitted++;
+        rta_condition_signal(&convolution_setup->work);
+        rta_mutex_unlock(&convolution_setup->mutex);
+      }
+      else
+      {
+        stage_compute(stage, channels_number);
+        stage->submitted++;
+        stage->completed++;
+      }
+    }
+  }
+
+  convolution_setup->time++;
+  return;
+}
+
+unsigned long
+rta_convolution_nonuniform_missed_deadlines(
+  const rta_convolution_nonuniform_setup_t * convolution_setup)
+{
+  return convolution_setup->missed_deadlines;
+}
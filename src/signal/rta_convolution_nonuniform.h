@@ -0,0 +1,164 @@
+/**
+ * @file   rta_convolution_nonuniform.h
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 14:20:37 2026
+ * @ingroup rta_signal
+ *
+ * @brief  Non-uniformly partitioned low-latency FFT convolution
+ *
+ * The filter is split into stages of growing partition sizes
+ * (Gardner). The head of the filter uses partitions of 'block_size'
+ * taps, convolved in the thread of the caller, with a latency of one
+ * block. Each further stage uses partitions 4 times larger, up to
+ * RTA_CONVOLUTION_NONUNIFORM_MAX_BLOCK_SIZE, and starts at twice its
+ * partition size within the filter, which leaves a whole partition
+ * period to compute each block of the stage.
+ *
+ * In background mode, these tail stages are computed by a worker
+ * thread, which always computes the pending block with the earliest
+ * deadline. When a block is still not computed at its deadline, the
+ * caller waits for it and counts a missed deadline.
+ *
+ * \see rta_convolution.h
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_CONVOLUTION_NONUNIFORM_H_
+#define _RTA_CONVOLUTION_NONUNIFORM_H_ 1
+
+#include "rta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** maximum partition size of the tail stages, in samples */
+#ifndef RTA_CONVOLUTION_NONUNIFORM_MAX_BLOCK_SIZE
+#define RTA_CONVOLUTION_NONUNIFORM_MAX_BLOCK_SIZE 16384
+#endif
+
+/* rta_convolution_nonuniform_setup is private (depends on implementation) */
+typedef struct rta_convolution_nonuniform_setup
+rta_convolution_nonuniform_setup_t;
+
+/**
+ * Allocate and initialize a non-uniformly partitioned convolution
+ * setup. In background mode, this starts the worker thread.
+ *
+ * \see rta_convolution_nonuniform_setup_delete
+ * \see rta_convolution_nonuniform_execute
+ *
+ * @param convolution_setup is an address of a pointer to a private
+ * structure, which is allocated and filled by this function.
+ * @param filters is an array of 'filters_number' * 'filter_size'
+ * taps. The filter of each channel is contiguous.
+ * @param filter_size is the number of taps of each filter
+ * @param filters_number is 1 to use the same filter for every
+ * channel, or 'channels_number'.
+ * @param block_size is the number of samples per channel processed by
+ * rta_convolution_nonuniform_execute, and the size of the first
+ * partitions.
+ * @param channels_number is the number of interleaved channels
+ * @param background is 1 to compute the tail stages in a worker
+ * thread, or 0 to compute them in the thread of the caller (for
+ * offline processing).
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'convolution_setup' (even a delete).
+ */
+int
+rta_convolution_nonuniform_setup_new(
+  rta_convolution_nonuniform_setup_t ** convolution_setup,
+  const rta_real_t * filters,
+  const unsigned int filter_size,
+  const unsigned int filters_number,
+  const unsigned int block_size,
+  const unsigned int channels_number,
+  const int background);
+
+/**
+ * Deallocate any (sucessfully) allocated convolution setup, after
+ * stopping its worker thread.
+ *
+ * \see rta_convolution_nonuniform_setup_new
+ *
+ * @param convolution_setup is a pointer to the memory wich will be
+ * released.
+ */
+void
+rta_convolution_nonuniform_setup_delete(
+  rta_convolution_nonuniform_setup_t * convolution_setup);
+
+/**
+ * Forget any previous input, and clear the missed deadlines
+ * counter. This waits for the pending blocks of the worker thread.
+ *
+ * @param convolution_setup is a previously allocated setup
+ */
+void
+rta_convolution_nonuniform_reset(
+  rta_convolution_nonuniform_setup_t * convolution_setup);
+
+/**
+ * Convolve a block of input samples with the filters.
+ *
+ * \f$y(n) = \sum_{f=0}^{filter\_size-1} h(f) \cdot x(n-f)\f$
+ *
+ * @param output is an array of 'block_size' * 'channels_number'
+ * samples, with interleaved channels. It may be 'input'.
+ * @param input is an array of 'block_size' * 'channels_number'
+ * samples, with interleaved channels.
+ * @param convolution_setup is a previously allocated setup
+ */
+void
+rta_convolution_nonuniform_execute(
+  rta_real_t * output, const rta_real_t * input,
+  rta_convolution_nonuniform_setup_t * convolution_setup);
+
+/**
+ * Number of tail blocks that were not computed by the worker thread
+ * at their deadline, since the setup or the last reset. It is only
+ * updated by rta_convolution_nonuniform_execute.
+ *
+ * @param convolution_setup is a previously allocated setup
+ *
+ * @return the number of missed deadlines
+ */
+unsigned long
+rta_convolution_nonuniform_missed_deadlines(
+  const rta_convolution_nonuniform_setup_t * convolution_setup);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_CONVOLUTION_NONUNIFORM_H_ */
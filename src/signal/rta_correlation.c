@@ -37,6 +37,10 @@
  */
 
 #include "rta_correlation.h"
+#include "rta_fft.h"
+#include "rta_complex.h"
+#include "rta_stdlib.h" /* memory management */
+#include "rta_int.h"    /* integer log2 function */
 
 
 /* specific implementations */
@@ -323,3 +327,345 @@ void rta_correlation_raw_scaled_stride(
   return;
 }
 
+/* -------  FFT-based correlation ------ */
+
+struct rta_correlation_setup
+{
+  unsigned int c_size;
+  unsigned int filter_size;
+  unsigned int fft_size;
+  unsigned int fft_log2;
+  rta_real_t * spectrum_a; /**< split: fft_size/2 real, then imaginary */
+  rta_real_t * spectrum_b; /**< split: fft_size/2 real, then imaginary */
+  rta_real_t * buffer;     /**< correlation, of fft_size */
+  rta_real_t nyquist_a;
+  rta_real_t nyquist_b;
+  rta_real_t forward_scale;
+  rta_real_t inverse_scale;
+  rta_fft_setup_t * forward;
+  rta_fft_setup_t * inverse;
+};
+
+/* direct cost against the cost of 3 real transforms, for sizes */
+/* within those of the setup (the direct algorithm is used otherwise) */
+static int
+correlation_fft_is_faster(const unsigned int c_size,
+                          const unsigned int filter_size,
+                          const rta_correlation_setup_t * correlation_setup)
+{
+  return (c_size <= correlation_setup->c_size &&
+          filter_size <= correlation_setup->filter_size &&
+          (double) c_size * filter_size >
+          (double) RTA_CORRELATION_FFT_CROSSOVER
+          * correlation_setup->fft_size * correlation_setup->fft_log2);
+}
+
+/* 'correlation_setup->buffer' = IFFT(A * conj(B)), the product being */
+/* in 'correlation_setup->spectrum_a' */
+static void
+correlation_spectra(const rta_real_t * spectrum_a_real,
+                    const rta_real_t * spectrum_a_imag,
+                    const rta_real_t nyquist_a,
+                    const rta_real_t * spectrum_b_real,
+                    const rta_real_t * spectrum_b_imag,
+                    const rta_real_t nyquist_b,
+                    rta_correlation_setup_t * correlation_setup)
+{
+  const unsigned int spectrum_size = correlation_setup->fft_size/2;
+  rta_real_t * product_real = correlation_setup->spectrum_a;
+  rta_real_t * product_imag = correlation_setup->spectrum_a + spectrum_size;
+  unsigned int i;
+
+  /* A * conj(B), on split arrays */
+  for(i=0; i<spectrum_size; i++)
+  {
+    const rta_real_t a_real = spectrum_a_real[i];
+    const rta_real_t a_imag = spectrum_a_imag[i];
+    const rta_real_t b_real = spectrum_b_real[i];
+    const rta_real_t b_imag = spectrum_b_imag[i];
+
+    product_real[i] = a_real * b_real + a_imag * b_imag;
+    product_imag[i] = a_imag * b_real - a_real * b_imag;
+  }
+  correlation_setup->nyquist_a = nyquist_a * nyquist_b;
+
+  rta_fft_split_real_execute(correlation_setup->buffer, NULL,
+                             product_real, product_imag, spectrum_size,
+                             correlation_setup->inverse,
+                             &(correlation_setup->nyquist_a));
+  return;
+}
+
+/* 'correlation_setup->buffer' = C(i) for i in [0, 'c_size') */
+/* where A is zero after 'a_size' samples, and B after 'b_size' */
+static void
+correlation_fft(const rta_real_t * input_vector_a, const unsigned int a_size,
+                const rta_real_t * input_vector_b, const unsigned int b_size,
+                rta_correlation_setup_t * correlation_setup)
+{
+  const unsigned int spectrum_size = correlation_setup->fft_size/2;
+  rta_real_t * spectrum_a = correlation_setup->spectrum_a;
+  rta_real_t * spectrum_b = correlation_setup->spectrum_b;
+  rta_real_t * buffer = correlation_setup->buffer;
+  unsigned int i;
+
+  /* the inputs are copied into the buffer (of 'fft_size'), which the */
+  /* transforms zero-pad */
+  for(i=0; i<a_size; i++)
+  {
+    buffer[i] = input_vector_a[i];
+  }
+  rta_fft_split_real_execute(spectrum_a, spectrum_a + spectrum_size,
+                             buffer, NULL, a_size,
+                             correlation_setup->forward,
+                             &(correlation_setup->nyquist_a));
+
+  for(i=0; i<b_size; i++)
+  {
+    buffer[i] = input_vector_b[i];
+  }
+  rta_fft_split_real_execute(spectrum_b, spectrum_b + spectrum_size,
+                             buffer, NULL, b_size,
+                             correlation_setup->forward,
+                             &(correlation_setup->nyquist_b));
+
+  correlation_spectra(spectrum_a, spectrum_a + spectrum_size,
+                      correlation_setup->nyquist_a,
+                      spectrum_b, spectrum_b + spectrum_size,
+                      correlation_setup->nyquist_b,
+                      correlation_setup);
+  return;
+}
+
+int
+rta_correlation_setup_new(rta_correlation_setup_t ** correlation_setup,
+                          const unsigned int c_size,
+                          const unsigned int filter_size)
+{
+  int ret = 1;
+  *correlation_setup = (rta_correlation_setup_t *)
+    rta_malloc(sizeof(rta_correlation_setup_t));
+
+  if(*correlation_setup == NULL || c_size == 0 || filter_size == 0)
+  {
+    if(*correlation_setup != NULL)
+    {
+      rta_free(*correlation_setup);
+      *correlation_setup = NULL;
+    }
+    ret = 0;
+  }
+  else
+  {
+    /* no circular overlap for any shift */
+    (*correlation_setup)->c_size = c_size;
+    (*correlation_setup)->filter_size = filter_size;
+    (*correlation_setup)->fft_size = rta_inextpow2(filter_size + c_size);
+    (*correlation_setup)->fft_log2 = rta_ilog2((*correlation_setup)->fft_size);
+    (*correlation_setup)->forward_scale = 1.;
+    (*correlation_setup)->inverse_scale =
+      1. / (*correlation_setup)->fft_size;
+    (*correlation_setup)->forward = NULL;
+    (*correlation_setup)->inverse = NULL;
+
+    (*correlation_setup)->spectrum_a = (rta_real_t *) rta_malloc(
+      (*correlation_setup)->fft_size * sizeof(rta_real_t));
+    (*correlation_setup)->spectrum_b = (rta_real_t *) rta_malloc(
+      (*correlation_setup)->fft_size * sizeof(rta_real_t));
+    (*correlation_setup)->buffer = (rta_real_t *) rta_malloc(
+      (*correlation_setup)->fft_size * sizeof(rta_real_t));
+
+    if((*correlation_setup)->spectrum_a == NULL ||
+       (*correlation_setup)->spectrum_b == NULL ||
+       (*correlation_setup)->buffer == NULL)
+    {
+      ret = 0;
+    }
+  }
+
+  if(ret != 0)
+  {
+    ret = rta_fft_split_setup_new(&((*correlation_setup)->forward),
+                                  rta_fft_real_to_complex_1d,
+                                  &((*correlation_setup)->forward_scale),
+                                  (*correlation_setup)->fft_size,
+                                  (*correlation_setup)->fft_size,
+                                  &((*correlation_setup)->nyquist_a));
+    if(ret == 0)
+    {
+      (*correlation_setup)->forward = NULL;
+    }
+  }
+
+  if(ret != 0)
+  {
+    ret = rta_fft_split_setup_new(&((*correlation_setup)->inverse),
+                                  rta_fft_complex_to_real_1d,
+                                  &((*correlation_setup)->inverse_scale),
+                                  (*correlation_setup)->fft_size/2,
+                                  (*correlation_setup)->fft_size,
+                                  &((*correlation_setup)->nyquist_a));
+    if(ret == 0)
+    {
+      (*correlation_setup)->inverse = NULL;
+    }
+  }
+
+  if(ret == 0 && *correlation_setup != NULL)
+  {
+    rta_correlation_setup_delete(*correlation_setup);
+    *correlation_setup = NULL;
+  }
+
+  return ret;
+}
+
+void
+rta_correlation_setup_delete(rta_correlation_setup_t * correlation_setup)
+{
+  if(correlation_setup != NULL)
+  {
+    if(correlation_setup->forward != NULL)
+    {
+      rta_fft_setup_delete(correlation_setup->forward);
+    }
+
+    if(correlation_setup->inverse != NULL)
+    {
+      rta_fft_setup_delete(correlation_setup->inverse);
+    }
+
+    if(correlation_setup->spectrum_a != NULL)
+    {
+      rta_free(correlation_setup->spectrum_a);
+    }
+
+    if(correlation_setup->spectrum_b != NULL)
+    {
+      rta_free(correlation_setup->spectrum_b);
+    }
+
+    if(correlation_setup->buffer != NULL)
+    {
+      rta_free(correlation_setup->buffer);
+    }
+
+    rta_free(correlation_setup);
+  }
+
+  return;
+}
+
+unsigned int
+rta_correlation_setup_fft_size(
+  const rta_correlation_setup_t * correlation_setup)
+{
+  return correlation_setup->fft_size;
+}
+
+/* Requirement: (a_size, b_size) >= c_size + filter_size */
+void rta_correlation_fast_fft(
+  rta_real_t * correlation, const unsigned int c_size,
+  const rta_real_t * input_vector_a,
+  const rta_real_t * input_vector_b,
+  const unsigned int filter_size,
+  rta_correlation_setup_t * correlation_setup)
+{
+  unsigned int c;
+
+  if(correlation_fft_is_faster(c_size, filter_size, correlation_setup))
+  {
+    correlation_fft(input_vector_a, c_size + filter_size - 1,
+                    input_vector_b, filter_size, correlation_setup);
+    for(c=0; c<c_size; c++)
+    {
+      correlation[c] = correlation_setup->buffer[c];
+    }
+  }
+  else
+  {
+    rta_correlation_fast(correlation, c_size, input_vector_a,
+                         input_vector_b, filter_size);
+  }
+  return;
+}
+
+/* Requirement: (a_size, b_size) >= max_filter_size > c_size */
+void rta_correlation_raw_fft(
+  rta_real_t * correlation, const unsigned int c_size,
+  const rta_real_t * input_vector_a,
+  const rta_real_t * input_vector_b,
+  const unsigned int max_filter_size,
+  rta_correlation_setup_t * correlation_setup)
+{
+  unsigned int c;
+
+  if(correlation_fft_is_faster(c_size, max_filter_size, correlation_setup))
+  {
+    correlation_fft(input_vector_a, max_filter_size,
+                    input_vector_b, max_filter_size, correlation_setup);
+    for(c=0; c<c_size; c++)
+    {
+      correlation[c] = correlation_setup->buffer[c];
+    }
+  }
+  else
+  {
+    rta_correlation_raw(correlation, c_size, input_vector_a,
+                        input_vector_b, max_filter_size);
+  }
+  return;
+}
+
+/* Requirements: (a_size, b_size) >= max_filter_size > c_size */
+void rta_correlation_unbiased_fft(
+  rta_real_t * correlation, const unsigned int c_size,
+  const rta_real_t * input_vector_a,
+  const rta_real_t * input_vector_b,
+  const unsigned int max_filter_size,
+  rta_correlation_setup_t * correlation_setup)
+{
+  unsigned int c;
+
+  if(correlation_fft_is_faster(c_size, max_filter_size, correlation_setup))
+  {
+    correlation_fft(input_vector_a, max_filter_size,
+                    input_vector_b, max_filter_size, correlation_setup);
+    for(c=0; c<c_size; c++)
+    {
+      correlation[c] = correlation_setup->buffer[c]
+        / (rta_real_t) (max_filter_size - c);
+    }
+  }
+  else
+  {
+    rta_correlation_unbiased(correlation, c_size, input_vector_a,
+                             input_vector_b, max_filter_size);
+  }
+  return;
+}
+
+void rta_correlation_split_fft(
+  rta_real_t * correlation, const unsigned int c_size,
+  const rta_real_t * spectrum_a_real, const rta_real_t * spectrum_a_imag,
+  const rta_real_t nyquist_a,
+  const rta_real_t * spectrum_b_real, const rta_real_t * spectrum_b_imag,
+  const rta_real_t nyquist_b,
+  rta_correlation_setup_t * correlation_setup)
+{
+  unsigned int c;
+
+  correlation_spectra(spectrum_a_real, spectrum_a_imag, nyquist_a,
+                      spectrum_b_real, spectrum_b_imag, nyquist_b,
+                      correlation_setup);
+  for(c=0; c<c_size && c<correlation_setup->c_size; c++)
+  {
+    correlation[c] = correlation_setup->buffer[c];
+  }
+  /* clamp to the 'c_size' of the setup */
+  for(; c<c_size; c++)
+  {
+    correlation[c] = 0.;
+  }
+  return;
+}
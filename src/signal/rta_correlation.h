@@ -365,6 +365,168 @@ rta_correlation_raw_scaled_stride(
   const rta_real_t * input_vector_b, const int b_stride,
   const unsigned int max_filter_size, const rta_real_t scale);
 
+/** The FFT path is used when 'c_size' * 'filter_size' >
+ * RTA_CORRELATION_FFT_CROSSOVER * fft_size * log2(fft_size) */
+#ifndef RTA_CORRELATION_FFT_CROSSOVER
+#define RTA_CORRELATION_FFT_CROSSOVER 1
+#endif
+
+/* rta_correlation_setup is private (depends on implementation) */
+typedef struct rta_correlation_setup rta_correlation_setup_t;
+
+/**
+ * Allocate and initialize a correlation setup, which holds the FFT
+ * setups and the buffers of rta_correlation_fast_fft,
+ * rta_correlation_raw_fft and rta_correlation_unbiased_fft. Nothing
+ * is allocated by these functions.
+ *
+ * \see rta_correlation_setup_delete
+ *
+ * @param correlation_setup is an address of a pointer to a private
+ * structure, which is allocated and filled by this function.
+ * @param c_size is the maximum 'correlation' order + 1
+ * @param filter_size is the maximum 'filter_size' or
+ * 'max_filter_size' of the correlations
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'correlation_setup' (even a delete).
+ */
+int
+rta_correlation_setup_new(rta_correlation_setup_t ** correlation_setup,
+                          const unsigned int c_size,
+                          const unsigned int filter_size);
+
+/**
+ * Deallocate any (sucessfully) allocated correlation setup.
+ *
+ * \see rta_correlation_setup_new
+ *
+ * @param correlation_setup is a pointer to the memory wich will be
+ * released.
+ */
+void
+rta_correlation_setup_delete(rta_correlation_setup_t * correlation_setup);
+
+/**
+ * Size of the real transforms of a correlation setup, for the spectra
+ * of rta_correlation_split_fft.
+ *
+ * @param correlation_setup is a previously allocated setup
+ *
+ * @return the transforms size, a power of 2
+ */
+unsigned int
+rta_correlation_setup_fft_size(
+  const rta_correlation_setup_t * correlation_setup);
+
+/**
+ * Same as rta_correlation_fast, computed with a Fourier transform
+ * when it is faster than the direct algorithm.
+ *
+ * \f$C(i) = \sum_{f=0}^{filter\_size-1} A(f+i) \cdot B(f), i=\{0,c\_size-1\}\f$
+ *
+ * When 'c_size' or 'filter_size' is greater than the one of
+ * 'correlation_setup', the direct algorithm is used.
+ *
+ * @param correlation size is 'c_size'
+ * @param c_size is the 'correlation' order + 1, 'c_size' must be > 0
+ * @param input_vector_a size a_size must be >= 'c_size' + 'filter_size'
+ * @param input_vector_b size b_size must be >= 'c_size'
+ * @param filter_size is the maximum shift for 'input_vector_a'.
+ * @param correlation_setup is a previously allocated setup
+ */
+void
+rta_correlation_fast_fft(
+  rta_real_t * correlation, const unsigned int c_size,
+  const rta_real_t * input_vector_a,
+  const rta_real_t * input_vector_b,
+  const unsigned int filter_size,
+  rta_correlation_setup_t * correlation_setup);
+
+/**
+ * Same as rta_correlation_raw, computed with a Fourier transform
+ * when it is faster than the direct algorithm.
+ *
+ * \f$C(i) = \sum_{f=0}^{max\_filter\_size-i} A(f+i) \cdot B(f), i=\{0,c\_size-1\}\f$
+ *
+ * When 'c_size' or 'max_filter_size' is greater than the 'c_size' or
+ * 'filter_size' of 'correlation_setup', the direct algorithm is used.
+ *
+ * @param correlation size is 'c_size'
+ * @param c_size is the 'correlation' order + 1, 'c_size' must be > 0
+ * @param input_vector_a size a_size must be >= 'max_filter_size'
+ * @param input_vector_b size b_size must be >= 'max_filter_size'
+ * @param max_filter_size is the maximum shift for 'input_vector_a'.
+ * 'max_filter_size' must be > 'c_size'.
+ * @param correlation_setup is a previously allocated setup
+ */
+void
+rta_correlation_raw_fft(
+  rta_real_t * correlation, const unsigned int c_size,
+  const rta_real_t * input_vector_a,
+  const rta_real_t * input_vector_b,
+  const unsigned int max_filter_size,
+  rta_correlation_setup_t * correlation_setup);
+
+/**
+ * Same as rta_correlation_unbiased, computed with a Fourier transform
+ * when it is faster than the direct algorithm.
+ *
+ * \f$C(i) = \frac{1}{max\_filter\_size-i} \sum_{f=0}^{max\_filter\_size-i} A(f+i) \cdot B(f), i=\{0,c\_size-1\}\f$
+ *
+ * When 'c_size' or 'max_filter_size' is greater than the 'c_size' or
+ * 'filter_size' of 'correlation_setup', the direct algorithm is used.
+ *
+ * @param correlation size is 'c_size'
+ * @param c_size is the 'correlation' order + 1, 'c_size' must be > 0
+ * @param input_vector_a size a_size must be >= 'max_filter_size'
+ * @param input_vector_b size b_size must be >= 'max_filter_size'
+ * @param max_filter_size is the maximum shift for 'input_vector_a'.
+ * 'max_filter_size' must be > 'c_size'.
+ * @param correlation_setup is a previously allocated setup
+ */
+void
+rta_correlation_unbiased_fft(
+  rta_real_t * correlation, const unsigned int c_size,
+  const rta_real_t * input_vector_a,
+  const rta_real_t * input_vector_b,
+  const unsigned int max_filter_size,
+  rta_correlation_setup_t * correlation_setup);
+
+/**
+ * Correlation from the spectra of the input vectors, in split complex
+ * format, as computed by a direct real transform (see
+ * rta_fft_split_setup_new) of rta_correlation_setup_fft_size points,
+ * with zero-padding. This is the inverse transform of A * conj(B),
+ * without any normalisation. With A of 'c_size' + 'filter_size' - 1
+ * samples and B of 'filter_size' samples, this is
+ * rta_correlation_fast.
+ *
+ * The spectra of a pipeline are thus reused, without any conversion
+ * to rta_complex_t.
+ *
+ * \f$C(i) = \sum_{f} A(f+i) \cdot B(f), i=\{0,c\_size-1\}\f$
+ *
+ * @param correlation size is 'c_size'
+ * @param c_size is the 'correlation' order + 1, 'c_size' must be >
+ * 0. The values after the 'c_size' of 'correlation_setup' are 0.
+ * @param spectrum_a_real size is rta_correlation_setup_fft_size / 2
+ * @param spectrum_a_imag size is rta_correlation_setup_fft_size / 2
+ * @param nyquist_a is the Nyquist value of the spectrum of A
+ * @param spectrum_b_real size is rta_correlation_setup_fft_size / 2
+ * @param spectrum_b_imag size is rta_correlation_setup_fft_size / 2
+ * @param nyquist_b is the Nyquist value of the spectrum of B
+ * @param correlation_setup is a previously allocated setup
+ */
+void
+rta_correlation_split_fft(
+  rta_real_t * correlation, const unsigned int c_size,
+  const rta_real_t * spectrum_a_real, const rta_real_t * spectrum_a_imag,
+  const rta_real_t nyquist_a,
+  const rta_real_t * spectrum_b_real, const rta_real_t * spectrum_b_imag,
+  const rta_real_t nyquist_b,
+  rta_correlation_setup_t * correlation_setup);
+
 #ifdef __cplusplus
 }
 #endif
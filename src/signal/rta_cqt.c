@@ -0,0 +1,644 @@
+/**
+ * @file   rta_cqt.c
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 17:05:48 2026
+ *
+ * @brief  Constant-Q transform
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_cqt.h"
+#include "rta_fft.h"
+#include "rta_resample.h" /* rta_downsample_int_mean */
+#include "rta_window.h" /* rta_window_hann_weights */
+#include "rta_int.h" /* rta_inextpow2 */
+#include "rta_stdlib.h" /* memory management */
+#include "rta_math.h" /* M_PI, cos, sin, pow, rta_sqrt */
+#include "rta_simd.h" /* rta_simd_level */
+
+/* x86 vector products, selected according to the CPU */
+#if defined(RTA_SIMD_X86) && \
+  (RTA_REAL_TYPE == RTA_FLOAT_TYPE || RTA_REAL_TYPE == RTA_DOUBLE_TYPE)
+#define RTA_CQT_SIMD 1
+#include <immintrin.h>
+#endif
+
+/* -------  private (depends on implementation) ------ */
+
+/* complex dot product of 'size' values, in split format */
+typedef void (*cqt_product_function)
+(rta_real_t * real, rta_real_t * imag,
+ const rta_real_t * x_real, const rta_real_t * x_imag,
+ const rta_real_t * k_real, const rta_real_t * k_imag,
+ const unsigned int size);
+
+struct rta_cqt_setup
+{
+  unsigned int bins_number;
+  unsigned int bins_per_octave;
+  unsigned int octaves_number; /**< 1 without decimation */
+  unsigned int rows_number;    /**< kernels: bins_number, or one octave */
+  unsigned int fft_size;       /**< of the kernels */
+  unsigned int frame_size;     /**< fft_size * 2^(octaves_number - 1) */
+  unsigned int * bounds;       /**< first and end FFT bins, by row */
+  unsigned int * offsets;      /**< first value of each row, and end */
+  rta_real_t * kernel_real;    /**< conj(T_k(j)) / fft_size */
+  rta_real_t * kernel_imag;
+  rta_complex_t * phases;      /**< decimation delays, by bin, or NULL */
+  rta_complex_t * cqt;         /**< bins_number, for the magnitudes */
+  rta_real_t * spectrum_real;  /**< fft_size / 2 */
+  rta_real_t * spectrum_imag;
+  rta_real_t * segment;        /**< fft_size, copy of the FFT input */
+  rta_real_t * decimated;      /**< octaves 1 and lower, one after another */
+  rta_real_t nyquist;
+  rta_real_t scale;
+  rta_fft_setup_t * fft_setup;
+  cqt_product_function product;
+};
+
+static void
+cqt_product(rta_real_t * real, rta_real_t * imag,
+            const rta_real_t * x_real, const rta_real_t * x_imag,
+            const rta_real_t * k_real, const rta_real_t * k_imag,
+            const unsigned int size)
+{
+  rta_real_t re = 0.;
+  rta_real_t im = 0.;
+  unsigned int j;
+
+  for(j=0; j<size; j++)
+  {
+    re += x_real[j] * k_real[j] - x_imag[j] * k_imag[j];
+    im += x_real[j] * k_imag[j] + x_imag[j] * k_real[j];
+  }
+  *real = re;
+  *imag = im;
+  return;
+}
+
+#if defined(RTA_CQT_SIMD)
+
+/* see cqt_product */
+#define CQT_SIMD_PRODUCT(name, isa, vector_t, width, \
+                         loadu, storeu, set1, add, sub, mul) \
+static void __attribute__((target(isa))) \
+name(rta_real_t * real, rta_real_t * imag, \
+     const rta_real_t * x_real, const rta_real_t * x_imag, \
+     const rta_real_t * k_real, const rta_real_t * k_imag, \
+     const unsigned int size) \
+{ \
+  vector_t re = set1(0.); \
+  vector_t im = set1(0.); \
+  rta_real_t r[width]; \
+  rta_real_t i[width]; \
+  rta_real_t sum_re = 0.; \
+  rta_real_t sum_im = 0.; \
+  unsigned int j; \
+  \
+  for(j=0; j+(width)<=size; j+=(width)) \
+  { \
+    const vector_t xr = loadu(x_real + j); \
+    const vector_t xi = loadu(x_imag + j); \
+    const vector_t kr = loadu(k_real + j); \
+    const vector_t ki = loadu(k_imag + j); \
+    re = add(re, sub(mul(xr, kr), mul(xi, ki))); \
+    im = add(im, add(mul(xr, ki), mul(xi, kr))); \
+  } \
+  for(; j<size; j++) \
+  { \
+    sum_re += x_real[j] * k_real[j] - x_imag[j] * k_imag[j]; \
+    sum_im += x_real[j] * k_imag[j] + x_imag[j] * k_real[j]; \
+  } \
+  storeu(r, re); \
+  storeu(i, im); \
+  for(j=0; j<(width); j++) \
+  { \
+    sum_re += r[j]; \
+    sum_im += i[j]; \
+  } \
+  *real = sum_re; \
+  *imag = sum_im; \
+  return; \
+}
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE)
+
+CQT_SIMD_PRODUCT(cqt_product_sse2, "sse2", __m128, 4,
+                 _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps,
+                 _mm_add_ps, _mm_sub_ps, _mm_mul_ps)
+CQT_SIMD_PRODUCT(cqt_product_avx2, "avx2", __m256, 8,
+                 _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps,
+                 _mm256_add_ps, _mm256_sub_ps, _mm256_mul_ps)
+CQT_SIMD_PRODUCT(cqt_product_avx512, "avx512f", __m512, 16,
+                 _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps,
+                 _mm512_add_ps, _mm512_sub_ps, _mm512_mul_ps)
+
+#else /* double */
+
+CQT_SIMD_PRODUCT(cqt_product_sse2, "sse2", __m128d, 2,
+                 _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd,
+                 _mm_add_pd, _mm_sub_pd, _mm_mul_pd)
+CQT_SIMD_PRODUCT(cqt_product_avx2, "avx2", __m256d, 4,
+                 _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd,
+                 _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd)
+CQT_SIMD_PRODUCT(cqt_product_avx512, "avx512f", __m512d, 8,
+                 _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd,
+                 _mm512_add_pd, _mm512_sub_pd, _mm512_mul_pd)
+
+#endif /* RTA_REAL_TYPE */
+
+#endif /* RTA_CQT_SIMD */
+
+static cqt_product_function
+cqt_product_select(void)
+{
+  cqt_product_function product = cqt_product;
+#if defined(RTA_CQT_SIMD)
+  switch(rta_simd_level())
+  {
+    case rta_simd_avx512:
+      product = cqt_product_avx512;
+      break;
+    case rta_simd_avx2:
+      product = cqt_product_avx2;
+      break;
+    case rta_simd_sse2:
+      product = cqt_product_sse2;
+      break;
+    default:
+      break;
+  }
+#endif
+  return product;
+}
+
+/* frequency of a kernel row, in Hz */
+static double
+cqt_row_frequency(const rta_cqt_setup_t * cqt_setup,
+                  const double min_frequency, const unsigned int row)
+{
+  /* the rows are the highest octave, with decimation */
+  const unsigned int bin =
+    row + cqt_setup->bins_number - cqt_setup->rows_number;
+  return min_frequency * pow(2., (double) bin / cqt_setup->bins_per_octave);
+}
+
+/*
+ * Spectral kernels, as rows of FFT bins [bounds[2r], bounds[2r+1]),
+ * whose values start at offsets[r]. 'real' and 'imag' are 'fft_size'
+ * values of work, and 'window' too.
+ */
+static int
+cqt_kernels_new(rta_cqt_setup_t * cqt_setup,
+                const double sample_rate, const double min_frequency,
+                const double q, const rta_real_t threshold,
+                rta_real_t * real, rta_real_t * imag, rta_real_t * window)
+{
+  const unsigned int size = cqt_setup->fft_size;
+  const unsigned int half = size / 2;
+  rta_fft_setup_t * fft_setup = NULL;
+  rta_real_t one = 1.;
+  unsigned int pass, r, j;
+  unsigned int values = 0;
+  int ret = rta_fft_split_setup_new(&fft_setup, rta_fft_complex_1d, &one,
+                                    size, size, NULL);
+
+  /* first pass for the sizes, second one for the values */
+  for(pass=0; pass<2 && ret != 0; pass++)
+  {
+    values = 0;
+    for(r=0; r<cqt_setup->rows_number; r++)
+    {
+      const double frequency = cqt_row_frequency(cqt_setup, min_frequency, r);
+      unsigned int length = (unsigned int) ceil(q * sample_rate / frequency);
+      unsigned int offset;
+      rta_real_t maximum = 0.;
+      unsigned int first = half;
+      unsigned int end = 0;
+
+      length = (length < size ? length : size);
+      offset = (size - length) / 2;
+      rta_window_hann_weights(window, length);
+
+      for(j=0; j<size; j++)
+      {
+        real[j] = 0.;
+        imag[j] = 0.;
+      }
+
+      /* phase relative to the centre of the frame */
+      for(j=0; j<length; j++)
+      {
+        const double phase = 2. * M_PI * frequency *
+          ((double) (offset + j) - half) / sample_rate;
+        real[offset + j] = window[j] * cos(phase) / length;
+        imag[offset + j] = window[j] * sin(phase) / length;
+      }
+
+      rta_fft_split_execute(real, imag, real, imag, size, fft_setup);
+
+      /* magnitudes in 'window', on the positive frequencies */
+      for(j=0; j<half; j++)
+      {
+        window[j] = rta_sqrt(real[j] * real[j] + imag[j] * imag[j]);
+        maximum = (window[j] > maximum ? window[j] : maximum);
+      }
+
+      for(j=0; j<half; j++)
+      {
+        if(window[j] > 0. && window[j] >= threshold * maximum)
+        {
+          first = (j < first ? j : first);
+          end = j + 1;
+        }
+      }
+
+      if(first >= end)
+      {
+        first = end = 0;
+      }
+
+      if(pass == 1)
+      {
+        cqt_setup->bounds[2 * r] = first;
+        cqt_setup->bounds[2 * r + 1] = end;
+        cqt_setup->offsets[r] = values;
+        for(j=first; j<end; j++)
+        {
+          cqt_setup->kernel_real[values + j - first] = real[j] / size;
+          cqt_setup->kernel_imag[values + j - first] = - imag[j] / size;
+        }
+      }
+      values += end - first;
+    }
+
+    if(pass == 0)
+    {
+      cqt_setup->kernel_real = (rta_real_t *) rta_malloc(
+        (values > 0 ? values : 1) * sizeof(rta_real_t));
+      cqt_setup->kernel_imag = (rta_real_t *) rta_malloc(
+        (values > 0 ? values : 1) * sizeof(rta_real_t));
+      if(cqt_setup->kernel_real == NULL || cqt_setup->kernel_imag == NULL)
+      {
+        ret = 0;
+      }
+    }
+  }
+
+  if(ret != 0)
+  {
+    cqt_setup->offsets[cqt_setup->rows_number] = values;
+  }
+
+  if(fft_setup != NULL)
+  {
+    rta_fft_setup_delete(fft_setup);
+  }
+
+  return ret;
+}
+
+/* the rows of octave 'octave' (0 is the highest), into 'cqt' */
+static void
+cqt_octave(rta_cqt_setup_t * cqt_setup, const rta_real_t * segment,
+           const unsigned int octave, rta_complex_t * cqt)
+{
+  const unsigned int rows_number = cqt_setup->rows_number;
+  const unsigned int top = cqt_setup->bins_number - octave * rows_number;
+  unsigned int r = 0;
+  unsigned int j;
+
+  /* the lowest octave may be partial */
+  if(top < rows_number)
+  {
+    r = rows_number - top;
+  }
+
+  /* the transform may use its input as work */
+  for(j=0; j<cqt_setup->fft_size; j++)
+  {
+    cqt_setup->segment[j] = segment[j];
+  }
+
+  rta_fft_split_real_execute(cqt_setup->spectrum_real,
+                             cqt_setup->spectrum_imag,
+                             cqt_setup->segment, NULL, cqt_setup->fft_size,
+                             cqt_setup->fft_setup, &(cqt_setup->nyquist));
+
+  for(; r<rows_number; r++)
+  {
+    const unsigned int first = cqt_setup->bounds[2 * r];
+    const unsigned int offset = cqt_setup->offsets[r];
+    const unsigned int bin = top - rows_number + r;
+    rta_real_t re, im;
+
+    cqt_setup->product(&re, &im,
+                       cqt_setup->spectrum_real + first,
+                       cqt_setup->spectrum_imag + first,
+                       cqt_setup->kernel_real + offset,
+                       cqt_setup->kernel_imag + offset,
+                       cqt_setup->bounds[2 * r + 1] - first);
+
+    if(octave > 0)
+    {
+      const rta_complex_t p = cqt_setup->phases[bin];
+      cqt[bin] = rta_make_complex(re * rta_creal(p) - im * rta_cimag(p),
+                                  re * rta_cimag(p) + im * rta_creal(p));
+    }
+    else
+    {
+      cqt[bin] = rta_make_complex(re, im);
+    }
+  }
+  return;
+}
+
+/* ------- end of private ---------------------------- */
+
+/* ------- Public functions -------------------------- */
+
+int
+rta_cqt_setup_new(rta_cqt_setup_t ** cqt_setup,
+                  const rta_real_t sample_rate,
+                  const rta_real_t min_frequency,
+                  const unsigned int bins_per_octave,
+                  const unsigned int bins_number,
+                  const rta_real_t threshold,
+                  const int decimation)
+{
+  int ret = 1;
+  const double q = 1. / (pow(2., 1. / (bins_per_octave > 0 ?
+                                       bins_per_octave : 1)) - 1.);
+  rta_real_t * work = NULL;
+
+  *cqt_setup = (rta_cqt_setup_t *) rta_malloc(sizeof(rta_cqt_setup_t));
+
+  if(*cqt_setup == NULL || bins_per_octave == 0 || bins_number == 0 ||
+     min_frequency <= 0. || sample_rate <= 0. ||
+     min_frequency * pow(2., (double) (bins_number - 1) / bins_per_octave)
+     >= 0.5 * sample_rate)
+  {
+    if(*cqt_setup != NULL)
+    {
+      rta_free(*cqt_setup);
+      *cqt_setup = NULL;
+    }
+    ret = 0;
+  }
+  else
+  {
+    unsigned int longest;
+
+    (*cqt_setup)->bins_number = bins_number;
+    (*cqt_setup)->bins_per_octave = bins_per_octave;
+    if(decimation != 0 && bins_number > bins_per_octave)
+    {
+      (*cqt_setup)->octaves_number =
+        (bins_number + bins_per_octave - 1) / bins_per_octave;
+      (*cqt_setup)->rows_number = bins_per_octave;
+    }
+    else
+    {
+      (*cqt_setup)->octaves_number = 1;
+      (*cqt_setup)->rows_number = bins_number;
+    }
+
+    longest = (unsigned int) ceil(
+      q * sample_rate / cqt_row_frequency(*cqt_setup, min_frequency, 0));
+    (*cqt_setup)->fft_size = rta_inextpow2(longest > 4 ? longest : 4);
+    (*cqt_setup)->frame_size =
+      (*cqt_setup)->fft_size << ((*cqt_setup)->octaves_number - 1);
+    (*cqt_setup)->scale = 1.;
+    (*cqt_setup)->product = cqt_product_select();
+
+    (*cqt_setup)->bounds = (unsigned int *) rta_malloc(
+      2 * (*cqt_setup)->rows_number * sizeof(unsigned int));
+    (*cqt_setup)->offsets = (unsigned int *) rta_malloc(
+      ((*cqt_setup)->rows_number + 1) * sizeof(unsigned int));
+    (*cqt_setup)->kernel_real = NULL;
+    (*cqt_setup)->kernel_imag = NULL;
+    (*cqt_setup)->phases = NULL;
+    (*cqt_setup)->cqt = (rta_complex_t *) rta_malloc(
+      bins_number * sizeof(rta_complex_t));
+    (*cqt_setup)->spectrum_real = (rta_real_t *) rta_malloc(
+      2 * (*cqt_setup)->fft_size * sizeof(rta_real_t));
+    (*cqt_setup)->spectrum_imag = (*cqt_setup)->spectrum_real +
+      (*cqt_setup)->fft_size / 2;
+    (*cqt_setup)->segment = (*cqt_setup)->spectrum_real +
+      (*cqt_setup)->fft_size;
+    (*cqt_setup)->decimated = NULL;
+    (*cqt_setup)->fft_setup = NULL;
+
+    work = (rta_real_t *) rta_malloc(
+      3 * (*cqt_setup)->fft_size * sizeof(rta_real_t));
+
+    if((*cqt_setup)->bounds == NULL || (*cqt_setup)->offsets == NULL ||
+       (*cqt_setup)->cqt == NULL || (*cqt_setup)->spectrum_real == NULL ||
+       work == NULL)
+    {
+      ret = 0;
+    }
+  }
+
+  if(ret != 0)
+  {
+    const unsigned int size = (*cqt_setup)->fft_size;
+    ret = cqt_kernels_new(*cqt_setup, sample_rate, min_frequency, q,
+                          threshold, work, work + size, work + 2 * size);
+  }
+
+  if(ret != 0)
+  {
+    ret = rta_fft_split_setup_new(
+      &((*cqt_setup)->fft_setup), rta_fft_real_to_complex_1d,
+      &((*cqt_setup)->scale), (*cqt_setup)->fft_size,
+      (*cqt_setup)->fft_size, &((*cqt_setup)->nyquist));
+  }
+
+  if(ret != 0 && (*cqt_setup)->octaves_number > 1)
+  {
+    (*cqt_setup)->decimated = (rta_real_t *) rta_malloc(
+      (*cqt_setup)->frame_size * sizeof(rta_real_t));
+    (*cqt_setup)->phases = (rta_complex_t *) rta_malloc(
+      bins_number * sizeof(rta_complex_t));
+
+    if((*cqt_setup)->decimated == NULL || (*cqt_setup)->phases == NULL)
+    {
+      ret = 0;
+    }
+    else
+    {
+      /* each mean of 2 samples delays by half a sample: octave o is */
+      /* centred (2^o - 1) / 2 samples after the frame centre. Its */
+      /* gain is also cos(pi f / sr) at the sample rate sr of the mean */
+      unsigned int k, o;
+      for(k=0; k<bins_number; k++)
+      {
+        const unsigned int octave = (bins_number - 1 - k) / bins_per_octave;
+        const double delay = 0.5 * ((1 << octave) - 1);
+        const double frequency = min_frequency *
+          pow(2., (double) k / bins_per_octave);
+        const double phase = -2. * M_PI * frequency * delay / sample_rate;
+        double gain = 1.;
+
+        for(o=0; o<octave; o++)
+        {
+          gain *= cos(M_PI * frequency * (1 << o) / sample_rate);
+        }
+        (*cqt_setup)->phases[k] = rta_make_complex(cos(phase) / gain,
+                                                   sin(phase) / gain);
+      }
+    }
+  }
+
+  if(work != NULL)
+  {
+    rta_free(work);
+  }
+
+  if(ret == 0 && *cqt_setup != NULL)
+  {
+    rta_cqt_setup_delete(*cqt_setup);
+    *cqt_setup = NULL;
+  }
+
+  return ret;
+}
+
+void
+rta_cqt_setup_delete(rta_cqt_setup_t * cqt_setup)
+{
+  if(cqt_setup != NULL)
+  {
+    if(cqt_setup->bounds != NULL)
+    {
+      rta_free(cqt_setup->bounds);
+    }
+
+    if(cqt_setup->offsets != NULL)
+    {
+      rta_free(cqt_setup->offsets);
+    }
+
+    if(cqt_setup->kernel_real != NULL)
+    {
+      rta_free(cqt_setup->kernel_real);
+    }
+
+    if(cqt_setup->kernel_imag != NULL)
+    {
+      rta_free(cqt_setup->kernel_imag);
+    }
+
+    if(cqt_setup->phases != NULL)
+    {
+      rta_free(cqt_setup->phases);
+    }
+
+    if(cqt_setup->cqt != NULL)
+    {
+      rta_free(cqt_setup->cqt);
+    }
+
+    if(cqt_setup->spectrum_real != NULL)
+    {
+      rta_free(cqt_setup->spectrum_real);
+    }
+
+    if(cqt_setup->decimated != NULL)
+    {
+      rta_free(cqt_setup->decimated);
+    }
+
+    if(cqt_setup->fft_setup != NULL)
+    {
+      rta_fft_setup_delete(cqt_setup->fft_setup);
+    }
+
+    rta_free(cqt_setup);
+  }
+  return;
+}
+
+unsigned int
+rta_cqt_frame_size(const rta_cqt_setup_t * cqt_setup)
+{
+  return cqt_setup->frame_size;
+}
+
+unsigned int
+rta_cqt_kernel_size(const rta_cqt_setup_t * cqt_setup)
+{
+  return cqt_setup->offsets[cqt_setup->rows_number];
+}
+
+void
+rta_cqt(rta_complex_t * cqt, const rta_real_t * frame,
+        rta_cqt_setup_t * cqt_setup)
+{
+  const unsigned int size = cqt_setup->fft_size;
+  const rta_real_t * level = frame;
+  unsigned int level_size = cqt_setup->frame_size;
+  rta_real_t * decimated = cqt_setup->decimated;
+  unsigned int octave;
+
+  cqt_octave(cqt_setup, frame + (level_size - size) / 2, 0, cqt);
+
+  /* centre of each octave, downsampled from the previous one */
+  for(octave=1; octave<cqt_setup->octaves_number; octave++)
+  {
+    rta_downsample_int_mean(decimated, level, level_size, 2);
+    level = decimated;
+    level_size /= 2;
+    decimated += level_size;
+
+    cqt_octave(cqt_setup, level + (level_size - size) / 2, octave, cqt);
+  }
+  return;
+}
+
+void
+rta_cqt_magnitude(rta_real_t * magnitude, const rta_real_t * frame,
+                  rta_cqt_setup_t * cqt_setup)
+{
+  unsigned int k;
+
+  rta_cqt(cqt_setup->cqt, frame, cqt_setup);
+
+  for(k=0; k<cqt_setup->bins_number; k++)
+  {
+    const rta_real_t re = rta_creal(cqt_setup->cqt[k]);
+    const rta_real_t im = rta_cimag(cqt_setup->cqt[k]);
+    magnitude[k] = rta_sqrt(re * re + im * im);
+  }
+  return;
+}
@@ -40,7 +40,19 @@
  */
 
 #include "rta_dct.h"
+#include "rta_fft.h"
+#include "rta_complex.h"
 #include "rta_math.h"
+#include "rta_stdlib.h"
+#include "rta_simd.h"
+
+/* x86 vector products of several frames, selected according to the */
+/* CPU */
+#if defined(RTA_SIMD_X86) && \
+  (RTA_REAL_TYPE == RTA_FLOAT_TYPE || RTA_REAL_TYPE == RTA_DOUBLE_TYPE)
+#define RTA_DCT_SIMD 1
+#include <immintrin.h>
+#endif
 
 int rta_dct_weights(rta_real_t * weights_matrix, 
                     const unsigned int input_size,
@@ -318,3 +330,778 @@ void rta_dct_stride_scaled(rta_real_t * dct, const int d_stride,
   
   return;
 }
+
+/* ------- DCT of several frames --------------------- */
+
+/* frames by coefficients of a tile of rta_dct_frames */
+#define DCT_TILE_FRAMES 4
+#define DCT_TILE_COEFFICIENTS 2
+
+/* tile of dct[f*d_stride+i], for f < DCT_TILE_FRAMES and */
+/* i < DCT_TILE_COEFFICIENTS, from the rows of 'size' weights */
+typedef void (*dct_tile_function)
+(rta_real_t * dct, const unsigned int d_stride,
+ const rta_real_t * input, const unsigned int i_stride,
+ const rta_real_t * weights, const unsigned int size);
+
+static void
+dct_tile(rta_real_t * dct, const unsigned int d_stride,
+         const rta_real_t * input, const unsigned int i_stride,
+         const rta_real_t * weights, const unsigned int size)
+{
+  const rta_real_t * x0 = input;
+  const rta_real_t * x1 = input + i_stride;
+  const rta_real_t * x2 = input + 2 * i_stride;
+  const rta_real_t * x3 = input + 3 * i_stride;
+  const rta_real_t * w0 = weights;
+  const rta_real_t * w1 = weights + size;
+  rta_real_t s00 = 0., s01 = 0., s10 = 0., s11 = 0.;
+  rta_real_t s20 = 0., s21 = 0., s30 = 0., s31 = 0.;
+  unsigned int j;
+
+  for(j=0; j<size; j++)
+  {
+    s00 += x0[j] * w0[j];
+    s01 += x0[j] * w1[j];
+    s10 += x1[j] * w0[j];
+    s11 += x1[j] * w1[j];
+    s20 += x2[j] * w0[j];
+    s21 += x2[j] * w1[j];
+    s30 += x3[j] * w0[j];
+    s31 += x3[j] * w1[j];
+  }
+
+  dct[0] = s00;
+  dct[1] = s01;
+  dct[d_stride] = s10;
+  dct[d_stride+1] = s11;
+  dct[2*d_stride] = s20;
+  dct[2*d_stride+1] = s21;
+  dct[3*d_stride] = s30;
+  dct[3*d_stride+1] = s31;
+
+  return;
+}
+
+#if defined(RTA_DCT_SIMD)
+
+/* see dct_tile: 8 vector sums, added up at the end */
+#define DCT_SIMD_TILE(name, isa, vector_t, width, \
+                      loadu, storeu, set1, add, mul) \
+static void __attribute__((target(isa))) \
+name(rta_real_t * dct, const unsigned int d_stride, \
+     const rta_real_t * input, const unsigned int i_stride, \
+     const rta_real_t * weights, const unsigned int size) \
+{ \
+  const rta_real_t * x0 = input; \
+  const rta_real_t * x1 = input + i_stride; \
+  const rta_real_t * x2 = input + 2 * i_stride; \
+  const rta_real_t * x3 = input + 3 * i_stride; \
+  const rta_real_t * w0 = weights; \
+  const rta_real_t * w1 = weights + size; \
+  vector_t s00 = set1(0.), s01 = set1(0.), s10 = set1(0.), s11 = set1(0.); \
+  vector_t s20 = set1(0.), s21 = set1(0.), s30 = set1(0.), s31 = set1(0.); \
+  rta_real_t s[8][width]; \
+  rta_real_t sums[8]; \
+  unsigned int j, k; \
+  \
+  for(j=0; j+(width)<=size; j+=(width)) \
+  { \
+    const vector_t a = loadu(w0 + j); \
+    const vector_t b = loadu(w1 + j); \
+    vector_t x = loadu(x0 + j); \
+    s00 = add(s00, mul(x, a)); \
+    s01 = add(s01, mul(x, b)); \
+    x = loadu(x1 + j); \
+    s10 = add(s10, mul(x, a)); \
+    s11 = add(s11, mul(x, b)); \
+    x = loadu(x2 + j); \
+    s20 = add(s20, mul(x, a)); \
+    s21 = add(s21, mul(x, b)); \
+    x = loadu(x3 + j); \
+    s30 = add(s30, mul(x, a)); \
+    s31 = add(s31, mul(x, b)); \
+  } \
+  storeu(s[0], s00); \
+  storeu(s[1], s01); \
+  storeu(s[2], s10); \
+  storeu(s[3], s11); \
+  storeu(s[4], s20); \
+  storeu(s[5], s21); \
+  storeu(s[6], s30); \
+  storeu(s[7], s31); \
+  for(k=0; k<8; k++) \
+  { \
+    const rta_real_t * x = input + (k / 2) * i_stride; \
+    const rta_real_t * w = weights + (k % 2) * size; \
+    unsigned int l; \
+    \
+    sums[k] = 0.; \
+    for(l=j; l<size; l++) \
+    { \
+      sums[k] += x[l] * w[l]; \
+    } \
+    for(l=0; l<(width); l++) \
+    { \
+      sums[k] += s[k][l]; \
+    } \
+    dct[(k / 2) * d_stride + (k % 2)] = sums[k]; \
+  } \
+  return; \
+}
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE)
+
+DCT_SIMD_TILE(dct_tile_sse2, "sse2", __m128, 4,
+              _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps,
+              _mm_add_ps, _mm_mul_ps)
+DCT_SIMD_TILE(dct_tile_avx2, "avx2", __m256, 8,
+              _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps,
+              _mm256_add_ps, _mm256_mul_ps)
+DCT_SIMD_TILE(dct_tile_avx512, "avx512f", __m512, 16,
+              _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps,
+              _mm512_add_ps, _mm512_mul_ps)
+
+#else /* double */
+
+DCT_SIMD_TILE(dct_tile_sse2, "sse2", __m128d, 2,
+              _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd,
+              _mm_add_pd, _mm_mul_pd)
+DCT_SIMD_TILE(dct_tile_avx2, "avx2", __m256d, 4,
+              _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd,
+              _mm256_add_pd, _mm256_mul_pd)
+DCT_SIMD_TILE(dct_tile_avx512, "avx512f", __m512d, 8,
+              _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd,
+              _mm512_add_pd, _mm512_mul_pd)
+
+#endif /* RTA_REAL_TYPE */
+
+#endif /* RTA_DCT_SIMD */
+
+#if defined(RTA_DCT_SIMD)
+/* iterations of a tile for a vector width: vectors, then scalars */
+#define DCT_TILE_ITERATIONS(size, width) ((size) / (width) + (size) % (width))
+#endif
+
+/* tile function according to the CPU, and to the size of the rows: */
+/* the widest vectors are not the fastest if most of a row is left to */
+/* the scalar end of the loop */
+static dct_tile_function
+dct_tile_select(const unsigned int size)
+{
+  dct_tile_function tile = dct_tile;
+#if defined(RTA_DCT_SIMD)
+  const unsigned int width = 16 / sizeof(rta_real_t);
+  const rta_simd_level_t level = rta_simd_level();
+  unsigned int iterations = size;
+
+  if(level >= rta_simd_sse2)
+  {
+    tile = dct_tile_sse2;
+    iterations = DCT_TILE_ITERATIONS(size, width);
+  }
+  if(level >= rta_simd_avx2 &&
+     DCT_TILE_ITERATIONS(size, 2 * width) < iterations)
+  {
+    tile = dct_tile_avx2;
+    iterations = DCT_TILE_ITERATIONS(size, 2 * width);
+  }
+  if(level >= rta_simd_avx512 &&
+     DCT_TILE_ITERATIONS(size, 4 * width) < iterations)
+  {
+    tile = dct_tile_avx512;
+  }
+#endif
+  return tile;
+}
+
+/* coefficients from 'begin' to 'end' of one frame, outside of the tiles */
+static void
+dct_coefficients(rta_real_t * dct, const rta_real_t * input_vector,
+                 const rta_real_t * weights_matrix,
+                 const unsigned int input_size,
+                 const unsigned int begin, const unsigned int end)
+{
+  unsigned int i,j;
+
+  for(i=begin; i<end; i++)
+  {
+    dct[i] = 0.;
+    for(j=0; j<input_size; j++)
+    {
+      dct[i] += weights_matrix[i*input_size+j] * input_vector[j];
+    }
+  }
+
+  return;
+}
+
+/* blocks of frames from 'begin' to 'end' */
+static void
+dct_frames(rta_real_t * dct, const unsigned int d_stride,
+           const rta_real_t * input_vectors, const unsigned int i_stride,
+           const unsigned int begin, const unsigned int end,
+           const rta_real_t * weights_matrix,
+           const unsigned int input_size, const unsigned int dct_order,
+           const dct_tile_function tile)
+{
+  /* coefficients computed by tiles, the others one by one */
+  const unsigned int tiled_order =
+    dct_order - dct_order % DCT_TILE_COEFFICIENTS;
+  unsigned int block, f, i;
+
+  for(block=begin; block<end; block+=RTA_DCT_FRAMES_BLOCK)
+  {
+    const unsigned int block_end = (block + RTA_DCT_FRAMES_BLOCK < end ?
+                                    block + RTA_DCT_FRAMES_BLOCK : end);
+
+    /* the rows of weights of a tile stay in cache for the whole block */
+    for(i=0; i<tiled_order; i+=DCT_TILE_COEFFICIENTS)
+    {
+      for(f=block; f+DCT_TILE_FRAMES<=block_end; f+=DCT_TILE_FRAMES)
+      {
+        (*tile)(dct + f*d_stride + i, d_stride,
+                input_vectors + f*i_stride, i_stride,
+                weights_matrix + i*input_size, input_size);
+      }
+
+      for(; f<block_end; f++)
+      {
+        dct_coefficients(dct + f*d_stride, input_vectors + f*i_stride,
+                         weights_matrix, input_size,
+                         i, i + DCT_TILE_COEFFICIENTS);
+      }
+    }
+
+    if(tiled_order < dct_order)
+    {
+      for(f=block; f<block_end; f++)
+      {
+        dct_coefficients(dct + f*d_stride, input_vectors + f*i_stride,
+                         weights_matrix, input_size, tiled_order, dct_order);
+      }
+    }
+  }
+
+  return;
+}
+
+/* arguments of rta_dct_frames, for the threads of a pool */
+typedef struct dct_frames_arguments
+{
+  rta_real_t * dct;
+  unsigned int d_stride;
+  const rta_real_t * input_vectors;
+  unsigned int i_stride;
+  unsigned int frames_number;
+  const rta_real_t * weights_matrix;
+  unsigned int input_size;
+  unsigned int dct_order;
+  dct_tile_function tile;
+} dct_frames_arguments_t;
+
+/* the part 'index' of the blocks of frames, run by each thread */
+static void
+dct_frames_part(void * argument, const unsigned int index,
+                const unsigned int threads_number)
+{
+  const dct_frames_arguments_t * a = (const dct_frames_arguments_t *) argument;
+  const unsigned int blocks_number =
+    (a->frames_number + RTA_DCT_FRAMES_BLOCK - 1) / RTA_DCT_FRAMES_BLOCK;
+  const unsigned int begin = RTA_DCT_FRAMES_BLOCK *
+    rta_thread_part_begin(blocks_number, index, threads_number);
+  const unsigned int end = RTA_DCT_FRAMES_BLOCK *
+    rta_thread_part_begin(blocks_number, index + 1, threads_number);
+
+  dct_frames(a->dct, a->d_stride, a->input_vectors, a->i_stride,
+             begin, (end < a->frames_number ? end : a->frames_number),
+             a->weights_matrix, a->input_size, a->dct_order, a->tile);
+  return;
+}
+
+void rta_dct_frames(rta_real_t * dct, const unsigned int d_stride,
+                    const rta_real_t * input_vectors,
+                    const unsigned int i_stride,
+                    const unsigned int frames_number,
+                    const rta_real_t * weights_matrix,
+                    const unsigned int input_size,
+                    const unsigned int dct_order,
+                    rta_thread_pool_t * pool)
+{
+  dct_frames_arguments_t arguments;
+
+  arguments.dct = dct;
+  arguments.d_stride = d_stride;
+  arguments.input_vectors = input_vectors;
+  arguments.i_stride = i_stride;
+  arguments.frames_number = frames_number;
+  arguments.weights_matrix = weights_matrix;
+  arguments.input_size = input_size;
+  arguments.dct_order = dct_order;
+  arguments.tile = dct_tile_select(input_size);
+
+  rta_thread_pool_run(pool, dct_frames_part, &arguments);
+  return;
+}
+
+/* ------- DCT setups -------------------------------- */
+
+struct rta_dct_setup
+{
+  unsigned int input_size;
+  unsigned int dct_order;
+  rta_dct_t dct_type;
+  rta_dct_method_t method;
+  int inverse;                /**< from rta_dct_inverse_setup_new */
+  rta_real_t * weights;       /**< matrix method, from rta_dct_weights */
+  unsigned int fft_size;      /**< FFT method */
+  rta_complex_t * buffer;     /**< fft_size (DCT-II), fft_size/2 (DCT-I) */
+  rta_complex_t * twiddle;    /**< DCT-II: norm(k) exp(-j pi k / 2N) */
+  rta_complex_t * inverse_twiddle; /**< DCT-II: exp(j pi k / 2N) */
+  rta_real_t inverse_norm;    /**< DCT-II: 1 / norm(k), k > 0 */
+  rta_real_t inverse_first_norm; /**< DCT-II: 1 / norm(0) */
+  rta_fft_setup_t * fft_setup; /**< complex (DCT-II), real (DCT-I) */
+  rta_fft_setup_t * inverse_fft_setup; /**< DCT-II inverse (DCT-III) */
+  rta_real_t scale;
+  rta_real_t inverse_scale;
+  rta_real_t nyquist;         /**< DCT-I */
+};
+
+/* FFT cost of a size, as the sum of its radices per point */
+static double
+dct_fft_cost(const unsigned int fft_size)
+{
+  unsigned int rest = fft_size;
+  unsigned int radix = 2;
+  double radices = 0.;
+
+  while(rest > 1)
+  {
+    if(radix > rest / radix)
+    {
+      radix = rest; /* prime */
+    }
+
+    while(rest % radix == 0)
+    {
+      rest /= radix;
+      radices += radix;
+    }
+    radix += (radix == 2 ? 1 : 2);
+  }
+
+  return (double) fft_size * radices;
+}
+
+/* size of the FFT of a DCT type */
+static unsigned int
+dct_fft_size(const unsigned int input_size, const rta_dct_t dct_type)
+{
+  unsigned int size = input_size;
+
+  if(dct_type == rta_dct_plp)
+  {
+    size = 2 * (input_size - 1);
+  }
+  else if(dct_type == rta_dct_feacalc)
+  {
+    size = 2 * (input_size + 1);
+  }
+  return size;
+}
+
+/* even extension of the input of a DCT-I, into the real buffer, with */
+/* the first and last values repeated for the feacalc type */
+static void
+dct_even_extension(rta_real_t * buffer, const rta_real_t * input,
+                   const unsigned int input_size,
+                   const unsigned int given_size,
+                   const rta_dct_t dct_type)
+{
+  const unsigned int fft_size = dct_fft_size(input_size, dct_type);
+  const unsigned int half = fft_size / 2;
+  unsigned int m;
+
+  if(dct_type == rta_dct_feacalc)
+  {
+    buffer[0] = input[0];
+    for(m=1; m<half; m++)
+    {
+      buffer[m] = input[m-1];
+    }
+    buffer[half] = input[input_size-1];
+  }
+  else
+  {
+    for(m=0; m<given_size; m++)
+    {
+      buffer[m] = input[m];
+    }
+    for(; m<=half; m++)
+    {
+      buffer[m] = 0.;
+    }
+  }
+
+  for(m=1; m<half; m++)
+  {
+    buffer[fft_size-m] = buffer[m];
+  }
+  return;
+}
+
+/* forward setup, and inverse one when 'inverse' is not 0 */
+static int
+dct_setup_new(rta_dct_setup_t ** dct_setup,
+              const unsigned int input_size,
+              const unsigned int dct_order,
+              const rta_dct_t dct_type,
+              const rta_dct_method_t method,
+              const int inverse)
+{
+  int ret = 1;
+  unsigned int k;
+
+  *dct_setup = NULL;
+
+  if(input_size < 2 || dct_order == 0 ||
+     (method == rta_dct_method_fft && dct_order > input_size) ||
+     (dct_type != rta_dct_slaney && dct_type != rta_dct_htk &&
+      dct_type != rta_dct_plp && dct_type != rta_dct_feacalc) ||
+     (inverse != 0 && dct_type == rta_dct_feacalc))
+  {
+    return 0;
+  }
+
+  *dct_setup = (rta_dct_setup_t *) rta_malloc(sizeof(rta_dct_setup_t));
+  if(*dct_setup == NULL)
+  {
+    return 0;
+  }
+
+  (*dct_setup)->input_size = input_size;
+  (*dct_setup)->dct_order = dct_order;
+  (*dct_setup)->dct_type = dct_type;
+  (*dct_setup)->inverse = inverse;
+  (*dct_setup)->fft_size = dct_fft_size(input_size, dct_type);
+  (*dct_setup)->weights = NULL;
+  (*dct_setup)->buffer = NULL;
+  (*dct_setup)->twiddle = NULL;
+  (*dct_setup)->inverse_twiddle = NULL;
+  (*dct_setup)->fft_setup = NULL;
+  (*dct_setup)->inverse_fft_setup = NULL;
+  (*dct_setup)->inverse_norm = 1.;
+  (*dct_setup)->inverse_first_norm = 1.;
+  (*dct_setup)->scale = 1.;
+  (*dct_setup)->inverse_scale = 1. / (*dct_setup)->fft_size;
+  (*dct_setup)->nyquist = 0.;
+
+  if(method == rta_dct_method_auto)
+  {
+    /* the real FFT of a DCT-I costs half of the complex one */
+    const double fft_cost = dct_fft_cost((*dct_setup)->fft_size) *
+      (dct_type == rta_dct_plp || dct_type == rta_dct_feacalc ? 0.5 : 1.);
+
+    (*dct_setup)->method =
+      (dct_order <= input_size &&
+       (double) dct_order * input_size > RTA_DCT_FFT_COST * fft_cost ?
+       rta_dct_method_fft : rta_dct_method_matrix);
+  }
+  else
+  {
+    (*dct_setup)->method = method;
+  }
+
+  if((*dct_setup)->method == rta_dct_method_matrix)
+  {
+    (*dct_setup)->weights = (rta_real_t *) rta_malloc(
+      input_size * dct_order * sizeof(rta_real_t));
+    ret = ((*dct_setup)->weights != NULL &&
+           rta_dct_weights((*dct_setup)->weights, input_size, dct_order,
+                           dct_type) != 0);
+  }
+  else if(dct_type == rta_dct_plp || dct_type == rta_dct_feacalc)
+  {
+    /* DCT-I: real FFT of the even extension, in place */
+    const unsigned int fft_size = (*dct_setup)->fft_size;
+
+    (*dct_setup)->buffer = (rta_complex_t *) rta_malloc(
+      fft_size / 2 * sizeof(rta_complex_t));
+    ret = ((*dct_setup)->buffer != NULL &&
+           rta_fft_real_setup_new(&((*dct_setup)->fft_setup),
+                                  rta_fft_real_to_complex_1d,
+                                  &((*dct_setup)->scale),
+                                  (*dct_setup)->buffer, fft_size,
+                                  (*dct_setup)->buffer, fft_size,
+                                  &((*dct_setup)->nyquist)) != 0);
+  }
+  else
+  {
+    const unsigned int fft_size = (*dct_setup)->fft_size;
+
+    (*dct_setup)->buffer = (rta_complex_t *) rta_malloc(
+      fft_size * sizeof(rta_complex_t));
+    (*dct_setup)->twiddle = (rta_complex_t *) rta_malloc(
+      input_size * sizeof(rta_complex_t));
+    ret = ((*dct_setup)->buffer != NULL && (*dct_setup)->twiddle != NULL &&
+           rta_fft_setup_new(&((*dct_setup)->fft_setup), rta_fft_complex_1d,
+                             &((*dct_setup)->scale),
+                             (*dct_setup)->buffer, fft_size,
+                             (*dct_setup)->buffer, fft_size) != 0);
+
+    if(ret != 0 && inverse != 0)
+    {
+      (*dct_setup)->inverse_twiddle = (rta_complex_t *) rta_malloc(
+        input_size * sizeof(rta_complex_t));
+      ret = ((*dct_setup)->inverse_twiddle != NULL &&
+             rta_fft_setup_new(&((*dct_setup)->inverse_fft_setup),
+                               rta_fft_complex_inverse_1d,
+                               &((*dct_setup)->inverse_scale),
+                               (*dct_setup)->buffer, fft_size,
+                               (*dct_setup)->buffer, fft_size) != 0);
+    }
+
+    for(k=0; k<input_size && ret != 0; k++)
+    {
+      /* same normalisation as rta_dct_weights */
+      double norm = sqrt(2. / input_size);
+      const double phase = M_PI * k / (2. * input_size);
+
+      if(k == 0 && dct_type == rta_dct_slaney)
+      {
+        norm /= M_SQRT2;
+      }
+
+      (*dct_setup)->twiddle[k] =
+        rta_make_complex(norm * cos(phase), - norm * sin(phase));
+      if(inverse != 0)
+      {
+        (*dct_setup)->inverse_twiddle[k] =
+          rta_make_complex(cos(phase), sin(phase));
+      }
+    }
+
+    (*dct_setup)->inverse_norm = sqrt(input_size / 2.);
+    (*dct_setup)->inverse_first_norm =
+      (dct_type == rta_dct_slaney ? sqrt((rta_real_t) input_size) :
+       (*dct_setup)->inverse_norm);
+  }
+
+  if(ret == 0 && *dct_setup != NULL)
+  {
+    rta_dct_setup_delete(*dct_setup);
+    *dct_setup = NULL;
+  }
+
+  return ret;
+}
+
+int rta_dct_setup_new(rta_dct_setup_t ** dct_setup,
+                      const unsigned int input_size,
+                      const unsigned int dct_order,
+                      const rta_dct_t dct_type,
+                      const rta_dct_method_t method)
+{
+  return dct_setup_new(dct_setup, input_size, dct_order, dct_type, method, 0);
+}
+
+int rta_dct_inverse_setup_new(rta_dct_setup_t ** dct_setup,
+                              const unsigned int input_size,
+                              const unsigned int dct_order,
+                              const rta_dct_t dct_type,
+                              const rta_dct_method_t method)
+{
+  return dct_setup_new(dct_setup, input_size, dct_order, dct_type, method, 1);
+}
+
+void rta_dct_setup_delete(rta_dct_setup_t * dct_setup)
+{
+  if(dct_setup != NULL)
+  {
+    if(dct_setup->weights != NULL)
+    {
+      rta_free(dct_setup->weights);
+    }
+
+    if(dct_setup->buffer != NULL)
+    {
+      rta_free(dct_setup->buffer);
+    }
+
+    if(dct_setup->twiddle != NULL)
+    {
+      rta_free(dct_setup->twiddle);
+    }
+
+    if(dct_setup->inverse_twiddle != NULL)
+    {
+      rta_free(dct_setup->inverse_twiddle);
+    }
+
+    if(dct_setup->fft_setup != NULL)
+    {
+      rta_fft_setup_delete(dct_setup->fft_setup);
+    }
+
+    if(dct_setup->inverse_fft_setup != NULL)
+    {
+      rta_fft_setup_delete(dct_setup->inverse_fft_setup);
+    }
+
+    rta_free(dct_setup);
+  }
+  return;
+}
+
+rta_dct_method_t rta_dct_setup_method(const rta_dct_setup_t * dct_setup)
+{
+  return dct_setup->method;
+}
+
+void rta_dct_execute(rta_real_t * dct, const rta_real_t * input_vector,
+                     rta_dct_setup_t * dct_setup)
+{
+  const unsigned int input_size = dct_setup->input_size;
+  rta_complex_t * buffer = dct_setup->buffer;
+  unsigned int j, k;
+
+  if(dct_setup->method == rta_dct_method_matrix)
+  {
+    rta_dct(dct, input_vector, dct_setup->weights, input_size,
+            dct_setup->dct_order);
+  }
+  else if(dct_setup->twiddle != NULL)
+  {
+    /* DCT-II: even samples, then odd ones reversed */
+    for(j=0; 2*j<input_size; j++)
+    {
+      buffer[j] = rta_make_complex(input_vector[2*j], 0.);
+    }
+    for(j=0; 2*j+1<input_size; j++)
+    {
+      buffer[input_size-1-j] = rta_make_complex(input_vector[2*j+1], 0.);
+    }
+
+    rta_fft_execute(buffer, buffer, input_size, dct_setup->fft_setup);
+
+    for(k=0; k<dct_setup->dct_order; k++)
+    {
+      dct[k] =
+        rta_creal(buffer[k]) * rta_creal(dct_setup->twiddle[k]) -
+        rta_cimag(buffer[k]) * rta_cimag(dct_setup->twiddle[k]);
+    }
+  }
+  else
+  {
+    /* DCT-I: real FFT of the even extension, whose spectrum is real */
+    const unsigned int half = dct_setup->fft_size / 2;
+    const rta_real_t scale = 1. / dct_setup->fft_size;
+
+    dct_even_extension((rta_real_t *) buffer, input_vector, input_size,
+                       input_size, dct_setup->dct_type);
+    rta_fft_real_execute(buffer, buffer, dct_setup->fft_size,
+                         dct_setup->fft_setup, &(dct_setup->nyquist));
+
+    for(k=0; k<dct_setup->dct_order; k++)
+    {
+      dct[k] = (k < half ? rta_creal(buffer[k]) : dct_setup->nyquist) * scale;
+    }
+  }
+
+  return;
+}
+
+void rta_dct_inverse_execute(rta_real_t * output_vector,
+                             const rta_real_t * dct,
+                             rta_dct_setup_t * dct_setup)
+{
+  const unsigned int input_size = dct_setup->input_size;
+  const unsigned int dct_order = dct_setup->dct_order;
+  rta_complex_t * buffer = dct_setup->buffer;
+  unsigned int j, k;
+
+  if(dct_setup->method == rta_dct_method_matrix)
+  {
+    const rta_real_t * weights = dct_setup->weights;
+
+    for(j=0; j<input_size; j++)
+    {
+      output_vector[j] = 0.;
+    }
+
+    /* transposed weights, scaled to invert them */
+    for(k=0; k<dct_order; k++)
+    {
+      rta_real_t coefficient = dct[k];
+
+      if(dct_setup->dct_type == rta_dct_htk && k == 0)
+      {
+        coefficient *= 0.5;
+      }
+      else if(dct_setup->dct_type == rta_dct_plp)
+      {
+        coefficient *= (k == 0 || k == input_size - 1 ? 1. : 2.) *
+          (input_size - 1.);
+      }
+
+      for(j=0; j<input_size; j++)
+      {
+        output_vector[j] += weights[k*input_size+j] * coefficient;
+      }
+    }
+
+    if(dct_setup->dct_type == rta_dct_plp)
+    {
+      /* weights of the first and last points are halved */
+      output_vector[0] *= 2.;
+      output_vector[input_size-1] *= 2.;
+    }
+  }
+  else if(dct_setup->twiddle != NULL)
+  {
+    /* DCT-III: V(k) = exp(j pi k / 2N) (C(k) - j C(N-k)), with C */
+    /* unnormalised and zero beyond the order */
+    for(k=0; k<input_size; k++)
+    {
+      const rta_real_t c_k = (k < dct_order ? dct[k] : 0.) *
+        (k == 0 ? dct_setup->inverse_first_norm : dct_setup->inverse_norm);
+      const rta_real_t c_n_k =
+        (k > 0 && input_size - k < dct_order ?
+         dct[input_size-k] * dct_setup->inverse_norm : 0.);
+
+      buffer[k] = rta_make_complex(
+        c_k * rta_creal(dct_setup->inverse_twiddle[k]) +
+        c_n_k * rta_cimag(dct_setup->inverse_twiddle[k]),
+        c_k * rta_cimag(dct_setup->inverse_twiddle[k]) -
+        c_n_k * rta_creal(dct_setup->inverse_twiddle[k]));
+    }
+
+    rta_fft_execute(buffer, buffer, input_size, dct_setup->inverse_fft_setup);
+
+    for(j=0; 2*j<input_size; j++)
+    {
+      output_vector[2*j] = rta_creal(buffer[j]);
+    }
+    for(j=0; 2*j+1<input_size; j++)
+    {
+      output_vector[2*j+1] = rta_creal(buffer[input_size-1-j]);
+    }
+  }
+  else
+  {
+    /* DCT-I is its own inverse, up to a factor 2 (N - 1) */
+    const unsigned int half = dct_setup->fft_size / 2;
+
+    dct_even_extension((rta_real_t *) buffer, dct, input_size, dct_order,
+                       dct_setup->dct_type);
+    rta_fft_real_execute(buffer, buffer, dct_setup->fft_size,
+                         dct_setup->fft_setup, &(dct_setup->nyquist));
+
+    for(j=0; j<input_size; j++)
+    {
+      output_vector[j] = (j < half ? rta_creal(buffer[j]) : dct_setup->nyquist);
+    }
+  }
+
+  return;
+}
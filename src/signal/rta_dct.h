@@ -44,6 +44,7 @@
 #define _RTA_DCT_H_ 1
 
 #include "rta.h"
+#include "rta_thread.h" /* rta_thread_pool_t */
 
 #ifdef __cplusplus
 extern "C" {
@@ -181,6 +182,162 @@ void rta_dct_stride_scaled(rta_real_t * dct, const int d_stride,
                            const unsigned int dct_order,
                            rta_real_t scale);
 
+/**
+ * Number of frames transformed together by rta_dct_frames, for each
+ * pair of coefficients, to reuse their weights in cache.
+ */
+#ifndef RTA_DCT_FRAMES_BLOCK
+#define RTA_DCT_FRAMES_BLOCK 32
+#endif
+
+/**
+ * Compute the Discrete Cosine Transform of several frames, with the
+ * same weights (matrix by matrix product). The frames are processed by
+ * blocks of RTA_DCT_FRAMES_BLOCK, and the products by tiles of 4
+ * frames by 2 coefficients, in vector instructions (see rta_simd.h).
+ * The blocks can be shared by the threads of a pool.
+ *
+ * \see rta_dct
+ *
+ * @param dct size is 'frames_number'*'d_stride'
+ * @param d_stride is the distance between the coefficients of two
+ * frames, not less than 'dct_order'
+ * @param input_vectors size is 'frames_number'*'i_stride'
+ * @param i_stride is the distance between two input vectors, not less
+ * than 'input_size'
+ * @param frames_number is the number of frames
+ * @param weights_matrix is generated by rta_dct_weights
+ * @param input_size is the size of each input vector
+ * @param dct_order is the number of coefficients of each frame
+ * @param pool is a pool of threads which share the blocks of frames,
+ * or NULL to compute them in the calling thread only
+ */
+void rta_dct_frames(rta_real_t * dct, const unsigned int d_stride,
+                    const rta_real_t * input_vectors,
+                    const unsigned int i_stride,
+                    const unsigned int frames_number,
+                    const rta_real_t * weights_matrix,
+                    const unsigned int input_size,
+                    const unsigned int dct_order,
+                    rta_thread_pool_t * pool);
+
+/** how a DCT setup computes the transform */
+typedef enum
+{
+  rta_dct_method_auto = 0,   /**< the cheaper one, according to the sizes */
+  rta_dct_method_matrix = 1, /**< product by the weights matrix */
+  rta_dct_method_fft = 2     /**< FFT of the same size (or of the even */
+                             /**< extension for plp and feacalc types) */
+} rta_dct_method_t;
+
+/**
+ * Relative cost of an FFT point for each unit of its radices, against
+ * a multiply-add of the weights matrix, for rta_dct_method_auto.
+ */
+#ifndef RTA_DCT_FFT_COST
+#define RTA_DCT_FFT_COST 2
+#endif
+
+/* rta_dct_setup is private (depends on implementation) */
+typedef struct rta_dct_setup rta_dct_setup_t;
+
+/**
+ * Allocate and initialize a DCT setup, to compute the same transform
+ * as rta_dct with the weights of rta_dct_weights. See
+ * rta_dct_inverse_setup_new to compute its inverse too.
+ *
+ * The transforms of the rta_dct_slaney and rta_dct_htk types (DCT-II)
+ * can be computed in O(N log N) by an FFT of 'input_size' points
+ * (Makhoul, "A fast cosine transform in one and two dimensions", IEEE
+ * Trans. ASSP 28(1), 1980), and those of the rta_dct_plp and
+ * rta_dct_feacalc types (DCT-I) by a real FFT of their even
+ * extension, of 2 * ('input_size' - 1) and 2 * ('input_size' + 1)
+ * points.
+ * rta_dct_method_auto estimates the cost of both methods, with the
+ * radices of the FFT size (see RTA_DCT_FFT_COST): the matrix stays
+ * cheaper for a few coefficients of a few bands, as for MFCC.
+ *
+ * \see rta_dct_setup_delete
+ * \see rta_dct_execute
+ *
+ * @param dct_setup is an address of a pointer to a private structure,
+ * which is allocated and filled by this function.
+ * @param input_size number of input values (> 1)
+ * @param dct_order number of output dct coefficients. The FFT method
+ * needs 'dct_order' <= 'input_size'.
+ * @param dct_type (see rta_dct_weights)
+ * @param method is rta_dct_method_auto, or forces a method
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'dct_setup' (even a delete).
+ */
+int rta_dct_setup_new(rta_dct_setup_t ** dct_setup,
+                      const unsigned int input_size,
+                      const unsigned int dct_order,
+                      const rta_dct_t dct_type,
+                      const rta_dct_method_t method);
+
+/**
+ * Allocate and initialize a DCT setup, as rta_dct_setup_new, to
+ * compute the transform and its inverse. The rta_dct_feacalc type has
+ * no inverse, and this function fails for it.
+ *
+ * \see rta_dct_setup_new
+ * \see rta_dct_inverse_execute
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'dct_setup' (even a delete).
+ */
+int rta_dct_inverse_setup_new(rta_dct_setup_t ** dct_setup,
+                              const unsigned int input_size,
+                              const unsigned int dct_order,
+                              const rta_dct_t dct_type,
+                              const rta_dct_method_t method);
+
+/**
+ * Deallocate any (sucessfully) allocated DCT setup.
+ *
+ * \see rta_dct_setup_new
+ * \see rta_dct_inverse_setup_new
+ *
+ * @param dct_setup is a pointer to the memory wich will be released.
+ */
+void rta_dct_setup_delete(rta_dct_setup_t * dct_setup);
+
+/**
+ * Method actually used by a DCT setup.
+ *
+ * @param dct_setup is a previously allocated setup
+ *
+ * @return rta_dct_method_matrix or rta_dct_method_fft
+ */
+rta_dct_method_t rta_dct_setup_method(const rta_dct_setup_t * dct_setup);
+
+/**
+ * Perform a discrete cosine transform according to a DCT setup, as
+ * rta_dct with the weights of rta_dct_weights.
+ *
+ * @param dct size is 'dct_order'
+ * @param input_vector size is 'input_size'
+ * @param dct_setup is a previously allocated setup
+ */
+void rta_dct_execute(rta_real_t * dct, const rta_real_t * input_vector,
+                     rta_dct_setup_t * dct_setup);
+
+/**
+ * Perform the inverse transform (DCT-III for the rta_dct_slaney and
+ * rta_dct_htk types, DCT-I for the rta_dct_plp type) of 'dct_order'
+ * coefficients, the missing ones being 0. When 'dct_order' ==
+ * 'input_size', this is the exact inverse of rta_dct_execute.
+ *
+ * @param output_vector size is 'input_size'
+ * @param dct size is 'dct_order'
+ * @param dct_setup is a setup allocated by rta_dct_inverse_setup_new
+ */
+void rta_dct_inverse_execute(rta_real_t * output_vector,
+                             const rta_real_t * dct,
+                             rta_dct_setup_t * dct_setup);
+
 #ifdef __cplusplus
 }
 #endif
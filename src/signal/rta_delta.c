@@ -41,6 +41,7 @@
 
 #include "rta_delta.h"
 #include "rta_math.h"
+#include "rta_stdlib.h"
 
 /* <filter_size> should be odd and positive */
 int rta_delta_weights(rta_real_t * weights_vector, const unsigned int filter_size)
@@ -191,3 +192,261 @@ void rta_delta_vector_stride(rta_real_t * delta, const int d_stride,
   
   return;
 }
+
+/* ------- delta stream ------------------------------ */
+
+/* ring of the last 'filter_size' vectors, and their delta */
+typedef struct delta_stage delta_stage_t;
+struct delta_stage
+{
+  unsigned int filter_size; /**< 0 for no stage */
+  unsigned int half_size;   /**< ('filter_size' - 1) / 2 */
+  rta_real_t * ring;        /**< 'filter_size' vectors */
+  rta_real_t * sum;         /**< sum of the ring */
+  rta_real_t * delta;       /**< delta of the middle vector */
+  unsigned int position;    /**< oldest vector of the ring */
+  unsigned int frames;      /**< input vectors, up to 'half_size' + 1 */
+  unsigned int updates;     /**< input vectors since the exact sums */
+};
+
+struct rta_delta_stream
+{
+  unsigned int input_size;
+  delta_stage_t delta;
+  delta_stage_t acceleration;
+};
+
+static int
+delta_stage_new(delta_stage_t * stage, const unsigned int input_size,
+                const unsigned int filter_size)
+{
+  stage->filter_size = filter_size;
+  stage->half_size = filter_size / 2;
+  stage->position = 0;
+  stage->frames = 0;
+  stage->updates = 0;
+  stage->ring = NULL;
+  stage->sum = NULL;
+  stage->delta = NULL;
+
+  if(filter_size > 0)
+  {
+    /* ring, sum and delta in one block */
+    stage->ring = (rta_real_t *) rta_malloc(
+      (filter_size + 2) * input_size * sizeof(rta_real_t));
+    stage->sum = stage->ring + filter_size * input_size;
+    stage->delta = stage->sum + input_size;
+  }
+
+  return (filter_size == 0 || stage->ring != NULL);
+}
+
+/* exact sum and delta of the ring, whose oldest vector is the first one */
+static void
+delta_stage_update(delta_stage_t * stage, const unsigned int input_size)
+{
+  rta_real_t * sum = stage->sum;
+  rta_real_t * delta = stage->delta;
+  unsigned int i,j;
+
+  for(j=0; j<input_size; j++)
+  {
+    sum[j] = 0.;
+    delta[j] = 0.;
+  }
+
+  for(i=0; i<stage->filter_size; i++)
+  {
+    const rta_real_t * vector = stage->ring + i * input_size;
+    const rta_real_t weight = (rta_real_t) i - (rta_real_t) stage->half_size;
+
+    for(j=0; j<input_size; j++)
+    {
+      sum[j] += vector[j];
+      delta[j] += vector[j] * weight;
+    }
+  }
+
+  return;
+}
+
+/* slide the window of a vector: the delta of the middle vector moves */
+/* by the weights of the new and oldest vectors, minus the sum of the */
+/* others */
+static void
+delta_stage_input(delta_stage_t * stage, const rta_real_t * input_vector,
+                  const unsigned int input_size)
+{
+  rta_real_t * oldest = stage->ring + stage->position * input_size;
+  rta_real_t * sum = stage->sum;
+  rta_real_t * delta = stage->delta;
+  unsigned int i,j;
+
+  if(stage->frames == 0)
+  {
+    /* the first vector is repeated before the sequence */
+    for(i=0; i<stage->filter_size; i++)
+    {
+      for(j=0; j<input_size; j++)
+      {
+        stage->ring[i*input_size+j] = input_vector[j];
+      }
+    }
+
+    for(j=0; j<input_size; j++)
+    {
+      sum[j] = input_vector[j] * stage->filter_size;
+      delta[j] = 0.;
+    }
+  }
+  else
+  {
+    const rta_real_t half_size = stage->half_size;
+    const rta_real_t new_weight = half_size + 1.;
+
+    for(j=0; j<input_size; j++)
+    {
+      sum[j] += input_vector[j] - oldest[j];
+      delta[j] += new_weight * input_vector[j] + half_size * oldest[j]
+        - sum[j];
+      oldest[j] = input_vector[j];
+    }
+
+    stage->position++;
+    stage->updates++;
+    if(stage->position == stage->filter_size)
+    {
+      stage->position = 0;
+      if(stage->updates >= RTA_DELTA_STREAM_UPDATE)
+      {
+        stage->updates = 0;
+        delta_stage_update(stage, input_size);
+      }
+    }
+  }
+
+  if(stage->frames <= stage->half_size)
+  {
+    stage->frames++;
+  }
+
+  return;
+}
+
+int rta_delta_stream_new(rta_delta_stream_t ** delta_stream,
+                         const unsigned int input_size,
+                         const unsigned int delta_filter_size,
+                         const unsigned int acceleration_filter_size)
+{
+  int ret;
+
+  *delta_stream = NULL;
+
+  if(input_size == 0 || delta_filter_size % 2 == 0 ||
+     (acceleration_filter_size > 0 && acceleration_filter_size % 2 == 0))
+  {
+    return 0;
+  }
+
+  *delta_stream = (rta_delta_stream_t *)
+    rta_malloc(sizeof(rta_delta_stream_t));
+  if(*delta_stream == NULL)
+  {
+    return 0;
+  }
+
+  (*delta_stream)->input_size = input_size;
+  ret = delta_stage_new(&((*delta_stream)->delta), input_size,
+                        delta_filter_size);
+  ret = delta_stage_new(&((*delta_stream)->acceleration), input_size,
+                        acceleration_filter_size) && ret;
+
+  if(ret == 0)
+  {
+    rta_delta_stream_delete(*delta_stream);
+    *delta_stream = NULL;
+  }
+
+  return ret;
+}
+
+void rta_delta_stream_delete(rta_delta_stream_t * delta_stream)
+{
+  if(delta_stream != NULL)
+  {
+    if(delta_stream->delta.ring != NULL)
+    {
+      rta_free(delta_stream->delta.ring);
+    }
+
+    if(delta_stream->acceleration.ring != NULL)
+    {
+      rta_free(delta_stream->acceleration.ring);
+    }
+
+    rta_free(delta_stream);
+  }
+  return;
+}
+
+void rta_delta_stream_reset(rta_delta_stream_t * delta_stream)
+{
+  delta_stream->delta.position = 0;
+  delta_stream->delta.frames = 0;
+  delta_stream->delta.updates = 0;
+  delta_stream->acceleration.position = 0;
+  delta_stream->acceleration.frames = 0;
+  delta_stream->acceleration.updates = 0;
+  return;
+}
+
+unsigned int rta_delta_stream_delay(const rta_delta_stream_t * delta_stream)
+{
+  return delta_stream->delta.half_size + delta_stream->acceleration.half_size;
+}
+
+int rta_delta_stream_input(rta_delta_stream_t * delta_stream,
+                           const rta_real_t * input_vector,
+                           rta_real_t * delta, rta_real_t * acceleration)
+{
+  const unsigned int input_size = delta_stream->input_size;
+  delta_stage_t * first = &(delta_stream->delta);
+  delta_stage_t * second = &(delta_stream->acceleration);
+  const rta_real_t * output = first->delta;
+  unsigned int j;
+
+  delta_stage_input(first, input_vector, input_size);
+
+  /* deltas of the virtual vectors before the sequence */
+  if(first->frames <= first->half_size)
+  {
+    return 0;
+  }
+
+  if(second->filter_size > 0)
+  {
+    delta_stage_input(second, first->delta, input_size);
+
+    if(second->frames <= second->half_size)
+    {
+      return 0;
+    }
+
+    /* delta of the middle of the ring, as the acceleration */
+    output = second->ring +
+      ((second->position + second->half_size) % second->filter_size) *
+      input_size;
+
+    for(j=0; j<input_size; j++)
+    {
+      acceleration[j] = second->delta[j];
+    }
+  }
+
+  for(j=0; j<input_size; j++)
+  {
+    delta[j] = output[j];
+  }
+
+  return 1;
+}
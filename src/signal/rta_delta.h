@@ -202,6 +202,99 @@ void rta_delta_vector_stride(rta_real_t * delta, const int d_stride,
                           const rta_real_t * weights_vector, const int w_stride,
                           const unsigned int filter_size);
 
+/**
+ * Number of input vectors after which a delta stream recomputes its
+ * sums exactly, the next time its ring wraps.
+ */
+#ifndef RTA_DELTA_STREAM_UPDATE
+#define RTA_DELTA_STREAM_UPDATE 16
+#endif
+
+/* rta_delta_stream is private (depends on implementation) */
+typedef struct rta_delta_stream rta_delta_stream_t;
+
+/**
+ * Allocate and initialize a stream of deltas, and of deltas of deltas
+ * (acceleration), of a sequence of vectors input one at a time.
+ *
+ * The stream keeps a ring of the last 'delta_filter_size' input
+ * vectors (and of the last 'acceleration_filter_size' deltas) and
+ * updates the deltas of each column as a new vector comes in, with
+ * the running sum of the window, instead of the whole weighted sum of
+ * rta_delta_vector. The sums are recomputed exactly from time to time
+ * (see RTA_DELTA_STREAM_UPDATE), so that rounding errors do not
+ * accumulate.
+ *
+ * The deltas are those of rta_delta_vector with rta_delta_weights, not
+ * normalised (see rta_delta_normalization_factor). As in deltas.m,
+ * the first vector is repeated before the sequence, and the first
+ * delta before the deltas.
+ *
+ * \see rta_delta_stream_delete
+ * \see rta_delta_stream_input
+ *
+ * @param delta_stream is an address of a pointer to a private
+ * structure, which is allocated and filled by this function.
+ * @param input_size is the size of each input vector
+ * @param delta_filter_size must be odd and stricly positive.
+ * @param acceleration_filter_size must be odd, or 0 for deltas only.
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'delta_stream' (even a delete).
+ */
+int rta_delta_stream_new(rta_delta_stream_t ** delta_stream,
+                         const unsigned int input_size,
+                         const unsigned int delta_filter_size,
+                         const unsigned int acceleration_filter_size);
+
+/**
+ * Deallocate any (sucessfully) allocated delta stream.
+ *
+ * \see rta_delta_stream_new
+ *
+ * @param delta_stream is a pointer to the memory wich will be released.
+ */
+void rta_delta_stream_delete(rta_delta_stream_t * delta_stream);
+
+/**
+ * Forget any input vector: the next one starts a new sequence.
+ *
+ * @param delta_stream is a previously allocated stream
+ */
+void rta_delta_stream_reset(rta_delta_stream_t * delta_stream);
+
+/**
+ * Delay of the outputs of rta_delta_stream_input, in vectors:
+ * ('delta_filter_size' - 1) / 2 + ('acceleration_filter_size' - 1) / 2
+ *
+ * @param delta_stream is a previously allocated stream
+ *
+ * @return the number of input vectors between an input and the output
+ * of its deltas
+ */
+unsigned int rta_delta_stream_delay(const rta_delta_stream_t * delta_stream);
+
+/**
+ * Input a vector, and output the delta and the acceleration of the
+ * vector input rta_delta_stream_delay vectors before. The ring is not
+ * shifted: the new vector replaces the oldest one.
+ *
+ * The outputs are written only when the first input vectors are
+ * delayed enough. To output the last vectors of a sequence, input the
+ * last one again, rta_delta_stream_delay times.
+ *
+ * @param delta_stream is a previously allocated stream
+ * @param input_vector size is 'input_size'
+ * @param delta size is 'input_size'
+ * @param acceleration size is 'input_size'. It can be NULL if
+ * 'acceleration_filter_size' is 0.
+ *
+ * @return 1 if 'delta' and 'acceleration' are written, 0 otherwise
+ */
+int rta_delta_stream_input(rta_delta_stream_t * delta_stream,
+                           const rta_real_t * input_vector,
+                           rta_real_t * delta, rta_real_t * acceleration);
+
 #ifdef __cplusplus
 }
 #endif
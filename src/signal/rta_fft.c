@@ -46,7 +46,97 @@
 #include "rta_int.h"  /* integer log2 function */
 #include "rta_math.h" /* M_PI, cos, sin */
 
+#ifndef RTA_FFT_NO_STATIC_TABLES
+#include "rta_fft_static_tables.h" /* precomputed sin and bitrev */
+#endif
+
+#include "rta_thread.h" /* tables cache lock, four-step threads */
+#include "rta_simd.h" /* rta_simd_level */
+
+/* x86 vector butterflies, selected at setup according to the CPU */
+#if defined(RTA_SIMD_X86) && \
+  (RTA_COMPLEX_TYPE == RTA_REAL_TYPE) && \
+  (RTA_REAL_TYPE == RTA_FLOAT_TYPE || RTA_REAL_TYPE == RTA_DOUBLE_TYPE)
+#define RTA_FFT_SIMD 1
+#include <immintrin.h>
+#endif
+
 /* -------  private (depends on implementation) ------ */
+
+/* maximum number of factors of the transform size (2^32) */
+#define FFT_FACTORS_MAX 32
+
+/* in place transform of natural order data (reordering included) */
+typedef void (*fft_kernel_function)
+(const struct rta_fft_setup * fft_setup,
+ rta_complex_t * buf, const int b_stride,
+ const unsigned int coef_step, const unsigned int size);
+
+#if defined(RTA_FFT_SIMD)
+/* vector radix-4 passes, see FFT_SIMD_RADIX4_PASSES */
+typedef void (*fft_simd_function)
+(rta_complex_t * buf, const rta_real_t * twiddle, const rta_real_t * sign,
+ unsigned int up, const unsigned int up_end, const unsigned int size);
+
+/* vector Stockham radix-4 pass, see FFT_SIMD_STOCKHAM_PASS */
+typedef void (*fft_stockham_simd_function)
+(const rta_complex_t * x, rta_complex_t * y,
+ const rta_real_t * coef_real, const rta_real_t * coef_imag,
+ const unsigned int coef_step,
+ const unsigned int n, const unsigned int s, const rta_real_t sign);
+
+typedef void (*fft_split_simd_function)
+(rta_real_t * re, rta_real_t * im, const rta_real_t * twiddle,
+ const rta_real_t sign, unsigned int up, const unsigned int size);
+#endif
+
+/* tables shared by all the setups of the same size and type, */
+/* see tables_acquire and tables_release */
+typedef struct fft_tables fft_tables_t;
+struct fft_tables
+{
+  unsigned int fft_size;
+  rta_fft_t fft_type;
+  unsigned int references; /**< number of setups using the tables */
+  rta_real_t * cos;
+  rta_real_t * sin;
+  unsigned int * bitrev;
+#if defined(RTA_FFT_SIMD)
+  rta_real_t * twiddle;
+#endif
+  fft_tables_t * next;
+};
+
+static fft_tables_t * tables_cache = NULL;
+
+static rta_mutex_t tables_cache_mutex = RTA_MUTEX_INITIALIZER;
+
+/* four-step transform of 'size' = 'size1' * 'size2' points, with a */
+/* pool of threads, see four_step_kernel */
+typedef struct fft_four_step fft_four_step_t;
+
+struct fft_four_step
+{
+  unsigned int size1;           /**< length of the first transforms */
+  unsigned int size2;           /**< length of the second transforms */
+  unsigned int log2_size1;
+  struct rta_fft_setup * fft1;  /**< in place, 'size1' points */
+  struct rta_fft_setup * fft2;  /**< in place, 'size2' points */
+  rta_real_t scale;             /**< 1, for fft1 and fft2 */
+  rta_complex_t * work;         /**< 'size1' * 'size2' points */
+  rta_complex_t * twiddle_low;  /**< W^j, j < 'size1' */
+  rta_complex_t * twiddle_high; /**< W^(j * 'size1'), j < 'size2' */
+  fft_kernel_function kernel;   /**< single thread kernel */
+
+  /* current phase, see four_step_phase */
+  rta_complex_t * buf;
+  unsigned int phase;
+  unsigned int count;
+  int inverse;
+
+  rta_thread_pool_t * pool;     /**< of the setup, not owned */
+};
+
 /* from FTS implementation (Butterfly) */
 struct rta_fft_setup
 {
@@ -62,7 +152,31 @@ struct rta_fft_setup
   rta_real_t * scale;
   rta_real_t * cos;
   rta_real_t * sin;
-  unsigned int * bitrev;
+  unsigned int * bitrev;    /**< bit or digit reversal table */
+  fft_tables_t * tables; /**< shared cos, sin, bitrev (and twiddle) */
+  fft_kernel_function kernel; /**< selected by kernel_select */
+  unsigned int factors[FFT_FACTORS_MAX]; /**< mixed radix passes */
+  unsigned int factors_number; /**< 0 for power of 2 sizes */
+  unsigned int stockham_radix2_passes; /**< for the Stockham kernel */
+  rta_complex_t * work; /**< mixed radix buffer and scratch */
+  struct fft_four_step * four_step; /**< NULL without threads */
+  rta_thread_pool_t * pool; /**< threads of the batches (and four-step) */
+  rta_complex_t * threads_work; /**< work of each thread but the first */
+  unsigned int threads_work_size; /**< per thread, see threads_work_new */
+  int input_pruning; /**< skip the passes on zero padding */
+  unsigned int output_pruning; /**< output size needed, 0 for all */
+  rta_real_t * split_twiddle; /**< split passes, or NULL */
+  rta_real_t * split_work; /**< split arrays and scratch, or NULL */
+  struct rta_fft_setup * pair; /**< complex transform of real pairs */
+#if defined(RTA_FFT_SIMD)
+  fft_simd_function simd_passes; /**< NULL for scalar passes only */
+  unsigned int simd_up; /**< half size of the first vector butterfly */
+  rta_real_t * twiddle; /**< vector twiddle factors */
+  fft_stockham_simd_function stockham_simd_pass; /**< or NULL */
+  unsigned int simd_width; /**< complex values per vector */
+  fft_split_simd_function split_simd_passes; /**< or NULL */
+  unsigned int split_simd_width; /**< real values per vector */
+#endif
 }; /* from fft_lookup_t */
 
 
@@ -162,989 +276,3998 @@ bitreversal_inplace_stride(rta_complex_t * buf,
 }
 
 /********************************************************************
- * from cfft_inplc:
+ * radix-4 decimation in time, on bit reversed shuffled data
+ *
+ *    After the bit reversal, the four quarters of each group of
+ *    4*'up' points hold the sub-transforms of the samples of residue
+ *    0, 2, 1, 3 (modulo 4). A radix-4 pass combines them with 3
+ *    complex multiplications where two radix-2 passes would use 4,
+ *    and it halves the number of passes over the buffer.
  *
- *    fft computation on bit reversed shuffled data
- *      for fft: coef = exp(j*2*PI*n/N), n = 0..N-1 
+ *    If log2('size') is odd, a first radix-2 pass (whose twiddle
+ *    factors are all 1) is done before the radix-4 passes.
+ *
+ *      for fft: coef = exp(j*2*PI*n/N), n = 0..N-1
  *      for ifft: coef = exp(-j*2*PI*n/N), n = 0..N-1
- *         see routine: generate_fft_coefficients()
+ *
+ *    arguments:
+ *      buf ... buffer for inplace transform, of 'size' points
+ *      b_stride ... 'buf' stride
+ *      coef_real, coef_imag ... cosine and sine tables of N points
+ *      coef_step ... N / 'size', that is 2 for the over-sampled
+ *        coefficient tables of the real transforms, 1 otherwise
+ *      size ... # of complex points (power of 2)
+ *      up_begin ... passes start at this half size of butterfly, 1
+ *        to do all of them (otherwise, 'size' / 'up_begin' must be a
+ *        power of 4)
+ *      up_end ... passes stop before this half size of butterfly,
+ *        'size' to do all of them
  */
-/* FFT with over-sampled coefficient tables */
-static void 
-fft_inplace(rta_complex_t * buf,
-            const rta_real_t * coef_real,
-            const rta_real_t * coef_imag,
-            const unsigned int size)
+static void
+fft_radix4_inplace(rta_complex_t * buf, const int b_stride,
+                   const rta_real_t * coef_real,
+                   const rta_real_t * coef_imag,
+                   const unsigned int coef_step,
+                   const unsigned int size,
+                   const unsigned int up_begin,
+                   const unsigned int up_end)
 {
-  unsigned int m, n;
-  unsigned int j, k, up, down;
+  const unsigned int end = size * b_stride;
+  unsigned int up = up_begin;
+  unsigned int m, j, k;
 
-  for(up=1, down=size>>1; up<size; up<<=1, down>>=1)
+  /* odd power of 2: first radix-2 pass, without multiplication */
+  if(up == 1 && (rta_ilog2(size) & 1))
   {
-    for(j=0, k=0; j<up; j++, k+=down)
+    for(m=0; m<end; m+=2*b_stride)
     {
-      //rta_complex_t W = coef_real[k] + coef_imag[k] *I;
-	  rta_complex_t W = rta_make_complex(coef_real[k], coef_imag[k]);
+      rta_complex_t A = buf[m];
+      rta_complex_t B = buf[m+b_stride];
+
+      buf[m] = rta_add_complex(A, B);
+      buf[m+b_stride] = rta_sub_complex(A, B);
+    }
+    up = 2;
+  }
+  
+  for(; up<up_end; up<<=2)
+  {
+    const unsigned int up_s = up * b_stride;
+    const unsigned int incr = 4 * up_s;
+    const unsigned int k_step = coef_step * size / (4 * up);
 
-      unsigned int incr = 2 * up;
-	  
-      for(m=j, n=j+up; m<size; m+=incr, n+=incr)
+    /* first butterflies: twiddle factors are all 1 */
+    for(m=0; m<end; m+=incr)
+    {
+      rta_complex_t A = buf[m];
+      rta_complex_t B = buf[m+up_s];
+      rta_complex_t C = buf[m+2*up_s];
+      rta_complex_t D = buf[m+3*up_s];
+
+      rta_real_t t0_real = rta_creal(A) + rta_creal(B);
+      rta_real_t t0_imag = rta_cimag(A) + rta_cimag(B);
+      rta_real_t t1_real = rta_creal(A) - rta_creal(B);
+      rta_real_t t1_imag = rta_cimag(A) - rta_cimag(B);
+      rta_real_t t2_real = rta_creal(C) + rta_creal(D);
+      rta_real_t t2_imag = rta_cimag(C) + rta_cimag(D);
+      rta_real_t t3_real = rta_creal(C) - rta_creal(D);
+      rta_real_t t3_imag = rta_cimag(C) - rta_cimag(D);
+
+      buf[m] = rta_make_complex(t0_real + t2_real, t0_imag + t2_imag);
+      buf[m+up_s] = rta_make_complex(t1_real + t3_imag, t1_imag - t3_real);
+      buf[m+2*up_s] = rta_make_complex(t0_real - t2_real, t0_imag - t2_imag);
+      buf[m+3*up_s] = rta_make_complex(t1_real - t3_imag, t1_imag + t3_real);
+    }
+    
+    for(j=1, k=k_step; j<up; j++, k+=k_step)
+    {
+      const rta_real_t W1_real = coef_real[k];
+      const rta_real_t W1_imag = coef_imag[k];
+      const rta_real_t W2_real = coef_real[2*k];
+      const rta_real_t W2_imag = coef_imag[2*k];
+      const rta_real_t W3_real = coef_real[3*k];
+      const rta_real_t W3_imag = coef_imag[3*k];
+
+      for(m=j*b_stride; m<end; m+=incr)
       {
         rta_complex_t A = buf[m];
-        rta_complex_t B = buf[n];
-
-        rta_complex_t C = rta_make_complex(rta_cimag(B) * rta_cimag(W) + rta_creal(B) * rta_creal(W),
-						  rta_cimag(B) * rta_creal(W) - rta_creal(B) * rta_cimag(W));
-                            
-        buf[m] = rta_add_complex(A , C);
-        buf[n] = rta_sub_complex(A , C);
+        rta_complex_t B = buf[m+up_s];
+        rta_complex_t C = buf[m+2*up_s];
+        rta_complex_t D = buf[m+3*up_s];
+
+        /* B * conj(W2), C * conj(W1), D * conj(W3) */
+        rta_real_t B_real = rta_creal(B) * W2_real + rta_cimag(B) * W2_imag;
+        rta_real_t B_imag = rta_cimag(B) * W2_real - rta_creal(B) * W2_imag;
+        rta_real_t C_real = rta_creal(C) * W1_real + rta_cimag(C) * W1_imag;
+        rta_real_t C_imag = rta_cimag(C) * W1_real - rta_creal(C) * W1_imag;
+        rta_real_t D_real = rta_creal(D) * W3_real + rta_cimag(D) * W3_imag;
+        rta_real_t D_imag = rta_cimag(D) * W3_real - rta_creal(D) * W3_imag;
+
+        rta_real_t t0_real = rta_creal(A) + B_real;
+        rta_real_t t0_imag = rta_cimag(A) + B_imag;
+        rta_real_t t1_real = rta_creal(A) - B_real;
+        rta_real_t t1_imag = rta_cimag(A) - B_imag;
+        rta_real_t t2_real = C_real + D_real;
+        rta_real_t t2_imag = C_imag + D_imag;
+        rta_real_t t3_real = C_real - D_real;
+        rta_real_t t3_imag = C_imag - D_imag;
+
+        /* t1 - j*t3 and t1 + j*t3 */
+        buf[m] = rta_make_complex(t0_real + t2_real, t0_imag + t2_imag);
+        buf[m+up_s] = rta_make_complex(t1_real + t3_imag, t1_imag - t3_real);
+        buf[m+2*up_s] = rta_make_complex(t0_real - t2_real, t0_imag - t2_imag);
+        buf[m+3*up_s] = rta_make_complex(t1_real - t3_imag, t1_imag + t3_real);
       }
     }
-  }  
+  }
   return;
 }
 
-/********************************************************************
- * from cfft_inplc:
- *
- *    fft computation on bit reversed shuffled data
- *      for fft: coef = exp(j*2*PI*n/N), n = 0..N-1 
- *      for ifft: coef = exp(-j*2*PI*n/N), n = 0..N-1
- *         see routine: generate_fft_coefficients()
- */
-/* FFT with over-sampled coefficient tables */
-static void 
-fft_inplace_stride(rta_complex_t * buf,
-                   const int b_stride,
-                   const rta_real_t * coef_real,
-                   const rta_real_t * coef_imag,
-                   const unsigned int size)
+/* see fft_radix4_inplace */
+static void
+ifft_radix4_inplace(rta_complex_t * buf, const int b_stride,
+                    const rta_real_t * coef_real,
+                    const rta_real_t * coef_imag,
+                    const unsigned int coef_step,
+                    const unsigned int size,
+                    const unsigned int up_begin,
+                    const unsigned int up_end)
 {
-  unsigned int m, n;
-  unsigned int j, k, up, down;
+  const unsigned int end = size * b_stride;
+  unsigned int up = up_begin;
+  unsigned int m, j, k;
 
-  for(up=1, down=size>>1; up<size; up<<=1, down>>=1)
+  /* odd power of 2: first radix-2 pass, without multiplication */
+  if(up == 1 && (rta_ilog2(size) & 1))
   {
-    for(j=0, k=0; j<up; j++, k+=down)
+    for(m=0; m<end; m+=2*b_stride)
     {
-      //rta_complex_t W = coef_real[k] + coef_imag[k] *I;
-	  rta_complex_t W = rta_make_complex(coef_real[k], coef_imag[k]);
+      rta_complex_t A = buf[m];
+      rta_complex_t B = buf[m+b_stride];
+
+      buf[m] = rta_add_complex(A, B);
+      buf[m+b_stride] = rta_sub_complex(A, B);
+    }
+    up = 2;
+  }
+  
+  for(; up<up_end; up<<=2)
+  {
+    const unsigned int up_s = up * b_stride;
+    const unsigned int incr = 4 * up_s;
+    const unsigned int k_step = coef_step * size / (4 * up);
 
-      int incr = 2 * up * b_stride;
-	  
-      for(m=j*b_stride, n=(j+up)*b_stride; m<size; m+=incr, n+=incr)
+    /* first butterflies: twiddle factors are all 1 */
+    for(m=0; m<end; m+=incr)
+    {
+      rta_complex_t A = buf[m];
+      rta_complex_t B = buf[m+up_s];
+      rta_complex_t C = buf[m+2*up_s];
+      rta_complex_t D = buf[m+3*up_s];
+
+      rta_real_t t0_real = rta_creal(A) + rta_creal(B);
+      rta_real_t t0_imag = rta_cimag(A) + rta_cimag(B);
+      rta_real_t t1_real = rta_creal(A) - rta_creal(B);
+      rta_real_t t1_imag = rta_cimag(A) - rta_cimag(B);
+      rta_real_t t2_real = rta_creal(C) + rta_creal(D);
+      rta_real_t t2_imag = rta_cimag(C) + rta_cimag(D);
+      rta_real_t t3_real = rta_creal(C) - rta_creal(D);
+      rta_real_t t3_imag = rta_cimag(C) - rta_cimag(D);
+
+      buf[m] = rta_make_complex(t0_real + t2_real, t0_imag + t2_imag);
+      buf[m+up_s] = rta_make_complex(t1_real - t3_imag, t1_imag + t3_real);
+      buf[m+2*up_s] = rta_make_complex(t0_real - t2_real, t0_imag - t2_imag);
+      buf[m+3*up_s] = rta_make_complex(t1_real + t3_imag, t1_imag - t3_real);
+    }
+    
+    for(j=1, k=k_step; j<up; j++, k+=k_step)
+    {
+      const rta_real_t W1_real = coef_real[k];
+      const rta_real_t W1_imag = coef_imag[k];
+      const rta_real_t W2_real = coef_real[2*k];
+      const rta_real_t W2_imag = coef_imag[2*k];
+      const rta_real_t W3_real = coef_real[3*k];
+      const rta_real_t W3_imag = coef_imag[3*k];
+
+      for(m=j*b_stride; m<end; m+=incr)
       {
         rta_complex_t A = buf[m];
-        rta_complex_t B = buf[n];
-
-        rta_complex_t C = rta_make_complex(rta_cimag(B) * rta_cimag(W) + rta_creal(B) * rta_creal(W),
-                                           rta_cimag(B) * rta_creal(W) - rta_creal(B) * rta_cimag(W));
-                            
-        buf[m] = rta_add_complex(A, C);
-        buf[n] = rta_sub_complex(A, C);
+        rta_complex_t B = buf[m+up_s];
+        rta_complex_t C = buf[m+2*up_s];
+        rta_complex_t D = buf[m+3*up_s];
+
+        /* B * W2, C * W1, D * W3 */
+        rta_real_t B_real = rta_creal(B) * W2_real - rta_cimag(B) * W2_imag;
+        rta_real_t B_imag = rta_creal(B) * W2_imag + rta_cimag(B) * W2_real;
+        rta_real_t C_real = rta_creal(C) * W1_real - rta_cimag(C) * W1_imag;
+        rta_real_t C_imag = rta_creal(C) * W1_imag + rta_cimag(C) * W1_real;
+        rta_real_t D_real = rta_creal(D) * W3_real - rta_cimag(D) * W3_imag;
+        rta_real_t D_imag = rta_creal(D) * W3_imag + rta_cimag(D) * W3_real;
+
+        rta_real_t t0_real = rta_creal(A) + B_real;
+        rta_real_t t0_imag = rta_cimag(A) + B_imag;
+        rta_real_t t1_real = rta_creal(A) - B_real;
+        rta_real_t t1_imag = rta_cimag(A) - B_imag;
+        rta_real_t t2_real = C_real + D_real;
+        rta_real_t t2_imag = C_imag + D_imag;
+        rta_real_t t3_real = C_real - D_real;
+        rta_real_t t3_imag = C_imag - D_imag;
+
+        /* t1 + j*t3 and t1 - j*t3 */
+        buf[m] = rta_make_complex(t0_real + t2_real, t0_imag + t2_imag);
+        buf[m+up_s] = rta_make_complex(t1_real - t3_imag, t1_imag + t3_real);
+        buf[m+2*up_s] = rta_make_complex(t0_real - t2_real, t0_imag - t2_imag);
+        buf[m+3*up_s] = rta_make_complex(t1_real + t3_imag, t1_imag - t3_real);
       }
     }
-  }  
+  }
   return;
 }
 
 
-/* FFT with over-sampled coefficient tables */
-static void 
-fft_inplace_oversampled_coefficients(rta_complex_t * buf,
-                                     const rta_real_t * coef_real,
-                                     const rta_real_t * coef_imag,
-                                     const unsigned int size)
-{
-  unsigned int m, n;
-  unsigned int j, k, up, down;
+/********************************************************************
+ * mixed radix decimation in time, on digit reversed data
+ *
+ *    'size' = factors[0] * factors[1] * ... * factors[factors_number-1]
+ *
+ *    Each pass p combines factors[p] transforms of 'span' points
+ *    (span = factors[0] * ... * factors[p-1]) into transforms of
+ *    factors[p] * 'span' points. The passes are in place, on a
+ *    contiguous buffer.
+ *
+ *    The butterflies are direct: exp(-j*2*PI*n/N). The inverse
+ *    transform conjugates its input and output.
+ *
+ *      coef_real, coef_imag ... cosine and sine tables of N points
+ *      coef_step ... N / 'size'
+ */
+
+/* W = exp(-j*2*PI*k/N): z * W with W = coef_real[k] - j*coef_imag[k] */
+#define fft_twiddle(z, W_real, W_imag) \
+  rta_make_complex(rta_creal(z) * (W_real) + rta_cimag(z) * (W_imag), \
+                   rta_cimag(z) * (W_real) - rta_creal(z) * (W_imag))
 
-  for(up=1, down=size>>1; up<size; up<<=1, down>>=1)
+static void
+mixed_radix_pass_2(rta_complex_t * buf,
+                   const rta_real_t * coef_real, const rta_real_t * coef_imag,
+                   const unsigned int tw_step,
+                   const unsigned int span, const unsigned int size)
+{
+  unsigned int m, j, k;
+  
+  for(j=0, k=0; j<span; j++, k+=tw_step)
   {
-    for(j=0, k=0; j<up; j++, k+=2*down)
-    {
-      //rta_complex_t W = coef_real[k] + coef_imag[k] *I;
-	  rta_complex_t W = rta_make_complex(coef_real[k], coef_imag[k]);
+    const rta_real_t W1_real = coef_real[k];
+    const rta_real_t W1_imag = coef_imag[k];
 
-      unsigned int incr = 2 * up;
-	  
-      for(m=j, n=j+up; m<size; m+=incr, n+=incr)
-      {
-        rta_complex_t A = buf[m];
-        rta_complex_t B = buf[n];
+    for(m=j; m<size; m+=2*span)
+    {
+      rta_complex_t A = buf[m];
+      rta_complex_t B = fft_twiddle(buf[m+span], W1_real, W1_imag);
 
-        rta_complex_t C = rta_make_complex(rta_cimag(B) * rta_cimag(W) + rta_creal(B) * rta_creal(W),
-										    rta_cimag(B) * rta_creal(W) - rta_creal(B) * rta_cimag(W));
-                            
-        buf[m] = rta_add_complex(A, C);
-        buf[n] = rta_sub_complex(A, C);
-      }
+      buf[m] = rta_add_complex(A, B);
+      buf[m+span] = rta_sub_complex(A, B);
     }
-  }  
+  }
   return;
 }
 
-/* FFT with over-sampled coefficient tables */
-static void 
-fft_inplace_oversampled_coefficients_stride(rta_complex_t * buf,
-                                            const int b_stride,
-                                            const rta_real_t * coef_real,
-                                            const rta_real_t * coef_imag,
-                                            const unsigned int size)
+static void
+mixed_radix_pass_3(rta_complex_t * buf,
+                   const rta_real_t * coef_real, const rta_real_t * coef_imag,
+                   const unsigned int tw_step,
+                   const unsigned int span, const unsigned int size)
 {
-  unsigned int m, n;
-  unsigned int j, k, up, down;
-
-  for(up=1, down=size>>1; up<size; up<<=1, down>>=1)
+  const rta_real_t sin_3 = 0.5 * M_SQRT3; /* sin(2*PI/3) */
+  unsigned int m, j, k;
+  
+  for(j=0, k=0; j<span; j++, k+=tw_step)
   {
-    for(j=0, k=0; j<up; j++, k+=2*down)
-    {
-      //rta_complex_t W = coef_real[k] + coef_imag[k] *I;
-	  rta_complex_t W = rta_make_complex(coef_real[k], coef_imag[k]);
+    const rta_real_t W1_real = coef_real[k];
+    const rta_real_t W1_imag = coef_imag[k];
+    const rta_real_t W2_real = coef_real[2*k];
+    const rta_real_t W2_imag = coef_imag[2*k];
 
-      int incr = 2 * up * b_stride;
-	  
-      for(m=j*b_stride, n=(j+up)*b_stride; m<size; m+=incr, n+=incr)
-      {
-        rta_complex_t A = buf[m];
-        rta_complex_t B = buf[n];
-
-        rta_complex_t C = rta_make_complex(rta_cimag(B) * rta_cimag(W) + rta_creal(B) * rta_creal(W),
-                                           rta_cimag(B) * rta_creal(W) - rta_creal(B) * rta_cimag(W));
-                            
-        buf[m] = rta_add_complex(A, C);
-        buf[n] = rta_sub_complex(A, C);
-      }
+    for(m=j; m<size; m+=3*span)
+    {
+      rta_complex_t A = buf[m];
+      rta_complex_t B = fft_twiddle(buf[m+span], W1_real, W1_imag);
+      rta_complex_t C = fft_twiddle(buf[m+2*span], W2_real, W2_imag);
+
+      rta_real_t t1_real = rta_creal(B) + rta_creal(C);
+      rta_real_t t1_imag = rta_cimag(B) + rta_cimag(C);
+      rta_real_t t2_real = rta_creal(A) - 0.5 * t1_real;
+      rta_real_t t2_imag = rta_cimag(A) - 0.5 * t1_imag;
+      rta_real_t t3_real = sin_3 * (rta_creal(B) - rta_creal(C));
+      rta_real_t t3_imag = sin_3 * (rta_cimag(B) - rta_cimag(C));
+
+      /* t2 - j*t3 and t2 + j*t3 */
+      buf[m] = rta_make_complex(rta_creal(A) + t1_real,
+                                rta_cimag(A) + t1_imag);
+      buf[m+span] = rta_make_complex(t2_real + t3_imag, t2_imag - t3_real);
+      buf[m+2*span] = rta_make_complex(t2_real - t3_imag, t2_imag + t3_real);
     }
-  }  
+  }
   return;
 }
 
-static void 
-ifft_inplace(rta_complex_t * buf,
-             const rta_real_t * coef_real,
-             const rta_real_t * coef_imag,
-             const unsigned int size)
+static void
+mixed_radix_pass_4(rta_complex_t * buf,
+                   const rta_real_t * coef_real, const rta_real_t * coef_imag,
+                   const unsigned int tw_step,
+                   const unsigned int span, const unsigned int size)
 {
-  unsigned int m, n;
-  unsigned int j, k, up, down;
-
-  for(up=1, down=size>>1; up<size; up<<=1, down>>=1)
+  unsigned int m, j, k;
+  
+  for(j=0, k=0; j<span; j++, k+=tw_step)
   {
-    for(j=0, k=0; j<up; j++, k+=down)
+    const rta_real_t W1_real = coef_real[k];
+    const rta_real_t W1_imag = coef_imag[k];
+    const rta_real_t W2_real = coef_real[2*k];
+    const rta_real_t W2_imag = coef_imag[2*k];
+    const rta_real_t W3_real = coef_real[3*k];
+    const rta_real_t W3_imag = coef_imag[3*k];
+
+    for(m=j; m<size; m+=4*span)
     {
-      //rta_complex_t W = coef_real[k] + coef_imag[k] *I;
-	  rta_complex_t W = rta_make_complex(coef_real[k], coef_imag[k]);
-
-      unsigned int incr = 2 * up;
-	  
-      for(m=j, n=j+up; m<size; m+=incr, n+=incr)
-      {
-        rta_complex_t A = buf[m];
-        rta_complex_t B = buf[n];
-
-        rta_complex_t C = rta_make_complex(rta_creal(B) * rta_creal(W) - rta_cimag(B) * rta_cimag(W),
-									       rta_creal(B) * rta_cimag(W) + rta_cimag(B) * rta_creal(W));
-                            
-        buf[m] = rta_add_complex(A, C);
-        buf[n] = rta_sub_complex(A, C);
-      }
+      rta_complex_t A = buf[m];
+      rta_complex_t B = fft_twiddle(buf[m+span], W1_real, W1_imag);
+      rta_complex_t C = fft_twiddle(buf[m+2*span], W2_real, W2_imag);
+      rta_complex_t D = fft_twiddle(buf[m+3*span], W3_real, W3_imag);
+
+      rta_real_t t0_real = rta_creal(A) + rta_creal(C);
+      rta_real_t t0_imag = rta_cimag(A) + rta_cimag(C);
+      rta_real_t t1_real = rta_creal(A) - rta_creal(C);
+      rta_real_t t1_imag = rta_cimag(A) - rta_cimag(C);
+      rta_real_t t2_real = rta_creal(B) + rta_creal(D);
+      rta_real_t t2_imag = rta_cimag(B) + rta_cimag(D);
+      rta_real_t t3_real = rta_creal(B) - rta_creal(D);
+      rta_real_t t3_imag = rta_cimag(B) - rta_cimag(D);
+
+      /* t1 - j*t3 and t1 + j*t3 */
+      buf[m] = rta_make_complex(t0_real + t2_real, t0_imag + t2_imag);
+      buf[m+span] = rta_make_complex(t1_real + t3_imag, t1_imag - t3_real);
+      buf[m+2*span] = rta_make_complex(t0_real - t2_real, t0_imag - t2_imag);
+      buf[m+3*span] = rta_make_complex(t1_real - t3_imag, t1_imag + t3_real);
     }
-  }  
+  }
   return;
 }
 
-static void 
-ifft_inplace_stride(rta_complex_t * buf,
-                    const int b_stride,
-                    const rta_real_t * coef_real,
-                    const rta_real_t * coef_imag,
-                    const unsigned int size)
+static void
+mixed_radix_pass_5(rta_complex_t * buf,
+                   const rta_real_t * coef_real, const rta_real_t * coef_imag,
+                   const unsigned int tw_step,
+                   const unsigned int span, const unsigned int size)
 {
-  unsigned int m, n;
-  unsigned int j, k, up, down;
-
-  for(up=1, down=size>>1; up<size; up<<=1, down>>=1)
+  const rta_real_t cos_1 = 0.309016994374947424102293417183; /* cos(2*PI/5) */
+  const rta_real_t cos_2 = -0.809016994374947424102293417183; /* cos(4*PI/5) */
+  const rta_real_t sin_1 = 0.951056516295153572116439333379; /* sin(2*PI/5) */
+  const rta_real_t sin_2 = 0.587785252292473129168705954639; /* sin(4*PI/5) */
+  unsigned int m, j, k;
+  
+  for(j=0, k=0; j<span; j++, k+=tw_step)
   {
-    for(j=0, k=0; j<up; j++, k+=down)
+    const rta_real_t W1_real = coef_real[k];
+    const rta_real_t W1_imag = coef_imag[k];
+    const rta_real_t W2_real = coef_real[2*k];
+    const rta_real_t W2_imag = coef_imag[2*k];
+    const rta_real_t W3_real = coef_real[3*k];
+    const rta_real_t W3_imag = coef_imag[3*k];
+    const rta_real_t W4_real = coef_real[4*k];
+    const rta_real_t W4_imag = coef_imag[4*k];
+
+    for(m=j; m<size; m+=5*span)
     {
-      //rta_complex_t W = coef_real[k] + coef_imag[k] *I;
-	  rta_complex_t W = rta_make_complex(coef_real[k], coef_imag[k]);
-
-      int incr = 2 * up * b_stride;
-	  
-      for(m=j*b_stride, n=(j+up)*b_stride; m<size; m+=incr, n+=incr)
-      {
-        rta_complex_t A = buf[m];
-        rta_complex_t B = buf[n];
-
-        rta_complex_t C = rta_make_complex(rta_creal(B) * rta_creal(W) - rta_cimag(B) * rta_cimag(W),
-										   rta_creal(B) * rta_cimag(W) + rta_cimag(B) * rta_creal(W));
-                            
-        buf[m] = rta_add_complex(A, C);
-        buf[n] = rta_sub_complex(A, C);
-      }
+      rta_complex_t A = buf[m];
+      rta_complex_t B = fft_twiddle(buf[m+span], W1_real, W1_imag);
+      rta_complex_t C = fft_twiddle(buf[m+2*span], W2_real, W2_imag);
+      rta_complex_t D = fft_twiddle(buf[m+3*span], W3_real, W3_imag);
+      rta_complex_t E = fft_twiddle(buf[m+4*span], W4_real, W4_imag);
+
+      rta_real_t t1_real = rta_creal(B) + rta_creal(E);
+      rta_real_t t1_imag = rta_cimag(B) + rta_cimag(E);
+      rta_real_t t2_real = rta_creal(C) + rta_creal(D);
+      rta_real_t t2_imag = rta_cimag(C) + rta_cimag(D);
+      rta_real_t t3_real = rta_creal(B) - rta_creal(E);
+      rta_real_t t3_imag = rta_cimag(B) - rta_cimag(E);
+      rta_real_t t4_real = rta_creal(C) - rta_creal(D);
+      rta_real_t t4_imag = rta_cimag(C) - rta_cimag(D);
+
+      rta_real_t a1_real = rta_creal(A) + cos_1 * t1_real + cos_2 * t2_real;
+      rta_real_t a1_imag = rta_cimag(A) + cos_1 * t1_imag + cos_2 * t2_imag;
+      rta_real_t a2_real = rta_creal(A) + cos_2 * t1_real + cos_1 * t2_real;
+      rta_real_t a2_imag = rta_cimag(A) + cos_2 * t1_imag + cos_1 * t2_imag;
+      rta_real_t b1_real = sin_1 * t3_real + sin_2 * t4_real;
+      rta_real_t b1_imag = sin_1 * t3_imag + sin_2 * t4_imag;
+      rta_real_t b2_real = sin_2 * t3_real - sin_1 * t4_real;
+      rta_real_t b2_imag = sin_2 * t3_imag - sin_1 * t4_imag;
+
+      /* a - j*b and a + j*b */
+      buf[m] = rta_make_complex(rta_creal(A) + t1_real + t2_real,
+                                rta_cimag(A) + t1_imag + t2_imag);
+      buf[m+span] = rta_make_complex(a1_real + b1_imag, a1_imag - b1_real);
+      buf[m+2*span] = rta_make_complex(a2_real + b2_imag, a2_imag - b2_real);
+      buf[m+3*span] = rta_make_complex(a2_real - b2_imag, a2_imag + b2_real);
+      buf[m+4*span] = rta_make_complex(a1_real - b1_imag, a1_imag + b1_real);
     }
-  }  
+  }
   return;
 }
 
-
-static void 
-ifft_inplace_oversampled_coefficients(rta_complex_t * buf,
-                                      const rta_real_t * coef_real,
-                                      const rta_real_t * coef_imag,
-                                      const unsigned int size)
+/* any odd radix, using the symmetry of the coefficients: */
+/* y[s] = x[0] + sum(cos * (x[q] + x[r-q])) - j * sum(sin * (x[q] - x[r-q])) */
+/* 'scratch' size is 'radix' */
+static void
+mixed_radix_pass_generic(rta_complex_t * buf,
+                         const rta_real_t * coef_real,
+                         const rta_real_t * coef_imag,
+                         const unsigned int tw_step,
+                         const unsigned int radix_step,
+                         const unsigned int radix,
+                         const unsigned int span, const unsigned int size,
+                         rta_complex_t * scratch)
 {
-  unsigned int m, n;
-  unsigned int j, k, up, down;
-
-  for(up=1, down=size>>1; up<size; up<<=1, down>>=1)
+  const unsigned int half = radix / 2;
+  unsigned int m, j, k, q, s, qs;
+  
+  for(j=0, k=0; j<span; j++, k+=tw_step)
   {
-    for(j=0, k=0; j<up; j++, k+=2*down)
+    for(m=j; m<size; m+=radix*span)
     {
-      //rta_complex_t W = coef_real[k] + coef_imag[k] *I;
-      rta_complex_t W = rta_make_complex(coef_real[k], coef_imag[k]);
+      rta_complex_t A = buf[m];
+      rta_real_t sum_real = rta_creal(A);
+      rta_real_t sum_imag = rta_cimag(A);
 
-      unsigned int incr = 2 * up;
-	  
-      for(m=j, n=j+up; m<size; m+=incr, n+=incr)
+      /* sums in the first half, differences in the second one */
+      for(q=1; q<=half; q++)
       {
-        rta_complex_t A = buf[m];
-        rta_complex_t B = buf[n];
+        rta_complex_t B = fft_twiddle(buf[m+q*span],
+                                      coef_real[q*k], coef_imag[q*k]);
+        rta_complex_t C = fft_twiddle(buf[m+(radix-q)*span],
+                                      coef_real[(radix-q)*k],
+                                      coef_imag[(radix-q)*k]);
+        scratch[q] = rta_add_complex(B, C);
+        scratch[radix-q] = rta_sub_complex(B, C);
+        sum_real += rta_creal(scratch[q]);
+        sum_imag += rta_cimag(scratch[q]);
+      }
 
-        rta_complex_t C = rta_make_complex(rta_creal(B) * rta_creal(W) - rta_cimag(B) * rta_cimag(W),
-										   rta_creal(B) * rta_cimag(W) + rta_cimag(B) * rta_creal(W));
-                            
-        buf[m] = rta_add_complex(A, C);
-        buf[n] = rta_sub_complex(A, C);
+      for(s=1; s<=half; s++)
+      {
+        rta_real_t a_real = rta_creal(A);
+        rta_real_t a_imag = rta_cimag(A);
+        rta_real_t b_real = 0.;
+        rta_real_t b_imag = 0.;
+
+        for(q=1, qs=s; q<=half; q++, qs+=s)
+        {
+          const unsigned int c = (qs % radix) * radix_step;
+          a_real += coef_real[c] * rta_creal(scratch[q]);
+          a_imag += coef_real[c] * rta_cimag(scratch[q]);
+          b_real += coef_imag[c] * rta_creal(scratch[radix-q]);
+          b_imag += coef_imag[c] * rta_cimag(scratch[radix-q]);
+        }
+
+        buf[m+s*span] = rta_make_complex(a_real + b_imag, a_imag - b_real);
+        buf[m+(radix-s)*span] = rta_make_complex(a_real - b_imag,
+                                                 a_imag + b_real);
       }
+      buf[m] = rta_make_complex(sum_real, sum_imag);
     }
-  }  
+  }
   return;
 }
 
-static void 
-ifft_inplace_oversampled_coefficients_stride(rta_complex_t * buf,
-                                             const int b_stride,
-                                             const rta_real_t * coef_real,
-                                             const rta_real_t * coef_imag,
-                                             const unsigned int size)
+static void
+mixed_radix_passes(rta_complex_t * buf,
+                   const rta_real_t * coef_real,
+                   const rta_real_t * coef_imag,
+                   const unsigned int coef_step,
+                   const unsigned int * factors,
+                   const unsigned int factors_number,
+                   const unsigned int size,
+                   rta_complex_t * scratch)
 {
-  unsigned int m, n;
-  unsigned int j, k, up, down;
+  const unsigned int coef_size = coef_step * size;
+  unsigned int p;
+  unsigned int span;
 
-  for(up=1, down=size>>1; up<size; up<<=1, down>>=1)
+  for(p=0, span=1; p<factors_number; span*=factors[p], p++)
   {
-    for(j=0, k=0; j<up; j++, k+=2*down)
-    {
-      //rta_complex_t W = coef_real[k] + coef_imag[k] *I;
-	  rta_complex_t W = rta_make_complex(coef_real[k], coef_imag[k]);
-
-      int incr = 2 * up * b_stride;
-	  
-      for(m=j*b_stride, n=(j+up)*b_stride; m<size; m+=incr, n+=incr)
-      {
-        rta_complex_t A = buf[m];
-        rta_complex_t B = buf[n];
+    /* index of exp(-j*2*PI/(radix*span)) */
+    const unsigned int tw_step = coef_size / (factors[p] * span);
 
-        rta_complex_t C = rta_make_complex(rta_creal(B) * rta_creal(W) - rta_cimag(B) * rta_cimag(W),
-										   rta_creal(B) * rta_cimag(W) + rta_cimag(B) * rta_creal(W));
-                            
-        buf[m] = rta_add_complex(A, C);
-        buf[n] = rta_sub_complex(A, C);
-      }
+    switch(factors[p])
+    {
+      case 2:
+        mixed_radix_pass_2(buf, coef_real, coef_imag, tw_step, span, size);
+        break;
+
+      case 3:
+        mixed_radix_pass_3(buf, coef_real, coef_imag, tw_step, span, size);
+        break;
+
+      case 4:
+        mixed_radix_pass_4(buf, coef_real, coef_imag, tw_step, span, size);
+        break;
+
+      case 5:
+        mixed_radix_pass_5(buf, coef_real, coef_imag, tw_step, span, size);
+        break;
+
+      default:
+        mixed_radix_pass_generic(buf, coef_real, coef_imag, tw_step,
+                                 coef_size / factors[p], factors[p],
+                                 span, size, scratch);
+        break;
     }
-  }  
+  }
   return;
 }
 
-
-/* from rfft_shuffle_after_fft_inplc */
-/**************************************************************************
- *
- *    rfft_shuffle_after_fft() and rfft_shuffle_befor_ifft()
- *
- *      shuffling routines to compute the positive half of a spectra out of the FFT
- *      of a 2*N points real signal treated as real and imaginary part of a complex
- *      signal and vice versa:
- *
- *      with:
- *        X+ = rfft_shuffle_after_fft(S, ...) ... use after complex FFT
- *      and:
- *        S = rfft_shuffle_befor_ifft(X+, ...) ... use befor complex IFFT
- *
- *      where:
- *        x[m], m = 0..2*N-1 ... real signal
- *        X+[k], k = 0..N-1 ... positive part of spectrum of x[m]
- *      and:
- *        s[n] = x[2n] + j x[2n+1], n = 0..N-1 ... real signal as complex vector
- *        S[k], k = 0..N-1 ... complex FFT of complex vector s[n]
+/********************************************************************
+ * Stockham autosort decimation in frequency, for powers of 2
  *
+ *    Each pass reads 'x' and writes 'y', in natural order, so that
+ *    no reordering is needed. A pass of radix r splits the transforms
+ *    of 'n' points into r transforms of n/r points, interleaved with
+ *    a stride 's' (the product of the previous radices): the inner
+ *    loop reads and writes 's' consecutive points.
  *
- *    arguments:
- *      buf ... buffer for inplace shuffling
- *      in, out ... input vector, output vector for non inplace shuffling
- *      coef_re ... lookup table with cos(2*PI*i/size), i = 0 ... size/2-1
- *      coef_im ... lookup table with sin(2*PI*i/size), i = 0 ... size/2-1
- *      size ... # of complex points (cfft size)
- *      (Note: the lookup tables just contain half of the sine/cosine period in size points)
+ *      sign ... 1 for exp(-j*2*PI*k/N), -1 for the inverse
  */
 static void
-shuffle_after_real_fft_inplace(rta_complex_t * buf, 
-                               const rta_real_t * coef_real,
-                               const rta_real_t * coef_imag,
-                               const int size)
+stockham_pass_2(const rta_complex_t * x, rta_complex_t * y,
+                const rta_real_t * coef_real, const rta_real_t * coef_imag,
+                const unsigned int coef_step,
+                const unsigned int n, const unsigned int s,
+                const rta_real_t sign)
 {
-  int idx, xdi;
-  
-  /* nyquist point coded in imaginary part first point  */
-  buf[0] = rta_make_complex(rta_creal(buf[0]) + rta_cimag(buf[0]), rta_creal(buf[0]) - rta_cimag(buf[0]));
-    
-  
-  for(idx=1, xdi=size-1; idx<size/2; idx++, xdi--)
-  {
-    rta_real_t x1_real = 0.5*(rta_creal(buf[idx]) + rta_creal(buf[xdi]));
-    rta_real_t x1_imag = 0.5*(rta_cimag(buf[idx]) - rta_cimag(buf[xdi]));
+  const unsigned int m = n >> 1;
+  unsigned int p, q;
 
-    rta_real_t x2_real = 0.5*(rta_cimag(buf[xdi]) + rta_cimag(buf[idx]));
-    rta_real_t x2_imag = 0.5*(rta_creal(buf[xdi]) - rta_creal(buf[idx]));
+  for(p=0; p<m; p++)
+  {
+    const unsigned int k = p * s * coef_step;
+    const rta_real_t W1_real = coef_real[k];
+    const rta_real_t W1_imag = sign * coef_imag[k];
+    const rta_complex_t * x0 = x + s * p;
+    const rta_complex_t * x1 = x + s * (p + m);
+    rta_complex_t * y0 = y + s * 2 * p;
+    rta_complex_t * y1 = y0 + s;
+
+    for(q=0; q<s; q++)
+    {
+      const rta_complex_t A = x0[q];
+      const rta_complex_t B = x1[q];
 
-    /* real of x2[idx] * exp(-j*PI*i/size) */
-    rta_real_t x2Ej_real = x2_imag * coef_imag[idx] + x2_real * coef_real[idx]; 
-    
-    /* imaginary of x2[idx] * exp(-j*PI*i/size) */
-    rta_real_t x2Ej_imag = x2_imag * coef_real[idx] - x2_real * coef_imag[idx];
-    
-    buf[idx] = rta_make_complex(x1_real + x2Ej_real, x1_imag + x2Ej_imag);
-    buf[xdi] = rta_make_complex(x1_real - x2Ej_real, x2Ej_imag - x1_imag);
+      y0[q] = rta_add_complex(A, B);
+      y1[q] = fft_twiddle(rta_sub_complex(A, B), W1_real, W1_imag);
+    }
   }
-  
-  buf[idx] = rta_conj(buf[idx]);
   return;
 }
 
 static void
-shuffle_after_real_fft_inplace_stride(rta_complex_t * buf, 
-                                      const int b_stride,
-                                      const rta_real_t * coef_real,
-                                      const rta_real_t * coef_imag,
-                                      const int size)
+stockham_pass_4(const rta_complex_t * x, rta_complex_t * y,
+                const rta_real_t * coef_real, const rta_real_t * coef_imag,
+                const unsigned int coef_step,
+                const unsigned int n, const unsigned int s,
+                const rta_real_t sign)
 {
-  int idx;
-  int idx_s, xdi_s; /* indexes * b_stride */
+  const unsigned int m = n >> 2;
+  unsigned int p, q;
 
-  /* nyquist point coded in imaginary part first point  */
-  buf[0] = rta_make_complex(rta_creal(buf[0]) + rta_cimag(buf[0]), rta_creal(buf[0]) - rta_cimag(buf[0]));
-    
-  for(idx=1, idx_s=b_stride, xdi_s=(size-1)*b_stride;
-      idx<size/2;
-      idx++, idx_s+=b_stride, xdi_s-=b_stride)
+  for(p=0; p<m; p++)
   {
-    rta_real_t x1_real = 0.5*(rta_creal(buf[idx_s]) + rta_creal(buf[xdi_s]));
-    rta_real_t x1_imag = 0.5*(rta_cimag(buf[idx_s]) - rta_cimag(buf[xdi_s]));
-
-    rta_real_t x2_real = 0.5*(rta_cimag(buf[xdi_s]) + rta_cimag(buf[idx_s]));
-    rta_real_t x2_imag = 0.5*(rta_creal(buf[xdi_s]) - rta_creal(buf[idx_s]));
-
-    /* real of x2[idx] * exp(-j*PI*i/size) */
-    rta_real_t x2Ej_real = x2_imag * coef_imag[idx] + x2_real * coef_real[idx]; 
-    
-    /* imaginary of x2[idx] * exp(-j*PI*i/size) */
-    rta_real_t x2Ej_imag = x2_imag * coef_real[idx] - x2_real * coef_imag[idx];
-    
-    buf[idx_s] = rta_make_complex(x1_real + x2Ej_real, x1_imag + x2Ej_imag);
-    buf[xdi_s] = rta_make_complex(x1_real - x2Ej_real, x2Ej_imag - x1_imag);
+    const unsigned int k = p * s * coef_step;
+    const rta_real_t W1_real = coef_real[k];
+    const rta_real_t W1_imag = sign * coef_imag[k];
+    const rta_real_t W2_real = coef_real[2*k];
+    const rta_real_t W2_imag = sign * coef_imag[2*k];
+    const rta_real_t W3_real = coef_real[3*k];
+    const rta_real_t W3_imag = sign * coef_imag[3*k];
+    const rta_complex_t * x0 = x + s * p;
+    const rta_complex_t * x1 = x + s * (p + m);
+    const rta_complex_t * x2 = x + s * (p + 2*m);
+    const rta_complex_t * x3 = x + s * (p + 3*m);
+    rta_complex_t * y0 = y + s * 4 * p;
+    rta_complex_t * y1 = y0 + s;
+    rta_complex_t * y2 = y0 + 2*s;
+    rta_complex_t * y3 = y0 + 3*s;
+
+    for(q=0; q<s; q++)
+    {
+      const rta_complex_t A = x0[q];
+      const rta_complex_t B = x1[q];
+      const rta_complex_t C = x2[q];
+      const rta_complex_t D = x3[q];
+
+      const rta_real_t t0_real = rta_creal(A) + rta_creal(C);
+      const rta_real_t t0_imag = rta_cimag(A) + rta_cimag(C);
+      const rta_real_t t1_real = rta_creal(A) - rta_creal(C);
+      const rta_real_t t1_imag = rta_cimag(A) - rta_cimag(C);
+      const rta_real_t t2_real = rta_creal(B) + rta_creal(D);
+      const rta_real_t t2_imag = rta_cimag(B) + rta_cimag(D);
+      /* -j * sign * (B - D) */
+      const rta_real_t t3_real = sign * (rta_cimag(B) - rta_cimag(D));
+      const rta_real_t t3_imag = sign * (rta_creal(D) - rta_creal(B));
+
+      y0[q] = rta_make_complex(t0_real + t2_real, t0_imag + t2_imag);
+      y1[q] = fft_twiddle(rta_make_complex(t1_real + t3_real,
+                                           t1_imag + t3_imag),
+                          W1_real, W1_imag);
+      y2[q] = fft_twiddle(rta_make_complex(t0_real - t2_real,
+                                           t0_imag - t2_imag),
+                          W2_real, W2_imag);
+      y3[q] = fft_twiddle(rta_make_complex(t1_real - t3_real,
+                                           t1_imag - t3_imag),
+                          W3_real, W3_imag);
+    }
   }
-  
-  buf[idx_s] = rta_conj(buf[idx_s]);
   return;
 }
 
-/* from rfft_shuffle_before_ifft_inplc */
-static void
-shuffle_before_real_inverse_fft_inplace(rta_complex_t * buf,
-                                        const rta_real_t *coef_real,
-                                        const rta_real_t *coef_imag,
-                                        const int size)
+/* radix-2 passes first, for an even number of passes ('size' >= 8) */
+static unsigned int
+stockham_radix2_passes(const unsigned int size)
 {
-  int idx, xdi;
-  
-  /* nyquist point coded in imaginary part of the first point */
-  buf[0] = rta_make_complex(rta_creal(buf[0]) + rta_cimag(buf[0]), rta_creal(buf[0]) - rta_cimag(buf[0]));
+  const unsigned int log2_size = rta_ilog2(size);
+  unsigned int radix2_passes = log2_size & 1;
 
-  for(idx=1, xdi=size-1; idx<size/2; idx++, xdi--)
+  if((((log2_size - radix2_passes) >> 1) + radix2_passes) & 1)
   {
-    rta_real_t x1_real = rta_creal(buf[idx]) + rta_creal(buf[xdi]);
-    rta_real_t x1_imag = rta_cimag(buf[idx]) - rta_cimag(buf[xdi]);
-
-    /* real of x2[idx] * exp(-j*PI*i/size) */
-    rta_real_t x2Ej_real = rta_creal(buf[idx]) - rta_creal(buf[xdi]);
-
-    /* imaginary of x2[idx] * exp(-j*PI*i/size) */
-    rta_real_t x2Ej_imag = rta_cimag(buf[idx]) + rta_cimag(buf[xdi]);
-
-    /* real of x2 */
-    rta_real_t x2_real = x2Ej_real * coef_real[idx] - x2Ej_imag * coef_imag[idx];
-  
-    /* imaginary of x2 */
-    rta_real_t x2_imag = x2Ej_real * coef_imag[idx] + x2Ej_imag * coef_real[idx];
-
-    buf[idx] = rta_make_complex(x1_real - x2_imag, x1_imag + x2_real);
-    buf[xdi] = rta_make_complex(x1_real + x2_imag, x2_real - x1_imag);
-
+    radix2_passes += 2;
   }
-  buf[idx] = rta_mul_complex_real(rta_conj(buf[idx]), 2);
-  return;
+  return radix2_passes;
 }
 
+/* kernels: reordering and passes */
+
+/* over-sampled table for the real transforms */
 static void
-shuffle_before_real_inverse_fft_inplace_stride(rta_complex_t * buf,
-                                               const int b_stride,
-                                               const rta_real_t *coef_real,
-                                               const rta_real_t *coef_imag,
-                                               const int size)
+bitreversal(const rta_fft_setup_t * fft_setup,
+            rta_complex_t * buf, const int b_stride,
+            const unsigned int coef_step, const unsigned int size)
 {
-  int idx;
-  int idx_s, xdi_s; /* indexes * b_stride */
-
-  /* nyquist point coded in imaginary part of the first point */
-  buf[0] = rta_make_complex(rta_creal(buf[0]) + rta_cimag(buf[0]), rta_creal(buf[0]) - rta_cimag(buf[0]));
-
-  for(idx=1, idx_s=b_stride, xdi_s=(size-1)*b_stride;
-      idx<size/2;
-      idx++, idx_s+=b_stride, xdi_s-=b_stride)
+  if(coef_step == 2)
   {
-    rta_real_t x1_real = rta_creal(buf[idx_s]) + rta_creal(buf[xdi_s]);
-    rta_real_t x1_imag = rta_cimag(buf[idx_s]) - rta_cimag(buf[xdi_s]);
-
-    /* real of x2[idx] * exp(-j*PI*i/size) */
-    rta_real_t x2Ej_real = rta_creal(buf[idx_s]) - rta_creal(buf[xdi_s]);
+    if(b_stride == 1)
+    {
+      bitreversal_oversampled_inplace(buf, fft_setup->bitrev, size);
+    }
+    else
+    {
+      bitreversal_oversampled_inplace_stride(buf, b_stride,
+                                             fft_setup->bitrev, size);
+    }
+  }
+  else
+  {
+    if(b_stride == 1)
+    {
+      bitreversal_inplace(buf, fft_setup->bitrev, size);
+    }
+    else
+    {
+      bitreversal_inplace_stride(buf, b_stride, fft_setup->bitrev, size);
+    }
+  }
+  return;
+}
 
-    /* imaginary of x2[idx] * exp(-j*PI*i/size) */
-    rta_real_t x2Ej_imag = rta_cimag(buf[idx_s]) + rta_cimag(buf[xdi_s]);
+static void
+fft_power_of_2(const rta_fft_setup_t * fft_setup,
+               rta_complex_t * buf, const int b_stride,
+               const unsigned int coef_step, const unsigned int size)
+{
+  bitreversal(fft_setup, buf, b_stride, coef_step, size);
+  fft_radix4_inplace(buf, b_stride, fft_setup->cos, fft_setup->sin,
+                     coef_step, size, 1, size);
+  return;
+}
 
-    /* real of x2 */
-    rta_real_t x2_real = x2Ej_real * coef_real[idx] - x2Ej_imag * coef_imag[idx];
-  
-    /* imaginary of x2 */
-    rta_real_t x2_imag = x2Ej_real * coef_imag[idx] + x2Ej_imag * coef_real[idx];
+static void
+ifft_power_of_2(const rta_fft_setup_t * fft_setup,
+                rta_complex_t * buf, const int b_stride,
+                const unsigned int coef_step, const unsigned int size)
+{
+  bitreversal(fft_setup, buf, b_stride, coef_step, size);
+  ifft_radix4_inplace(buf, b_stride, fft_setup->cos, fft_setup->sin,
+                      coef_step, size, 1, size);
+  return;
+}
 
-    buf[idx_s] = rta_make_complex(x1_real - x2_imag, x1_imag + x2_real);
-    buf[xdi_s] = rta_make_complex(x1_real + x2_imag, x2_real - x1_imag);
+#if defined(RTA_FFT_SIMD)
+/********************************************************************
+ * x86 vector radix-4 passes, on bit reversed shuffled data
+ *
+ *    Same butterflies as fft_radix4_inplace and ifft_radix4_inplace,
+ *    on 'width' consecutive butterflies of a group at once, for a
+ *    contiguous buffer. They do the passes from 'up' (at least
+ *    'width') to 'up_end' (at most 'size'), after the scalar ones.
+ *    'twiddle' starts with the factors of the pass of 'up': they are
+ *    4 * ('up' - simd_up) real values after the first ones.
+ *
+ *    The twiddle factors W of each pass are precomputed by
+ *    simd_twiddle_new, for B, C and D, as (W_real, W_real) and
+ *    (-W_imag, W_imag) pairs, so that
+ *      z * W = z * (W_real, W_real) + swap(z) * (-W_imag, W_imag)
+ *
+ *    'sign' gives -j * z = swap(z) * (1, -1) for the direct transform
+ *    and j * z = swap(z) * (-1, 1) for the inverse one.
+ */
+static const rta_real_t simd_sign_forward[16] =
+{ 1., -1., 1., -1., 1., -1., 1., -1., 1., -1., 1., -1., 1., -1., 1., -1. };
+
+static const rta_real_t simd_sign_inverse[16] =
+{ -1., 1., -1., 1., -1., 1., -1., 1., -1., 1., -1., 1., -1., 1., -1., 1. };
+
+#define FFT_SIMD_RADIX4_PASSES(name, isa, vector_t, width, \
+                               loadu, storeu, add, sub, mul, swap) \
+static void __attribute__((target(isa))) \
+name(rta_complex_t * buf, const rta_real_t * twiddle, \
+     const rta_real_t * sign, unsigned int up, const unsigned int up_end, \
+     const unsigned int size) \
+{ \
+  rta_real_t * b = (rta_real_t *) buf; \
+  const vector_t s = loadu(sign); \
+  const rta_real_t * tw = twiddle; \
+  unsigned int g, j; \
+  \
+  for(; up<up_end; up<<=2) \
+  { \
+    const unsigned int up2 = 2 * up; /* in reals */ \
+    for(g=0; g<2*size; g+=4*up2) \
+    { \
+      rta_real_t * p = b + g; \
+      for(j=0; j<up2; j+=2*(width)) \
+      { \
+        vector_t A = loadu(p + j); \
+        vector_t B = loadu(p + up2 + j); \
+        vector_t C = loadu(p + 2*up2 + j); \
+        vector_t D = loadu(p + 3*up2 + j); \
+        vector_t t0, t1, t2, t3; \
+        \
+        B = add(mul(B, loadu(tw + j)), mul(swap(B), loadu(tw + up2 + j))); \
+        C = add(mul(C, loadu(tw + 2*up2 + j)), \
+                mul(swap(C), loadu(tw + 3*up2 + j))); \
+        D = add(mul(D, loadu(tw + 4*up2 + j)), \
+                mul(swap(D), loadu(tw + 5*up2 + j))); \
+        \
+        t0 = add(A, B); \
+        t1 = sub(A, B); \
+        t2 = add(C, D); \
+        t3 = mul(swap(sub(C, D)), s); \
+        \
+        storeu(p + j, add(t0, t2)); \
+        storeu(p + up2 + j, add(t1, t3)); \
+        storeu(p + 2*up2 + j, sub(t0, t2)); \
+        storeu(p + 3*up2 + j, sub(t1, t3)); \
+      } \
+    } \
+    tw += 6 * up2; \
+  } \
+  return; \
+}
 
-  }
-  buf[idx_s] = rta_mul_complex_real(rta_conj(buf[idx_s]), 2);
-  return;
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE)
+
+#define fft_sse2_swap(v) _mm_shuffle_ps((v), (v), _MM_SHUFFLE(2, 3, 0, 1))
+#define fft_avx2_swap(v) _mm256_permute_ps((v), 0xB1)
+#define fft_avx512_swap(v) _mm512_permute_ps((v), 0xB1)
+
+FFT_SIMD_RADIX4_PASSES(fft_radix4_sse2, "sse2", __m128, 2,
+                       _mm_loadu_ps, _mm_storeu_ps,
+                       _mm_add_ps, _mm_sub_ps, _mm_mul_ps, fft_sse2_swap)
+FFT_SIMD_RADIX4_PASSES(fft_radix4_avx2, "avx2", __m256, 4,
+                       _mm256_loadu_ps, _mm256_storeu_ps,
+                       _mm256_add_ps, _mm256_sub_ps, _mm256_mul_ps,
+                       fft_avx2_swap)
+FFT_SIMD_RADIX4_PASSES(fft_radix4_avx512, "avx512f", __m512, 8,
+                       _mm512_loadu_ps, _mm512_storeu_ps,
+                       _mm512_add_ps, _mm512_sub_ps, _mm512_mul_ps,
+                       fft_avx512_swap)
+
+#else /* double */
+
+#define fft_sse2_swap(v) _mm_shuffle_pd((v), (v), 1)
+#define fft_avx2_swap(v) _mm256_permute_pd((v), 0x5)
+#define fft_avx512_swap(v) _mm512_permute_pd((v), 0x55)
+
+FFT_SIMD_RADIX4_PASSES(fft_radix4_sse2, "sse2", __m128d, 1,
+                       _mm_loadu_pd, _mm_storeu_pd,
+                       _mm_add_pd, _mm_sub_pd, _mm_mul_pd, fft_sse2_swap)
+FFT_SIMD_RADIX4_PASSES(fft_radix4_avx2, "avx2", __m256d, 2,
+                       _mm256_loadu_pd, _mm256_storeu_pd,
+                       _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd,
+                       fft_avx2_swap)
+FFT_SIMD_RADIX4_PASSES(fft_radix4_avx512, "avx512f", __m512d, 4,
+                       _mm512_loadu_pd, _mm512_storeu_pd,
+                       _mm512_add_pd, _mm512_sub_pd, _mm512_mul_pd,
+                       fft_avx512_swap)
+
+#endif /* RTA_REAL_TYPE */
+
+/* Same butterflies as stockham_pass_4, on 'width' consecutive */
+/* points at once, for 's' >= 'width'. The twiddle factors are */
+/* broadcast as above. */
+#define FFT_SIMD_STOCKHAM_PASS(name, isa, vector_t, width, \
+                               loadu, storeu, set1, add, sub, mul, swap) \
+static void __attribute__((target(isa))) \
+name(const rta_complex_t * x, rta_complex_t * y, \
+     const rta_real_t * coef_real, const rta_real_t * coef_imag, \
+     const unsigned int coef_step, \
+     const unsigned int n, const unsigned int s, const rta_real_t sign) \
+{ \
+  const unsigned int m = n >> 2; \
+  const unsigned int s2 = 2 * s; /* in reals */ \
+  const vector_t j_sign = loadu(sign > 0. ? simd_sign_forward \
+                                : simd_sign_inverse); \
+  const vector_t w_sign = loadu(simd_sign_forward); \
+  unsigned int p, q; \
+  \
+  for(p=0; p<m; p++) \
+  { \
+    const unsigned int k = p * s * coef_step; \
+    const vector_t W1_real = set1(coef_real[k]); \
+    const vector_t W1_imag = mul(set1(sign * coef_imag[k]), w_sign); \
+    const vector_t W2_real = set1(coef_real[2*k]); \
+    const vector_t W2_imag = mul(set1(sign * coef_imag[2*k]), w_sign); \
+    const vector_t W3_real = set1(coef_real[3*k]); \
+    const vector_t W3_imag = mul(set1(sign * coef_imag[3*k]), w_sign); \
+    const rta_real_t * x0 = (const rta_real_t *) (x + s * p); \
+    const rta_real_t * x1 = (const rta_real_t *) (x + s * (p + m)); \
+    const rta_real_t * x2 = (const rta_real_t *) (x + s * (p + 2*m)); \
+    const rta_real_t * x3 = (const rta_real_t *) (x + s * (p + 3*m)); \
+    rta_real_t * y0 = (rta_real_t *) (y + s * 4 * p); \
+    \
+    for(q=0; q<s2; q+=2*(width)) \
+    { \
+      const vector_t A = loadu(x0 + q); \
+      const vector_t B = loadu(x1 + q); \
+      const vector_t C = loadu(x2 + q); \
+      const vector_t D = loadu(x3 + q); \
+      const vector_t t0 = add(A, C); \
+      const vector_t t1 = sub(A, C); \
+      const vector_t t2 = add(B, D); \
+      const vector_t t3 = mul(swap(sub(B, D)), j_sign); \
+      const vector_t u1 = add(t1, t3); \
+      const vector_t u2 = sub(t0, t2); \
+      const vector_t u3 = sub(t1, t3); \
+      \
+      storeu(y0 + q, add(t0, t2)); \
+      storeu(y0 + s2 + q, add(mul(u1, W1_real), mul(swap(u1), W1_imag))); \
+      storeu(y0 + 2*s2 + q, add(mul(u2, W2_real), mul(swap(u2), W2_imag))); \
+      storeu(y0 + 3*s2 + q, add(mul(u3, W3_real), mul(swap(u3), W3_imag))); \
+    } \
+  } \
+  return; \
 }
 
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE)
+
+FFT_SIMD_STOCKHAM_PASS(stockham_pass_4_sse2, "sse2", __m128, 2,
+                       _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps,
+                       _mm_add_ps, _mm_sub_ps, _mm_mul_ps, fft_sse2_swap)
+FFT_SIMD_STOCKHAM_PASS(stockham_pass_4_avx2, "avx2", __m256, 4,
+                       _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps,
+                       _mm256_add_ps, _mm256_sub_ps, _mm256_mul_ps,
+                       fft_avx2_swap)
+FFT_SIMD_STOCKHAM_PASS(stockham_pass_4_avx512, "avx512f", __m512, 8,
+                       _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps,
+                       _mm512_add_ps, _mm512_sub_ps, _mm512_mul_ps,
+                       fft_avx512_swap)
+
+#else /* double */
+
+FFT_SIMD_STOCKHAM_PASS(stockham_pass_4_sse2, "sse2", __m128d, 1,
+                       _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd,
+                       _mm_add_pd, _mm_sub_pd, _mm_mul_pd, fft_sse2_swap)
+FFT_SIMD_STOCKHAM_PASS(stockham_pass_4_avx2, "avx2", __m256d, 2,
+                       _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd,
+                       _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd,
+                       fft_avx2_swap)
+FFT_SIMD_STOCKHAM_PASS(stockham_pass_4_avx512, "avx512f", __m512d, 4,
+                       _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd,
+                       _mm512_add_pd, _mm512_sub_pd, _mm512_mul_pd,
+                       fft_avx512_swap)
+
+#endif /* RTA_REAL_TYPE */
+
+/* Same butterflies as split_radix4_passes, on 'width' consecutive */
+/* real or imaginary parts at once, from 'up' >= 'width' to 'size'. */
+/* 'twiddle' points to the split twiddle factors of the 'up' pass. */
+#define FFT_SIMD_SPLIT_PASSES(name, isa, vector_t, width, \
+                              loadu, storeu, set1, add, sub, mul) \
+static void __attribute__((target(isa))) \
+name(rta_real_t * re, rta_real_t * im, const rta_real_t * twiddle, \
+     const rta_real_t sign, unsigned int up, const unsigned int size) \
+{ \
+  const vector_t s = set1(sign); \
+  const rta_real_t * tw = twiddle; \
+  unsigned int g, j; \
+  \
+  for(; up<size; up<<=2) \
+  { \
+    for(g=0; g<size; g+=4*up) \
+    { \
+      rta_real_t * a_re = re + g; \
+      rta_real_t * a_im = im + g; \
+      for(j=0; j<up; j+=(width)) \
+      { \
+        const vector_t W1_re = loadu(tw + j); \
+        const vector_t W1_im = mul(s, loadu(tw + up + j)); \
+        const vector_t W2_re = loadu(tw + 2*up + j); \
+        const vector_t W2_im = mul(s, loadu(tw + 3*up + j)); \
+        const vector_t W3_re = loadu(tw + 4*up + j); \
+        const vector_t W3_im = mul(s, loadu(tw + 5*up + j)); \
+        const vector_t A_re = loadu(a_re + j); \
+        const vector_t A_im = loadu(a_im + j); \
+        vector_t b_re = loadu(a_re + up + j); \
+        vector_t b_im = loadu(a_im + up + j); \
+        vector_t c_re = loadu(a_re + 2*up + j); \
+        vector_t c_im = loadu(a_im + 2*up + j); \
+        vector_t d_re = loadu(a_re + 3*up + j); \
+        vector_t d_im = loadu(a_im + 3*up + j); \
+        const vector_t B_re = add(mul(b_re, W2_re), mul(b_im, W2_im)); \
+        const vector_t B_im = sub(mul(b_im, W2_re), mul(b_re, W2_im)); \
+        const vector_t C_re = add(mul(c_re, W1_re), mul(c_im, W1_im)); \
+        const vector_t C_im = sub(mul(c_im, W1_re), mul(c_re, W1_im)); \
+        const vector_t D_re = add(mul(d_re, W3_re), mul(d_im, W3_im)); \
+        const vector_t D_im = sub(mul(d_im, W3_re), mul(d_re, W3_im)); \
+        const vector_t t0_re = add(A_re, B_re); \
+        const vector_t t0_im = add(A_im, B_im); \
+        const vector_t t1_re = sub(A_re, B_re); \
+        const vector_t t1_im = sub(A_im, B_im); \
+        const vector_t t2_re = add(C_re, D_re); \
+        const vector_t t2_im = add(C_im, D_im); \
+        const vector_t t3_re = mul(s, sub(C_re, D_re)); \
+        const vector_t t3_im = mul(s, sub(C_im, D_im)); \
+        \
+        storeu(a_re + j, add(t0_re, t2_re)); \
+        storeu(a_im + j, add(t0_im, t2_im)); \
+        storeu(a_re + up + j, add(t1_re, t3_im)); \
+        storeu(a_im + up + j, sub(t1_im, t3_re)); \
+        storeu(a_re + 2*up + j, sub(t0_re, t2_re)); \
+        storeu(a_im + 2*up + j, sub(t0_im, t2_im)); \
+        storeu(a_re + 3*up + j, sub(t1_re, t3_im)); \
+        storeu(a_im + 3*up + j, add(t1_im, t3_re)); \
+      } \
+    } \
+    tw += 6 * up; \
+  } \
+  return; \
+}
 
-/* FTS fill_real  */
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE)
+
+FFT_SIMD_SPLIT_PASSES(split_passes_sse2, "sse2", __m128, 4,
+                      _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps,
+                      _mm_add_ps, _mm_sub_ps, _mm_mul_ps)
+FFT_SIMD_SPLIT_PASSES(split_passes_avx2, "avx2", __m256, 8,
+                      _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps,
+                      _mm256_add_ps, _mm256_sub_ps, _mm256_mul_ps)
+FFT_SIMD_SPLIT_PASSES(split_passes_avx512, "avx512f", __m512, 16,
+                      _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps,
+                      _mm512_add_ps, _mm512_sub_ps, _mm512_mul_ps)
+
+#else /* double */
+
+FFT_SIMD_SPLIT_PASSES(split_passes_sse2, "sse2", __m128d, 2,
+                      _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd,
+                      _mm_add_pd, _mm_sub_pd, _mm_mul_pd)
+FFT_SIMD_SPLIT_PASSES(split_passes_avx2, "avx2", __m256d, 4,
+                      _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd,
+                      _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd)
+FFT_SIMD_SPLIT_PASSES(split_passes_avx512, "avx512f", __m512d, 8,
+                      _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd,
+                      _mm512_add_pd, _mm512_sub_pd, _mm512_mul_pd)
+
+#endif /* RTA_REAL_TYPE */
+
+/* the scalar passes stop at simd_up, for a contiguous buffer */
 static void
-fill_real_scale_zero_pad(rta_real_t * output, const unsigned int output_size,
-                         rta_real_t * input, const unsigned int input_size,
-                         const rta_real_t scale)
+fft_power_of_2_simd(const rta_fft_setup_t * fft_setup,
+                    rta_complex_t * buf, const int b_stride,
+                    const unsigned int coef_step, const unsigned int size)
 {
-  unsigned int i;
-  unsigned int used_input_size;
-  
-  if(input_size > output_size)
-  {
-    used_input_size = output_size;
-  }
-  else
-  {
-    used_input_size = input_size;
-  }
-  
-  if(scale != 1.)
+  bitreversal(fft_setup, buf, b_stride, coef_step, size);
+  if(b_stride == 1)
   {
-    for(i=0; i<used_input_size; i++)
-    {
-      output[i] = input[i] * scale;
-    }
+    fft_radix4_inplace(buf, 1, fft_setup->cos, fft_setup->sin,
+                       coef_step, size, 1, fft_setup->simd_up);
+    fft_setup->simd_passes(buf, fft_setup->twiddle, simd_sign_forward,
+                           fft_setup->simd_up, size, size);
   }
   else
   {
-    for (i = 0; i < used_input_size; i++)
-    {
-      output[i] = input[i];
-    }    
-  }
-  
-  /* zero padding */
-  for(; i<output_size; i++)
-  {
-    output[i] = 0.0;    
+    fft_radix4_inplace(buf, b_stride, fft_setup->cos, fft_setup->sin,
+                       coef_step, size, 1, size);
   }
   return;
 }
 
 static void
-fill_real_scale_zero_pad_stride(
-  rta_real_t * output, const int o_stride, const unsigned int output_size,
-  rta_real_t * input, const int i_stride, const unsigned int input_size,
-  const rta_real_t scale)
+ifft_power_of_2_simd(const rta_fft_setup_t * fft_setup,
+                     rta_complex_t * buf, const int b_stride,
+                     const unsigned int coef_step, const unsigned int size)
 {
-  unsigned int o, i;
-  unsigned int used_input_size;
-  
-  if(input_size > output_size)
+  bitreversal(fft_setup, buf, b_stride, coef_step, size);
+  if(b_stride == 1)
   {
-    used_input_size = output_size;
+    ifft_radix4_inplace(buf, 1, fft_setup->cos, fft_setup->sin,
+                        coef_step, size, 1, fft_setup->simd_up);
+    fft_setup->simd_passes(buf, fft_setup->twiddle, simd_sign_inverse,
+                           fft_setup->simd_up, size, size);
   }
   else
   {
-    used_input_size = input_size;
-  }
-  
-  if(scale != 1.)
-  {
-    for(i=0, o=0; i<used_input_size*i_stride; i+=i_stride, o+=o_stride)
-    {
-      output[o] = input[i] * scale;
-    }
+    ifft_radix4_inplace(buf, b_stride, fft_setup->cos, fft_setup->sin,
+                        coef_step, size, 1, size);
   }
-  else
+  return;
+}
+#endif /* RTA_FFT_SIMD */
+
+/* the digit reversal is done out of place, into the work buffer */
+static void
+fft_mixed_radix(const rta_fft_setup_t * fft_setup,
+                rta_complex_t * buf, const int b_stride,
+                const unsigned int coef_step, const unsigned int size)
+{
+  rta_complex_t * work = fft_setup->work;
+  unsigned int idx;
+
+  for(idx=0; idx<size; idx++)
   {
-    for(i=0, o=0; i<used_input_size*i_stride; i+=i_stride, o+=o_stride)
-    {
-      output[o] = input[i];
-    }    
+    work[idx] = buf[fft_setup->bitrev[idx] * b_stride];
   }
-  
-  /* zero padding */
-  for(; o<output_size*o_stride; o+=o_stride)
+
+  mixed_radix_passes(work, fft_setup->cos, fft_setup->sin, coef_step,
+                     fft_setup->factors, fft_setup->factors_number, size,
+                     work + size);
+
+  for(idx=0; idx<size; idx++)
   {
-    output[o] = 0.0;    
+    buf[idx * b_stride] = work[idx];
   }
   return;
 }
 
-/* FTS fill_complex  */
+/* inverse transform is the conjugate of the transform of the conjugate */
 static void
-fill_complex_scale_zero_pad(rta_complex_t * output, const unsigned int output_size,
-                            rta_complex_t * input, const unsigned int input_size,
-                            const rta_real_t scale)
+ifft_mixed_radix(const rta_fft_setup_t * fft_setup,
+                 rta_complex_t * buf, const int b_stride,
+                 const unsigned int coef_step, const unsigned int size)
 {
-  unsigned int i;
-  unsigned int used_input_size;
-  
-  if(input_size > output_size)
+  rta_complex_t * work = fft_setup->work;
+  unsigned int idx;
+
+  for(idx=0; idx<size; idx++)
   {
-    used_input_size = output_size;
+    work[idx] = rta_conj(buf[fft_setup->bitrev[idx] * b_stride]);
   }
-  else
+
+  mixed_radix_passes(work, fft_setup->cos, fft_setup->sin, coef_step,
+                     fft_setup->factors, fft_setup->factors_number, size,
+                     work + size);
+
+  for(idx=0; idx<size; idx++)
   {
-    used_input_size = input_size;
+    buf[idx * b_stride] = rta_conj(work[idx]);
   }
-  
-  if(scale != 1.)
+  return;
+}
+
+/* Stockham passes, from 'buf' to the work buffer and back: their */
+/* number is even, for the result to be in 'buf' */
+static void
+stockham_passes(const rta_fft_setup_t * fft_setup, rta_complex_t * buf,
+                const unsigned int coef_step, const unsigned int size,
+                const rta_real_t sign)
+{
+  rta_complex_t * x = buf;
+  rta_complex_t * y = fft_setup->work;
+  unsigned int n = size;
+  unsigned int s = 1;
+  unsigned int pass;
+
+  for(pass=0; n>1; pass++)
   {
-    for(i=0; i<used_input_size; i++)
+    rta_complex_t * swap;
+
+    if(pass < fft_setup->stockham_radix2_passes)
     {
-      output[i] = rta_mul_complex_real(input[i], scale);
+      stockham_pass_2(x, y, fft_setup->cos, fft_setup->sin, coef_step,
+                      n, s, sign);
+      n >>= 1;
+      s <<= 1;
     }
-  }
-  else
-  {
-    for(i=0; i<used_input_size; i++)
+    else
     {
-      output[i] = input[i];
-    }    
-  }
-  
-  /* zero padding */
-  for(; i<output_size; i++)
-  {
-    rta_set_complex_real(output[i], 0.0);    
+#if defined(RTA_FFT_SIMD)
+      if(fft_setup->stockham_simd_pass != NULL &&
+         s >= fft_setup->simd_width)
+      {
+        fft_setup->stockham_simd_pass(x, y, fft_setup->cos, fft_setup->sin,
+                                      coef_step, n, s, sign);
+      }
+      else
+#endif
+      {
+        stockham_pass_4(x, y, fft_setup->cos, fft_setup->sin, coef_step,
+                        n, s, sign);
+      }
+      n >>= 2;
+      s <<= 2;
+    }
+
+    swap = x;
+    x = y;
+    y = swap;
   }
   return;
 }
 
+/* no reordering, for a contiguous buffer */
 static void
-fill_complex_scale_zero_pad_stride(
-  rta_complex_t * output, const int o_stride, const unsigned int output_size,
-  rta_complex_t * input, const int i_stride, const unsigned int input_size,
-  const rta_real_t scale)
+fft_stockham(const rta_fft_setup_t * fft_setup,
+             rta_complex_t * buf, const int b_stride,
+             const unsigned int coef_step, const unsigned int size)
 {
-  unsigned int i, o;
-  unsigned int used_input_size;
-  
-  if(input_size > output_size)
+  if(b_stride == 1)
   {
-    used_input_size = output_size;
+    stockham_passes(fft_setup, buf, coef_step, size, 1.);
   }
   else
   {
-    used_input_size = input_size;
+    fft_power_of_2(fft_setup, buf, b_stride, coef_step, size);
   }
-  
-  if(scale != 1.)
+  return;
+}
+
+static void
+ifft_stockham(const rta_fft_setup_t * fft_setup,
+              rta_complex_t * buf, const int b_stride,
+              const unsigned int coef_step, const unsigned int size)
+{
+  if(b_stride == 1)
   {
-    for(i=0, o=0; i<used_input_size*i_stride; i+=i_stride, o+=o_stride)
-    {
-      output[o] = rta_mul_complex_real(input[i], scale);
-    }
+    stockham_passes(fft_setup, buf, coef_step, size, -1.);
   }
   else
   {
-    for(i=0, o=0; i<used_input_size*i_stride; i+=i_stride, o+=o_stride)
-    {
-      output[o] = input[i];
-    }    
-  }
-  
-  /* zero padding */
-  for(; o<output_size*o_stride; o+=o_stride)
-  {
-    rta_set_complex_real(output[o], 0.0);    
+    ifft_power_of_2(fft_setup, buf, b_stride, coef_step, size);
   }
   return;
 }
 
+/********************************************************************
+ * input and output pruning
+ *
+ *    When only the first 'size' / 'up' points of the buffer may be
+ *    non-zero, after the bit reversal they are at the multiples of
+ *    'up', and the first passes on each group of 'up' points (with a
+ *    single non-zero point) simply replicate it. The bit reversal is
+ *    done among the non-zero points only, and the passes start at
+ *    'up', which costs log2('size' / 'up') passes instead of
+ *    log2('size').
+ *
+ *    When only the first points of the transform (and the last ones,
+ *    for the real shuffle) are needed, the passes stop at blocks of
+ *    'block_size' points. Each block b then holds the transform of the
+ *    samples of residue r = bitrev(b) modulo P = 'size' / 'block_size',
+ *    and the needed points are combined directly:
+ *      X[k] = sum_b W^(r*k) * Y_b[k mod block_size]
+ *    which costs P multiplications per point instead of the last
+ *    log2(P) passes.
+ */
 
-static void
-fill_complex_from_real_scale_zero_pad(
-  rta_complex_t * output, const unsigned int output_size,
-  rta_real_t * input, const unsigned int input_size,
-  const rta_real_t scale)
+/* half size of the first butterfly to compute, from the input size; */
+/* 1 for no pruning */
+static unsigned int
+pruned_input_up(const rta_fft_setup_t * fft_setup, const unsigned int size)
 {
-  unsigned int i;
-  unsigned int used_input_size;
-  
-  if(input_size > output_size)
+  /* real input samples are packed by 2 */
+  unsigned int non_zero = (fft_setup->fft_type == rta_fft_real_to_complex_1d ?
+                           (fft_setup->input_size + 1) >> 1 :
+                           fft_setup->input_size);
+  unsigned int up = 1;
+
+  /* the inverse real shuffle fills the whole buffer */
+  if(fft_setup->input_pruning == 0 ||
+     fft_setup->fft_type == rta_fft_complex_to_real_1d)
   {
-    used_input_size = output_size;
+    return 1;
   }
-  else
+
+  if(non_zero == 0)
   {
-    used_input_size = input_size;
+    non_zero = 1;
   }
-  
-  if(scale != 1.)
+
+  if(non_zero <= size >> 2)
   {
-    for(i=0; i<used_input_size; i++)
+    up = size / rta_inextpow2(non_zero);
+
+    /* 'size' / 'up' must be a power of 4 for the radix-4 passes */
+    if((rta_ilog2(up) ^ rta_ilog2(size)) & 1)
     {
-      rta_set_complex_real(output[i], input[i] * scale);
+      up >>= 1;
+    }
+
+    /* a single radix-2 pass is not worth it */
+    if(up < 4)
+    {
+      up = 1;
     }
   }
-  else
+
+  return up;
+}
+
+/* number of first (low) points needed, from the output size; */
+/* 'size' for no pruning */
+static unsigned int
+pruned_output_low_size(const rta_fft_setup_t * fft_setup,
+                       const unsigned int size)
+{
+  unsigned int low_size = fft_setup->output_pruning;
+
+  /* real output samples are packed by 2 */
+  if(fft_setup->fft_type == rta_fft_complex_to_real_1d)
   {
-    for (i = 0; i < used_input_size; i++)
-    {
-      rta_set_complex_real(output[i], input[i]);
-    }    
+    low_size = (low_size + 1) >> 1;
   }
-  
-  /* zero padding */
-  for(; i<output_size; i++)
+
+  return ((low_size == 0 || low_size > size) ? size : low_size);
+}
+
+/* size of the blocks where the passes stop; 'size' for no pruning */
+static unsigned int
+pruned_output_block_size(const rta_fft_setup_t * fft_setup,
+                         const unsigned int size,
+                         const unsigned int low_size)
+{
+  /* the real shuffle also needs the last low_size - 1 points */
+  const unsigned int needed =
+    (fft_setup->fft_type == rta_fft_real_to_complex_1d ?
+     2 * low_size - 1 : low_size);
+  unsigned int block_size = size;
+
+  if(needed <= size >> 2)
   {
-    rta_set_complex_real(output[i], 0.0);    
+    block_size = rta_inextpow2(needed);
+
+    /* block sizes after the first radix-2 or radix-4 passes */
+    if((rta_ilog2(block_size) ^ rta_ilog2(size)) & 1)
+    {
+      block_size <<= 1;
+    }
+
+    if(block_size > size >> 2)
+    {
+      block_size = size;
+    }
   }
-  return;
+
+  return block_size;
 }
 
+/* the first 'low_size' and the last 'high_size' points, from the */
+/* transforms of the blocks, in place */
 static void
-fill_complex_from_real_scale_zero_pad_stride(
-  rta_complex_t * output, const int o_stride, const unsigned int output_size,
-  rta_real_t * input, const int i_stride, const unsigned int input_size,
-  const rta_real_t scale)
+pruned_output_combine(const rta_fft_setup_t * fft_setup, rta_complex_t * buf,
+                      const unsigned int coef_step, const unsigned int size,
+                      const unsigned int block_size,
+                      const unsigned int low_size,
+                      const unsigned int high_size)
 {
-  unsigned int i, o;
-  unsigned int used_input_size;
-  
-  if(input_size > output_size)
+  const rta_real_t sign =
+    (fft_setup->fft_type == rta_fft_complex_to_real_1d ||
+     fft_setup->fft_type == rta_fft_complex_inverse_1d ? -1. : 1.);
+  const unsigned int mask = coef_step * size - 1;
+  const unsigned int last = size - block_size;
+  unsigned int b, c, k;
+
+  /* the first block holds residue 0, whose twiddle factors are 1 */
+  for(b=block_size; b<size; b+=block_size)
   {
-    used_input_size = output_size;
-  }
-  else
-  {
-    used_input_size = input_size;
-  }
-  
-  if(scale != 1.)
-  {
-    for(i=0, o=0; i<used_input_size*i_stride; i+=i_stride, o+=o_stride)
+    const unsigned int step = coef_step * fft_setup->bitrev[coef_step * b];
+    const rta_complex_t * y = buf + b;
+
+    for(k=0, c=0; k<low_size; k++, c=(c+step)&mask)
     {
-      rta_set_complex_real(output[o], input[i] * scale);
+      buf[k] = rta_add_complex(
+        buf[k], fft_twiddle(y[k], fft_setup->cos[c], sign * fft_setup->sin[c]));
     }
   }
-  else
+
+  /* last points, size - k for k = 1..high_size, in the last block, */
+  /* whose low points (read above) do not overlap */
+  if(high_size > 0)
   {
-    for(i=0, o=0; i<used_input_size*i_stride; i+=i_stride, o+=o_stride)
+    const unsigned int step =
+      coef_step * fft_setup->bitrev[coef_step * last];
+
+    for(k=1, c=(0-step)&mask; k<=high_size; k++, c=(c-step)&mask)
     {
-      rta_set_complex_real(output[o], input[i]);
-    }    
-  }
-  
-  /* zero padding */
-  for(; o<output_size*o_stride; o+=o_stride)
-  {
-    rta_set_complex_real(output[o], 0.0);    
+      buf[size - k] = fft_twiddle(buf[size - k], fft_setup->cos[c],
+                                  sign * fft_setup->sin[c]);
+    }
+
+    for(b=0; b<last; b+=block_size)
+    {
+      const unsigned int block_step =
+        coef_step * fft_setup->bitrev[coef_step * b];
+      const rta_complex_t * y = buf + b + block_size;
+
+      for(k=1, c=(0-block_step)&mask; k<=high_size;
+          k++, c=(c-block_step)&mask)
+      {
+        buf[size - k] = rta_add_complex(
+          buf[size - k],
+          fft_twiddle(y[-(int) k], fft_setup->cos[c],
+                      sign * fft_setup->sin[c]));
+      }
+    }
   }
   return;
 }
 
-
+/* for a contiguous buffer of a power of 2 'size', with */
+/* up <= block_size */
 static void
-scale_real_zero_pad_in_place(rta_real_t * buf, const unsigned int output_size,
-                             const unsigned int input_size,
-                             const rta_real_t scale)
+fft_pruned(const rta_fft_setup_t * fft_setup, rta_complex_t * buf,
+           const unsigned int coef_step, const unsigned int size,
+           const unsigned int up, const unsigned int block_size)
 {
-  unsigned int i;
-  unsigned int used_input_size;
-  
-  if(input_size > output_size)
-  {
-    used_input_size = output_size;
-  }
-  else
-  {
-    used_input_size = input_size;
-  }
-  
-  if(scale != 1.)
+  const int inverse =
+    (fft_setup->fft_type == rta_fft_complex_to_real_1d ||
+     fft_setup->fft_type == rta_fft_complex_inverse_1d);
+  unsigned int up_end = block_size;
+  unsigned int idx, m;
+
+  if(up > 1)
   {
-    for(i=0; i<used_input_size; i++)
+    const unsigned int non_zero_size = size / up;
+
+    /* bit reversal over log2(size) bits of idx < non_zero_size is */
+    /* 'up' times its bit reversal over log2(non_zero_size) bits */
+    for(idx=0; idx<non_zero_size; idx++)
     {
-      buf[i] *= scale;
+      const unsigned int xdi = fft_setup->bitrev[coef_step * idx] / up;
+
+      if(xdi > idx)
+      {
+        rta_complex_t z = buf[idx];
+        buf[idx] = buf[xdi];
+        buf[xdi] = z;
+      }
+    }
+
+    /* backwards, as idx <= idx * up */
+    for(idx=non_zero_size; idx-- > 0;)
+    {
+      const rta_complex_t z = buf[idx];
+
+      for(m=idx*up; m<(idx+1)*up; m++)
+      {
+        buf[m] = z;
+      }
     }
   }
   else
   {
-    i = used_input_size;
+    bitreversal(fft_setup, buf, 1, coef_step, size);
   }
-  
-  /* zero padding */
-  for(; i<output_size; i++)
+
+#if defined(RTA_FFT_SIMD)
+  if(fft_setup->simd_passes != NULL && fft_setup->simd_up < block_size)
   {
-    buf[i] = 0.0;    
+    up_end = (up < fft_setup->simd_up ? fft_setup->simd_up : up);
   }
-  return;
-}
+#endif
 
-static void
-scale_real_zero_pad_in_place_stride(
-  rta_real_t * buf, const int b_stride, const unsigned int output_size,
-  const unsigned int input_size,
-  const rta_real_t scale)
-{
-  unsigned int i;
-  unsigned int used_input_size;
-  
-  if(input_size > output_size)
+  if(inverse)
   {
-    used_input_size = output_size;
+    ifft_radix4_inplace(buf, 1, fft_setup->cos, fft_setup->sin,
+                        coef_step, size, up, up_end);
   }
   else
   {
-    used_input_size = input_size;
+    fft_radix4_inplace(buf, 1, fft_setup->cos, fft_setup->sin,
+                       coef_step, size, up, up_end);
   }
-  
-  if(scale != 1.)
+
+#if defined(RTA_FFT_SIMD)
+  if(up_end < block_size)
   {
-    for(i=0; i<used_input_size*b_stride; i+=b_stride)
+    /* skip the twiddle factors of the pruned vector passes, the */
+    /* other ones do not depend on the size */
+    const rta_real_t * twiddle = fft_setup->twiddle;
+
+    for(m=fft_setup->simd_up; m<up_end; m<<=2)
     {
-      buf[i] *= scale;
+      twiddle += 12 * m;
+    }
+
+    for(m=0; m<size; m+=block_size)
+    {
+      fft_setup->simd_passes(buf + m, twiddle,
+                             (inverse ? simd_sign_inverse : simd_sign_forward),
+                             up_end, block_size, block_size);
     }
   }
-  else
-  {
-    i = used_input_size*b_stride;
-  }
-  
-  /* zero padding */
-  for(; i<output_size*b_stride; i+=b_stride)
+#endif
+
+  if(block_size < size)
   {
-    buf[i] = 0.0;    
+    const unsigned int low_size = pruned_output_low_size(fft_setup, size);
+    pruned_output_combine(
+      fft_setup, buf, coef_step, size, block_size, low_size,
+      (fft_setup->fft_type == rta_fft_real_to_complex_1d ? low_size - 1 : 0));
   }
   return;
 }
 
-
+/* selected kernel, or pruned passes if enabled and worth it */
 static void
-scale_complex_zero_pad_in_place(rta_complex_t * buf, const unsigned int output_size,
-                                const unsigned int input_size,
-                                const rta_real_t scale)
+kernel_execute(const rta_fft_setup_t * fft_setup,
+               rta_complex_t * buf, const int b_stride,
+               const unsigned int coef_step, const unsigned int size)
 {
-  unsigned int i;
-  unsigned int used_input_size;
-  
-  if(input_size > output_size)
-  {
-    used_input_size = output_size;
-  }
-  else
-  {
-    used_input_size = input_size;
-  }
-  
-  if(scale != 1.)
+  unsigned int up = 1;
+  unsigned int block_size = size;
+
+  if(b_stride == 1 && fft_setup->factors_number == 0)
   {
-    for(i=0; i<used_input_size; i++)
+    up = pruned_input_up(fft_setup, size);
+    block_size = pruned_output_block_size(
+      fft_setup, size, pruned_output_low_size(fft_setup, size));
+
+    /* the replicated points are only right for the passes up to 'up' */
+    if(up > block_size)
     {
-      buf[i] = rta_mul_complex_real(buf[i], scale);
+      up = (block_size >= 4 ? block_size : 1);
     }
   }
-  else
+
+  if(up > 1 || block_size < size)
   {
-    i = used_input_size;
+    fft_pruned(fft_setup, buf, coef_step, size, up, block_size);
   }
-  
-  /* zero padding */
-  for(; i<output_size; i++)
+  else
   {
-    rta_set_complex_real(buf[i], 0.0);    
+    fft_setup->kernel(fft_setup, buf, b_stride, coef_step, size);
   }
   return;
 }
 
+/* from rfft_shuffle_after_fft_inplc */
+/**************************************************************************
+ *
+ *    rfft_shuffle_after_fft() and rfft_shuffle_befor_ifft()
+ *
+ *      shuffling routines to compute the positive half of a spectra out of the FFT
+ *      of a 2*N points real signal treated as real and imaginary part of a complex
+ *      signal and vice versa:
+ *
+ *      with:
+ *        X+ = rfft_shuffle_after_fft(S, ...) ... use after complex FFT
+ *      and:
+ *        S = rfft_shuffle_befor_ifft(X+, ...) ... use befor complex IFFT
+ *
+ *      where:
+ *        x[m], m = 0..2*N-1 ... real signal
+ *        X+[k], k = 0..N-1 ... positive part of spectrum of x[m]
+ *      and:
+ *        s[n] = x[2n] + j x[2n+1], n = 0..N-1 ... real signal as complex vector
+ *        S[k], k = 0..N-1 ... complex FFT of complex vector s[n]
+ *
+ *
+ *    arguments:
+ *      buf ... buffer for inplace shuffling
+ *      in, out ... input vector, output vector for non inplace shuffling
+ *      coef_re ... lookup table with cos(2*PI*i/size), i = 0 ... size/2-1
+ *      coef_im ... lookup table with sin(2*PI*i/size), i = 0 ... size/2-1
+ *      size ... # of complex points (cfft size)
+ *      (Note: the lookup tables just contain half of the sine/cosine period in size points)
+ */
 static void
-scale_complex_zero_pad_in_place_stride(
-  rta_complex_t * buf, const int b_stride, const unsigned int output_size,
-  const unsigned int input_size,
-  const rta_real_t scale)
+shuffle_after_real_fft_inplace(rta_complex_t * buf, 
+                               const rta_real_t * coef_real,
+                               const rta_real_t * coef_imag,
+                               const int size)
 {
-  unsigned int i;
-  unsigned int used_input_size;
+  int idx, xdi;
   
-  if(input_size > output_size)
-  {
-    used_input_size = output_size;
-  }
-  else
-  {
-    used_input_size = input_size;
-  }
+  /* nyquist point coded in imaginary part first point  */
+  buf[0] = rta_make_complex(rta_creal(buf[0]) + rta_cimag(buf[0]), rta_creal(buf[0]) - rta_cimag(buf[0]));
+    
   
-  if(scale != 1.)
-  {
-    for(i=0; i<used_input_size*b_stride; i+=b_stride)
-    {
-      buf[i] = rta_mul_complex_real(buf[i], scale);
-    }
-  }
-  else
+  for(idx=1, xdi=size-1; idx<xdi; idx++, xdi--)
   {
-    i = used_input_size*b_stride;
+    rta_real_t x1_real = 0.5*(rta_creal(buf[idx]) + rta_creal(buf[xdi]));
+    rta_real_t x1_imag = 0.5*(rta_cimag(buf[idx]) - rta_cimag(buf[xdi]));
+
+    rta_real_t x2_real = 0.5*(rta_cimag(buf[xdi]) + rta_cimag(buf[idx]));
+    rta_real_t x2_imag = 0.5*(rta_creal(buf[xdi]) - rta_creal(buf[idx]));
+
+    /* real of x2[idx] * exp(-j*PI*i/size) */
+    rta_real_t x2Ej_real = x2_imag * coef_imag[idx] + x2_real * coef_real[idx]; 
+    
+    /* imaginary of x2[idx] * exp(-j*PI*i/size) */
+    rta_real_t x2Ej_imag = x2_imag * coef_real[idx] - x2_real * coef_imag[idx];
+    
+    buf[idx] = rta_make_complex(x1_real + x2Ej_real, x1_imag + x2Ej_imag);
+    buf[xdi] = rta_make_complex(x1_real - x2Ej_real, x2Ej_imag - x1_imag);
   }
   
-  /* zero padding */
-  for(; i<output_size*b_stride; i+=b_stride)
+  /* middle point, for an even size */
+  if(idx == xdi)
   {
-    rta_set_complex_real(buf[i], 0.0);    
+    buf[idx] = rta_conj(buf[idx]);
   }
   return;
 }
 
-
-
-/* sine, cosine and bitreverse tables */
-/* retrun 1 on success, 0 on fail */
-static int
-tables_new(rta_fft_setup_t * fft_setup)
+static void
+shuffle_after_real_fft_inplace_stride(rta_complex_t * buf, 
+                                      const int b_stride,
+                                      const rta_real_t * coef_real,
+                                      const rta_real_t * coef_imag,
+                                      const int size)
 {
-  int ret = 0;
-  /* sine (and cosine) table */
-
-  /* 1/4 more for cosine as phase shift and one more point at the end */
-  /* => total size is 5/4*sine_size + 1 */
-  fft_setup->sin = (rta_real_t *) rta_malloc(
-    sizeof(rta_real_t) * (fft_setup->fft_size * 5/4 + 1));
+  int idx, xdi;
+  int idx_s, xdi_s; /* indexes * b_stride */
 
-  if(fft_setup->sin != NULL)
+  /* nyquist point coded in imaginary part first point  */
+  buf[0] = rta_make_complex(rta_creal(buf[0]) + rta_cimag(buf[0]), rta_creal(buf[0]) - rta_cimag(buf[0]));
+    
+  for(idx=1, xdi=size-1, idx_s=b_stride, xdi_s=(size-1)*b_stride;
+      idx<xdi;
+      idx++, xdi--, idx_s+=b_stride, xdi_s-=b_stride)
   {
-    /* sine function from 0 to 2pi, inclusive (plus 1/4 for cosine) */
-    /* step = 5/4 * 2 pi / (5/4 * size) = 2 * pi / size */
-    const rta_real_t step = 2. * M_PI / fft_setup->fft_size;
-    unsigned int i;
-    for(i=0; i<=fft_setup->fft_size * 5/4; i++)
-    {
-      fft_setup->sin[i] = rta_sin(i*step);
-    }
-
-    /* cosine function is just a phase-shifted sine */
-    /* Memory is shared */
-    fft_setup->cos = fft_setup->sin + (fft_setup->fft_size / 4);
+    rta_real_t x1_real = 0.5*(rta_creal(buf[idx_s]) + rta_creal(buf[xdi_s]));
+    rta_real_t x1_imag = 0.5*(rta_cimag(buf[idx_s]) - rta_cimag(buf[xdi_s]));
 
-    /* Bit reversal table */
-    fft_setup->bitrev = (unsigned int *) rta_malloc(
-      sizeof(unsigned int) * fft_setup->fft_size);
+    rta_real_t x2_real = 0.5*(rta_cimag(buf[xdi_s]) + rta_cimag(buf[idx_s]));
+    rta_real_t x2_imag = 0.5*(rta_creal(buf[xdi_s]) - rta_creal(buf[idx_s]));
 
-    if(fft_setup->bitrev != NULL)
-    {
-      unsigned int idx, xdi;
-      unsigned int i, j;
-          
-      for(i=0; i<fft_setup->fft_size; i++)
-      {
-        idx = i;
-        xdi = 0;
+    /* real of x2[idx] * exp(-j*PI*i/size) */
+    rta_real_t x2Ej_real = x2_imag * coef_imag[idx] + x2_real * coef_real[idx]; 
     
-        for(j=1; j<fft_setup->log2_size; j++)
-        {
-          xdi += (idx & 1);
-          xdi <<= 1;
-          idx >>= 1;
-        }
+    /* imaginary of x2[idx] * exp(-j*PI*i/size) */
+    rta_real_t x2Ej_imag = x2_imag * coef_real[idx] - x2_real * coef_imag[idx];
     
-        fft_setup->bitrev[i] = xdi + (idx & 1);
-      }
-        
-      ret = 1; /* setup complete */
-    }
-    else /* bitrev failed */
-      rta_free(fft_setup->sin);
+    buf[idx_s] = rta_make_complex(x1_real + x2Ej_real, x1_imag + x2Ej_imag);
+    buf[xdi_s] = rta_make_complex(x1_real - x2Ej_real, x2Ej_imag - x1_imag);
   }
-  /* else: sin failed */
   
-  return ret;
+  /* middle point, for an even size */
+  if(idx == xdi)
+  {
+    buf[idx_s] = rta_conj(buf[idx_s]);
+  }
+  return;
 }
 
-/* ------- end of private ---------------------------- */
+/**
+ * Separate the spectra of two real signals x and y, from the complex
+ * transform of x + j*y of 2*'half' points, in place: X(k) is written
+ * in 'buf'[k] and Y(k) in 'buf'['half'+k], for k < 'half'. As for a
+ * real transform, the imaginary parts of X(0) and Y(0) are the
+ * (real) Nyquist values.
+ *
+ *   X(k) = (Z(k) + conj(Z(N-k))) / 2
+ *   Y(k) = (Z(k) - conj(Z(N-k))) / 2j
+ *
+ * This is the first step of shuffle_after_real_fft_inplace (x1 and
+ * x2), without the twiddle. Each Y(k) goes where Z(N-k') is, with
+ * k' = 'half'-k, so k and k' are separated together.
+ */
+static void
+separate_real_pair_inplace(rta_complex_t * buf, const int half)
+{
+  rta_complex_t * high = buf + half;
+  int idx, xdi;
+  rta_real_t re, im;
+
+  re = rta_creal(buf[0]);
+  im = rta_cimag(buf[0]);
+  buf[0] = rta_make_complex(re, rta_creal(high[0]));
+  high[0] = rta_make_complex(im, rta_cimag(high[0]));
+
+  /* buf[N-idx] is high[xdi] */
+  for(idx=1, xdi=half-1; idx<xdi; idx++, xdi--)
+  {
+    rta_real_t x1_real = 0.5*(rta_creal(buf[idx]) + rta_creal(high[xdi]));
+    rta_real_t x1_imag = 0.5*(rta_cimag(buf[idx]) - rta_cimag(high[xdi]));
+    rta_real_t x2_real = 0.5*(rta_cimag(high[xdi]) + rta_cimag(buf[idx]));
+    rta_real_t x2_imag = 0.5*(rta_creal(high[xdi]) - rta_creal(buf[idx]));
+
+    rta_real_t y1_real = 0.5*(rta_creal(buf[xdi]) + rta_creal(high[idx]));
+    rta_real_t y1_imag = 0.5*(rta_cimag(buf[xdi]) - rta_cimag(high[idx]));
+    rta_real_t y2_real = 0.5*(rta_cimag(high[idx]) + rta_cimag(buf[xdi]));
+    rta_real_t y2_imag = 0.5*(rta_creal(high[idx]) - rta_creal(buf[xdi]));
+
+    buf[idx] = rta_make_complex(x1_real, x1_imag);
+    high[idx] = rta_make_complex(x2_real, x2_imag);
+    buf[xdi] = rta_make_complex(y1_real, y1_imag);
+    high[xdi] = rta_make_complex(y2_real, y2_imag);
+  }
+
+  /* middle point, for an even 'half' */
+  if(idx == xdi)
+  {
+    rta_real_t x1_real = 0.5*(rta_creal(buf[idx]) + rta_creal(high[idx]));
+    rta_real_t x1_imag = 0.5*(rta_cimag(buf[idx]) - rta_cimag(high[idx]));
+    rta_real_t x2_real = 0.5*(rta_cimag(high[idx]) + rta_cimag(buf[idx]));
+    rta_real_t x2_imag = 0.5*(rta_creal(high[idx]) - rta_creal(buf[idx]));
+
+    buf[idx] = rta_make_complex(x1_real, x1_imag);
+    high[idx] = rta_make_complex(x2_real, x2_imag);
+  }
+  return;
+}
+
+/* from rfft_shuffle_before_ifft_inplc */
+static void
+shuffle_before_real_inverse_fft_inplace(rta_complex_t * buf,
+                                        const rta_real_t *coef_real,
+                                        const rta_real_t *coef_imag,
+                                        const int size)
+{
+  int idx, xdi;
+  
+  /* nyquist point coded in imaginary part of the first point */
+  buf[0] = rta_make_complex(rta_creal(buf[0]) + rta_cimag(buf[0]), rta_creal(buf[0]) - rta_cimag(buf[0]));
+
+  for(idx=1, xdi=size-1; idx<xdi; idx++, xdi--)
+  {
+    rta_real_t x1_real = rta_creal(buf[idx]) + rta_creal(buf[xdi]);
+    rta_real_t x1_imag = rta_cimag(buf[idx]) - rta_cimag(buf[xdi]);
+
+    /* real of x2[idx] * exp(-j*PI*i/size) */
+    rta_real_t x2Ej_real = rta_creal(buf[idx]) - rta_creal(buf[xdi]);
+
+    /* imaginary of x2[idx] * exp(-j*PI*i/size) */
+    rta_real_t x2Ej_imag = rta_cimag(buf[idx]) + rta_cimag(buf[xdi]);
+
+    /* real of x2 */
+    rta_real_t x2_real = x2Ej_real * coef_real[idx] - x2Ej_imag * coef_imag[idx];
+  
+    /* imaginary of x2 */
+    rta_real_t x2_imag = x2Ej_real * coef_imag[idx] + x2Ej_imag * coef_real[idx];
+
+    buf[idx] = rta_make_complex(x1_real - x2_imag, x1_imag + x2_real);
+    buf[xdi] = rta_make_complex(x1_real + x2_imag, x2_real - x1_imag);
+
+  }
+  /* middle point, for an even size */
+  if(idx == xdi)
+  {
+    buf[idx] = rta_mul_complex_real(rta_conj(buf[idx]), 2);
+  }
+  return;
+}
+
+static void
+shuffle_before_real_inverse_fft_inplace_stride(rta_complex_t * buf,
+                                               const int b_stride,
+                                               const rta_real_t *coef_real,
+                                               const rta_real_t *coef_imag,
+                                               const int size)
+{
+  int idx, xdi;
+  int idx_s, xdi_s; /* indexes * b_stride */
+
+  /* nyquist point coded in imaginary part of the first point */
+  buf[0] = rta_make_complex(rta_creal(buf[0]) + rta_cimag(buf[0]), rta_creal(buf[0]) - rta_cimag(buf[0]));
+
+  for(idx=1, xdi=size-1, idx_s=b_stride, xdi_s=(size-1)*b_stride;
+      idx<xdi;
+      idx++, xdi--, idx_s+=b_stride, xdi_s-=b_stride)
+  {
+    rta_real_t x1_real = rta_creal(buf[idx_s]) + rta_creal(buf[xdi_s]);
+    rta_real_t x1_imag = rta_cimag(buf[idx_s]) - rta_cimag(buf[xdi_s]);
+
+    /* real of x2[idx] * exp(-j*PI*i/size) */
+    rta_real_t x2Ej_real = rta_creal(buf[idx_s]) - rta_creal(buf[xdi_s]);
+
+    /* imaginary of x2[idx] * exp(-j*PI*i/size) */
+    rta_real_t x2Ej_imag = rta_cimag(buf[idx_s]) + rta_cimag(buf[xdi_s]);
+
+    /* real of x2 */
+    rta_real_t x2_real = x2Ej_real * coef_real[idx] - x2Ej_imag * coef_imag[idx];
+  
+    /* imaginary of x2 */
+    rta_real_t x2_imag = x2Ej_real * coef_imag[idx] + x2Ej_imag * coef_real[idx];
+
+    buf[idx_s] = rta_make_complex(x1_real - x2_imag, x1_imag + x2_real);
+    buf[xdi_s] = rta_make_complex(x1_real + x2_imag, x2_real - x1_imag);
+
+  }
+  /* middle point, for an even size */
+  if(idx == xdi)
+  {
+    buf[idx_s] = rta_mul_complex_real(rta_conj(buf[idx_s]), 2);
+  }
+  return;
+}
+
+
+/* FTS fill_real  */
+static void
+fill_real_scale_zero_pad(rta_real_t * output, const unsigned int output_size,
+                         rta_real_t * input, const unsigned int input_size,
+                         const rta_real_t scale)
+{
+  unsigned int i;
+  unsigned int used_input_size;
+  
+  if(input_size > output_size)
+  {
+    used_input_size = output_size;
+  }
+  else
+  {
+    used_input_size = input_size;
+  }
+  
+  if(scale != 1.)
+  {
+    for(i=0; i<used_input_size; i++)
+    {
+      output[i] = input[i] * scale;
+    }
+  }
+  else
+  {
+    for (i = 0; i < used_input_size; i++)
+    {
+      output[i] = input[i];
+    }    
+  }
+  
+  /* zero padding */
+  for(; i<output_size; i++)
+  {
+    output[i] = 0.0;    
+  }
+  return;
+}
+
+static void
+fill_real_scale_zero_pad_stride(
+  rta_real_t * output, const int o_stride, const unsigned int output_size,
+  rta_real_t * input, const int i_stride, const unsigned int input_size,
+  const rta_real_t scale)
+{
+  unsigned int o, i;
+  unsigned int used_input_size;
+  
+  if(input_size > output_size)
+  {
+    used_input_size = output_size;
+  }
+  else
+  {
+    used_input_size = input_size;
+  }
+  
+  if(scale != 1.)
+  {
+    for(i=0, o=0; i<used_input_size*i_stride; i+=i_stride, o+=o_stride)
+    {
+      output[o] = input[i] * scale;
+    }
+  }
+  else
+  {
+    for(i=0, o=0; i<used_input_size*i_stride; i+=i_stride, o+=o_stride)
+    {
+      output[o] = input[i];
+    }    
+  }
+  
+  /* zero padding */
+  for(; o<output_size*o_stride; o+=o_stride)
+  {
+    output[o] = 0.0;    
+  }
+  return;
+}
+
+/* FTS fill_complex  */
+static void
+fill_complex_scale_zero_pad(rta_complex_t * output, const unsigned int output_size,
+                            rta_complex_t * input, const unsigned int input_size,
+                            const rta_real_t scale)
+{
+  unsigned int i;
+  unsigned int used_input_size;
+  
+  if(input_size > output_size)
+  {
+    used_input_size = output_size;
+  }
+  else
+  {
+    used_input_size = input_size;
+  }
+  
+  if(scale != 1.)
+  {
+    for(i=0; i<used_input_size; i++)
+    {
+      output[i] = rta_mul_complex_real(input[i], scale);
+    }
+  }
+  else
+  {
+    for(i=0; i<used_input_size; i++)
+    {
+      output[i] = input[i];
+    }    
+  }
+  
+  /* zero padding */
+  for(; i<output_size; i++)
+  {
+    rta_set_complex_real(output[i], 0.0);    
+  }
+  return;
+}
+
+static void
+fill_complex_scale_zero_pad_stride(
+  rta_complex_t * output, const int o_stride, const unsigned int output_size,
+  rta_complex_t * input, const int i_stride, const unsigned int input_size,
+  const rta_real_t scale)
+{
+  unsigned int i, o;
+  unsigned int used_input_size;
+  
+  if(input_size > output_size)
+  {
+    used_input_size = output_size;
+  }
+  else
+  {
+    used_input_size = input_size;
+  }
+  
+  if(scale != 1.)
+  {
+    for(i=0, o=0; i<used_input_size*i_stride; i+=i_stride, o+=o_stride)
+    {
+      output[o] = rta_mul_complex_real(input[i], scale);
+    }
+  }
+  else
+  {
+    for(i=0, o=0; i<used_input_size*i_stride; i+=i_stride, o+=o_stride)
+    {
+      output[o] = input[i];
+    }    
+  }
+  
+  /* zero padding */
+  for(; o<output_size*o_stride; o+=o_stride)
+  {
+    rta_set_complex_real(output[o], 0.0);    
+  }
+  return;
+}
+
+
+static void
+fill_complex_from_real_scale_zero_pad(
+  rta_complex_t * output, const unsigned int output_size,
+  rta_real_t * input, const unsigned int input_size,
+  const rta_real_t scale)
+{
+  unsigned int i;
+  unsigned int used_input_size;
+  
+  if(input_size > output_size)
+  {
+    used_input_size = output_size;
+  }
+  else
+  {
+    used_input_size = input_size;
+  }
+  
+  if(scale != 1.)
+  {
+    for(i=0; i<used_input_size; i++)
+    {
+      rta_set_complex_real(output[i], input[i] * scale);
+    }
+  }
+  else
+  {
+    for (i = 0; i < used_input_size; i++)
+    {
+      rta_set_complex_real(output[i], input[i]);
+    }    
+  }
+  
+  /* zero padding */
+  for(; i<output_size; i++)
+  {
+    rta_set_complex_real(output[i], 0.0);    
+  }
+  return;
+}
+
+static void
+fill_complex_from_real_scale_zero_pad_stride(
+  rta_complex_t * output, const int o_stride, const unsigned int output_size,
+  rta_real_t * input, const int i_stride, const unsigned int input_size,
+  const rta_real_t scale)
+{
+  unsigned int i, o;
+  unsigned int used_input_size;
+  
+  if(input_size > output_size)
+  {
+    used_input_size = output_size;
+  }
+  else
+  {
+    used_input_size = input_size;
+  }
+  
+  if(scale != 1.)
+  {
+    for(i=0, o=0; i<used_input_size*i_stride; i+=i_stride, o+=o_stride)
+    {
+      rta_set_complex_real(output[o], input[i] * scale);
+    }
+  }
+  else
+  {
+    for(i=0, o=0; i<used_input_size*i_stride; i+=i_stride, o+=o_stride)
+    {
+      rta_set_complex_real(output[o], input[i]);
+    }    
+  }
+  
+  /* zero padding */
+  for(; o<output_size*o_stride; o+=o_stride)
+  {
+    rta_set_complex_real(output[o], 0.0);    
+  }
+  return;
+}
+
+
+static void
+scale_real_zero_pad_in_place(rta_real_t * buf, const unsigned int output_size,
+                             const unsigned int input_size,
+                             const rta_real_t scale)
+{
+  unsigned int i;
+  unsigned int used_input_size;
+  
+  if(input_size > output_size)
+  {
+    used_input_size = output_size;
+  }
+  else
+  {
+    used_input_size = input_size;
+  }
+  
+  if(scale != 1.)
+  {
+    for(i=0; i<used_input_size; i++)
+    {
+      buf[i] *= scale;
+    }
+  }
+  else
+  {
+    i = used_input_size;
+  }
+  
+  /* zero padding */
+  for(; i<output_size; i++)
+  {
+    buf[i] = 0.0;    
+  }
+  return;
+}
+
+static void
+scale_real_zero_pad_in_place_stride(
+  rta_real_t * buf, const int b_stride, const unsigned int output_size,
+  const unsigned int input_size,
+  const rta_real_t scale)
+{
+  unsigned int i;
+  unsigned int used_input_size;
+  
+  if(input_size > output_size)
+  {
+    used_input_size = output_size;
+  }
+  else
+  {
+    used_input_size = input_size;
+  }
+  
+  if(scale != 1.)
+  {
+    for(i=0; i<used_input_size*b_stride; i+=b_stride)
+    {
+      buf[i] *= scale;
+    }
+  }
+  else
+  {
+    i = used_input_size*b_stride;
+  }
+  
+  /* zero padding */
+  for(; i<output_size*b_stride; i+=b_stride)
+  {
+    buf[i] = 0.0;    
+  }
+  return;
+}
+
+
+static void
+scale_complex_zero_pad_in_place(rta_complex_t * buf, const unsigned int output_size,
+                                const unsigned int input_size,
+                                const rta_real_t scale)
+{
+  unsigned int i;
+  unsigned int used_input_size;
+  
+  if(input_size > output_size)
+  {
+    used_input_size = output_size;
+  }
+  else
+  {
+    used_input_size = input_size;
+  }
+  
+  if(scale != 1.)
+  {
+    for(i=0; i<used_input_size; i++)
+    {
+      buf[i] = rta_mul_complex_real(buf[i], scale);
+    }
+  }
+  else
+  {
+    i = used_input_size;
+  }
+  
+  /* zero padding */
+  for(; i<output_size; i++)
+  {
+    rta_set_complex_real(buf[i], 0.0);    
+  }
+  return;
+}
+
+static void
+scale_complex_zero_pad_in_place_stride(
+  rta_complex_t * buf, const int b_stride, const unsigned int output_size,
+  const unsigned int input_size,
+  const rta_real_t scale)
+{
+  unsigned int i;
+  unsigned int used_input_size;
+  
+  if(input_size > output_size)
+  {
+    used_input_size = output_size;
+  }
+  else
+  {
+    used_input_size = input_size;
+  }
+  
+  if(scale != 1.)
+  {
+    for(i=0; i<used_input_size*b_stride; i+=b_stride)
+    {
+      buf[i] = rta_mul_complex_real(buf[i], scale);
+    }
+  }
+  else
+  {
+    i = used_input_size*b_stride;
+  }
+  
+  /* zero padding */
+  for(; i<output_size*b_stride; i+=b_stride)
+  {
+    rta_set_complex_real(buf[i], 0.0);    
+  }
+  return;
+}
+
+
+
+/* size of the complex transform: real transforms use half of the size */
+static unsigned int
+transform_size(const rta_fft_setup_t * fft_setup)
+{
+  unsigned int size;
+
+  if(fft_setup->fft_type == rta_fft_real_to_complex_1d ||
+     fft_setup->fft_type == rta_fft_complex_to_real_1d)
+  {
+    size = fft_setup->fft_size >> 1;
+  }
+  else
+  {
+    size = fft_setup->fft_size;
+  }
+  
+  return size;
+}
+
+#if defined(RTA_FFT_SIMD)
+/* twiddle factors of the vector passes, see FFT_SIMD_RADIX4_PASSES */
+/* retrun 1 on success, 0 on fail */
+static int
+simd_twiddle_new(rta_fft_setup_t * fft_setup)
+{
+  const unsigned int size = transform_size(fft_setup);
+  const rta_real_t sign =
+    (fft_setup->fft_type == rta_fft_complex_to_real_1d ||
+     fft_setup->fft_type == rta_fft_complex_inverse_1d ? 1. : -1.);
+  unsigned int twiddle_size = 0;
+  unsigned int up;
+
+  for(up=fft_setup->simd_up; up<size; up<<=2)
+  {
+    twiddle_size += 12 * up;
+  }
+
+  fft_setup->twiddle = (rta_real_t *) rta_malloc(
+    sizeof(rta_real_t) * twiddle_size);
+  
+  if(fft_setup->twiddle != NULL)
+  {
+    /* exponents of B, C and D */
+    const unsigned int q[3] = {2, 1, 3};
+    rta_real_t * tw = fft_setup->twiddle;
+    unsigned int i, j;
+
+    for(up=fft_setup->simd_up; up<size; up<<=2)
+    {
+      const unsigned int k_step = fft_setup->fft_size / (4 * up);
+      for(i=0; i<3; i++)
+      {
+        for(j=0; j<up; j++)
+        {
+          const unsigned int k = q[i] * j * k_step;
+          tw[2*j] = fft_setup->cos[k];
+          tw[2*j+1] = fft_setup->cos[k];
+          tw[2*up + 2*j] = - sign * fft_setup->sin[k];
+          tw[2*up + 2*j+1] = sign * fft_setup->sin[k];
+        }
+        tw += 4 * up;
+      }
+    }
+  }
+
+  return (fft_setup->twiddle != NULL);
+}
+#endif /* RTA_FFT_SIMD */
+
+/* sine, cosine and bitreverse tables */
+/* retrun 1 on success, 0 on fail */
+/* index of the precomputed tables of 'fft_size', or -1 */
+static int
+static_tables_index(const unsigned int fft_size)
+{
+  int ret = -1;
+#if defined(FFT_STATIC_SIN)
+  if(fft_size >= FFT_STATIC_MIN_SIZE && fft_size <= FFT_STATIC_MAX_SIZE &&
+     fft_size == rta_inextpow2(fft_size))
+  {
+    ret = rta_ilog2(fft_size) - rta_ilog2(FFT_STATIC_MIN_SIZE);
+  }
+#endif
+  return ret;
+}
+
+static int
+tables_new(rta_fft_setup_t * fft_setup)
+{
+  int ret = 0;
+  const unsigned int size = transform_size(fft_setup);
+  unsigned int i;
+
+  fft_setup->sin = NULL;
+  fft_setup->bitrev = NULL;
+
+#if defined(FFT_STATIC_SIN)
+  /* read-only tables, shared by all the processes */
+  if(static_tables_index(fft_setup->fft_size) >= 0)
+  {
+    const int t = static_tables_index(fft_setup->fft_size);
+    fft_setup->sin = (rta_real_t *) fft_static_sin[t];
+    fft_setup->cos = fft_setup->sin + (fft_setup->fft_size / 4);
+    fft_setup->bitrev = (unsigned int *) fft_static_bitrev[t];
+    ret = 1;
+#if defined(RTA_FFT_SIMD)
+    if(fft_setup->simd_passes != NULL)
+    {
+      ret = simd_twiddle_new(fft_setup);
+    }
+#endif
+    return ret;
+  }
+#endif
+
+  /* sine (and cosine) table */
+  if((fft_setup->fft_size & 3) == 0)
+  {
+    /* 1/4 more for cosine as phase shift and one more point at the end */
+    /* => total size is 5/4*sine_size + 1 */
+    fft_setup->sin = (rta_real_t *) rta_malloc(
+      sizeof(rta_real_t) * (fft_setup->fft_size * 5/4 + 1));
+
+    if(fft_setup->sin != NULL)
+    {
+      /* sine function from 0 to 2pi, inclusive (plus 1/4 for cosine) */
+      /* step = 5/4 * 2 pi / (5/4 * size) = 2 * pi / size */
+      const rta_real_t step = 2. * M_PI / fft_setup->fft_size;
+      for(i=0; i<=fft_setup->fft_size * 5/4; i++)
+      {
+        fft_setup->sin[i] = rta_sin(i*step);
+      }
+
+      /* cosine function is just a phase-shifted sine */
+      /* Memory is shared */
+      fft_setup->cos = fft_setup->sin + (fft_setup->fft_size / 4);
+    }
+  }
+  else
+  {
+    /* no exact phase shift: separate cosine, in the same allocation */
+    fft_setup->sin = (rta_real_t *) rta_malloc(
+      sizeof(rta_real_t) * 2 * (fft_setup->fft_size + 1));
+
+    if(fft_setup->sin != NULL)
+    {
+      const rta_real_t step = 2. * M_PI / fft_setup->fft_size;
+      fft_setup->cos = fft_setup->sin + fft_setup->fft_size + 1;
+      for(i=0; i<=fft_setup->fft_size; i++)
+      {
+        fft_setup->sin[i] = rta_sin(i*step);
+        fft_setup->cos[i] = rta_cos(i*step);
+      }
+    }
+  }
+
+  if(fft_setup->sin != NULL)
+  {
+    if(fft_setup->factors_number == 0)
+    {
+      /* Bit reversal table */
+      fft_setup->bitrev = (unsigned int *) rta_malloc(
+        sizeof(unsigned int) * fft_setup->fft_size);
+
+      if(fft_setup->bitrev != NULL)
+      {
+        unsigned int idx, xdi;
+        unsigned int j;
+          
+        for(i=0; i<fft_setup->fft_size; i++)
+        {
+          idx = i;
+          xdi = 0;
+    
+          for(j=1; j<fft_setup->log2_size; j++)
+          {
+            xdi += (idx & 1);
+            xdi <<= 1;
+            idx >>= 1;
+          }
+    
+          fft_setup->bitrev[i] = xdi + (idx & 1);
+        }
+        
+        ret = 1; /* setup complete */
+#if defined(RTA_FFT_SIMD)
+        if(fft_setup->simd_passes != NULL)
+        {
+          ret = simd_twiddle_new(fft_setup);
+        }
+#endif
+      }
+    }
+    else
+    {
+      /* Digit reversal table, for the complex transform size */
+      fft_setup->bitrev = (unsigned int *) rta_malloc(
+        sizeof(unsigned int) * size);
+
+      if(fft_setup->bitrev != NULL)
+      {
+        unsigned int p, q, idx;
+        unsigned int span = 1;
+
+        /* each pass interleaves 'radix' copies of the previous table */
+        fft_setup->bitrev[0] = 0;
+        for(p=0; p<fft_setup->factors_number; p++)
+        {
+          const unsigned int radix = fft_setup->factors[p];
+          for(q=radix; q>0; q--)
+          {
+            for(idx=span; idx>0; idx--)
+            {
+              fft_setup->bitrev[(q-1) * span + idx-1] =
+                (q-1) + radix * fft_setup->bitrev[idx-1];
+            }
+          }
+          span *= radix;
+        }
+
+        ret = 1; /* setup complete */
+      }
+    }
+
+    if(ret == 0)
+    {
+      rta_free(fft_setup->sin);
+      fft_setup->sin = NULL;
+      if(fft_setup->bitrev != NULL)
+      {
+        rta_free(fft_setup->bitrev);
+        fft_setup->bitrev = NULL;
+      }
+    }
+  }
+  /* else: sin failed */
+  
+  return ret;
+}
+
+/* get the tables from the cache, or create them */
+/* retrun 1 on success, 0 on fail */
+static int
+tables_acquire(rta_fft_setup_t * fft_setup)
+{
+  int ret = 0;
+  fft_tables_t * tables;
+
+  rta_mutex_lock(&tables_cache_mutex);
+
+  for(tables = tables_cache; tables != NULL; tables = tables->next)
+  {
+    if(tables->fft_size == fft_setup->fft_size &&
+       tables->fft_type == fft_setup->fft_type)
+    {
+      break;
+    }
+  }
+
+  if(tables == NULL)
+  {
+    tables = (fft_tables_t *) rta_malloc(sizeof(fft_tables_t));
+    if(tables != NULL)
+    {
+      if(tables_new(fft_setup) != 0)
+      {
+        tables->fft_size = fft_setup->fft_size;
+        tables->fft_type = fft_setup->fft_type;
+        tables->references = 0;
+        tables->cos = fft_setup->cos;
+        tables->sin = fft_setup->sin;
+        tables->bitrev = fft_setup->bitrev;
+#if defined(RTA_FFT_SIMD)
+        tables->twiddle = fft_setup->twiddle;
+#endif
+        tables->next = tables_cache;
+        tables_cache = tables;
+      }
+      else
+      {
+        rta_free(tables);
+        tables = NULL;
+      }
+    }
+  }
+
+  if(tables != NULL)
+  {
+    tables->references++;
+    fft_setup->tables = tables;
+    fft_setup->cos = tables->cos;
+    fft_setup->sin = tables->sin;
+    fft_setup->bitrev = tables->bitrev;
+#if defined(RTA_FFT_SIMD)
+    fft_setup->twiddle = tables->twiddle;
+#endif
+    ret = 1;
+  }
+
+  rta_mutex_unlock(&tables_cache_mutex);
+  
+  return ret;
+}
+
+/* the tables are deleted when they are not used by any setup */
+static void
+tables_release(fft_tables_t * tables)
+{
+  fft_tables_t ** previous;
+
+  rta_mutex_lock(&tables_cache_mutex);
+
+  tables->references--;
+  if(tables->references == 0)
+  {
+    for(previous = &tables_cache; *previous != tables;
+        previous = &((*previous)->next))
+    {
+      ;
+    }
+    *previous = tables->next;
+
+    if(static_tables_index(tables->fft_size) < 0)
+    {
+      rta_free(tables->sin);
+      rta_free(tables->bitrev);
+    }
+#if defined(RTA_FFT_SIMD)
+    if(tables->twiddle != NULL)
+    {
+      rta_free(tables->twiddle);
+    }
+#endif
+    rta_free(tables);
+  }
+
+  rta_mutex_unlock(&tables_cache_mutex);
+  
+  return;
+}
+
+/* factorise the transform size, and select the transform kernel, */
+/* according to the type of the setup */
+static void
+kernel_select(rta_fft_setup_t * fft_setup)
+{
+  const unsigned int size = transform_size(fft_setup);
+  unsigned int stockham_min_size = RTA_FFT_STOCKHAM_MIN_SIZE;
+  unsigned int rest = size;
+  unsigned int fours = 0;
+  unsigned int twos = 0;
+  unsigned int threes = 0;
+  unsigned int fives = 0;
+  unsigned int f = 0;
+  unsigned int i;
+
+  fft_setup->factors_number = 0;
+
+  if(size != rta_inextpow2(size))
+  {
+    /* generic radices first, as their scratch is sized by factors[0] */
+    unsigned int prime = 7;
+    while(rest % 4 == 0) { rest /= 4; fours++; }
+    while(rest % 2 == 0) { rest /= 2; twos++; }
+    while(rest % 3 == 0) { rest /= 3; threes++; }
+    while(rest % 5 == 0) { rest /= 5; fives++; }
+
+    while(rest > 1)
+    {
+      /* largest prime factor is the last one */
+      if(prime > rest / prime)
+      {
+        prime = rest;
+      }
+
+      while(rest % prime == 0)
+      {
+        rest /= prime;
+        /* keep the largest first */
+        for(i=f; i>0; i--)
+        {
+          fft_setup->factors[i] = fft_setup->factors[i-1];
+        }
+        fft_setup->factors[0] = prime;
+        f++;
+      }
+      prime += 2;
+    }
+
+    for(i=0; i<fives; i++) { fft_setup->factors[f++] = 5; }
+    for(i=0; i<threes; i++) { fft_setup->factors[f++] = 3; }
+    for(i=0; i<twos; i++) { fft_setup->factors[f++] = 2; }
+    for(i=0; i<fours; i++) { fft_setup->factors[f++] = 4; }
+
+    fft_setup->factors_number = f;
+  }
+
+#if defined(RTA_FFT_SIMD)
+  fft_setup->simd_passes = NULL;
+  fft_setup->simd_up = size;
+  fft_setup->twiddle = NULL;
+  fft_setup->stockham_simd_pass = NULL;
+  fft_setup->split_simd_passes = NULL;
+  fft_setup->split_simd_width = 0;
+
+  if(fft_setup->factors_number == 0)
+  {
+    unsigned int width = 0; /* complex values per vector */
+    fft_simd_function passes = NULL;
+    fft_stockham_simd_function stockham_pass = NULL;
+    fft_split_simd_function split_passes = NULL;
+    unsigned int up;
+    
+    switch(rta_simd_level())
+    {
+      case rta_simd_avx512:
+        passes = fft_radix4_avx512;
+        stockham_pass = stockham_pass_4_avx512;
+        split_passes = split_passes_avx512;
+        width = 64 / sizeof(rta_complex_t);
+        break;
+      case rta_simd_avx2:
+        passes = fft_radix4_avx2;
+        stockham_pass = stockham_pass_4_avx2;
+        split_passes = split_passes_avx2;
+        width = 32 / sizeof(rta_complex_t);
+        break;
+      case rta_simd_sse2:
+        passes = fft_radix4_sse2;
+        stockham_pass = stockham_pass_4_sse2;
+        split_passes = split_passes_sse2;
+        width = 16 / sizeof(rta_complex_t);
+        break;
+      default:
+        break;
+    }
+
+    fft_setup->stockham_simd_pass = stockham_pass;
+    fft_setup->simd_width = width;
+    fft_setup->split_simd_passes = split_passes;
+    fft_setup->split_simd_width = 2 * width;
+
+    /* first radix-4 pass with enough butterflies for a vector */
+    up = ((rta_ilog2(size) & 1) ? 2 : 1);
+    while(up < width)
+    {
+      up <<= 2;
+    }
+
+    if(passes != NULL && up < size)
+    {
+      fft_setup->simd_passes = passes;
+      fft_setup->simd_up = up;
+    }
+  }
+#endif /* RTA_FFT_SIMD */
+  
+  if(fft_setup->fft_type == rta_fft_complex_to_real_1d ||
+     fft_setup->fft_type == rta_fft_complex_inverse_1d)
+  {
+    fft_setup->kernel = (fft_setup->factors_number == 0 ?
+                         ifft_power_of_2 : ifft_mixed_radix);
+  }
+  else
+  {
+    fft_setup->kernel = (fft_setup->factors_number == 0 ?
+                         fft_power_of_2 : fft_mixed_radix);
+  }
+
+#if defined(RTA_FFT_SIMD)
+  if(fft_setup->simd_passes != NULL)
+  {
+    if(fft_setup->fft_type == rta_fft_complex_to_real_1d ||
+       fft_setup->fft_type == rta_fft_complex_inverse_1d)
+    {
+      fft_setup->kernel = ifft_power_of_2_simd;
+    }
+    else
+    {
+      fft_setup->kernel = fft_power_of_2_simd;
+    }
+  }
+#endif
+
+  /* out of place plans of large sizes avoid the bit reversal */
+  fft_setup->stockham_radix2_passes = 0;
+#if defined(RTA_FFT_SIMD)
+  if(fft_setup->simd_passes != NULL)
+  {
+    stockham_min_size = RTA_FFT_STOCKHAM_SIMD_MIN_SIZE;
+  }
+#endif
+
+  if(fft_setup->factors_number == 0 && size >= stockham_min_size &&
+     size >= 8 && fft_setup->input != fft_setup->output)
+  {
+    fft_setup->stockham_radix2_passes = stockham_radix2_passes(size);
+    if(fft_setup->fft_type == rta_fft_complex_to_real_1d ||
+       fft_setup->fft_type == rta_fft_complex_inverse_1d)
+    {
+      fft_setup->kernel = ifft_stockham;
+    }
+    else
+    {
+      fft_setup->kernel = fft_stockham;
+    }
+  }
+  return;
+}
+
+/* size of the work buffer of a kernel, in complex values: transform */
+/* buffer and scratch for the generic radix, or second buffer of the */
+/* Stockham passes, 0 for none */
+static unsigned int
+work_size(const rta_fft_setup_t * fft_setup)
+{
+  unsigned int size = 0;
+
+  if(fft_setup->factors_number > 0)
+  {
+    size = transform_size(fft_setup) + fft_setup->factors[0];
+  }
+  else if(fft_setup->kernel == fft_stockham ||
+          fft_setup->kernel == ifft_stockham)
+  {
+    size = transform_size(fft_setup);
+  }
+
+  return size;
+}
+
+/* common to all setups */
+/* retrun 1 on success, 0 on fail */
+static int
+setup_new(rta_fft_setup_t ** fft_setup,
+          const rta_fft_t fft_type, rta_real_t * scale,
+          void * input, const int i_stride, const unsigned int input_size,
+          void * output, const int o_stride, const unsigned int fft_size,
+          rta_real_t * nyquist)
+{
+  int ret = 0;
+
+  *fft_setup = (rta_fft_setup_t *) rta_malloc(sizeof(rta_fft_setup_t));
+
+  if(*fft_setup != NULL)
+  {
+    /* actual FFT size is the given one, but at least 1, and even for */
+    /* real transforms */
+    (*fft_setup)->fft_type = fft_type;
+    (*fft_setup)->fft_size = (fft_size > 0 ? fft_size : 1);
+    if(fft_type == rta_fft_real_to_complex_1d ||
+       fft_type == rta_fft_complex_to_real_1d)
+    {
+      (*fft_setup)->fft_size += (*fft_setup)->fft_size & 1;
+    }
+    (*fft_setup)->log2_size = rta_ilog2((*fft_setup)->fft_size);
+    (*fft_setup)->input_size = input_size;
+
+    (*fft_setup)->output = output;
+    (*fft_setup)->o_stride = o_stride;
+
+    (*fft_setup)->input = input;
+    (*fft_setup)->i_stride = i_stride;
+
+    (*fft_setup)->nyquist = nyquist;
+
+    (*fft_setup)->scale = scale;
+    (*fft_setup)->work = NULL;
+    (*fft_setup)->four_step = NULL;
+    (*fft_setup)->pool = NULL;
+    (*fft_setup)->threads_work = NULL;
+    (*fft_setup)->threads_work_size = 0;
+    (*fft_setup)->input_pruning = 0;
+    (*fft_setup)->output_pruning = 0;
+    (*fft_setup)->split_twiddle = NULL;
+    (*fft_setup)->split_work = NULL;
+    (*fft_setup)->pair = NULL;
+    kernel_select(*fft_setup);
+    
+    ret = tables_acquire(*fft_setup);
+
+    if(ret != 0 && work_size(*fft_setup) > 0)
+    {
+      (*fft_setup)->work = (rta_complex_t *) rta_malloc(
+        sizeof(rta_complex_t) * work_size(*fft_setup));
+
+      if((*fft_setup)->work == NULL)
+      {
+        tables_release((*fft_setup)->tables);
+        ret = 0;
+      }
+    }
+    
+    if(ret == 0)
+    {
+      rta_free(*fft_setup);
+      *fft_setup = NULL;
+    }
+  }
+
+  return ret;
+}
+
+/********************************************************************
+ * four-step (Bailey) transform, for large powers of 2
+ *
+ *    'size' = 'size1' * 'size2', n = 'size2' * n1 + n2 and
+ *    k = k1 + 'size1' * k2:
+ *
+ *    X(k) = sum_n2 W_size2^(n2*k2) W_size^(n2*k1)
+ *             sum_n1 x(n) W_size1^(n1*k1)
+ *
+ *    The transforms of 'size1' and then 'size2' points are done on
+ *    contiguous rows, between transposes:
+ *    0. transpose buf ('size1' x 'size2') into work
+ *    1. rows n2 of work: transform of 'size1' points, times W^(n2*k1)
+ *    2. transpose work ('size2' x 'size1') into buf
+ *    3. rows k1 of buf: transform of 'size2' points
+ *    4. transpose buf ('size1' x 'size2') into work
+ *    5. copy work into buf
+ *
+ *    The rows of each phase are shared by the threads.
+ */
+
+/* square tiles of the transposes, of 16 complex values by row */
+#define FOUR_STEP_TILE 16
+
+/* rows ['begin', 'end') of 'source' ('rows' x 'columns') */
+static void
+four_step_transpose(rta_complex_t * destination,
+                    const rta_complex_t * source,
+                    const unsigned int rows, const unsigned int columns,
+                    const unsigned int begin, const unsigned int end)
+{
+  unsigned int r, c, rr, cc;
+
+  for(r=begin; r<end; r+=FOUR_STEP_TILE)
+  {
+    const unsigned int r_end = (r + FOUR_STEP_TILE < end ?
+                                r + FOUR_STEP_TILE : end);
+    for(c=0; c<columns; c+=FOUR_STEP_TILE)
+    {
+      const unsigned int c_end = (c + FOUR_STEP_TILE < columns ?
+                                  c + FOUR_STEP_TILE : columns);
+      for(cc=c; cc<c_end; cc++)
+      {
+        for(rr=r; rr<r_end; rr++)
+        {
+          destination[cc * rows + rr] = source[rr * columns + cc];
+        }
+      }
+    }
+  }
+  return;
+}
+
+static void
+four_step_phase(fft_four_step_t * four_step,
+                const unsigned int begin, const unsigned int end)
+{
+  const unsigned int size1 = four_step->size1;
+  const unsigned int size2 = four_step->size2;
+  rta_complex_t * buf = four_step->buf;
+  rta_complex_t * work = four_step->work;
+  unsigned int row, k;
+
+  switch(four_step->phase)
+  {
+    case 0:
+      four_step_transpose(work, buf, size1, size2, begin, end);
+      break;
+
+    case 1:
+      for(row=begin; row<end; row++)
+      {
+        rta_complex_t * z = work + row * size1;
+        four_step->fft1->kernel(four_step->fft1, z, 1, 1, size1);
+
+        /* W^(row * k), as W^low * W^(high * size1) */
+        for(k=1; k<size1; k++)
+        {
+          const unsigned int j = row * k;
+          const rta_complex_t low =
+            four_step->twiddle_low[j & (size1 - 1)];
+          const rta_complex_t high =
+            four_step->twiddle_high[j >> four_step->log2_size1];
+          const rta_real_t W_real = rta_creal(low) * rta_creal(high)
+            - rta_cimag(low) * rta_cimag(high);
+          const rta_real_t W_imag = rta_creal(low) * rta_cimag(high)
+            + rta_cimag(low) * rta_creal(high);
+
+          z[k] = rta_make_complex(
+            rta_creal(z[k]) * W_real - rta_cimag(z[k]) * W_imag,
+            rta_creal(z[k]) * W_imag + rta_cimag(z[k]) * W_real);
+        }
+      }
+      break;
+
+    case 2:
+      four_step_transpose(buf, work, size2, size1, begin, end);
+      break;
+
+    case 3:
+      for(row=begin; row<end; row++)
+      {
+        four_step->fft2->kernel(four_step->fft2, buf + row * size2, 1, 1,
+                                size2);
+      }
+      break;
+
+    case 4:
+      four_step_transpose(work, buf, size1, size2, begin, end);
+      break;
+
+    case 5:
+      for(k=begin * size1; k<end * size1; k++)
+      {
+        buf[k] = work[k];
+      }
+      break;
+
+    default:
+      break;
+  }
+  return;
+}
+
+/* the part 'index' of the rows of the current phase, run by each */
+/* thread of the pool */
+static void
+four_step_part(void * argument, const unsigned int index,
+               const unsigned int threads_number)
+{
+  fft_four_step_t * four_step = (fft_four_step_t *) argument;
+  const unsigned int count = four_step->count;
+
+  four_step_phase(four_step,
+                  rta_thread_part_begin(count, index, threads_number),
+                  rta_thread_part_begin(count, index + 1, threads_number));
+  return;
+}
+
+/* run a phase on all the threads, and wait for its end */
+static void
+four_step_run(fft_four_step_t * four_step, const unsigned int phase,
+              const unsigned int count)
+{
+  four_step->phase = phase;
+  four_step->count = count;
+  rta_thread_pool_run(four_step->pool, four_step_part, four_step);
+  return;
+}
+
+/* for a contiguous buffer */
+static void
+four_step_kernel(const rta_fft_setup_t * fft_setup,
+                 rta_complex_t * buf, const int b_stride,
+                 const unsigned int coef_step, const unsigned int size)
+{
+  fft_four_step_t * four_step = fft_setup->four_step;
+
+  if(b_stride == 1)
+  {
+    four_step->buf = buf;
+    four_step_run(four_step, 0, four_step->size1);
+    four_step_run(four_step, 1, four_step->size2);
+    four_step_run(four_step, 2, four_step->size2);
+    four_step_run(four_step, 3, four_step->size1);
+    four_step_run(four_step, 4, four_step->size1);
+    four_step_run(four_step, 5, four_step->size2);
+  }
+  else
+  {
+    four_step->kernel(fft_setup, buf, b_stride, coef_step, size);
+  }
+  return;
+}
+
+static void
+four_step_delete(fft_four_step_t * four_step)
+{
+  if(four_step->fft1 != NULL)
+  {
+    rta_fft_setup_delete(four_step->fft1);
+  }
+
+  if(four_step->fft2 != NULL)
+  {
+    rta_fft_setup_delete(four_step->fft2);
+  }
+
+  if(four_step->work != NULL)
+  {
+    rta_free(four_step->work);
+  }
+
+  if(four_step->twiddle_low != NULL)
+  {
+    rta_free(four_step->twiddle_low);
+  }
+
+  if(four_step->twiddle_high != NULL)
+  {
+    rta_free(four_step->twiddle_high);
+  }
+
+  rta_free(four_step);
+  return;
+}
+
+/* retrun 1 on success, 0 on fail */
+static int
+four_step_new(fft_four_step_t ** four_step, const rta_fft_setup_t * fft_setup,
+              rta_thread_pool_t * pool)
+{
+  const unsigned int size = transform_size(fft_setup);
+  const int inverse = (fft_setup->fft_type == rta_fft_complex_to_real_1d ||
+                       fft_setup->fft_type == rta_fft_complex_inverse_1d);
+  int ret = 1;
+  unsigned int i;
+
+  *four_step = (fft_four_step_t *) rta_malloc(sizeof(fft_four_step_t));
+  if(*four_step == NULL)
+  {
+    return 0;
+  }
+
+  (*four_step)->log2_size1 = (rta_ilog2(size) + 1) / 2;
+  (*four_step)->size1 = 1 << (*four_step)->log2_size1;
+  (*four_step)->size2 = size / (*four_step)->size1;
+  (*four_step)->scale = 1.;
+  (*four_step)->kernel = fft_setup->kernel;
+  (*four_step)->inverse = inverse;
+  (*four_step)->pool = pool;
+  (*four_step)->fft1 = NULL;
+  (*four_step)->fft2 = NULL;
+
+  (*four_step)->work = (rta_complex_t *) rta_malloc(
+    sizeof(rta_complex_t) * size);
+  (*four_step)->twiddle_low = (rta_complex_t *) rta_malloc(
+    sizeof(rta_complex_t) * (*four_step)->size1);
+  (*four_step)->twiddle_high = (rta_complex_t *) rta_malloc(
+    sizeof(rta_complex_t) * (*four_step)->size2);
+
+  if((*four_step)->work == NULL || (*four_step)->twiddle_low == NULL ||
+     (*four_step)->twiddle_high == NULL)
+  {
+    ret = 0;
+  }
+  else
+  {
+    /* exp(-j*2*PI*i/size), or its conjugate */
+    const rta_real_t step = (inverse ? 2. : -2.) * M_PI / size;
+
+    for(i=0; i<(*four_step)->size1; i++)
+    {
+      (*four_step)->twiddle_low[i] = rta_make_complex(rta_cos(i * step),
+                                                      rta_sin(i * step));
+    }
+
+    for(i=0; i<(*four_step)->size2; i++)
+    {
+      const rta_real_t phase = (rta_real_t) i * (*four_step)->size1 * step;
+      (*four_step)->twiddle_high[i] = rta_make_complex(rta_cos(phase),
+                                                       rta_sin(phase));
+    }
+  }
+
+  /* in place sub-transforms (no Stockham passes) */
+  if(ret != 0)
+  {
+    const rta_fft_t type = (inverse ?
+                            rta_fft_complex_inverse_1d : rta_fft_complex_1d);
+
+    ret = setup_new(&((*four_step)->fft1), type, &((*four_step)->scale),
+                    NULL, 1, (*four_step)->size1,
+                    NULL, 1, (*four_step)->size1, NULL);
+    if(ret != 0)
+    {
+      ret = setup_new(&((*four_step)->fft2), type, &((*four_step)->scale),
+                      NULL, 1, (*four_step)->size2,
+                      NULL, 1, (*four_step)->size2, NULL);
+    }
+  }
+
+  if(ret == 0)
+  {
+    four_step_delete(*four_step);
+    *four_step = NULL;
+  }
+
+  return ret;
+}
+
+/********************************************************************
+ * split complex format
+ *
+ *    Real and imaginary parts in separate arrays: the radix-4
+ *    butterflies and the twiddle multiplications operate on
+ *    contiguous real values, without any shuffle, so that the
+ *    compiler can vectorise the inner loops. The twiddle factors of
+ *    each pass are contiguous, as cos and sin of W1, W2 and W3 for the
+ *    'up' butterflies of a group, from the first pass with 'up' >= 2.
+ *
+ *    'sign' is 1 for the direct transform and -1 for the inverse one.
+ */
+
+/* retrun 1 on success, 0 on fail */
+static int
+split_new(rta_fft_setup_t * fft_setup)
+{
+  const unsigned int size = transform_size(fft_setup);
+  unsigned int twiddle_size = 1;
+  unsigned int up;
+
+  fft_setup->split_twiddle = NULL;
+  fft_setup->split_work = NULL;
+
+  /* split arrays of the inverse real transform, then an interleaved */
+  /* buffer for the generic radices */
+  fft_setup->split_work = (rta_real_t *) rta_malloc(
+    sizeof(rta_real_t) * 4 * size);
+
+  if(fft_setup->split_work != NULL && fft_setup->factors_number == 0)
+  {
+    for(up=((rta_ilog2(size) & 1) ? 2 : 4); up<size; up<<=2)
+    {
+      twiddle_size += 6 * up;
+    }
+
+    fft_setup->split_twiddle = (rta_real_t *) rta_malloc(
+      sizeof(rta_real_t) * twiddle_size);
+
+    if(fft_setup->split_twiddle != NULL)
+    {
+      rta_real_t * tw = fft_setup->split_twiddle;
+      unsigned int j;
+
+      for(up=((rta_ilog2(size) & 1) ? 2 : 4); up<size; up<<=2)
+      {
+        const unsigned int k_step = fft_setup->fft_size / (4 * up);
+        for(j=0; j<up; j++)
+        {
+          const unsigned int k = j * k_step;
+          tw[j] = fft_setup->cos[k];
+          tw[up + j] = fft_setup->sin[k];
+          tw[2*up + j] = fft_setup->cos[2*k];
+          tw[3*up + j] = fft_setup->sin[2*k];
+          tw[4*up + j] = fft_setup->cos[3*k];
+          tw[5*up + j] = fft_setup->sin[3*k];
+        }
+        tw += 6 * up;
+      }
+    }
+  }
+
+  return (fft_setup->split_work != NULL &&
+          (fft_setup->factors_number > 0 ||
+           fft_setup->split_twiddle != NULL));
+}
+
+static void
+split_bitreversal(rta_real_t * re, rta_real_t * im,
+                  const unsigned int * bitrev,
+                  const unsigned int coef_step, const unsigned int size)
+{
+  unsigned int idx;
+
+  for(idx=0; idx<size; idx++)
+  {
+    const unsigned int xdi = bitrev[coef_step * idx];
+
+    if(xdi > idx)
+    {
+      rta_real_t z = re[idx];
+      re[idx] = re[xdi];
+      re[xdi] = z;
+
+      z = im[idx];
+      im[idx] = im[xdi];
+      im[xdi] = z;
+    }
+  }
+  return;
+}
+
+/* same butterflies as fft_radix4_inplace and ifft_radix4_inplace */
+static void
+split_radix4_passes(const rta_fft_setup_t * fft_setup,
+                    rta_real_t * re, rta_real_t * im,
+                    const unsigned int size, const rta_real_t sign)
+{
+  const rta_real_t * tw = fft_setup->split_twiddle;
+  unsigned int up;
+  unsigned int g, j;
+
+  if(rta_ilog2(size) & 1)
+  {
+    /* first radix-2 pass, without multiplication */
+    for(g=0; g<size; g+=2)
+    {
+      const rta_real_t a_re = re[g];
+      const rta_real_t a_im = im[g];
+
+      re[g] = a_re + re[g+1];
+      im[g] = a_im + im[g+1];
+      re[g+1] = a_re - re[g+1];
+      im[g+1] = a_im - im[g+1];
+    }
+    up = 2;
+  }
+  else
+  {
+    /* first radix-4 pass: twiddle factors are all 1 */
+    for(g=0; g+3<size; g+=4)
+    {
+      const rta_real_t t0_re = re[g] + re[g+1];
+      const rta_real_t t0_im = im[g] + im[g+1];
+      const rta_real_t t1_re = re[g] - re[g+1];
+      const rta_real_t t1_im = im[g] - im[g+1];
+      const rta_real_t t2_re = re[g+2] + re[g+3];
+      const rta_real_t t2_im = im[g+2] + im[g+3];
+      const rta_real_t t3_re = re[g+2] - re[g+3];
+      const rta_real_t t3_im = im[g+2] - im[g+3];
+
+      re[g] = t0_re + t2_re;
+      im[g] = t0_im + t2_im;
+      re[g+1] = t1_re + sign * t3_im;
+      im[g+1] = t1_im - sign * t3_re;
+      re[g+2] = t0_re - t2_re;
+      im[g+2] = t0_im - t2_im;
+      re[g+3] = t1_re - sign * t3_im;
+      im[g+3] = t1_im + sign * t3_re;
+    }
+    up = 4;
+  }
+
+  for(; up<size; up<<=2)
+  {
+    const rta_real_t * W1_re = tw;
+    const rta_real_t * W1_im = tw + up;
+    const rta_real_t * W2_re = tw + 2 * up;
+    const rta_real_t * W2_im = tw + 3 * up;
+    const rta_real_t * W3_re = tw + 4 * up;
+    const rta_real_t * W3_im = tw + 5 * up;
+
+#if defined(RTA_FFT_SIMD)
+    if(fft_setup->split_simd_passes != NULL &&
+       up >= fft_setup->split_simd_width)
+    {
+      /* all the remaining passes */
+      fft_setup->split_simd_passes(re, im, tw, sign, up, size);
+      break;
+    }
+#endif
+
+    for(g=0; g<size; g+=4*up)
+    {
+      rta_real_t * a_re = re + g;
+      rta_real_t * a_im = im + g;
+      rta_real_t * b_re = a_re + up;
+      rta_real_t * b_im = a_im + up;
+      rta_real_t * c_re = b_re + up;
+      rta_real_t * c_im = b_im + up;
+      rta_real_t * d_re = c_re + up;
+      rta_real_t * d_im = c_im + up;
+
+      for(j=0; j<up; j++)
+      {
+        /* B * conj(W2), C * conj(W1), D * conj(W3) for the direct */
+        /* transform, B * W2, C * W1, D * W3 for the inverse one */
+        const rta_real_t B_re = b_re[j] * W2_re[j] + sign * b_im[j] * W2_im[j];
+        const rta_real_t B_im = b_im[j] * W2_re[j] - sign * b_re[j] * W2_im[j];
+        const rta_real_t C_re = c_re[j] * W1_re[j] + sign * c_im[j] * W1_im[j];
+        const rta_real_t C_im = c_im[j] * W1_re[j] - sign * c_re[j] * W1_im[j];
+        const rta_real_t D_re = d_re[j] * W3_re[j] + sign * d_im[j] * W3_im[j];
+        const rta_real_t D_im = d_im[j] * W3_re[j] - sign * d_re[j] * W3_im[j];
+
+        const rta_real_t t0_re = a_re[j] + B_re;
+        const rta_real_t t0_im = a_im[j] + B_im;
+        const rta_real_t t1_re = a_re[j] - B_re;
+        const rta_real_t t1_im = a_im[j] - B_im;
+        const rta_real_t t2_re = C_re + D_re;
+        const rta_real_t t2_im = C_im + D_im;
+        const rta_real_t t3_re = C_re - D_re;
+        const rta_real_t t3_im = C_im - D_im;
+
+        a_re[j] = t0_re + t2_re;
+        a_im[j] = t0_im + t2_im;
+        b_re[j] = t1_re + sign * t3_im;
+        b_im[j] = t1_im - sign * t3_re;
+        c_re[j] = t0_re - t2_re;
+        c_im[j] = t0_im - t2_im;
+        d_re[j] = t1_re - sign * t3_im;
+        d_im[j] = t1_im + sign * t3_re;
+      }
+    }
+    tw += 6 * up;
+  }
+  return;
+}
+
+/* in place transform of 'size' points, through an interleaved */
+/* buffer for the generic radices */
+static void
+split_kernel_execute(const rta_fft_setup_t * fft_setup,
+                     rta_real_t * re, rta_real_t * im,
+                     const unsigned int coef_step, const unsigned int size,
+                     const rta_real_t sign)
+{
+  if(fft_setup->split_twiddle != NULL)
+  {
+    split_bitreversal(re, im, fft_setup->bitrev, coef_step, size);
+    split_radix4_passes(fft_setup, re, im, size, sign);
+  }
+  else
+  {
+    rta_complex_t * buf =
+      (rta_complex_t *) (fft_setup->split_work + 2 * size);
+    unsigned int i;
+
+    for(i=0; i<size; i++)
+    {
+      buf[i] = rta_make_complex(re[i], im[i]);
+    }
+
+    fft_setup->kernel(fft_setup, buf, 1, coef_step, size);
+
+    for(i=0; i<size; i++)
+    {
+      re[i] = rta_creal(buf[i]);
+      im[i] = rta_cimag(buf[i]);
+    }
+  }
+  return;
+}
+
+/* see shuffle_after_real_fft_inplace */
+static void
+split_shuffle_after_real_fft(rta_real_t * re, rta_real_t * im,
+                             const rta_real_t * coef_real,
+                             const rta_real_t * coef_imag,
+                             const unsigned int size)
+{
+  const rta_real_t re_0 = re[0];
+  unsigned int idx, xdi;
+
+  /* nyquist point coded in imaginary part first point */
+  re[0] = re_0 + im[0];
+  im[0] = re_0 - im[0];
+
+  for(idx=1, xdi=size-1; idx<xdi; idx++, xdi--)
+  {
+    const rta_real_t x1_real = 0.5 * (re[idx] + re[xdi]);
+    const rta_real_t x1_imag = 0.5 * (im[idx] - im[xdi]);
+    const rta_real_t x2_real = 0.5 * (im[xdi] + im[idx]);
+    const rta_real_t x2_imag = 0.5 * (re[xdi] - re[idx]);
+
+    /* x2[idx] * exp(-j*PI*i/size) */
+    const rta_real_t x2Ej_real =
+      x2_imag * coef_imag[idx] + x2_real * coef_real[idx];
+    const rta_real_t x2Ej_imag =
+      x2_imag * coef_real[idx] - x2_real * coef_imag[idx];
+
+    re[idx] = x1_real + x2Ej_real;
+    im[idx] = x1_imag + x2Ej_imag;
+    re[xdi] = x1_real - x2Ej_real;
+    im[xdi] = x2Ej_imag - x1_imag;
+  }
+
+  /* middle point, for an even size */
+  if(idx == xdi)
+  {
+    im[idx] = - im[idx];
+  }
+  return;
+}
+
+/* see shuffle_before_real_inverse_fft_inplace */
+static void
+split_shuffle_before_real_inverse_fft(rta_real_t * re, rta_real_t * im,
+                                      const rta_real_t * coef_real,
+                                      const rta_real_t * coef_imag,
+                                      const unsigned int size)
+{
+  const rta_real_t re_0 = re[0];
+  unsigned int idx, xdi;
+
+  /* nyquist point coded in imaginary part of the first point */
+  re[0] = re_0 + im[0];
+  im[0] = re_0 - im[0];
+
+  for(idx=1, xdi=size-1; idx<xdi; idx++, xdi--)
+  {
+    const rta_real_t x1_real = re[idx] + re[xdi];
+    const rta_real_t x1_imag = im[idx] - im[xdi];
+
+    /* x2[idx] * exp(-j*PI*i/size) */
+    const rta_real_t x2Ej_real = re[idx] - re[xdi];
+    const rta_real_t x2Ej_imag = im[idx] + im[xdi];
+
+    const rta_real_t x2_real =
+      x2Ej_real * coef_real[idx] - x2Ej_imag * coef_imag[idx];
+    const rta_real_t x2_imag =
+      x2Ej_real * coef_imag[idx] + x2Ej_imag * coef_real[idx];
+
+    re[idx] = x1_real - x2_imag;
+    im[idx] = x1_imag + x2_real;
+    re[xdi] = x1_real + x2_imag;
+    im[xdi] = x2_real - x1_imag;
+  }
+
+  /* middle point, for an even size */
+  if(idx == xdi)
+  {
+    re[idx] = 2. * re[idx];
+    im[idx] = -2. * im[idx];
+  }
+  return;
+}
+
+/* 'output' = 'scale' * 'input', zero-padded from 'input_size' to */
+/* 'output_size', possibly in place */
+static void
+split_fill_scale_zero_pad(rta_real_t * output, const unsigned int output_size,
+                          const rta_real_t * input,
+                          const unsigned int input_size,
+                          const rta_real_t scale)
+{
+  const unsigned int size =
+    (input_size < output_size ? input_size : output_size);
+  unsigned int i;
+
+  if(scale != 1.)
+  {
+    for(i=0; i<size; i++)
+    {
+      output[i] = scale * input[i];
+    }
+  }
+  else if(output != input)
+  {
+    for(i=0; i<size; i++)
+    {
+      output[i] = input[i];
+    }
+  }
+
+  for(i=size; i<output_size; i++)
+  {
+    output[i] = 0.;
+  }
+  return;
+}
+
+/********************************************************************
+ * frames
+ */
+
+/* scale and zero pad 'input' into 'output' (or in place), as */
+/* planned by rta_fft_execute, before the kernel, and shuffle the */
+/* spectrum of an inverse real transform */
+static void
+execute_prepare(const rta_fft_setup_t * fft_setup)
+{
+  const unsigned int no_stride = 
+    fft_setup->i_stride == 1 && fft_setup->o_stride == 1;
+  const unsigned int spectrum_size = fft_setup->fft_size >> 1;
+
+  switch(fft_setup->fft_type)
+  {
+    case rta_fft_real_to_complex_1d:
+    {
+      rta_real_t * real_input = (rta_real_t *) fft_setup->input;
+
+      /* out of place transform */
+      if(fft_setup->input != fft_setup->output)
+      {
+        /* at this moment, the output buffer is real, as the input one */
+        if(no_stride)
+        {
+          fill_real_scale_zero_pad(
+            (rta_real_t *) fft_setup->output, fft_setup->fft_size, 
+            real_input, fft_setup->input_size, *(fft_setup->scale));
+        }
+        else
+        {
+          fill_real_scale_zero_pad_stride(
+            (rta_real_t *) fft_setup->output, fft_setup->o_stride,
+            fft_setup->fft_size, 
+            real_input, fft_setup->i_stride, fft_setup->input_size,
+            *(fft_setup->scale));          
+        }
+      }
+      else
+      {
+       if(no_stride)
+       {
+         scale_real_zero_pad_in_place(
+           real_input, fft_setup->fft_size,
+           fft_setup->input_size, *(fft_setup->scale));
+       }
+       else
+       {
+         /* for in place transforms, fft_setup->o_stride and */
+         /* fft_setup->i_stride must be the equal */
+         scale_real_zero_pad_in_place_stride(
+           real_input, fft_setup->i_stride, fft_setup->fft_size,
+           fft_setup->input_size, *(fft_setup->scale));        
+       }
+      }
+
+      break;
+    }
+
+    case rta_fft_complex_to_real_1d:
+    {
+      rta_complex_t * complex_input = (rta_complex_t *) fft_setup->input;
+      rta_real_t * real_output = (rta_real_t *) fft_setup->output;
+      rta_complex_t * complex_output = (rta_complex_t *) fft_setup->output;
 
-/* ------- Public functions -------------------------- */
+      /* out of place transform */
+      if(fft_setup->input != fft_setup->output)
+      {
+        if(no_stride)
+        {
+          fill_complex_scale_zero_pad(
+            complex_output, spectrum_size,
+            complex_input, fft_setup->input_size, *(fft_setup->scale));
+        }
+        else
+        {
+          fill_complex_scale_zero_pad_stride(
+            complex_output, fft_setup->o_stride, spectrum_size,
+            complex_input, fft_setup->i_stride, fft_setup->input_size,
+            *(fft_setup->scale));          
+        }
+      }
+      else
+      {
+        if(no_stride)
+        {
+          scale_complex_zero_pad_in_place(
+            complex_input, spectrum_size,
+            fft_setup->input_size,*(fft_setup->scale));
+        }
+        else
+        {
+          /* for in place transforms, fft_setup->o_stride and */
+          /* fft_setup->i_stride must be the equal */
+          scale_complex_zero_pad_in_place_stride(
+            complex_input, fft_setup->i_stride, spectrum_size,
+            fft_setup->input_size,*(fft_setup->scale));          
+        }
+      }
+      
+      /* nyquist value is coded on the first imaginary value */
+      /* there is no stride here: real and imaginary values of the */
+      /* complex type must be contiguous */
+      if(*(fft_setup->scale) != 1.)
+      {
+        real_output[1] = *(fft_setup->nyquist) * *(fft_setup->scale);
+      }
+      else
+      {
+        real_output[1] = *(fft_setup->nyquist);
+      }
+      
+      if(fft_setup->o_stride == 1)
+      {
+        shuffle_before_real_inverse_fft_inplace(
+          complex_output, fft_setup->cos, fft_setup->sin, spectrum_size);
+      }
+      else
+      {
+        shuffle_before_real_inverse_fft_inplace_stride(
+          complex_output, fft_setup->o_stride,
+          fft_setup->cos, fft_setup->sin, spectrum_size);
+      }
+
+      break;
+    }
+
+    case rta_fft_complex_1d:
+    {
+      rta_complex_t * complex_input = (rta_complex_t *) fft_setup->input;
+      rta_complex_t * complex_output = (rta_complex_t *) fft_setup->output;
+
+      /* out of place transform */
+      if(fft_setup->input != fft_setup->output)
+      {
+        if(no_stride)
+        {
+          fill_complex_scale_zero_pad(
+            complex_output, fft_setup->fft_size,
+            complex_input, fft_setup->input_size, *(fft_setup->scale));
+        }
+        else
+        {
+          fill_complex_scale_zero_pad_stride(
+            complex_output, fft_setup->o_stride, fft_setup->fft_size,
+            complex_input, fft_setup->i_stride, fft_setup->input_size,
+            *(fft_setup->scale));
+        }
+      }
+      else
+      {
+        if(no_stride)
+        {
+          scale_complex_zero_pad_in_place(
+            complex_input, fft_setup->fft_size,
+            fft_setup->input_size,*(fft_setup->scale));
+        }
+        else
+        {
+         /* for in place transforms, fft_setup->o_stride and */
+         /* fft_setup->i_stride must be the equal */
+          scale_complex_zero_pad_in_place_stride(
+            complex_input, fft_setup->i_stride, fft_setup->fft_size,
+            fft_setup->input_size,*(fft_setup->scale));
+       }
+      }
+      
+      break;
+    }
+
+    case rta_fft_complex_inverse_1d:
+    {
+      rta_complex_t * complex_input = (rta_complex_t *) fft_setup->input;
+      rta_complex_t * complex_output = (rta_complex_t *) fft_setup->output;
+
+      /* out of place transform */
+      if(fft_setup->input != fft_setup->output)
+      {
+        if(no_stride)
+        {
+          fill_complex_scale_zero_pad(
+            complex_output, fft_setup->fft_size,
+            complex_input, fft_setup->input_size, *(fft_setup->scale));
+        }
+        else
+        {
+          fill_complex_scale_zero_pad_stride(
+            complex_output, fft_setup->o_stride, fft_setup->fft_size,
+            complex_input, fft_setup->i_stride, fft_setup->input_size,
+            *(fft_setup->scale));
+        }
+      }
+      else
+      {
+        if(no_stride)
+        {
+          scale_complex_zero_pad_in_place(
+            complex_input, fft_setup->fft_size,
+            fft_setup->input_size,*(fft_setup->scale));
+        }
+        else
+        {
+          /* for in place transforms, fft_setup->o_stride and */
+          /* fft_setup->i_stride must be the equal */
+          scale_complex_zero_pad_in_place_stride(
+            complex_input, fft_setup->i_stride, fft_setup->fft_size,
+            fft_setup->input_size,*(fft_setup->scale));
+        }
+      }
+
+      break;
+    }
+      
+    default:
+      break;
+  }
+  return;
+}
+
+/* spectrum of a direct real transform, after the kernel */
+static void
+execute_finish(const rta_fft_setup_t * fft_setup)
+{
+  if(fft_setup->fft_type == rta_fft_real_to_complex_1d)
+  {
+    const unsigned int spectrum_size = fft_setup->fft_size >> 1;
+    rta_complex_t * complex_output = (rta_complex_t *) fft_setup->output;
+
+    if(fft_setup->o_stride == 1)
+    {
+      shuffle_after_real_fft_inplace(
+        complex_output, fft_setup->cos, fft_setup->sin, spectrum_size);
+    }
+    else
+    {
+      shuffle_after_real_fft_inplace_stride(
+        complex_output, fft_setup->o_stride,
+        fft_setup->cos, fft_setup->sin, spectrum_size);
+    }
+
+    *(fft_setup->nyquist) = rta_cimag(complex_output[0]);
+    rta_set_complex_real(complex_output[0], rta_creal(complex_output[0]));
+  }
+  return;
+}
+
+/* multiples of the step of the tables for the kernel */
+static unsigned int
+kernel_coef_step(const rta_fft_setup_t * fft_setup)
+{
+  return (fft_setup->fft_type == rta_fft_real_to_complex_1d ||
+          fft_setup->fft_type == rta_fft_complex_to_real_1d ? 2 : 1);
+}
+
+/* scale and zero pad two real frames a and b, as z = a + j*b, for the */
+/* complex transform of their pair */
+static void
+pair_prepare(const rta_fft_setup_t * fft_setup, rta_complex_t * buf,
+             const rta_real_t * input_a, const rta_real_t * input_b,
+             const unsigned int input_size)
+{
+  const unsigned int size = fft_setup->fft_size;
+  const unsigned int filled = (input_size < size ? input_size : size);
+  const rta_real_t scale = *(fft_setup->scale);
+  unsigned int i;
+
+  if(scale != 1.)
+  {
+    for(i=0; i<filled; i++)
+    {
+      buf[i] = rta_make_complex(input_a[i] * scale, input_b[i] * scale);
+    }
+  }
+  else
+  {
+    for(i=0; i<filled; i++)
+    {
+      buf[i] = rta_make_complex(input_a[i], input_b[i]);
+    }
+  }
+
+  for(; i<size; i++)
+  {
+    buf[i] = rta_make_complex(0., 0.);
+  }
+  return;
+}
+
+/* separate the spectra of a pair, in the layout of */
+/* rta_fft_real_execute */
+static void
+pair_finish(const rta_fft_setup_t * fft_setup, rta_complex_t * buf,
+            rta_real_t * nyquist_a, rta_real_t * nyquist_b)
+{
+  const unsigned int size = fft_setup->fft_size;
+
+  separate_real_pair_inplace(buf, size >> 1);
+
+  *nyquist_a = rta_cimag(buf[0]);
+  rta_set_complex_real(buf[0], rta_creal(buf[0]));
+  *nyquist_b = rta_cimag(buf[size >> 1]);
+  rta_set_complex_real(buf[size >> 1], rta_creal(buf[size >> 1]));
+  return;
+}
+
+/********************************************************************
+ * batches of channels
+ *
+ *    The channels are transformed by tiles of FFT_BATCH_TILE frames:
+ *    for the in place powers of 2, each pass of the butterflies is
+ *    done on all the frames of a tile before the next one, so that
+ *    its twiddle factors are loaded once per tile. The other kernels
+ *    (mixed radix, Stockham, pruned, four-step) transform the frames
+ *    of a tile one after the other.
+ *
+ *    With the pool of rta_fft_setup_threads_set, the tiles are shared
+ *    by the threads. Each thread runs on a copy of the setup, with its
+ *    own work buffer, as rta_fft_execute changes the frame of the
+ *    setup. The four-step transforms use the threads for each frame,
+ *    and their channels stay in the calling thread.
+ */
+
+/* frames of a tile */
+#define FFT_BATCH_TILE 4
+
+/* work of each thread but the first one, for the kernels of the */
+/* setup and of its pair setup */
+/* retrun 1 on success, 0 on fail */
+static int
+threads_work_new(rta_fft_setup_t * fft_setup)
+{
+  const unsigned int threads_number =
+    rta_thread_pool_threads_number(fft_setup->pool);
+  unsigned int size = work_size(fft_setup);
+
+  if(fft_setup->threads_work != NULL)
+  {
+    rta_free(fft_setup->threads_work);
+    fft_setup->threads_work = NULL;
+  }
+
+  if(fft_setup->pair != NULL && work_size(fft_setup->pair) > size)
+  {
+    size = work_size(fft_setup->pair);
+  }
+
+  fft_setup->threads_work_size = size;
+
+  if(size > 0 && threads_number > 1)
+  {
+    fft_setup->threads_work = (rta_complex_t *) rta_malloc(
+      sizeof(rta_complex_t) * size * (threads_number - 1));
+  }
+
+  return (size == 0 || threads_number < 2 ||
+          fft_setup->threads_work != NULL);
+}
+
+static void
+threads_delete(rta_fft_setup_t * fft_setup)
+{
+  if(fft_setup->threads_work != NULL)
+  {
+    rta_free(fft_setup->threads_work);
+    fft_setup->threads_work = NULL;
+  }
+  fft_setup->threads_work_size = 0;
+
+  if(fft_setup->pool != NULL)
+  {
+    rta_thread_pool_delete(fft_setup->pool);
+    fft_setup->pool = NULL;
+  }
+  return;
+}
+
+/* kernels of the 'count' frames of a tile, see kernel_execute */
+static void
+kernel_execute_tile(const rta_fft_setup_t * fft_setup,
+                    rta_complex_t * const * bufs, const unsigned int count,
+                    const int b_stride,
+                    const unsigned int coef_step, const unsigned int size)
+{
+  const int inverse =
+    (fft_setup->fft_type == rta_fft_complex_to_real_1d ||
+     fft_setup->fft_type == rta_fft_complex_inverse_1d);
+  int passes = (fft_setup->kernel == fft_power_of_2 ||
+                fft_setup->kernel == ifft_power_of_2);
+  unsigned int up, up_end, c;
+
+#if defined(RTA_FFT_SIMD)
+  passes |= (fft_setup->kernel == fft_power_of_2_simd ||
+             fft_setup->kernel == ifft_power_of_2_simd);
+#endif
+
+  /* no pruning */
+  if(b_stride != 1 || passes == 0 || pruned_input_up(fft_setup, size) > 1 ||
+     pruned_output_block_size(
+       fft_setup, size, pruned_output_low_size(fft_setup, size)) < size)
+  {
+    for(c=0; c<count; c++)
+    {
+      kernel_execute(fft_setup, bufs[c], b_stride, coef_step, size);
+    }
+    return;
+  }
+
+  for(c=0; c<count; c++)
+  {
+    bitreversal(fft_setup, bufs[c], 1, coef_step, size);
+  }
+
+  /* one pass at a time, as in fft_radix4_inplace */
+  for(up=1; up<size; up=up_end)
+  {
+    up_end = ((up == 1 && (rta_ilog2(size) & 1)) ? 2 : 4 * up);
+
+#if defined(RTA_FFT_SIMD)
+    if(fft_setup->simd_passes != NULL && up >= fft_setup->simd_up)
+    {
+      const rta_real_t * twiddle =
+        fft_setup->twiddle + 4 * (up - fft_setup->simd_up);
+
+      for(c=0; c<count; c++)
+      {
+        fft_setup->simd_passes(bufs[c], twiddle,
+                               (inverse ?
+                                simd_sign_inverse : simd_sign_forward),
+                               up, up_end, size);
+      }
+      continue;
+    }
+#endif
+
+    for(c=0; c<count; c++)
+    {
+      if(inverse)
+      {
+        ifft_radix4_inplace(bufs[c], 1, fft_setup->cos, fft_setup->sin,
+                            coef_step, size, up, up_end);
+      }
+      else
+      {
+        fft_radix4_inplace(bufs[c], 1, fft_setup->cos, fft_setup->sin,
+                           coef_step, size, up, up_end);
+      }
+    }
+  }
+  return;
+}
 
-int
-rta_fft_real_setup_new(rta_fft_setup_t ** fft_setup,
-                       const rta_fft_t fft_type, rta_real_t * scale,
-                       void * input, const unsigned int input_size,
-                       void * output, const unsigned int fft_size,
-                       rta_real_t * nyquist)
-/* FFTW uses input and output to plan executions */
+/* arguments of a batch, for the threads of the pool */
+typedef struct fft_batch_arguments
 {
-  int ret = 0;
+  const rta_fft_setup_t * fft_setup;
+  char * outputs;
+  char * inputs;
+  size_t stride; /**< between two channels, in bytes */
+  unsigned int input_size;
+  unsigned int units_number; /**< channels, or pairs of channels */
+  rta_real_t * nyquists; /**< or NULL for the one of the setup */
+  int pairs; /**< units are pairs of real channels */
+} fft_batch_arguments_t;
 
-  *fft_setup = (rta_fft_setup_t *) rta_malloc(sizeof(rta_fft_setup_t));
+/* units from 'begin' to 'end', with 'fft_setup' a copy of the setup */
+static void
+batch_units(const fft_batch_arguments_t * a, rta_fft_setup_t * fft_setup,
+            const unsigned int begin, const unsigned int end)
+{
+  rta_complex_t * bufs[FFT_BATCH_TILE];
+  const unsigned int channels = (a->pairs ? 2 : 1);
+  unsigned int u, t, count;
 
-  if(*fft_setup != NULL)
+  for(u=begin; u<end; u+=count)
   {
-    /* actual FFT size is the next power of 2 of the given argument */
-    (*fft_setup)->fft_size = rta_inextpow2(fft_size);
-    (*fft_setup)->log2_size = rta_ilog2((*fft_setup)->fft_size);
-    (*fft_setup)->input_size = input_size;
+    count = (end - u < FFT_BATCH_TILE ? end - u : FFT_BATCH_TILE);
 
-    (*fft_setup)->output = output;
-    (*fft_setup)->o_stride = 1;
+    for(t=0; t<count; t++)
+    {
+      const size_t offset = (u + t) * channels * a->stride;
 
-    (*fft_setup)->input = input;
-    (*fft_setup)->i_stride = 1;
+      bufs[t] = (rta_complex_t *) (a->outputs + offset);
+      if(a->pairs)
+      {
+        pair_prepare(fft_setup, bufs[t],
+                     (const rta_real_t *) (a->inputs + offset),
+                     (const rta_real_t *) (a->inputs + offset + a->stride),
+                     a->input_size);
+      }
+      else
+      {
+        fft_setup->output = bufs[t];
+        fft_setup->input = a->inputs + offset;
+        if(a->nyquists != NULL)
+        {
+          fft_setup->nyquist = a->nyquists + u + t;
+        }
+        execute_prepare(fft_setup);
+      }
+    }
 
-    (*fft_setup)->nyquist = nyquist;
+    if(a->pairs)
+    {
+      kernel_execute_tile(fft_setup->pair, bufs, count,
+                          1, 1, fft_setup->fft_size);
+    }
+    else
+    {
+      kernel_execute_tile(fft_setup, bufs, count, fft_setup->o_stride,
+                          kernel_coef_step(fft_setup),
+                          transform_size(fft_setup));
+    }
 
-    (*fft_setup)->scale = scale;
-    (*fft_setup)->fft_type = fft_type;
-    
-    ret = tables_new(*fft_setup);
-    if(ret == 0)
+    for(t=0; t<count; t++)
     {
-      rta_free(*fft_setup);
-      *fft_setup = NULL;
+      if(a->pairs)
+      {
+        pair_finish(fft_setup, bufs[t], a->nyquists + 2 * (u + t),
+                    a->nyquists + 2 * (u + t) + 1);
+      }
+      else
+      {
+        fft_setup->output = bufs[t];
+        if(a->nyquists != NULL)
+        {
+          fft_setup->nyquist = a->nyquists + u + t;
+        }
+        execute_finish(fft_setup);
+      }
     }
   }
+  return;
+}
 
-  return ret;
+/* the part 'index' of the tiles, run by each thread */
+static void
+batch_part(void * argument, const unsigned int index,
+           const unsigned int threads_number)
+{
+  const fft_batch_arguments_t * a = (const fft_batch_arguments_t *) argument;
+  const unsigned int tiles_number =
+    (a->units_number + FFT_BATCH_TILE - 1) / FFT_BATCH_TILE;
+  const unsigned int begin = FFT_BATCH_TILE *
+    rta_thread_part_begin(tiles_number, index, threads_number);
+  const unsigned int end = FFT_BATCH_TILE *
+    rta_thread_part_begin(tiles_number, index + 1, threads_number);
+  rta_fft_setup_t fft_setup = *(a->fft_setup);
+  rta_fft_setup_t pair;
+
+  fft_setup.input_size = a->input_size;
+
+  /* the first thread uses the work of the setups */
+  if(index > 0)
+  {
+    rta_complex_t * work = a->fft_setup->threads_work +
+      (index - 1) * a->fft_setup->threads_work_size;
+
+    if(fft_setup.work != NULL)
+    {
+      fft_setup.work = work;
+    }
+
+    if(fft_setup.pair != NULL)
+    {
+      pair = *(fft_setup.pair);
+      if(pair.work != NULL)
+      {
+        pair.work = work;
+      }
+      fft_setup.pair = &pair;
+    }
+  }
+
+  batch_units(a, &fft_setup, begin,
+              (end < a->units_number ? end : a->units_number));
+  return;
+}
+
+/* all the units, on the threads of the pool of the setup if there */
+/* are more than one tile */
+static void
+batch_run(const fft_batch_arguments_t * arguments)
+{
+  const rta_fft_setup_t * fft_setup = arguments->fft_setup;
+  rta_thread_pool_t * pool = NULL;
+
+  if(fft_setup->four_step == NULL &&
+     arguments->units_number > FFT_BATCH_TILE &&
+     (fft_setup->threads_work_size == 0 || fft_setup->threads_work != NULL))
+  {
+    pool = fft_setup->pool;
+  }
+
+  rta_thread_pool_run(pool, batch_part, (void *) arguments);
+  return;
+}
+
+/* ------- end of private ---------------------------- */
+
+/* ------- Public functions -------------------------- */
+
+int
+rta_fft_real_setup_new(rta_fft_setup_t ** fft_setup,
+                       const rta_fft_t fft_type, rta_real_t * scale,
+                       void * input, const unsigned int input_size,
+                       void * output, const unsigned int fft_size,
+                       rta_real_t * nyquist)
+/* FFTW uses input and output to plan executions */
+{
+  return setup_new(fft_setup, fft_type, scale, input, 1, input_size,
+                   output, 1, fft_size, nyquist);
 }
 
 int
@@ -1156,440 +4279,448 @@ rta_fft_real_setup_new_stride(
   rta_real_t * nyquist)
 /* FFTW uses input and output to plan executions */
 {
-  int ret = 0;
+  return setup_new(fft_setup, fft_type, scale,
+                   input, i_stride, input_size,
+                   output, o_stride, fft_size, nyquist);
+}
 
-  *fft_setup = (rta_fft_setup_t *) rta_malloc(sizeof(rta_fft_setup_t));
+int
+rta_fft_setup_new(rta_fft_setup_t ** fft_setup,
+                  const rta_fft_t fft_type, rta_real_t * scale,
+                  rta_complex_t * input, const unsigned int input_size,
+                  rta_complex_t * output, const unsigned int fft_size)
+/* FFTW uses input and output to plan executions */
+{
+  return setup_new(fft_setup, fft_type, scale,
+                   (void *) input, 1, input_size,
+                   (void *) output, 1, fft_size, NULL);
+}
+
+int
+rta_fft_setup_new_stride(
+  rta_fft_setup_t ** fft_setup,
+  const rta_fft_t fft_type, rta_real_t * scale,
+  rta_complex_t * input, const int i_stride, const unsigned int input_size,
+  rta_complex_t * output, const int o_stride, const unsigned int fft_size)
+/* FFTW uses input and output to plan executions */
+{
+  return setup_new(fft_setup, fft_type, scale,
+                   (void *) input, i_stride, input_size,
+                   (void *) output, o_stride, fft_size, NULL);
+}
 
+
+void
+rta_fft_setup_delete(rta_fft_setup_t * fft_setup)
+{
   if(fft_setup != NULL)
   {
-    /* actual FFT size is the next power of 2 of the given argument */
-    (*fft_setup)->fft_size = rta_inextpow2(fft_size);
-    (*fft_setup)->log2_size = rta_ilog2((*fft_setup)->fft_size);
-    (*fft_setup)->input_size = input_size;
+    tables_release(fft_setup->tables);
 
-    (*fft_setup)->output = output;
-    (*fft_setup)->o_stride = o_stride;
+    if(fft_setup->work != NULL)
+    {
+      rta_free(fft_setup->work);
+    }
 
-    (*fft_setup)->input = input;
-    (*fft_setup)->i_stride = i_stride;
+    if(fft_setup->four_step != NULL)
+    {
+      four_step_delete(fft_setup->four_step);
+    }
 
-    (*fft_setup)->nyquist = nyquist;
+    threads_delete(fft_setup);
 
-    (*fft_setup)->scale = scale;
-    (*fft_setup)->fft_type = fft_type;
-    
-    ret = tables_new(*fft_setup);
-    if(ret == 0)
+    if(fft_setup->split_twiddle != NULL)
     {
-      rta_free(*fft_setup);
-      *fft_setup = NULL;
+      rta_free(fft_setup->split_twiddle);
+    }
+
+    if(fft_setup->split_work != NULL)
+    {
+      rta_free(fft_setup->split_work);
+    }
+
+    if(fft_setup->pair != NULL)
+    {
+      rta_fft_setup_delete(fft_setup->pair);
     }
+
+    rta_free(fft_setup);
   }
 
-  return ret;
+  return;
 }
 
+
 int
-rta_fft_setup_new(rta_fft_setup_t ** fft_setup,
-                  const rta_fft_t fft_type, rta_real_t * scale,
-                  rta_complex_t * input, const unsigned int input_size,
-                  rta_complex_t * output, const unsigned int fft_size)
-/* FFTW uses input and output to plan executions */
+rta_fft_setup_threads_set(rta_fft_setup_t * fft_setup,
+                          const unsigned int threads_number)
 {
-  int ret = 0;
+  const unsigned int size = transform_size(fft_setup);
+  int ret = 1;
 
-  *fft_setup = (rta_fft_setup_t *) rta_malloc(sizeof(rta_fft_setup_t));
-
-  if(*fft_setup != NULL)
+  if(fft_setup->four_step != NULL)
   {
-    /* actual FFT size is the next power of 2 of the given argument */
-    (*fft_setup)->fft_size = rta_inextpow2(fft_size);
-    (*fft_setup)->log2_size = rta_ilog2((*fft_setup)->fft_size);
-    (*fft_setup)->input_size = input_size;
+    fft_setup->kernel = fft_setup->four_step->kernel;
+    four_step_delete(fft_setup->four_step);
+    fft_setup->four_step = NULL;
+  }
 
-    (*fft_setup)->output = (void *) output;
-    (*fft_setup)->o_stride = 1;
+  threads_delete(fft_setup);
 
-    (*fft_setup)->input = (void *) input;
-    (*fft_setup)->i_stride = 1;
+  if(threads_number > 1)
+  {
+    ret = rta_thread_pool_new(&(fft_setup->pool), threads_number);
+    if(ret == 0)
+    {
+      fft_setup->pool = NULL;
+    }
+    else
+    {
+      ret = threads_work_new(fft_setup);
+    }
 
-    (*fft_setup)->nyquist = NULL;
+    if(ret != 0 && fft_setup->factors_number == 0 &&
+       size >= RTA_FFT_FOUR_STEP_MIN_SIZE)
+    {
+      ret = four_step_new(&(fft_setup->four_step), fft_setup,
+                          fft_setup->pool);
+      if(ret != 0)
+      {
+        fft_setup->kernel = four_step_kernel;
+      }
+    }
 
-    (*fft_setup)->scale = scale;
-    (*fft_setup)->fft_type = fft_type;
-    
-    ret = tables_new(*fft_setup);
     if(ret == 0)
     {
-      rta_free(*fft_setup);
-      *fft_setup = NULL;
+      threads_delete(fft_setup);
     }
   }
 
   return ret;
 }
 
-int
-rta_fft_setup_new_stride(
-  rta_fft_setup_t ** fft_setup,
-  const rta_fft_t fft_type, rta_real_t * scale,
-  rta_complex_t * input, const int i_stride, const unsigned int input_size,
-  rta_complex_t * output, const int o_stride, const unsigned int fft_size)
-/* FFTW uses input and output to plan executions */
+void
+rta_fft_setup_input_pruning_set(rta_fft_setup_t * fft_setup,
+                                const int input_pruning)
 {
-  int ret = 0;
-
-  *fft_setup = (rta_fft_setup_t *) rta_malloc(sizeof(rta_fft_setup_t));
-
-  if(*fft_setup != NULL)
-  {
-    /* actual FFT size is the next power of 2 of the given argument */
-    (*fft_setup)->fft_size = rta_inextpow2(fft_size);
-    (*fft_setup)->log2_size = rta_ilog2((*fft_setup)->fft_size);
-    (*fft_setup)->input_size = input_size;
+  fft_setup->input_pruning = input_pruning;
+  return;
+}
 
-    (*fft_setup)->output = (void *) output;
-    (*fft_setup)->o_stride = o_stride;
+void
+rta_fft_setup_output_pruning_set(rta_fft_setup_t * fft_setup,
+                                 const unsigned int output_size)
+{
+  fft_setup->output_pruning = output_size;
+  return;
+}
 
-    (*fft_setup)->input = (void *) input;
-    (*fft_setup)->i_stride = i_stride;
+int
+rta_fft_setup_real_pairs_set(rta_fft_setup_t * fft_setup,
+                             const int real_pairs)
+{
+  int ret = 1;
 
-    (*fft_setup)->nyquist = NULL;
+  if(fft_setup->pair != NULL)
+  {
+    rta_fft_setup_delete(fft_setup->pair);
+    fft_setup->pair = NULL;
+  }
 
-    (*fft_setup)->scale = scale;
-    (*fft_setup)->fft_type = fft_type;
-    
-    ret = tables_new(*fft_setup);
-    if(ret == 0)
+  if(real_pairs != 0)
+  {
+    if(fft_setup->fft_type == rta_fft_real_to_complex_1d)
     {
-      rta_free(*fft_setup);
-      *fft_setup = NULL;
+      /* in place, as the pair is transformed in the output */
+      ret = setup_new(&(fft_setup->pair), rta_fft_complex_1d,
+                      fft_setup->scale, NULL, 1, fft_setup->fft_size,
+                      NULL, 1, fft_setup->fft_size, NULL);
     }
+    else
+    {
+      ret = 0;
+    }
+  }
+
+  /* the threads may now need a larger work */
+  if(ret != 0 && fft_setup->pool != NULL)
+  {
+    ret = threads_work_new(fft_setup);
   }
 
   return ret;
 }
 
+void
+rta_fft_execute(void * output, void * input, const unsigned int input_size,
+                rta_fft_setup_t * fft_setup)
+{
+  fft_setup->input = input;
+  fft_setup->output = output;
+  fft_setup->input_size = input_size;
+
+  execute_prepare(fft_setup);
+  kernel_execute(fft_setup, (rta_complex_t *) output, fft_setup->o_stride,
+                 kernel_coef_step(fft_setup), transform_size(fft_setup));
+  execute_finish(fft_setup);
+  return;
+}
+
+inline void 
+rta_fft_real_execute(void * output, void * input, const unsigned int input_size,
+                     rta_fft_setup_t * fft_setup,
+                     rta_real_t * nyquist)
+{
+  fft_setup->nyquist = nyquist;
+  rta_fft_execute(output, input, input_size, fft_setup);
+  return;    
+}
+
+void
+rta_fft_execute_batch(void * outputs, void * inputs,
+                      const unsigned int input_size,
+                      const unsigned int channels_number,
+                      const unsigned int channel_stride,
+                      rta_fft_setup_t * fft_setup)
+{
+  fft_batch_arguments_t arguments;
+
+  arguments.fft_setup = fft_setup;
+  arguments.outputs = (char *) outputs;
+  arguments.inputs = (char *) inputs;
+  /* channel stride in bytes */
+  arguments.stride = channel_stride *
+    (fft_setup->fft_type == rta_fft_real_to_complex_1d ||
+     fft_setup->fft_type == rta_fft_complex_to_real_1d ?
+     sizeof(rta_real_t) : sizeof(rta_complex_t));
+  arguments.input_size = input_size;
+  arguments.units_number = channels_number;
+  arguments.nyquists = NULL;
+  arguments.pairs = 0;
+
+  batch_run(&arguments);
+  return;
+}
 
 void
-rta_fft_setup_delete(rta_fft_setup_t * fft_setup)
+rta_fft_real_execute_batch(void * outputs, void * inputs,
+                           const unsigned int input_size,
+                           const unsigned int channels_number,
+                           const unsigned int channel_stride,
+                           rta_fft_setup_t * fft_setup,
+                           rta_real_t * nyquists)
+{
+  fft_batch_arguments_t arguments;
+
+  arguments.fft_setup = fft_setup;
+  arguments.outputs = (char *) outputs;
+  arguments.inputs = (char *) inputs;
+  arguments.stride = channel_stride * sizeof(rta_real_t);
+  arguments.input_size = input_size;
+  arguments.units_number = channels_number;
+  arguments.nyquists = nyquists;
+
+  /* two by two, when the output frames of a pair are contiguous */
+  arguments.pairs =
+    (fft_setup->pair != NULL && channel_stride == fft_setup->fft_size &&
+     fft_setup->i_stride == 1 && fft_setup->o_stride == 1 &&
+     fft_setup->input_pruning == 0 && fft_setup->output_pruning == 0 &&
+     outputs != inputs);
+
+  if(arguments.pairs)
+  {
+    arguments.units_number = channels_number / 2;
+  }
+
+  batch_run(&arguments);
+
+  /* last channel of an odd number */
+  if(arguments.pairs && (channels_number & 1))
+  {
+    const size_t offset = (channels_number - 1) * arguments.stride;
+
+    rta_fft_real_execute(arguments.outputs + offset,
+                         arguments.inputs + offset, input_size,
+                         fft_setup, nyquists + channels_number - 1);
+  }
+  return;
+}
+
+void
+rta_fft_real_execute_pair(rta_real_t * output,
+                          rta_real_t * input_a, rta_real_t * input_b,
+                          const unsigned int input_size,
+                          rta_fft_setup_t * fft_setup,
+                          rta_real_t * nyquist_a, rta_real_t * nyquist_b)
+{
+  rta_complex_t * buf = (rta_complex_t *) output;
+
+  if(fft_setup->pair == NULL)
+  {
+    /* no pair setup: one after the other */
+    fft_setup->nyquist = nyquist_a;
+    rta_fft_execute(output, input_a, input_size, fft_setup);
+    fft_setup->nyquist = nyquist_b;
+    rta_fft_execute(output + fft_setup->fft_size, input_b, input_size,
+                    fft_setup);
+    return;
+  }
+
+  pair_prepare(fft_setup, buf, input_a, input_b, input_size);
+  kernel_execute(fft_setup->pair, buf, 1, 1, fft_setup->fft_size);
+  pair_finish(fft_setup, buf, nyquist_a, nyquist_b);
+  return;
+}
+
+int
+rta_fft_split_setup_new(rta_fft_setup_t ** fft_setup,
+                        const rta_fft_t fft_type, rta_real_t * scale,
+                        const unsigned int input_size,
+                        const unsigned int fft_size,
+                        rta_real_t * nyquist)
 {
-  if(fft_setup != NULL)
-  {
-    if(fft_setup->sin != NULL)
-    {
-      rta_free(fft_setup->sin);
-    }
+  /* planned in place, without the Stockham passes */
+  int ret = setup_new(fft_setup, fft_type, scale, NULL, 1, input_size,
+                      NULL, 1, fft_size, nyquist);
 
-    if(fft_setup->bitrev != NULL)
+  if(ret != 0)
+  {
+    ret = split_new(*fft_setup);
+    if(ret == 0)
     {
-      rta_free(fft_setup->bitrev);
+      rta_fft_setup_delete(*fft_setup);
+      *fft_setup = NULL;
     }
-
-    rta_free(fft_setup);
   }
 
-  return;
+  return ret;
 }
 
-
 void
-rta_fft_execute(void * output, void * input, const unsigned int input_size,
-                rta_fft_setup_t * fft_setup)
+rta_fft_split_execute(rta_real_t * output_real, rta_real_t * output_imag,
+                      rta_real_t * input_real, rta_real_t * input_imag,
+                      const unsigned int input_size,
+                      rta_fft_setup_t * fft_setup)
 {
-  const unsigned int no_stride = 
-    fft_setup->i_stride == 1 && fft_setup->o_stride == 1;
-  unsigned int spectrum_size = fft_setup->fft_size >> 1;
-  fft_setup->input = input;
-  fft_setup->output = output;
+  const unsigned int size = transform_size(fft_setup);
+  const rta_real_t scale = *(fft_setup->scale);
+  unsigned int i;
+
   fft_setup->input_size = input_size;
 
   switch(fft_setup->fft_type)
   {
     case rta_fft_real_to_complex_1d:
     {
-      rta_real_t * real_input = (rta_real_t *) fft_setup->input;
-      rta_complex_t * complex_output = (rta_complex_t *) fft_setup->output;
+      /* even and odd samples as real and imaginary parts */
+      const unsigned int samples = (input_size < fft_setup->fft_size ?
+                                    input_size : fft_setup->fft_size);
 
-      /* out of place transform */
-      if(fft_setup->input != fft_setup->output)
+      for(i=0; 2*i+1<samples; i++)
       {
-        /* at this moment, the output buffer is real, as the input one */
-        if(no_stride)
-        {
-          fill_real_scale_zero_pad(
-            (rta_real_t *) fft_setup->output, fft_setup->fft_size, 
-            real_input, fft_setup->input_size, *(fft_setup->scale));
-        }
-        else
-        {
-          fill_real_scale_zero_pad_stride(
-            (rta_real_t *) fft_setup->output, fft_setup->o_stride,
-            fft_setup->fft_size, 
-            real_input, fft_setup->i_stride, fft_setup->input_size,
-            *(fft_setup->scale));          
-        }
+        output_real[i] = scale * input_real[2*i];
+        output_imag[i] = scale * input_real[2*i+1];
       }
-      else
+
+      if(2*i < samples)
       {
-       if(no_stride)
-       {
-         scale_real_zero_pad_in_place(
-           real_input, fft_setup->fft_size,
-           fft_setup->input_size, *(fft_setup->scale));
-       }
-       else
-       {
-         /* for in place transforms, fft_setup->o_stride and */
-         /* fft_setup->i_stride must be the equal */
-         scale_real_zero_pad_in_place_stride(
-           real_input, fft_setup->i_stride, fft_setup->fft_size,
-           fft_setup->input_size, *(fft_setup->scale));        
-       }
+        output_real[i] = scale * input_real[2*i];
+        output_imag[i] = 0.;
+        i++;
       }
 
-      if(fft_setup->o_stride == 1)
+      for(; i<size; i++)
       {
-        bitreversal_oversampled_inplace(
-          complex_output, fft_setup->bitrev, spectrum_size);
-        
-        fft_inplace_oversampled_coefficients(
-          complex_output, fft_setup->cos, fft_setup->sin, spectrum_size);
-          
-        shuffle_after_real_fft_inplace(
-          complex_output, fft_setup->cos, fft_setup->sin, spectrum_size);
+        output_real[i] = 0.;
+        output_imag[i] = 0.;
       }
-      else
-      {
-        bitreversal_oversampled_inplace_stride(
-          complex_output, fft_setup->o_stride, fft_setup->bitrev, spectrum_size);
-        
-        fft_inplace_oversampled_coefficients_stride(
-          complex_output, fft_setup->o_stride,
-          fft_setup->cos, fft_setup->sin, spectrum_size);
-          
-        shuffle_after_real_fft_inplace_stride(
-          complex_output, fft_setup->o_stride,
-          fft_setup->cos, fft_setup->sin, spectrum_size);
 
-      }
-      *(fft_setup->nyquist) = rta_cimag(complex_output[0]);
-      rta_set_complex_real(complex_output[0], rta_creal(complex_output[0]));
+      split_kernel_execute(fft_setup, output_real, output_imag, 2, size, 1.);
+      split_shuffle_after_real_fft(output_real, output_imag,
+                                   fft_setup->cos, fft_setup->sin, size);
 
+      *(fft_setup->nyquist) = output_imag[0];
+      output_imag[0] = 0.;
       break;
     }
 
     case rta_fft_complex_to_real_1d:
     {
-      rta_complex_t * complex_input = (rta_complex_t *) fft_setup->input;
-      rta_real_t * real_output = (rta_real_t *) fft_setup->output;
-      rta_complex_t * complex_output = (rta_complex_t *) fft_setup->output;
-
-      /* out of place transform */
-      if(fft_setup->input != fft_setup->output)
-      {
-        if(no_stride)
-        {
-          fill_complex_scale_zero_pad(
-            complex_output, spectrum_size,
-            complex_input, fft_setup->input_size, *(fft_setup->scale));
-        }
-        else
-        {
-          fill_complex_scale_zero_pad_stride(
-            complex_output, fft_setup->o_stride, spectrum_size,
-            complex_input, fft_setup->i_stride, fft_setup->input_size,
-            *(fft_setup->scale));          
-        }
-      }
-      else
-      {
-        if(no_stride)
-        {
-          scale_complex_zero_pad_in_place(
-            complex_input, spectrum_size,
-            fft_setup->input_size,*(fft_setup->scale));
-        }
-        else
-        {
-          /* for in place transforms, fft_setup->o_stride and */
-          /* fft_setup->i_stride must be the equal */
-          scale_complex_zero_pad_in_place_stride(
-            complex_input, fft_setup->i_stride, spectrum_size,
-            fft_setup->input_size,*(fft_setup->scale));          
-        }
-      }
-      
-      /* nyquist value is coded on the first imaginary value */
-      /* there is no stride here: real and imaginary values of the */
-      /* complex type must be contiguous */
-      if(*(fft_setup->scale) != 1.)
-      {
-        real_output[1] = *(fft_setup->nyquist) * *(fft_setup->scale);
-      }
-      else
-      {
-        real_output[1] = *(fft_setup->nyquist);
-      }
-      
-      if(fft_setup->o_stride == 1)
-      {
-        shuffle_before_real_inverse_fft_inplace(
-          complex_output, fft_setup->cos, fft_setup->sin, spectrum_size);
-        
-        bitreversal_oversampled_inplace(
-          complex_output, fft_setup->bitrev, spectrum_size);
-        
-        ifft_inplace_oversampled_coefficients(
-          complex_output, fft_setup->cos, fft_setup->sin, spectrum_size);
-      }
-      else
-      {
-        shuffle_before_real_inverse_fft_inplace_stride(
-          complex_output, fft_setup->o_stride,
-          fft_setup->cos, fft_setup->sin, spectrum_size);
-        
-        bitreversal_oversampled_inplace_stride(
-          complex_output, fft_setup->o_stride,
-          fft_setup->bitrev, spectrum_size);
-        
-        ifft_inplace_oversampled_coefficients_stride(
-          complex_output, fft_setup->o_stride,
-          fft_setup->cos, fft_setup->sin, spectrum_size);        
-      }
+      rta_real_t * work_real = fft_setup->split_work;
+      rta_real_t * work_imag = fft_setup->split_work + size;
 
-      break;
-    }
+      split_fill_scale_zero_pad(work_real, size, input_real, input_size,
+                                scale);
+      split_fill_scale_zero_pad(work_imag, size, input_imag, input_size,
+                                scale);
 
-    case rta_fft_complex_1d:
-    {
-      rta_complex_t * complex_input = (rta_complex_t *) fft_setup->input;
-      rta_complex_t * complex_output = (rta_complex_t *) fft_setup->output;
+      /* nyquist value is coded on the first imaginary value */
+      work_imag[0] = *(fft_setup->nyquist) * scale;
 
-      /* out of place transform */
-      if(fft_setup->input != fft_setup->output)
-      {
-        if(no_stride)
-        {
-          fill_complex_scale_zero_pad(
-            complex_output, fft_setup->fft_size,
-            complex_input, fft_setup->input_size, *(fft_setup->scale));
-        }
-        else
-        {
-          fill_complex_scale_zero_pad_stride(
-            complex_output, fft_setup->o_stride, fft_setup->fft_size,
-            complex_input, fft_setup->i_stride, fft_setup->input_size,
-            *(fft_setup->scale));
-        }
-      }
-      else
-      {
-        if(no_stride)
-        {
-          scale_complex_zero_pad_in_place(
-            complex_input, fft_setup->fft_size,
-            fft_setup->input_size,*(fft_setup->scale));
-        }
-        else
-        {
-         /* for in place transforms, fft_setup->o_stride and */
-         /* fft_setup->i_stride must be the equal */
-          scale_complex_zero_pad_in_place_stride(
-            complex_input, fft_setup->i_stride, fft_setup->fft_size,
-            fft_setup->input_size,*(fft_setup->scale));
-       }
-      }
-      
-      if(fft_setup->o_stride == 1)
-      {
-        bitreversal_inplace(complex_output, fft_setup->bitrev, fft_setup->fft_size);
+      split_shuffle_before_real_inverse_fft(work_real, work_imag,
+                                            fft_setup->cos, fft_setup->sin,
+                                            size);
+      split_kernel_execute(fft_setup, work_real, work_imag, 2, size, -1.);
 
-        fft_inplace(complex_output, fft_setup->cos, fft_setup->sin, fft_setup->fft_size);
-      }
-      else
+      for(i=0; i<size; i++)
       {
-        bitreversal_inplace_stride(complex_output, fft_setup->o_stride,
-          fft_setup->bitrev, fft_setup->fft_size);
-
-        fft_inplace_stride(complex_output, fft_setup->o_stride,
-                           fft_setup->cos, fft_setup->sin, fft_setup->fft_size);
+        output_real[2*i] = work_real[i];
+        output_real[2*i+1] = work_imag[i];
       }
-
       break;
     }
 
+    case rta_fft_complex_1d:
     case rta_fft_complex_inverse_1d:
     {
-      rta_complex_t * complex_input = (rta_complex_t *) fft_setup->input;
-      rta_complex_t * complex_output = (rta_complex_t *) fft_setup->output;
-
-      /* out of place transform */
-      if(fft_setup->input != fft_setup->output)
-      {
-        if(no_stride)
-        {
-          fill_complex_scale_zero_pad(
-            complex_output, fft_setup->fft_size,
-            complex_input, fft_setup->input_size, *(fft_setup->scale));
-        }
-        else
-        {
-          fill_complex_scale_zero_pad_stride(
-            complex_output, fft_setup->o_stride, fft_setup->fft_size,
-            complex_input, fft_setup->i_stride, fft_setup->input_size,
-            *(fft_setup->scale));
-        }
-      }
-      else
-      {
-        if(no_stride)
-        {
-          scale_complex_zero_pad_in_place(
-            complex_input, fft_setup->fft_size,
-            fft_setup->input_size,*(fft_setup->scale));
-        }
-        else
-        {
-          /* for in place transforms, fft_setup->o_stride and */
-          /* fft_setup->i_stride must be the equal */
-          scale_complex_zero_pad_in_place_stride(
-            complex_input, fft_setup->i_stride, fft_setup->fft_size,
-            fft_setup->input_size,*(fft_setup->scale));
-        }
-      }
-
-      if(fft_setup->o_stride == 1)
-      {
-        bitreversal_inplace(
-          complex_output, fft_setup->bitrev, fft_setup->fft_size);
-
-        ifft_inplace(
-          complex_output, fft_setup->cos, fft_setup->sin, fft_setup->fft_size);
-      }
-      else
-      {
-        bitreversal_inplace_stride(complex_output, fft_setup->o_stride,
-                                   fft_setup->bitrev, fft_setup->fft_size);
-        ifft_inplace_stride(complex_output, fft_setup->o_stride, 
-                            fft_setup->cos, fft_setup->sin, fft_setup->fft_size);
-      }
-      
+      split_fill_scale_zero_pad(output_real, size, input_real, input_size,
+                                scale);
+      split_fill_scale_zero_pad(output_imag, size, input_imag, input_size,
+                                scale);
+
+      split_kernel_execute(
+        fft_setup, output_real, output_imag, 1, size,
+        (fft_setup->fft_type == rta_fft_complex_1d ? 1. : -1.));
       break;
     }
-      
+
     default:
       break;
   }
   return;
 }
 
-inline void 
-rta_fft_real_execute(void * output, void * input, const unsigned int input_size,
-                     rta_fft_setup_t * fft_setup,
-                     rta_real_t * nyquist)
+void
+rta_fft_split_real_execute(rta_real_t * output_real, rta_real_t * output_imag,
+                           rta_real_t * input_real, rta_real_t * input_imag,
+                           const unsigned int input_size,
+                           rta_fft_setup_t * fft_setup,
+                           rta_real_t * nyquist)
 {
   fft_setup->nyquist = nyquist;
-  rta_fft_execute(output, input, input_size, fft_setup);
-  return;    
+  rta_fft_split_execute(output_real, output_imag, input_real, input_imag,
+                        input_size, fft_setup);
+  return;
+}
+
+void
+rta_fft_split_magnitude(rta_real_t * magnitude,
+                        const rta_real_t * spectrum_real,
+                        const rta_real_t * spectrum_imag,
+                        const rta_real_t nyquist,
+                        const unsigned int spectrum_size)
+{
+  unsigned int k;
+
+  for(k=0; k+1<spectrum_size; k++)
+  {
+    magnitude[k] = rta_sqrt(spectrum_real[k] * spectrum_real[k] +
+                            spectrum_imag[k] * spectrum_imag[k]);
+  }
+
+  if(spectrum_size > 0)
+  {
+    magnitude[spectrum_size - 1] = rta_abs(nyquist);
+  }
+  return;
 }
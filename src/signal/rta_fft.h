@@ -9,6 +9,34 @@
  * Based on FTM (based on FTS) FFT routines.
  * @see http://ftm.ircam.fr
  *
+ * The radix-4 passes of power of 2 sizes use vector instructions,
+ * selected at setup time (see rta_simd.h).
+ *
+ * Setups of large power of 2 sizes, planned out of place ('input' !=
+ * 'output'), use Stockham autosort passes instead of a bit reversal
+ * followed by in place passes: every pass reads and writes the data in
+ * natural order. See RTA_FFT_STOCKHAM_MIN_SIZE.
+ *
+ * Very large transforms, and the channels of a batch, can be spread on
+ * several threads, see rta_fft_setup_threads_set.
+ *
+ * Complex values can also be given in split format, as separate real
+ * and imaginary arrays, see rta_fft_split_setup_new.
+ *
+ * The sine and bit reversal tables of the power of 2 sizes from 256 to
+ * 8192 are precomputed (see build/rta_fft_static_tables.py), so their
+ * setups do not compute any sine. Define RTA_FFT_NO_STATIC_TABLES to
+ * compute them at setup time instead, for a smaller binary.
+ *
+ * Heavily zero-padded inputs can skip the passes on the padding, and
+ * executions can compute the first output values only (for a narrow
+ * band analysis), see rta_fft_setup_input_pruning_set and
+ * rta_fft_setup_output_pruning_set.
+ *
+ * The coefficient tables are shared by all the setups of the same size
+ * and type: they are computed by the first setup, and released with
+ * the last one. Setups may be created and deleted from any thread.
+ *
  * @copyright
  * Copyright (C) 2007 by IRCAM-Centre Georges Pompidou, Paris, France.
  * All rights reserved.
@@ -46,6 +74,24 @@
 #include "rta.h"
 #include "rta_complex.h"
 
+/** minimum complex transform size of the Stockham passes, with the
+ * scalar butterflies */
+#ifndef RTA_FFT_STOCKHAM_MIN_SIZE
+#define RTA_FFT_STOCKHAM_MIN_SIZE 16384
+#endif
+
+/** minimum complex transform size of the Stockham passes, with the
+ * vector butterflies */
+#ifndef RTA_FFT_STOCKHAM_SIMD_MIN_SIZE
+#define RTA_FFT_STOCKHAM_SIMD_MIN_SIZE 2097152
+#endif
+
+/** minimum complex transform size of the four-step threads, see
+ * rta_fft_setup_threads_set */
+#ifndef RTA_FFT_FOUR_STEP_MIN_SIZE
+#define RTA_FFT_FOUR_STEP_MIN_SIZE 262144
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -66,10 +112,11 @@ typedef struct rta_fft_setup rta_fft_setup_t;
  * Allocate and initialize an FFT setup for real to complex or complex
  * to real transform, according to the planned processes.
  *
- * The internal implementation always uses an FFT size of the next (or
- * equal) power of 2 of the given 'fft_size'. If the 'input_size is
- * smaller than the actual FFT size, it is zero-padded. The use of
- * external libraries may differ.
+ * The internal implementation uses the given 'fft_size', rounded up to
+ * the next even number. Any size is supported: sizes made of factors
+ * 2, 3, 4 and 5 are the fastest, other prime factors use a slower
+ * generic butterfly. If the 'input_size is smaller than the actual FFT
+ * size, it is zero-padded. The use of external libraries may differ.
  *
  * Processing can be in place if 'input' == 'output'. Any real input
  * data must be written as real (static cast).
@@ -113,10 +160,11 @@ rta_fft_real_setup_new(rta_fft_setup_t ** fft_setup,
  * Allocate and initialize an FFT setup for real to complex or complex
  * to real transform, according to the planned processes.
  *
- * The internal implementation always uses an FFT size of the next (or
- * equal) power of 2 of the given 'fft_size'. If the 'input_size is
- * smaller than the actual FFT size, it is zero-padded. The use of
- * external libraries may differ.
+ * The internal implementation uses the given 'fft_size', rounded up to
+ * the next even number. Any size is supported: sizes made of factors
+ * 2, 3, 4 and 5 are the fastest, other prime factors use a slower
+ * generic butterfly. If the 'input_size is smaller than the actual FFT
+ * size, it is zero-padded. The use of external libraries may differ.
  *
  * Processing can be in place if 'input' == 'output'. Any real input
  * data must be written as real (static cast), using 'o_stride'.
@@ -163,10 +211,11 @@ rta_fft_real_setup_new_stride(
  * Allocate and initialize an FFT setup for complex transform, direct
  * or inverse, according to the planned processes.
  *
- * The internal implementation always uses an FFT size of the next (or
- * equal) power of 2 of the given 'fft_size'. If the 'input_size is
- * smaller than the actual FFT size, it is zero-padded. The use of
- * external libraries may differ.
+ * The internal implementation uses the given 'fft_size'. Any size is
+ * supported: sizes made of factors 2, 3, 4 and 5 are the fastest,
+ * other prime factors use a slower generic butterfly. If the
+ * 'input_size is smaller than the actual FFT size, it is
+ * zero-padded. The use of external libraries may differ.
  *
  * Processing can be in place if 'input' == 'output'. Any real input
  * data must be written as complex (real and imaginary values must be
@@ -207,10 +256,11 @@ rta_fft_setup_new(rta_fft_setup_t ** fft_setup,
  * Allocate and initialize an FFT setup for complex transform, direct
  * or inverse, according to the planned processes.
  *
- * The internal implementation always uses an FFT size of the next (or
- * equal) power of 2 of the given 'fft_size'. If the 'input_size is
- * smaller than the actual FFT size, it is zero-padded. The use of
- * external libraries may differ.
+ * The internal implementation uses the given 'fft_size'. Any size is
+ * supported: sizes made of factors 2, 3, 4 and 5 are the fastest,
+ * other prime factors use a slower generic butterfly. If the
+ * 'input_size is smaller than the actual FFT size, it is
+ * zero-padded. The use of external libraries may differ.
  *
  * Processing can be in place if 'input' == 'output'. (real and
  * imaginary values must be contiguous no matter the strides).
@@ -259,6 +309,103 @@ rta_fft_setup_new_stride(
  */
 void rta_fft_setup_delete(rta_fft_setup_t * fft_setup);
 
+/**
+ * Set the number of threads of a transform. With more than 1 thread,
+ * a pool of 'threads_number' - 1 worker threads and the calling one
+ * shares the channels of rta_fft_execute_batch and
+ * rta_fft_real_execute_batch. For power of 2 complex transform sizes
+ * (half of 'fft_size' for real transforms) of at least
+ * RTA_FFT_FOUR_STEP_MIN_SIZE, each transform is rather computed by
+ * the four-step (Bailey) algorithm: two sets of transforms of about
+ * the square root of the size, which fit in cache, between
+ * transposes. The transforms of each set are shared by the pool. The
+ * workers live until the setup is deleted, or until this function is
+ * called again.
+ *
+ * A setup with threads must not be executed from several threads at
+ * the same time.
+ *
+ * \see rta_fft_setup_new
+ *
+ * @param fft_setup is a previously allocated setup
+ * @param threads_number is the number of threads, including the
+ * calling one. 0 or 1 stop any workers.
+ *
+ * @return 1 on success 0 on fail. If it fails, the setup is single
+ * threaded.
+ */
+int
+rta_fft_setup_threads_set(rta_fft_setup_t * fft_setup,
+                          const unsigned int threads_number);
+
+/**
+ * Enable or disable the input pruning of a setup (disabled by
+ * default). When an execution zero-pads its input to at most a quarter
+ * of the complex transform size, the passes on the zero padding are
+ * skipped: the cost is in N*log2(M) instead of N*log2(N), with M the
+ * next power of 2 of 'input_size' (of 'input_size' / 2 for a real
+ * input). This applies to power of 2 sizes, for direct transforms and
+ * complex inverse transforms, with a contiguous 'output'. Other
+ * executions, or a larger 'input_size', use the usual passes (and the
+ * threads, if any).
+ *
+ * \see rta_fft_execute
+ *
+ * @param fft_setup is a previously allocated setup
+ * @param input_pruning is 1 to enable, 0 to disable
+ */
+void
+rta_fft_setup_input_pruning_set(rta_fft_setup_t * fft_setup,
+                                const int input_pruning);
+
+/**
+ * Declare the number of first output values actually needed by the
+ * executions of a setup (all of them by default). For power of 2
+ * sizes and a contiguous 'output', when it is at most a quarter of
+ * the complex transform size (an eighth for a real input), the last
+ * passes are replaced by a direct computation of these values only:
+ * the cost is in N*log2(M) + N, with M the next power of 2 of
+ * 'output_size'. The other output values are then unspecified.
+ *
+ * 'output_size' counts complex values for the direct transforms (the
+ * nyquist value of a real input is always computed) and the complex
+ * inverse transform, and real samples for the complex to real inverse
+ * transform.
+ *
+ * This can be combined with rta_fft_setup_input_pruning_set.
+ *
+ * \see rta_fft_execute
+ *
+ * @param fft_setup is a previously allocated setup
+ * @param output_size is the number of first output values needed, 0
+ * for all of them
+ */
+void
+rta_fft_setup_output_pruning_set(rta_fft_setup_t * fft_setup,
+                                 const unsigned int output_size);
+
+/**
+ * Enable the transforms of pairs of real frames, for a
+ * rta_fft_real_to_complex_1d setup. Two real frames a and b are
+ * transformed together, as the real and imaginary parts of one
+ * complex frame of 'fft_size' points, and their spectra are then
+ * separated. See rta_fft_real_execute_pair.
+ *
+ * rta_fft_real_execute_batch then transforms the channels two by
+ * two, when the output frames are contiguous ('channel_stride' is
+ * 'fft_size'), without stride, out of place, and without pruning.
+ *
+ * @param fft_setup is a previously allocated setup
+ * @param real_pairs is 0 to release the pair transform, otherwise it
+ * is allocated
+ *
+ * @return 1 on success, 0 on failure (allocation, or not a real to
+ * complex setup)
+ */
+int
+rta_fft_setup_real_pairs_set(rta_fft_setup_t * fft_setup,
+                             const int real_pairs);
+
 /**
  * Compute an FFT according to an FFT setup. It is possible to use
  * different 'input' and 'output' arguments as those used to
@@ -308,6 +455,201 @@ rta_fft_real_execute(void * output, void * input, const unsigned int input_size,
                      rta_fft_setup_t * fft_setup,
                      rta_real_t * nyquist);
 
+/**
+ * Compute the FFTs of several channels, according to an FFT setup,
+ * with the same results as calls to rta_fft_execute for each
+ * channel. The channels are transformed by tiles of a few frames: for
+ * power of 2 sizes, each pass of the butterflies runs over all the
+ * frames of a tile before the next one, so that the tables of the
+ * setup stay in cache and each twiddle factor serves several
+ * frames. With the threads of rta_fft_setup_threads_set, the tiles
+ * are shared by the threads (except for the four-step transforms,
+ * which use the threads for each frame).
+ *
+ * \see rta_fft_execute
+ * \see rta_fft_setup_threads_set
+ *
+ * @param outputs is the first output frame, as 'output' of
+ * rta_fft_execute.
+ * @param inputs is the first input frame, as 'input' of
+ * rta_fft_execute.
+ * @param input_size is used to perform zero padding, not to resize
+ * 'inputs' after a planned setup.
+ * @param channels_number is the number of frames to transform
+ * @param channel_stride is the distance between the beginnings of two
+ * consecutive frames, for inputs and outputs, in number of rta_complex_t
+ * for complex transforms, and in number of rta_real_t for real
+ * transforms. Frames must not overlap.
+ * @param fft_setup is a pointer to a private structure, which may
+ * depend on the actual FFT implementation.
+ */
+void
+rta_fft_execute_batch(void * outputs, void * inputs,
+                      const unsigned int input_size,
+                      const unsigned int channels_number,
+                      const unsigned int channel_stride,
+                      rta_fft_setup_t * fft_setup);
+
+/**
+ * Compute the real FFTs of several channels, according to an FFT
+ * setup, with the same results as calls to rta_fft_real_execute for
+ * each channel, by tiles and threads as rta_fft_execute_batch. With
+ * rta_fft_setup_real_pairs_set, the channels are transformed two by
+ * two, and the last one of an odd number alone.
+ *
+ * \see rta_fft_real_execute
+ * \see rta_fft_execute_batch
+ * \see rta_fft_setup_real_pairs_set
+ *
+ * @param outputs is the first output frame, as 'output' of
+ * rta_fft_real_execute.
+ * @param inputs is the first input frame, as 'input' of
+ * rta_fft_real_execute.
+ * @param input_size is used to perform zero padding, not to resize
+ * 'inputs' after a planned setup.
+ * @param channels_number is the number of frames to transform
+ * @param channel_stride is the distance between the beginnings of two
+ * consecutive frames, for inputs and outputs, in number of
+ * rta_real_t. Frames must not overlap.
+ * @param fft_setup is a pointer to a private structure, which may
+ * depend on the actual FFT implementation.
+ * @param nyquists is an array of 'channels_number' values at the
+ * Nyquist frequency (for direct and inverse real transforms).
+ */
+void
+rta_fft_real_execute_batch(void * outputs, void * inputs,
+                           const unsigned int input_size,
+                           const unsigned int channels_number,
+                           const unsigned int channel_stride,
+                           rta_fft_setup_t * fft_setup,
+                           rta_real_t * nyquists);
+
+/**
+ * Compute the real FFTs of two frames at once, with one complex FFT
+ * of 'fft_size' points, according to an FFT setup. The frames are
+ * scaled and zero padded as for rta_fft_real_execute. Without
+ * rta_fft_setup_real_pairs_set, the frames are transformed one after
+ * the other.
+ *
+ * \see rta_fft_setup_real_pairs_set
+ *
+ * @param output size is 2 * 'fft_size': the spectrum of 'input_a',
+ * then the spectrum of 'input_b', each one as 'output' of
+ * rta_fft_real_execute. It must not overlap the inputs.
+ * @param input_a is the first real frame
+ * @param input_b is the second real frame
+ * @param input_size is used to perform zero padding, for both frames
+ * @param fft_setup is a rta_fft_real_to_complex_1d setup
+ * @param nyquist_a is the Nyquist value of 'input_a'
+ * @param nyquist_b is the Nyquist value of 'input_b'
+ */
+void
+rta_fft_real_execute_pair(rta_real_t * output,
+                          rta_real_t * input_a, rta_real_t * input_b,
+                          const unsigned int input_size,
+                          rta_fft_setup_t * fft_setup,
+                          rta_real_t * nyquist_a, rta_real_t * nyquist_b);
+
+/**
+ * Allocate and initialize an FFT setup for the split complex format,
+ * where the real and imaginary parts of complex values are in
+ * separate arrays, without any shuffle in the butterflies (like
+ * vDSP's DSPSplitComplex). Power of 2 sizes use split passes; the
+ * other sizes go through an interleaved buffer.
+ *
+ * Such a setup is executed by rta_fft_split_execute or
+ * rta_fft_split_real_execute only. It ignores the threads and the
+ * pruning of the interleaved executions.
+ *
+ * \see rta_fft_setup_delete
+ *
+ * @param fft_setup is an address of a pointer to a private structure,
+ * which may depend on the actual FFT implementation. This function
+ * allocates 'fft_setup' and fills it.
+ * @param fft_type is the type of the transforms, as for
+ * rta_fft_real_setup_new.
+ * @param scale is a pointer to the scale factor.
+ * @param input_size is the default input size, used for zero-padding.
+ * @param fft_size is the size of the transform (real values for a
+ * real transform, complex values otherwise). It must be even for a
+ * real transform.
+ * @param nyquist is the address of the real transform value at the
+ * Nyquist frequency (for direct and inverse real transforms, NULL
+ * otherwise).
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'fft_setup' (even a delete).
+ */
+int
+rta_fft_split_setup_new(rta_fft_setup_t ** fft_setup,
+                        const rta_fft_t fft_type, rta_real_t * scale,
+                        const unsigned int input_size,
+                        const unsigned int fft_size,
+                        rta_real_t * nyquist);
+
+/**
+ * Compute an FFT according to a split complex setup. Each complex
+ * array is given as its 'real' and 'imag' parts, of 'fft_size' values
+ * for complex transforms, and 'fft_size' / 2 values for a real
+ * transform spectrum (whose imaginary part at 0 is 0, the Nyquist
+ * value being apart).
+ *
+ * Complex transforms can be done in place ('output_real' ==
+ * 'input_real' and 'output_imag' == 'input_imag'). The real signal
+ * of a real transform (of 'fft_size' values) must not overlap its
+ * spectrum.
+ *
+ * \see rta_fft_split_setup_new
+ *
+ * @param output_real is the real part of the output, or the real
+ * signal of an inverse real transform
+ * @param output_imag is the imaginary part of the output, unused for
+ * an inverse real transform
+ * @param input_real is the real part of the input, or the real
+ * signal of a direct real transform
+ * @param input_imag is the imaginary part of the input, unused for a
+ * direct real transform
+ * @param input_size is used to perform zero padding
+ * @param fft_setup is a split complex setup
+ */
+void
+rta_fft_split_execute(rta_real_t * output_real, rta_real_t * output_imag,
+                      rta_real_t * input_real, rta_real_t * input_imag,
+                      const unsigned int input_size,
+                      rta_fft_setup_t * fft_setup);
+
+/**
+ * Same as rta_fft_split_execute, with the address of the Nyquist
+ * value of a real transform.
+ *
+ * \see rta_fft_split_execute
+ *
+ * @param nyquist is the address of the real transform value at the
+ * Nyquist frequency (for direct and inverse real transforms).
+ */
+void
+rta_fft_split_real_execute(rta_real_t * output_real, rta_real_t * output_imag,
+                           rta_real_t * input_real, rta_real_t * input_imag,
+                           const unsigned int input_size,
+                           rta_fft_setup_t * fft_setup,
+                           rta_real_t * nyquist);
+
+/**
+ * Magnitude of a real transform spectrum in split complex format.
+ *
+ * @param magnitude size is 'spectrum_size'
+ * @param spectrum_real size is 'spectrum_size' - 1
+ * @param spectrum_imag size is 'spectrum_size' - 1
+ * @param nyquist is the real value at the Nyquist frequency
+ * @param spectrum_size is ('fft_size' / 2) + 1
+ */
+void
+rta_fft_split_magnitude(rta_real_t * magnitude,
+                        const rta_real_t * spectrum_real,
+                        const rta_real_t * spectrum_imag,
+                        const rta_real_t nyquist,
+                        const unsigned int spectrum_size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,12277 @@
+/**
+ * @file   rta_fft_static_tables.h
+ * @author Jean-Philippe Lambert
+ * @ingroup rta_signal
+ *
+ * @brief  Precomputed FFT tables (private)
+ *
+ * Sine and bit reversal tables of the power of 2 FFT sizes from
+ * FFT_STATIC_MIN_SIZE to FFT_STATIC_MAX_SIZE, in the layout of
+ * tables_new in rta_fft.c: the sine from 0 to 2pi inclusive, plus a
+ * quarter for the cosine (5/4 * size + 1 values). Only included by
+ * rta_fft.c, unless RTA_FFT_NO_STATIC_TABLES is defined.
+ *
+ * Generated by build/rta_fft_static_tables.py. Do not edit.
+ *
+ * @copyright
+ * Copyright (C) 2007 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_FFT_STATIC_TABLES_H_
+#define _RTA_FFT_STATIC_TABLES_H_ 1
+
+#include "rta.h"
+
+#define FFT_STATIC_MIN_SIZE 256
+#define FFT_STATIC_MAX_SIZE 8192
+
+static const unsigned int fft_static_bitrev_256[256] =
+{
+  0, 128, 64, 192, 32, 160, 96, 224, 16, 144, 80, 208,
+  48, 176, 112, 240, 8, 136, 72, 200, 40, 168, 104, 232,
+  24, 152, 88, 216, 56, 184, 120, 248, 4, 132, 68, 196,
+  36, 164, 100, 228, 20, 148, 84, 212, 52, 180, 116, 244,
+  12, 140, 76, 204, 44, 172, 108, 236, 28, 156, 92, 220,
+  60, 188, 124, 252, 2, 130, 66, 194, 34, 162, 98, 226,
+  18, 146, 82, 210, 50, 178, 114, 242, 10, 138, 74, 202,
+  42, 170, 106, 234, 26, 154, 90, 218, 58, 186, 122, 250,
+  6, 134, 70, 198, 38, 166, 102, 230, 22, 150, 86, 214,
+  54, 182, 118, 246, 14, 142, 78, 206, 46, 174, 110, 238,
+  30, 158, 94, 222, 62, 190, 126, 254, 1, 129, 65, 193,
+  33, 161, 97, 225, 17, 145, 81, 209, 49, 177, 113, 241,
+  9, 137, 73, 201, 41, 169, 105, 233, 25, 153, 89, 217,
+  57, 185, 121, 249, 5, 133, 69, 197, 37, 165, 101, 229,
+  21, 149, 85, 213, 53, 181, 117, 245, 13, 141, 77, 205,
+  45, 173, 109, 237, 29, 157, 93, 221, 61, 189, 125, 253,
+  3, 131, 67, 195, 35, 163, 99, 227, 19, 147, 83, 211,
+  51, 179, 115, 243, 11, 139, 75, 203, 43, 171, 107, 235,
+  27, 155, 91, 219, 59, 187, 123, 251, 7, 135, 71, 199,
+  39, 167, 103, 231, 23, 151, 87, 215, 55, 183, 119, 247,
+  15, 143, 79, 207, 47, 175, 111, 239, 31, 159, 95, 223,
+  63, 191, 127, 255
+};
+
+static const unsigned int fft_static_bitrev_512[512] =
+{
+  0, 256, 128, 384, 64, 320, 192, 448, 32, 288, 160, 416,
+  96, 352, 224, 480, 16, 272, 144, 400, 80, 336, 208, 464,
+  48, 304, 176, 432, 112, 368, 240, 496, 8, 264, 136, 392,
+  72, 328, 200, 456, 40, 296, 168, 424, 104, 360, 232, 488,
+  24, 280, 152, 408, 88, 344, 216, 472, 56, 312, 184, 440,
+  120, 376, 248, 504, 4, 260, 132, 388, 68, 324, 196, 452,
+  36, 292, 164, 420, 100, 356, 228, 484, 20, 276, 148, 404,
+  84, 340, 212, 468, 52, 308, 180, 436, 116, 372, 244, 500,
+  12, 268, 140, 396, 76, 332, 204, 460, 44, 300, 172, 428,
+  108, 364, 236, 492, 28, 284, 156, 412, 92, 348, 220, 476,
+  60, 316, 188, 444, 124, 380, 252, 508, 2, 258, 130, 386,
+  66, 322, 194, 450, 34, 290, 162, 418, 98, 354, 226, 482,
+  18, 274, 146, 402, 82, 338, 210, 466, 50, 306, 178, 434,
+  114, 370, 242, 498, 10, 266, 138, 394, 74, 330, 202, 458,
+  42, 298, 170, 426, 106, 362, 234, 490, 26, 282, 154, 410,
+  90, 346, 218, 474, 58, 314, 186, 442, 122, 378, 250, 506,
+  6, 262, 134, 390, 70, 326, 198, 454, 38, 294, 166, 422,
+  102, 358, 230, 486, 22, 278, 150, 406, 86, 342, 214, 470,
+  54, 310, 182, 438, 118, 374, 246, 502, 14, 270, 142, 398,
+  78, 334, 206, 462, 46, 302, 174, 430, 110, 366, 238, 494,
+  30, 286, 158, 414, 94, 350, 222, 478, 62, 318, 190, 446,
+  126, 382, 254, 510, 1, 257, 129, 385, 65, 321, 193, 449,
+  33, 289, 161, 417, 97, 353, 225, 481, 17, 273, 145, 401,
+  81, 337, 209, 465, 49, 305, 177, 433, 113, 369, 241, 497,
+  9, 265, 137, 393, 73, 329, 201, 457, 41, 297, 169, 425,
+  105, 361, 233, 489, 25, 281, 153, 409, 89, 345, 217, 473,
+  57, 313, 185, 441, 121, 377, 249, 505, 5, 261, 133, 389,
+  69, 325, 197, 453, 37, 293, 165, 421, 101, 357, 229, 485,
+  21, 277, 149, 405, 85, 341, 213, 469, 53, 309, 181, 437,
+  117, 373, 245, 501, 13, 269, 141, 397, 77, 333, 205, 461,
+  45, 301, 173, 429, 109, 365, 237, 493, 29, 285, 157, 413,
+  93, 349, 221, 477, 61, 317, 189, 445, 125, 381, 253, 509,
+  3, 259, 131, 387, 67, 323, 195, 451, 35, 291, 163, 419,
+  99, 355, 227, 483, 19, 275, 147, 403, 83, 339, 211, 467,
+  51, 307, 179, 435, 115, 371, 243, 499, 11, 267, 139, 395,
+  75, 331, 203, 459, 43, 299, 171, 427, 107, 363, 235, 491,
+  27, 283, 155, 411, 91, 347, 219, 475, 59, 315, 187, 443,
+  123, 379, 251, 507, 7, 263, 135, 391, 71, 327, 199, 455,
+  39, 295, 167, 423, 103, 359, 231, 487, 23, 279, 151, 407,
+  87, 343, 215, 471, 55, 311, 183, 439, 119, 375, 247, 503,
+  15, 271, 143, 399, 79, 335, 207, 463, 47, 303, 175, 431,
+  111, 367, 239, 495, 31, 287, 159, 415, 95, 351, 223, 479,
+  63, 319, 191, 447, 127, 383, 255, 511
+};
+
+static const unsigned int fft_static_bitrev_1024[1024] =
+{
+  0, 512, 256, 768, 128, 640, 384, 896, 64, 576, 320, 832,
+  192, 704, 448, 960, 32, 544, 288, 800, 160, 672, 416, 928,
+  96, 608, 352, 864, 224, 736, 480, 992, 16, 528, 272, 784,
+  144, 656, 400, 912, 80, 592, 336, 848, 208, 720, 464, 976,
+  48, 560, 304, 816, 176, 688, 432, 944, 112, 624, 368, 880,
+  240, 752, 496, 1008, 8, 520, 264, 776, 136, 648, 392, 904,
+  72, 584, 328, 840, 200, 712, 456, 968, 40, 552, 296, 808,
+  168, 680, 424, 936, 104, 616, 360, 872, 232, 744, 488, 1000,
+  24, 536, 280, 792, 152, 664, 408, 920, 88, 600, 344, 856,
+  216, 728, 472, 984, 56, 568, 312, 824, 184, 696, 440, 952,
+  120, 632, 376, 888, 248, 760, 504, 1016, 4, 516, 260, 772,
+  132, 644, 388, 900, 68, 580, 324, 836, 196, 708, 452, 964,
+  36, 548, 292, 804, 164, 676, 420, 932, 100, 612, 356, 868,
+  228, 740, 484, 996, 20, 532, 276, 788, 148, 660, 404, 916,
+  84, 596, 340, 852, 212, 724, 468, 980, 52, 564, 308, 820,
+  180, 692, 436, 948, 116, 628, 372, 884, 244, 756, 500, 1012,
+  12, 524, 268, 780, 140, 652, 396, 908, 76, 588, 332, 844,
+  204, 716, 460, 972, 44, 556, 300, 812, 172, 684, 428, 940,
+  108, 620, 364, 876, 236, 748, 492, 1004, 28, 540, 284, 796,
+  156, 668, 412, 924, 92, 604, 348, 860, 220, 732, 476, 988,
+  60, 572, 316, 828, 188, 700, 444, 956, 124, 636, 380, 892,
+  252, 764, 508, 1020, 2, 514, 258, 770, 130, 642, 386, 898,
+  66, 578, 322, 834, 194, 706, 450, 962, 34, 546, 290, 802,
+  162, 674, 418, 930, 98, 610, 354, 866, 226, 738, 482, 994,
+  18, 530, 274, 786, 146, 658, 402, 914, 82, 594, 338, 850,
+  210, 722, 466, 978, 50, 562, 306, 818, 178, 690, 434, 946,
+  114, 626, 370, 882, 242, 754, 498, 1010, 10, 522, 266, 778,
+  138, 650, 394, 906, 74, 586, 330, 842, 202, 714, 458, 970,
+  42, 554, 298, 810, 170, 682, 426, 938, 106, 618, 362, 874,
+  234, 746, 490, 1002, 26, 538, 282, 794, 154, 666, 410, 922,
+  90, 602, 346, 858, 218, 730, 474, 986, 58, 570, 314, 826,
+  186, 698, 442, 954, 122, 634, 378, 890, 250, 762, 506, 1018,
+  6, 518, 262, 774, 134, 646, 390, 902, 70, 582, 326, 838,
+  198, 710, 454, 966, 38, 550, 294, 806, 166, 678, 422, 934,
+  102, 614, 358, 870, 230, 742, 486, 998, 22, 534, 278, 790,
+  150, 662, 406, 918, 86, 598, 342, 854, 214, 726, 470, 982,
+  54, 566, 310, 822, 182, 694, 438, 950, 118, 630, 374, 886,
+  246, 758, 502, 1014, 14, 526, 270, 782, 142, 654, 398, 910,
+  78, 590, 334, 846, 206, 718, 462, 974, 46, 558, 302, 814,
+  174, 686, 430, 942, 110, 622, 366, 878, 238, 750, 494, 1006,
+  30, 542, 286, 798, 158, 670, 414, 926, 94, 606, 350, 862,
+  222, 734, 478, 990, 62, 574, 318, 830, 190, 702, 446, 958,
+  126, 638, 382, 894, 254, 766, 510, 1022, 1, 513, 257, 769,
+  129, 641, 385, 897, 65, 577, 321, 833, 193, 705, 449, 961,
+  33, 545, 289, 801, 161, 673, 417, 929, 97, 609, 353, 865,
+  225, 737, 481, 993, 17, 529, 273, 785, 145, 657, 401, 913,
+  81, 593, 337, 849, 209, 721, 465, 977, 49, 561, 305, 817,
+  177, 689, 433, 945, 113, 625, 369, 881, 241, 753, 497, 1009,
+  9, 521, 265, 777, 137, 649, 393, 905, 73, 585, 329, 841,
+  201, 713, 457, 969, 41, 553, 297, 809, 169, 681, 425, 937,
+  105, 617, 361, 873, 233, 745, 489, 1001, 25, 537, 281, 793,
+  153, 665, 409, 921, 89, 601, 345, 857, 217, 729, 473, 985,
+  57, 569, 313, 825, 185, 697, 441, 953, 121, 633, 377, 889,
+  249, 761, 505, 1017, 5, 517, 261, 773, 133, 645, 389, 901,
+  69, 581, 325, 837, 197, 709, 453, 965, 37, 549, 293, 805,
+  165, 677, 421, 933, 101, 613, 357, 869, 229, 741, 485, 997,
+  21, 533, 277, 789, 149, 661, 405, 917, 85, 597, 341, 853,
+  213, 725, 469, 981, 53, 565, 309, 821, 181, 693, 437, 949,
+  117, 629, 373, 885, 245, 757, 501, 1013, 13, 525, 269, 781,
+  141, 653, 397, 909, 77, 589, 333, 845, 205, 717, 461, 973,
+  45, 557, 301, 813, 173, 685, 429, 941, 109, 621, 365, 877,
+  237, 749, 493, 1005, 29, 541, 285, 797, 157, 669, 413, 925,
+  93, 605, 349, 861, 221, 733, 477, 989, 61, 573, 317, 829,
+  189, 701, 445, 957, 125, 637, 381, 893, 253, 765, 509, 1021,
+  3, 515, 259, 771, 131, 643, 387, 899, 67, 579, 323, 835,
+  195, 707, 451, 963, 35, 547, 291, 803, 163, 675, 419, 931,
+  99, 611, 355, 867, 227, 739, 483, 995, 19, 531, 275, 787,
+  147, 659, 403, 915, 83, 595, 339, 851, 211, 723, 467, 979,
+  51, 563, 307, 819, 179, 691, 435, 947, 115, 627, 371, 883,
+  243, 755, 499, 1011, 11, 523, 267, 779, 139, 651, 395, 907,
+  75, 587, 331, 843, 203, 715, 459, 971, 43, 555, 299, 811,
+  171, 683, 427, 939, 107, 619, 363, 875, 235, 747, 491, 1003,
+  27, 539, 283, 795, 155, 667, 411, 923, 91, 603, 347, 859,
+  219, 731, 475, 987, 59, 571, 315, 827, 187, 699, 443, 955,
+  123, 635, 379, 891, 251, 763, 507, 1019, 7, 519, 263, 775,
+  135, 647, 391, 903, 71, 583, 327, 839, 199, 711, 455, 967,
+  39, 551, 295, 807, 167, 679, 423, 935, 103, 615, 359, 871,
+  231, 743, 487, 999, 23, 535, 279, 791, 151, 663, 407, 919,
+  87, 599, 343, 855, 215, 727, 471, 983, 55, 567, 311, 823,
+  183, 695, 439, 951, 119, 631, 375, 887, 247, 759, 503, 1015,
+  15, 527, 271, 783, 143, 655, 399, 911, 79, 591, 335, 847,
+  207, 719, 463, 975, 47, 559, 303, 815, 175, 687, 431, 943,
+  111, 623, 367, 879, 239, 751, 495, 1007, 31, 543, 287, 799,
+  159, 671, 415, 927, 95, 607, 351, 863, 223, 735, 479, 991,
+  63, 575, 319, 831, 191, 703, 447, 959, 127, 639, 383, 895,
+  255, 767, 511, 1023
+};
+
+static const unsigned int fft_static_bitrev_2048[2048] =
+{
+  0, 1024, 512, 1536, 256, 1280, 768, 1792, 128, 1152, 640, 1664,
+  384, 1408, 896, 1920, 64, 1088, 576, 1600, 320, 1344, 832, 1856,
+  192, 1216, 704, 1728, 448, 1472, 960, 1984, 32, 1056, 544, 1568,
+  288, 1312, 800, 1824, 160, 1184, 672, 1696, 416, 1440, 928, 1952,
+  96, 1120, 608, 1632, 352, 1376, 864, 1888, 224, 1248, 736, 1760,
+  480, 1504, 992, 2016, 16, 1040, 528, 1552, 272, 1296, 784, 1808,
+  144, 1168, 656, 1680, 400, 1424, 912, 1936, 80, 1104, 592, 1616,
+  336, 1360, 848, 1872, 208, 1232, 720, 1744, 464, 1488, 976, 2000,
+  48, 1072, 560, 1584, 304, 1328, 816, 1840, 176, 1200, 688, 1712,
+  432, 1456, 944, 1968, 112, 1136, 624, 1648, 368, 1392, 880, 1904,
+  240, 1264, 752, 1776, 496, 1520, 1008, 2032, 8, 1032, 520, 1544,
+  264, 1288, 776, 1800, 136, 1160, 648, 1672, 392, 1416, 904, 1928,
+  72, 1096, 584, 1608, 328, 1352, 840, 1864, 200, 1224, 712, 1736,
+  456, 1480, 968, 1992, 40, 1064, 552, 1576, 296, 1320, 808, 1832,
+  168, 1192, 680, 1704, 424, 1448, 936, 1960, 104, 1128, 616, 1640,
+  360, 1384, 872, 1896, 232, 1256, 744, 1768, 488, 1512, 1000, 2024,
+  24, 1048, 536, 1560, 280, 1304, 792, 1816, 152, 1176, 664, 1688,
+  408, 1432, 920, 1944, 88, 1112, 600, 1624, 344, 1368, 856, 1880,
+  216, 1240, 728, 1752, 472, 1496, 984, 2008, 56, 1080, 568, 1592,
+  312, 1336, 824, 1848, 184, 1208, 696, 1720, 440, 1464, 952, 1976,
+  120, 1144, 632, 1656, 376, 1400, 888, 1912, 248, 1272, 760, 1784,
+  504, 1528, 1016, 2040, 4, 1028, 516, 1540, 260, 1284, 772, 1796,
+  132, 1156, 644, 1668, 388, 1412, 900, 1924, 68, 1092, 580, 1604,
+  324, 1348, 836, 1860, 196, 1220, 708, 1732, 452, 1476, 964, 1988,
+  36, 1060, 548, 1572, 292, 1316, 804, 1828, 164, 1188, 676, 1700,
+  420, 1444, 932, 1956, 100, 1124, 612, 1636, 356, 1380, 868, 1892,
+  228, 1252, 740, 1764, 484, 1508, 996, 2020, 20, 1044, 532, 1556,
+  276, 1300, 788, 1812, 148, 1172, 660, 1684, 404, 1428, 916, 1940,
+  84, 1108, 596, 1620, 340, 1364, 852, 1876, 212, 1236, 724, 1748,
+  468, 1492, 980, 2004, 52, 1076, 564, 1588, 308, 1332, 820, 1844,
+  180, 1204, 692, 1716, 436, 1460, 948, 1972, 116, 1140, 628, 1652,
+  372, 1396, 884, 1908, 244, 1268, 756, 1780, 500, 1524, 1012, 2036,
+  12, 1036, 524, 1548, 268, 1292, 780, 1804, 140, 1164, 652, 1676,
+  396, 1420, 908, 1932, 76, 1100, 588, 1612, 332, 1356, 844, 1868,
+  204, 1228, 716, 1740, 460, 1484, 972, 1996, 44, 1068, 556, 1580,
+  300, 1324, 812, 1836, 172, 1196, 684, 1708, 428, 1452, 940, 1964,
+  108, 1132, 620, 1644, 364, 1388, 876, 1900, 236, 1260, 748, 1772,
+  492, 1516, 1004, 2028, 28, 1052, 540, 1564, 284, 1308, 796, 1820,
+  156, 1180, 668, 1692, 412, 1436, 924, 1948, 92, 1116, 604, 1628,
+  348, 1372, 860, 1884, 220, 1244, 732, 1756, 476, 1500, 988, 2012,
+  60, 1084, 572, 1596, 316, 1340, 828, 1852, 188, 1212, 700, 1724,
+  444, 1468, 956, 1980, 124, 1148, 636, 1660, 380, 1404, 892, 1916,
+  252, 1276, 764, 1788, 508, 1532, 1020, 2044, 2, 1026, 514, 1538,
+  258, 1282, 770, 1794, 130, 1154, 642, 1666, 386, 1410, 898, 1922,
+  66, 1090, 578, 1602, 322, 1346, 834, 1858, 194, 1218, 706, 1730,
+  450, 1474, 962, 1986, 34, 1058, 546, 1570, 290, 1314, 802, 1826,
+  162, 1186, 674, 1698, 418, 1442, 930, 1954, 98, 1122, 610, 1634,
+  354, 1378, 866, 1890, 226, 1250, 738, 1762, 482, 1506, 994, 2018,
+  18, 1042, 530, 1554, 274, 1298, 786, 1810, 146, 1170, 658, 1682,
+  402, 1426, 914, 1938, 82, 1106, 594, 1618, 338, 1362, 850, 1874,
+  210, 1234, 722, 1746, 466, 1490, 978, 2002, 50, 1074, 562, 1586,
+  306, 1330, 818, 1842, 178, 1202, 690, 1714, 434, 1458, 946, 1970,
+  114, 1138, 626, 1650, 370, 1394, 882, 1906, 242, 1266, 754, 1778,
+  498, 1522, 1010, 2034, 10, 1034, 522, 1546, 266, 1290, 778, 1802,
+  138, 1162, 650, 1674, 394, 1418, 906, 1930, 74, 1098, 586, 1610,
+  330, 1354, 842, 1866, 202, 1226, 714, 1738, 458, 1482, 970, 1994,
+  42, 1066, 554, 1578, 298, 1322, 810, 1834, 170, 1194, 682, 1706,
+  426, 1450, 938, 1962, 106, 1130, 618, 1642, 362, 1386, 874, 1898,
+  234, 1258, 746, 1770, 490, 1514, 1002, 2026, 26, 1050, 538, 1562,
+  282, 1306, 794, 1818, 154, 1178, 666, 1690, 410, 1434, 922, 1946,
+  90, 1114, 602, 1626, 346, 1370, 858, 1882, 218, 1242, 730, 1754,
+  474, 1498, 986, 2010, 58, 1082, 570, 1594, 314, 1338, 826, 1850,
+  186, 1210, 698, 1722, 442, 1466, 954, 1978, 122, 1146, 634, 1658,
+  378, 1402, 890, 1914, 250, 1274, 762, 1786, 506, 1530, 1018, 2042,
+  6, 1030, 518, 1542, 262, 1286, 774, 1798, 134, 1158, 646, 1670,
+  390, 1414, 902, 1926, 70, 1094, 582, 1606, 326, 1350, 838, 1862,
+  198, 1222, 710, 1734, 454, 1478, 966, 1990, 38, 1062, 550, 1574,
+  294, 1318, 806, 1830, 166, 1190, 678, 1702, 422, 1446, 934, 1958,
+  102, 1126, 614, 1638, 358, 1382, 870, 1894, 230, 1254, 742, 1766,
+  486, 1510, 998, 2022, 22, 1046, 534, 1558, 278, 1302, 790, 1814,
+  150, 1174, 662, 1686, 406, 1430, 918, 1942, 86, 1110, 598, 1622,
+  342, 1366, 854, 1878, 214, 1238, 726, 1750, 470, 1494, 982, 2006,
+  54, 1078, 566, 1590, 310, 1334, 822, 1846, 182, 1206, 694, 1718,
+  438, 1462, 950, 1974, 118, 1142, 630, 1654, 374, 1398, 886, 1910,
+  246, 1270, 758, 1782, 502, 1526, 1014, 2038, 14, 1038, 526, 1550,
+  270, 1294, 782, 1806, 142, 1166, 654, 1678, 398, 1422, 910, 1934,
+  78, 1102, 590, 1614, 334, 1358, 846, 1870, 206, 1230, 718, 1742,
+  462, 1486, 974, 1998, 46, 1070, 558, 1582, 302, 1326, 814, 1838,
+  174, 1198, 686, 1710, 430, 1454, 942, 1966, 110, 1134, 622, 1646,
+  366, 1390, 878, 1902, 238, 1262, 750, 1774, 494, 1518, 1006, 2030,
+  30, 1054, 542, 1566, 286, 1310, 798, 1822, 158, 1182, 670, 1694,
+  414, 1438, 926, 1950, 94, 1118, 606, 1630, 350, 1374, 862, 1886,
+  222, 1246, 734, 1758, 478, 1502, 990, 2014, 62, 1086, 574, 1598,
+  318, 1342, 830, 1854, 190, 1214, 702, 1726, 446, 1470, 958, 1982,
+  126, 1150, 638, 1662, 382, 1406, 894, 1918, 254, 1278, 766, 1790,
+  510, 1534, 1022, 2046, 1, 1025, 513, 1537, 257, 1281, 769, 1793,
+  129, 1153, 641, 1665, 385, 1409, 897, 1921, 65, 1089, 577, 1601,
+  321, 1345, 833, 1857, 193, 1217, 705, 1729, 449, 1473, 961, 1985,
+  33, 1057, 545, 1569, 289, 1313, 801, 1825, 161, 1185, 673, 1697,
+  417, 1441, 929, 1953, 97, 1121, 609, 1633, 353, 1377, 865, 1889,
+  225, 1249, 737, 1761, 481, 1505, 993, 2017, 17, 1041, 529, 1553,
+  273, 1297, 785, 1809, 145, 1169, 657, 1681, 401, 1425, 913, 1937,
+  81, 1105, 593, 1617, 337, 1361, 849, 1873, 209, 1233, 721, 1745,
+  465, 1489, 977, 2001, 49, 1073, 561, 1585, 305, 1329, 817, 1841,
+  177, 1201, 689, 1713, 433, 1457, 945, 1969, 113, 1137, 625, 1649,
+  369, 1393, 881, 1905, 241, 1265, 753, 1777, 497, 1521, 1009, 2033,
+  9, 1033, 521, 1545, 265, 1289, 777, 1801, 137, 1161, 649, 1673,
+  393, 1417, 905, 1929, 73, 1097, 585, 1609, 329, 1353, 841, 1865,
+  201, 1225, 713, 1737, 457, 1481, 969, 1993, 41, 1065, 553, 1577,
+  297, 1321, 809, 1833, 169, 1193, 681, 1705, 425, 1449, 937, 1961,
+  105, 1129, 617, 1641, 361, 1385, 873, 1897, 233, 1257, 745, 1769,
+  489, 1513, 1001, 2025, 25, 1049, 537, 1561, 281, 1305, 793, 1817,
+  153, 1177, 665, 1689, 409, 1433, 921, 1945, 89, 1113, 601, 1625,
+  345, 1369, 857, 1881, 217, 1241, 729, 1753, 473, 1497, 985, 2009,
+  57, 1081, 569, 1593, 313, 1337, 825, 1849, 185, 1209, 697, 1721,
+  441, 1465, 953, 1977, 121, 1145, 633, 1657, 377, 1401, 889, 1913,
+  249, 1273, 761, 1785, 505, 1529, 1017, 2041, 5, 1029, 517, 1541,
+  261, 1285, 773, 1797, 133, 1157, 645, 1669, 389, 1413, 901, 1925,
+  69, 1093, 581, 1605, 325, 1349, 837, 1861, 197, 1221, 709, 1733,
+  453, 1477, 965, 1989, 37, 1061, 549, 1573, 293, 1317, 805, 1829,
+  165, 1189, 677, 1701, 421, 1445, 933, 1957, 101, 1125, 613, 1637,
+  357, 1381, 869, 1893, 229, 1253, 741, 1765, 485, 1509, 997, 2021,
+  21, 1045, 533, 1557, 277, 1301, 789, 1813, 149, 1173, 661, 1685,
+  405, 1429, 917, 1941, 85, 1109, 597, 1621, 341, 1365, 853, 1877,
+  213, 1237, 725, 1749, 469, 1493, 981, 2005, 53, 1077, 565, 1589,
+  309, 1333, 821, 1845, 181, 1205, 693, 1717, 437, 1461, 949, 1973,
+  117, 1141, 629, 1653, 373, 1397, 885, 1909, 245, 1269, 757, 1781,
+  501, 1525, 1013, 2037, 13, 1037, 525, 1549, 269, 1293, 781, 1805,
+  141, 1165, 653, 1677, 397, 1421, 909, 1933, 77, 1101, 589, 1613,
+  333, 1357, 845, 1869, 205, 1229, 717, 1741, 461, 1485, 973, 1997,
+  45, 1069, 557, 1581, 301, 1325, 813, 1837, 173, 1197, 685, 1709,
+  429, 1453, 941, 1965, 109, 1133, 621, 1645, 365, 1389, 877, 1901,
+  237, 1261, 749, 1773, 493, 1517, 1005, 2029, 29, 1053, 541, 1565,
+  285, 1309, 797, 1821, 157, 1181, 669, 1693, 413, 1437, 925, 1949,
+  93, 1117, 605, 1629, 349, 1373, 861, 1885, 221, 1245, 733, 1757,
+  477, 1501, 989, 2013, 61, 1085, 573, 1597, 317, 1341, 829, 1853,
+  189, 1213, 701, 1725, 445, 1469, 957, 1981, 125, 1149, 637, 1661,
+  381, 1405, 893, 1917, 253, 1277, 765, 1789, 509, 1533, 1021, 2045,
+  3, 1027, 515, 1539, 259, 1283, 771, 1795, 131, 1155, 643, 1667,
+  387, 1411, 899, 1923, 67, 1091, 579, 1603, 323, 1347, 835, 1859,
+  195, 1219, 707, 1731, 451, 1475, 963, 1987, 35, 1059, 547, 1571,
+  291, 1315, 803, 1827, 163, 1187, 675, 1699, 419, 1443, 931, 1955,
+  99, 1123, 611, 1635, 355, 1379, 867, 1891, 227, 1251, 739, 1763,
+  483, 1507, 995, 2019, 19, 1043, 531, 1555, 275, 1299, 787, 1811,
+  147, 1171, 659, 1683, 403, 1427, 915, 1939, 83, 1107, 595, 1619,
+  339, 1363, 851, 1875, 211, 1235, 723, 1747, 467, 1491, 979, 2003,
+  51, 1075, 563, 1587, 307, 1331, 819, 1843, 179, 1203, 691, 1715,
+  435, 1459, 947, 1971, 115, 1139, 627, 1651, 371, 1395, 883, 1907,
+  243, 1267, 755, 1779, 499, 1523, 1011, 2035, 11, 1035, 523, 1547,
+  267, 1291, 779, 1803, 139, 1163, 651, 1675, 395, 1419, 907, 1931,
+  75, 1099, 587, 1611, 331, 1355, 843, 1867, 203, 1227, 715, 1739,
+  459, 1483, 971, 1995, 43, 1067, 555, 1579, 299, 1323, 811, 1835,
+  171, 1195, 683, 1707, 427, 1451, 939, 1963, 107, 1131, 619, 1643,
+  363, 1387, 875, 1899, 235, 1259, 747, 1771, 491, 1515, 1003, 2027,
+  27, 1051, 539, 1563, 283, 1307, 795, 1819, 155, 1179, 667, 1691,
+  411, 1435, 923, 1947, 91, 1115, 603, 1627, 347, 1371, 859, 1883,
+  219, 1243, 731, 1755, 475, 1499, 987, 2011, 59, 1083, 571, 1595,
+  315, 1339, 827, 1851, 187, 1211, 699, 1723, 443, 1467, 955, 1979,
+  123, 1147, 635, 1659, 379, 1403, 891, 1915, 251, 1275, 763, 1787,
+  507, 1531, 1019, 2043, 7, 1031, 519, 1543, 263, 1287, 775, 1799,
+  135, 1159, 647, 1671, 391, 1415, 903, 1927, 71, 1095, 583, 1607,
+  327, 1351, 839, 1863, 199, 1223, 711, 1735, 455, 1479, 967, 1991,
+  39, 1063, 551, 1575, 295, 1319, 807, 1831, 167, 1191, 679, 1703,
+  423, 1447, 935, 1959, 103, 1127, 615, 1639, 359, 1383, 871, 1895,
+  231, 1255, 743, 1767, 487, 1511, 999, 2023, 23, 1047, 535, 1559,
+  279, 1303, 791, 1815, 151, 1175, 663, 1687, 407, 1431, 919, 1943,
+  87, 1111, 599, 1623, 343, 1367, 855, 1879, 215, 1239, 727, 1751,
+  471, 1495, 983, 2007, 55, 1079, 567, 1591, 311, 1335, 823, 1847,
+  183, 1207, 695, 1719, 439, 1463, 951, 1975, 119, 1143, 631, 1655,
+  375, 1399, 887, 1911, 247, 1271, 759, 1783, 503, 1527, 1015, 2039,
+  15, 1039, 527, 1551, 271, 1295, 783, 1807, 143, 1167, 655, 1679,
+  399, 1423, 911, 1935, 79, 1103, 591, 1615, 335, 1359, 847, 1871,
+  207, 1231, 719, 1743, 463, 1487, 975, 1999, 47, 1071, 559, 1583,
+  303, 1327, 815, 1839, 175, 1199, 687, 1711, 431, 1455, 943, 1967,
+  111, 1135, 623, 1647, 367, 1391, 879, 1903, 239, 1263, 751, 1775,
+  495, 1519, 1007, 2031, 31, 1055, 543, 1567, 287, 1311, 799, 1823,
+  159, 1183, 671, 1695, 415, 1439, 927, 1951, 95, 1119, 607, 1631,
+  351, 1375, 863, 1887, 223, 1247, 735, 1759, 479, 1503, 991, 2015,
+  63, 1087, 575, 1599, 319, 1343, 831, 1855, 191, 1215, 703, 1727,
+  447, 1471, 959, 1983, 127, 1151, 639, 1663, 383, 1407, 895, 1919,
+  255, 1279, 767, 1791, 511, 1535, 1023, 2047
+};
+
+static const unsigned int fft_static_bitrev_4096[4096] =
+{
+  0, 2048, 1024, 3072, 512, 2560, 1536, 3584, 256, 2304, 1280, 3328,
+  768, 2816, 1792, 3840, 128, 2176, 1152, 3200, 640, 2688, 1664, 3712,
+  384, 2432, 1408, 3456, 896, 2944, 1920, 3968, 64, 2112, 1088, 3136,
+  576, 2624, 1600, 3648, 320, 2368, 1344, 3392, 832, 2880, 1856, 3904,
+  192, 2240, 1216, 3264, 704, 2752, 1728, 3776, 448, 2496, 1472, 3520,
+  960, 3008, 1984, 4032, 32, 2080, 1056, 3104, 544, 2592, 1568, 3616,
+  288, 2336, 1312, 3360, 800, 2848, 1824, 3872, 160, 2208, 1184, 3232,
+  672, 2720, 1696, 3744, 416, 2464, 1440, 3488, 928, 2976, 1952, 4000,
+  96, 2144, 1120, 3168, 608, 2656, 1632, 3680, 352, 2400, 1376, 3424,
+  864, 2912, 1888, 3936, 224, 2272, 1248, 3296, 736, 2784, 1760, 3808,
+  480, 2528, 1504, 3552, 992, 3040, 2016, 4064, 16, 2064, 1040, 3088,
+  528, 2576, 1552, 3600, 272, 2320, 1296, 3344, 784, 2832, 1808, 3856,
+  144, 2192, 1168, 3216, 656, 2704, 1680, 3728, 400, 2448, 1424, 3472,
+  912, 2960, 1936, 3984, 80, 2128, 1104, 3152, 592, 2640, 1616, 3664,
+  336, 2384, 1360, 3408, 848, 2896, 1872, 3920, 208, 2256, 1232, 3280,
+  720, 2768, 1744, 3792, 464, 2512, 1488, 3536, 976, 3024, 2000, 4048,
+  48, 2096, 1072, 3120, 560, 2608, 1584, 3632, 304, 2352, 1328, 3376,
+  816, 2864, 1840, 3888, 176, 2224, 1200, 3248, 688, 2736, 1712, 3760,
+  432, 2480, 1456, 3504, 944, 2992, 1968, 4016, 112, 2160, 1136, 3184,
+  624, 2672, 1648, 3696, 368, 2416, 1392, 3440, 880, 2928, 1904, 3952,
+  240, 2288, 1264, 3312, 752, 2800, 1776, 3824, 496, 2544, 1520, 3568,
+  1008, 3056, 2032, 4080, 8, 2056, 1032, 3080, 520, 2568, 1544, 3592,
+  264, 2312, 1288, 3336, 776, 2824, 1800, 3848, 136, 2184, 1160, 3208,
+  648, 2696, 1672, 3720, 392, 2440, 1416, 3464, 904, 2952, 1928, 3976,
+  72, 2120, 1096, 3144, 584, 2632, 1608, 3656, 328, 2376, 1352, 3400,
+  840, 2888, 1864, 3912, 200, 2248, 1224, 3272, 712, 2760, 1736, 3784,
+  456, 2504, 1480, 3528, 968, 3016, 1992, 4040, 40, 2088, 1064, 3112,
+  552, 2600, 1576, 3624, 296, 2344, 1320, 3368, 808, 2856, 1832, 3880,
+  168, 2216, 1192, 3240, 680, 2728, 1704, 3752, 424, 2472, 1448, 3496,
+  936, 2984, 1960, 4008, 104, 2152, 1128, 3176, 616, 2664, 1640, 3688,
+  360, 2408, 1384, 3432, 872, 2920, 1896, 3944, 232, 2280, 1256, 3304,
+  744, 2792, 1768, 3816, 488, 2536, 1512, 3560, 1000, 3048, 2024, 4072,
+  24, 2072, 1048, 3096, 536, 2584, 1560, 3608, 280, 2328, 1304, 3352,
+  792, 2840, 1816, 3864, 152, 2200, 1176, 3224, 664, 2712, 1688, 3736,
+  408, 2456, 1432, 3480, 920, 2968, 1944, 3992, 88, 2136, 1112, 3160,
+  600, 2648, 1624, 3672, 344, 2392, 1368, 3416, 856, 2904, 1880, 3928,
+  216, 2264, 1240, 3288, 728, 2776, 1752, 3800, 472, 2520, 1496, 3544,
+  984, 3032, 2008, 4056, 56, 2104, 1080, 3128, 568, 2616, 1592, 3640,
+  312, 2360, 1336, 3384, 824, 2872, 1848, 3896, 184, 2232, 1208, 3256,
+  696, 2744, 1720, 3768, 440, 2488, 1464, 3512, 952, 3000, 1976, 4024,
+  120, 2168, 1144, 3192, 632, 2680, 1656, 3704, 376, 2424, 1400, 3448,
+  888, 2936, 1912, 3960, 248, 2296, 1272, 3320, 760, 2808, 1784, 3832,
+  504, 2552, 1528, 3576, 1016, 3064, 2040, 4088, 4, 2052, 1028, 3076,
+  516, 2564, 1540, 3588, 260, 2308, 1284, 3332, 772, 2820, 1796, 3844,
+  132, 2180, 1156, 3204, 644, 2692, 1668, 3716, 388, 2436, 1412, 3460,
+  900, 2948, 1924, 3972, 68, 2116, 1092, 3140, 580, 2628, 1604, 3652,
+  324, 2372, 1348, 3396, 836, 2884, 1860, 3908, 196, 2244, 1220, 3268,
+  708, 2756, 1732, 3780, 452, 2500, 1476, 3524, 964, 3012, 1988, 4036,
+  36, 2084, 1060, 3108, 548, 2596, 1572, 3620, 292, 2340, 1316, 3364,
+  804, 2852, 1828, 3876, 164, 2212, 1188, 3236, 676, 2724, 1700, 3748,
+  420, 2468, 1444, 3492, 932, 2980, 1956, 4004, 100, 2148, 1124, 3172,
+  612, 2660, 1636, 3684, 356, 2404, 1380, 3428, 868, 2916, 1892, 3940,
+  228, 2276, 1252, 3300, 740, 2788, 1764, 3812, 484, 2532, 1508, 3556,
+  996, 3044, 2020, 4068, 20, 2068, 1044, 3092, 532, 2580, 1556, 3604,
+  276, 2324, 1300, 3348, 788, 2836, 1812, 3860, 148, 2196, 1172, 3220,
+  660, 2708, 1684, 3732, 404, 2452, 1428, 3476, 916, 2964, 1940, 3988,
+  84, 2132, 1108, 3156, 596, 2644, 1620, 3668, 340, 2388, 1364, 3412,
+  852, 2900, 1876, 3924, 212, 2260, 1236, 3284, 724, 2772, 1748, 3796,
+  468, 2516, 1492, 3540, 980, 3028, 2004, 4052, 52, 2100, 1076, 3124,
+  564, 2612, 1588, 3636, 308, 2356, 1332, 3380, 820, 2868, 1844, 3892,
+  180, 2228, 1204, 3252, 692, 2740, 1716, 3764, 436, 2484, 1460, 3508,
+  948, 2996, 1972, 4020, 116, 2164, 1140, 3188, 628, 2676, 1652, 3700,
+  372, 2420, 1396, 3444, 884, 2932, 1908, 3956, 244, 2292, 1268, 3316,
+  756, 2804, 1780, 3828, 500, 2548, 1524, 3572, 1012, 3060, 2036, 4084,
+  12, 2060, 1036, 3084, 524, 2572, 1548, 3596, 268, 2316, 1292, 3340,
+  780, 2828, 1804, 3852, 140, 2188, 1164, 3212, 652, 2700, 1676, 3724,
+  396, 2444, 1420, 3468, 908, 2956, 1932, 3980, 76, 2124, 1100, 3148,
+  588, 2636, 1612, 3660, 332, 2380, 1356, 3404, 844, 2892, 1868, 3916,
+  204, 2252, 1228, 3276, 716, 2764, 1740, 3788, 460, 2508, 1484, 3532,
+  972, 3020, 1996, 4044, 44, 2092, 1068, 3116, 556, 2604, 1580, 3628,
+  300, 2348, 1324, 3372, 812, 2860, 1836, 3884, 172, 2220, 1196, 3244,
+  684, 2732, 1708, 3756, 428, 2476, 1452, 3500, 940, 2988, 1964, 4012,
+  108, 2156, 1132, 3180, 620, 2668, 1644, 3692, 364, 2412, 1388, 3436,
+  876, 2924, 1900, 3948, 236, 2284, 1260, 3308, 748, 2796, 1772, 3820,
+  492, 2540, 1516, 3564, 1004, 3052, 2028, 4076, 28, 2076, 1052, 3100,
+  540, 2588, 1564, 3612, 284, 2332, 1308, 3356, 796, 2844, 1820, 3868,
+  156, 2204, 1180, 3228, 668, 2716, 1692, 3740, 412, 2460, 1436, 3484,
+  924, 2972, 1948, 3996, 92, 2140, 1116, 3164, 604, 2652, 1628, 3676,
+  348, 2396, 1372, 3420, 860, 2908, 1884, 3932, 220, 2268, 1244, 3292,
+  732, 2780, 1756, 3804, 476, 2524, 1500, 3548, 988, 3036, 2012, 4060,
+  60, 2108, 1084, 3132, 572, 2620, 1596, 3644, 316, 2364, 1340, 3388,
+  828, 2876, 1852, 3900, 188, 2236, 1212, 3260, 700, 2748, 1724, 3772,
+  444, 2492, 1468, 3516, 956, 3004, 1980, 4028, 124, 2172, 1148, 3196,
+  636, 2684, 1660, 3708, 380, 2428, 1404, 3452, 892, 2940, 1916, 3964,
+  252, 2300, 1276, 3324, 764, 2812, 1788, 3836, 508, 2556, 1532, 3580,
+  1020, 3068, 2044, 4092, 2, 2050, 1026, 3074, 514, 2562, 1538, 3586,
+  258, 2306, 1282, 3330, 770, 2818, 1794, 3842, 130, 2178, 1154, 3202,
+  642, 2690, 1666, 3714, 386, 2434, 1410, 3458, 898, 2946, 1922, 3970,
+  66, 2114, 1090, 3138, 578, 2626, 1602, 3650, 322, 2370, 1346, 3394,
+  834, 2882, 1858, 3906, 194, 2242, 1218, 3266, 706, 2754, 1730, 3778,
+  450, 2498, 1474, 3522, 962, 3010, 1986, 4034, 34, 2082, 1058, 3106,
+  546, 2594, 1570, 3618, 290, 2338, 1314, 3362, 802, 2850, 1826, 3874,
+  162, 2210, 1186, 3234, 674, 2722, 1698, 3746, 418, 2466, 1442, 3490,
+  930, 2978, 1954, 4002, 98, 2146, 1122, 3170, 610, 2658, 1634, 3682,
+  354, 2402, 1378, 3426, 866, 2914, 1890, 3938, 226, 2274, 1250, 3298,
+  738, 2786, 1762, 3810, 482, 2530, 1506, 3554, 994, 3042, 2018, 4066,
+  18, 2066, 1042, 3090, 530, 2578, 1554, 3602, 274, 2322, 1298, 3346,
+  786, 2834, 1810, 3858, 146, 2194, 1170, 3218, 658, 2706, 1682, 3730,
+  402, 2450, 1426, 3474, 914, 2962, 1938, 3986, 82, 2130, 1106, 3154,
+  594, 2642, 1618, 3666, 338, 2386, 1362, 3410, 850, 2898, 1874, 3922,
+  210, 2258, 1234, 3282, 722, 2770, 1746, 3794, 466, 2514, 1490, 3538,
+  978, 3026, 2002, 4050, 50, 2098, 1074, 3122, 562, 2610, 1586, 3634,
+  306, 2354, 1330, 3378, 818, 2866, 1842, 3890, 178, 2226, 1202, 3250,
+  690, 2738, 1714, 3762, 434, 2482, 1458, 3506, 946, 2994, 1970, 4018,
+  114, 2162, 1138, 3186, 626, 2674, 1650, 3698, 370, 2418, 1394, 3442,
+  882, 2930, 1906, 3954, 242, 2290, 1266, 3314, 754, 2802, 1778, 3826,
+  498, 2546, 1522, 3570, 1010, 3058, 2034, 4082, 10, 2058, 1034, 3082,
+  522, 2570, 1546, 3594, 266, 2314, 1290, 3338, 778, 2826, 1802, 3850,
+  138, 2186, 1162, 3210, 650, 2698, 1674, 3722, 394, 2442, 1418, 3466,
+  906, 2954, 1930, 3978, 74, 2122, 1098, 3146, 586, 2634, 1610, 3658,
+  330, 2378, 1354, 3402, 842, 2890, 1866, 3914, 202, 2250, 1226, 3274,
+  714, 2762, 1738, 3786, 458, 2506, 1482, 3530, 970, 3018, 1994, 4042,
+  42, 2090, 1066, 3114, 554, 2602, 1578, 3626, 298, 2346, 1322, 3370,
+  810, 2858, 1834, 3882, 170, 2218, 1194, 3242, 682, 2730, 1706, 3754,
+  426, 2474, 1450, 3498, 938, 2986, 1962, 4010, 106, 2154, 1130, 3178,
+  618, 2666, 1642, 3690, 362, 2410, 1386, 3434, 874, 2922, 1898, 3946,
+  234, 2282, 1258, 3306, 746, 2794, 1770, 3818, 490, 2538, 1514, 3562,
+  1002, 3050, 2026, 4074, 26, 2074, 1050, 3098, 538, 2586, 1562, 3610,
+  282, 2330, 1306, 3354, 794, 2842, 1818, 3866, 154, 2202, 1178, 3226,
+  666, 2714, 1690, 3738, 410, 2458, 1434, 3482, 922, 2970, 1946, 3994,
+  90, 2138, 1114, 3162, 602, 2650, 1626, 3674, 346, 2394, 1370, 3418,
+  858, 2906, 1882, 3930, 218, 2266, 1242, 3290, 730, 2778, 1754, 3802,
+  474, 2522, 1498, 3546, 986, 3034, 2010, 4058, 58, 2106, 1082, 3130,
+  570, 2618, 1594, 3642, 314, 2362, 1338, 3386, 826, 2874, 1850, 3898,
+  186, 2234, 1210, 3258, 698, 2746, 1722, 3770, 442, 2490, 1466, 3514,
+  954, 3002, 1978, 4026, 122, 2170, 1146, 3194, 634, 2682, 1658, 3706,
+  378, 2426, 1402, 3450, 890, 2938, 1914, 3962, 250, 2298, 1274, 3322,
+  762, 2810, 1786, 3834, 506, 2554, 1530, 3578, 1018, 3066, 2042, 4090,
+  6, 2054, 1030, 3078, 518, 2566, 1542, 3590, 262, 2310, 1286, 3334,
+  774, 2822, 1798, 3846, 134, 2182, 1158, 3206, 646, 2694, 1670, 3718,
+  390, 2438, 1414, 3462, 902, 2950, 1926, 3974, 70, 2118, 1094, 3142,
+  582, 2630, 1606, 3654, 326, 2374, 1350, 3398, 838, 2886, 1862, 3910,
+  198, 2246, 1222, 3270, 710, 2758, 1734, 3782, 454, 2502, 1478, 3526,
+  966, 3014, 1990, 4038, 38, 2086, 1062, 3110, 550, 2598, 1574, 3622,
+  294, 2342, 1318, 3366, 806, 2854, 1830, 3878, 166, 2214, 1190, 3238,
+  678, 2726, 1702, 3750, 422, 2470, 1446, 3494, 934, 2982, 1958, 4006,
+  102, 2150, 1126, 3174, 614, 2662, 1638, 3686, 358, 2406, 1382, 3430,
+  870, 2918, 1894, 3942, 230, 2278, 1254, 3302, 742, 2790, 1766, 3814,
+  486, 2534, 1510, 3558, 998, 3046, 2022, 4070, 22, 2070, 1046, 3094,
+  534, 2582, 1558, 3606, 278, 2326, 1302, 3350, 790, 2838, 1814, 3862,
+  150, 2198, 1174, 3222, 662, 2710, 1686, 3734, 406, 2454, 1430, 3478,
+  918, 2966, 1942, 3990, 86, 2134, 1110, 3158, 598, 2646, 1622, 3670,
+  342, 2390, 1366, 3414, 854, 2902, 1878, 3926, 214, 2262, 1238, 3286,
+  726, 2774, 1750, 3798, 470, 2518, 1494, 3542, 982, 3030, 2006, 4054,
+  54, 2102, 1078, 3126, 566, 2614, 1590, 3638, 310, 2358, 1334, 3382,
+  822, 2870, 1846, 3894, 182, 2230, 1206, 3254, 694, 2742, 1718, 3766,
+  438, 2486, 1462, 3510, 950, 2998, 1974, 4022, 118, 2166, 1142, 3190,
+  630, 2678, 1654, 3702, 374, 2422, 1398, 3446, 886, 2934, 1910, 3958,
+  246, 2294, 1270, 3318, 758, 2806, 1782, 3830, 502, 2550, 1526, 3574,
+  1014, 3062, 2038, 4086, 14, 2062, 1038, 3086, 526, 2574, 1550, 3598,
+  270, 2318, 1294, 3342, 782, 2830, 1806, 3854, 142, 2190, 1166, 3214,
+  654, 2702, 1678, 3726, 398, 2446, 1422, 3470, 910, 2958, 1934, 3982,
+  78, 2126, 1102, 3150, 590, 2638, 1614, 3662, 334, 2382, 1358, 3406,
+  846, 2894, 1870, 3918, 206, 2254, 1230, 3278, 718, 2766, 1742, 3790,
+  462, 2510, 1486, 3534, 974, 3022, 1998, 4046, 46, 2094, 1070, 3118,
+  558, 2606, 1582, 3630, 302, 2350, 1326, 3374, 814, 2862, 1838, 3886,
+  174, 2222, 1198, 3246, 686, 2734, 1710, 3758, 430, 2478, 1454, 3502,
+  942, 2990, 1966, 4014, 110, 2158, 1134, 3182, 622, 2670, 1646, 3694,
+  366, 2414, 1390, 3438, 878, 2926, 1902, 3950, 238, 2286, 1262, 3310,
+  750, 2798, 1774, 3822, 494, 2542, 1518, 3566, 1006, 3054, 2030, 4078,
+  30, 2078, 1054, 3102, 542, 2590, 1566, 3614, 286, 2334, 1310, 3358,
+  798, 2846, 1822, 3870, 158, 2206, 1182, 3230, 670, 2718, 1694, 3742,
+  414, 2462, 1438, 3486, 926, 2974, 1950, 3998, 94, 2142, 1118, 3166,
+  606, 2654, 1630, 3678, 350, 2398, 1374, 3422, 862, 2910, 1886, 3934,
+  222, 2270, 1246, 3294, 734, 2782, 1758, 3806, 478, 2526, 1502, 3550,
+  990, 3038, 2014, 4062, 62, 2110, 1086, 3134, 574, 2622, 1598, 3646,
+  318, 2366, 1342, 3390, 830, 2878, 1854, 3902, 190, 2238, 1214, 3262,
+  702, 2750, 1726, 3774, 446, 2494, 1470, 3518, 958, 3006, 1982, 4030,
+  126, 2174, 1150, 3198, 638, 2686, 1662, 3710, 382, 2430, 1406, 3454,
+  894, 2942, 1918, 3966, 254, 2302, 1278, 3326, 766, 2814, 1790, 3838,
+  510, 2558, 1534, 3582, 1022, 3070, 2046, 4094, 1, 2049, 1025, 3073,
+  513, 2561, 1537, 3585, 257, 2305, 1281, 3329, 769, 2817, 1793, 3841,
+  129, 2177, 1153, 3201, 641, 2689, 1665, 3713, 385, 2433, 1409, 3457,
+  897, 2945, 1921, 3969, 65, 2113, 1089, 3137, 577, 2625, 1601, 3649,
+  321, 2369, 1345, 3393, 833, 2881, 1857, 3905, 193, 2241, 1217, 3265,
+  705, 2753, 1729, 3777, 449, 2497, 1473, 3521, 961, 3009, 1985, 4033,
+  33, 2081, 1057, 3105, 545, 2593, 1569, 3617, 289, 2337, 1313, 3361,
+  801, 2849, 1825, 3873, 161, 2209, 1185, 3233, 673, 2721, 1697, 3745,
+  417, 2465, 1441, 3489, 929, 2977, 1953, 4001, 97, 2145, 1121, 3169,
+  609, 2657, 1633, 3681, 353, 2401, 1377, 3425, 865, 2913, 1889, 3937,
+  225, 2273, 1249, 3297, 737, 2785, 1761, 3809, 481, 2529, 1505, 3553,
+  993, 3041, 2017, 4065, 17, 2065, 1041, 3089, 529, 2577, 1553, 3601,
+  273, 2321, 1297, 3345, 785, 2833, 1809, 3857, 145, 2193, 1169, 3217,
+  657, 2705, 1681, 3729, 401, 2449, 1425, 3473, 913, 2961, 1937, 3985,
+  81, 2129, 1105, 3153, 593, 2641, 1617, 3665, 337, 2385, 1361, 3409,
+  849, 2897, 1873, 3921, 209, 2257, 1233, 3281, 721, 2769, 1745, 3793,
+  465, 2513, 1489, 3537, 977, 3025, 2001, 4049, 49, 2097, 1073, 3121,
+  561, 2609, 1585, 3633, 305, 2353, 1329, 3377, 817, 2865, 1841, 3889,
+  177, 2225, 1201, 3249, 689, 2737, 1713, 3761, 433, 2481, 1457, 3505,
+  945, 2993, 1969, 4017, 113, 2161, 1137, 3185, 625, 2673, 1649, 3697,
+  369, 2417, 1393, 3441, 881, 2929, 1905, 3953, 241, 2289, 1265, 3313,
+  753, 2801, 1777, 3825, 497, 2545, 1521, 3569, 1009, 3057, 2033, 4081,
+  9, 2057, 1033, 3081, 521, 2569, 1545, 3593, 265, 2313, 1289, 3337,
+  777, 2825, 1801, 3849, 137, 2185, 1161, 3209, 649, 2697, 1673, 3721,
+  393, 2441, 1417, 3465, 905, 2953, 1929, 3977, 73, 2121, 1097, 3145,
+  585, 2633, 1609, 3657, 329, 2377, 1353, 3401, 841, 2889, 1865, 3913,
+  201, 2249, 1225, 3273, 713, 2761, 1737, 3785, 457, 2505, 1481, 3529,
+  969, 3017, 1993, 4041, 41, 2089, 1065, 3113, 553, 2601, 1577, 3625,
+  297, 2345, 1321, 3369, 809, 2857, 1833, 3881, 169, 2217, 1193, 3241,
+  681, 2729, 1705, 3753, 425, 2473, 1449, 3497, 937, 2985, 1961, 4009,
+  105, 2153, 1129, 3177, 617, 2665, 1641, 3689, 361, 2409, 1385, 3433,
+  873, 2921, 1897, 3945, 233, 2281, 1257, 3305, 745, 2793, 1769, 3817,
+  489, 2537, 1513, 3561, 1001, 3049, 2025, 4073, 25, 2073, 1049, 3097,
+  537, 2585, 1561, 3609, 281, 2329, 1305, 3353, 793, 2841, 1817, 3865,
+  153, 2201, 1177, 3225, 665, 2713, 1689, 3737, 409, 2457, 1433, 3481,
+  921, 2969, 1945, 3993, 89, 2137, 1113, 3161, 601, 2649, 1625, 3673,
+  345, 2393, 1369, 3417, 857, 2905, 1881, 3929, 217, 2265, 1241, 3289,
+  729, 2777, 1753, 3801, 473, 2521, 1497, 3545, 985, 3033, 2009, 4057,
+  57, 2105, 1081, 3129, 569, 2617, 1593, 3641, 313, 2361, 1337, 3385,
+  825, 2873, 1849, 3897, 185, 2233, 1209, 3257, 697, 2745, 1721, 3769,
+  441, 2489, 1465, 3513, 953, 3001, 1977, 4025, 121, 2169, 1145, 3193,
+  633, 2681, 1657, 3705, 377, 2425, 1401, 3449, 889, 2937, 1913, 3961,
+  249, 2297, 1273, 3321, 761, 2809, 1785, 3833, 505, 2553, 1529, 3577,
+  1017, 3065, 2041, 4089, 5, 2053, 1029, 3077, 517, 2565, 1541, 3589,
+  261, 2309, 1285, 3333, 773, 2821, 1797, 3845, 133, 2181, 1157, 3205,
+  645, 2693, 1669, 3717, 389, 2437, 1413, 3461, 901, 2949, 1925, 3973,
+  69, 2117, 1093, 3141, 581, 2629, 1605, 3653, 325, 2373, 1349, 3397,
+  837, 2885, 1861, 3909, 197, 2245, 1221, 3269, 709, 2757, 1733, 3781,
+  453, 2501, 1477, 3525, 965, 3013, 1989, 4037, 37, 2085, 1061, 3109,
+  549, 2597, 1573, 3621, 293, 2341, 1317, 3365, 805, 2853, 1829, 3877,
+  165, 2213, 1189, 3237, 677, 2725, 1701, 3749, 421, 2469, 1445, 3493,
+  933, 2981, 1957, 4005, 101, 2149, 1125, 3173, 613, 2661, 1637, 3685,
+  357, 2405, 1381, 3429, 869, 2917, 1893, 3941, 229, 2277, 1253, 3301,
+  741, 2789, 1765, 3813, 485, 2533, 1509, 3557, 997, 3045, 2021, 4069,
+  21, 2069, 1045, 3093, 533, 2581, 1557, 3605, 277, 2325, 1301, 3349,
+  789, 2837, 1813, 3861, 149, 2197, 1173, 3221, 661, 2709, 1685, 3733,
+  405, 2453, 1429, 3477, 917, 2965, 1941, 3989, 85, 2133, 1109, 3157,
+  597, 2645, 1621, 3669, 341, 2389, 1365, 3413, 853, 2901, 1877, 3925,
+  213, 2261, 1237, 3285, 725, 2773, 1749, 3797, 469, 2517, 1493, 3541,
+  981, 3029, 2005, 4053, 53, 2101, 1077, 3125, 565, 2613, 1589, 3637,
+  309, 2357, 1333, 3381, 821, 2869, 1845, 3893, 181, 2229, 1205, 3253,
+  693, 2741, 1717, 3765, 437, 2485, 1461, 3509, 949, 2997, 1973, 4021,
+  117, 2165, 1141, 3189, 629, 2677, 1653, 3701, 373, 2421, 1397, 3445,
+  885, 2933, 1909, 3957, 245, 2293, 1269, 3317, 757, 2805, 1781, 3829,
+  501, 2549, 1525, 3573, 1013, 3061, 2037, 4085, 13, 2061, 1037, 3085,
+  525, 2573, 1549, 3597, 269, 2317, 1293, 3341, 781, 2829, 1805, 3853,
+  141, 2189, 1165, 3213, 653, 2701, 1677, 3725, 397, 2445, 1421, 3469,
+  909, 2957, 1933, 3981, 77, 2125, 1101, 3149, 589, 2637, 1613, 3661,
+  333, 2381, 1357, 3405, 845, 2893, 1869, 3917, 205, 2253, 1229, 3277,
+  717, 2765, 1741, 3789, 461, 2509, 1485, 3533, 973, 3021, 1997, 4045,
+  45, 2093, 1069, 3117, 557, 2605, 1581, 3629, 301, 2349, 1325, 3373,
+  813, 2861, 1837, 3885, 173, 2221, 1197, 3245, 685, 2733, 1709, 3757,
+  429, 2477, 1453, 3501, 941, 2989, 1965, 4013, 109, 2157, 1133, 3181,
+  621, 2669, 1645, 3693, 365, 2413, 1389, 3437, 877, 2925, 1901, 3949,
+  237, 2285, 1261, 3309, 749, 2797, 1773, 3821, 493, 2541, 1517, 3565,
+  1005, 3053, 2029, 4077, 29, 2077, 1053, 3101, 541, 2589, 1565, 3613,
+  285, 2333, 1309, 3357, 797, 2845, 1821, 3869, 157, 2205, 1181, 3229,
+  669, 2717, 1693, 3741, 413, 2461, 1437, 3485, 925, 2973, 1949, 3997,
+  93, 2141, 1117, 3165, 605, 2653, 1629, 3677, 349, 2397, 1373, 3421,
+  861, 2909, 1885, 3933, 221, 2269, 1245, 3293, 733, 2781, 1757, 3805,
+  477, 2525, 1501, 3549, 989, 3037, 2013, 4061, 61, 2109, 1085, 3133,
+  573, 2621, 1597, 3645, 317, 2365, 1341, 3389, 829, 2877, 1853, 3901,
+  189, 2237, 1213, 3261, 701, 2749, 1725, 3773, 445, 2493, 1469, 3517,
+  957, 3005, 1981, 4029, 125, 2173, 1149, 3197, 637, 2685, 1661, 3709,
+  381, 2429, 1405, 3453, 893, 2941, 1917, 3965, 253, 2301, 1277, 3325,
+  765, 2813, 1789, 3837, 509, 2557, 1533, 3581, 1021, 3069, 2045, 4093,
+  3, 2051, 1027, 3075, 515, 2563, 1539, 3587, 259, 2307, 1283, 3331,
+  771, 2819, 1795, 3843, 131, 2179, 1155, 3203, 643, 2691, 1667, 3715,
+  387, 2435, 1411, 3459, 899, 2947, 1923, 3971, 67, 2115, 1091, 3139,
+  579, 2627, 1603, 3651, 323, 2371, 1347, 3395, 835, 2883, 1859, 3907,
+  195, 2243, 1219, 3267, 707, 2755, 1731, 3779, 451, 2499, 1475, 3523,
+  963, 3011, 1987, 4035, 35, 2083, 1059, 3107, 547, 2595, 1571, 3619,
+  291, 2339, 1315, 3363, 803, 2851, 1827, 3875, 163, 2211, 1187, 3235,
+  675, 2723, 1699, 3747, 419, 2467, 1443, 3491, 931, 2979, 1955, 4003,
+  99, 2147, 1123, 3171, 611, 2659, 1635, 3683, 355, 2403, 1379, 3427,
+  867, 2915, 1891, 3939, 227, 2275, 1251, 3299, 739, 2787, 1763, 3811,
+  483, 2531, 1507, 3555, 995, 3043, 2019, 4067, 19, 2067, 1043, 3091,
+  531, 2579, 1555, 3603, 275, 2323, 1299, 3347, 787, 2835, 1811, 3859,
+  147, 2195, 1171, 3219, 659, 2707, 1683, 3731, 403, 2451, 1427, 3475,
+  915, 2963, 1939, 3987, 83, 2131, 1107, 3155, 595, 2643, 1619, 3667,
+  339, 2387, 1363, 3411, 851, 2899, 1875, 3923, 211, 2259, 1235, 3283,
+  723, 2771, 1747, 3795, 467, 2515, 1491, 3539, 979, 3027, 2003, 4051,
+  51, 2099, 1075, 3123, 563, 2611, 1587, 3635, 307, 2355, 1331, 3379,
+  819, 2867, 1843, 3891, 179, 2227, 1203, 3251, 691, 2739, 1715, 3763,
+  435, 2483, 1459, 3507, 947, 2995, 1971, 4019, 115, 2163, 1139, 3187,
+  627, 2675, 1651, 3699, 371, 2419, 1395, 3443, 883, 2931, 1907, 3955,
+  243, 2291, 1267, 3315, 755, 2803, 1779, 3827, 499, 2547, 1523, 3571,
+  1011, 3059, 2035, 4083, 11, 2059, 1035, 3083, 523, 2571, 1547, 3595,
+  267, 2315, 1291, 3339, 779, 2827, 1803, 3851, 139, 2187, 1163, 3211,
+  651, 2699, 1675, 3723, 395, 2443, 1419, 3467, 907, 2955, 1931, 3979,
+  75, 2123, 1099, 3147, 587, 2635, 1611, 3659, 331, 2379, 1355, 3403,
+  843, 2891, 1867, 3915, 203, 2251, 1227, 3275, 715, 2763, 1739, 3787,
+  459, 2507, 1483, 3531, 971, 3019, 1995, 4043, 43, 2091, 1067, 3115,
+  555, 2603, 1579, 3627, 299, 2347, 1323, 3371, 811, 2859, 1835, 3883,
+  171, 2219, 1195, 3243, 683, 2731, 1707, 3755, 427, 2475, 1451, 3499,
+  939, 2987, 1963, 4011, 107, 2155, 1131, 3179, 619, 2667, 1643, 3691,
+  363, 2411, 1387, 3435, 875, 2923, 1899, 3947, 235, 2283, 1259, 3307,
+  747, 2795, 1771, 3819, 491, 2539, 1515, 3563, 1003, 3051, 2027, 4075,
+  27, 2075, 1051, 3099, 539, 2587, 1563, 3611, 283, 2331, 1307, 3355,
+  795, 2843, 1819, 3867, 155, 2203, 1179, 3227, 667, 2715, 1691, 3739,
+  411, 2459, 1435, 3483, 923, 2971, 1947, 3995, 91, 2139, 1115, 3163,
+  603, 2651, 1627, 3675, 347, 2395, 1371, 3419, 859, 2907, 1883, 3931,
+  219, 2267, 1243, 3291, 731, 2779, 1755, 3803, 475, 2523, 1499, 3547,
+  987, 3035, 2011, 4059, 59, 2107, 1083, 3131, 571, 2619, 1595, 3643,
+  315, 2363, 1339, 3387, 827, 2875, 1851, 3899, 187, 2235, 1211, 3259,
+  699, 2747, 1723, 3771, 443, 2491, 1467, 3515, 955, 3003, 1979, 4027,
+  123, 2171, 1147, 3195, 635, 2683, 1659, 3707, 379, 2427, 1403, 3451,
+  891, 2939, 1915, 3963, 251, 2299, 1275, 3323, 763, 2811, 1787, 3835,
+  507, 2555, 1531, 3579, 1019, 3067, 2043, 4091, 7, 2055, 1031, 3079,
+  519, 2567, 1543, 3591, 263, 2311, 1287, 3335, 775, 2823, 1799, 3847,
+  135, 2183, 1159, 3207, 647, 2695, 1671, 3719, 391, 2439, 1415, 3463,
+  903, 2951, 1927, 3975, 71, 2119, 1095, 3143, 583, 2631, 1607, 3655,
+  327, 2375, 1351, 3399, 839, 2887, 1863, 3911, 199, 2247, 1223, 3271,
+  711, 2759, 1735, 3783, 455, 2503, 1479, 3527, 967, 3015, 1991, 4039,
+  39, 2087, 1063, 3111, 551, 2599, 1575, 3623, 295, 2343, 1319, 3367,
+  807, 2855, 1831, 3879, 167, 2215, 1191, 3239, 679, 2727, 1703, 3751,
+  423, 2471, 1447, 3495, 935, 2983, 1959, 4007, 103, 2151, 1127, 3175,
+  615, 2663, 1639, 3687, 359, 2407, 1383, 3431, 871, 2919, 1895, 3943,
+  231, 2279, 1255, 3303, 743, 2791, 1767, 3815, 487, 2535, 1511, 3559,
+  999, 3047, 2023, 4071, 23, 2071, 1047, 3095, 535, 2583, 1559, 3607,
+  279, 2327, 1303, 3351, 791, 2839, 1815, 3863, 151, 2199, 1175, 3223,
+  663, 2711, 1687, 3735, 407, 2455, 1431, 3479, 919, 2967, 1943, 3991,
+  87, 2135, 1111, 3159, 599, 2647, 1623, 3671, 343, 2391, 1367, 3415,
+  855, 2903, 1879, 3927, 215, 2263, 1239, 3287, 727, 2775, 1751, 3799,
+  471, 2519, 1495, 3543, 983, 3031, 2007, 4055, 55, 2103, 1079, 3127,
+  567, 2615, 1591, 3639, 311, 2359, 1335, 3383, 823, 2871, 1847, 3895,
+  183, 2231, 1207, 3255, 695, 2743, 1719, 3767, 439, 2487, 1463, 3511,
+  951, 2999, 1975, 4023, 119, 2167, 1143, 3191, 631, 2679, 1655, 3703,
+  375, 2423, 1399, 3447, 887, 2935, 1911, 3959, 247, 2295, 1271, 3319,
+  759, 2807, 1783, 3831, 503, 2551, 1527, 3575, 1015, 3063, 2039, 4087,
+  15, 2063, 1039, 3087, 527, 2575, 1551, 3599, 271, 2319, 1295, 3343,
+  783, 2831, 1807, 3855, 143, 2191, 1167, 3215, 655, 2703, 1679, 3727,
+  399, 2447, 1423, 3471, 911, 2959, 1935, 3983, 79, 2127, 1103, 3151,
+  591, 2639, 1615, 3663, 335, 2383, 1359, 3407, 847, 2895, 1871, 3919,
+  207, 2255, 1231, 3279, 719, 2767, 1743, 3791, 463, 2511, 1487, 3535,
+  975, 3023, 1999, 4047, 47, 2095, 1071, 3119, 559, 2607, 1583, 3631,
+  303, 2351, 1327, 3375, 815, 2863, 1839, 3887, 175, 2223, 1199, 3247,
+  687, 2735, 1711, 3759, 431, 2479, 1455, 3503, 943, 2991, 1967, 4015,
+  111, 2159, 1135, 3183, 623, 2671, 1647, 3695, 367, 2415, 1391, 3439,
+  879, 2927, 1903, 3951, 239, 2287, 1263, 3311, 751, 2799, 1775, 3823,
+  495, 2543, 1519, 3567, 1007, 3055, 2031, 4079, 31, 2079, 1055, 3103,
+  543, 2591, 1567, 3615, 287, 2335, 1311, 3359, 799, 2847, 1823, 3871,
+  159, 2207, 1183, 3231, 671, 2719, 1695, 3743, 415, 2463, 1439, 3487,
+  927, 2975, 1951, 3999, 95, 2143, 1119, 3167, 607, 2655, 1631, 3679,
+  351, 2399, 1375, 3423, 863, 2911, 1887, 3935, 223, 2271, 1247, 3295,
+  735, 2783, 1759, 3807, 479, 2527, 1503, 3551, 991, 3039, 2015, 4063,
+  63, 2111, 1087, 3135, 575, 2623, 1599, 3647, 319, 2367, 1343, 3391,
+  831, 2879, 1855, 3903, 191, 2239, 1215, 3263, 703, 2751, 1727, 3775,
+  447, 2495, 1471, 3519, 959, 3007, 1983, 4031, 127, 2175, 1151, 3199,
+  639, 2687, 1663, 3711, 383, 2431, 1407, 3455, 895, 2943, 1919, 3967,
+  255, 2303, 1279, 3327, 767, 2815, 1791, 3839, 511, 2559, 1535, 3583,
+  1023, 3071, 2047, 4095
+};
+
+static const unsigned int fft_static_bitrev_8192[8192] =
+{
+  0, 4096, 2048, 6144, 1024, 5120, 3072, 7168, 512, 4608, 2560, 6656,
+  1536, 5632, 3584, 7680, 256, 4352, 2304, 6400, 1280, 5376, 3328, 7424,
+  768, 4864, 2816, 6912, 1792, 5888, 3840, 7936, 128, 4224, 2176, 6272,
+  1152, 5248, 3200, 7296, 640, 4736, 2688, 6784, 1664, 5760, 3712, 7808,
+  384, 4480, 2432, 6528, 1408, 5504, 3456, 7552, 896, 4992, 2944, 7040,
+  1920, 6016, 3968, 8064, 64, 4160, 2112, 6208, 1088, 5184, 3136, 7232,
+  576, 4672, 2624, 6720, 1600, 5696, 3648, 7744, 320, 4416, 2368, 6464,
+  1344, 5440, 3392, 7488, 832, 4928, 2880, 6976, 1856, 5952, 3904, 8000,
+  192, 4288, 2240, 6336, 1216, 5312, 3264, 7360, 704, 4800, 2752, 6848,
+  1728, 5824, 3776, 7872, 448, 4544, 2496, 6592, 1472, 5568, 3520, 7616,
+  960, 5056, 3008, 7104, 1984, 6080, 4032, 8128, 32, 4128, 2080, 6176,
+  1056, 5152, 3104, 7200, 544, 4640, 2592, 6688, 1568, 5664, 3616, 7712,
+  288, 4384, 2336, 6432, 1312, 5408, 3360, 7456, 800, 4896, 2848, 6944,
+  1824, 5920, 3872, 7968, 160, 4256, 2208, 6304, 1184, 5280, 3232, 7328,
+  672, 4768, 2720, 6816, 1696, 5792, 3744, 7840, 416, 4512, 2464, 6560,
+  1440, 5536, 3488, 7584, 928, 5024, 2976, 7072, 1952, 6048, 4000, 8096,
+  96, 4192, 2144, 6240, 1120, 5216, 3168, 7264, 608, 4704, 2656, 6752,
+  1632, 5728, 3680, 7776, 352, 4448, 2400, 6496, 1376, 5472, 3424, 7520,
+  864, 4960, 2912, 7008, 1888, 5984, 3936, 8032, 224, 4320, 2272, 6368,
+  1248, 5344, 3296, 7392, 736, 4832, 2784, 6880, 1760, 5856, 3808, 7904,
+  480, 4576, 2528, 6624, 1504, 5600, 3552, 7648, 992, 5088, 3040, 7136,
+  2016, 6112, 4064, 8160, 16, 4112, 2064, 6160, 1040, 5136, 3088, 7184,
+  528, 4624, 2576, 6672, 1552, 5648, 3600, 7696, 272, 4368, 2320, 6416,
+  1296, 5392, 3344, 7440, 784, 4880, 2832, 6928, 1808, 5904, 3856, 7952,
+  144, 4240, 2192, 6288, 1168, 5264, 3216, 7312, 656, 4752, 2704, 6800,
+  1680, 5776, 3728, 7824, 400, 4496, 2448, 6544, 1424, 5520, 3472, 7568,
+  912, 5008, 2960, 7056, 1936, 6032, 3984, 8080, 80, 4176, 2128, 6224,
+  1104, 5200, 3152, 7248, 592, 4688, 2640, 6736, 1616, 5712, 3664, 7760,
+  336, 4432, 2384, 6480, 1360, 5456, 3408, 7504, 848, 4944, 2896, 6992,
+  1872, 5968, 3920, 8016, 208, 4304, 2256, 6352, 1232, 5328, 3280, 7376,
+  720, 4816, 2768, 6864, 1744, 5840, 3792, 7888, 464, 4560, 2512, 6608,
+  1488, 5584, 3536, 7632, 976, 5072, 3024, 7120, 2000, 6096, 4048, 8144,
+  48, 4144, 2096, 6192, 1072, 5168, 3120, 7216, 560, 4656, 2608, 6704,
+  1584, 5680, 3632, 7728, 304, 4400, 2352, 6448, 1328, 5424, 3376, 7472,
+  816, 4912, 2864, 6960, 1840, 5936, 3888, 7984, 176, 4272, 2224, 6320,
+  1200, 5296, 3248, 7344, 688, 4784, 2736, 6832, 1712, 5808, 3760, 7856,
+  432, 4528, 2480, 6576, 1456, 5552, 3504, 7600, 944, 5040, 2992, 7088,
+  1968, 6064, 4016, 8112, 112, 4208, 2160, 6256, 1136, 5232, 3184, 7280,
+  624, 4720, 2672, 6768, 1648, 5744, 3696, 7792, 368, 4464, 2416, 6512,
+  1392, 5488, 3440, 7536, 880, 4976, 2928, 7024, 1904, 6000, 3952, 8048,
+  240, 4336, 2288, 6384, 1264, 5360, 3312, 7408, 752, 4848, 2800, 6896,
+  1776, 5872, 3824, 7920, 496, 4592, 2544, 6640, 1520, 5616, 3568, 7664,
+  1008, 5104, 3056, 7152, 2032, 6128, 4080, 8176, 8, 4104, 2056, 6152,
+  1032, 5128, 3080, 7176, 520, 4616, 2568, 6664, 1544, 5640, 3592, 7688,
+  264, 4360, 2312, 6408, 1288, 5384, 3336, 7432, 776, 4872, 2824, 6920,
+  1800, 5896, 3848, 7944, 136, 4232, 2184, 6280, 1160, 5256, 3208, 7304,
+  648, 4744, 2696, 6792, 1672, 5768, 3720, 7816, 392, 4488, 2440, 6536,
+  1416, 5512, 3464, 7560, 904, 5000, 2952, 7048, 1928, 6024, 3976, 8072,
+  72, 4168, 2120, 6216, 1096, 5192, 3144, 7240, 584, 4680, 2632, 6728,
+  1608, 5704, 3656, 7752, 328, 4424, 2376, 6472, 1352, 5448, 3400, 7496,
+  840, 4936, 2888, 6984, 1864, 5960, 3912, 8008, 200, 4296, 2248, 6344,
+  1224, 5320, 3272, 7368, 712, 4808, 2760, 6856, 1736, 5832, 3784, 7880,
+  456, 4552, 2504, 6600, 1480, 5576, 3528, 7624, 968, 5064, 3016, 7112,
+  1992, 6088, 4040, 8136, 40, 4136, 2088, 6184, 1064, 5160, 3112, 7208,
+  552, 4648, 2600, 6696, 1576, 5672, 3624, 7720, 296, 4392, 2344, 6440,
+  1320, 5416, 3368, 7464, 808, 4904, 2856, 6952, 1832, 5928, 3880, 7976,
+  168, 4264, 2216, 6312, 1192, 5288, 3240, 7336, 680, 4776, 2728, 6824,
+  1704, 5800, 3752, 7848, 424, 4520, 2472, 6568, 1448, 5544, 3496, 7592,
+  936, 5032, 2984, 7080, 1960, 6056, 4008, 8104, 104, 4200, 2152, 6248,
+  1128, 5224, 3176, 7272, 616, 4712, 2664, 6760, 1640, 5736, 3688, 7784,
+  360, 4456, 2408, 6504, 1384, 5480, 3432, 7528, 872, 4968, 2920, 7016,
+  1896, 5992, 3944, 8040, 232, 4328, 2280, 6376, 1256, 5352, 3304, 7400,
+  744, 4840, 2792, 6888, 1768, 5864, 3816, 7912, 488, 4584, 2536, 6632,
+  1512, 5608, 3560, 7656, 1000, 5096, 3048, 7144, 2024, 6120, 4072, 8168,
+  24, 4120, 2072, 6168, 1048, 5144, 3096, 7192, 536, 4632, 2584, 6680,
+  1560, 5656, 3608, 7704, 280, 4376, 2328, 6424, 1304, 5400, 3352, 7448,
+  792, 4888, 2840, 6936, 1816, 5912, 3864, 7960, 152, 4248, 2200, 6296,
+  1176, 5272, 3224, 7320, 664, 4760, 2712, 6808, 1688, 5784, 3736, 7832,
+  408, 4504, 2456, 6552, 1432, 5528, 3480, 7576, 920, 5016, 2968, 7064,
+  1944, 6040, 3992, 8088, 88, 4184, 2136, 6232, 1112, 5208, 3160, 7256,
+  600, 4696, 2648, 6744, 1624, 5720, 3672, 7768, 344, 4440, 2392, 6488,
+  1368, 5464, 3416, 7512, 856, 4952, 2904, 7000, 1880, 5976, 3928, 8024,
+  216, 4312, 2264, 6360, 1240, 5336, 3288, 7384, 728, 4824, 2776, 6872,
+  1752, 5848, 3800, 7896, 472, 4568, 2520, 6616, 1496, 5592, 3544, 7640,
+  984, 5080, 3032, 7128, 2008, 6104, 4056, 8152, 56, 4152, 2104, 6200,
+  1080, 5176, 3128, 7224, 568, 4664, 2616, 6712, 1592, 5688, 3640, 7736,
+  312, 4408, 2360, 6456, 1336, 5432, 3384, 7480, 824, 4920, 2872, 6968,
+  1848, 5944, 3896, 7992, 184, 4280, 2232, 6328, 1208, 5304, 3256, 7352,
+  696, 4792, 2744, 6840, 1720, 5816, 3768, 7864, 440, 4536, 2488, 6584,
+  1464, 5560, 3512, 7608, 952, 5048, 3000, 7096, 1976, 6072, 4024, 8120,
+  120, 4216, 2168, 6264, 1144, 5240, 3192, 7288, 632, 4728, 2680, 6776,
+  1656, 5752, 3704, 7800, 376, 4472, 2424, 6520, 1400, 5496, 3448, 7544,
+  888, 4984, 2936, 7032, 1912, 6008, 3960, 8056, 248, 4344, 2296, 6392,
+  1272, 5368, 3320, 7416, 760, 4856, 2808, 6904, 1784, 5880, 3832, 7928,
+  504, 4600, 2552, 6648, 1528, 5624, 3576, 7672, 1016, 5112, 3064, 7160,
+  2040, 6136, 4088, 8184, 4, 4100, 2052, 6148, 1028, 5124, 3076, 7172,
+  516, 4612, 2564, 6660, 1540, 5636, 3588, 7684, 260, 4356, 2308, 6404,
+  1284, 5380, 3332, 7428, 772, 4868, 2820, 6916, 1796, 5892, 3844, 7940,
+  132, 4228, 2180, 6276, 1156, 5252, 3204, 7300, 644, 4740, 2692, 6788,
+  1668, 5764, 3716, 7812, 388, 4484, 2436, 6532, 1412, 5508, 3460, 7556,
+  900, 4996, 2948, 7044, 1924, 6020, 3972, 8068, 68, 4164, 2116, 6212,
+  1092, 5188, 3140, 7236, 580, 4676, 2628, 6724, 1604, 5700, 3652, 7748,
+  324, 4420, 2372, 6468, 1348, 5444, 3396, 7492, 836, 4932, 2884, 6980,
+  1860, 5956, 3908, 8004, 196, 4292, 2244, 6340, 1220, 5316, 3268, 7364,
+  708, 4804, 2756, 6852, 1732, 5828, 3780, 7876, 452, 4548, 2500, 6596,
+  1476, 5572, 3524, 7620, 964, 5060, 3012, 7108, 1988, 6084, 4036, 8132,
+  36, 4132, 2084, 6180, 1060, 5156, 3108, 7204, 548, 4644, 2596, 6692,
+  1572, 5668, 3620, 7716, 292, 4388, 2340, 6436, 1316, 5412, 3364, 7460,
+  804, 4900, 2852, 6948, 1828, 5924, 3876, 7972, 164, 4260, 2212, 6308,
+  1188, 5284, 3236, 7332, 676, 4772, 2724, 6820, 1700, 5796, 3748, 7844,
+  420, 4516, 2468, 6564, 1444, 5540, 3492, 7588, 932, 5028, 2980, 7076,
+  1956, 6052, 4004, 8100, 100, 4196, 2148, 6244, 1124, 5220, 3172, 7268,
+  612, 4708, 2660, 6756, 1636, 5732, 3684, 7780, 356, 4452, 2404, 6500,
+  1380, 5476, 3428, 7524, 868, 4964, 2916, 7012, 1892, 5988, 3940, 8036,
+  228, 4324, 2276, 6372, 1252, 5348, 3300, 7396, 740, 4836, 2788, 6884,
+  1764, 5860, 3812, 7908, 484, 4580, 2532, 6628, 1508, 5604, 3556, 7652,
+  996, 5092, 3044, 7140, 2020, 6116, 4068, 8164, 20, 4116, 2068, 6164,
+  1044, 5140, 3092, 7188, 532, 4628, 2580, 6676, 1556, 5652, 3604, 7700,
+  276, 4372, 2324, 6420, 1300, 5396, 3348, 7444, 788, 4884, 2836, 6932,
+  1812, 5908, 3860, 7956, 148, 4244, 2196, 6292, 1172, 5268, 3220, 7316,
+  660, 4756, 2708, 6804, 1684, 5780, 3732, 7828, 404, 4500, 2452, 6548,
+  1428, 5524, 3476, 7572, 916, 5012, 2964, 7060, 1940, 6036, 3988, 8084,
+  84, 4180, 2132, 6228, 1108, 5204, 3156, 7252, 596, 4692, 2644, 6740,
+  1620, 5716, 3668, 7764, 340, 4436, 2388, 6484, 1364, 5460, 3412, 7508,
+  852, 4948, 2900, 6996, 1876, 5972, 3924, 8020, 212, 4308, 2260, 6356,
+  1236, 5332, 3284, 7380, 724, 4820, 2772, 6868, 1748, 5844, 3796, 7892,
+  468, 4564, 2516, 6612, 1492, 5588, 3540, 7636, 980, 5076, 3028, 7124,
+  2004, 6100, 4052, 8148, 52, 4148, 2100, 6196, 1076, 5172, 3124, 7220,
+  564, 4660, 2612, 6708, 1588, 5684, 3636, 7732, 308, 4404, 2356, 6452,
+  1332, 5428, 3380, 7476, 820, 4916, 2868, 6964, 1844, 5940, 3892, 7988,
+  180, 4276, 2228, 6324, 1204, 5300, 3252, 7348, 692, 4788, 2740, 6836,
+  1716, 5812, 3764, 7860, 436, 4532, 2484, 6580, 1460, 5556, 3508, 7604,
+  948, 5044, 2996, 7092, 1972, 6068, 4020, 8116, 116, 4212, 2164, 6260,
+  1140, 5236, 3188, 7284, 628, 4724, 2676, 6772, 1652, 5748, 3700, 7796,
+  372, 4468, 2420, 6516, 1396, 5492, 3444, 7540, 884, 4980, 2932, 7028,
+  1908, 6004, 3956, 8052, 244, 4340, 2292, 6388, 1268, 5364, 3316, 7412,
+  756, 4852, 2804, 6900, 1780, 5876, 3828, 7924, 500, 4596, 2548, 6644,
+  1524, 5620, 3572, 7668, 1012, 5108, 3060, 7156, 2036, 6132, 4084, 8180,
+  12, 4108, 2060, 6156, 1036, 5132, 3084, 7180, 524, 4620, 2572, 6668,
+  1548, 5644, 3596, 7692, 268, 4364, 2316, 6412, 1292, 5388, 3340, 7436,
+  780, 4876, 2828, 6924, 1804, 5900, 3852, 7948, 140, 4236, 2188, 6284,
+  1164, 5260, 3212, 7308, 652, 4748, 2700, 6796, 1676, 5772, 3724, 7820,
+  396, 4492, 2444, 6540, 1420, 5516, 3468, 7564, 908, 5004, 2956, 7052,
+  1932, 6028, 3980, 8076, 76, 4172, 2124, 6220, 1100, 5196, 3148, 7244,
+  588, 4684, 2636, 6732, 1612, 5708, 3660, 7756, 332, 4428, 2380, 6476,
+  1356, 5452, 3404, 7500, 844, 4940, 2892, 6988, 1868, 5964, 3916, 8012,
+  204, 4300, 2252, 6348, 1228, 5324, 3276, 7372, 716, 4812, 2764, 6860,
+  1740, 5836, 3788, 7884, 460, 4556, 2508, 6604, 1484, 5580, 3532, 7628,
+  972, 5068, 3020, 7116, 1996, 6092, 4044, 8140, 44, 4140, 2092, 6188,
+  1068, 5164, 3116, 7212, 556, 4652, 2604, 6700, 1580, 5676, 3628, 7724,
+  300, 4396, 2348, 6444, 1324, 5420, 3372, 7468, 812, 4908, 2860, 6956,
+  1836, 5932, 3884, 7980, 172, 4268, 2220, 6316, 1196, 5292, 3244, 7340,
+  684, 4780, 2732, 6828, 1708, 5804, 3756, 7852, 428, 4524, 2476, 6572,
+  1452, 5548, 3500, 7596, 940, 5036, 2988, 7084, 1964, 6060, 4012, 8108,
+  108, 4204, 2156, 6252, 1132, 5228, 3180, 7276, 620, 4716, 2668, 6764,
+  1644, 5740, 3692, 7788, 364, 4460, 2412, 6508, 1388, 5484, 3436, 7532,
+  876, 4972, 2924, 7020, 1900, 5996, 3948, 8044, 236, 4332, 2284, 6380,
+  1260, 5356, 3308, 7404, 748, 4844, 2796, 6892, 1772, 5868, 3820, 7916,
+  492, 4588, 2540, 6636, 1516, 5612, 3564, 7660, 1004, 5100, 3052, 7148,
+  2028, 6124, 4076, 8172, 28, 4124, 2076, 6172, 1052, 5148, 3100, 7196,
+  540, 4636, 2588, 6684, 1564, 5660, 3612, 7708, 284, 4380, 2332, 6428,
+  1308, 5404, 3356, 7452, 796, 4892, 2844, 6940, 1820, 5916, 3868, 7964,
+  156, 4252, 2204, 6300, 1180, 5276, 3228, 7324, 668, 4764, 2716, 6812,
+  1692, 5788, 3740, 7836, 412, 4508, 2460, 6556, 1436, 5532, 3484, 7580,
+  924, 5020, 2972, 7068, 1948, 6044, 3996, 8092, 92, 4188, 2140, 6236,
+  1116, 5212, 3164, 7260, 604, 4700, 2652, 6748, 1628, 5724, 3676, 7772,
+  348, 4444, 2396, 6492, 1372, 5468, 3420, 7516, 860, 4956, 2908, 7004,
+  1884, 5980, 3932, 8028, 220, 4316, 2268, 6364, 1244, 5340, 3292, 7388,
+  732, 4828, 2780, 6876, 1756, 5852, 3804, 7900, 476, 4572, 2524, 6620,
+  1500, 5596, 3548, 7644, 988, 5084, 3036, 7132, 2012, 6108, 4060, 8156,
+  60, 4156, 2108, 6204, 1084, 5180, 3132, 7228, 572, 4668, 2620, 6716,
+  1596, 5692, 3644, 7740, 316, 4412, 2364, 6460, 1340, 5436, 3388, 7484,
+  828, 4924, 2876, 6972, 1852, 5948, 3900, 7996, 188, 4284, 2236, 6332,
+  1212, 5308, 3260, 7356, 700, 4796, 2748, 6844, 1724, 5820, 3772, 7868,
+  444, 4540, 2492, 6588, 1468, 5564, 3516, 7612, 956, 5052, 3004, 7100,
+  1980, 6076, 4028, 8124, 124, 4220, 2172, 6268, 1148, 5244, 3196, 7292,
+  636, 4732, 2684, 6780, 1660, 5756, 3708, 7804, 380, 4476, 2428, 6524,
+  1404, 5500, 3452, 7548, 892, 4988, 2940, 7036, 1916, 6012, 3964, 8060,
+  252, 4348, 2300, 6396, 1276, 5372, 3324, 7420, 764, 4860, 2812, 6908,
+  1788, 5884, 3836, 7932, 508, 4604, 2556, 6652, 1532, 5628, 3580, 7676,
+  1020, 5116, 3068, 7164, 2044, 6140, 4092, 8188, 2, 4098, 2050, 6146,
+  1026, 5122, 3074, 7170, 514, 4610, 2562, 6658, 1538, 5634, 3586, 7682,
+  258, 4354, 2306, 6402, 1282, 5378, 3330, 7426, 770, 4866, 2818, 6914,
+  1794, 5890, 3842, 7938, 130, 4226, 2178, 6274, 1154, 5250, 3202, 7298,
+  642, 4738, 2690, 6786, 1666, 5762, 3714, 7810, 386, 4482, 2434, 6530,
+  1410, 5506, 3458, 7554, 898, 4994, 2946, 7042, 1922, 6018, 3970, 8066,
+  66, 4162, 2114, 6210, 1090, 5186, 3138, 7234, 578, 4674, 2626, 6722,
+  1602, 5698, 3650, 7746, 322, 4418, 2370, 6466, 1346, 5442, 3394, 7490,
+  834, 4930, 2882, 6978, 1858, 5954, 3906, 8002, 194, 4290, 2242, 6338,
+  1218, 5314, 3266, 7362, 706, 4802, 2754, 6850, 1730, 5826, 3778, 7874,
+  450, 4546, 2498, 6594, 1474, 5570, 3522, 7618, 962, 5058, 3010, 7106,
+  1986, 6082, 4034, 8130, 34, 4130, 2082, 6178, 1058, 5154, 3106, 7202,
+  546, 4642, 2594, 6690, 1570, 5666, 3618, 7714, 290, 4386, 2338, 6434,
+  1314, 5410, 3362, 7458, 802, 4898, 2850, 6946, 1826, 5922, 3874, 7970,
+  162, 4258, 2210, 6306, 1186, 5282, 3234, 7330, 674, 4770, 2722, 6818,
+  1698, 5794, 3746, 7842, 418, 4514, 2466, 6562, 1442, 5538, 3490, 7586,
+  930, 5026, 2978, 7074, 1954, 6050, 4002, 8098, 98, 4194, 2146, 6242,
+  1122, 5218, 3170, 7266, 610, 4706, 2658, 6754, 1634, 5730, 3682, 7778,
+  354, 4450, 2402, 6498, 1378, 5474, 3426, 7522, 866, 4962, 2914, 7010,
+  1890, 5986, 3938, 8034, 226, 4322, 2274, 6370, 1250, 5346, 3298, 7394,
+  738, 4834, 2786, 6882, 1762, 5858, 3810, 7906, 482, 4578, 2530, 6626,
+  1506, 5602, 3554, 7650, 994, 5090, 3042, 7138, 2018, 6114, 4066, 8162,
+  18, 4114, 2066, 6162, 1042, 5138, 3090, 7186, 530, 4626, 2578, 6674,
+  1554, 5650, 3602, 7698, 274, 4370, 2322, 6418, 1298, 5394, 3346, 7442,
+  786, 4882, 2834, 6930, 1810, 5906, 3858, 7954, 146, 4242, 2194, 6290,
+  1170, 5266, 3218, 7314, 658, 4754, 2706, 6802, 1682, 5778, 3730, 7826,
+  402, 4498, 2450, 6546, 1426, 5522, 3474, 7570, 914, 5010, 2962, 7058,
+  1938, 6034, 3986, 8082, 82, 4178, 2130, 6226, 1106, 5202, 3154, 7250,
+  594, 4690, 2642, 6738, 1618, 5714, 3666, 7762, 338, 4434, 2386, 6482,
+  1362, 5458, 3410, 7506, 850, 4946, 2898, 6994, 1874, 5970, 3922, 8018,
+  210, 4306, 2258, 6354, 1234, 5330, 3282, 7378, 722, 4818, 2770, 6866,
+  1746, 5842, 3794, 7890, 466, 4562, 2514, 6610, 1490, 5586, 3538, 7634,
+  978, 5074, 3026, 7122, 2002, 6098, 4050, 8146, 50, 4146, 2098, 6194,
+  1074, 5170, 3122, 7218, 562, 4658, 2610, 6706, 1586, 5682, 3634, 7730,
+  306, 4402, 2354, 6450, 1330, 5426, 3378, 7474, 818, 4914, 2866, 6962,
+  1842, 5938, 3890, 7986, 178, 4274, 2226, 6322, 1202, 5298, 3250, 7346,
+  690, 4786, 2738, 6834, 1714, 5810, 3762, 7858, 434, 4530, 2482, 6578,
+  1458, 5554, 3506, 7602, 946, 5042, 2994, 7090, 1970, 6066, 4018, 8114,
+  114, 4210, 2162, 6258, 1138, 5234, 3186, 7282, 626, 4722, 2674, 6770,
+  1650, 5746, 3698, 7794, 370, 4466, 2418, 6514, 1394, 5490, 3442, 7538,
+  882, 4978, 2930, 7026, 1906, 6002, 3954, 8050, 242, 4338, 2290, 6386,
+  1266, 5362, 3314, 7410, 754, 4850, 2802, 6898, 1778, 5874, 3826, 7922,
+  498, 4594, 2546, 6642, 1522, 5618, 3570, 7666, 1010, 5106, 3058, 7154,
+  2034, 6130, 4082, 8178, 10, 4106, 2058, 6154, 1034, 5130, 3082, 7178,
+  522, 4618, 2570, 6666, 1546, 5642, 3594, 7690, 266, 4362, 2314, 6410,
+  1290, 5386, 3338, 7434, 778, 4874, 2826, 6922, 1802, 5898, 3850, 7946,
+  138, 4234, 2186, 6282, 1162, 5258, 3210, 7306, 650, 4746, 2698, 6794,
+  1674, 5770, 3722, 7818, 394, 4490, 2442, 6538, 1418, 5514, 3466, 7562,
+  906, 5002, 2954, 7050, 1930, 6026, 3978, 8074, 74, 4170, 2122, 6218,
+  1098, 5194, 3146, 7242, 586, 4682, 2634, 6730, 1610, 5706, 3658, 7754,
+  330, 4426, 2378, 6474, 1354, 5450, 3402, 7498, 842, 4938, 2890, 6986,
+  1866, 5962, 3914, 8010, 202, 4298, 2250, 6346, 1226, 5322, 3274, 7370,
+  714, 4810, 2762, 6858, 1738, 5834, 3786, 7882, 458, 4554, 2506, 6602,
+  1482, 5578, 3530, 7626, 970, 5066, 3018, 7114, 1994, 6090, 4042, 8138,
+  42, 4138, 2090, 6186, 1066, 5162, 3114, 7210, 554, 4650, 2602, 6698,
+  1578, 5674, 3626, 7722, 298, 4394, 2346, 6442, 1322, 5418, 3370, 7466,
+  810, 4906, 2858, 6954, 1834, 5930, 3882, 7978, 170, 4266, 2218, 6314,
+  1194, 5290, 3242, 7338, 682, 4778, 2730, 6826, 1706, 5802, 3754, 7850,
+  426, 4522, 2474, 6570, 1450, 5546, 3498, 7594, 938, 5034, 2986, 7082,
+  1962, 6058, 4010, 8106, 106, 4202, 2154, 6250, 1130, 5226, 3178, 7274,
+  618, 4714, 2666, 6762, 1642, 5738, 3690, 7786, 362, 4458, 2410, 6506,
+  1386, 5482, 3434, 7530, 874, 4970, 2922, 7018, 1898, 5994, 3946, 8042,
+  234, 4330, 2282, 6378, 1258, 5354, 3306, 7402, 746, 4842, 2794, 6890,
+  1770, 5866, 3818, 7914, 490, 4586, 2538, 6634, 1514, 5610, 3562, 7658,
+  1002, 5098, 3050, 7146, 2026, 6122, 4074, 8170, 26, 4122, 2074, 6170,
+  1050, 5146, 3098, 7194, 538, 4634, 2586, 6682, 1562, 5658, 3610, 7706,
+  282, 4378, 2330, 6426, 1306, 5402, 3354, 7450, 794, 4890, 2842, 6938,
+  1818, 5914, 3866, 7962, 154, 4250, 2202, 6298, 1178, 5274, 3226, 7322,
+  666, 4762, 2714, 6810, 1690, 5786, 3738, 7834, 410, 4506, 2458, 6554,
+  1434, 5530, 3482, 7578, 922, 5018, 2970, 7066, 1946, 6042, 3994, 8090,
+  90, 4186, 2138, 6234, 1114, 5210, 3162, 7258, 602, 4698, 2650, 6746,
+  1626, 5722, 3674, 7770, 346, 4442, 2394, 6490, 1370, 5466, 3418, 7514,
+  858, 4954, 2906, 7002, 1882, 5978, 3930, 8026, 218, 4314, 2266, 6362,
+  1242, 5338, 3290, 7386, 730, 4826, 2778, 6874, 1754, 5850, 3802, 7898,
+  474, 4570, 2522, 6618, 1498, 5594, 3546, 7642, 986, 5082, 3034, 7130,
+  2010, 6106, 4058, 8154, 58, 4154, 2106, 6202, 1082, 5178, 3130, 7226,
+  570, 4666, 2618, 6714, 1594, 5690, 3642, 7738, 314, 4410, 2362, 6458,
+  1338, 5434, 3386, 7482, 826, 4922, 2874, 6970, 1850, 5946, 3898, 7994,
+  186, 4282, 2234, 6330, 1210, 5306, 3258, 7354, 698, 4794, 2746, 6842,
+  1722, 5818, 3770, 7866, 442, 4538, 2490, 6586, 1466, 5562, 3514, 7610,
+  954, 5050, 3002, 7098, 1978, 6074, 4026, 8122, 122, 4218, 2170, 6266,
+  1146, 5242, 3194, 7290, 634, 4730, 2682, 6778, 1658, 5754, 3706, 7802,
+  378, 4474, 2426, 6522, 1402, 5498, 3450, 7546, 890, 4986, 2938, 7034,
+  1914, 6010, 3962, 8058, 250, 4346, 2298, 6394, 1274, 5370, 3322, 7418,
+  762, 4858, 2810, 6906, 1786, 5882, 3834, 7930, 506, 4602, 2554, 6650,
+  1530, 5626, 3578, 7674, 1018, 5114, 3066, 7162, 2042, 6138, 4090, 8186,
+  6, 4102, 2054, 6150, 1030, 5126, 3078, 7174, 518, 4614, 2566, 6662,
+  1542, 5638, 3590, 7686, 262, 4358, 2310, 6406, 1286, 5382, 3334, 7430,
+  774, 4870, 2822, 6918, 1798, 5894, 3846, 7942, 134, 4230, 2182, 6278,
+  1158, 5254, 3206, 7302, 646, 4742, 2694, 6790, 1670, 5766, 3718, 7814,
+  390, 4486, 2438, 6534, 1414, 5510, 3462, 7558, 902, 4998, 2950, 7046,
+  1926, 6022, 3974, 8070, 70, 4166, 2118, 6214, 1094, 5190, 3142, 7238,
+  582, 4678, 2630, 6726, 1606, 5702, 3654, 7750, 326, 4422, 2374, 6470,
+  1350, 5446, 3398, 7494, 838, 4934, 2886, 6982, 1862, 5958, 3910, 8006,
+  198, 4294, 2246, 6342, 1222, 5318, 3270, 7366, 710, 4806, 2758, 6854,
+  1734, 5830, 3782, 7878, 454, 4550, 2502, 6598, 1478, 5574, 3526, 7622,
+  966, 5062, 3014, 7110, 1990, 6086, 4038, 8134, 38, 4134, 2086, 6182,
+  1062, 5158, 3110, 7206, 550, 4646, 2598, 6694, 1574, 5670, 3622, 7718,
+  294, 4390, 2342, 6438, 1318, 5414, 3366, 7462, 806, 4902, 2854, 6950,
+  1830, 5926, 3878, 7974, 166, 4262, 2214, 6310, 1190, 5286, 3238, 7334,
+  678, 4774, 2726, 6822, 1702, 5798, 3750, 7846, 422, 4518, 2470, 6566,
+  1446, 5542, 3494, 7590, 934, 5030, 2982, 7078, 1958, 6054, 4006, 8102,
+  102, 4198, 2150, 6246, 1126, 5222, 3174, 7270, 614, 4710, 2662, 6758,
+  1638, 5734, 3686, 7782, 358, 4454, 2406, 6502, 1382, 5478, 3430, 7526,
+  870, 4966, 2918, 7014, 1894, 5990, 3942, 8038, 230, 4326, 2278, 6374,
+  1254, 5350, 3302, 7398, 742, 4838, 2790, 6886, 1766, 5862, 3814, 7910,
+  486, 4582, 2534, 6630, 1510, 5606, 3558, 7654, 998, 5094, 3046, 7142,
+  2022, 6118, 4070, 8166, 22, 4118, 2070, 6166, 1046, 5142, 3094, 7190,
+  534, 4630, 2582, 6678, 1558, 5654, 3606, 7702, 278, 4374, 2326, 6422,
+  1302, 5398, 3350, 7446, 790, 4886, 2838, 6934, 1814, 5910, 3862, 7958,
+  150, 4246, 2198, 6294, 1174, 5270, 3222, 7318, 662, 4758, 2710, 6806,
+  1686, 5782, 3734, 7830, 406, 4502, 2454, 6550, 1430, 5526, 3478, 7574,
+  918, 5014, 2966, 7062, 1942, 6038, 3990, 8086, 86, 4182, 2134, 6230,
+  1110, 5206, 3158, 7254, 598, 4694, 2646, 6742, 1622, 5718, 3670, 7766,
+  342, 4438, 2390, 6486, 1366, 5462, 3414, 7510, 854, 4950, 2902, 6998,
+  1878, 5974, 3926, 8022, 214, 4310, 2262, 6358, 1238, 5334, 3286, 7382,
+  726, 4822, 2774, 6870, 1750, 5846, 3798, 7894, 470, 4566, 2518, 6614,
+  1494, 5590, 3542, 7638, 982, 5078, 3030, 7126, 2006, 6102, 4054, 8150,
+  54, 4150, 2102, 6198, 1078, 5174, 3126, 7222, 566, 4662, 2614, 6710,
+  1590, 5686, 3638, 7734, 310, 4406, 2358, 6454, 1334, 5430, 3382, 7478,
+  822, 4918, 2870, 6966, 1846, 5942, 3894, 7990, 182, 4278, 2230, 6326,
+  1206, 5302, 3254, 7350, 694, 4790, 2742, 6838, 1718, 5814, 3766, 7862,
+  438, 4534, 2486, 6582, 1462, 5558, 3510, 7606, 950, 5046, 2998, 7094,
+  1974, 6070, 4022, 8118, 118, 4214, 2166, 6262, 1142, 5238, 3190, 7286,
+  630, 4726, 2678, 6774, 1654, 5750, 3702, 7798, 374, 4470, 2422, 6518,
+  1398, 5494, 3446, 7542, 886, 4982, 2934, 7030, 1910, 6006, 3958, 8054,
+  246, 4342, 2294, 6390, 1270, 5366, 3318, 7414, 758, 4854, 2806, 6902,
+  1782, 5878, 3830, 7926, 502, 4598, 2550, 6646, 1526, 5622, 3574, 7670,
+  1014, 5110, 3062, 7158, 2038, 6134, 4086, 8182, 14, 4110, 2062, 6158,
+  1038, 5134, 3086, 7182, 526, 4622, 2574, 6670, 1550, 5646, 3598, 7694,
+  270, 4366, 2318, 6414, 1294, 5390, 3342, 7438, 782, 4878, 2830, 6926,
+  1806, 5902, 3854, 7950, 142, 4238, 2190, 6286, 1166, 5262, 3214, 7310,
+  654, 4750, 2702, 6798, 1678, 5774, 3726, 7822, 398, 4494, 2446, 6542,
+  1422, 5518, 3470, 7566, 910, 5006, 2958, 7054, 1934, 6030, 3982, 8078,
+  78, 4174, 2126, 6222, 1102, 5198, 3150, 7246, 590, 4686, 2638, 6734,
+  1614, 5710, 3662, 7758, 334, 4430, 2382, 6478, 1358, 5454, 3406, 7502,
+  846, 4942, 2894, 6990, 1870, 5966, 3918, 8014, 206, 4302, 2254, 6350,
+  1230, 5326, 3278, 7374, 718, 4814, 2766, 6862, 1742, 5838, 3790, 7886,
+  462, 4558, 2510, 6606, 1486, 5582, 3534, 7630, 974, 5070, 3022, 7118,
+  1998, 6094, 4046, 8142, 46, 4142, 2094, 6190, 1070, 5166, 3118, 7214,
+  558, 4654, 2606, 6702, 1582, 5678, 3630, 7726, 302, 4398, 2350, 6446,
+  1326, 5422, 3374, 7470, 814, 4910, 2862, 6958, 1838, 5934, 3886, 7982,
+  174, 4270, 2222, 6318, 1198, 5294, 3246, 7342, 686, 4782, 2734, 6830,
+  1710, 5806, 3758, 7854, 430, 4526, 2478, 6574, 1454, 5550, 3502, 7598,
+  942, 5038, 2990, 7086, 1966, 6062, 4014, 8110, 110, 4206, 2158, 6254,
+  1134, 5230, 3182, 7278, 622, 4718, 2670, 6766, 1646, 5742, 3694, 7790,
+  366, 4462, 2414, 6510, 1390, 5486, 3438, 7534, 878, 4974, 2926, 7022,
+  1902, 5998, 3950, 8046, 238, 4334, 2286, 6382, 1262, 5358, 3310, 7406,
+  750, 4846, 2798, 6894, 1774, 5870, 3822, 7918, 494, 4590, 2542, 6638,
+  1518, 5614, 3566, 7662, 1006, 5102, 3054, 7150, 2030, 6126, 4078, 8174,
+  30, 4126, 2078, 6174, 1054, 5150, 3102, 7198, 542, 4638, 2590, 6686,
+  1566, 5662, 3614, 7710, 286, 4382, 2334, 6430, 1310, 5406, 3358, 7454,
+  798, 4894, 2846, 6942, 1822, 5918, 3870, 7966, 158, 4254, 2206, 6302,
+  1182, 5278, 3230, 7326, 670, 4766, 2718, 6814, 1694, 5790, 3742, 7838,
+  414, 4510, 2462, 6558, 1438, 5534, 3486, 7582, 926, 5022, 2974, 7070,
+  1950, 6046, 3998, 8094, 94, 4190, 2142, 6238, 1118, 5214, 3166, 7262,
+  606, 4702, 2654, 6750, 1630, 5726, 3678, 7774, 350, 4446, 2398, 6494,
+  1374, 5470, 3422, 7518, 862, 4958, 2910, 7006, 1886, 5982, 3934, 8030,
+  222, 4318, 2270, 6366, 1246, 5342, 3294, 7390, 734, 4830, 2782, 6878,
+  1758, 5854, 3806, 7902, 478, 4574, 2526, 6622, 1502, 5598, 3550, 7646,
+  990, 5086, 3038, 7134, 2014, 6110, 4062, 8158, 62, 4158, 2110, 6206,
+  1086, 5182, 3134, 7230, 574, 4670, 2622, 6718, 1598, 5694, 3646, 7742,
+  318, 4414, 2366, 6462, 1342, 5438, 3390, 7486, 830, 4926, 2878, 6974,
+  1854, 5950, 3902, 7998, 190, 4286, 2238, 6334, 1214, 5310, 3262, 7358,
+  702, 4798, 2750, 6846, 1726, 5822, 3774, 7870, 446, 4542, 2494, 6590,
+  1470, 5566, 3518, 7614, 958, 5054, 3006, 7102, 1982, 6078, 4030, 8126,
+  126, 4222, 2174, 6270, 1150, 5246, 3198, 7294, 638, 4734, 2686, 6782,
+  1662, 5758, 3710, 7806, 382, 4478, 2430, 6526, 1406, 5502, 3454, 7550,
+  894, 4990, 2942, 7038, 1918, 6014, 3966, 8062, 254, 4350, 2302, 6398,
+  1278, 5374, 3326, 7422, 766, 4862, 2814, 6910, 1790, 5886, 3838, 7934,
+  510, 4606, 2558, 6654, 1534, 5630, 3582, 7678, 1022, 5118, 3070, 7166,
+  2046, 6142, 4094, 8190, 1, 4097, 2049, 6145, 1025, 5121, 3073, 7169,
+  513, 4609, 2561, 6657, 1537, 5633, 3585, 7681, 257, 4353, 2305, 6401,
+  1281, 5377, 3329, 7425, 769, 4865, 2817, 6913, 1793, 5889, 3841, 7937,
+  129, 4225, 2177, 6273, 1153, 5249, 3201, 7297, 641, 4737, 2689, 6785,
+  1665, 5761, 3713, 7809, 385, 4481, 2433, 6529, 1409, 5505, 3457, 7553,
+  897, 4993, 2945, 7041, 1921, 6017, 3969, 8065, 65, 4161, 2113, 6209,
+  1089, 5185, 3137, 7233, 577, 4673, 2625, 6721, 1601, 5697, 3649, 7745,
+  321, 4417, 2369, 6465, 1345, 5441, 3393, 7489, 833, 4929, 2881, 6977,
+  1857, 5953, 3905, 8001, 193, 4289, 2241, 6337, 1217, 5313, 3265, 7361,
+  705, 4801, 2753, 6849, 1729, 5825, 3777, 7873, 449, 4545, 2497, 6593,
+  1473, 5569, 3521, 7617, 961, 5057, 3009, 7105, 1985, 6081, 4033, 8129,
+  33, 4129, 2081, 6177, 1057, 5153, 3105, 7201, 545, 4641, 2593, 6689,
+  1569, 5665, 3617, 7713, 289, 4385, 2337, 6433, 1313, 5409, 3361, 7457,
+  801, 4897, 2849, 6945, 1825, 5921, 3873, 7969, 161, 4257, 2209, 6305,
+  1185, 5281, 3233, 7329, 673, 4769, 2721, 6817, 1697, 5793, 3745, 7841,
+  417, 4513, 2465, 6561, 1441, 5537, 3489, 7585, 929, 5025, 2977, 7073,
+  1953, 6049, 4001, 8097, 97, 4193, 2145, 6241, 1121, 5217, 3169, 7265,
+  609, 4705, 2657, 6753, 1633, 5729, 3681, 7777, 353, 4449, 2401, 6497,
+  1377, 5473, 3425, 7521, 865, 4961, 2913, 7009, 1889, 5985, 3937, 8033,
+  225, 4321, 2273, 6369, 1249, 5345, 3297, 7393, 737, 4833, 2785, 6881,
+  1761, 5857, 3809, 7905, 481, 4577, 2529, 6625, 1505, 5601, 3553, 7649,
+  993, 5089, 3041, 7137, 2017, 6113, 4065, 8161, 17, 4113, 2065, 6161,
+  1041, 5137, 3089, 7185, 529, 4625, 2577, 6673, 1553, 5649, 3601, 7697,
+  273, 4369, 2321, 6417, 1297, 5393, 3345, 7441, 785, 4881, 2833, 6929,
+  1809, 5905, 3857, 7953, 145, 4241, 2193, 6289, 1169, 5265, 3217, 7313,
+  657, 4753, 2705, 6801, 1681, 5777, 3729, 7825, 401, 4497, 2449, 6545,
+  1425, 5521, 3473, 7569, 913, 5009, 2961, 7057, 1937, 6033, 3985, 8081,
+  81, 4177, 2129, 6225, 1105, 5201, 3153, 7249, 593, 4689, 2641, 6737,
+  1617, 5713, 3665, 7761, 337, 4433, 2385, 6481, 1361, 5457, 3409, 7505,
+  849, 4945, 2897, 6993, 1873, 5969, 3921, 8017, 209, 4305, 2257, 6353,
+  1233, 5329, 3281, 7377, 721, 4817, 2769, 6865, 1745, 5841, 3793, 7889,
+  465, 4561, 2513, 6609, 1489, 5585, 3537, 7633, 977, 5073, 3025, 7121,
+  2001, 6097, 4049, 8145, 49, 4145, 2097, 6193, 1073, 5169, 3121, 7217,
+  561, 4657, 2609, 6705, 1585, 5681, 3633, 7729, 305, 4401, 2353, 6449,
+  1329, 5425, 3377, 7473, 817, 4913, 2865, 6961, 1841, 5937, 3889, 7985,
+  177, 4273, 2225, 6321, 1201, 5297, 3249, 7345, 689, 4785, 2737, 6833,
+  1713, 5809, 3761, 7857, 433, 4529, 2481, 6577, 1457, 5553, 3505, 7601,
+  945, 5041, 2993, 7089, 1969, 6065, 4017, 8113, 113, 4209, 2161, 6257,
+  1137, 5233, 3185, 7281, 625, 4721, 2673, 6769, 1649, 5745, 3697, 7793,
+  369, 4465, 2417, 6513, 1393, 5489, 3441, 7537, 881, 4977, 2929, 7025,
+  1905, 6001, 3953, 8049, 241, 4337, 2289, 6385, 1265, 5361, 3313, 7409,
+  753, 4849, 2801, 6897, 1777, 5873, 3825, 7921, 497, 4593, 2545, 6641,
+  1521, 5617, 3569, 7665, 1009, 5105, 3057, 7153, 2033, 6129, 4081, 8177,
+  9, 4105, 2057, 6153, 1033, 5129, 3081, 7177, 521, 4617, 2569, 6665,
+  1545, 5641, 3593, 7689, 265, 4361, 2313, 6409, 1289, 5385, 3337, 7433,
+  777, 4873, 2825, 6921, 1801, 5897, 3849, 7945, 137, 4233, 2185, 6281,
+  1161, 5257, 3209, 7305, 649, 4745, 2697, 6793, 1673, 5769, 3721, 7817,
+  393, 4489, 2441, 6537, 1417, 5513, 3465, 7561, 905, 5001, 2953, 7049,
+  1929, 6025, 3977, 8073, 73, 4169, 2121, 6217, 1097, 5193, 3145, 7241,
+  585, 4681, 2633, 6729, 1609, 5705, 3657, 7753, 329, 4425, 2377, 6473,
+  1353, 5449, 3401, 7497, 841, 4937, 2889, 6985, 1865, 5961, 3913, 8009,
+  201, 4297, 2249, 6345, 1225, 5321, 3273, 7369, 713, 4809, 2761, 6857,
+  1737, 5833, 3785, 7881, 457, 4553, 2505, 6601, 1481, 5577, 3529, 7625,
+  969, 5065, 3017, 7113, 1993, 6089, 4041, 8137, 41, 4137, 2089, 6185,
+  1065, 5161, 3113, 7209, 553, 4649, 2601, 6697, 1577, 5673, 3625, 7721,
+  297, 4393, 2345, 6441, 1321, 5417, 3369, 7465, 809, 4905, 2857, 6953,
+  1833, 5929, 3881, 7977, 169, 4265, 2217, 6313, 1193, 5289, 3241, 7337,
+  681, 4777, 2729, 6825, 1705, 5801, 3753, 7849, 425, 4521, 2473, 6569,
+  1449, 5545, 3497, 7593, 937, 5033, 2985, 7081, 1961, 6057, 4009, 8105,
+  105, 4201, 2153, 6249, 1129, 5225, 3177, 7273, 617, 4713, 2665, 6761,
+  1641, 5737, 3689, 7785, 361, 4457, 2409, 6505, 1385, 5481, 3433, 7529,
+  873, 4969, 2921, 7017, 1897, 5993, 3945, 8041, 233, 4329, 2281, 6377,
+  1257, 5353, 3305, 7401, 745, 4841, 2793, 6889, 1769, 5865, 3817, 7913,
+  489, 4585, 2537, 6633, 1513, 5609, 3561, 7657, 1001, 5097, 3049, 7145,
+  2025, 6121, 4073, 8169, 25, 4121, 2073, 6169, 1049, 5145, 3097, 7193,
+  537, 4633, 2585, 6681, 1561, 5657, 3609, 7705, 281, 4377, 2329, 6425,
+  1305, 5401, 3353, 7449, 793, 4889, 2841, 6937, 1817, 5913, 3865, 7961,
+  153, 4249, 2201, 6297, 1177, 5273, 3225, 7321, 665, 4761, 2713, 6809,
+  1689, 5785, 3737, 7833, 409, 4505, 2457, 6553, 1433, 5529, 3481, 7577,
+  921, 5017, 2969, 7065, 1945, 6041, 3993, 8089, 89, 4185, 2137, 6233,
+  1113, 5209, 3161, 7257, 601, 4697, 2649, 6745, 1625, 5721, 3673, 7769,
+  345, 4441, 2393, 6489, 1369, 5465, 3417, 7513, 857, 4953, 2905, 7001,
+  1881, 5977, 3929, 8025, 217, 4313, 2265, 6361, 1241, 5337, 3289, 7385,
+  729, 4825, 2777, 6873, 1753, 5849, 3801, 7897, 473, 4569, 2521, 6617,
+  1497, 5593, 3545, 7641, 985, 5081, 3033, 7129, 2009, 6105, 4057, 8153,
+  57, 4153, 2105, 6201, 1081, 5177, 3129, 7225, 569, 4665, 2617, 6713,
+  1593, 5689, 3641, 7737, 313, 4409, 2361, 6457, 1337, 5433, 3385, 7481,
+  825, 4921, 2873, 6969, 1849, 5945, 3897, 7993, 185, 4281, 2233, 6329,
+  1209, 5305, 3257, 7353, 697, 4793, 2745, 6841, 1721, 5817, 3769, 7865,
+  441, 4537, 2489, 6585, 1465, 5561, 3513, 7609, 953, 5049, 3001, 7097,
+  1977, 6073, 4025, 8121, 121, 4217, 2169, 6265, 1145, 5241, 3193, 7289,
+  633, 4729, 2681, 6777, 1657, 5753, 3705, 7801, 377, 4473, 2425, 6521,
+  1401, 5497, 3449, 7545, 889, 4985, 2937, 7033, 1913, 6009, 3961, 8057,
+  249, 4345, 2297, 6393, 1273, 5369, 3321, 7417, 761, 4857, 2809, 6905,
+  1785, 5881, 3833, 7929, 505, 4601, 2553, 6649, 1529, 5625, 3577, 7673,
+  1017, 5113, 3065, 7161, 2041, 6137, 4089, 8185, 5, 4101, 2053, 6149,
+  1029, 5125, 3077, 7173, 517, 4613, 2565, 6661, 1541, 5637, 3589, 7685,
+  261, 4357, 2309, 6405, 1285, 5381, 3333, 7429, 773, 4869, 2821, 6917,
+  1797, 5893, 3845, 7941, 133, 4229, 2181, 6277, 1157, 5253, 3205, 7301,
+  645, 4741, 2693, 6789, 1669, 5765, 3717, 7813, 389, 4485, 2437, 6533,
+  1413, 5509, 3461, 7557, 901, 4997, 2949, 7045, 1925, 6021, 3973, 8069,
+  69, 4165, 2117, 6213, 1093, 5189, 3141, 7237, 581, 4677, 2629, 6725,
+  1605, 5701, 3653, 7749, 325, 4421, 2373, 6469, 1349, 5445, 3397, 7493,
+  837, 4933, 2885, 6981, 1861, 5957, 3909, 8005, 197, 4293, 2245, 6341,
+  1221, 5317, 3269, 7365, 709, 4805, 2757, 6853, 1733, 5829, 3781, 7877,
+  453, 4549, 2501, 6597, 1477, 5573, 3525, 7621, 965, 5061, 3013, 7109,
+  1989, 6085, 4037, 8133, 37, 4133, 2085, 6181, 1061, 5157, 3109, 7205,
+  549, 4645, 2597, 6693, 1573, 5669, 3621, 7717, 293, 4389, 2341, 6437,
+  1317, 5413, 3365, 7461, 805, 4901, 2853, 6949, 1829, 5925, 3877, 7973,
+  165, 4261, 2213, 6309, 1189, 5285, 3237, 7333, 677, 4773, 2725, 6821,
+  1701, 5797, 3749, 7845, 421, 4517, 2469, 6565, 1445, 5541, 3493, 7589,
+  933, 5029, 2981, 7077, 1957, 6053, 4005, 8101, 101, 4197, 2149, 6245,
+  1125, 5221, 3173, 7269, 613, 4709, 2661, 6757, 1637, 5733, 3685, 7781,
+  357, 4453, 2405, 6501, 1381, 5477, 3429, 7525, 869, 4965, 2917, 7013,
+  1893, 5989, 3941, 8037, 229, 4325, 2277, 6373, 1253, 5349, 3301, 7397,
+  741, 4837, 2789, 6885, 1765, 5861, 3813, 7909, 485, 4581, 2533, 6629,
+  1509, 5605, 3557, 7653, 997, 5093, 3045, 7141, 2021, 6117, 4069, 8165,
+  21, 4117, 2069, 6165, 1045, 5141, 3093, 7189, 533, 4629, 2581, 6677,
+  1557, 5653, 3605, 7701, 277, 4373, 2325, 6421, 1301, 5397, 3349, 7445,
+  789, 4885, 2837, 6933, 1813, 5909, 3861, 7957, 149, 4245, 2197, 6293,
+  1173, 5269, 3221, 7317, 661, 4757, 2709, 6805, 1685, 5781, 3733, 7829,
+  405, 4501, 2453, 6549, 1429, 5525, 3477, 7573, 917, 5013, 2965, 7061,
+  1941, 6037, 3989, 8085, 85, 4181, 2133, 6229, 1109, 5205, 3157, 7253,
+  597, 4693, 2645, 6741, 1621, 5717, 3669, 7765, 341, 4437, 2389, 6485,
+  1365, 5461, 3413, 7509, 853, 4949, 2901, 6997, 1877, 5973, 3925, 8021,
+  213, 4309, 2261, 6357, 1237, 5333, 3285, 7381, 725, 4821, 2773, 6869,
+  1749, 5845, 3797, 7893, 469, 4565, 2517, 6613, 1493, 5589, 3541, 7637,
+  981, 5077, 3029, 7125, 2005, 6101, 4053, 8149, 53, 4149, 2101, 6197,
+  1077, 5173, 3125, 7221, 565, 4661, 2613, 6709, 1589, 5685, 3637, 7733,
+  309, 4405, 2357, 6453, 1333, 5429, 3381, 7477, 821, 4917, 2869, 6965,
+  1845, 5941, 3893, 7989, 181, 4277, 2229, 6325, 1205, 5301, 3253, 7349,
+  693, 4789, 2741, 6837, 1717, 5813, 3765, 7861, 437, 4533, 2485, 6581,
+  1461, 5557, 3509, 7605, 949, 5045, 2997, 7093, 1973, 6069, 4021, 8117,
+  117, 4213, 2165, 6261, 1141, 5237, 3189, 7285, 629, 4725, 2677, 6773,
+  1653, 5749, 3701, 7797, 373, 4469, 2421, 6517, 1397, 5493, 3445, 7541,
+  885, 4981, 2933, 7029, 1909, 6005, 3957, 8053, 245, 4341, 2293, 6389,
+  1269, 5365, 3317, 7413, 757, 4853, 2805, 6901, 1781, 5877, 3829, 7925,
+  501, 4597, 2549, 6645, 1525, 5621, 3573, 7669, 1013, 5109, 3061, 7157,
+  2037, 6133, 4085, 8181, 13, 4109, 2061, 6157, 1037, 5133, 3085, 7181,
+  525, 4621, 2573, 6669, 1549, 5645, 3597, 7693, 269, 4365, 2317, 6413,
+  1293, 5389, 3341, 7437, 781, 4877, 2829, 6925, 1805, 5901, 3853, 7949,
+  141, 4237, 2189, 6285, 1165, 5261, 3213, 7309, 653, 4749, 2701, 6797,
+  1677, 5773, 3725, 7821, 397, 4493, 2445, 6541, 1421, 5517, 3469, 7565,
+  909, 5005, 2957, 7053, 1933, 6029, 3981, 8077, 77, 4173, 2125, 6221,
+  1101, 5197, 3149, 7245, 589, 4685, 2637, 6733, 1613, 5709, 3661, 7757,
+  333, 4429, 2381, 6477, 1357, 5453, 3405, 7501, 845, 4941, 2893, 6989,
+  1869, 5965, 3917, 8013, 205, 4301, 2253, 6349, 1229, 5325, 3277, 7373,
+  717, 4813, 2765, 6861, 1741, 5837, 3789, 7885, 461, 4557, 2509, 6605,
+  1485, 5581, 3533, 7629, 973, 5069, 3021, 7117, 1997, 6093, 4045, 8141,
+  45, 4141, 2093, 6189, 1069, 5165, 3117, 7213, 557, 4653, 2605, 6701,
+  1581, 5677, 3629, 7725, 301, 4397, 2349, 6445, 1325, 5421, 3373, 7469,
+  813, 4909, 2861, 6957, 1837, 5933, 3885, 7981, 173, 4269, 2221, 6317,
+  1197, 5293, 3245, 7341, 685, 4781, 2733, 6829, 1709, 5805, 3757, 7853,
+  429, 4525, 2477, 6573, 1453, 5549, 3501, 7597, 941, 5037, 2989, 7085,
+  1965, 6061, 4013, 8109, 109, 4205, 2157, 6253, 1133, 5229, 3181, 7277,
+  621, 4717, 2669, 6765, 1645, 5741, 3693, 7789, 365, 4461, 2413, 6509,
+  1389, 5485, 3437, 7533, 877, 4973, 2925, 7021, 1901, 5997, 3949, 8045,
+  237, 4333, 2285, 6381, 1261, 5357, 3309, 7405, 749, 4845, 2797, 6893,
+  1773, 5869, 3821, 7917, 493, 4589, 2541, 6637, 1517, 5613, 3565, 7661,
+  1005, 5101, 3053, 7149, 2029, 6125, 4077, 8173, 29, 4125, 2077, 6173,
+  1053, 5149, 3101, 7197, 541, 4637, 2589, 6685, 1565, 5661, 3613, 7709,
+  285, 4381, 2333, 6429, 1309, 5405, 3357, 7453, 797, 4893, 2845, 6941,
+  1821, 5917, 3869, 7965, 157, 4253, 2205, 6301, 1181, 5277, 3229, 7325,
+  669, 4765, 2717, 6813, 1693, 5789, 3741, 7837, 413, 4509, 2461, 6557,
+  1437, 5533, 3485, 7581, 925, 5021, 2973, 7069, 1949, 6045, 3997, 8093,
+  93, 4189, 2141, 6237, 1117, 5213, 3165, 7261, 605, 4701, 2653, 6749,
+  1629, 5725, 3677, 7773, 349, 4445, 2397, 6493, 1373, 5469, 3421, 7517,
+  861, 4957, 2909, 7005, 1885, 5981, 3933, 8029, 221, 4317, 2269, 6365,
+  1245, 5341, 3293, 7389, 733, 4829, 2781, 6877, 1757, 5853, 3805, 7901,
+  477, 4573, 2525, 6621, 1501, 5597, 3549, 7645, 989, 5085, 3037, 7133,
+  2013, 6109, 4061, 8157, 61, 4157, 2109, 6205, 1085, 5181, 3133, 7229,
+  573, 4669, 2621, 6717, 1597, 5693, 3645, 7741, 317, 4413, 2365, 6461,
+  1341, 5437, 3389, 7485, 829, 4925, 2877, 6973, 1853, 5949, 3901, 7997,
+  189, 4285, 2237, 6333, 1213, 5309, 3261, 7357, 701, 4797, 2749, 6845,
+  1725, 5821, 3773, 7869, 445, 4541, 2493, 6589, 1469, 5565, 3517, 7613,
+  957, 5053, 3005, 7101, 1981, 6077, 4029, 8125, 125, 4221, 2173, 6269,
+  1149, 5245, 3197, 7293, 637, 4733, 2685, 6781, 1661, 5757, 3709, 7805,
+  381, 4477, 2429, 6525, 1405, 5501, 3453, 7549, 893, 4989, 2941, 7037,
+  1917, 6013, 3965, 8061, 253, 4349, 2301, 6397, 1277, 5373, 3325, 7421,
+  765, 4861, 2813, 6909, 1789, 5885, 3837, 7933, 509, 4605, 2557, 6653,
+  1533, 5629, 3581, 7677, 1021, 5117, 3069, 7165, 2045, 6141, 4093, 8189,
+  3, 4099, 2051, 6147, 1027, 5123, 3075, 7171, 515, 4611, 2563, 6659,
+  1539, 5635, 3587, 7683, 259, 4355, 2307, 6403, 1283, 5379, 3331, 7427,
+  771, 4867, 2819, 6915, 1795, 5891, 3843, 7939, 131, 4227, 2179, 6275,
+  1155, 5251, 3203, 7299, 643, 4739, 2691, 6787, 1667, 5763, 3715, 7811,
+  387, 4483, 2435, 6531, 1411, 5507, 3459, 7555, 899, 4995, 2947, 7043,
+  1923, 6019, 3971, 8067, 67, 4163, 2115, 6211, 1091, 5187, 3139, 7235,
+  579, 4675, 2627, 6723, 1603, 5699, 3651, 7747, 323, 4419, 2371, 6467,
+  1347, 5443, 3395, 7491, 835, 4931, 2883, 6979, 1859, 5955, 3907, 8003,
+  195, 4291, 2243, 6339, 1219, 5315, 3267, 7363, 707, 4803, 2755, 6851,
+  1731, 5827, 3779, 7875, 451, 4547, 2499, 6595, 1475, 5571, 3523, 7619,
+  963, 5059, 3011, 7107, 1987, 6083, 4035, 8131, 35, 4131, 2083, 6179,
+  1059, 5155, 3107, 7203, 547, 4643, 2595, 6691, 1571, 5667, 3619, 7715,
+  291, 4387, 2339, 6435, 1315, 5411, 3363, 7459, 803, 4899, 2851, 6947,
+  1827, 5923, 3875, 7971, 163, 4259, 2211, 6307, 1187, 5283, 3235, 7331,
+  675, 4771, 2723, 6819, 1699, 5795, 3747, 7843, 419, 4515, 2467, 6563,
+  1443, 5539, 3491, 7587, 931, 5027, 2979, 7075, 1955, 6051, 4003, 8099,
+  99, 4195, 2147, 6243, 1123, 5219, 3171, 7267, 611, 4707, 2659, 6755,
+  1635, 5731, 3683, 7779, 355, 4451, 2403, 6499, 1379, 5475, 3427, 7523,
+  867, 4963, 2915, 7011, 1891, 5987, 3939, 8035, 227, 4323, 2275, 6371,
+  1251, 5347, 3299, 7395, 739, 4835, 2787, 6883, 1763, 5859, 3811, 7907,
+  483, 4579, 2531, 6627, 1507, 5603, 3555, 7651, 995, 5091, 3043, 7139,
+  2019, 6115, 4067, 8163, 19, 4115, 2067, 6163, 1043, 5139, 3091, 7187,
+  531, 4627, 2579, 6675, 1555, 5651, 3603, 7699, 275, 4371, 2323, 6419,
+  1299, 5395, 3347, 7443, 787, 4883, 2835, 6931, 1811, 5907, 3859, 7955,
+  147, 4243, 2195, 6291, 1171, 5267, 3219, 7315, 659, 4755, 2707, 6803,
+  1683, 5779, 3731, 7827, 403, 4499, 2451, 6547, 1427, 5523, 3475, 7571,
+  915, 5011, 2963, 7059, 1939, 6035, 3987, 8083, 83, 4179, 2131, 6227,
+  1107, 5203, 3155, 7251, 595, 4691, 2643, 6739, 1619, 5715, 3667, 7763,
+  339, 4435, 2387, 6483, 1363, 5459, 3411, 7507, 851, 4947, 2899, 6995,
+  1875, 5971, 3923, 8019, 211, 4307, 2259, 6355, 1235, 5331, 3283, 7379,
+  723, 4819, 2771, 6867, 1747, 5843, 3795, 7891, 467, 4563, 2515, 6611,
+  1491, 5587, 3539, 7635, 979, 5075, 3027, 7123, 2003, 6099, 4051, 8147,
+  51, 4147, 2099, 6195, 1075, 5171, 3123, 7219, 563, 4659, 2611, 6707,
+  1587, 5683, 3635, 7731, 307, 4403, 2355, 6451, 1331, 5427, 3379, 7475,
+  819, 4915, 2867, 6963, 1843, 5939, 3891, 7987, 179, 4275, 2227, 6323,
+  1203, 5299, 3251, 7347, 691, 4787, 2739, 6835, 1715, 5811, 3763, 7859,
+  435, 4531, 2483, 6579, 1459, 5555, 3507, 7603, 947, 5043, 2995, 7091,
+  1971, 6067, 4019, 8115, 115, 4211, 2163, 6259, 1139, 5235, 3187, 7283,
+  627, 4723, 2675, 6771, 1651, 5747, 3699, 7795, 371, 4467, 2419, 6515,
+  1395, 5491, 3443, 7539, 883, 4979, 2931, 7027, 1907, 6003, 3955, 8051,
+  243, 4339, 2291, 6387, 1267, 5363, 3315, 7411, 755, 4851, 2803, 6899,
+  1779, 5875, 3827, 7923, 499, 4595, 2547, 6643, 1523, 5619, 3571, 7667,
+  1011, 5107, 3059, 7155, 2035, 6131, 4083, 8179, 11, 4107, 2059, 6155,
+  1035, 5131, 3083, 7179, 523, 4619, 2571, 6667, 1547, 5643, 3595, 7691,
+  267, 4363, 2315, 6411, 1291, 5387, 3339, 7435, 779, 4875, 2827, 6923,
+  1803, 5899, 3851, 7947, 139, 4235, 2187, 6283, 1163, 5259, 3211, 7307,
+  651, 4747, 2699, 6795, 1675, 5771, 3723, 7819, 395, 4491, 2443, 6539,
+  1419, 5515, 3467, 7563, 907, 5003, 2955, 7051, 1931, 6027, 3979, 8075,
+  75, 4171, 2123, 6219, 1099, 5195, 3147, 7243, 587, 4683, 2635, 6731,
+  1611, 5707, 3659, 7755, 331, 4427, 2379, 6475, 1355, 5451, 3403, 7499,
+  843, 4939, 2891, 6987, 1867, 5963, 3915, 8011, 203, 4299, 2251, 6347,
+  1227, 5323, 3275, 7371, 715, 4811, 2763, 6859, 1739, 5835, 3787, 7883,
+  459, 4555, 2507, 6603, 1483, 5579, 3531, 7627, 971, 5067, 3019, 7115,
+  1995, 6091, 4043, 8139, 43, 4139, 2091, 6187, 1067, 5163, 3115, 7211,
+  555, 4651, 2603, 6699, 1579, 5675, 3627, 7723, 299, 4395, 2347, 6443,
+  1323, 5419, 3371, 7467, 811, 4907, 2859, 6955, 1835, 5931, 3883, 7979,
+  171, 4267, 2219, 6315, 1195, 5291, 3243, 7339, 683, 4779, 2731, 6827,
+  1707, 5803, 3755, 7851, 427, 4523, 2475, 6571, 1451, 5547, 3499, 7595,
+  939, 5035, 2987, 7083, 1963, 6059, 4011, 8107, 107, 4203, 2155, 6251,
+  1131, 5227, 3179, 7275, 619, 4715, 2667, 6763, 1643, 5739, 3691, 7787,
+  363, 4459, 2411, 6507, 1387, 5483, 3435, 7531, 875, 4971, 2923, 7019,
+  1899, 5995, 3947, 8043, 235, 4331, 2283, 6379, 1259, 5355, 3307, 7403,
+  747, 4843, 2795, 6891, 1771, 5867, 3819, 7915, 491, 4587, 2539, 6635,
+  1515, 5611, 3563, 7659, 1003, 5099, 3051, 7147, 2027, 6123, 4075, 8171,
+  27, 4123, 2075, 6171, 1051, 5147, 3099, 7195, 539, 4635, 2587, 6683,
+  1563, 5659, 3611, 7707, 283, 4379, 2331, 6427, 1307, 5403, 3355, 7451,
+  795, 4891, 2843, 6939, 1819, 5915, 3867, 7963, 155, 4251, 2203, 6299,
+  1179, 5275, 3227, 7323, 667, 4763, 2715, 6811, 1691, 5787, 3739, 7835,
+  411, 4507, 2459, 6555, 1435, 5531, 3483, 7579, 923, 5019, 2971, 7067,
+  1947, 6043, 3995, 8091, 91, 4187, 2139, 6235, 1115, 5211, 3163, 7259,
+  603, 4699, 2651, 6747, 1627, 5723, 3675, 7771, 347, 4443, 2395, 6491,
+  1371, 5467, 3419, 7515, 859, 4955, 2907, 7003, 1883, 5979, 3931, 8027,
+  219, 4315, 2267, 6363, 1243, 5339, 3291, 7387, 731, 4827, 2779, 6875,
+  1755, 5851, 3803, 7899, 475, 4571, 2523, 6619, 1499, 5595, 3547, 7643,
+  987, 5083, 3035, 7131, 2011, 6107, 4059, 8155, 59, 4155, 2107, 6203,
+  1083, 5179, 3131, 7227, 571, 4667, 2619, 6715, 1595, 5691, 3643, 7739,
+  315, 4411, 2363, 6459, 1339, 5435, 3387, 7483, 827, 4923, 2875, 6971,
+  1851, 5947, 3899, 7995, 187, 4283, 2235, 6331, 1211, 5307, 3259, 7355,
+  699, 4795, 2747, 6843, 1723, 5819, 3771, 7867, 443, 4539, 2491, 6587,
+  1467, 5563, 3515, 7611, 955, 5051, 3003, 7099, 1979, 6075, 4027, 8123,
+  123, 4219, 2171, 6267, 1147, 5243, 3195, 7291, 635, 4731, 2683, 6779,
+  1659, 5755, 3707, 7803, 379, 4475, 2427, 6523, 1403, 5499, 3451, 7547,
+  891, 4987, 2939, 7035, 1915, 6011, 3963, 8059, 251, 4347, 2299, 6395,
+  1275, 5371, 3323, 7419, 763, 4859, 2811, 6907, 1787, 5883, 3835, 7931,
+  507, 4603, 2555, 6651, 1531, 5627, 3579, 7675, 1019, 5115, 3067, 7163,
+  2043, 6139, 4091, 8187, 7, 4103, 2055, 6151, 1031, 5127, 3079, 7175,
+  519, 4615, 2567, 6663, 1543, 5639, 3591, 7687, 263, 4359, 2311, 6407,
+  1287, 5383, 3335, 7431, 775, 4871, 2823, 6919, 1799, 5895, 3847, 7943,
+  135, 4231, 2183, 6279, 1159, 5255, 3207, 7303, 647, 4743, 2695, 6791,
+  1671, 5767, 3719, 7815, 391, 4487, 2439, 6535, 1415, 5511, 3463, 7559,
+  903, 4999, 2951, 7047, 1927, 6023, 3975, 8071, 71, 4167, 2119, 6215,
+  1095, 5191, 3143, 7239, 583, 4679, 2631, 6727, 1607, 5703, 3655, 7751,
+  327, 4423, 2375, 6471, 1351, 5447, 3399, 7495, 839, 4935, 2887, 6983,
+  1863, 5959, 3911, 8007, 199, 4295, 2247, 6343, 1223, 5319, 3271, 7367,
+  711, 4807, 2759, 6855, 1735, 5831, 3783, 7879, 455, 4551, 2503, 6599,
+  1479, 5575, 3527, 7623, 967, 5063, 3015, 7111, 1991, 6087, 4039, 8135,
+  39, 4135, 2087, 6183, 1063, 5159, 3111, 7207, 551, 4647, 2599, 6695,
+  1575, 5671, 3623, 7719, 295, 4391, 2343, 6439, 1319, 5415, 3367, 7463,
+  807, 4903, 2855, 6951, 1831, 5927, 3879, 7975, 167, 4263, 2215, 6311,
+  1191, 5287, 3239, 7335, 679, 4775, 2727, 6823, 1703, 5799, 3751, 7847,
+  423, 4519, 2471, 6567, 1447, 5543, 3495, 7591, 935, 5031, 2983, 7079,
+  1959, 6055, 4007, 8103, 103, 4199, 2151, 6247, 1127, 5223, 3175, 7271,
+  615, 4711, 2663, 6759, 1639, 5735, 3687, 7783, 359, 4455, 2407, 6503,
+  1383, 5479, 3431, 7527, 871, 4967, 2919, 7015, 1895, 5991, 3943, 8039,
+  231, 4327, 2279, 6375, 1255, 5351, 3303, 7399, 743, 4839, 2791, 6887,
+  1767, 5863, 3815, 7911, 487, 4583, 2535, 6631, 1511, 5607, 3559, 7655,
+  999, 5095, 3047, 7143, 2023, 6119, 4071, 8167, 23, 4119, 2071, 6167,
+  1047, 5143, 3095, 7191, 535, 4631, 2583, 6679, 1559, 5655, 3607, 7703,
+  279, 4375, 2327, 6423, 1303, 5399, 3351, 7447, 791, 4887, 2839, 6935,
+  1815, 5911, 3863, 7959, 151, 4247, 2199, 6295, 1175, 5271, 3223, 7319,
+  663, 4759, 2711, 6807, 1687, 5783, 3735, 7831, 407, 4503, 2455, 6551,
+  1431, 5527, 3479, 7575, 919, 5015, 2967, 7063, 1943, 6039, 3991, 8087,
+  87, 4183, 2135, 6231, 1111, 5207, 3159, 7255, 599, 4695, 2647, 6743,
+  1623, 5719, 3671, 7767, 343, 4439, 2391, 6487, 1367, 5463, 3415, 7511,
+  855, 4951, 2903, 6999, 1879, 5975, 3927, 8023, 215, 4311, 2263, 6359,
+  1239, 5335, 3287, 7383, 727, 4823, 2775, 6871, 1751, 5847, 3799, 7895,
+  471, 4567, 2519, 6615, 1495, 5591, 3543, 7639, 983, 5079, 3031, 7127,
+  2007, 6103, 4055, 8151, 55, 4151, 2103, 6199, 1079, 5175, 3127, 7223,
+  567, 4663, 2615, 6711, 1591, 5687, 3639, 7735, 311, 4407, 2359, 6455,
+  1335, 5431, 3383, 7479, 823, 4919, 2871, 6967, 1847, 5943, 3895, 7991,
+  183, 4279, 2231, 6327, 1207, 5303, 3255, 7351, 695, 4791, 2743, 6839,
+  1719, 5815, 3767, 7863, 439, 4535, 2487, 6583, 1463, 5559, 3511, 7607,
+  951, 5047, 2999, 7095, 1975, 6071, 4023, 8119, 119, 4215, 2167, 6263,
+  1143, 5239, 3191, 7287, 631, 4727, 2679, 6775, 1655, 5751, 3703, 7799,
+  375, 4471, 2423, 6519, 1399, 5495, 3447, 7543, 887, 4983, 2935, 7031,
+  1911, 6007, 3959, 8055, 247, 4343, 2295, 6391, 1271, 5367, 3319, 7415,
+  759, 4855, 2807, 6903, 1783, 5879, 3831, 7927, 503, 4599, 2551, 6647,
+  1527, 5623, 3575, 7671, 1015, 5111, 3063, 7159, 2039, 6135, 4087, 8183,
+  15, 4111, 2063, 6159, 1039, 5135, 3087, 7183, 527, 4623, 2575, 6671,
+  1551, 5647, 3599, 7695, 271, 4367, 2319, 6415, 1295, 5391, 3343, 7439,
+  783, 4879, 2831, 6927, 1807, 5903, 3855, 7951, 143, 4239, 2191, 6287,
+  1167, 5263, 3215, 7311, 655, 4751, 2703, 6799, 1679, 5775, 3727, 7823,
+  399, 4495, 2447, 6543, 1423, 5519, 3471, 7567, 911, 5007, 2959, 7055,
+  1935, 6031, 3983, 8079, 79, 4175, 2127, 6223, 1103, 5199, 3151, 7247,
+  591, 4687, 2639, 6735, 1615, 5711, 3663, 7759, 335, 4431, 2383, 6479,
+  1359, 5455, 3407, 7503, 847, 4943, 2895, 6991, 1871, 5967, 3919, 8015,
+  207, 4303, 2255, 6351, 1231, 5327, 3279, 7375, 719, 4815, 2767, 6863,
+  1743, 5839, 3791, 7887, 463, 4559, 2511, 6607, 1487, 5583, 3535, 7631,
+  975, 5071, 3023, 7119, 1999, 6095, 4047, 8143, 47, 4143, 2095, 6191,
+  1071, 5167, 3119, 7215, 559, 4655, 2607, 6703, 1583, 5679, 3631, 7727,
+  303, 4399, 2351, 6447, 1327, 5423, 3375, 7471, 815, 4911, 2863, 6959,
+  1839, 5935, 3887, 7983, 175, 4271, 2223, 6319, 1199, 5295, 3247, 7343,
+  687, 4783, 2735, 6831, 1711, 5807, 3759, 7855, 431, 4527, 2479, 6575,
+  1455, 5551, 3503, 7599, 943, 5039, 2991, 7087, 1967, 6063, 4015, 8111,
+  111, 4207, 2159, 6255, 1135, 5231, 3183, 7279, 623, 4719, 2671, 6767,
+  1647, 5743, 3695, 7791, 367, 4463, 2415, 6511, 1391, 5487, 3439, 7535,
+  879, 4975, 2927, 7023, 1903, 5999, 3951, 8047, 239, 4335, 2287, 6383,
+  1263, 5359, 3311, 7407, 751, 4847, 2799, 6895, 1775, 5871, 3823, 7919,
+  495, 4591, 2543, 6639, 1519, 5615, 3567, 7663, 1007, 5103, 3055, 7151,
+  2031, 6127, 4079, 8175, 31, 4127, 2079, 6175, 1055, 5151, 3103, 7199,
+  543, 4639, 2591, 6687, 1567, 5663, 3615, 7711, 287, 4383, 2335, 6431,
+  1311, 5407, 3359, 7455, 799, 4895, 2847, 6943, 1823, 5919, 3871, 7967,
+  159, 4255, 2207, 6303, 1183, 5279, 3231, 7327, 671, 4767, 2719, 6815,
+  1695, 5791, 3743, 7839, 415, 4511, 2463, 6559, 1439, 5535, 3487, 7583,
+  927, 5023, 2975, 7071, 1951, 6047, 3999, 8095, 95, 4191, 2143, 6239,
+  1119, 5215, 3167, 7263, 607, 4703, 2655, 6751, 1631, 5727, 3679, 7775,
+  351, 4447, 2399, 6495, 1375, 5471, 3423, 7519, 863, 4959, 2911, 7007,
+  1887, 5983, 3935, 8031, 223, 4319, 2271, 6367, 1247, 5343, 3295, 7391,
+  735, 4831, 2783, 6879, 1759, 5855, 3807, 7903, 479, 4575, 2527, 6623,
+  1503, 5599, 3551, 7647, 991, 5087, 3039, 7135, 2015, 6111, 4063, 8159,
+  63, 4159, 2111, 6207, 1087, 5183, 3135, 7231, 575, 4671, 2623, 6719,
+  1599, 5695, 3647, 7743, 319, 4415, 2367, 6463, 1343, 5439, 3391, 7487,
+  831, 4927, 2879, 6975, 1855, 5951, 3903, 7999, 191, 4287, 2239, 6335,
+  1215, 5311, 3263, 7359, 703, 4799, 2751, 6847, 1727, 5823, 3775, 7871,
+  447, 4543, 2495, 6591, 1471, 5567, 3519, 7615, 959, 5055, 3007, 7103,
+  1983, 6079, 4031, 8127, 127, 4223, 2175, 6271, 1151, 5247, 3199, 7295,
+  639, 4735, 2687, 6783, 1663, 5759, 3711, 7807, 383, 4479, 2431, 6527,
+  1407, 5503, 3455, 7551, 895, 4991, 2943, 7039, 1919, 6015, 3967, 8063,
+  255, 4351, 2303, 6399, 1279, 5375, 3327, 7423, 767, 4863, 2815, 6911,
+  1791, 5887, 3839, 7935, 511, 4607, 2559, 6655, 1535, 5631, 3583, 7679,
+  1023, 5119, 3071, 7167, 2047, 6143, 4095, 8191
+};
+
+static const unsigned int * const fft_static_bitrev[6] =
+{
+  fft_static_bitrev_256,
+  fft_static_bitrev_512,
+  fft_static_bitrev_1024,
+  fft_static_bitrev_2048,
+  fft_static_bitrev_4096,
+  fft_static_bitrev_8192
+};
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE)
+
+#define FFT_STATIC_SIN 1
+
+static const float fft_static_sin_256[321] =
+{
+  0.f, 0.024541229f, 0.0490676761f, 0.0735645667f, 0.0980171412f,
+  0.122410677f, 0.146730468f, 0.170961887f, 0.195090324f, 0.219101235f,
+  0.242980182f, 0.266712755f, 0.290284663f, 0.313681751f, 0.336889863f,
+  0.359895051f, 0.382683426f, 0.405241311f, 0.427555084f, 0.449611336f,
+  0.471396744f, 0.492898196f, 0.514102757f, 0.534997642f, 0.555570245f,
+  0.575808167f, 0.59569931f, 0.615231574f, 0.634393275f, 0.653172851f,
+  0.671558976f, 0.689540565f, 0.707106769f, 0.724247098f, 0.740951121f,
+  0.757208824f, 0.773010433f, 0.78834641f, 0.803207517f, 0.817584813f,
+  0.831469595f, 0.84485358f, 0.857728601f, 0.870086968f, 0.881921291f,
+  0.893224299f, 0.903989315f, 0.914209783f, 0.923879504f, 0.932992816f,
+  0.941544056f, 0.949528158f, 0.956940353f, 0.963776052f, 0.970031261f,
+  0.975702107f, 0.980785251f, 0.985277653f, 0.989176512f, 0.992479563f,
+  0.99518472f, 0.997290432f, 0.99879545f, 0.999698818f, 1.f,
+  0.999698818f, 0.99879545f, 0.997290432f, 0.99518472f, 0.992479563f,
+  0.989176512f, 0.985277653f, 0.980785251f, 0.975702107f, 0.970031261f,
+  0.963776052f, 0.956940353f, 0.949528158f, 0.941544056f, 0.932992816f,
+  0.923879504f, 0.914209783f, 0.903989315f, 0.893224299f, 0.881921291f,
+  0.870086968f, 0.857728601f, 0.84485358f, 0.831469595f, 0.817584813f,
+  0.803207517f, 0.78834641f, 0.773010433f, 0.757208824f, 0.740951121f,
+  0.724247098f, 0.707106769f, 0.689540565f, 0.671558976f, 0.653172851f,
+  0.634393275f, 0.615231574f, 0.59569931f, 0.575808167f, 0.555570245f,
+  0.534997642f, 0.514102757f, 0.492898196f, 0.471396744f, 0.449611336f,
+  0.427555084f, 0.405241311f, 0.382683426f, 0.359895051f, 0.336889863f,
+  0.313681751f, 0.290284663f, 0.266712755f, 0.242980182f, 0.219101235f,
+  0.195090324f, 0.170961887f, 0.146730468f, 0.122410677f, 0.0980171412f,
+  0.0735645667f, 0.0490676761f, 0.024541229f, 0.f, -0.024541229f,
+  -0.0490676761f, -0.0735645667f, -0.0980171412f, -0.122410677f, -0.146730468f,
+  -0.170961887f, -0.195090324f, -0.219101235f, -0.242980182f, -0.266712755f,
+  -0.290284663f, -0.313681751f, -0.336889863f, -0.359895051f, -0.382683426f,
+  -0.405241311f, -0.427555084f, -0.449611336f, -0.471396744f, -0.492898196f,
+  -0.514102757f, -0.534997642f, -0.555570245f, -0.575808167f, -0.59569931f,
+  -0.615231574f, -0.634393275f, -0.653172851f, -0.671558976f, -0.689540565f,
+  -0.707106769f, -0.724247098f, -0.740951121f, -0.757208824f, -0.773010433f,
+  -0.78834641f, -0.803207517f, -0.817584813f, -0.831469595f, -0.84485358f,
+  -0.857728601f, -0.870086968f, -0.881921291f, -0.893224299f, -0.903989315f,
+  -0.914209783f, -0.923879504f, -0.932992816f, -0.941544056f, -0.949528158f,
+  -0.956940353f, -0.963776052f, -0.970031261f, -0.975702107f, -0.980785251f,
+  -0.985277653f, -0.989176512f, -0.992479563f, -0.99518472f, -0.997290432f,
+  -0.99879545f, -0.999698818f, -1.f, -0.999698818f, -0.99879545f,
+  -0.997290432f, -0.99518472f, -0.992479563f, -0.989176512f, -0.985277653f,
+  -0.980785251f, -0.975702107f, -0.970031261f, -0.963776052f, -0.956940353f,
+  -0.949528158f, -0.941544056f, -0.932992816f, -0.923879504f, -0.914209783f,
+  -0.903989315f, -0.893224299f, -0.881921291f, -0.870086968f, -0.857728601f,
+  -0.84485358f, -0.831469595f, -0.817584813f, -0.803207517f, -0.78834641f,
+  -0.773010433f, -0.757208824f, -0.740951121f, -0.724247098f, -0.707106769f,
+  -0.689540565f, -0.671558976f, -0.653172851f, -0.634393275f, -0.615231574f,
+  -0.59569931f, -0.575808167f, -0.555570245f, -0.534997642f, -0.514102757f,
+  -0.492898196f, -0.471396744f, -0.449611336f, -0.427555084f, -0.405241311f,
+  -0.382683426f, -0.359895051f, -0.336889863f, -0.313681751f, -0.290284663f,
+  -0.266712755f, -0.242980182f, -0.219101235f, -0.195090324f, -0.170961887f,
+  -0.146730468f, -0.122410677f, -0.0980171412f, -0.0735645667f, -0.0490676761f,
+  -0.024541229f, 0.f, 0.024541229f, 0.0490676761f, 0.0735645667f,
+  0.0980171412f, 0.122410677f, 0.146730468f, 0.170961887f, 0.195090324f,
+  0.219101235f, 0.242980182f, 0.266712755f, 0.290284663f, 0.313681751f,
+  0.336889863f, 0.359895051f, 0.382683426f, 0.405241311f, 0.427555084f,
+  0.449611336f, 0.471396744f, 0.492898196f, 0.514102757f, 0.534997642f,
+  0.555570245f, 0.575808167f, 0.59569931f, 0.615231574f, 0.634393275f,
+  0.653172851f, 0.671558976f, 0.689540565f, 0.707106769f, 0.724247098f,
+  0.740951121f, 0.757208824f, 0.773010433f, 0.78834641f, 0.803207517f,
+  0.817584813f, 0.831469595f, 0.84485358f, 0.857728601f, 0.870086968f,
+  0.881921291f, 0.893224299f, 0.903989315f, 0.914209783f, 0.923879504f,
+  0.932992816f, 0.941544056f, 0.949528158f, 0.956940353f, 0.963776052f,
+  0.970031261f, 0.975702107f, 0.980785251f, 0.985277653f, 0.989176512f,
+  0.992479563f, 0.99518472f, 0.997290432f, 0.99879545f, 0.999698818f,
+  1.f
+};
+
+static const float fft_static_sin_512[641] =
+{
+  0.f, 0.0122715384f, 0.024541229f, 0.0368072242f, 0.0490676761f,
+  0.061320737f, 0.0735645667f, 0.0857973099f, 0.0980171412f, 0.110222206f,
+  0.122410677f, 0.134580702f, 0.146730468f, 0.15885815f, 0.170961887f,
+  0.183039889f, 0.195090324f, 0.207111374f, 0.219101235f, 0.231058106f,
+  0.242980182f, 0.254865646f, 0.266712755f, 0.27851969f, 0.290284663f,
+  0.302005947f, 0.313681751f, 0.32531029f, 0.336889863f, 0.348418683f,
+  0.359895051f, 0.371317208f, 0.382683426f, 0.393992037f, 0.405241311f,
+  0.416429549f, 0.427555084f, 0.438616246f, 0.449611336f, 0.460538715f,
+  0.471396744f, 0.482183784f, 0.492898196f, 0.50353837f, 0.514102757f,
+  0.524589658f, 0.534997642f, 0.545324981f, 0.555570245f, 0.565731823f,
+  0.575808167f, 0.585797846f, 0.59569931f, 0.605511069f, 0.615231574f,
+  0.624859512f, 0.634393275f, 0.643831551f, 0.653172851f, 0.662415802f,
+  0.671558976f, 0.680601001f, 0.689540565f, 0.698376238f, 0.707106769f,
+  0.715730846f, 0.724247098f, 0.732654274f, 0.740951121f, 0.749136388f,
+  0.757208824f, 0.765167236f, 0.773010433f, 0.780737221f, 0.78834641f,
+  0.795836926f, 0.803207517f, 0.81045717f, 0.817584813f, 0.824589312f,
+  0.831469595f, 0.838224709f, 0.84485358f, 0.851355195f, 0.857728601f,
+  0.863972843f, 0.870086968f, 0.876070082f, 0.881921291f, 0.887639642f,
+  0.893224299f, 0.898674488f, 0.903989315f, 0.909168005f, 0.914209783f,
+  0.919113874f, 0.923879504f, 0.928506076f, 0.932992816f, 0.937339008f,
+  0.941544056f, 0.945607305f, 0.949528158f, 0.953306019f, 0.956940353f,
+  0.960430503f, 0.963776052f, 0.966976464f, 0.970031261f, 0.972939968f,
+  0.975702107f, 0.97831738f, 0.980785251f, 0.983105481f, 0.985277653f,
+  0.987301409f, 0.989176512f, 0.990902662f, 0.992479563f, 0.993906975f,
+  0.99518472f, 0.996312618f, 0.997290432f, 0.998118103f, 0.99879545f,
+  0.999322355f, 0.999698818f, 0.999924719f, 1.f, 0.999924719f,
+  0.999698818f, 0.999322355f, 0.99879545f, 0.998118103f, 0.997290432f,
+  0.996312618f, 0.99518472f, 0.993906975f, 0.992479563f, 0.990902662f,
+  0.989176512f, 0.987301409f, 0.985277653f, 0.983105481f, 0.980785251f,
+  0.97831738f, 0.975702107f, 0.972939968f, 0.970031261f, 0.966976464f,
+  0.963776052f, 0.960430503f, 0.956940353f, 0.953306019f, 0.949528158f,
+  0.945607305f, 0.941544056f, 0.937339008f, 0.932992816f, 0.928506076f,
+  0.923879504f, 0.919113874f, 0.914209783f, 0.909168005f, 0.903989315f,
+  0.898674488f, 0.893224299f, 0.887639642f, 0.881921291f, 0.876070082f,
+  0.870086968f, 0.863972843f, 0.857728601f, 0.851355195f, 0.84485358f,
+  0.838224709f, 0.831469595f, 0.824589312f, 0.817584813f, 0.81045717f,
+  0.803207517f, 0.795836926f, 0.78834641f, 0.780737221f, 0.773010433f,
+  0.765167236f, 0.757208824f, 0.749136388f, 0.740951121f, 0.732654274f,
+  0.724247098f, 0.715730846f, 0.707106769f, 0.698376238f, 0.689540565f,
+  0.680601001f, 0.671558976f, 0.662415802f, 0.653172851f, 0.643831551f,
+  0.634393275f, 0.624859512f, 0.615231574f, 0.605511069f, 0.59569931f,
+  0.585797846f, 0.575808167f, 0.565731823f, 0.555570245f, 0.545324981f,
+  0.534997642f, 0.524589658f, 0.514102757f, 0.50353837f, 0.492898196f,
+  0.482183784f, 0.471396744f, 0.460538715f, 0.449611336f, 0.438616246f,
+  0.427555084f, 0.416429549f, 0.405241311f, 0.393992037f, 0.382683426f,
+  0.371317208f, 0.359895051f, 0.348418683f, 0.336889863f, 0.32531029f,
+  0.313681751f, 0.302005947f, 0.290284663f, 0.27851969f, 0.266712755f,
+  0.254865646f, 0.242980182f, 0.231058106f, 0.219101235f, 0.207111374f,
+  0.195090324f, 0.183039889f, 0.170961887f, 0.15885815f, 0.146730468f,
+  0.134580702f, 0.122410677f, 0.110222206f, 0.0980171412f, 0.0857973099f,
+  0.0735645667f, 0.061320737f, 0.0490676761f, 0.0368072242f, 0.024541229f,
+  0.0122715384f, 0.f, -0.0122715384f, -0.024541229f, -0.0368072242f,
+  -0.0490676761f, -0.061320737f, -0.0735645667f, -0.0857973099f, -0.0980171412f,
+  -0.110222206f, -0.122410677f, -0.134580702f, -0.146730468f, -0.15885815f,
+  -0.170961887f, -0.183039889f, -0.195090324f, -0.207111374f, -0.219101235f,
+  -0.231058106f, -0.242980182f, -0.254865646f, -0.266712755f, -0.27851969f,
+  -0.290284663f, -0.302005947f, -0.313681751f, -0.32531029f, -0.336889863f,
+  -0.348418683f, -0.359895051f, -0.371317208f, -0.382683426f, -0.393992037f,
+  -0.405241311f, -0.416429549f, -0.427555084f, -0.438616246f, -0.449611336f,
+  -0.460538715f, -0.471396744f, -0.482183784f, -0.492898196f, -0.50353837f,
+  -0.514102757f, -0.524589658f, -0.534997642f, -0.545324981f, -0.555570245f,
+  -0.565731823f, -0.575808167f, -0.585797846f, -0.59569931f, -0.605511069f,
+  -0.615231574f, -0.624859512f, -0.634393275f, -0.643831551f, -0.653172851f,
+  -0.662415802f, -0.671558976f, -0.680601001f, -0.689540565f, -0.698376238f,
+  -0.707106769f, -0.715730846f, -0.724247098f, -0.732654274f, -0.740951121f,
+  -0.749136388f, -0.757208824f, -0.765167236f, -0.773010433f, -0.780737221f,
+  -0.78834641f, -0.795836926f, -0.803207517f, -0.81045717f, -0.817584813f,
+  -0.824589312f, -0.831469595f, -0.838224709f, -0.84485358f, -0.851355195f,
+  -0.857728601f, -0.863972843f, -0.870086968f, -0.876070082f, -0.881921291f,
+  -0.887639642f, -0.893224299f, -0.898674488f, -0.903989315f, -0.909168005f,
+  -0.914209783f, -0.919113874f, -0.923879504f, -0.928506076f, -0.932992816f,
+  -0.937339008f, -0.941544056f, -0.945607305f, -0.949528158f, -0.953306019f,
+  -0.956940353f, -0.960430503f, -0.963776052f, -0.966976464f, -0.970031261f,
+  -0.972939968f, -0.975702107f, -0.97831738f, -0.980785251f, -0.983105481f,
+  -0.985277653f, -0.987301409f, -0.989176512f, -0.990902662f, -0.992479563f,
+  -0.993906975f, -0.99518472f, -0.996312618f, -0.997290432f, -0.998118103f,
+  -0.99879545f, -0.999322355f, -0.999698818f, -0.999924719f, -1.f,
+  -0.999924719f, -0.999698818f, -0.999322355f, -0.99879545f, -0.998118103f,
+  -0.997290432f, -0.996312618f, -0.99518472f, -0.993906975f, -0.992479563f,
+  -0.990902662f, -0.989176512f, -0.987301409f, -0.985277653f, -0.983105481f,
+  -0.980785251f, -0.97831738f, -0.975702107f, -0.972939968f, -0.970031261f,
+  -0.966976464f, -0.963776052f, -0.960430503f, -0.956940353f, -0.953306019f,
+  -0.949528158f, -0.945607305f, -0.941544056f, -0.937339008f, -0.932992816f,
+  -0.928506076f, -0.923879504f, -0.919113874f, -0.914209783f, -0.909168005f,
+  -0.903989315f, -0.898674488f, -0.893224299f, -0.887639642f, -0.881921291f,
+  -0.876070082f, -0.870086968f, -0.863972843f, -0.857728601f, -0.851355195f,
+  -0.84485358f, -0.838224709f, -0.831469595f, -0.824589312f, -0.817584813f,
+  -0.81045717f, -0.803207517f, -0.795836926f, -0.78834641f, -0.780737221f,
+  -0.773010433f, -0.765167236f, -0.757208824f, -0.749136388f, -0.740951121f,
+  -0.732654274f, -0.724247098f, -0.715730846f, -0.707106769f, -0.698376238f,
+  -0.689540565f, -0.680601001f, -0.671558976f, -0.662415802f, -0.653172851f,
+  -0.643831551f, -0.634393275f, -0.624859512f, -0.615231574f, -0.605511069f,
+  -0.59569931f, -0.585797846f, -0.575808167f, -0.565731823f, -0.555570245f,
+  -0.545324981f, -0.534997642f, -0.524589658f, -0.514102757f, -0.50353837f,
+  -0.492898196f, -0.482183784f, -0.471396744f, -0.460538715f, -0.449611336f,
+  -0.438616246f, -0.427555084f, -0.416429549f, -0.405241311f, -0.393992037f,
+  -0.382683426f, -0.371317208f, -0.359895051f, -0.348418683f, -0.336889863f,
+  -0.32531029f, -0.313681751f, -0.302005947f, -0.290284663f, -0.27851969f,
+  -0.266712755f, -0.254865646f, -0.242980182f, -0.231058106f, -0.219101235f,
+  -0.207111374f, -0.195090324f, -0.183039889f, -0.170961887f, -0.15885815f,
+  -0.146730468f, -0.134580702f, -0.122410677f, -0.110222206f, -0.0980171412f,
+  -0.0857973099f, -0.0735645667f, -0.061320737f, -0.0490676761f, -0.0368072242f,
+  -0.024541229f, -0.0122715384f, 0.f, 0.0122715384f, 0.024541229f,
+  0.0368072242f, 0.0490676761f, 0.061320737f, 0.0735645667f, 0.0857973099f,
+  0.0980171412f, 0.110222206f, 0.122410677f, 0.134580702f, 0.146730468f,
+  0.15885815f, 0.170961887f, 0.183039889f, 0.195090324f, 0.207111374f,
+  0.219101235f, 0.231058106f, 0.242980182f, 0.254865646f, 0.266712755f,
+  0.27851969f, 0.290284663f, 0.302005947f, 0.313681751f, 0.32531029f,
+  0.336889863f, 0.348418683f, 0.359895051f, 0.371317208f, 0.382683426f,
+  0.393992037f, 0.405241311f, 0.416429549f, 0.427555084f, 0.438616246f,
+  0.449611336f, 0.460538715f, 0.471396744f, 0.482183784f, 0.492898196f,
+  0.50353837f, 0.514102757f, 0.524589658f, 0.534997642f, 0.545324981f,
+  0.555570245f, 0.565731823f, 0.575808167f, 0.585797846f, 0.59569931f,
+  0.605511069f, 0.615231574f, 0.624859512f, 0.634393275f, 0.643831551f,
+  0.653172851f, 0.662415802f, 0.671558976f, 0.680601001f, 0.689540565f,
+  0.698376238f, 0.707106769f, 0.715730846f, 0.724247098f, 0.732654274f,
+  0.740951121f, 0.749136388f, 0.757208824f, 0.765167236f, 0.773010433f,
+  0.780737221f, 0.78834641f, 0.795836926f, 0.803207517f, 0.81045717f,
+  0.817584813f, 0.824589312f, 0.831469595f, 0.838224709f, 0.84485358f,
+  0.851355195f, 0.857728601f, 0.863972843f, 0.870086968f, 0.876070082f,
+  0.881921291f, 0.887639642f, 0.893224299f, 0.898674488f, 0.903989315f,
+  0.909168005f, 0.914209783f, 0.919113874f, 0.923879504f, 0.928506076f,
+  0.932992816f, 0.937339008f, 0.941544056f, 0.945607305f, 0.949528158f,
+  0.953306019f, 0.956940353f, 0.960430503f, 0.963776052f, 0.966976464f,
+  0.970031261f, 0.972939968f, 0.975702107f, 0.97831738f, 0.980785251f,
+  0.983105481f, 0.985277653f, 0.987301409f, 0.989176512f, 0.990902662f,
+  0.992479563f, 0.993906975f, 0.99518472f, 0.996312618f, 0.997290432f,
+  0.998118103f, 0.99879545f, 0.999322355f, 0.999698818f, 0.999924719f,
+  1.f
+};
+
+static const float fft_static_sin_1024[1281] =
+{
+  0.f, 0.00613588467f, 0.0122715384f, 0.0184067301f, 0.024541229f,
+  0.030674804f, 0.0368072242f, 0.0429382585f, 0.0490676761f, 0.0551952459f,
+  0.061320737f, 0.0674439222f, 0.0735645667f, 0.0796824396f, 0.0857973099f,
+  0.0919089541f, 0.0980171412f, 0.104121633f, 0.110222206f, 0.116318628f,
+  0.122410677f, 0.128498107f, 0.134580702f, 0.140658244f, 0.146730468f,
+  0.152797192f, 0.15885815f, 0.164913118f, 0.170961887f, 0.177004218f,
+  0.183039889f, 0.18906866f, 0.195090324f, 0.201104641f, 0.207111374f,
+  0.213110313f, 0.219101235f, 0.225083917f, 0.231058106f, 0.237023607f,
+  0.242980182f, 0.248927608f, 0.254865646f, 0.260794103f, 0.266712755f,
+  0.272621363f, 0.27851969f, 0.284407526f, 0.290284663f, 0.296150893f,
+  0.302005947f, 0.307849646f, 0.313681751f, 0.319502026f, 0.32531029f,
+  0.331106305f, 0.336889863f, 0.342660725f, 0.348418683f, 0.354163527f,
+  0.359895051f, 0.365612984f, 0.371317208f, 0.377007425f, 0.382683426f,
+  0.388345033f, 0.393992037f, 0.399624199f, 0.405241311f, 0.410843164f,
+  0.416429549f, 0.422000259f, 0.427555084f, 0.433093816f, 0.438616246f,
+  0.444122136f, 0.449611336f, 0.455083579f, 0.460538715f, 0.465976506f,
+  0.471396744f, 0.47679922f, 0.482183784f, 0.487550169f, 0.492898196f,
+  0.498227656f, 0.50353837f, 0.50883013f, 0.514102757f, 0.519356012f,
+  0.524589658f, 0.529803634f, 0.534997642f, 0.540171444f, 0.545324981f,
+  0.550457954f, 0.555570245f, 0.560661554f, 0.565731823f, 0.570780754f,
+  0.575808167f, 0.580813944f, 0.585797846f, 0.590759695f, 0.59569931f,
+  0.600616455f, 0.605511069f, 0.610382795f, 0.615231574f, 0.620057225f,
+  0.624859512f, 0.629638255f, 0.634393275f, 0.639124453f, 0.643831551f,
+  0.64851439f, 0.653172851f, 0.657806695f, 0.662415802f, 0.666999936f,
+  0.671558976f, 0.676092684f, 0.680601001f, 0.685083687f, 0.689540565f,
+  0.693971455f, 0.698376238f, 0.702754736f, 0.707106769f, 0.711432219f,
+  0.715730846f, 0.720002532f, 0.724247098f, 0.728464365f, 0.732654274f,
+  0.736816585f, 0.740951121f, 0.745057762f, 0.749136388f, 0.753186822f,
+  0.757208824f, 0.761202395f, 0.765167236f, 0.769103348f, 0.773010433f,
+  0.77688849f, 0.780737221f, 0.784556568f, 0.78834641f, 0.792106569f,
+  0.795836926f, 0.799537241f, 0.803207517f, 0.806847572f, 0.81045717f,
+  0.81403631f, 0.817584813f, 0.8211025f, 0.824589312f, 0.82804507f,
+  0.831469595f, 0.834862888f, 0.838224709f, 0.841554999f, 0.84485358f,
+  0.848120332f, 0.851355195f, 0.854557991f, 0.857728601f, 0.860866964f,
+  0.863972843f, 0.867046237f, 0.870086968f, 0.873094976f, 0.876070082f,
+  0.879012227f, 0.881921291f, 0.884797096f, 0.887639642f, 0.890448749f,
+  0.893224299f, 0.895966232f, 0.898674488f, 0.901348829f, 0.903989315f,
+  0.906595707f, 0.909168005f, 0.91170603f, 0.914209783f, 0.916679084f,
+  0.919113874f, 0.921514034f, 0.923879504f, 0.926210225f, 0.928506076f,
+  0.93076694f, 0.932992816f, 0.935183525f, 0.937339008f, 0.939459205f,
+  0.941544056f, 0.943593442f, 0.945607305f, 0.947585583f, 0.949528158f,
+  0.95143503f, 0.953306019f, 0.955141187f, 0.956940353f, 0.958703458f,
+  0.960430503f, 0.962121427f, 0.963776052f, 0.965394437f, 0.966976464f,
+  0.968522072f, 0.970031261f, 0.971503913f, 0.972939968f, 0.974339366f,
+  0.975702107f, 0.977028131f, 0.97831738f, 0.979569793f, 0.980785251f,
+  0.981963873f, 0.983105481f, 0.984210074f, 0.985277653f, 0.986308098f,
+  0.987301409f, 0.988257587f, 0.989176512f, 0.990058184f, 0.990902662f,
+  0.991709769f, 0.992479563f, 0.993211925f, 0.993906975f, 0.994564593f,
+  0.99518472f, 0.995767415f, 0.996312618f, 0.996820271f, 0.997290432f,
+  0.997723043f, 0.998118103f, 0.998475552f, 0.99879545f, 0.999077737f,
+  0.999322355f, 0.999529421f, 0.999698818f, 0.999830604f, 0.999924719f,
+  0.999981165f, 1.f, 0.999981165f, 0.999924719f, 0.999830604f,
+  0.999698818f, 0.999529421f, 0.999322355f, 0.999077737f, 0.99879545f,
+  0.998475552f, 0.998118103f, 0.997723043f, 0.997290432f, 0.996820271f,
+  0.996312618f, 0.995767415f, 0.99518472f, 0.994564593f, 0.993906975f,
+  0.993211925f, 0.992479563f, 0.991709769f, 0.990902662f, 0.990058184f,
+  0.989176512f, 0.988257587f, 0.987301409f, 0.986308098f, 0.985277653f,
+  0.984210074f, 0.983105481f, 0.981963873f, 0.980785251f, 0.979569793f,
+  0.97831738f, 0.977028131f, 0.975702107f, 0.974339366f, 0.972939968f,
+  0.971503913f, 0.970031261f, 0.968522072f, 0.966976464f, 0.965394437f,
+  0.963776052f, 0.962121427f, 0.960430503f, 0.958703458f, 0.956940353f,
+  0.955141187f, 0.953306019f, 0.95143503f, 0.949528158f, 0.947585583f,
+  0.945607305f, 0.943593442f, 0.941544056f, 0.939459205f, 0.937339008f,
+  0.935183525f, 0.932992816f, 0.93076694f, 0.928506076f, 0.926210225f,
+  0.923879504f, 0.921514034f, 0.919113874f, 0.916679084f, 0.914209783f,
+  0.91170603f, 0.909168005f, 0.906595707f, 0.903989315f, 0.901348829f,
+  0.898674488f, 0.895966232f, 0.893224299f, 0.890448749f, 0.887639642f,
+  0.884797096f, 0.881921291f, 0.879012227f, 0.876070082f, 0.873094976f,
+  0.870086968f, 0.867046237f, 0.863972843f, 0.860866964f, 0.857728601f,
+  0.854557991f, 0.851355195f, 0.848120332f, 0.84485358f, 0.841554999f,
+  0.838224709f, 0.834862888f, 0.831469595f, 0.82804507f, 0.824589312f,
+  0.8211025f, 0.817584813f, 0.81403631f, 0.81045717f, 0.806847572f,
+  0.803207517f, 0.799537241f, 0.795836926f, 0.792106569f, 0.78834641f,
+  0.784556568f, 0.780737221f, 0.77688849f, 0.773010433f, 0.769103348f,
+  0.765167236f, 0.761202395f, 0.757208824f, 0.753186822f, 0.749136388f,
+  0.745057762f, 0.740951121f, 0.736816585f, 0.732654274f, 0.728464365f,
+  0.724247098f, 0.720002532f, 0.715730846f, 0.711432219f, 0.707106769f,
+  0.702754736f, 0.698376238f, 0.693971455f, 0.689540565f, 0.685083687f,
+  0.680601001f, 0.676092684f, 0.671558976f, 0.666999936f, 0.662415802f,
+  0.657806695f, 0.653172851f, 0.64851439f, 0.643831551f, 0.639124453f,
+  0.634393275f, 0.629638255f, 0.624859512f, 0.620057225f, 0.615231574f,
+  0.610382795f, 0.605511069f, 0.600616455f, 0.59569931f, 0.590759695f,
+  0.585797846f, 0.580813944f, 0.575808167f, 0.570780754f, 0.565731823f,
+  0.560661554f, 0.555570245f, 0.550457954f, 0.545324981f, 0.540171444f,
+  0.534997642f, 0.529803634f, 0.524589658f, 0.519356012f, 0.514102757f,
+  0.50883013f, 0.50353837f, 0.498227656f, 0.492898196f, 0.487550169f,
+  0.482183784f, 0.47679922f, 0.471396744f, 0.465976506f, 0.460538715f,
+  0.455083579f, 0.449611336f, 0.444122136f, 0.438616246f, 0.433093816f,
+  0.427555084f, 0.422000259f, 0.416429549f, 0.410843164f, 0.405241311f,
+  0.399624199f, 0.393992037f, 0.388345033f, 0.382683426f, 0.377007425f,
+  0.371317208f, 0.365612984f, 0.359895051f, 0.354163527f, 0.348418683f,
+  0.342660725f, 0.336889863f, 0.331106305f, 0.32531029f, 0.319502026f,
+  0.313681751f, 0.307849646f, 0.302005947f, 0.296150893f, 0.290284663f,
+  0.284407526f, 0.27851969f, 0.272621363f, 0.266712755f, 0.260794103f,
+  0.254865646f, 0.248927608f, 0.242980182f, 0.237023607f, 0.231058106f,
+  0.225083917f, 0.219101235f, 0.213110313f, 0.207111374f, 0.201104641f,
+  0.195090324f, 0.18906866f, 0.183039889f, 0.177004218f, 0.170961887f,
+  0.164913118f, 0.15885815f, 0.152797192f, 0.146730468f, 0.140658244f,
+  0.134580702f, 0.128498107f, 0.122410677f, 0.116318628f, 0.110222206f,
+  0.104121633f, 0.0980171412f, 0.0919089541f, 0.0857973099f, 0.0796824396f,
+  0.0735645667f, 0.0674439222f, 0.061320737f, 0.0551952459f, 0.0490676761f,
+  0.0429382585f, 0.0368072242f, 0.030674804f, 0.024541229f, 0.0184067301f,
+  0.0122715384f, 0.00613588467f, 0.f, -0.00613588467f, -0.0122715384f,
+  -0.0184067301f, -0.024541229f, -0.030674804f, -0.0368072242f, -0.0429382585f,
+  -0.0490676761f, -0.0551952459f, -0.061320737f, -0.0674439222f, -0.0735645667f,
+  -0.0796824396f, -0.0857973099f, -0.0919089541f, -0.0980171412f, -0.104121633f,
+  -0.110222206f, -0.116318628f, -0.122410677f, -0.128498107f, -0.134580702f,
+  -0.140658244f, -0.146730468f, -0.152797192f, -0.15885815f, -0.164913118f,
+  -0.170961887f, -0.177004218f, -0.183039889f, -0.18906866f, -0.195090324f,
+  -0.201104641f, -0.207111374f, -0.213110313f, -0.219101235f, -0.225083917f,
+  -0.231058106f, -0.237023607f, -0.242980182f, -0.248927608f, -0.254865646f,
+  -0.260794103f, -0.266712755f, -0.272621363f, -0.27851969f, -0.284407526f,
+  -0.290284663f, -0.296150893f, -0.302005947f, -0.307849646f, -0.313681751f,
+  -0.319502026f, -0.32531029f, -0.331106305f, -0.336889863f, -0.342660725f,
+  -0.348418683f, -0.354163527f, -0.359895051f, -0.365612984f, -0.371317208f,
+  -0.377007425f, -0.382683426f, -0.388345033f, -0.393992037f, -0.399624199f,
+  -0.405241311f, -0.410843164f, -0.416429549f, -0.422000259f, -0.427555084f,
+  -0.433093816f, -0.438616246f, -0.444122136f, -0.449611336f, -0.455083579f,
+  -0.460538715f, -0.465976506f, -0.471396744f, -0.47679922f, -0.482183784f,
+  -0.487550169f, -0.492898196f, -0.498227656f, -0.50353837f, -0.50883013f,
+  -0.514102757f, -0.519356012f, -0.524589658f, -0.529803634f, -0.534997642f,
+  -0.540171444f, -0.545324981f, -0.550457954f, -0.555570245f, -0.560661554f,
+  -0.565731823f, -0.570780754f, -0.575808167f, -0.580813944f, -0.585797846f,
+  -0.590759695f, -0.59569931f, -0.600616455f, -0.605511069f, -0.610382795f,
+  -0.615231574f, -0.620057225f, -0.624859512f, -0.629638255f, -0.634393275f,
+  -0.639124453f, -0.643831551f, -0.64851439f, -0.653172851f, -0.657806695f,
+  -0.662415802f, -0.666999936f, -0.671558976f, -0.676092684f, -0.680601001f,
+  -0.685083687f, -0.689540565f, -0.693971455f, -0.698376238f, -0.702754736f,
+  -0.707106769f, -0.711432219f, -0.715730846f, -0.720002532f, -0.724247098f,
+  -0.728464365f, -0.732654274f, -0.736816585f, -0.740951121f, -0.745057762f,
+  -0.749136388f, -0.753186822f, -0.757208824f, -0.761202395f, -0.765167236f,
+  -0.769103348f, -0.773010433f, -0.77688849f, -0.780737221f, -0.784556568f,
+  -0.78834641f, -0.792106569f, -0.795836926f, -0.799537241f, -0.803207517f,
+  -0.806847572f, -0.81045717f, -0.81403631f, -0.817584813f, -0.8211025f,
+  -0.824589312f, -0.82804507f, -0.831469595f, -0.834862888f, -0.838224709f,
+  -0.841554999f, -0.84485358f, -0.848120332f, -0.851355195f, -0.854557991f,
+  -0.857728601f, -0.860866964f, -0.863972843f, -0.867046237f, -0.870086968f,
+  -0.873094976f, -0.876070082f, -0.879012227f, -0.881921291f, -0.884797096f,
+  -0.887639642f, -0.890448749f, -0.893224299f, -0.895966232f, -0.898674488f,
+  -0.901348829f, -0.903989315f, -0.906595707f, -0.909168005f, -0.91170603f,
+  -0.914209783f, -0.916679084f, -0.919113874f, -0.921514034f, -0.923879504f,
+  -0.926210225f, -0.928506076f, -0.93076694f, -0.932992816f, -0.935183525f,
+  -0.937339008f, -0.939459205f, -0.941544056f, -0.943593442f, -0.945607305f,
+  -0.947585583f, -0.949528158f, -0.95143503f, -0.953306019f, -0.955141187f,
+  -0.956940353f, -0.958703458f, -0.960430503f, -0.962121427f, -0.963776052f,
+  -0.965394437f, -0.966976464f, -0.968522072f, -0.970031261f, -0.971503913f,
+  -0.972939968f, -0.974339366f, -0.975702107f, -0.977028131f, -0.97831738f,
+  -0.979569793f, -0.980785251f, -0.981963873f, -0.983105481f, -0.984210074f,
+  -0.985277653f, -0.986308098f, -0.987301409f, -0.988257587f, -0.989176512f,
+  -0.990058184f, -0.990902662f, -0.991709769f, -0.992479563f, -0.993211925f,
+  -0.993906975f, -0.994564593f, -0.99518472f, -0.995767415f, -0.996312618f,
+  -0.996820271f, -0.997290432f, -0.997723043f, -0.998118103f, -0.998475552f,
+  -0.99879545f, -0.999077737f, -0.999322355f, -0.999529421f, -0.999698818f,
+  -0.999830604f, -0.999924719f, -0.999981165f, -1.f, -0.999981165f,
+  -0.999924719f, -0.999830604f, -0.999698818f, -0.999529421f, -0.999322355f,
+  -0.999077737f, -0.99879545f, -0.998475552f, -0.998118103f, -0.997723043f,
+  -0.997290432f, -0.996820271f, -0.996312618f, -0.995767415f, -0.99518472f,
+  -0.994564593f, -0.993906975f, -0.993211925f, -0.992479563f, -0.991709769f,
+  -0.990902662f, -0.990058184f, -0.989176512f, -0.988257587f, -0.987301409f,
+  -0.986308098f, -0.985277653f, -0.984210074f, -0.983105481f, -0.981963873f,
+  -0.980785251f, -0.979569793f, -0.97831738f, -0.977028131f, -0.975702107f,
+  -0.974339366f, -0.972939968f, -0.971503913f, -0.970031261f, -0.968522072f,
+  -0.966976464f, -0.965394437f, -0.963776052f, -0.962121427f, -0.960430503f,
+  -0.958703458f, -0.956940353f, -0.955141187f, -0.953306019f, -0.95143503f,
+  -0.949528158f, -0.947585583f, -0.945607305f, -0.943593442f, -0.941544056f,
+  -0.939459205f, -0.937339008f, -0.935183525f, -0.932992816f, -0.93076694f,
+  -0.928506076f, -0.926210225f, -0.923879504f, -0.921514034f, -0.919113874f,
+  -0.916679084f, -0.914209783f, -0.91170603f, -0.909168005f, -0.906595707f,
+  -0.903989315f, -0.901348829f, -0.898674488f, -0.895966232f, -0.893224299f,
+  -0.890448749f, -0.887639642f, -0.884797096f, -0.881921291f, -0.879012227f,
+  -0.876070082f, -0.873094976f, -0.870086968f, -0.867046237f, -0.863972843f,
+  -0.860866964f, -0.857728601f, -0.854557991f, -0.851355195f, -0.848120332f,
+  -0.84485358f, -0.841554999f, -0.838224709f, -0.834862888f, -0.831469595f,
+  -0.82804507f, -0.824589312f, -0.8211025f, -0.817584813f, -0.81403631f,
+  -0.81045717f, -0.806847572f, -0.803207517f, -0.799537241f, -0.795836926f,
+  -0.792106569f, -0.78834641f, -0.784556568f, -0.780737221f, -0.77688849f,
+  -0.773010433f, -0.769103348f, -0.765167236f, -0.761202395f, -0.757208824f,
+  -0.753186822f, -0.749136388f, -0.745057762f, -0.740951121f, -0.736816585f,
+  -0.732654274f, -0.728464365f, -0.724247098f, -0.720002532f, -0.715730846f,
+  -0.711432219f, -0.707106769f, -0.702754736f, -0.698376238f, -0.693971455f,
+  -0.689540565f, -0.685083687f, -0.680601001f, -0.676092684f, -0.671558976f,
+  -0.666999936f, -0.662415802f, -0.657806695f, -0.653172851f, -0.64851439f,
+  -0.643831551f, -0.639124453f, -0.634393275f, -0.629638255f, -0.624859512f,
+  -0.620057225f, -0.615231574f, -0.610382795f, -0.605511069f, -0.600616455f,
+  -0.59569931f, -0.590759695f, -0.585797846f, -0.580813944f, -0.575808167f,
+  -0.570780754f, -0.565731823f, -0.560661554f, -0.555570245f, -0.550457954f,
+  -0.545324981f, -0.540171444f, -0.534997642f, -0.529803634f, -0.524589658f,
+  -0.519356012f, -0.514102757f, -0.50883013f, -0.50353837f, -0.498227656f,
+  -0.492898196f, -0.487550169f, -0.482183784f, -0.47679922f, -0.471396744f,
+  -0.465976506f, -0.460538715f, -0.455083579f, -0.449611336f, -0.444122136f,
+  -0.438616246f, -0.433093816f, -0.427555084f, -0.422000259f, -0.416429549f,
+  -0.410843164f, -0.405241311f, -0.399624199f, -0.393992037f, -0.388345033f,
+  -0.382683426f, -0.377007425f, -0.371317208f, -0.365612984f, -0.359895051f,
+  -0.354163527f, -0.348418683f, -0.342660725f, -0.336889863f, -0.331106305f,
+  -0.32531029f, -0.319502026f, -0.313681751f, -0.307849646f, -0.302005947f,
+  -0.296150893f, -0.290284663f, -0.284407526f, -0.27851969f, -0.272621363f,
+  -0.266712755f, -0.260794103f, -0.254865646f, -0.248927608f, -0.242980182f,
+  -0.237023607f, -0.231058106f, -0.225083917f, -0.219101235f, -0.213110313f,
+  -0.207111374f, -0.201104641f, -0.195090324f, -0.18906866f, -0.183039889f,
+  -0.177004218f, -0.170961887f, -0.164913118f, -0.15885815f, -0.152797192f,
+  -0.146730468f, -0.140658244f, -0.134580702f, -0.128498107f, -0.122410677f,
+  -0.116318628f, -0.110222206f, -0.104121633f, -0.0980171412f, -0.0919089541f,
+  -0.0857973099f, -0.0796824396f, -0.0735645667f, -0.0674439222f, -0.061320737f,
+  -0.0551952459f, -0.0490676761f, -0.0429382585f, -0.0368072242f, -0.030674804f,
+  -0.024541229f, -0.0184067301f, -0.0122715384f, -0.00613588467f, 0.f,
+  0.00613588467f, 0.0122715384f, 0.0184067301f, 0.024541229f, 0.030674804f,
+  0.0368072242f, 0.0429382585f, 0.0490676761f, 0.0551952459f, 0.061320737f,
+  0.0674439222f, 0.0735645667f, 0.0796824396f, 0.0857973099f, 0.0919089541f,
+  0.0980171412f, 0.104121633f, 0.110222206f, 0.116318628f, 0.122410677f,
+  0.128498107f, 0.134580702f, 0.140658244f, 0.146730468f, 0.152797192f,
+  0.15885815f, 0.164913118f, 0.170961887f, 0.177004218f, 0.183039889f,
+  0.18906866f, 0.195090324f, 0.201104641f, 0.207111374f, 0.213110313f,
+  0.219101235f, 0.225083917f, 0.231058106f, 0.237023607f, 0.242980182f,
+  0.248927608f, 0.254865646f, 0.260794103f, 0.266712755f, 0.272621363f,
+  0.27851969f, 0.284407526f, 0.290284663f, 0.296150893f, 0.302005947f,
+  0.307849646f, 0.313681751f, 0.319502026f, 0.32531029f, 0.331106305f,
+  0.336889863f, 0.342660725f, 0.348418683f, 0.354163527f, 0.359895051f,
+  0.365612984f, 0.371317208f, 0.377007425f, 0.382683426f, 0.388345033f,
+  0.393992037f, 0.399624199f, 0.405241311f, 0.410843164f, 0.416429549f,
+  0.422000259f, 0.427555084f, 0.433093816f, 0.438616246f, 0.444122136f,
+  0.449611336f, 0.455083579f, 0.460538715f, 0.465976506f, 0.471396744f,
+  0.47679922f, 0.482183784f, 0.487550169f, 0.492898196f, 0.498227656f,
+  0.50353837f, 0.50883013f, 0.514102757f, 0.519356012f, 0.524589658f,
+  0.529803634f, 0.534997642f, 0.540171444f, 0.545324981f, 0.550457954f,
+  0.555570245f, 0.560661554f, 0.565731823f, 0.570780754f, 0.575808167f,
+  0.580813944f, 0.585797846f, 0.590759695f, 0.59569931f, 0.600616455f,
+  0.605511069f, 0.610382795f, 0.615231574f, 0.620057225f, 0.624859512f,
+  0.629638255f, 0.634393275f, 0.639124453f, 0.643831551f, 0.64851439f,
+  0.653172851f, 0.657806695f, 0.662415802f, 0.666999936f, 0.671558976f,
+  0.676092684f, 0.680601001f, 0.685083687f, 0.689540565f, 0.693971455f,
+  0.698376238f, 0.702754736f, 0.707106769f, 0.711432219f, 0.715730846f,
+  0.720002532f, 0.724247098f, 0.728464365f, 0.732654274f, 0.736816585f,
+  0.740951121f, 0.745057762f, 0.749136388f, 0.753186822f, 0.757208824f,
+  0.761202395f, 0.765167236f, 0.769103348f, 0.773010433f, 0.77688849f,
+  0.780737221f, 0.784556568f, 0.78834641f, 0.792106569f, 0.795836926f,
+  0.799537241f, 0.803207517f, 0.806847572f, 0.81045717f, 0.81403631f,
+  0.817584813f, 0.8211025f, 0.824589312f, 0.82804507f, 0.831469595f,
+  0.834862888f, 0.838224709f, 0.841554999f, 0.84485358f, 0.848120332f,
+  0.851355195f, 0.854557991f, 0.857728601f, 0.860866964f, 0.863972843f,
+  0.867046237f, 0.870086968f, 0.873094976f, 0.876070082f, 0.879012227f,
+  0.881921291f, 0.884797096f, 0.887639642f, 0.890448749f, 0.893224299f,
+  0.895966232f, 0.898674488f, 0.901348829f, 0.903989315f, 0.906595707f,
+  0.909168005f, 0.91170603f, 0.914209783f, 0.916679084f, 0.919113874f,
+  0.921514034f, 0.923879504f, 0.926210225f, 0.928506076f, 0.93076694f,
+  0.932992816f, 0.935183525f, 0.937339008f, 0.939459205f, 0.941544056f,
+  0.943593442f, 0.945607305f, 0.947585583f, 0.949528158f, 0.95143503f,
+  0.953306019f, 0.955141187f, 0.956940353f, 0.958703458f, 0.960430503f,
+  0.962121427f, 0.963776052f, 0.965394437f, 0.966976464f, 0.968522072f,
+  0.970031261f, 0.971503913f, 0.972939968f, 0.974339366f, 0.975702107f,
+  0.977028131f, 0.97831738f, 0.979569793f, 0.980785251f, 0.981963873f,
+  0.983105481f, 0.984210074f, 0.985277653f, 0.986308098f, 0.987301409f,
+  0.988257587f, 0.989176512f, 0.990058184f, 0.990902662f, 0.991709769f,
+  0.992479563f, 0.993211925f, 0.993906975f, 0.994564593f, 0.99518472f,
+  0.995767415f, 0.996312618f, 0.996820271f, 0.997290432f, 0.997723043f,
+  0.998118103f, 0.998475552f, 0.99879545f, 0.999077737f, 0.999322355f,
+  0.999529421f, 0.999698818f, 0.999830604f, 0.999924719f, 0.999981165f,
+  1.f
+};
+
+static const float fft_static_sin_2048[2561] =
+{
+  0.f, 0.00306795677f, 0.00613588467f, 0.00920375437f, 0.0122715384f,
+  0.015339206f, 0.0184067301f, 0.0214740802f, 0.024541229f, 0.027608145f,
+  0.030674804f, 0.0337411724f, 0.0368072242f, 0.0398729257f, 0.0429382585f,
+  0.0460031815f, 0.0490676761f, 0.052131705f, 0.0551952459f, 0.0582582653f,
+  0.061320737f, 0.0643826276f, 0.0674439222f, 0.070504576f, 0.0735645667f,
+  0.0766238645f, 0.0796824396f, 0.0827402622f, 0.0857973099f, 0.0888535529f,
+  0.0919089541f, 0.0949634984f, 0.0980171412f, 0.10106986f, 0.104121633f,
+  0.107172422f, 0.110222206f, 0.113270953f, 0.116318628f, 0.119365215f,
+  0.122410677f, 0.125454977f, 0.128498107f, 0.13154003f, 0.134580702f,
+  0.137620121f, 0.140658244f, 0.143695027f, 0.146730468f, 0.149764538f,
+  0.152797192f, 0.155828401f, 0.15885815f, 0.161886394f, 0.164913118f,
+  0.167938292f, 0.170961887f, 0.173983872f, 0.177004218f, 0.180022895f,
+  0.183039889f, 0.186055154f, 0.18906866f, 0.192080393f, 0.195090324f,
+  0.198098406f, 0.201104641f, 0.204108968f, 0.207111374f, 0.210111842f,
+  0.213110313f, 0.216106802f, 0.219101235f, 0.222093627f, 0.225083917f,
+  0.228072077f, 0.231058106f, 0.234041959f, 0.237023607f, 0.24000302f,
+  0.242980182f, 0.24595505f, 0.248927608f, 0.251897812f, 0.254865646f,
+  0.257831097f, 0.260794103f, 0.263754666f, 0.266712755f, 0.269668311f,
+  0.272621363f, 0.275571823f, 0.27851969f, 0.281464934f, 0.284407526f,
+  0.287347466f, 0.290284663f, 0.293219149f, 0.296150893f, 0.299079835f,
+  0.302005947f, 0.304929227f, 0.307849646f, 0.310767144f, 0.313681751f,
+  0.316593379f, 0.319502026f, 0.322407693f, 0.32531029f, 0.328209847f,
+  0.331106305f, 0.333999664f, 0.336889863f, 0.339776874f, 0.342660725f,
+  0.345541328f, 0.348418683f, 0.351292759f, 0.354163527f, 0.357030958f,
+  0.359895051f, 0.362755716f, 0.365612984f, 0.368466824f, 0.371317208f,
+  0.374164075f, 0.377007425f, 0.379847199f, 0.382683426f, 0.385516047f,
+  0.388345033f, 0.391170382f, 0.393992037f, 0.396809995f, 0.399624199f,
+  0.402434647f, 0.405241311f, 0.408044159f, 0.410843164f, 0.413638324f,
+  0.416429549f, 0.419216901f, 0.422000259f, 0.424779683f, 0.427555084f,
+  0.430326492f, 0.433093816f, 0.435857087f, 0.438616246f, 0.441371262f,
+  0.444122136f, 0.446868837f, 0.449611336f, 0.452349573f, 0.455083579f,
+  0.457813293f, 0.460538715f, 0.463259786f, 0.465976506f, 0.468688816f,
+  0.471396744f, 0.474100202f, 0.47679922f, 0.479493767f, 0.482183784f,
+  0.484869242f, 0.487550169f, 0.490226477f, 0.492898196f, 0.495565265f,
+  0.498227656f, 0.500885367f, 0.50353837f, 0.506186664f, 0.50883013f,
+  0.511468828f, 0.514102757f, 0.516731799f, 0.519356012f, 0.521975279f,
+  0.524589658f, 0.527199149f, 0.529803634f, 0.532403111f, 0.534997642f,
+  0.537587047f, 0.540171444f, 0.542750776f, 0.545324981f, 0.547894061f,
+  0.550457954f, 0.553016722f, 0.555570245f, 0.558118522f, 0.560661554f,
+  0.563199341f, 0.565731823f, 0.568258941f, 0.570780754f, 0.573297143f,
+  0.575808167f, 0.578313768f, 0.580813944f, 0.583308637f, 0.585797846f,
+  0.588281572f, 0.590759695f, 0.593232274f, 0.59569931f, 0.598160684f,
+  0.600616455f, 0.603066623f, 0.605511069f, 0.607949793f, 0.610382795f,
+  0.612810075f, 0.615231574f, 0.61764729f, 0.620057225f, 0.622461259f,
+  0.624859512f, 0.627251804f, 0.629638255f, 0.632018745f, 0.634393275f,
+  0.636761844f, 0.639124453f, 0.641481042f, 0.643831551f, 0.64617604f,
+  0.64851439f, 0.65084666f, 0.653172851f, 0.655492842f, 0.657806695f,
+  0.660114348f, 0.662415802f, 0.664710999f, 0.666999936f, 0.669282615f,
+  0.671558976f, 0.673829019f, 0.676092684f, 0.678350031f, 0.680601001f,
+  0.682845533f, 0.685083687f, 0.687315345f, 0.689540565f, 0.691759229f,
+  0.693971455f, 0.696177125f, 0.698376238f, 0.700568795f, 0.702754736f,
+  0.704934061f, 0.707106769f, 0.709272802f, 0.711432219f, 0.71358484f,
+  0.715730846f, 0.717870057f, 0.720002532f, 0.722128212f, 0.724247098f,
+  0.726359129f, 0.728464365f, 0.730562747f, 0.732654274f, 0.734738886f,
+  0.736816585f, 0.73888731f, 0.740951121f, 0.743007958f, 0.745057762f,
+  0.747100592f, 0.749136388f, 0.751165152f, 0.753186822f, 0.755201399f,
+  0.757208824f, 0.759209216f, 0.761202395f, 0.763188422f, 0.765167236f,
+  0.767138898f, 0.769103348f, 0.771060526f, 0.773010433f, 0.774953127f,
+  0.77688849f, 0.778816521f, 0.780737221f, 0.78265059f, 0.784556568f,
+  0.786455214f, 0.78834641f, 0.790230215f, 0.792106569f, 0.793975472f,
+  0.795836926f, 0.797690868f, 0.799537241f, 0.801376164f, 0.803207517f,
+  0.805031359f, 0.806847572f, 0.808656156f, 0.81045717f, 0.812250614f,
+  0.81403631f, 0.815814435f, 0.817584813f, 0.819347501f, 0.8211025f,
+  0.82284981f, 0.824589312f, 0.826321065f, 0.82804507f, 0.829761207f,
+  0.831469595f, 0.833170176f, 0.834862888f, 0.836547732f, 0.838224709f,
+  0.839893818f, 0.841554999f, 0.843208253f, 0.84485358f, 0.84649092f,
+  0.848120332f, 0.849741757f, 0.851355195f, 0.852960587f, 0.854557991f,
+  0.856147349f, 0.857728601f, 0.859301805f, 0.860866964f, 0.862423956f,
+  0.863972843f, 0.865513623f, 0.867046237f, 0.868570685f, 0.870086968f,
+  0.871595085f, 0.873094976f, 0.874586642f, 0.876070082f, 0.877545297f,
+  0.879012227f, 0.880470872f, 0.881921291f, 0.883363366f, 0.884797096f,
+  0.886222541f, 0.887639642f, 0.889048338f, 0.890448749f, 0.891840696f,
+  0.893224299f, 0.894599497f, 0.895966232f, 0.897324562f, 0.898674488f,
+  0.900015891f, 0.901348829f, 0.902673304f, 0.903989315f, 0.905296743f,
+  0.906595707f, 0.907886088f, 0.909168005f, 0.910441279f, 0.91170603f,
+  0.912962198f, 0.914209783f, 0.915448725f, 0.916679084f, 0.917900801f,
+  0.919113874f, 0.920318305f, 0.921514034f, 0.92270112f, 0.923879504f,
+  0.925049245f, 0.926210225f, 0.927362502f, 0.928506076f, 0.929640889f,
+  0.93076694f, 0.931884289f, 0.932992816f, 0.934092522f, 0.935183525f,
+  0.936265647f, 0.937339008f, 0.938403547f, 0.939459205f, 0.940506041f,
+  0.941544056f, 0.94257319f, 0.943593442f, 0.944604814f, 0.945607305f,
+  0.946600914f, 0.947585583f, 0.94856137f, 0.949528158f, 0.950486064f,
+  0.95143503f, 0.952374995f, 0.953306019f, 0.954228103f, 0.955141187f,
+  0.95604527f, 0.956940353f, 0.957826436f, 0.958703458f, 0.95957154f,
+  0.960430503f, 0.961280465f, 0.962121427f, 0.962953269f, 0.963776052f,
+  0.964589775f, 0.965394437f, 0.966189981f, 0.966976464f, 0.967753828f,
+  0.968522072f, 0.969281256f, 0.970031261f, 0.970772147f, 0.971503913f,
+  0.972226501f, 0.972939968f, 0.973644257f, 0.974339366f, 0.975025356f,
+  0.975702107f, 0.976369739f, 0.977028131f, 0.977677345f, 0.97831738f,
+  0.978948176f, 0.979569793f, 0.980182111f, 0.980785251f, 0.981379211f,
+  0.981963873f, 0.982539296f, 0.983105481f, 0.983662426f, 0.984210074f,
+  0.984748483f, 0.985277653f, 0.985797524f, 0.986308098f, 0.986809373f,
+  0.987301409f, 0.987784147f, 0.988257587f, 0.988721669f, 0.989176512f,
+  0.989621997f, 0.990058184f, 0.990485072f, 0.990902662f, 0.991310835f,
+  0.991709769f, 0.992099285f, 0.992479563f, 0.992850423f, 0.993211925f,
+  0.993564129f, 0.993906975f, 0.994240463f, 0.994564593f, 0.994879305f,
+  0.99518472f, 0.995480776f, 0.995767415f, 0.996044695f, 0.996312618f,
+  0.996571124f, 0.996820271f, 0.997060061f, 0.997290432f, 0.997511446f,
+  0.997723043f, 0.997925282f, 0.998118103f, 0.998301566f, 0.998475552f,
+  0.998640239f, 0.99879545f, 0.998941302f, 0.999077737f, 0.999204755f,
+  0.999322355f, 0.999430597f, 0.999529421f, 0.999618828f, 0.999698818f,
+  0.99976939f, 0.999830604f, 0.99988234f, 0.999924719f, 0.999957621f,
+  0.999981165f, 0.999995291f, 1.f, 0.999995291f, 0.999981165f,
+  0.999957621f, 0.999924719f, 0.99988234f, 0.999830604f, 0.99976939f,
+  0.999698818f, 0.999618828f, 0.999529421f, 0.999430597f, 0.999322355f,
+  0.999204755f, 0.999077737f, 0.998941302f, 0.99879545f, 0.998640239f,
+  0.998475552f, 0.998301566f, 0.998118103f, 0.997925282f, 0.997723043f,
+  0.997511446f, 0.997290432f, 0.997060061f, 0.996820271f, 0.996571124f,
+  0.996312618f, 0.996044695f, 0.995767415f, 0.995480776f, 0.99518472f,
+  0.994879305f, 0.994564593f, 0.994240463f, 0.993906975f, 0.993564129f,
+  0.993211925f, 0.992850423f, 0.992479563f, 0.992099285f, 0.991709769f,
+  0.991310835f, 0.990902662f, 0.990485072f, 0.990058184f, 0.989621997f,
+  0.989176512f, 0.988721669f, 0.988257587f, 0.987784147f, 0.987301409f,
+  0.986809373f, 0.986308098f, 0.985797524f, 0.985277653f, 0.984748483f,
+  0.984210074f, 0.983662426f, 0.983105481f, 0.982539296f, 0.981963873f,
+  0.981379211f, 0.980785251f, 0.980182111f, 0.979569793f, 0.978948176f,
+  0.97831738f, 0.977677345f, 0.977028131f, 0.976369739f, 0.975702107f,
+  0.975025356f, 0.974339366f, 0.973644257f, 0.972939968f, 0.972226501f,
+  0.971503913f, 0.970772147f, 0.970031261f, 0.969281256f, 0.968522072f,
+  0.967753828f, 0.966976464f, 0.966189981f, 0.965394437f, 0.964589775f,
+  0.963776052f, 0.962953269f, 0.962121427f, 0.961280465f, 0.960430503f,
+  0.95957154f, 0.958703458f, 0.957826436f, 0.956940353f, 0.95604527f,
+  0.955141187f, 0.954228103f, 0.953306019f, 0.952374995f, 0.95143503f,
+  0.950486064f, 0.949528158f, 0.94856137f, 0.947585583f, 0.946600914f,
+  0.945607305f, 0.944604814f, 0.943593442f, 0.94257319f, 0.941544056f,
+  0.940506041f, 0.939459205f, 0.938403547f, 0.937339008f, 0.936265647f,
+  0.935183525f, 0.934092522f, 0.932992816f, 0.931884289f, 0.93076694f,
+  0.929640889f, 0.928506076f, 0.927362502f, 0.926210225f, 0.925049245f,
+  0.923879504f, 0.92270112f, 0.921514034f, 0.920318305f, 0.919113874f,
+  0.917900801f, 0.916679084f, 0.915448725f, 0.914209783f, 0.912962198f,
+  0.91170603f, 0.910441279f, 0.909168005f, 0.907886088f, 0.906595707f,
+  0.905296743f, 0.903989315f, 0.902673304f, 0.901348829f, 0.900015891f,
+  0.898674488f, 0.897324562f, 0.895966232f, 0.894599497f, 0.893224299f,
+  0.891840696f, 0.890448749f, 0.889048338f, 0.887639642f, 0.886222541f,
+  0.884797096f, 0.883363366f, 0.881921291f, 0.880470872f, 0.879012227f,
+  0.877545297f, 0.876070082f, 0.874586642f, 0.873094976f, 0.871595085f,
+  0.870086968f, 0.868570685f, 0.867046237f, 0.865513623f, 0.863972843f,
+  0.862423956f, 0.860866964f, 0.859301805f, 0.857728601f, 0.856147349f,
+  0.854557991f, 0.852960587f, 0.851355195f, 0.849741757f, 0.848120332f,
+  0.84649092f, 0.84485358f, 0.843208253f, 0.841554999f, 0.839893818f,
+  0.838224709f, 0.836547732f, 0.834862888f, 0.833170176f, 0.831469595f,
+  0.829761207f, 0.82804507f, 0.826321065f, 0.824589312f, 0.82284981f,
+  0.8211025f, 0.819347501f, 0.817584813f, 0.815814435f, 0.81403631f,
+  0.812250614f, 0.81045717f, 0.808656156f, 0.806847572f, 0.805031359f,
+  0.803207517f, 0.801376164f, 0.799537241f, 0.797690868f, 0.795836926f,
+  0.793975472f, 0.792106569f, 0.790230215f, 0.78834641f, 0.786455214f,
+  0.784556568f, 0.78265059f, 0.780737221f, 0.778816521f, 0.77688849f,
+  0.774953127f, 0.773010433f, 0.771060526f, 0.769103348f, 0.767138898f,
+  0.765167236f, 0.763188422f, 0.761202395f, 0.759209216f, 0.757208824f,
+  0.755201399f, 0.753186822f, 0.751165152f, 0.749136388f, 0.747100592f,
+  0.745057762f, 0.743007958f, 0.740951121f, 0.73888731f, 0.736816585f,
+  0.734738886f, 0.732654274f, 0.730562747f, 0.728464365f, 0.726359129f,
+  0.724247098f, 0.722128212f, 0.720002532f, 0.717870057f, 0.715730846f,
+  0.71358484f, 0.711432219f, 0.709272802f, 0.707106769f, 0.704934061f,
+  0.702754736f, 0.700568795f, 0.698376238f, 0.696177125f, 0.693971455f,
+  0.691759229f, 0.689540565f, 0.687315345f, 0.685083687f, 0.682845533f,
+  0.680601001f, 0.678350031f, 0.676092684f, 0.673829019f, 0.671558976f,
+  0.669282615f, 0.666999936f, 0.664710999f, 0.662415802f, 0.660114348f,
+  0.657806695f, 0.655492842f, 0.653172851f, 0.65084666f, 0.64851439f,
+  0.64617604f, 0.643831551f, 0.641481042f, 0.639124453f, 0.636761844f,
+  0.634393275f, 0.632018745f, 0.629638255f, 0.627251804f, 0.624859512f,
+  0.622461259f, 0.620057225f, 0.61764729f, 0.615231574f, 0.612810075f,
+  0.610382795f, 0.607949793f, 0.605511069f, 0.603066623f, 0.600616455f,
+  0.598160684f, 0.59569931f, 0.593232274f, 0.590759695f, 0.588281572f,
+  0.585797846f, 0.583308637f, 0.580813944f, 0.578313768f, 0.575808167f,
+  0.573297143f, 0.570780754f, 0.568258941f, 0.565731823f, 0.563199341f,
+  0.560661554f, 0.558118522f, 0.555570245f, 0.553016722f, 0.550457954f,
+  0.547894061f, 0.545324981f, 0.542750776f, 0.540171444f, 0.537587047f,
+  0.534997642f, 0.532403111f, 0.529803634f, 0.527199149f, 0.524589658f,
+  0.521975279f, 0.519356012f, 0.516731799f, 0.514102757f, 0.511468828f,
+  0.50883013f, 0.506186664f, 0.50353837f, 0.500885367f, 0.498227656f,
+  0.495565265f, 0.492898196f, 0.490226477f, 0.487550169f, 0.484869242f,
+  0.482183784f, 0.479493767f, 0.47679922f, 0.474100202f, 0.471396744f,
+  0.468688816f, 0.465976506f, 0.463259786f, 0.460538715f, 0.457813293f,
+  0.455083579f, 0.452349573f, 0.449611336f, 0.446868837f, 0.444122136f,
+  0.441371262f, 0.438616246f, 0.435857087f, 0.433093816f, 0.430326492f,
+  0.427555084f, 0.424779683f, 0.422000259f, 0.419216901f, 0.416429549f,
+  0.413638324f, 0.410843164f, 0.408044159f, 0.405241311f, 0.402434647f,
+  0.399624199f, 0.396809995f, 0.393992037f, 0.391170382f, 0.388345033f,
+  0.385516047f, 0.382683426f, 0.379847199f, 0.377007425f, 0.374164075f,
+  0.371317208f, 0.368466824f, 0.365612984f, 0.362755716f, 0.359895051f,
+  0.357030958f, 0.354163527f, 0.351292759f, 0.348418683f, 0.345541328f,
+  0.342660725f, 0.339776874f, 0.336889863f, 0.333999664f, 0.331106305f,
+  0.328209847f, 0.32531029f, 0.322407693f, 0.319502026f, 0.316593379f,
+  0.313681751f, 0.310767144f, 0.307849646f, 0.304929227f, 0.302005947f,
+  0.299079835f, 0.296150893f, 0.293219149f, 0.290284663f, 0.287347466f,
+  0.284407526f, 0.281464934f, 0.27851969f, 0.275571823f, 0.272621363f,
+  0.269668311f, 0.266712755f, 0.263754666f, 0.260794103f, 0.257831097f,
+  0.254865646f, 0.251897812f, 0.248927608f, 0.24595505f, 0.242980182f,
+  0.24000302f, 0.237023607f, 0.234041959f, 0.231058106f, 0.228072077f,
+  0.225083917f, 0.222093627f, 0.219101235f, 0.216106802f, 0.213110313f,
+  0.210111842f, 0.207111374f, 0.204108968f, 0.201104641f, 0.198098406f,
+  0.195090324f, 0.192080393f, 0.18906866f, 0.186055154f, 0.183039889f,
+  0.180022895f, 0.177004218f, 0.173983872f, 0.170961887f, 0.167938292f,
+  0.164913118f, 0.161886394f, 0.15885815f, 0.155828401f, 0.152797192f,
+  0.149764538f, 0.146730468f, 0.143695027f, 0.140658244f, 0.137620121f,
+  0.134580702f, 0.13154003f, 0.128498107f, 0.125454977f, 0.122410677f,
+  0.119365215f, 0.116318628f, 0.113270953f, 0.110222206f, 0.107172422f,
+  0.104121633f, 0.10106986f, 0.0980171412f, 0.0949634984f, 0.0919089541f,
+  0.0888535529f, 0.0857973099f, 0.0827402622f, 0.0796824396f, 0.0766238645f,
+  0.0735645667f, 0.070504576f, 0.0674439222f, 0.0643826276f, 0.061320737f,
+  0.0582582653f, 0.0551952459f, 0.052131705f, 0.0490676761f, 0.0460031815f,
+  0.0429382585f, 0.0398729257f, 0.0368072242f, 0.0337411724f, 0.030674804f,
+  0.027608145f, 0.024541229f, 0.0214740802f, 0.0184067301f, 0.015339206f,
+  0.0122715384f, 0.00920375437f, 0.00613588467f, 0.00306795677f, 0.f,
+  -0.00306795677f, -0.00613588467f, -0.00920375437f, -0.0122715384f, -0.015339206f,
+  -0.0184067301f, -0.0214740802f, -0.024541229f, -0.027608145f, -0.030674804f,
+  -0.0337411724f, -0.0368072242f, -0.0398729257f, -0.0429382585f, -0.0460031815f,
+  -0.0490676761f, -0.052131705f, -0.0551952459f, -0.0582582653f, -0.061320737f,
+  -0.0643826276f, -0.0674439222f, -0.070504576f, -0.0735645667f, -0.0766238645f,
+  -0.0796824396f, -0.0827402622f, -0.0857973099f, -0.0888535529f, -0.0919089541f,
+  -0.0949634984f, -0.0980171412f, -0.10106986f, -0.104121633f, -0.107172422f,
+  -0.110222206f, -0.113270953f, -0.116318628f, -0.119365215f, -0.122410677f,
+  -0.125454977f, -0.128498107f, -0.13154003f, -0.134580702f, -0.137620121f,
+  -0.140658244f, -0.143695027f, -0.146730468f, -0.149764538f, -0.152797192f,
+  -0.155828401f, -0.15885815f, -0.161886394f, -0.164913118f, -0.167938292f,
+  -0.170961887f, -0.173983872f, -0.177004218f, -0.180022895f, -0.183039889f,
+  -0.186055154f, -0.18906866f, -0.192080393f, -0.195090324f, -0.198098406f,
+  -0.201104641f, -0.204108968f, -0.207111374f, -0.210111842f, -0.213110313f,
+  -0.216106802f, -0.219101235f, -0.222093627f, -0.225083917f, -0.228072077f,
+  -0.231058106f, -0.234041959f, -0.237023607f, -0.24000302f, -0.242980182f,
+  -0.24595505f, -0.248927608f, -0.251897812f, -0.254865646f, -0.257831097f,
+  -0.260794103f, -0.263754666f, -0.266712755f, -0.269668311f, -0.272621363f,
+  -0.275571823f, -0.27851969f, -0.281464934f, -0.284407526f, -0.287347466f,
+  -0.290284663f, -0.293219149f, -0.296150893f, -0.299079835f, -0.302005947f,
+  -0.304929227f, -0.307849646f, -0.310767144f, -0.313681751f, -0.316593379f,
+  -0.319502026f, -0.322407693f, -0.32531029f, -0.328209847f, -0.331106305f,
+  -0.333999664f, -0.336889863f, -0.339776874f, -0.342660725f, -0.345541328f,
+  -0.348418683f, -0.351292759f, -0.354163527f, -0.357030958f, -0.359895051f,
+  -0.362755716f, -0.365612984f, -0.368466824f, -0.371317208f, -0.374164075f,
+  -0.377007425f, -0.379847199f, -0.382683426f, -0.385516047f, -0.388345033f,
+  -0.391170382f, -0.393992037f, -0.396809995f, -0.399624199f, -0.402434647f,
+  -0.405241311f, -0.408044159f, -0.410843164f, -0.413638324f, -0.416429549f,
+  -0.419216901f, -0.422000259f, -0.424779683f, -0.427555084f, -0.430326492f,
+  -0.433093816f, -0.435857087f, -0.438616246f, -0.441371262f, -0.444122136f,
+  -0.446868837f, -0.449611336f, -0.452349573f, -0.455083579f, -0.457813293f,
+  -0.460538715f, -0.463259786f, -0.465976506f, -0.468688816f, -0.471396744f,
+  -0.474100202f, -0.47679922f, -0.479493767f, -0.482183784f, -0.484869242f,
+  -0.487550169f, -0.490226477f, -0.492898196f, -0.495565265f, -0.498227656f,
+  -0.500885367f, -0.50353837f, -0.506186664f, -0.50883013f, -0.511468828f,
+  -0.514102757f, -0.516731799f, -0.519356012f, -0.521975279f, -0.524589658f,
+  -0.527199149f, -0.529803634f, -0.532403111f, -0.534997642f, -0.537587047f,
+  -0.540171444f, -0.542750776f, -0.545324981f, -0.547894061f, -0.550457954f,
+  -0.553016722f, -0.555570245f, -0.558118522f, -0.560661554f, -0.563199341f,
+  -0.565731823f, -0.568258941f, -0.570780754f, -0.573297143f, -0.575808167f,
+  -0.578313768f, -0.580813944f, -0.583308637f, -0.585797846f, -0.588281572f,
+  -0.590759695f, -0.593232274f, -0.59569931f, -0.598160684f, -0.600616455f,
+  -0.603066623f, -0.605511069f, -0.607949793f, -0.610382795f, -0.612810075f,
+  -0.615231574f, -0.61764729f, -0.620057225f, -0.622461259f, -0.624859512f,
+  -0.627251804f, -0.629638255f, -0.632018745f, -0.634393275f, -0.636761844f,
+  -0.639124453f, -0.641481042f, -0.643831551f, -0.64617604f, -0.64851439f,
+  -0.65084666f, -0.653172851f, -0.655492842f, -0.657806695f, -0.660114348f,
+  -0.662415802f, -0.664710999f, -0.666999936f, -0.669282615f, -0.671558976f,
+  -0.673829019f, -0.676092684f, -0.678350031f, -0.680601001f, -0.682845533f,
+  -0.685083687f, -0.687315345f, -0.689540565f, -0.691759229f, -0.693971455f,
+  -0.696177125f, -0.698376238f, -0.700568795f, -0.702754736f, -0.704934061f,
+  -0.707106769f, -0.709272802f, -0.711432219f, -0.71358484f, -0.715730846f,
+  -0.717870057f, -0.720002532f, -0.722128212f, -0.724247098f, -0.726359129f,
+  -0.728464365f, -0.730562747f, -0.732654274f, -0.734738886f, -0.736816585f,
+  -0.73888731f, -0.740951121f, -0.743007958f, -0.745057762f, -0.747100592f,
+  -0.749136388f, -0.751165152f, -0.753186822f, -0.755201399f, -0.757208824f,
+  -0.759209216f, -0.761202395f, -0.763188422f, -0.765167236f, -0.767138898f,
+  -0.769103348f, -0.771060526f, -0.773010433f, -0.774953127f, -0.77688849f,
+  -0.778816521f, -0.780737221f, -0.78265059f, -0.784556568f, -0.786455214f,
+  -0.78834641f, -0.790230215f, -0.792106569f, -0.793975472f, -0.795836926f,
+  -0.797690868f, -0.799537241f, -0.801376164f, -0.803207517f, -0.805031359f,
+  -0.806847572f, -0.808656156f, -0.81045717f, -0.812250614f, -0.81403631f,
+  -0.815814435f, -0.817584813f, -0.819347501f, -0.8211025f, -0.82284981f,
+  -0.824589312f, -0.826321065f, -0.82804507f, -0.829761207f, -0.831469595f,
+  -0.833170176f, -0.834862888f, -0.836547732f, -0.838224709f, -0.839893818f,
+  -0.841554999f, -0.843208253f, -0.84485358f, -0.84649092f, -0.848120332f,
+  -0.849741757f, -0.851355195f, -0.852960587f, -0.854557991f, -0.856147349f,
+  -0.857728601f, -0.859301805f, -0.860866964f, -0.862423956f, -0.863972843f,
+  -0.865513623f, -0.867046237f, -0.868570685f, -0.870086968f, -0.871595085f,
+  -0.873094976f, -0.874586642f, -0.876070082f, -0.877545297f, -0.879012227f,
+  -0.880470872f, -0.881921291f, -0.883363366f, -0.884797096f, -0.886222541f,
+  -0.887639642f, -0.889048338f, -0.890448749f, -0.891840696f, -0.893224299f,
+  -0.894599497f, -0.895966232f, -0.897324562f, -0.898674488f, -0.900015891f,
+  -0.901348829f, -0.902673304f, -0.903989315f, -0.905296743f, -0.906595707f,
+  -0.907886088f, -0.909168005f, -0.910441279f, -0.91170603f, -0.912962198f,
+  -0.914209783f, -0.915448725f, -0.916679084f, -0.917900801f, -0.919113874f,
+  -0.920318305f, -0.921514034f, -0.92270112f, -0.923879504f, -0.925049245f,
+  -0.926210225f, -0.927362502f, -0.928506076f, -0.929640889f, -0.93076694f,
+  -0.931884289f, -0.932992816f, -0.934092522f, -0.935183525f, -0.936265647f,
+  -0.937339008f, -0.938403547f, -0.939459205f, -0.940506041f, -0.941544056f,
+  -0.94257319f, -0.943593442f, -0.944604814f, -0.945607305f, -0.946600914f,
+  -0.947585583f, -0.94856137f, -0.949528158f, -0.950486064f, -0.95143503f,
+  -0.952374995f, -0.953306019f, -0.954228103f, -0.955141187f, -0.95604527f,
+  -0.956940353f, -0.957826436f, -0.958703458f, -0.95957154f, -0.960430503f,
+  -0.961280465f, -0.962121427f, -0.962953269f, -0.963776052f, -0.964589775f,
+  -0.965394437f, -0.966189981f, -0.966976464f, -0.967753828f, -0.968522072f,
+  -0.969281256f, -0.970031261f, -0.970772147f, -0.971503913f, -0.972226501f,
+  -0.972939968f, -0.973644257f, -0.974339366f, -0.975025356f, -0.975702107f,
+  -0.976369739f, -0.977028131f, -0.977677345f, -0.97831738f, -0.978948176f,
+  -0.979569793f, -0.980182111f, -0.980785251f, -0.981379211f, -0.981963873f,
+  -0.982539296f, -0.983105481f, -0.983662426f, -0.984210074f, -0.984748483f,
+  -0.985277653f, -0.985797524f, -0.986308098f, -0.986809373f, -0.987301409f,
+  -0.987784147f, -0.988257587f, -0.988721669f, -0.989176512f, -0.989621997f,
+  -0.990058184f, -0.990485072f, -0.990902662f, -0.991310835f, -0.991709769f,
+  -0.992099285f, -0.992479563f, -0.992850423f, -0.993211925f, -0.993564129f,
+  -0.993906975f, -0.994240463f, -0.994564593f, -0.994879305f, -0.99518472f,
+  -0.995480776f, -0.995767415f, -0.996044695f, -0.996312618f, -0.996571124f,
+  -0.996820271f, -0.997060061f, -0.997290432f, -0.997511446f, -0.997723043f,
+  -0.997925282f, -0.998118103f, -0.998301566f, -0.998475552f, -0.998640239f,
+  -0.99879545f, -0.998941302f, -0.999077737f, -0.999204755f, -0.999322355f,
+  -0.999430597f, -0.999529421f, -0.999618828f, -0.999698818f, -0.99976939f,
+  -0.999830604f, -0.99988234f, -0.999924719f, -0.999957621f, -0.999981165f,
+  -0.999995291f, -1.f, -0.999995291f, -0.999981165f, -0.999957621f,
+  -0.999924719f, -0.99988234f, -0.999830604f, -0.99976939f, -0.999698818f,
+  -0.999618828f, -0.999529421f, -0.999430597f, -0.999322355f, -0.999204755f,
+  -0.999077737f, -0.998941302f, -0.99879545f, -0.998640239f, -0.998475552f,
+  -0.998301566f, -0.998118103f, -0.997925282f, -0.997723043f, -0.997511446f,
+  -0.997290432f, -0.997060061f, -0.996820271f, -0.996571124f, -0.996312618f,
+  -0.996044695f, -0.995767415f, -0.995480776f, -0.99518472f, -0.994879305f,
+  -0.994564593f, -0.994240463f, -0.993906975f, -0.993564129f, -0.993211925f,
+  -0.992850423f, -0.992479563f, -0.992099285f, -0.991709769f, -0.991310835f,
+  -0.990902662f, -0.990485072f, -0.990058184f, -0.989621997f, -0.989176512f,
+  -0.988721669f, -0.988257587f, -0.987784147f, -0.987301409f, -0.986809373f,
+  -0.986308098f, -0.985797524f, -0.985277653f, -0.984748483f, -0.984210074f,
+  -0.983662426f, -0.983105481f, -0.982539296f, -0.981963873f, -0.981379211f,
+  -0.980785251f, -0.980182111f, -0.979569793f, -0.978948176f, -0.97831738f,
+  -0.977677345f, -0.977028131f, -0.976369739f, -0.975702107f, -0.975025356f,
+  -0.974339366f, -0.973644257f, -0.972939968f, -0.972226501f, -0.971503913f,
+  -0.970772147f, -0.970031261f, -0.969281256f, -0.968522072f, -0.967753828f,
+  -0.966976464f, -0.966189981f, -0.965394437f, -0.964589775f, -0.963776052f,
+  -0.962953269f, -0.962121427f, -0.961280465f, -0.960430503f, -0.95957154f,
+  -0.958703458f, -0.957826436f, -0.956940353f, -0.95604527f, -0.955141187f,
+  -0.954228103f, -0.953306019f, -0.952374995f, -0.95143503f, -0.950486064f,
+  -0.949528158f, -0.94856137f, -0.947585583f, -0.946600914f, -0.945607305f,
+  -0.944604814f, -0.943593442f, -0.94257319f, -0.941544056f, -0.940506041f,
+  -0.939459205f, -0.938403547f, -0.937339008f, -0.936265647f, -0.935183525f,
+  -0.934092522f, -0.932992816f, -0.931884289f, -0.93076694f, -0.929640889f,
+  -0.928506076f, -0.927362502f, -0.926210225f, -0.925049245f, -0.923879504f,
+  -0.92270112f, -0.921514034f, -0.920318305f, -0.919113874f, -0.917900801f,
+  -0.916679084f, -0.915448725f, -0.914209783f, -0.912962198f, -0.91170603f,
+  -0.910441279f, -0.909168005f, -0.907886088f, -0.906595707f, -0.905296743f,
+  -0.903989315f, -0.902673304f, -0.901348829f, -0.900015891f, -0.898674488f,
+  -0.897324562f, -0.895966232f, -0.894599497f, -0.893224299f, -0.891840696f,
+  -0.890448749f, -0.889048338f, -0.887639642f, -0.886222541f, -0.884797096f,
+  -0.883363366f, -0.881921291f, -0.880470872f, -0.879012227f, -0.877545297f,
+  -0.876070082f, -0.874586642f, -0.873094976f, -0.871595085f, -0.870086968f,
+  -0.868570685f, -0.867046237f, -0.865513623f, -0.863972843f, -0.862423956f,
+  -0.860866964f, -0.859301805f, -0.857728601f, -0.856147349f, -0.854557991f,
+  -0.852960587f, -0.851355195f, -0.849741757f, -0.848120332f, -0.84649092f,
+  -0.84485358f, -0.843208253f, -0.841554999f, -0.839893818f, -0.838224709f,
+  -0.836547732f, -0.834862888f, -0.833170176f, -0.831469595f, -0.829761207f,
+  -0.82804507f, -0.826321065f, -0.824589312f, -0.82284981f, -0.8211025f,
+  -0.819347501f, -0.817584813f, -0.815814435f, -0.81403631f, -0.812250614f,
+  -0.81045717f, -0.808656156f, -0.806847572f, -0.805031359f, -0.803207517f,
+  -0.801376164f, -0.799537241f, -0.797690868f, -0.795836926f, -0.793975472f,
+  -0.792106569f, -0.790230215f, -0.78834641f, -0.786455214f, -0.784556568f,
+  -0.78265059f, -0.780737221f, -0.778816521f, -0.77688849f, -0.774953127f,
+  -0.773010433f, -0.771060526f, -0.769103348f, -0.767138898f, -0.765167236f,
+  -0.763188422f, -0.761202395f, -0.759209216f, -0.757208824f, -0.755201399f,
+  -0.753186822f, -0.751165152f, -0.749136388f, -0.747100592f, -0.745057762f,
+  -0.743007958f, -0.740951121f, -0.73888731f, -0.736816585f, -0.734738886f,
+  -0.732654274f, -0.730562747f, -0.728464365f, -0.726359129f, -0.724247098f,
+  -0.722128212f, -0.720002532f, -0.717870057f, -0.715730846f, -0.71358484f,
+  -0.711432219f, -0.709272802f, -0.707106769f, -0.704934061f, -0.702754736f,
+  -0.700568795f, -0.698376238f, -0.696177125f, -0.693971455f, -0.691759229f,
+  -0.689540565f, -0.687315345f, -0.685083687f, -0.682845533f, -0.680601001f,
+  -0.678350031f, -0.676092684f, -0.673829019f, -0.671558976f, -0.669282615f,
+  -0.666999936f, -0.664710999f, -0.662415802f, -0.660114348f, -0.657806695f,
+  -0.655492842f, -0.653172851f, -0.65084666f, -0.64851439f, -0.64617604f,
+  -0.643831551f, -0.641481042f, -0.639124453f, -0.636761844f, -0.634393275f,
+  -0.632018745f, -0.629638255f, -0.627251804f, -0.624859512f, -0.622461259f,
+  -0.620057225f, -0.61764729f, -0.615231574f, -0.612810075f, -0.610382795f,
+  -0.607949793f, -0.605511069f, -0.603066623f, -0.600616455f, -0.598160684f,
+  -0.59569931f, -0.593232274f, -0.590759695f, -0.588281572f, -0.585797846f,
+  -0.583308637f, -0.580813944f, -0.578313768f, -0.575808167f, -0.573297143f,
+  -0.570780754f, -0.568258941f, -0.565731823f, -0.563199341f, -0.560661554f,
+  -0.558118522f, -0.555570245f, -0.553016722f, -0.550457954f, -0.547894061f,
+  -0.545324981f, -0.542750776f, -0.540171444f, -0.537587047f, -0.534997642f,
+  -0.532403111f, -0.529803634f, -0.527199149f, -0.524589658f, -0.521975279f,
+  -0.519356012f, -0.516731799f, -0.514102757f, -0.511468828f, -0.50883013f,
+  -0.506186664f, -0.50353837f, -0.500885367f, -0.498227656f, -0.495565265f,
+  -0.492898196f, -0.490226477f, -0.487550169f, -0.484869242f, -0.482183784f,
+  -0.479493767f, -0.47679922f, -0.474100202f, -0.471396744f, -0.468688816f,
+  -0.465976506f, -0.463259786f, -0.460538715f, -0.457813293f, -0.455083579f,
+  -0.452349573f, -0.449611336f, -0.446868837f, -0.444122136f, -0.441371262f,
+  -0.438616246f, -0.435857087f, -0.433093816f, -0.430326492f, -0.427555084f,
+  -0.424779683f, -0.422000259f, -0.419216901f, -0.416429549f, -0.413638324f,
+  -0.410843164f, -0.408044159f, -0.405241311f, -0.402434647f, -0.399624199f,
+  -0.396809995f, -0.393992037f, -0.391170382f, -0.388345033f, -0.385516047f,
+  -0.382683426f, -0.379847199f, -0.377007425f, -0.374164075f, -0.371317208f,
+  -0.368466824f, -0.365612984f, -0.362755716f, -0.359895051f, -0.357030958f,
+  -0.354163527f, -0.351292759f, -0.348418683f, -0.345541328f, -0.342660725f,
+  -0.339776874f, -0.336889863f, -0.333999664f, -0.331106305f, -0.328209847f,
+  -0.32531029f, -0.322407693f, -0.319502026f, -0.316593379f, -0.313681751f,
+  -0.310767144f, -0.307849646f, -0.304929227f, -0.302005947f, -0.299079835f,
+  -0.296150893f, -0.293219149f, -0.290284663f, -0.287347466f, -0.284407526f,
+  -0.281464934f, -0.27851969f, -0.275571823f, -0.272621363f, -0.269668311f,
+  -0.266712755f, -0.263754666f, -0.260794103f, -0.257831097f, -0.254865646f,
+  -0.251897812f, -0.248927608f, -0.24595505f, -0.242980182f, -0.24000302f,
+  -0.237023607f, -0.234041959f, -0.231058106f, -0.228072077f, -0.225083917f,
+  -0.222093627f, -0.219101235f, -0.216106802f, -0.213110313f, -0.210111842f,
+  -0.207111374f, -0.204108968f, -0.201104641f, -0.198098406f, -0.195090324f,
+  -0.192080393f, -0.18906866f, -0.186055154f, -0.183039889f, -0.180022895f,
+  -0.177004218f, -0.173983872f, -0.170961887f, -0.167938292f, -0.164913118f,
+  -0.161886394f, -0.15885815f, -0.155828401f, -0.152797192f, -0.149764538f,
+  -0.146730468f, -0.143695027f, -0.140658244f, -0.137620121f, -0.134580702f,
+  -0.13154003f, -0.128498107f, -0.125454977f, -0.122410677f, -0.119365215f,
+  -0.116318628f, -0.113270953f, -0.110222206f, -0.107172422f, -0.104121633f,
+  -0.10106986f, -0.0980171412f, -0.0949634984f, -0.0919089541f, -0.0888535529f,
+  -0.0857973099f, -0.0827402622f, -0.0796824396f, -0.0766238645f, -0.0735645667f,
+  -0.070504576f, -0.0674439222f, -0.0643826276f, -0.061320737f, -0.0582582653f,
+  -0.0551952459f, -0.052131705f, -0.0490676761f, -0.0460031815f, -0.0429382585f,
+  -0.0398729257f, -0.0368072242f, -0.0337411724f, -0.030674804f, -0.027608145f,
+  -0.024541229f, -0.0214740802f, -0.0184067301f, -0.015339206f, -0.0122715384f,
+  -0.00920375437f, -0.00613588467f, -0.00306795677f, 0.f, 0.00306795677f,
+  0.00613588467f, 0.00920375437f, 0.0122715384f, 0.015339206f, 0.0184067301f,
+  0.0214740802f, 0.024541229f, 0.027608145f, 0.030674804f, 0.0337411724f,
+  0.0368072242f, 0.0398729257f, 0.0429382585f, 0.0460031815f, 0.0490676761f,
+  0.052131705f, 0.0551952459f, 0.0582582653f, 0.061320737f, 0.0643826276f,
+  0.0674439222f, 0.070504576f, 0.0735645667f, 0.0766238645f, 0.0796824396f,
+  0.0827402622f, 0.0857973099f, 0.0888535529f, 0.0919089541f, 0.0949634984f,
+  0.0980171412f, 0.10106986f, 0.104121633f, 0.107172422f, 0.110222206f,
+  0.113270953f, 0.116318628f, 0.119365215f, 0.122410677f, 0.125454977f,
+  0.128498107f, 0.13154003f, 0.134580702f, 0.137620121f, 0.140658244f,
+  0.143695027f, 0.146730468f, 0.149764538f, 0.152797192f, 0.155828401f,
+  0.15885815f, 0.161886394f, 0.164913118f, 0.167938292f, 0.170961887f,
+  0.173983872f, 0.177004218f, 0.180022895f, 0.183039889f, 0.186055154f,
+  0.18906866f, 0.192080393f, 0.195090324f, 0.198098406f, 0.201104641f,
+  0.204108968f, 0.207111374f, 0.210111842f, 0.213110313f, 0.216106802f,
+  0.219101235f, 0.222093627f, 0.225083917f, 0.228072077f, 0.231058106f,
+  0.234041959f, 0.237023607f, 0.24000302f, 0.242980182f, 0.24595505f,
+  0.248927608f, 0.251897812f, 0.254865646f, 0.257831097f, 0.260794103f,
+  0.263754666f, 0.266712755f, 0.269668311f, 0.272621363f, 0.275571823f,
+  0.27851969f, 0.281464934f, 0.284407526f, 0.287347466f, 0.290284663f,
+  0.293219149f, 0.296150893f, 0.299079835f, 0.302005947f, 0.304929227f,
+  0.307849646f, 0.310767144f, 0.313681751f, 0.316593379f, 0.319502026f,
+  0.322407693f, 0.32531029f, 0.328209847f, 0.331106305f, 0.333999664f,
+  0.336889863f, 0.339776874f, 0.342660725f, 0.345541328f, 0.348418683f,
+  0.351292759f, 0.354163527f, 0.357030958f, 0.359895051f, 0.362755716f,
+  0.365612984f, 0.368466824f, 0.371317208f, 0.374164075f, 0.377007425f,
+  0.379847199f, 0.382683426f, 0.385516047f, 0.388345033f, 0.391170382f,
+  0.393992037f, 0.396809995f, 0.399624199f, 0.402434647f, 0.405241311f,
+  0.408044159f, 0.410843164f, 0.413638324f, 0.416429549f, 0.419216901f,
+  0.422000259f, 0.424779683f, 0.427555084f, 0.430326492f, 0.433093816f,
+  0.435857087f, 0.438616246f, 0.441371262f, 0.444122136f, 0.446868837f,
+  0.449611336f, 0.452349573f, 0.455083579f, 0.457813293f, 0.460538715f,
+  0.463259786f, 0.465976506f, 0.468688816f, 0.471396744f, 0.474100202f,
+  0.47679922f, 0.479493767f, 0.482183784f, 0.484869242f, 0.487550169f,
+  0.490226477f, 0.492898196f, 0.495565265f, 0.498227656f, 0.500885367f,
+  0.50353837f, 0.506186664f, 0.50883013f, 0.511468828f, 0.514102757f,
+  0.516731799f, 0.519356012f, 0.521975279f, 0.524589658f, 0.527199149f,
+  0.529803634f, 0.532403111f, 0.534997642f, 0.537587047f, 0.540171444f,
+  0.542750776f, 0.545324981f, 0.547894061f, 0.550457954f, 0.553016722f,
+  0.555570245f, 0.558118522f, 0.560661554f, 0.563199341f, 0.565731823f,
+  0.568258941f, 0.570780754f, 0.573297143f, 0.575808167f, 0.578313768f,
+  0.580813944f, 0.583308637f, 0.585797846f, 0.588281572f, 0.590759695f,
+  0.593232274f, 0.59569931f, 0.598160684f, 0.600616455f, 0.603066623f,
+  0.605511069f, 0.607949793f, 0.610382795f, 0.612810075f, 0.615231574f,
+  0.61764729f, 0.620057225f, 0.622461259f, 0.624859512f, 0.627251804f,
+  0.629638255f, 0.632018745f, 0.634393275f, 0.636761844f, 0.639124453f,
+  0.641481042f, 0.643831551f, 0.64617604f, 0.64851439f, 0.65084666f,
+  0.653172851f, 0.655492842f, 0.657806695f, 0.660114348f, 0.662415802f,
+  0.664710999f, 0.666999936f, 0.669282615f, 0.671558976f, 0.673829019f,
+  0.676092684f, 0.678350031f, 0.680601001f, 0.682845533f, 0.685083687f,
+  0.687315345f, 0.689540565f, 0.691759229f, 0.693971455f, 0.696177125f,
+  0.698376238f, 0.700568795f, 0.702754736f, 0.704934061f, 0.707106769f,
+  0.709272802f, 0.711432219f, 0.71358484f, 0.715730846f, 0.717870057f,
+  0.720002532f, 0.722128212f, 0.724247098f, 0.726359129f, 0.728464365f,
+  0.730562747f, 0.732654274f, 0.734738886f, 0.736816585f, 0.73888731f,
+  0.740951121f, 0.743007958f, 0.745057762f, 0.747100592f, 0.749136388f,
+  0.751165152f, 0.753186822f, 0.755201399f, 0.757208824f, 0.759209216f,
+  0.761202395f, 0.763188422f, 0.765167236f, 0.767138898f, 0.769103348f,
+  0.771060526f, 0.773010433f, 0.774953127f, 0.77688849f, 0.778816521f,
+  0.780737221f, 0.78265059f, 0.784556568f, 0.786455214f, 0.78834641f,
+  0.790230215f, 0.792106569f, 0.793975472f, 0.795836926f, 0.797690868f,
+  0.799537241f, 0.801376164f, 0.803207517f, 0.805031359f, 0.806847572f,
+  0.808656156f, 0.81045717f, 0.812250614f, 0.81403631f, 0.815814435f,
+  0.817584813f, 0.819347501f, 0.8211025f, 0.82284981f, 0.824589312f,
+  0.826321065f, 0.82804507f, 0.829761207f, 0.831469595f, 0.833170176f,
+  0.834862888f, 0.836547732f, 0.838224709f, 0.839893818f, 0.841554999f,
+  0.843208253f, 0.84485358f, 0.84649092f, 0.848120332f, 0.849741757f,
+  0.851355195f, 0.852960587f, 0.854557991f, 0.856147349f, 0.857728601f,
+  0.859301805f, 0.860866964f, 0.862423956f, 0.863972843f, 0.865513623f,
+  0.867046237f, 0.868570685f, 0.870086968f, 0.871595085f, 0.873094976f,
+  0.874586642f, 0.876070082f, 0.877545297f, 0.879012227f, 0.880470872f,
+  0.881921291f, 0.883363366f, 0.884797096f, 0.886222541f, 0.887639642f,
+  0.889048338f, 0.890448749f, 0.891840696f, 0.893224299f, 0.894599497f,
+  0.895966232f, 0.897324562f, 0.898674488f, 0.900015891f, 0.901348829f,
+  0.902673304f, 0.903989315f, 0.905296743f, 0.906595707f, 0.907886088f,
+  0.909168005f, 0.910441279f, 0.91170603f, 0.912962198f, 0.914209783f,
+  0.915448725f, 0.916679084f, 0.917900801f, 0.919113874f, 0.920318305f,
+  0.921514034f, 0.92270112f, 0.923879504f, 0.925049245f, 0.926210225f,
+  0.927362502f, 0.928506076f, 0.929640889f, 0.93076694f, 0.931884289f,
+  0.932992816f, 0.934092522f, 0.935183525f, 0.936265647f, 0.937339008f,
+  0.938403547f, 0.939459205f, 0.940506041f, 0.941544056f, 0.94257319f,
+  0.943593442f, 0.944604814f, 0.945607305f, 0.946600914f, 0.947585583f,
+  0.94856137f, 0.949528158f, 0.950486064f, 0.95143503f, 0.952374995f,
+  0.953306019f, 0.954228103f, 0.955141187f, 0.95604527f, 0.956940353f,
+  0.957826436f, 0.958703458f, 0.95957154f, 0.960430503f, 0.961280465f,
+  0.962121427f, 0.962953269f, 0.963776052f, 0.964589775f, 0.965394437f,
+  0.966189981f, 0.966976464f, 0.967753828f, 0.968522072f, 0.969281256f,
+  0.970031261f, 0.970772147f, 0.971503913f, 0.972226501f, 0.972939968f,
+  0.973644257f, 0.974339366f, 0.975025356f, 0.975702107f, 0.976369739f,
+  0.977028131f, 0.977677345f, 0.97831738f, 0.978948176f, 0.979569793f,
+  0.980182111f, 0.980785251f, 0.981379211f, 0.981963873f, 0.982539296f,
+  0.983105481f, 0.983662426f, 0.984210074f, 0.984748483f, 0.985277653f,
+  0.985797524f, 0.986308098f, 0.986809373f, 0.987301409f, 0.987784147f,
+  0.988257587f, 0.988721669f, 0.989176512f, 0.989621997f, 0.990058184f,
+  0.990485072f, 0.990902662f, 0.991310835f, 0.991709769f, 0.992099285f,
+  0.992479563f, 0.992850423f, 0.993211925f, 0.993564129f, 0.993906975f,
+  0.994240463f, 0.994564593f, 0.994879305f, 0.99518472f, 0.995480776f,
+  0.995767415f, 0.996044695f, 0.996312618f, 0.996571124f, 0.996820271f,
+  0.997060061f, 0.997290432f, 0.997511446f, 0.997723043f, 0.997925282f,
+  0.998118103f, 0.998301566f, 0.998475552f, 0.998640239f, 0.99879545f,
+  0.998941302f, 0.999077737f, 0.999204755f, 0.999322355f, 0.999430597f,
+  0.999529421f, 0.999618828f, 0.999698818f, 0.99976939f, 0.999830604f,
+  0.99988234f, 0.999924719f, 0.999957621f, 0.999981165f, 0.999995291f,
+  1.f
+};
+
+static const float fft_static_sin_4096[5121] =
+{
+  0.f, 0.00153398013f, 0.00306795677f, 0.00460192608f, 0.00613588467f,
+  0.00766982883f, 0.00920375437f, 0.0107376594f, 0.0122715384f, 0.0138053885f,
+  0.015339206f, 0.0168729872f, 0.0184067301f, 0.0199404284f, 0.0214740802f,
+  0.0230076816f, 0.024541229f, 0.0260747187f, 0.027608145f, 0.029141508f,
+  0.030674804f, 0.0322080255f, 0.0337411724f, 0.0352742374f, 0.0368072242f,
+  0.0383401215f, 0.0398729257f, 0.0414056405f, 0.0429382585f, 0.0444707721f,
+  0.0460031815f, 0.0475354828f, 0.0490676761f, 0.0505997501f, 0.052131705f,
+  0.0536635369f, 0.0551952459f, 0.0567268208f, 0.0582582653f, 0.0597895719f,
+  0.061320737f, 0.0628517568f, 0.0643826276f, 0.0659133494f, 0.0674439222f,
+  0.068974331f, 0.070504576f, 0.0720346496f, 0.0735645667f, 0.0750942975f,
+  0.0766238645f, 0.0781532452f, 0.0796824396f, 0.0812114477f, 0.0827402622f,
+  0.0842688903f, 0.0857973099f, 0.0873255357f, 0.0888535529f, 0.0903813615f,
+  0.0919089541f, 0.093436338f, 0.0949634984f, 0.0964904279f, 0.0980171412f,
+  0.0995436162f, 0.10106986f, 0.102595866f, 0.104121633f, 0.105647154f,
+  0.107172422f, 0.108697444f, 0.110222206f, 0.111746714f, 0.113270953f,
+  0.114794925f, 0.116318628f, 0.117842063f, 0.119365215f, 0.120888084f,
+  0.122410677f, 0.123932973f, 0.125454977f, 0.126976699f, 0.128498107f,
+  0.130019218f, 0.13154003f, 0.13306053f, 0.134580702f, 0.136100575f,
+  0.137620121f, 0.139139339f, 0.140658244f, 0.142176807f, 0.143695027f,
+  0.145212919f, 0.146730468f, 0.148247674f, 0.149764538f, 0.151281044f,
+  0.152797192f, 0.154312968f, 0.155828401f, 0.157343462f, 0.15885815f,
+  0.160372451f, 0.161886394f, 0.16339995f, 0.164913118f, 0.166425899f,
+  0.167938292f, 0.169450298f, 0.170961887f, 0.172473088f, 0.173983872f,
+  0.175494254f, 0.177004218f, 0.178513765f, 0.180022895f, 0.181531608f,
+  0.183039889f, 0.184547737f, 0.186055154f, 0.187562123f, 0.18906866f,
+  0.19057475f, 0.192080393f, 0.19358559f, 0.195090324f, 0.196594596f,
+  0.198098406f, 0.199601755f, 0.201104641f, 0.202607036f, 0.204108968f,
+  0.205610409f, 0.207111374f, 0.208611846f, 0.210111842f, 0.211611331f,
+  0.213110313f, 0.214608818f, 0.216106802f, 0.21760428f, 0.219101235f,
+  0.220597684f, 0.222093627f, 0.223589033f, 0.225083917f, 0.226578265f,
+  0.228072077f, 0.229565367f, 0.231058106f, 0.232550308f, 0.234041959f,
+  0.235533059f, 0.237023607f, 0.238513589f, 0.24000302f, 0.241491884f,
+  0.242980182f, 0.244467899f, 0.24595505f, 0.24744162f, 0.248927608f,
+  0.250413001f, 0.251897812f, 0.253382027f, 0.254865646f, 0.25634867f,
+  0.257831097f, 0.259312928f, 0.260794103f, 0.262274712f, 0.263754666f,
+  0.265234023f, 0.266712755f, 0.268190861f, 0.269668311f, 0.271145165f,
+  0.272621363f, 0.274096906f, 0.275571823f, 0.277046084f, 0.27851969f,
+  0.27999264f, 0.281464934f, 0.282936573f, 0.284407526f, 0.285877824f,
+  0.287347466f, 0.288816422f, 0.290284663f, 0.291752249f, 0.293219149f,
+  0.294685364f, 0.296150893f, 0.297615707f, 0.299079835f, 0.300543249f,
+  0.302005947f, 0.303467959f, 0.304929227f, 0.306389809f, 0.307849646f,
+  0.309308767f, 0.310767144f, 0.312224805f, 0.313681751f, 0.315137923f,
+  0.316593379f, 0.31804809f, 0.319502026f, 0.320955247f, 0.322407693f,
+  0.323859364f, 0.32531029f, 0.326760441f, 0.328209847f, 0.329658449f,
+  0.331106305f, 0.332553357f, 0.333999664f, 0.335445136f, 0.336889863f,
+  0.338333756f, 0.339776874f, 0.341219217f, 0.342660725f, 0.344101429f,
+  0.345541328f, 0.346980423f, 0.348418683f, 0.349856138f, 0.351292759f,
+  0.352728546f, 0.354163527f, 0.355597675f, 0.357030958f, 0.358463407f,
+  0.359895051f, 0.3613258f, 0.362755716f, 0.364184797f, 0.365612984f,
+  0.367040336f, 0.368466824f, 0.369892448f, 0.371317208f, 0.372741073f,
+  0.374164075f, 0.375586182f, 0.377007425f, 0.378427744f, 0.379847199f,
+  0.381265759f, 0.382683426f, 0.384100199f, 0.385516047f, 0.386931002f,
+  0.388345033f, 0.38975817f, 0.391170382f, 0.392581671f, 0.393992037f,
+  0.395401478f, 0.396809995f, 0.398217559f, 0.399624199f, 0.401029885f,
+  0.402434647f, 0.403838456f, 0.405241311f, 0.406643212f, 0.408044159f,
+  0.409444153f, 0.410843164f, 0.41224122f, 0.413638324f, 0.415034413f,
+  0.416429549f, 0.417823702f, 0.419216901f, 0.420609087f, 0.422000259f,
+  0.423390478f, 0.424779683f, 0.426167876f, 0.427555084f, 0.42894128f,
+  0.430326492f, 0.43171066f, 0.433093816f, 0.434475958f, 0.435857087f,
+  0.437237173f, 0.438616246f, 0.439994276f, 0.441371262f, 0.442747235f,
+  0.444122136f, 0.445496023f, 0.446868837f, 0.448240608f, 0.449611336f,
+  0.450980991f, 0.452349573f, 0.453717113f, 0.455083579f, 0.456448972f,
+  0.457813293f, 0.45917654f, 0.460538715f, 0.461899787f, 0.463259786f,
+  0.464618683f, 0.465976506f, 0.467333198f, 0.468688816f, 0.470043331f,
+  0.471396744f, 0.472749025f, 0.474100202f, 0.475450277f, 0.47679922f,
+  0.47814706f, 0.479493767f, 0.480839342f, 0.482183784f, 0.483527064f,
+  0.484869242f, 0.486210287f, 0.487550169f, 0.48888889f, 0.490226477f,
+  0.491562903f, 0.492898196f, 0.494232297f, 0.495565265f, 0.496897042f,
+  0.498227656f, 0.499557108f, 0.500885367f, 0.502212465f, 0.50353837f,
+  0.504863083f, 0.506186664f, 0.507508993f, 0.50883013f, 0.510150075f,
+  0.511468828f, 0.512786388f, 0.514102757f, 0.515417874f, 0.516731799f,
+  0.518044531f, 0.519356012f, 0.520666242f, 0.521975279f, 0.523283124f,
+  0.524589658f, 0.525895f, 0.527199149f, 0.528501987f, 0.529803634f,
+  0.531104028f, 0.532403111f, 0.533701003f, 0.534997642f, 0.53629297f,
+  0.537587047f, 0.538879931f, 0.540171444f, 0.541461766f, 0.542750776f,
+  0.544038534f, 0.545324981f, 0.546610177f, 0.547894061f, 0.549176633f,
+  0.550457954f, 0.551737964f, 0.553016722f, 0.554294109f, 0.555570245f,
+  0.556845009f, 0.558118522f, 0.559390724f, 0.560661554f, 0.561931133f,
+  0.563199341f, 0.564466238f, 0.565731823f, 0.566996038f, 0.568258941f,
+  0.569520533f, 0.570780754f, 0.572039604f, 0.573297143f, 0.57455337f,
+  0.575808167f, 0.577061653f, 0.578313768f, 0.579564571f, 0.580813944f,
+  0.582062006f, 0.583308637f, 0.584553957f, 0.585797846f, 0.587040365f,
+  0.588281572f, 0.589521289f, 0.590759695f, 0.59199667f, 0.593232274f,
+  0.594466507f, 0.59569931f, 0.596930683f, 0.598160684f, 0.599389315f,
+  0.600616455f, 0.601842225f, 0.603066623f, 0.604289532f, 0.605511069f,
+  0.606731117f, 0.607949793f, 0.609167039f, 0.610382795f, 0.61159718f,
+  0.612810075f, 0.61402154f, 0.615231574f, 0.616440177f, 0.61764729f,
+  0.618852973f, 0.620057225f, 0.621259987f, 0.622461259f, 0.623661101f,
+  0.624859512f, 0.626056373f, 0.627251804f, 0.628445745f, 0.629638255f,
+  0.630829215f, 0.632018745f, 0.633206785f, 0.634393275f, 0.635578334f,
+  0.636761844f, 0.637943923f, 0.639124453f, 0.640303493f, 0.641481042f,
+  0.642657042f, 0.643831551f, 0.645004511f, 0.64617604f, 0.64734596f,
+  0.64851439f, 0.64968133f, 0.65084666f, 0.65201056f, 0.653172851f,
+  0.654333591f, 0.655492842f, 0.656650543f, 0.657806695f, 0.658961296f,
+  0.660114348f, 0.66126585f, 0.662415802f, 0.663564146f, 0.664710999f,
+  0.665856242f, 0.666999936f, 0.668142021f, 0.669282615f, 0.670421541f,
+  0.671558976f, 0.672694743f, 0.673829019f, 0.674961627f, 0.676092684f,
+  0.677222192f, 0.678350031f, 0.679476321f, 0.680601001f, 0.681724072f,
+  0.682845533f, 0.683965385f, 0.685083687f, 0.686200321f, 0.687315345f,
+  0.68842876f, 0.689540565f, 0.690650702f, 0.691759229f, 0.692866147f,
+  0.693971455f, 0.695075095f, 0.696177125f, 0.697277486f, 0.698376238f,
+  0.699473321f, 0.700568795f, 0.7016626f, 0.702754736f, 0.703845263f,
+  0.704934061f, 0.706021249f, 0.707106769f, 0.70819062f, 0.709272802f,
+  0.710353374f, 0.711432219f, 0.712509394f, 0.71358484f, 0.714658678f,
+  0.715730846f, 0.716801286f, 0.717870057f, 0.718937099f, 0.720002532f,
+  0.721066177f, 0.722128212f, 0.72318846f, 0.724247098f, 0.725303948f,
+  0.726359129f, 0.727412641f, 0.728464365f, 0.72951442f, 0.730562747f,
+  0.731609404f, 0.732654274f, 0.733697414f, 0.734738886f, 0.73577857f,
+  0.736816585f, 0.737852812f, 0.73888731f, 0.73992008f, 0.740951121f,
+  0.741980433f, 0.743007958f, 0.744033754f, 0.745057762f, 0.746080101f,
+  0.747100592f, 0.748119354f, 0.749136388f, 0.750151634f, 0.751165152f,
+  0.752176821f, 0.753186822f, 0.754194975f, 0.755201399f, 0.756205976f,
+  0.757208824f, 0.758209884f, 0.759209216f, 0.760206699f, 0.761202395f,
+  0.762196302f, 0.763188422f, 0.764178753f, 0.765167236f, 0.766153991f,
+  0.767138898f, 0.768122017f, 0.769103348f, 0.770082831f, 0.771060526f,
+  0.772036374f, 0.773010433f, 0.773982704f, 0.774953127f, 0.775921702f,
+  0.77688849f, 0.777853429f, 0.778816521f, 0.779777765f, 0.780737221f,
+  0.781694829f, 0.78265059f, 0.783604503f, 0.784556568f, 0.785506845f,
+  0.786455214f, 0.787401736f, 0.78834641f, 0.789289236f, 0.790230215f,
+  0.791169345f, 0.792106569f, 0.793041945f, 0.793975472f, 0.794907153f,
+  0.795836926f, 0.796764791f, 0.797690868f, 0.798614979f, 0.799537241f,
+  0.800457656f, 0.801376164f, 0.802292824f, 0.803207517f, 0.804120362f,
+  0.805031359f, 0.80594039f, 0.806847572f, 0.807752848f, 0.808656156f,
+  0.809557617f, 0.81045717f, 0.811354876f, 0.812250614f, 0.813144386f,
+  0.81403631f, 0.814926326f, 0.815814435f, 0.816700578f, 0.817584813f,
+  0.81846714f, 0.819347501f, 0.820225954f, 0.8211025f, 0.821977139f,
+  0.82284981f, 0.823720515f, 0.824589312f, 0.825456142f, 0.826321065f,
+  0.827184021f, 0.82804507f, 0.828904092f, 0.829761207f, 0.830616415f,
+  0.831469595f, 0.832320869f, 0.833170176f, 0.834017515f, 0.834862888f,
+  0.835706294f, 0.836547732f, 0.837387204f, 0.838224709f, 0.839060247f,
+  0.839893818f, 0.840725362f, 0.841554999f, 0.84238261f, 0.843208253f,
+  0.84403187f, 0.84485358f, 0.845673263f, 0.84649092f, 0.847306609f,
+  0.848120332f, 0.848932028f, 0.849741757f, 0.850549459f, 0.851355195f,
+  0.852158904f, 0.852960587f, 0.853760302f, 0.854557991f, 0.855353653f,
+  0.856147349f, 0.856938958f, 0.857728601f, 0.858516216f, 0.859301805f,
+  0.860085368f, 0.860866964f, 0.861646473f, 0.862423956f, 0.863199413f,
+  0.863972843f, 0.864744246f, 0.865513623f, 0.866280973f, 0.867046237f,
+  0.867809474f, 0.868570685f, 0.86932987f, 0.870086968f, 0.87084204f,
+  0.871595085f, 0.872346044f, 0.873094976f, 0.873841822f, 0.874586642f,
+  0.875329375f, 0.876070082f, 0.876808703f, 0.877545297f, 0.878279805f,
+  0.879012227f, 0.879742622f, 0.880470872f, 0.881197095f, 0.881921291f,
+  0.882643342f, 0.883363366f, 0.884081244f, 0.884797096f, 0.885510862f,
+  0.886222541f, 0.886932135f, 0.887639642f, 0.888345063f, 0.889048338f,
+  0.889749587f, 0.890448749f, 0.891145766f, 0.891840696f, 0.892533541f,
+  0.893224299f, 0.893912971f, 0.894599497f, 0.895283937f, 0.895966232f,
+  0.8966465f, 0.897324562f, 0.898000598f, 0.898674488f, 0.899346232f,
+  0.900015891f, 0.900683403f, 0.901348829f, 0.902012169f, 0.902673304f,
+  0.903332353f, 0.903989315f, 0.904644072f, 0.905296743f, 0.905947268f,
+  0.906595707f, 0.907242f, 0.907886088f, 0.90852809f, 0.909168005f,
+  0.909805715f, 0.910441279f, 0.911074758f, 0.91170603f, 0.912335157f,
+  0.912962198f, 0.913587034f, 0.914209783f, 0.914830327f, 0.915448725f,
+  0.916064978f, 0.916679084f, 0.917290986f, 0.917900801f, 0.91850841f,
+  0.919113874f, 0.919717133f, 0.920318305f, 0.920917213f, 0.921514034f,
+  0.92210865f, 0.92270112f, 0.923291445f, 0.923879504f, 0.924465477f,
+  0.925049245f, 0.925630808f, 0.926210225f, 0.926787496f, 0.927362502f,
+  0.927935421f, 0.928506076f, 0.929074585f, 0.929640889f, 0.930205047f,
+  0.93076694f, 0.931326687f, 0.931884289f, 0.932439625f, 0.932992816f,
+  0.933543801f, 0.934092522f, 0.934639156f, 0.935183525f, 0.935725689f,
+  0.936265647f, 0.93680346f, 0.937339008f, 0.93787235f, 0.938403547f,
+  0.938932478f, 0.939459205f, 0.939983726f, 0.940506041f, 0.941026151f,
+  0.941544056f, 0.942059755f, 0.94257319f, 0.943084419f, 0.943593442f,
+  0.944100261f, 0.944604814f, 0.945107222f, 0.945607305f, 0.946105242f,
+  0.946600914f, 0.947094381f, 0.947585583f, 0.948074579f, 0.94856137f,
+  0.949045897f, 0.949528158f, 0.950008273f, 0.950486064f, 0.950961649f,
+  0.95143503f, 0.951906145f, 0.952374995f, 0.95284164f, 0.953306019f,
+  0.953768194f, 0.954228103f, 0.954685748f, 0.955141187f, 0.955594361f,
+  0.95604527f, 0.956493914f, 0.956940353f, 0.957384527f, 0.957826436f,
+  0.958266079f, 0.958703458f, 0.959138632f, 0.95957154f, 0.960002124f,
+  0.960430503f, 0.960856616f, 0.961280465f, 0.961702049f, 0.962121427f,
+  0.962538481f, 0.962953269f, 0.963365793f, 0.963776052f, 0.964184046f,
+  0.964589775f, 0.964993238f, 0.965394437f, 0.965793371f, 0.966189981f,
+  0.966584384f, 0.966976464f, 0.967366278f, 0.967753828f, 0.968139112f,
+  0.968522072f, 0.968902826f, 0.969281256f, 0.969657362f, 0.970031261f,
+  0.970402837f, 0.970772147f, 0.971139133f, 0.971503913f, 0.97186631f,
+  0.972226501f, 0.972584367f, 0.972939968f, 0.973293245f, 0.973644257f,
+  0.973992944f, 0.974339366f, 0.974683523f, 0.975025356f, 0.975364864f,
+  0.975702107f, 0.976037085f, 0.976369739f, 0.976700068f, 0.977028131f,
+  0.977353871f, 0.977677345f, 0.977998495f, 0.97831738f, 0.97863394f,
+  0.978948176f, 0.979260147f, 0.979569793f, 0.979877114f, 0.980182111f,
+  0.980484843f, 0.980785251f, 0.981083393f, 0.981379211f, 0.981672704f,
+  0.981963873f, 0.982252717f, 0.982539296f, 0.982823551f, 0.983105481f,
+  0.983385086f, 0.983662426f, 0.983937442f, 0.984210074f, 0.984480441f,
+  0.984748483f, 0.98501426f, 0.985277653f, 0.985538721f, 0.985797524f,
+  0.986053944f, 0.986308098f, 0.986559927f, 0.986809373f, 0.987056553f,
+  0.987301409f, 0.987543941f, 0.987784147f, 0.988022029f, 0.988257587f,
+  0.98849082f, 0.988721669f, 0.988950253f, 0.989176512f, 0.989400446f,
+  0.989621997f, 0.989841282f, 0.990058184f, 0.99027282f, 0.990485072f,
+  0.990695f, 0.990902662f, 0.991107941f, 0.991310835f, 0.991511464f,
+  0.991709769f, 0.991905689f, 0.992099285f, 0.992290616f, 0.992479563f,
+  0.992666125f, 0.992850423f, 0.993032336f, 0.993211925f, 0.993389189f,
+  0.993564129f, 0.993736744f, 0.993906975f, 0.994074881f, 0.994240463f,
+  0.99440366f, 0.994564593f, 0.994723141f, 0.994879305f, 0.995033205f,
+  0.99518472f, 0.99533391f, 0.995480776f, 0.995625257f, 0.995767415f,
+  0.995907247f, 0.996044695f, 0.996179819f, 0.996312618f, 0.996443033f,
+  0.996571124f, 0.996696889f, 0.996820271f, 0.996941328f, 0.997060061f,
+  0.997176409f, 0.997290432f, 0.997402132f, 0.997511446f, 0.997618437f,
+  0.997723043f, 0.997825325f, 0.997925282f, 0.998022854f, 0.998118103f,
+  0.998211026f, 0.998301566f, 0.998389721f, 0.998475552f, 0.998559058f,
+  0.998640239f, 0.998719037f, 0.99879545f, 0.998869538f, 0.998941302f,
+  0.999010682f, 0.999077737f, 0.999142408f, 0.999204755f, 0.999264777f,
+  0.999322355f, 0.999377668f, 0.999430597f, 0.999481201f, 0.999529421f,
+  0.999575317f, 0.999618828f, 0.999660015f, 0.999698818f, 0.999735296f,
+  0.99976939f, 0.999801159f, 0.999830604f, 0.999857664f, 0.99988234f,
+  0.999904692f, 0.999924719f, 0.999942362f, 0.999957621f, 0.999970615f,
+  0.999981165f, 0.99998939f, 0.999995291f, 0.999998808f, 1.f,
+  0.999998808f, 0.999995291f, 0.99998939f, 0.999981165f, 0.999970615f,
+  0.999957621f, 0.999942362f, 0.999924719f, 0.999904692f, 0.99988234f,
+  0.999857664f, 0.999830604f, 0.999801159f, 0.99976939f, 0.999735296f,
+  0.999698818f, 0.999660015f, 0.999618828f, 0.999575317f, 0.999529421f,
+  0.999481201f, 0.999430597f, 0.999377668f, 0.999322355f, 0.999264777f,
+  0.999204755f, 0.999142408f, 0.999077737f, 0.999010682f, 0.998941302f,
+  0.998869538f, 0.99879545f, 0.998719037f, 0.998640239f, 0.998559058f,
+  0.998475552f, 0.998389721f, 0.998301566f, 0.998211026f, 0.998118103f,
+  0.998022854f, 0.997925282f, 0.997825325f, 0.997723043f, 0.997618437f,
+  0.997511446f, 0.997402132f, 0.997290432f, 0.997176409f, 0.997060061f,
+  0.996941328f, 0.996820271f, 0.996696889f, 0.996571124f, 0.996443033f,
+  0.996312618f, 0.996179819f, 0.996044695f, 0.995907247f, 0.995767415f,
+  0.995625257f, 0.995480776f, 0.99533391f, 0.99518472f, 0.995033205f,
+  0.994879305f, 0.994723141f, 0.994564593f, 0.99440366f, 0.994240463f,
+  0.994074881f, 0.993906975f, 0.993736744f, 0.993564129f, 0.993389189f,
+  0.993211925f, 0.993032336f, 0.992850423f, 0.992666125f, 0.992479563f,
+  0.992290616f, 0.992099285f, 0.991905689f, 0.991709769f, 0.991511464f,
+  0.991310835f, 0.991107941f, 0.990902662f, 0.990695f, 0.990485072f,
+  0.99027282f, 0.990058184f, 0.989841282f, 0.989621997f, 0.989400446f,
+  0.989176512f, 0.988950253f, 0.988721669f, 0.98849082f, 0.988257587f,
+  0.988022029f, 0.987784147f, 0.987543941f, 0.987301409f, 0.987056553f,
+  0.986809373f, 0.986559927f, 0.986308098f, 0.986053944f, 0.985797524f,
+  0.985538721f, 0.985277653f, 0.98501426f, 0.984748483f, 0.984480441f,
+  0.984210074f, 0.983937442f, 0.983662426f, 0.983385086f, 0.983105481f,
+  0.982823551f, 0.982539296f, 0.982252717f, 0.981963873f, 0.981672704f,
+  0.981379211f, 0.981083393f, 0.980785251f, 0.980484843f, 0.980182111f,
+  0.979877114f, 0.979569793f, 0.979260147f, 0.978948176f, 0.97863394f,
+  0.97831738f, 0.977998495f, 0.977677345f, 0.977353871f, 0.977028131f,
+  0.976700068f, 0.976369739f, 0.976037085f, 0.975702107f, 0.975364864f,
+  0.975025356f, 0.974683523f, 0.974339366f, 0.973992944f, 0.973644257f,
+  0.973293245f, 0.972939968f, 0.972584367f, 0.972226501f, 0.97186631f,
+  0.971503913f, 0.971139133f, 0.970772147f, 0.970402837f, 0.970031261f,
+  0.969657362f, 0.969281256f, 0.968902826f, 0.968522072f, 0.968139112f,
+  0.967753828f, 0.967366278f, 0.966976464f, 0.966584384f, 0.966189981f,
+  0.965793371f, 0.965394437f, 0.964993238f, 0.964589775f, 0.964184046f,
+  0.963776052f, 0.963365793f, 0.962953269f, 0.962538481f, 0.962121427f,
+  0.961702049f, 0.961280465f, 0.960856616f, 0.960430503f, 0.960002124f,
+  0.95957154f, 0.959138632f, 0.958703458f, 0.958266079f, 0.957826436f,
+  0.957384527f, 0.956940353f, 0.956493914f, 0.95604527f, 0.955594361f,
+  0.955141187f, 0.954685748f, 0.954228103f, 0.953768194f, 0.953306019f,
+  0.95284164f, 0.952374995f, 0.951906145f, 0.95143503f, 0.950961649f,
+  0.950486064f, 0.950008273f, 0.949528158f, 0.949045897f, 0.94856137f,
+  0.948074579f, 0.947585583f, 0.947094381f, 0.946600914f, 0.946105242f,
+  0.945607305f, 0.945107222f, 0.944604814f, 0.944100261f, 0.943593442f,
+  0.943084419f, 0.94257319f, 0.942059755f, 0.941544056f, 0.941026151f,
+  0.940506041f, 0.939983726f, 0.939459205f, 0.938932478f, 0.938403547f,
+  0.93787235f, 0.937339008f, 0.93680346f, 0.936265647f, 0.935725689f,
+  0.935183525f, 0.934639156f, 0.934092522f, 0.933543801f, 0.932992816f,
+  0.932439625f, 0.931884289f, 0.931326687f, 0.93076694f, 0.930205047f,
+  0.929640889f, 0.929074585f, 0.928506076f, 0.927935421f, 0.927362502f,
+  0.926787496f, 0.926210225f, 0.925630808f, 0.925049245f, 0.924465477f,
+  0.923879504f, 0.923291445f, 0.92270112f, 0.92210865f, 0.921514034f,
+  0.920917213f, 0.920318305f, 0.919717133f, 0.919113874f, 0.91850841f,
+  0.917900801f, 0.917290986f, 0.916679084f, 0.916064978f, 0.915448725f,
+  0.914830327f, 0.914209783f, 0.913587034f, 0.912962198f, 0.912335157f,
+  0.91170603f, 0.911074758f, 0.910441279f, 0.909805715f, 0.909168005f,
+  0.90852809f, 0.907886088f, 0.907242f, 0.906595707f, 0.905947268f,
+  0.905296743f, 0.904644072f, 0.903989315f, 0.903332353f, 0.902673304f,
+  0.902012169f, 0.901348829f, 0.900683403f, 0.900015891f, 0.899346232f,
+  0.898674488f, 0.898000598f, 0.897324562f, 0.8966465f, 0.895966232f,
+  0.895283937f, 0.894599497f, 0.893912971f, 0.893224299f, 0.892533541f,
+  0.891840696f, 0.891145766f, 0.890448749f, 0.889749587f, 0.889048338f,
+  0.888345063f, 0.887639642f, 0.886932135f, 0.886222541f, 0.885510862f,
+  0.884797096f, 0.884081244f, 0.883363366f, 0.882643342f, 0.881921291f,
+  0.881197095f, 0.880470872f, 0.879742622f, 0.879012227f, 0.878279805f,
+  0.877545297f, 0.876808703f, 0.876070082f, 0.875329375f, 0.874586642f,
+  0.873841822f, 0.873094976f, 0.872346044f, 0.871595085f, 0.87084204f,
+  0.870086968f, 0.86932987f, 0.868570685f, 0.867809474f, 0.867046237f,
+  0.866280973f, 0.865513623f, 0.864744246f, 0.863972843f, 0.863199413f,
+  0.862423956f, 0.861646473f, 0.860866964f, 0.860085368f, 0.859301805f,
+  0.858516216f, 0.857728601f, 0.856938958f, 0.856147349f, 0.855353653f,
+  0.854557991f, 0.853760302f, 0.852960587f, 0.852158904f, 0.851355195f,
+  0.850549459f, 0.849741757f, 0.848932028f, 0.848120332f, 0.847306609f,
+  0.84649092f, 0.845673263f, 0.84485358f, 0.84403187f, 0.843208253f,
+  0.84238261f, 0.841554999f, 0.840725362f, 0.839893818f, 0.839060247f,
+  0.838224709f, 0.837387204f, 0.836547732f, 0.835706294f, 0.834862888f,
+  0.834017515f, 0.833170176f, 0.832320869f, 0.831469595f, 0.830616415f,
+  0.829761207f, 0.828904092f, 0.82804507f, 0.827184021f, 0.826321065f,
+  0.825456142f, 0.824589312f, 0.823720515f, 0.82284981f, 0.821977139f,
+  0.8211025f, 0.820225954f, 0.819347501f, 0.81846714f, 0.817584813f,
+  0.816700578f, 0.815814435f, 0.814926326f, 0.81403631f, 0.813144386f,
+  0.812250614f, 0.811354876f, 0.81045717f, 0.809557617f, 0.808656156f,
+  0.807752848f, 0.806847572f, 0.80594039f, 0.805031359f, 0.804120362f,
+  0.803207517f, 0.802292824f, 0.801376164f, 0.800457656f, 0.799537241f,
+  0.798614979f, 0.797690868f, 0.796764791f, 0.795836926f, 0.794907153f,
+  0.793975472f, 0.793041945f, 0.792106569f, 0.791169345f, 0.790230215f,
+  0.789289236f, 0.78834641f, 0.787401736f, 0.786455214f, 0.785506845f,
+  0.784556568f, 0.783604503f, 0.78265059f, 0.781694829f, 0.780737221f,
+  0.779777765f, 0.778816521f, 0.777853429f, 0.77688849f, 0.775921702f,
+  0.774953127f, 0.773982704f, 0.773010433f, 0.772036374f, 0.771060526f,
+  0.770082831f, 0.769103348f, 0.768122017f, 0.767138898f, 0.766153991f,
+  0.765167236f, 0.764178753f, 0.763188422f, 0.762196302f, 0.761202395f,
+  0.760206699f, 0.759209216f, 0.758209884f, 0.757208824f, 0.756205976f,
+  0.755201399f, 0.754194975f, 0.753186822f, 0.752176821f, 0.751165152f,
+  0.750151634f, 0.749136388f, 0.748119354f, 0.747100592f, 0.746080101f,
+  0.745057762f, 0.744033754f, 0.743007958f, 0.741980433f, 0.740951121f,
+  0.73992008f, 0.73888731f, 0.737852812f, 0.736816585f, 0.73577857f,
+  0.734738886f, 0.733697414f, 0.732654274f, 0.731609404f, 0.730562747f,
+  0.72951442f, 0.728464365f, 0.727412641f, 0.726359129f, 0.725303948f,
+  0.724247098f, 0.72318846f, 0.722128212f, 0.721066177f, 0.720002532f,
+  0.718937099f, 0.717870057f, 0.716801286f, 0.715730846f, 0.714658678f,
+  0.71358484f, 0.712509394f, 0.711432219f, 0.710353374f, 0.709272802f,
+  0.70819062f, 0.707106769f, 0.706021249f, 0.704934061f, 0.703845263f,
+  0.702754736f, 0.7016626f, 0.700568795f, 0.699473321f, 0.698376238f,
+  0.697277486f, 0.696177125f, 0.695075095f, 0.693971455f, 0.692866147f,
+  0.691759229f, 0.690650702f, 0.689540565f, 0.68842876f, 0.687315345f,
+  0.686200321f, 0.685083687f, 0.683965385f, 0.682845533f, 0.681724072f,
+  0.680601001f, 0.679476321f, 0.678350031f, 0.677222192f, 0.676092684f,
+  0.674961627f, 0.673829019f, 0.672694743f, 0.671558976f, 0.670421541f,
+  0.669282615f, 0.668142021f, 0.666999936f, 0.665856242f, 0.664710999f,
+  0.663564146f, 0.662415802f, 0.66126585f, 0.660114348f, 0.658961296f,
+  0.657806695f, 0.656650543f, 0.655492842f, 0.654333591f, 0.653172851f,
+  0.65201056f, 0.65084666f, 0.64968133f, 0.64851439f, 0.64734596f,
+  0.64617604f, 0.645004511f, 0.643831551f, 0.642657042f, 0.641481042f,
+  0.640303493f, 0.639124453f, 0.637943923f, 0.636761844f, 0.635578334f,
+  0.634393275f, 0.633206785f, 0.632018745f, 0.630829215f, 0.629638255f,
+  0.628445745f, 0.627251804f, 0.626056373f, 0.624859512f, 0.623661101f,
+  0.622461259f, 0.621259987f, 0.620057225f, 0.618852973f, 0.61764729f,
+  0.616440177f, 0.615231574f, 0.61402154f, 0.612810075f, 0.61159718f,
+  0.610382795f, 0.609167039f, 0.607949793f, 0.606731117f, 0.605511069f,
+  0.604289532f, 0.603066623f, 0.601842225f, 0.600616455f, 0.599389315f,
+  0.598160684f, 0.596930683f, 0.59569931f, 0.594466507f, 0.593232274f,
+  0.59199667f, 0.590759695f, 0.589521289f, 0.588281572f, 0.587040365f,
+  0.585797846f, 0.584553957f, 0.583308637f, 0.582062006f, 0.580813944f,
+  0.579564571f, 0.578313768f, 0.577061653f, 0.575808167f, 0.57455337f,
+  0.573297143f, 0.572039604f, 0.570780754f, 0.569520533f, 0.568258941f,
+  0.566996038f, 0.565731823f, 0.564466238f, 0.563199341f, 0.561931133f,
+  0.560661554f, 0.559390724f, 0.558118522f, 0.556845009f, 0.555570245f,
+  0.554294109f, 0.553016722f, 0.551737964f, 0.550457954f, 0.549176633f,
+  0.547894061f, 0.546610177f, 0.545324981f, 0.544038534f, 0.542750776f,
+  0.541461766f, 0.540171444f, 0.538879931f, 0.537587047f, 0.53629297f,
+  0.534997642f, 0.533701003f, 0.532403111f, 0.531104028f, 0.529803634f,
+  0.528501987f, 0.527199149f, 0.525895f, 0.524589658f, 0.523283124f,
+  0.521975279f, 0.520666242f, 0.519356012f, 0.518044531f, 0.516731799f,
+  0.515417874f, 0.514102757f, 0.512786388f, 0.511468828f, 0.510150075f,
+  0.50883013f, 0.507508993f, 0.506186664f, 0.504863083f, 0.50353837f,
+  0.502212465f, 0.500885367f, 0.499557108f, 0.498227656f, 0.496897042f,
+  0.495565265f, 0.494232297f, 0.492898196f, 0.491562903f, 0.490226477f,
+  0.48888889f, 0.487550169f, 0.486210287f, 0.484869242f, 0.483527064f,
+  0.482183784f, 0.480839342f, 0.479493767f, 0.47814706f, 0.47679922f,
+  0.475450277f, 0.474100202f, 0.472749025f, 0.471396744f, 0.470043331f,
+  0.468688816f, 0.467333198f, 0.465976506f, 0.464618683f, 0.463259786f,
+  0.461899787f, 0.460538715f, 0.45917654f, 0.457813293f, 0.456448972f,
+  0.455083579f, 0.453717113f, 0.452349573f, 0.450980991f, 0.449611336f,
+  0.448240608f, 0.446868837f, 0.445496023f, 0.444122136f, 0.442747235f,
+  0.441371262f, 0.439994276f, 0.438616246f, 0.437237173f, 0.435857087f,
+  0.434475958f, 0.433093816f, 0.43171066f, 0.430326492f, 0.42894128f,
+  0.427555084f, 0.426167876f, 0.424779683f, 0.423390478f, 0.422000259f,
+  0.420609087f, 0.419216901f, 0.417823702f, 0.416429549f, 0.415034413f,
+  0.413638324f, 0.41224122f, 0.410843164f, 0.409444153f, 0.408044159f,
+  0.406643212f, 0.405241311f, 0.403838456f, 0.402434647f, 0.401029885f,
+  0.399624199f, 0.398217559f, 0.396809995f, 0.395401478f, 0.393992037f,
+  0.392581671f, 0.391170382f, 0.38975817f, 0.388345033f, 0.386931002f,
+  0.385516047f, 0.384100199f, 0.382683426f, 0.381265759f, 0.379847199f,
+  0.378427744f, 0.377007425f, 0.375586182f, 0.374164075f, 0.372741073f,
+  0.371317208f, 0.369892448f, 0.368466824f, 0.367040336f, 0.365612984f,
+  0.364184797f, 0.362755716f, 0.3613258f, 0.359895051f, 0.358463407f,
+  0.357030958f, 0.355597675f, 0.354163527f, 0.352728546f, 0.351292759f,
+  0.349856138f, 0.348418683f, 0.346980423f, 0.345541328f, 0.344101429f,
+  0.342660725f, 0.341219217f, 0.339776874f, 0.338333756f, 0.336889863f,
+  0.335445136f, 0.333999664f, 0.332553357f, 0.331106305f, 0.329658449f,
+  0.328209847f, 0.326760441f, 0.32531029f, 0.323859364f, 0.322407693f,
+  0.320955247f, 0.319502026f, 0.31804809f, 0.316593379f, 0.315137923f,
+  0.313681751f, 0.312224805f, 0.310767144f, 0.309308767f, 0.307849646f,
+  0.306389809f, 0.304929227f, 0.303467959f, 0.302005947f, 0.300543249f,
+  0.299079835f, 0.297615707f, 0.296150893f, 0.294685364f, 0.293219149f,
+  0.291752249f, 0.290284663f, 0.288816422f, 0.287347466f, 0.285877824f,
+  0.284407526f, 0.282936573f, 0.281464934f, 0.27999264f, 0.27851969f,
+  0.277046084f, 0.275571823f, 0.274096906f, 0.272621363f, 0.271145165f,
+  0.269668311f, 0.268190861f, 0.266712755f, 0.265234023f, 0.263754666f,
+  0.262274712f, 0.260794103f, 0.259312928f, 0.257831097f, 0.25634867f,
+  0.254865646f, 0.253382027f, 0.251897812f, 0.250413001f, 0.248927608f,
+  0.24744162f, 0.24595505f, 0.244467899f, 0.242980182f, 0.241491884f,
+  0.24000302f, 0.238513589f, 0.237023607f, 0.235533059f, 0.234041959f,
+  0.232550308f, 0.231058106f, 0.229565367f, 0.228072077f, 0.226578265f,
+  0.225083917f, 0.223589033f, 0.222093627f, 0.220597684f, 0.219101235f,
+  0.21760428f, 0.216106802f, 0.214608818f, 0.213110313f, 0.211611331f,
+  0.210111842f, 0.208611846f, 0.207111374f, 0.205610409f, 0.204108968f,
+  0.202607036f, 0.201104641f, 0.199601755f, 0.198098406f, 0.196594596f,
+  0.195090324f, 0.19358559f, 0.192080393f, 0.19057475f, 0.18906866f,
+  0.187562123f, 0.186055154f, 0.184547737f, 0.183039889f, 0.181531608f,
+  0.180022895f, 0.178513765f, 0.177004218f, 0.175494254f, 0.173983872f,
+  0.172473088f, 0.170961887f, 0.169450298f, 0.167938292f, 0.166425899f,
+  0.164913118f, 0.16339995f, 0.161886394f, 0.160372451f, 0.15885815f,
+  0.157343462f, 0.155828401f, 0.154312968f, 0.152797192f, 0.151281044f,
+  0.149764538f, 0.148247674f, 0.146730468f, 0.145212919f, 0.143695027f,
+  0.142176807f, 0.140658244f, 0.139139339f, 0.137620121f, 0.136100575f,
+  0.134580702f, 0.13306053f, 0.13154003f, 0.130019218f, 0.128498107f,
+  0.126976699f, 0.125454977f, 0.123932973f, 0.122410677f, 0.120888084f,
+  0.119365215f, 0.117842063f, 0.116318628f, 0.114794925f, 0.113270953f,
+  0.111746714f, 0.110222206f, 0.108697444f, 0.107172422f, 0.105647154f,
+  0.104121633f, 0.102595866f, 0.10106986f, 0.0995436162f, 0.0980171412f,
+  0.0964904279f, 0.0949634984f, 0.093436338f, 0.0919089541f, 0.0903813615f,
+  0.0888535529f, 0.0873255357f, 0.0857973099f, 0.0842688903f, 0.0827402622f,
+  0.0812114477f, 0.0796824396f, 0.0781532452f, 0.0766238645f, 0.0750942975f,
+  0.0735645667f, 0.0720346496f, 0.070504576f, 0.068974331f, 0.0674439222f,
+  0.0659133494f, 0.0643826276f, 0.0628517568f, 0.061320737f, 0.0597895719f,
+  0.0582582653f, 0.0567268208f, 0.0551952459f, 0.0536635369f, 0.052131705f,
+  0.0505997501f, 0.0490676761f, 0.0475354828f, 0.0460031815f, 0.0444707721f,
+  0.0429382585f, 0.0414056405f, 0.0398729257f, 0.0383401215f, 0.0368072242f,
+  0.0352742374f, 0.0337411724f, 0.0322080255f, 0.030674804f, 0.029141508f,
+  0.027608145f, 0.0260747187f, 0.024541229f, 0.0230076816f, 0.0214740802f,
+  0.0199404284f, 0.0184067301f, 0.0168729872f, 0.015339206f, 0.0138053885f,
+  0.0122715384f, 0.0107376594f, 0.00920375437f, 0.00766982883f, 0.00613588467f,
+  0.00460192608f, 0.00306795677f, 0.00153398013f, 0.f, -0.00153398013f,
+  -0.00306795677f, -0.00460192608f, -0.00613588467f, -0.00766982883f, -0.00920375437f,
+  -0.0107376594f, -0.0122715384f, -0.0138053885f, -0.015339206f, -0.0168729872f,
+  -0.0184067301f, -0.0199404284f, -0.0214740802f, -0.0230076816f, -0.024541229f,
+  -0.0260747187f, -0.027608145f, -0.029141508f, -0.030674804f, -0.0322080255f,
+  -0.0337411724f, -0.0352742374f, -0.0368072242f, -0.0383401215f, -0.0398729257f,
+  -0.0414056405f, -0.0429382585f, -0.0444707721f, -0.0460031815f, -0.0475354828f,
+  -0.0490676761f, -0.0505997501f, -0.052131705f, -0.0536635369f, -0.0551952459f,
+  -0.0567268208f, -0.0582582653f, -0.0597895719f, -0.061320737f, -0.0628517568f,
+  -0.0643826276f, -0.0659133494f, -0.0674439222f, -0.068974331f, -0.070504576f,
+  -0.0720346496f, -0.0735645667f, -0.0750942975f, -0.0766238645f, -0.0781532452f,
+  -0.0796824396f, -0.0812114477f, -0.0827402622f, -0.0842688903f, -0.0857973099f,
+  -0.0873255357f, -0.0888535529f, -0.0903813615f, -0.0919089541f, -0.093436338f,
+  -0.0949634984f, -0.0964904279f, -0.0980171412f, -0.0995436162f, -0.10106986f,
+  -0.102595866f, -0.104121633f, -0.105647154f, -0.107172422f, -0.108697444f,
+  -0.110222206f, -0.111746714f, -0.113270953f, -0.114794925f, -0.116318628f,
+  -0.117842063f, -0.119365215f, -0.120888084f, -0.122410677f, -0.123932973f,
+  -0.125454977f, -0.126976699f, -0.128498107f, -0.130019218f, -0.13154003f,
+  -0.13306053f, -0.134580702f, -0.136100575f, -0.137620121f, -0.139139339f,
+  -0.140658244f, -0.142176807f, -0.143695027f, -0.145212919f, -0.146730468f,
+  -0.148247674f, -0.149764538f, -0.151281044f, -0.152797192f, -0.154312968f,
+  -0.155828401f, -0.157343462f, -0.15885815f, -0.160372451f, -0.161886394f,
+  -0.16339995f, -0.164913118f, -0.166425899f, -0.167938292f, -0.169450298f,
+  -0.170961887f, -0.172473088f, -0.173983872f, -0.175494254f, -0.177004218f,
+  -0.178513765f, -0.180022895f, -0.181531608f, -0.183039889f, -0.184547737f,
+  -0.186055154f, -0.187562123f, -0.18906866f, -0.19057475f, -0.192080393f,
+  -0.19358559f, -0.195090324f, -0.196594596f, -0.198098406f, -0.199601755f,
+  -0.201104641f, -0.202607036f, -0.204108968f, -0.205610409f, -0.207111374f,
+  -0.208611846f, -0.210111842f, -0.211611331f, -0.213110313f, -0.214608818f,
+  -0.216106802f, -0.21760428f, -0.219101235f, -0.220597684f, -0.222093627f,
+  -0.223589033f, -0.225083917f, -0.226578265f, -0.228072077f, -0.229565367f,
+  -0.231058106f, -0.232550308f, -0.234041959f, -0.235533059f, -0.237023607f,
+  -0.238513589f, -0.24000302f, -0.241491884f, -0.242980182f, -0.244467899f,
+  -0.24595505f, -0.24744162f, -0.248927608f, -0.250413001f, -0.251897812f,
+  -0.253382027f, -0.254865646f, -0.25634867f, -0.257831097f, -0.259312928f,
+  -0.260794103f, -0.262274712f, -0.263754666f, -0.265234023f, -0.266712755f,
+  -0.268190861f, -0.269668311f, -0.271145165f, -0.272621363f, -0.274096906f,
+  -0.275571823f, -0.277046084f, -0.27851969f, -0.27999264f, -0.281464934f,
+  -0.282936573f, -0.284407526f, -0.285877824f, -0.287347466f, -0.288816422f,
+  -0.290284663f, -0.291752249f, -0.293219149f, -0.294685364f, -0.296150893f,
+  -0.297615707f, -0.299079835f, -0.300543249f, -0.302005947f, -0.303467959f,
+  -0.304929227f, -0.306389809f, -0.307849646f, -0.309308767f, -0.310767144f,
+  -0.312224805f, -0.313681751f, -0.315137923f, -0.316593379f, -0.31804809f,
+  -0.319502026f, -0.320955247f, -0.322407693f, -0.323859364f, -0.32531029f,
+  -0.326760441f, -0.328209847f, -0.329658449f, -0.331106305f, -0.332553357f,
+  -0.333999664f, -0.335445136f, -0.336889863f, -0.338333756f, -0.339776874f,
+  -0.341219217f, -0.342660725f, -0.344101429f, -0.345541328f, -0.346980423f,
+  -0.348418683f, -0.349856138f, -0.351292759f, -0.352728546f, -0.354163527f,
+  -0.355597675f, -0.357030958f, -0.358463407f, -0.359895051f, -0.3613258f,
+  -0.362755716f, -0.364184797f, -0.365612984f, -0.367040336f, -0.368466824f,
+  -0.369892448f, -0.371317208f, -0.372741073f, -0.374164075f, -0.375586182f,
+  -0.377007425f, -0.378427744f, -0.379847199f, -0.381265759f, -0.382683426f,
+  -0.384100199f, -0.385516047f, -0.386931002f, -0.388345033f, -0.38975817f,
+  -0.391170382f, -0.392581671f, -0.393992037f, -0.395401478f, -0.396809995f,
+  -0.398217559f, -0.399624199f, -0.401029885f, -0.402434647f, -0.403838456f,
+  -0.405241311f, -0.406643212f, -0.408044159f, -0.409444153f, -0.410843164f,
+  -0.41224122f, -0.413638324f, -0.415034413f, -0.416429549f, -0.417823702f,
+  -0.419216901f, -0.420609087f, -0.422000259f, -0.423390478f, -0.424779683f,
+  -0.426167876f, -0.427555084f, -0.42894128f, -0.430326492f, -0.43171066f,
+  -0.433093816f, -0.434475958f, -0.435857087f, -0.437237173f, -0.438616246f,
+  -0.439994276f, -0.441371262f, -0.442747235f, -0.444122136f, -0.445496023f,
+  -0.446868837f, -0.448240608f, -0.449611336f, -0.450980991f, -0.452349573f,
+  -0.453717113f, -0.455083579f, -0.456448972f, -0.457813293f, -0.45917654f,
+  -0.460538715f, -0.461899787f, -0.463259786f, -0.464618683f, -0.465976506f,
+  -0.467333198f, -0.468688816f, -0.470043331f, -0.471396744f, -0.472749025f,
+  -0.474100202f, -0.475450277f, -0.47679922f, -0.47814706f, -0.479493767f,
+  -0.480839342f, -0.482183784f, -0.483527064f, -0.484869242f, -0.486210287f,
+  -0.487550169f, -0.48888889f, -0.490226477f, -0.491562903f, -0.492898196f,
+  -0.494232297f, -0.495565265f, -0.496897042f, -0.498227656f, -0.499557108f,
+  -0.500885367f, -0.502212465f, -0.50353837f, -0.504863083f, -0.506186664f,
+  -0.507508993f, -0.50883013f, -0.510150075f, -0.511468828f, -0.512786388f,
+  -0.514102757f, -0.515417874f, -0.516731799f, -0.518044531f, -0.519356012f,
+  -0.520666242f, -0.521975279f, -0.523283124f, -0.524589658f, -0.525895f,
+  -0.527199149f, -0.528501987f, -0.529803634f, -0.531104028f, -0.532403111f,
+  -0.533701003f, -0.534997642f, -0.53629297f, -0.537587047f, -0.538879931f,
+  -0.540171444f, -0.541461766f, -0.542750776f, -0.544038534f, -0.545324981f,
+  -0.546610177f, -0.547894061f, -0.549176633f, -0.550457954f, -0.551737964f,
+  -0.553016722f, -0.554294109f, -0.555570245f, -0.556845009f, -0.558118522f,
+  -0.559390724f, -0.560661554f, -0.561931133f, -0.563199341f, -0.564466238f,
+  -0.565731823f, -0.566996038f, -0.568258941f, -0.569520533f, -0.570780754f,
+  -0.572039604f, -0.573297143f, -0.57455337f, -0.575808167f, -0.577061653f,
+  -0.578313768f, -0.579564571f, -0.580813944f, -0.582062006f, -0.583308637f,
+  -0.584553957f, -0.585797846f, -0.587040365f, -0.588281572f, -0.589521289f,
+  -0.590759695f, -0.59199667f, -0.593232274f, -0.594466507f, -0.59569931f,
+  -0.596930683f, -0.598160684f, -0.599389315f, -0.600616455f, -0.601842225f,
+  -0.603066623f, -0.604289532f, -0.605511069f, -0.606731117f, -0.607949793f,
+  -0.609167039f, -0.610382795f, -0.61159718f, -0.612810075f, -0.61402154f,
+  -0.615231574f, -0.616440177f, -0.61764729f, -0.618852973f, -0.620057225f,
+  -0.621259987f, -0.622461259f, -0.623661101f, -0.624859512f, -0.626056373f,
+  -0.627251804f, -0.628445745f, -0.629638255f, -0.630829215f, -0.632018745f,
+  -0.633206785f, -0.634393275f, -0.635578334f, -0.636761844f, -0.637943923f,
+  -0.639124453f, -0.640303493f, -0.641481042f, -0.642657042f, -0.643831551f,
+  -0.645004511f, -0.64617604f, -0.64734596f, -0.64851439f, -0.64968133f,
+  -0.65084666f, -0.65201056f, -0.653172851f, -0.654333591f, -0.655492842f,
+  -0.656650543f, -0.657806695f, -0.658961296f, -0.660114348f, -0.66126585f,
+  -0.662415802f, -0.663564146f, -0.664710999f, -0.665856242f, -0.666999936f,
+  -0.668142021f, -0.669282615f, -0.670421541f, -0.671558976f, -0.672694743f,
+  -0.673829019f, -0.674961627f, -0.676092684f, -0.677222192f, -0.678350031f,
+  -0.679476321f, -0.680601001f, -0.681724072f, -0.682845533f, -0.683965385f,
+  -0.685083687f, -0.686200321f, -0.687315345f, -0.68842876f, -0.689540565f,
+  -0.690650702f, -0.691759229f, -0.692866147f, -0.693971455f, -0.695075095f,
+  -0.696177125f, -0.697277486f, -0.698376238f, -0.699473321f, -0.700568795f,
+  -0.7016626f, -0.702754736f, -0.703845263f, -0.704934061f, -0.706021249f,
+  -0.707106769f, -0.70819062f, -0.709272802f, -0.710353374f, -0.711432219f,
+  -0.712509394f, -0.71358484f, -0.714658678f, -0.715730846f, -0.716801286f,
+  -0.717870057f, -0.718937099f, -0.720002532f, -0.721066177f, -0.722128212f,
+  -0.72318846f, -0.724247098f, -0.725303948f, -0.726359129f, -0.727412641f,
+  -0.728464365f, -0.72951442f, -0.730562747f, -0.731609404f, -0.732654274f,
+  -0.733697414f, -0.734738886f, -0.73577857f, -0.736816585f, -0.737852812f,
+  -0.73888731f, -0.73992008f, -0.740951121f, -0.741980433f, -0.743007958f,
+  -0.744033754f, -0.745057762f, -0.746080101f, -0.747100592f, -0.748119354f,
+  -0.749136388f, -0.750151634f, -0.751165152f, -0.752176821f, -0.753186822f,
+  -0.754194975f, -0.755201399f, -0.756205976f, -0.757208824f, -0.758209884f,
+  -0.759209216f, -0.760206699f, -0.761202395f, -0.762196302f, -0.763188422f,
+  -0.764178753f, -0.765167236f, -0.766153991f, -0.767138898f, -0.768122017f,
+  -0.769103348f, -0.770082831f, -0.771060526f, -0.772036374f, -0.773010433f,
+  -0.773982704f, -0.774953127f, -0.775921702f, -0.77688849f, -0.777853429f,
+  -0.778816521f, -0.779777765f, -0.780737221f, -0.781694829f, -0.78265059f,
+  -0.783604503f, -0.784556568f, -0.785506845f, -0.786455214f, -0.787401736f,
+  -0.78834641f, -0.789289236f, -0.790230215f, -0.791169345f, -0.792106569f,
+  -0.793041945f, -0.793975472f, -0.794907153f, -0.795836926f, -0.796764791f,
+  -0.797690868f, -0.798614979f, -0.799537241f, -0.800457656f, -0.801376164f,
+  -0.802292824f, -0.803207517f, -0.804120362f, -0.805031359f, -0.80594039f,
+  -0.806847572f, -0.807752848f, -0.808656156f, -0.809557617f, -0.81045717f,
+  -0.811354876f, -0.812250614f, -0.813144386f, -0.81403631f, -0.814926326f,
+  -0.815814435f, -0.816700578f, -0.817584813f, -0.81846714f, -0.819347501f,
+  -0.820225954f, -0.8211025f, -0.821977139f, -0.82284981f, -0.823720515f,
+  -0.824589312f, -0.825456142f, -0.826321065f, -0.827184021f, -0.82804507f,
+  -0.828904092f, -0.829761207f, -0.830616415f, -0.831469595f, -0.832320869f,
+  -0.833170176f, -0.834017515f, -0.834862888f, -0.835706294f, -0.836547732f,
+  -0.837387204f, -0.838224709f, -0.839060247f, -0.839893818f, -0.840725362f,
+  -0.841554999f, -0.84238261f, -0.843208253f, -0.84403187f, -0.84485358f,
+  -0.845673263f, -0.84649092f, -0.847306609f, -0.848120332f, -0.848932028f,
+  -0.849741757f, -0.850549459f, -0.851355195f, -0.852158904f, -0.852960587f,
+  -0.853760302f, -0.854557991f, -0.855353653f, -0.856147349f, -0.856938958f,
+  -0.857728601f, -0.858516216f, -0.859301805f, -0.860085368f, -0.860866964f,
+  -0.861646473f, -0.862423956f, -0.863199413f, -0.863972843f, -0.864744246f,
+  -0.865513623f, -0.866280973f, -0.867046237f, -0.867809474f, -0.868570685f,
+  -0.86932987f, -0.870086968f, -0.87084204f, -0.871595085f, -0.872346044f,
+  -0.873094976f, -0.873841822f, -0.874586642f, -0.875329375f, -0.876070082f,
+  -0.876808703f, -0.877545297f, -0.878279805f, -0.879012227f, -0.879742622f,
+  -0.880470872f, -0.881197095f, -0.881921291f, -0.882643342f, -0.883363366f,
+  -0.884081244f, -0.884797096f, -0.885510862f, -0.886222541f, -0.886932135f,
+  -0.887639642f, -0.888345063f, -0.889048338f, -0.889749587f, -0.890448749f,
+  -0.891145766f, -0.891840696f, -0.892533541f, -0.893224299f, -0.893912971f,
+  -0.894599497f, -0.895283937f, -0.895966232f, -0.8966465f, -0.897324562f,
+  -0.898000598f, -0.898674488f, -0.899346232f, -0.900015891f, -0.900683403f,
+  -0.901348829f, -0.902012169f, -0.902673304f, -0.903332353f, -0.903989315f,
+  -0.904644072f, -0.905296743f, -0.905947268f, -0.906595707f, -0.907242f,
+  -0.907886088f, -0.90852809f, -0.909168005f, -0.909805715f, -0.910441279f,
+  -0.911074758f, -0.91170603f, -0.912335157f, -0.912962198f, -0.913587034f,
+  -0.914209783f, -0.914830327f, -0.915448725f, -0.916064978f, -0.916679084f,
+  -0.917290986f, -0.917900801f, -0.91850841f, -0.919113874f, -0.919717133f,
+  -0.920318305f, -0.920917213f, -0.921514034f, -0.92210865f, -0.92270112f,
+  -0.923291445f, -0.923879504f, -0.924465477f, -0.925049245f, -0.925630808f,
+  -0.926210225f, -0.926787496f, -0.927362502f, -0.927935421f, -0.928506076f,
+  -0.929074585f, -0.929640889f, -0.930205047f, -0.93076694f, -0.931326687f,
+  -0.931884289f, -0.932439625f, -0.932992816f, -0.933543801f, -0.934092522f,
+  -0.934639156f, -0.935183525f, -0.935725689f, -0.936265647f, -0.93680346f,
+  -0.937339008f, -0.93787235f, -0.938403547f, -0.938932478f, -0.939459205f,
+  -0.939983726f, -0.940506041f, -0.941026151f, -0.941544056f, -0.942059755f,
+  -0.94257319f, -0.943084419f, -0.943593442f, -0.944100261f, -0.944604814f,
+  -0.945107222f, -0.945607305f, -0.946105242f, -0.946600914f, -0.947094381f,
+  -0.947585583f, -0.948074579f, -0.94856137f, -0.949045897f, -0.949528158f,
+  -0.950008273f, -0.950486064f, -0.950961649f, -0.95143503f, -0.951906145f,
+  -0.952374995f, -0.95284164f, -0.953306019f, -0.953768194f, -0.954228103f,
+  -0.954685748f, -0.955141187f, -0.955594361f, -0.95604527f, -0.956493914f,
+  -0.956940353f, -0.957384527f, -0.957826436f, -0.958266079f, -0.958703458f,
+  -0.959138632f, -0.95957154f, -0.960002124f, -0.960430503f, -0.960856616f,
+  -0.961280465f, -0.961702049f, -0.962121427f, -0.962538481f, -0.962953269f,
+  -0.963365793f, -0.963776052f, -0.964184046f, -0.964589775f, -0.964993238f,
+  -0.965394437f, -0.965793371f, -0.966189981f, -0.966584384f, -0.966976464f,
+  -0.967366278f, -0.967753828f, -0.968139112f, -0.968522072f, -0.968902826f,
+  -0.969281256f, -0.969657362f, -0.970031261f, -0.970402837f, -0.970772147f,
+  -0.971139133f, -0.971503913f, -0.97186631f, -0.972226501f, -0.972584367f,
+  -0.972939968f, -0.973293245f, -0.973644257f, -0.973992944f, -0.974339366f,
+  -0.974683523f, -0.975025356f, -0.975364864f, -0.975702107f, -0.976037085f,
+  -0.976369739f, -0.976700068f, -0.977028131f, -0.977353871f, -0.977677345f,
+  -0.977998495f, -0.97831738f, -0.97863394f, -0.978948176f, -0.979260147f,
+  -0.979569793f, -0.979877114f, -0.980182111f, -0.980484843f, -0.980785251f,
+  -0.981083393f, -0.981379211f, -0.981672704f, -0.981963873f, -0.982252717f,
+  -0.982539296f, -0.982823551f, -0.983105481f, -0.983385086f, -0.983662426f,
+  -0.983937442f, -0.984210074f, -0.984480441f, -0.984748483f, -0.98501426f,
+  -0.985277653f, -0.985538721f, -0.985797524f, -0.986053944f, -0.986308098f,
+  -0.986559927f, -0.986809373f, -0.987056553f, -0.987301409f, -0.987543941f,
+  -0.987784147f, -0.988022029f, -0.988257587f, -0.98849082f, -0.988721669f,
+  -0.988950253f, -0.989176512f, -0.989400446f, -0.989621997f, -0.989841282f,
+  -0.990058184f, -0.99027282f, -0.990485072f, -0.990695f, -0.990902662f,
+  -0.991107941f, -0.991310835f, -0.991511464f, -0.991709769f, -0.991905689f,
+  -0.992099285f, -0.992290616f, -0.992479563f, -0.992666125f, -0.992850423f,
+  -0.993032336f, -0.993211925f, -0.993389189f, -0.993564129f, -0.993736744f,
+  -0.993906975f, -0.994074881f, -0.994240463f, -0.99440366f, -0.994564593f,
+  -0.994723141f, -0.994879305f, -0.995033205f, -0.99518472f, -0.99533391f,
+  -0.995480776f, -0.995625257f, -0.995767415f, -0.995907247f, -0.996044695f,
+  -0.996179819f, -0.996312618f, -0.996443033f, -0.996571124f, -0.996696889f,
+  -0.996820271f, -0.996941328f, -0.997060061f, -0.997176409f, -0.997290432f,
+  -0.997402132f, -0.997511446f, -0.997618437f, -0.997723043f, -0.997825325f,
+  -0.997925282f, -0.998022854f, -0.998118103f, -0.998211026f, -0.998301566f,
+  -0.998389721f, -0.998475552f, -0.998559058f, -0.998640239f, -0.998719037f,
+  -0.99879545f, -0.998869538f, -0.998941302f, -0.999010682f, -0.999077737f,
+  -0.999142408f, -0.999204755f, -0.999264777f, -0.999322355f, -0.999377668f,
+  -0.999430597f, -0.999481201f, -0.999529421f, -0.999575317f, -0.999618828f,
+  -0.999660015f, -0.999698818f, -0.999735296f, -0.99976939f, -0.999801159f,
+  -0.999830604f, -0.999857664f, -0.99988234f, -0.999904692f, -0.999924719f,
+  -0.999942362f, -0.999957621f, -0.999970615f, -0.999981165f, -0.99998939f,
+  -0.999995291f, -0.999998808f, -1.f, -0.999998808f, -0.999995291f,
+  -0.99998939f, -0.999981165f, -0.999970615f, -0.999957621f, -0.999942362f,
+  -0.999924719f, -0.999904692f, -0.99988234f, -0.999857664f, -0.999830604f,
+  -0.999801159f, -0.99976939f, -0.999735296f, -0.999698818f, -0.999660015f,
+  -0.999618828f, -0.999575317f, -0.999529421f, -0.999481201f, -0.999430597f,
+  -0.999377668f, -0.999322355f, -0.999264777f, -0.999204755f, -0.999142408f,
+  -0.999077737f, -0.999010682f, -0.998941302f, -0.998869538f, -0.99879545f,
+  -0.998719037f, -0.998640239f, -0.998559058f, -0.998475552f, -0.998389721f,
+  -0.998301566f, -0.998211026f, -0.998118103f, -0.998022854f, -0.997925282f,
+  -0.997825325f, -0.997723043f, -0.997618437f, -0.997511446f, -0.997402132f,
+  -0.997290432f, -0.997176409f, -0.997060061f, -0.996941328f, -0.996820271f,
+  -0.996696889f, -0.996571124f, -0.996443033f, -0.996312618f, -0.996179819f,
+  -0.996044695f, -0.995907247f, -0.995767415f, -0.995625257f, -0.995480776f,
+  -0.99533391f, -0.99518472f, -0.995033205f, -0.994879305f, -0.994723141f,
+  -0.994564593f, -0.99440366f, -0.994240463f, -0.994074881f, -0.993906975f,
+  -0.993736744f, -0.993564129f, -0.993389189f, -0.993211925f, -0.993032336f,
+  -0.992850423f, -0.992666125f, -0.992479563f, -0.992290616f, -0.992099285f,
+  -0.991905689f, -0.991709769f, -0.991511464f, -0.991310835f, -0.991107941f,
+  -0.990902662f, -0.990695f, -0.990485072f, -0.99027282f, -0.990058184f,
+  -0.989841282f, -0.989621997f, -0.989400446f, -0.989176512f, -0.988950253f,
+  -0.988721669f, -0.98849082f, -0.988257587f, -0.988022029f, -0.987784147f,
+  -0.987543941f, -0.987301409f, -0.987056553f, -0.986809373f, -0.986559927f,
+  -0.986308098f, -0.986053944f, -0.985797524f, -0.985538721f, -0.985277653f,
+  -0.98501426f, -0.984748483f, -0.984480441f, -0.984210074f, -0.983937442f,
+  -0.983662426f, -0.983385086f, -0.983105481f, -0.982823551f, -0.982539296f,
+  -0.982252717f, -0.981963873f, -0.981672704f, -0.981379211f, -0.981083393f,
+  -0.980785251f, -0.980484843f, -0.980182111f, -0.979877114f, -0.979569793f,
+  -0.979260147f, -0.978948176f, -0.97863394f, -0.97831738f, -0.977998495f,
+  -0.977677345f, -0.977353871f, -0.977028131f, -0.976700068f, -0.976369739f,
+  -0.976037085f, -0.975702107f, -0.975364864f, -0.975025356f, -0.974683523f,
+  -0.974339366f, -0.973992944f, -0.973644257f, -0.973293245f, -0.972939968f,
+  -0.972584367f, -0.972226501f, -0.97186631f, -0.971503913f, -0.971139133f,
+  -0.970772147f, -0.970402837f, -0.970031261f, -0.969657362f, -0.969281256f,
+  -0.968902826f, -0.968522072f, -0.968139112f, -0.967753828f, -0.967366278f,
+  -0.966976464f, -0.966584384f, -0.966189981f, -0.965793371f, -0.965394437f,
+  -0.964993238f, -0.964589775f, -0.964184046f, -0.963776052f, -0.963365793f,
+  -0.962953269f, -0.962538481f, -0.962121427f, -0.961702049f, -0.961280465f,
+  -0.960856616f, -0.960430503f, -0.960002124f, -0.95957154f, -0.959138632f,
+  -0.958703458f, -0.958266079f, -0.957826436f, -0.957384527f, -0.956940353f,
+  -0.956493914f, -0.95604527f, -0.955594361f, -0.955141187f, -0.954685748f,
+  -0.954228103f, -0.953768194f, -0.953306019f, -0.95284164f, -0.952374995f,
+  -0.951906145f, -0.95143503f, -0.950961649f, -0.950486064f, -0.950008273f,
+  -0.949528158f, -0.949045897f, -0.94856137f, -0.948074579f, -0.947585583f,
+  -0.947094381f, -0.946600914f, -0.946105242f, -0.945607305f, -0.945107222f,
+  -0.944604814f, -0.944100261f, -0.943593442f, -0.943084419f, -0.94257319f,
+  -0.942059755f, -0.941544056f, -0.941026151f, -0.940506041f, -0.939983726f,
+  -0.939459205f, -0.938932478f, -0.938403547f, -0.93787235f, -0.937339008f,
+  -0.93680346f, -0.936265647f, -0.935725689f, -0.935183525f, -0.934639156f,
+  -0.934092522f, -0.933543801f, -0.932992816f, -0.932439625f, -0.931884289f,
+  -0.931326687f, -0.93076694f, -0.930205047f, -0.929640889f, -0.929074585f,
+  -0.928506076f, -0.927935421f, -0.927362502f, -0.926787496f, -0.926210225f,
+  -0.925630808f, -0.925049245f, -0.924465477f, -0.923879504f, -0.923291445f,
+  -0.92270112f, -0.92210865f, -0.921514034f, -0.920917213f, -0.920318305f,
+  -0.919717133f, -0.919113874f, -0.91850841f, -0.917900801f, -0.917290986f,
+  -0.916679084f, -0.916064978f, -0.915448725f, -0.914830327f, -0.914209783f,
+  -0.913587034f, -0.912962198f, -0.912335157f, -0.91170603f, -0.911074758f,
+  -0.910441279f, -0.909805715f, -0.909168005f, -0.90852809f, -0.907886088f,
+  -0.907242f, -0.906595707f, -0.905947268f, -0.905296743f, -0.904644072f,
+  -0.903989315f, -0.903332353f, -0.902673304f, -0.902012169f, -0.901348829f,
+  -0.900683403f, -0.900015891f, -0.899346232f, -0.898674488f, -0.898000598f,
+  -0.897324562f, -0.8966465f, -0.895966232f, -0.895283937f, -0.894599497f,
+  -0.893912971f, -0.893224299f, -0.892533541f, -0.891840696f, -0.891145766f,
+  -0.890448749f, -0.889749587f, -0.889048338f, -0.888345063f, -0.887639642f,
+  -0.886932135f, -0.886222541f, -0.885510862f, -0.884797096f, -0.884081244f,
+  -0.883363366f, -0.882643342f, -0.881921291f, -0.881197095f, -0.880470872f,
+  -0.879742622f, -0.879012227f, -0.878279805f, -0.877545297f, -0.876808703f,
+  -0.876070082f, -0.875329375f, -0.874586642f, -0.873841822f, -0.873094976f,
+  -0.872346044f, -0.871595085f, -0.87084204f, -0.870086968f, -0.86932987f,
+  -0.868570685f, -0.867809474f, -0.867046237f, -0.866280973f, -0.865513623f,
+  -0.864744246f, -0.863972843f, -0.863199413f, -0.862423956f, -0.861646473f,
+  -0.860866964f, -0.860085368f, -0.859301805f, -0.858516216f, -0.857728601f,
+  -0.856938958f, -0.856147349f, -0.855353653f, -0.854557991f, -0.853760302f,
+  -0.852960587f, -0.852158904f, -0.851355195f, -0.850549459f, -0.849741757f,
+  -0.848932028f, -0.848120332f, -0.847306609f, -0.84649092f, -0.845673263f,
+  -0.84485358f, -0.84403187f, -0.843208253f, -0.84238261f, -0.841554999f,
+  -0.840725362f, -0.839893818f, -0.839060247f, -0.838224709f, -0.837387204f,
+  -0.836547732f, -0.835706294f, -0.834862888f, -0.834017515f, -0.833170176f,
+  -0.832320869f, -0.831469595f, -0.830616415f, -0.829761207f, -0.828904092f,
+  -0.82804507f, -0.827184021f, -0.826321065f, -0.825456142f, -0.824589312f,
+  -0.823720515f, -0.82284981f, -0.821977139f, -0.8211025f, -0.820225954f,
+  -0.819347501f, -0.81846714f, -0.817584813f, -0.816700578f, -0.815814435f,
+  -0.814926326f, -0.81403631f, -0.813144386f, -0.812250614f, -0.811354876f,
+  -0.81045717f, -0.809557617f, -0.808656156f, -0.807752848f, -0.806847572f,
+  -0.80594039f, -0.805031359f, -0.804120362f, -0.803207517f, -0.802292824f,
+  -0.801376164f, -0.800457656f, -0.799537241f, -0.798614979f, -0.797690868f,
+  -0.796764791f, -0.795836926f, -0.794907153f, -0.793975472f, -0.793041945f,
+  -0.792106569f, -0.791169345f, -0.790230215f, -0.789289236f, -0.78834641f,
+  -0.787401736f, -0.786455214f, -0.785506845f, -0.784556568f, -0.783604503f,
+  -0.78265059f, -0.781694829f, -0.780737221f, -0.779777765f, -0.778816521f,
+  -0.777853429f, -0.77688849f, -0.775921702f, -0.774953127f, -0.773982704f,
+  -0.773010433f, -0.772036374f, -0.771060526f, -0.770082831f, -0.769103348f,
+  -0.768122017f, -0.767138898f, -0.766153991f, -0.765167236f, -0.764178753f,
+  -0.763188422f, -0.762196302f, -0.761202395f, -0.760206699f, -0.759209216f,
+  -0.758209884f, -0.757208824f, -0.756205976f, -0.755201399f, -0.754194975f,
+  -0.753186822f, -0.752176821f, -0.751165152f, -0.750151634f, -0.749136388f,
+  -0.748119354f, -0.747100592f, -0.746080101f, -0.745057762f, -0.744033754f,
+  -0.743007958f, -0.741980433f, -0.740951121f, -0.73992008f, -0.73888731f,
+  -0.737852812f, -0.736816585f, -0.73577857f, -0.734738886f, -0.733697414f,
+  -0.732654274f, -0.731609404f, -0.730562747f, -0.72951442f, -0.728464365f,
+  -0.727412641f, -0.726359129f, -0.725303948f, -0.724247098f, -0.72318846f,
+  -0.722128212f, -0.721066177f, -0.720002532f, -0.718937099f, -0.717870057f,
+  -0.716801286f, -0.715730846f, -0.714658678f, -0.71358484f, -0.712509394f,
+  -0.711432219f, -0.710353374f, -0.709272802f, -0.70819062f, -0.707106769f,
+  -0.706021249f, -0.704934061f, -0.703845263f, -0.702754736f, -0.7016626f,
+  -0.700568795f, -0.699473321f, -0.698376238f, -0.697277486f, -0.696177125f,
+  -0.695075095f, -0.693971455f, -0.692866147f, -0.691759229f, -0.690650702f,
+  -0.689540565f, -0.68842876f, -0.687315345f, -0.686200321f, -0.685083687f,
+  -0.683965385f, -0.682845533f, -0.681724072f, -0.680601001f, -0.679476321f,
+  -0.678350031f, -0.677222192f, -0.676092684f, -0.674961627f, -0.673829019f,
+  -0.672694743f, -0.671558976f, -0.670421541f, -0.669282615f, -0.668142021f,
+  -0.666999936f, -0.665856242f, -0.664710999f, -0.663564146f, -0.662415802f,
+  -0.66126585f, -0.660114348f, -0.658961296f, -0.657806695f, -0.656650543f,
+  -0.655492842f, -0.654333591f, -0.653172851f, -0.65201056f, -0.65084666f,
+  -0.64968133f, -0.64851439f, -0.64734596f, -0.64617604f, -0.645004511f,
+  -0.643831551f, -0.642657042f, -0.641481042f, -0.640303493f, -0.639124453f,
+  -0.637943923f, -0.636761844f, -0.635578334f, -0.634393275f, -0.633206785f,
+  -0.632018745f, -0.630829215f, -0.629638255f, -0.628445745f, -0.627251804f,
+  -0.626056373f, -0.624859512f, -0.623661101f, -0.622461259f, -0.621259987f,
+  -0.620057225f, -0.618852973f, -0.61764729f, -0.616440177f, -0.615231574f,
+  -0.61402154f, -0.612810075f, -0.61159718f, -0.610382795f, -0.609167039f,
+  -0.607949793f, -0.606731117f, -0.605511069f, -0.604289532f, -0.603066623f,
+  -0.601842225f, -0.600616455f, -0.599389315f, -0.598160684f, -0.596930683f,
+  -0.59569931f, -0.594466507f, -0.593232274f, -0.59199667f, -0.590759695f,
+  -0.589521289f, -0.588281572f, -0.587040365f, -0.585797846f, -0.584553957f,
+  -0.583308637f, -0.582062006f, -0.580813944f, -0.579564571f, -0.578313768f,
+  -0.577061653f, -0.575808167f, -0.57455337f, -0.573297143f, -0.572039604f,
+  -0.570780754f, -0.569520533f, -0.568258941f, -0.566996038f, -0.565731823f,
+  -0.564466238f, -0.563199341f, -0.561931133f, -0.560661554f, -0.559390724f,
+  -0.558118522f, -0.556845009f, -0.555570245f, -0.554294109f, -0.553016722f,
+  -0.551737964f, -0.550457954f, -0.549176633f, -0.547894061f, -0.546610177f,
+  -0.545324981f, -0.544038534f, -0.542750776f, -0.541461766f, -0.540171444f,
+  -0.538879931f, -0.537587047f, -0.53629297f, -0.534997642f, -0.533701003f,
+  -0.532403111f, -0.531104028f, -0.529803634f, -0.528501987f, -0.527199149f,
+  -0.525895f, -0.524589658f, -0.523283124f, -0.521975279f, -0.520666242f,
+  -0.519356012f, -0.518044531f, -0.516731799f, -0.515417874f, -0.514102757f,
+  -0.512786388f, -0.511468828f, -0.510150075f, -0.50883013f, -0.507508993f,
+  -0.506186664f, -0.504863083f, -0.50353837f, -0.502212465f, -0.500885367f,
+  -0.499557108f, -0.498227656f, -0.496897042f, -0.495565265f, -0.494232297f,
+  -0.492898196f, -0.491562903f, -0.490226477f, -0.48888889f, -0.487550169f,
+  -0.486210287f, -0.484869242f, -0.483527064f, -0.482183784f, -0.480839342f,
+  -0.479493767f, -0.47814706f, -0.47679922f, -0.475450277f, -0.474100202f,
+  -0.472749025f, -0.471396744f, -0.470043331f, -0.468688816f, -0.467333198f,
+  -0.465976506f, -0.464618683f, -0.463259786f, -0.461899787f, -0.460538715f,
+  -0.45917654f, -0.457813293f, -0.456448972f, -0.455083579f, -0.453717113f,
+  -0.452349573f, -0.450980991f, -0.449611336f, -0.448240608f, -0.446868837f,
+  -0.445496023f, -0.444122136f, -0.442747235f, -0.441371262f, -0.439994276f,
+  -0.438616246f, -0.437237173f, -0.435857087f, -0.434475958f, -0.433093816f,
+  -0.43171066f, -0.430326492f, -0.42894128f, -0.427555084f, -0.426167876f,
+  -0.424779683f, -0.423390478f, -0.422000259f, -0.420609087f, -0.419216901f,
+  -0.417823702f, -0.416429549f, -0.415034413f, -0.413638324f, -0.41224122f,
+  -0.410843164f, -0.409444153f, -0.408044159f, -0.406643212f, -0.405241311f,
+  -0.403838456f, -0.402434647f, -0.401029885f, -0.399624199f, -0.398217559f,
+  -0.396809995f, -0.395401478f, -0.393992037f, -0.392581671f, -0.391170382f,
+  -0.38975817f, -0.388345033f, -0.386931002f, -0.385516047f, -0.384100199f,
+  -0.382683426f, -0.381265759f, -0.379847199f, -0.378427744f, -0.377007425f,
+  -0.375586182f, -0.374164075f, -0.372741073f, -0.371317208f, -0.369892448f,
+  -0.368466824f, -0.367040336f, -0.365612984f, -0.364184797f, -0.362755716f,
+  -0.3613258f, -0.359895051f, -0.358463407f, -0.357030958f, -0.355597675f,
+  -0.354163527f, -0.352728546f, -0.351292759f, -0.349856138f, -0.348418683f,
+  -0.346980423f, -0.345541328f, -0.344101429f, -0.342660725f, -0.341219217f,
+  -0.339776874f, -0.338333756f, -0.336889863f, -0.335445136f, -0.333999664f,
+  -0.332553357f, -0.331106305f, -0.329658449f, -0.328209847f, -0.326760441f,
+  -0.32531029f, -0.323859364f, -0.322407693f, -0.320955247f, -0.319502026f,
+  -0.31804809f, -0.316593379f, -0.315137923f, -0.313681751f, -0.312224805f,
+  -0.310767144f, -0.309308767f, -0.307849646f, -0.306389809f, -0.304929227f,
+  -0.303467959f, -0.302005947f, -0.300543249f, -0.299079835f, -0.297615707f,
+  -0.296150893f, -0.294685364f, -0.293219149f, -0.291752249f, -0.290284663f,
+  -0.288816422f, -0.287347466f, -0.285877824f, -0.284407526f, -0.282936573f,
+  -0.281464934f, -0.27999264f, -0.27851969f, -0.277046084f, -0.275571823f,
+  -0.274096906f, -0.272621363f, -0.271145165f, -0.269668311f, -0.268190861f,
+  -0.266712755f, -0.265234023f, -0.263754666f, -0.262274712f, -0.260794103f,
+  -0.259312928f, -0.257831097f, -0.25634867f, -0.254865646f, -0.253382027f,
+  -0.251897812f, -0.250413001f, -0.248927608f, -0.24744162f, -0.24595505f,
+  -0.244467899f, -0.242980182f, -0.241491884f, -0.24000302f, -0.238513589f,
+  -0.237023607f, -0.235533059f, -0.234041959f, -0.232550308f, -0.231058106f,
+  -0.229565367f, -0.228072077f, -0.226578265f, -0.225083917f, -0.223589033f,
+  -0.222093627f, -0.220597684f, -0.219101235f, -0.21760428f, -0.216106802f,
+  -0.214608818f, -0.213110313f, -0.211611331f, -0.210111842f, -0.208611846f,
+  -0.207111374f, -0.205610409f, -0.204108968f, -0.202607036f, -0.201104641f,
+  -0.199601755f, -0.198098406f, -0.196594596f, -0.195090324f, -0.19358559f,
+  -0.192080393f, -0.19057475f, -0.18906866f, -0.187562123f, -0.186055154f,
+  -0.184547737f, -0.183039889f, -0.181531608f, -0.180022895f, -0.178513765f,
+  -0.177004218f, -0.175494254f, -0.173983872f, -0.172473088f, -0.170961887f,
+  -0.169450298f, -0.167938292f, -0.166425899f, -0.164913118f, -0.16339995f,
+  -0.161886394f, -0.160372451f, -0.15885815f, -0.157343462f, -0.155828401f,
+  -0.154312968f, -0.152797192f, -0.151281044f, -0.149764538f, -0.148247674f,
+  -0.146730468f, -0.145212919f, -0.143695027f, -0.142176807f, -0.140658244f,
+  -0.139139339f, -0.137620121f, -0.136100575f, -0.134580702f, -0.13306053f,
+  -0.13154003f, -0.130019218f, -0.128498107f, -0.126976699f, -0.125454977f,
+  -0.123932973f, -0.122410677f, -0.120888084f, -0.119365215f, -0.117842063f,
+  -0.116318628f, -0.114794925f, -0.113270953f, -0.111746714f, -0.110222206f,
+  -0.108697444f, -0.107172422f, -0.105647154f, -0.104121633f, -0.102595866f,
+  -0.10106986f, -0.0995436162f, -0.0980171412f, -0.0964904279f, -0.0949634984f,
+  -0.093436338f, -0.0919089541f, -0.0903813615f, -0.0888535529f, -0.0873255357f,
+  -0.0857973099f, -0.0842688903f, -0.0827402622f, -0.0812114477f, -0.0796824396f,
+  -0.0781532452f, -0.0766238645f, -0.0750942975f, -0.0735645667f, -0.0720346496f,
+  -0.070504576f, -0.068974331f, -0.0674439222f, -0.0659133494f, -0.0643826276f,
+  -0.0628517568f, -0.061320737f, -0.0597895719f, -0.0582582653f, -0.0567268208f,
+  -0.0551952459f, -0.0536635369f, -0.052131705f, -0.0505997501f, -0.0490676761f,
+  -0.0475354828f, -0.0460031815f, -0.0444707721f, -0.0429382585f, -0.0414056405f,
+  -0.0398729257f, -0.0383401215f, -0.0368072242f, -0.0352742374f, -0.0337411724f,
+  -0.0322080255f, -0.030674804f, -0.029141508f, -0.027608145f, -0.0260747187f,
+  -0.024541229f, -0.0230076816f, -0.0214740802f, -0.0199404284f, -0.0184067301f,
+  -0.0168729872f, -0.015339206f, -0.0138053885f, -0.0122715384f, -0.0107376594f,
+  -0.00920375437f, -0.00766982883f, -0.00613588467f, -0.00460192608f, -0.00306795677f,
+  -0.00153398013f, 0.f, 0.00153398013f, 0.00306795677f, 0.00460192608f,
+  0.00613588467f, 0.00766982883f, 0.00920375437f, 0.0107376594f, 0.0122715384f,
+  0.0138053885f, 0.015339206f, 0.0168729872f, 0.0184067301f, 0.0199404284f,
+  0.0214740802f, 0.0230076816f, 0.024541229f, 0.0260747187f, 0.027608145f,
+  0.029141508f, 0.030674804f, 0.0322080255f, 0.0337411724f, 0.0352742374f,
+  0.0368072242f, 0.0383401215f, 0.0398729257f, 0.0414056405f, 0.0429382585f,
+  0.0444707721f, 0.0460031815f, 0.0475354828f, 0.0490676761f, 0.0505997501f,
+  0.052131705f, 0.0536635369f, 0.0551952459f, 0.0567268208f, 0.0582582653f,
+  0.0597895719f, 0.061320737f, 0.0628517568f, 0.0643826276f, 0.0659133494f,
+  0.0674439222f, 0.068974331f, 0.070504576f, 0.0720346496f, 0.0735645667f,
+  0.0750942975f, 0.0766238645f, 0.0781532452f, 0.0796824396f, 0.0812114477f,
+  0.0827402622f, 0.0842688903f, 0.0857973099f, 0.0873255357f, 0.0888535529f,
+  0.0903813615f, 0.0919089541f, 0.093436338f, 0.0949634984f, 0.0964904279f,
+  0.0980171412f, 0.0995436162f, 0.10106986f, 0.102595866f, 0.104121633f,
+  0.105647154f, 0.107172422f, 0.108697444f, 0.110222206f, 0.111746714f,
+  0.113270953f, 0.114794925f, 0.116318628f, 0.117842063f, 0.119365215f,
+  0.120888084f, 0.122410677f, 0.123932973f, 0.125454977f, 0.126976699f,
+  0.128498107f, 0.130019218f, 0.13154003f, 0.13306053f, 0.134580702f,
+  0.136100575f, 0.137620121f, 0.139139339f, 0.140658244f, 0.142176807f,
+  0.143695027f, 0.145212919f, 0.146730468f, 0.148247674f, 0.149764538f,
+  0.151281044f, 0.152797192f, 0.154312968f, 0.155828401f, 0.157343462f,
+  0.15885815f, 0.160372451f, 0.161886394f, 0.16339995f, 0.164913118f,
+  0.166425899f, 0.167938292f, 0.169450298f, 0.170961887f, 0.172473088f,
+  0.173983872f, 0.175494254f, 0.177004218f, 0.178513765f, 0.180022895f,
+  0.181531608f, 0.183039889f, 0.184547737f, 0.186055154f, 0.187562123f,
+  0.18906866f, 0.19057475f, 0.192080393f, 0.19358559f, 0.195090324f,
+  0.196594596f, 0.198098406f, 0.199601755f, 0.201104641f, 0.202607036f,
+  0.204108968f, 0.205610409f, 0.207111374f, 0.208611846f, 0.210111842f,
+  0.211611331f, 0.213110313f, 0.214608818f, 0.216106802f, 0.21760428f,
+  0.219101235f, 0.220597684f, 0.222093627f, 0.223589033f, 0.225083917f,
+  0.226578265f, 0.228072077f, 0.229565367f, 0.231058106f, 0.232550308f,
+  0.234041959f, 0.235533059f, 0.237023607f, 0.238513589f, 0.24000302f,
+  0.241491884f, 0.242980182f, 0.244467899f, 0.24595505f, 0.24744162f,
+  0.248927608f, 0.250413001f, 0.251897812f, 0.253382027f, 0.254865646f,
+  0.25634867f, 0.257831097f, 0.259312928f, 0.260794103f, 0.262274712f,
+  0.263754666f, 0.265234023f, 0.266712755f, 0.268190861f, 0.269668311f,
+  0.271145165f, 0.272621363f, 0.274096906f, 0.275571823f, 0.277046084f,
+  0.27851969f, 0.27999264f, 0.281464934f, 0.282936573f, 0.284407526f,
+  0.285877824f, 0.287347466f, 0.288816422f, 0.290284663f, 0.291752249f,
+  0.293219149f, 0.294685364f, 0.296150893f, 0.297615707f, 0.299079835f,
+  0.300543249f, 0.302005947f, 0.303467959f, 0.304929227f, 0.306389809f,
+  0.307849646f, 0.309308767f, 0.310767144f, 0.312224805f, 0.313681751f,
+  0.315137923f, 0.316593379f, 0.31804809f, 0.319502026f, 0.320955247f,
+  0.322407693f, 0.323859364f, 0.32531029f, 0.326760441f, 0.328209847f,
+  0.329658449f, 0.331106305f, 0.332553357f, 0.333999664f, 0.335445136f,
+  0.336889863f, 0.338333756f, 0.339776874f, 0.341219217f, 0.342660725f,
+  0.344101429f, 0.345541328f, 0.346980423f, 0.348418683f, 0.349856138f,
+  0.351292759f, 0.352728546f, 0.354163527f, 0.355597675f, 0.357030958f,
+  0.358463407f, 0.359895051f, 0.3613258f, 0.362755716f, 0.364184797f,
+  0.365612984f, 0.367040336f, 0.368466824f, 0.369892448f, 0.371317208f,
+  0.372741073f, 0.374164075f, 0.375586182f, 0.377007425f, 0.378427744f,
+  0.379847199f, 0.381265759f, 0.382683426f, 0.384100199f, 0.385516047f,
+  0.386931002f, 0.388345033f, 0.38975817f, 0.391170382f, 0.392581671f,
+  0.393992037f, 0.395401478f, 0.396809995f, 0.398217559f, 0.399624199f,
+  0.401029885f, 0.402434647f, 0.403838456f, 0.405241311f, 0.406643212f,
+  0.408044159f, 0.409444153f, 0.410843164f, 0.41224122f, 0.413638324f,
+  0.415034413f, 0.416429549f, 0.417823702f, 0.419216901f, 0.420609087f,
+  0.422000259f, 0.423390478f, 0.424779683f, 0.426167876f, 0.427555084f,
+  0.42894128f, 0.430326492f, 0.43171066f, 0.433093816f, 0.434475958f,
+  0.435857087f, 0.437237173f, 0.438616246f, 0.439994276f, 0.441371262f,
+  0.442747235f, 0.444122136f, 0.445496023f, 0.446868837f, 0.448240608f,
+  0.449611336f, 0.450980991f, 0.452349573f, 0.453717113f, 0.455083579f,
+  0.456448972f, 0.457813293f, 0.45917654f, 0.460538715f, 0.461899787f,
+  0.463259786f, 0.464618683f, 0.465976506f, 0.467333198f, 0.468688816f,
+  0.470043331f, 0.471396744f, 0.472749025f, 0.474100202f, 0.475450277f,
+  0.47679922f, 0.47814706f, 0.479493767f, 0.480839342f, 0.482183784f,
+  0.483527064f, 0.484869242f, 0.486210287f, 0.487550169f, 0.48888889f,
+  0.490226477f, 0.491562903f, 0.492898196f, 0.494232297f, 0.495565265f,
+  0.496897042f, 0.498227656f, 0.499557108f, 0.500885367f, 0.502212465f,
+  0.50353837f, 0.504863083f, 0.506186664f, 0.507508993f, 0.50883013f,
+  0.510150075f, 0.511468828f, 0.512786388f, 0.514102757f, 0.515417874f,
+  0.516731799f, 0.518044531f, 0.519356012f, 0.520666242f, 0.521975279f,
+  0.523283124f, 0.524589658f, 0.525895f, 0.527199149f, 0.528501987f,
+  0.529803634f, 0.531104028f, 0.532403111f, 0.533701003f, 0.534997642f,
+  0.53629297f, 0.537587047f, 0.538879931f, 0.540171444f, 0.541461766f,
+  0.542750776f, 0.544038534f, 0.545324981f, 0.546610177f, 0.547894061f,
+  0.549176633f, 0.550457954f, 0.551737964f, 0.553016722f, 0.554294109f,
+  0.555570245f, 0.556845009f, 0.558118522f, 0.559390724f, 0.560661554f,
+  0.561931133f, 0.563199341f, 0.564466238f, 0.565731823f, 0.566996038f,
+  0.568258941f, 0.569520533f, 0.570780754f, 0.572039604f, 0.573297143f,
+  0.57455337f, 0.575808167f, 0.577061653f, 0.578313768f, 0.579564571f,
+  0.580813944f, 0.582062006f, 0.583308637f, 0.584553957f, 0.585797846f,
+  0.587040365f, 0.588281572f, 0.589521289f, 0.590759695f, 0.59199667f,
+  0.593232274f, 0.594466507f, 0.59569931f, 0.596930683f, 0.598160684f,
+  0.599389315f, 0.600616455f, 0.601842225f, 0.603066623f, 0.604289532f,
+  0.605511069f, 0.606731117f, 0.607949793f, 0.609167039f, 0.610382795f,
+  0.61159718f, 0.612810075f, 0.61402154f, 0.615231574f, 0.616440177f,
+  0.61764729f, 0.618852973f, 0.620057225f, 0.621259987f, 0.622461259f,
+  0.623661101f, 0.624859512f, 0.626056373f, 0.627251804f, 0.628445745f,
+  0.629638255f, 0.630829215f, 0.632018745f, 0.633206785f, 0.634393275f,
+  0.635578334f, 0.636761844f, 0.637943923f, 0.639124453f, 0.640303493f,
+  0.641481042f, 0.642657042f, 0.643831551f, 0.645004511f, 0.64617604f,
+  0.64734596f, 0.64851439f, 0.64968133f, 0.65084666f, 0.65201056f,
+  0.653172851f, 0.654333591f, 0.655492842f, 0.656650543f, 0.657806695f,
+  0.658961296f, 0.660114348f, 0.66126585f, 0.662415802f, 0.663564146f,
+  0.664710999f, 0.665856242f, 0.666999936f, 0.668142021f, 0.669282615f,
+  0.670421541f, 0.671558976f, 0.672694743f, 0.673829019f, 0.674961627f,
+  0.676092684f, 0.677222192f, 0.678350031f, 0.679476321f, 0.680601001f,
+  0.681724072f, 0.682845533f, 0.683965385f, 0.685083687f, 0.686200321f,
+  0.687315345f, 0.68842876f, 0.689540565f, 0.690650702f, 0.691759229f,
+  0.692866147f, 0.693971455f, 0.695075095f, 0.696177125f, 0.697277486f,
+  0.698376238f, 0.699473321f, 0.700568795f, 0.7016626f, 0.702754736f,
+  0.703845263f, 0.704934061f, 0.706021249f, 0.707106769f, 0.70819062f,
+  0.709272802f, 0.710353374f, 0.711432219f, 0.712509394f, 0.71358484f,
+  0.714658678f, 0.715730846f, 0.716801286f, 0.717870057f, 0.718937099f,
+  0.720002532f, 0.721066177f, 0.722128212f, 0.72318846f, 0.724247098f,
+  0.725303948f, 0.726359129f, 0.727412641f, 0.728464365f, 0.72951442f,
+  0.730562747f, 0.731609404f, 0.732654274f, 0.733697414f, 0.734738886f,
+  0.73577857f, 0.736816585f, 0.737852812f, 0.73888731f, 0.73992008f,
+  0.740951121f, 0.741980433f, 0.743007958f, 0.744033754f, 0.745057762f,
+  0.746080101f, 0.747100592f, 0.748119354f, 0.749136388f, 0.750151634f,
+  0.751165152f, 0.752176821f, 0.753186822f, 0.754194975f, 0.755201399f,
+  0.756205976f, 0.757208824f, 0.758209884f, 0.759209216f, 0.760206699f,
+  0.761202395f, 0.762196302f, 0.763188422f, 0.764178753f, 0.765167236f,
+  0.766153991f, 0.767138898f, 0.768122017f, 0.769103348f, 0.770082831f,
+  0.771060526f, 0.772036374f, 0.773010433f, 0.773982704f, 0.774953127f,
+  0.775921702f, 0.77688849f, 0.777853429f, 0.778816521f, 0.779777765f,
+  0.780737221f, 0.781694829f, 0.78265059f, 0.783604503f, 0.784556568f,
+  0.785506845f, 0.786455214f, 0.787401736f, 0.78834641f, 0.789289236f,
+  0.790230215f, 0.791169345f, 0.792106569f, 0.793041945f, 0.793975472f,
+  0.794907153f, 0.795836926f, 0.796764791f, 0.797690868f, 0.798614979f,
+  0.799537241f, 0.800457656f, 0.801376164f, 0.802292824f, 0.803207517f,
+  0.804120362f, 0.805031359f, 0.80594039f, 0.806847572f, 0.807752848f,
+  0.808656156f, 0.809557617f, 0.81045717f, 0.811354876f, 0.812250614f,
+  0.813144386f, 0.81403631f, 0.814926326f, 0.815814435f, 0.816700578f,
+  0.817584813f, 0.81846714f, 0.819347501f, 0.820225954f, 0.8211025f,
+  0.821977139f, 0.82284981f, 0.823720515f, 0.824589312f, 0.825456142f,
+  0.826321065f, 0.827184021f, 0.82804507f, 0.828904092f, 0.829761207f,
+  0.830616415f, 0.831469595f, 0.832320869f, 0.833170176f, 0.834017515f,
+  0.834862888f, 0.835706294f, 0.836547732f, 0.837387204f, 0.838224709f,
+  0.839060247f, 0.839893818f, 0.840725362f, 0.841554999f, 0.84238261f,
+  0.843208253f, 0.84403187f, 0.84485358f, 0.845673263f, 0.84649092f,
+  0.847306609f, 0.848120332f, 0.848932028f, 0.849741757f, 0.850549459f,
+  0.851355195f, 0.852158904f, 0.852960587f, 0.853760302f, 0.854557991f,
+  0.855353653f, 0.856147349f, 0.856938958f, 0.857728601f, 0.858516216f,
+  0.859301805f, 0.860085368f, 0.860866964f, 0.861646473f, 0.862423956f,
+  0.863199413f, 0.863972843f, 0.864744246f, 0.865513623f, 0.866280973f,
+  0.867046237f, 0.867809474f, 0.868570685f, 0.86932987f, 0.870086968f,
+  0.87084204f, 0.871595085f, 0.872346044f, 0.873094976f, 0.873841822f,
+  0.874586642f, 0.875329375f, 0.876070082f, 0.876808703f, 0.877545297f,
+  0.878279805f, 0.879012227f, 0.879742622f, 0.880470872f, 0.881197095f,
+  0.881921291f, 0.882643342f, 0.883363366f, 0.884081244f, 0.884797096f,
+  0.885510862f, 0.886222541f, 0.886932135f, 0.887639642f, 0.888345063f,
+  0.889048338f, 0.889749587f, 0.890448749f, 0.891145766f, 0.891840696f,
+  0.892533541f, 0.893224299f, 0.893912971f, 0.894599497f, 0.895283937f,
+  0.895966232f, 0.8966465f, 0.897324562f, 0.898000598f, 0.898674488f,
+  0.899346232f, 0.900015891f, 0.900683403f, 0.901348829f, 0.902012169f,
+  0.902673304f, 0.903332353f, 0.903989315f, 0.904644072f, 0.905296743f,
+  0.905947268f, 0.906595707f, 0.907242f, 0.907886088f, 0.90852809f,
+  0.909168005f, 0.909805715f, 0.910441279f, 0.911074758f, 0.91170603f,
+  0.912335157f, 0.912962198f, 0.913587034f, 0.914209783f, 0.914830327f,
+  0.915448725f, 0.916064978f, 0.916679084f, 0.917290986f, 0.917900801f,
+  0.91850841f, 0.919113874f, 0.919717133f, 0.920318305f, 0.920917213f,
+  0.921514034f, 0.92210865f, 0.92270112f, 0.923291445f, 0.923879504f,
+  0.924465477f, 0.925049245f, 0.925630808f, 0.926210225f, 0.926787496f,
+  0.927362502f, 0.927935421f, 0.928506076f, 0.929074585f, 0.929640889f,
+  0.930205047f, 0.93076694f, 0.931326687f, 0.931884289f, 0.932439625f,
+  0.932992816f, 0.933543801f, 0.934092522f, 0.934639156f, 0.935183525f,
+  0.935725689f, 0.936265647f, 0.93680346f, 0.937339008f, 0.93787235f,
+  0.938403547f, 0.938932478f, 0.939459205f, 0.939983726f, 0.940506041f,
+  0.941026151f, 0.941544056f, 0.942059755f, 0.94257319f, 0.943084419f,
+  0.943593442f, 0.944100261f, 0.944604814f, 0.945107222f, 0.945607305f,
+  0.946105242f, 0.946600914f, 0.947094381f, 0.947585583f, 0.948074579f,
+  0.94856137f, 0.949045897f, 0.949528158f, 0.950008273f, 0.950486064f,
+  0.950961649f, 0.95143503f, 0.951906145f, 0.952374995f, 0.95284164f,
+  0.953306019f, 0.953768194f, 0.954228103f, 0.954685748f, 0.955141187f,
+  0.955594361f, 0.95604527f, 0.956493914f, 0.956940353f, 0.957384527f,
+  0.957826436f, 0.958266079f, 0.958703458f, 0.959138632f, 0.95957154f,
+  0.960002124f, 0.960430503f, 0.960856616f, 0.961280465f, 0.961702049f,
+  0.962121427f, 0.962538481f, 0.962953269f, 0.963365793f, 0.963776052f,
+  0.964184046f, 0.964589775f, 0.964993238f, 0.965394437f, 0.965793371f,
+  0.966189981f, 0.966584384f, 0.966976464f, 0.967366278f, 0.967753828f,
+  0.968139112f, 0.968522072f, 0.968902826f, 0.969281256f, 0.969657362f,
+  0.970031261f, 0.970402837f, 0.970772147f, 0.971139133f, 0.971503913f,
+  0.97186631f, 0.972226501f, 0.972584367f, 0.972939968f, 0.973293245f,
+  0.973644257f, 0.973992944f, 0.974339366f, 0.974683523f, 0.975025356f,
+  0.975364864f, 0.975702107f, 0.976037085f, 0.976369739f, 0.976700068f,
+  0.977028131f, 0.977353871f, 0.977677345f, 0.977998495f, 0.97831738f,
+  0.97863394f, 0.978948176f, 0.979260147f, 0.979569793f, 0.979877114f,
+  0.980182111f, 0.980484843f, 0.980785251f, 0.981083393f, 0.981379211f,
+  0.981672704f, 0.981963873f, 0.982252717f, 0.982539296f, 0.982823551f,
+  0.983105481f, 0.983385086f, 0.983662426f, 0.983937442f, 0.984210074f,
+  0.984480441f, 0.984748483f, 0.98501426f, 0.985277653f, 0.985538721f,
+  0.985797524f, 0.986053944f, 0.986308098f, 0.986559927f, 0.986809373f,
+  0.987056553f, 0.987301409f, 0.987543941f, 0.987784147f, 0.988022029f,
+  0.988257587f, 0.98849082f, 0.988721669f, 0.988950253f, 0.989176512f,
+  0.989400446f, 0.989621997f, 0.989841282f, 0.990058184f, 0.99027282f,
+  0.990485072f, 0.990695f, 0.990902662f, 0.991107941f, 0.991310835f,
+  0.991511464f, 0.991709769f, 0.991905689f, 0.992099285f, 0.992290616f,
+  0.992479563f, 0.992666125f, 0.992850423f, 0.993032336f, 0.993211925f,
+  0.993389189f, 0.993564129f, 0.993736744f, 0.993906975f, 0.994074881f,
+  0.994240463f, 0.99440366f, 0.994564593f, 0.994723141f, 0.994879305f,
+  0.995033205f, 0.99518472f, 0.99533391f, 0.995480776f, 0.995625257f,
+  0.995767415f, 0.995907247f, 0.996044695f, 0.996179819f, 0.996312618f,
+  0.996443033f, 0.996571124f, 0.996696889f, 0.996820271f, 0.996941328f,
+  0.997060061f, 0.997176409f, 0.997290432f, 0.997402132f, 0.997511446f,
+  0.997618437f, 0.997723043f, 0.997825325f, 0.997925282f, 0.998022854f,
+  0.998118103f, 0.998211026f, 0.998301566f, 0.998389721f, 0.998475552f,
+  0.998559058f, 0.998640239f, 0.998719037f, 0.99879545f, 0.998869538f,
+  0.998941302f, 0.999010682f, 0.999077737f, 0.999142408f, 0.999204755f,
+  0.999264777f, 0.999322355f, 0.999377668f, 0.999430597f, 0.999481201f,
+  0.999529421f, 0.999575317f, 0.999618828f, 0.999660015f, 0.999698818f,
+  0.999735296f, 0.99976939f, 0.999801159f, 0.999830604f, 0.999857664f,
+  0.99988234f, 0.999904692f, 0.999924719f, 0.999942362f, 0.999957621f,
+  0.999970615f, 0.999981165f, 0.99998939f, 0.999995291f, 0.999998808f,
+  1.f
+};
+
+static const float fft_static_sin_8192[10241] =
+{
+  0.f, 0.000766990299f, 0.00153398013f, 0.00230096909f, 0.00306795677f,
+  0.00383494259f, 0.00460192608f, 0.005368907f, 0.00613588467f, 0.00690285861f,
+  0.00766982883f, 0.00843679439f, 0.00920375437f, 0.00997070968f, 0.0107376594f,
+  0.0115046017f, 0.0122715384f, 0.0130384676f, 0.0138053885f, 0.0145723019f,
+  0.015339206f, 0.0161061026f, 0.0168729872f, 0.0176398642f, 0.0184067301f,
+  0.0191735849f, 0.0199404284f, 0.0207072608f, 0.0214740802f, 0.0222408883f,
+  0.0230076816f, 0.0237744618f, 0.024541229f, 0.0253079813f, 0.0260747187f,
+  0.0268414393f, 0.027608145f, 0.0283748358f, 0.029141508f, 0.0299081653f,
+  0.030674804f, 0.031441424f, 0.0322080255f, 0.0329746082f, 0.0337411724f,
+  0.0345077142f, 0.0352742374f, 0.036040742f, 0.0368072242f, 0.037573684f,
+  0.0383401215f, 0.0391065367f, 0.0398729257f, 0.0406392962f, 0.0414056405f,
+  0.0421719626f, 0.0429382585f, 0.0437045284f, 0.0444707721f, 0.0452369899f,
+  0.0460031815f, 0.046769347f, 0.0475354828f, 0.0483015925f, 0.0490676761f,
+  0.0498337261f, 0.0505997501f, 0.0513657406f, 0.052131705f, 0.0528976358f,
+  0.0536635369f, 0.0544294082f, 0.0551952459f, 0.0559610501f, 0.0567268208f,
+  0.0574925579f, 0.0582582653f, 0.0590239353f, 0.0597895719f, 0.0605551712f,
+  0.061320737f, 0.0620862655f, 0.0628517568f, 0.0636172146f, 0.0643826276f,
+  0.0651480108f, 0.0659133494f, 0.0666786581f, 0.0674439222f, 0.0682091415f,
+  0.068974331f, 0.0697394684f, 0.070504576f, 0.0712696314f, 0.0720346496f,
+  0.0727996305f, 0.0735645667f, 0.0743294507f, 0.0750942975f, 0.0758591071f,
+  0.0766238645f, 0.0773885772f, 0.0781532452f, 0.078917861f, 0.0796824396f,
+  0.080446966f, 0.0812114477f, 0.0819758773f, 0.0827402622f, 0.0835046023f,
+  0.0842688903f, 0.0850331262f, 0.0857973099f, 0.0865614489f, 0.0873255357f,
+  0.0880895704f, 0.0888535529f, 0.0896174833f, 0.0903813615f, 0.0911451876f,
+  0.0919089541f, 0.0926726758f, 0.093436338f, 0.0941999406f, 0.0949634984f,
+  0.0957269892f, 0.0964904279f, 0.0972538143f, 0.0980171412f, 0.0987804085f,
+  0.0995436162f, 0.100306772f, 0.10106986f, 0.101832896f, 0.102595866f,
+  0.103358783f, 0.104121633f, 0.104884423f, 0.105647154f, 0.106409818f,
+  0.107172422f, 0.107934967f, 0.108697444f, 0.109459855f, 0.110222206f,
+  0.110984489f, 0.111746714f, 0.112508863f, 0.113270953f, 0.114032976f,
+  0.114794925f, 0.115556814f, 0.116318628f, 0.117080383f, 0.117842063f,
+  0.118603677f, 0.119365215f, 0.120126687f, 0.120888084f, 0.121649414f,
+  0.122410677f, 0.123171858f, 0.123932973f, 0.12469402f, 0.125454977f,
+  0.126215875f, 0.126976699f, 0.127737448f, 0.128498107f, 0.129258707f,
+  0.130019218f, 0.130779669f, 0.13154003f, 0.132300317f, 0.13306053f,
+  0.133820653f, 0.134580702f, 0.135340676f, 0.136100575f, 0.136860386f,
+  0.137620121f, 0.138379768f, 0.139139339f, 0.139898837f, 0.140658244f,
+  0.141417563f, 0.142176807f, 0.142935961f, 0.143695027f, 0.144454017f,
+  0.145212919f, 0.145971745f, 0.146730468f, 0.147489116f, 0.148247674f,
+  0.149006143f, 0.149764538f, 0.150522828f, 0.151281044f, 0.152039155f,
+  0.152797192f, 0.153555125f, 0.154312968f, 0.155070737f, 0.155828401f,
+  0.156585976f, 0.157343462f, 0.158100843f, 0.15885815f, 0.159615353f,
+  0.160372451f, 0.161129475f, 0.161886394f, 0.162643224f, 0.16339995f,
+  0.164156586f, 0.164913118f, 0.16566956f, 0.166425899f, 0.167182148f,
+  0.167938292f, 0.168694347f, 0.169450298f, 0.170206144f, 0.170961887f,
+  0.171717539f, 0.172473088f, 0.173228532f, 0.173983872f, 0.174739107f,
+  0.175494254f, 0.176249295f, 0.177004218f, 0.177759051f, 0.178513765f,
+  0.17926839f, 0.180022895f, 0.180777311f, 0.181531608f, 0.182285801f,
+  0.183039889f, 0.183793873f, 0.184547737f, 0.185301498f, 0.186055154f,
+  0.18680869f, 0.187562123f, 0.188315451f, 0.18906866f, 0.189821765f,
+  0.19057475f, 0.191327631f, 0.192080393f, 0.192833051f, 0.19358559f,
+  0.194338009f, 0.195090324f, 0.195842519f, 0.196594596f, 0.197346568f,
+  0.198098406f, 0.19885014f, 0.199601755f, 0.20035325f, 0.201104641f,
+  0.201855898f, 0.202607036f, 0.203358069f, 0.204108968f, 0.204859748f,
+  0.205610409f, 0.206360951f, 0.207111374f, 0.207861677f, 0.208611846f,
+  0.209361911f, 0.210111842f, 0.210861638f, 0.211611331f, 0.212360889f,
+  0.213110313f, 0.213859633f, 0.214608818f, 0.21535787f, 0.216106802f,
+  0.2168556f, 0.21760428f, 0.218352824f, 0.219101235f, 0.219849527f,
+  0.220597684f, 0.221345723f, 0.222093627f, 0.222841397f, 0.223589033f,
+  0.224336535f, 0.225083917f, 0.225831151f, 0.226578265f, 0.227325246f,
+  0.228072077f, 0.228818789f, 0.229565367f, 0.230311811f, 0.231058106f,
+  0.231804281f, 0.232550308f, 0.233296201f, 0.234041959f, 0.234787583f,
+  0.235533059f, 0.2362784f, 0.237023607f, 0.237768665f, 0.238513589f,
+  0.239258379f, 0.24000302f, 0.240747526f, 0.241491884f, 0.242236108f,
+  0.242980182f, 0.243724108f, 0.244467899f, 0.245211542f, 0.24595505f,
+  0.246698409f, 0.24744162f, 0.248184681f, 0.248927608f, 0.249670386f,
+  0.250413001f, 0.251155496f, 0.251897812f, 0.252640009f, 0.253382027f,
+  0.254123926f, 0.254865646f, 0.255607247f, 0.25634867f, 0.257089972f,
+  0.257831097f, 0.258572072f, 0.259312928f, 0.260053605f, 0.260794103f,
+  0.261534482f, 0.262274712f, 0.263014764f, 0.263754666f, 0.264494419f,
+  0.265234023f, 0.265973479f, 0.266712755f, 0.267451882f, 0.268190861f,
+  0.26892966f, 0.269668311f, 0.270406812f, 0.271145165f, 0.271883339f,
+  0.272621363f, 0.273359209f, 0.274096906f, 0.274834454f, 0.275571823f,
+  0.276309043f, 0.277046084f, 0.277782977f, 0.27851969f, 0.279256254f,
+  0.27999264f, 0.280728877f, 0.281464934f, 0.282200843f, 0.282936573f,
+  0.283672124f, 0.284407526f, 0.285142779f, 0.285877824f, 0.286612719f,
+  0.287347466f, 0.288082033f, 0.288816422f, 0.289550632f, 0.290284663f,
+  0.291018546f, 0.291752249f, 0.292485803f, 0.293219149f, 0.293952346f,
+  0.294685364f, 0.295418203f, 0.296150893f, 0.296883374f, 0.297615707f,
+  0.298347861f, 0.299079835f, 0.299811631f, 0.300543249f, 0.301274687f,
+  0.302005947f, 0.302737027f, 0.303467959f, 0.304198682f, 0.304929227f,
+  0.305659592f, 0.306389809f, 0.307119817f, 0.307849646f, 0.308579296f,
+  0.309308767f, 0.31003806f, 0.310767144f, 0.311496079f, 0.312224805f,
+  0.312953383f, 0.313681751f, 0.314409941f, 0.315137923f, 0.315865755f,
+  0.316593379f, 0.317320824f, 0.31804809f, 0.318775147f, 0.319502026f,
+  0.320228726f, 0.320955247f, 0.321681559f, 0.322407693f, 0.323133618f,
+  0.323859364f, 0.324584931f, 0.32531029f, 0.32603547f, 0.326760441f,
+  0.327485234f, 0.328209847f, 0.328934252f, 0.329658449f, 0.330382496f,
+  0.331106305f, 0.331829935f, 0.332553357f, 0.3332766f, 0.333999664f,
+  0.334722489f, 0.335445136f, 0.336167604f, 0.336889863f, 0.337611914f,
+  0.338333756f, 0.339055419f, 0.339776874f, 0.340498149f, 0.341219217f,
+  0.341940075f, 0.342660725f, 0.343381166f, 0.344101429f, 0.344821483f,
+  0.345541328f, 0.346260965f, 0.346980423f, 0.347699642f, 0.348418683f,
+  0.349137515f, 0.349856138f, 0.350574553f, 0.351292759f, 0.352010757f,
+  0.352728546f, 0.353446156f, 0.354163527f, 0.354880691f, 0.355597675f,
+  0.356314421f, 0.357030958f, 0.357747287f, 0.358463407f, 0.359179348f,
+  0.359895051f, 0.360610515f, 0.3613258f, 0.362040877f, 0.362755716f,
+  0.363470376f, 0.364184797f, 0.364899009f, 0.365612984f, 0.366326779f,
+  0.367040336f, 0.367753685f, 0.368466824f, 0.369179755f, 0.369892448f,
+  0.370604932f, 0.371317208f, 0.372029245f, 0.372741073f, 0.373452663f,
+  0.374164075f, 0.374875218f, 0.375586182f, 0.376296908f, 0.377007425f,
+  0.377717704f, 0.378427744f, 0.379137605f, 0.379847199f, 0.380556613f,
+  0.381265759f, 0.381974727f, 0.382683426f, 0.383391917f, 0.384100199f,
+  0.384808242f, 0.385516047f, 0.386223644f, 0.386931002f, 0.387638152f,
+  0.388345033f, 0.389051735f, 0.38975817f, 0.390464395f, 0.391170382f,
+  0.391876131f, 0.392581671f, 0.393286973f, 0.393992037f, 0.394696862f,
+  0.395401478f, 0.396105856f, 0.396809995f, 0.397513896f, 0.398217559f,
+  0.398921013f, 0.399624199f, 0.400327176f, 0.401029885f, 0.401732385f,
+  0.402434647f, 0.403136671f, 0.403838456f, 0.404540002f, 0.405241311f,
+  0.40594238f, 0.406643212f, 0.407343805f, 0.408044159f, 0.408744276f,
+  0.409444153f, 0.410143793f, 0.410843164f, 0.411542326f, 0.41224122f,
+  0.412939876f, 0.413638324f, 0.414336503f, 0.415034413f, 0.415732116f,
+  0.416429549f, 0.417126775f, 0.417823702f, 0.418520421f, 0.419216901f,
+  0.419913113f, 0.420609087f, 0.421304792f, 0.422000259f, 0.422695488f,
+  0.423390478f, 0.4240852f, 0.424779683f, 0.425473899f, 0.426167876f,
+  0.426861614f, 0.427555084f, 0.428248316f, 0.42894128f, 0.429634005f,
+  0.430326492f, 0.43101871f, 0.43171066f, 0.432402372f, 0.433093816f,
+  0.433785021f, 0.434475958f, 0.435166657f, 0.435857087f, 0.43654725f,
+  0.437237173f, 0.437926829f, 0.438616246f, 0.439305395f, 0.439994276f,
+  0.440682888f, 0.441371262f, 0.442059368f, 0.442747235f, 0.443434805f,
+  0.444122136f, 0.444809198f, 0.445496023f, 0.446182549f, 0.446868837f,
+  0.447554857f, 0.448240608f, 0.448926091f, 0.449611336f, 0.450296283f,
+  0.450980991f, 0.451665431f, 0.452349573f, 0.453033477f, 0.453717113f,
+  0.45440048f, 0.455083579f, 0.45576641f, 0.456448972f, 0.457131267f,
+  0.457813293f, 0.458495051f, 0.45917654f, 0.459857762f, 0.460538715f,
+  0.4612194f, 0.461899787f, 0.462579936f, 0.463259786f, 0.463939369f,
+  0.464618683f, 0.465297729f, 0.465976506f, 0.466654986f, 0.467333198f,
+  0.468011141f, 0.468688816f, 0.469366223f, 0.470043331f, 0.470720172f,
+  0.471396744f, 0.472073019f, 0.472749025f, 0.473424762f, 0.474100202f,
+  0.474775374f, 0.475450277f, 0.476124883f, 0.47679922f, 0.477473289f,
+  0.47814706f, 0.478820562f, 0.479493767f, 0.480166674f, 0.480839342f,
+  0.481511682f, 0.482183784f, 0.482855558f, 0.483527064f, 0.484198302f,
+  0.484869242f, 0.485539913f, 0.486210287f, 0.486880362f, 0.487550169f,
+  0.488219678f, 0.48888889f, 0.489557832f, 0.490226477f, 0.490894854f,
+  0.491562903f, 0.492230713f, 0.492898196f, 0.49356541f, 0.494232297f,
+  0.494898945f, 0.495565265f, 0.496231288f, 0.496897042f, 0.497562498f,
+  0.498227656f, 0.498892546f, 0.499557108f, 0.500221372f, 0.500885367f,
+  0.501549065f, 0.502212465f, 0.502875566f, 0.50353837f, 0.504200876f,
+  0.504863083f, 0.505525053f, 0.506186664f, 0.506847978f, 0.507508993f,
+  0.508169711f, 0.50883013f, 0.509490252f, 0.510150075f, 0.5108096f,
+  0.511468828f, 0.512127757f, 0.512786388f, 0.513444722f, 0.514102757f,
+  0.514760435f, 0.515417874f, 0.516075015f, 0.516731799f, 0.517388284f,
+  0.518044531f, 0.518700421f, 0.519356012f, 0.520011246f, 0.520666242f,
+  0.521320939f, 0.521975279f, 0.52262938f, 0.523283124f, 0.52393657f,
+  0.524589658f, 0.525242507f, 0.525895f, 0.526547253f, 0.527199149f,
+  0.527850747f, 0.528501987f, 0.529152989f, 0.529803634f, 0.53045398f,
+  0.531104028f, 0.531753719f, 0.532403111f, 0.533052206f, 0.533701003f,
+  0.534349442f, 0.534997642f, 0.535645485f, 0.53629297f, 0.536940157f,
+  0.537587047f, 0.538233638f, 0.538879931f, 0.539525867f, 0.540171444f,
+  0.540816784f, 0.541461766f, 0.54210645f, 0.542750776f, 0.543394804f,
+  0.544038534f, 0.544681907f, 0.545324981f, 0.545967758f, 0.546610177f,
+  0.547252297f, 0.547894061f, 0.548535526f, 0.549176633f, 0.549817502f,
+  0.550457954f, 0.551098168f, 0.551737964f, 0.552377522f, 0.553016722f,
+  0.553655565f, 0.554294109f, 0.554932356f, 0.555570245f, 0.556207776f,
+  0.556845009f, 0.557481945f, 0.558118522f, 0.558754802f, 0.559390724f,
+  0.560026288f, 0.560661554f, 0.561296523f, 0.561931133f, 0.562565386f,
+  0.563199341f, 0.563832939f, 0.564466238f, 0.56509918f, 0.565731823f,
+  0.56636411f, 0.566996038f, 0.567627668f, 0.568258941f, 0.568889916f,
+  0.569520533f, 0.570150793f, 0.570780754f, 0.571410358f, 0.572039604f,
+  0.572668552f, 0.573297143f, 0.573925436f, 0.57455337f, 0.575180948f,
+  0.575808167f, 0.576435089f, 0.577061653f, 0.577687919f, 0.578313768f,
+  0.578939319f, 0.579564571f, 0.580189407f, 0.580813944f, 0.581438124f,
+  0.582062006f, 0.582685471f, 0.583308637f, 0.583931446f, 0.584553957f,
+  0.585176051f, 0.585797846f, 0.586419284f, 0.587040365f, 0.587661147f,
+  0.588281572f, 0.588901579f, 0.589521289f, 0.5901407f, 0.590759695f,
+  0.591378391f, 0.59199667f, 0.592614651f, 0.593232274f, 0.593849599f,
+  0.594466507f, 0.595083058f, 0.59569931f, 0.596315205f, 0.596930683f,
+  0.597545862f, 0.598160684f, 0.598775208f, 0.599389315f, 0.600003064f,
+  0.600616455f, 0.601229548f, 0.601842225f, 0.602454603f, 0.603066623f,
+  0.603678226f, 0.604289532f, 0.604900479f, 0.605511069f, 0.606121242f,
+  0.606731117f, 0.607340634f, 0.607949793f, 0.608558595f, 0.609167039f,
+  0.609775066f, 0.610382795f, 0.610990167f, 0.61159718f, 0.612203777f,
+  0.612810075f, 0.613416016f, 0.61402154f, 0.614626765f, 0.615231574f,
+  0.615836084f, 0.616440177f, 0.617043912f, 0.61764729f, 0.61825031f,
+  0.618852973f, 0.619455278f, 0.620057225f, 0.620658755f, 0.621259987f,
+  0.621860802f, 0.622461259f, 0.623061359f, 0.623661101f, 0.624260485f,
+  0.624859512f, 0.625458121f, 0.626056373f, 0.626654267f, 0.627251804f,
+  0.627848983f, 0.628445745f, 0.629042208f, 0.629638255f, 0.630233943f,
+  0.630829215f, 0.631424189f, 0.632018745f, 0.632612944f, 0.633206785f,
+  0.633800209f, 0.634393275f, 0.634985983f, 0.635578334f, 0.636170268f,
+  0.636761844f, 0.637353063f, 0.637943923f, 0.638534367f, 0.639124453f,
+  0.639714181f, 0.640303493f, 0.640892446f, 0.641481042f, 0.642069221f,
+  0.642657042f, 0.643244505f, 0.643831551f, 0.64441824f, 0.645004511f,
+  0.645590484f, 0.64617604f, 0.646761179f, 0.64734596f, 0.647930384f,
+  0.64851439f, 0.649098039f, 0.64968133f, 0.650264204f, 0.65084666f,
+  0.651428819f, 0.65201056f, 0.652591884f, 0.653172851f, 0.6537534f,
+  0.654333591f, 0.654913425f, 0.655492842f, 0.656071901f, 0.656650543f,
+  0.657228827f, 0.657806695f, 0.658384204f, 0.658961296f, 0.659538031f,
+  0.660114348f, 0.660690308f, 0.66126585f, 0.661840975f, 0.662415802f,
+  0.662990153f, 0.663564146f, 0.664137781f, 0.664710999f, 0.665283799f,
+  0.665856242f, 0.666428268f, 0.666999936f, 0.667571187f, 0.668142021f,
+  0.668712497f, 0.669282615f, 0.669852257f, 0.670421541f, 0.670990467f,
+  0.671558976f, 0.672127068f, 0.672694743f, 0.67326206f, 0.673829019f,
+  0.674395502f, 0.674961627f, 0.675527394f, 0.676092684f, 0.676657617f,
+  0.677222192f, 0.677786291f, 0.678350031f, 0.678913355f, 0.679476321f,
+  0.680038869f, 0.680601001f, 0.681162715f, 0.681724072f, 0.682285011f,
+  0.682845533f, 0.683405697f, 0.683965385f, 0.684524715f, 0.685083687f,
+  0.685642183f, 0.686200321f, 0.686758041f, 0.687315345f, 0.687872231f,
+  0.68842876f, 0.688984871f, 0.689540565f, 0.690095842f, 0.690650702f,
+  0.691205204f, 0.691759229f, 0.692312896f, 0.692866147f, 0.693419039f,
+  0.693971455f, 0.694523513f, 0.695075095f, 0.695626318f, 0.696177125f,
+  0.696727514f, 0.697277486f, 0.697827101f, 0.698376238f, 0.698925018f,
+  0.699473321f, 0.700021267f, 0.700568795f, 0.701115906f, 0.7016626f,
+  0.702208877f, 0.702754736f, 0.703300178f, 0.703845263f, 0.70438987f,
+  0.704934061f, 0.705477893f, 0.706021249f, 0.706564248f, 0.707106769f,
+  0.707648933f, 0.70819062f, 0.708731949f, 0.709272802f, 0.709813297f,
+  0.710353374f, 0.710892975f, 0.711432219f, 0.711970985f, 0.712509394f,
+  0.713047326f, 0.71358484f, 0.714121997f, 0.714658678f, 0.715194941f,
+  0.715730846f, 0.716266274f, 0.716801286f, 0.71733588f, 0.717870057f,
+  0.718403816f, 0.718937099f, 0.719470024f, 0.720002532f, 0.720534563f,
+  0.721066177f, 0.721597433f, 0.722128212f, 0.722658575f, 0.72318846f,
+  0.723717988f, 0.724247098f, 0.724775732f, 0.725303948f, 0.725831807f,
+  0.726359129f, 0.726886094f, 0.727412641f, 0.727938712f, 0.728464365f,
+  0.728989601f, 0.72951442f, 0.730038822f, 0.730562747f, 0.731086314f,
+  0.731609404f, 0.732132018f, 0.732654274f, 0.733176053f, 0.733697414f,
+  0.734218359f, 0.734738886f, 0.735258937f, 0.73577857f, 0.736297786f,
+  0.736816585f, 0.737334907f, 0.737852812f, 0.738370299f, 0.73888731f,
+  0.739403903f, 0.73992008f, 0.740435839f, 0.740951121f, 0.741465986f,
+  0.741980433f, 0.742494404f, 0.743007958f, 0.743521094f, 0.744033754f,
+  0.744545996f, 0.745057762f, 0.74556917f, 0.746080101f, 0.746590555f,
+  0.747100592f, 0.747610211f, 0.748119354f, 0.74862808f, 0.749136388f,
+  0.74964422f, 0.750151634f, 0.750658631f, 0.751165152f, 0.751671195f,
+  0.752176821f, 0.75268203f, 0.753186822f, 0.753691137f, 0.754194975f,
+  0.754698396f, 0.755201399f, 0.755703926f, 0.756205976f, 0.756707668f,
+  0.757208824f, 0.757709622f, 0.758209884f, 0.758709788f, 0.759209216f,
+  0.759708166f, 0.760206699f, 0.760704756f, 0.761202395f, 0.761699557f,
+  0.762196302f, 0.762692571f, 0.763188422f, 0.763683796f, 0.764178753f,
+  0.764673233f, 0.765167236f, 0.765660882f, 0.766153991f, 0.766646683f,
+  0.767138898f, 0.767630696f, 0.768122017f, 0.768612921f, 0.769103348f,
+  0.769593298f, 0.770082831f, 0.770571887f, 0.771060526f, 0.771548688f,
+  0.772036374f, 0.772523642f, 0.773010433f, 0.773496807f, 0.773982704f,
+  0.774468124f, 0.774953127f, 0.775437653f, 0.775921702f, 0.776405334f,
+  0.77688849f, 0.777371168f, 0.777853429f, 0.778335214f, 0.778816521f,
+  0.779297352f, 0.779777765f, 0.780257761f, 0.780737221f, 0.781216264f,
+  0.781694829f, 0.782172918f, 0.78265059f, 0.783127785f, 0.783604503f,
+  0.784080803f, 0.784556568f, 0.785031915f, 0.785506845f, 0.785981238f,
+  0.786455214f, 0.786928713f, 0.787401736f, 0.787874341f, 0.78834641f,
+  0.788818061f, 0.789289236f, 0.789759994f, 0.790230215f, 0.790700018f,
+  0.791169345f, 0.791638196f, 0.792106569f, 0.792574525f, 0.793041945f,
+  0.793508947f, 0.793975472f, 0.794441521f, 0.794907153f, 0.795372248f,
+  0.795836926f, 0.796301067f, 0.796764791f, 0.797228038f, 0.797690868f,
+  0.798153162f, 0.798614979f, 0.799076378f, 0.799537241f, 0.799997687f,
+  0.800457656f, 0.800917149f, 0.801376164f, 0.801834702f, 0.802292824f,
+  0.802750409f, 0.803207517f, 0.803664207f, 0.804120362f, 0.804576099f,
+  0.805031359f, 0.805486083f, 0.80594039f, 0.806394219f, 0.806847572f,
+  0.807300448f, 0.807752848f, 0.80820471f, 0.808656156f, 0.809107125f,
+  0.809557617f, 0.810007632f, 0.81045717f, 0.810906231f, 0.811354876f,
+  0.811802983f, 0.812250614f, 0.812697768f, 0.813144386f, 0.813590586f,
+  0.81403631f, 0.814481556f, 0.814926326f, 0.815370619f, 0.815814435f,
+  0.816257715f, 0.816700578f, 0.817142904f, 0.817584813f, 0.818026185f,
+  0.81846714f, 0.818907559f, 0.819347501f, 0.819786966f, 0.820225954f,
+  0.820664465f, 0.8211025f, 0.821540058f, 0.821977139f, 0.822413683f,
+  0.82284981f, 0.823285401f, 0.823720515f, 0.824155152f, 0.824589312f,
+  0.825022995f, 0.825456142f, 0.825888872f, 0.826321065f, 0.826752782f,
+  0.827184021f, 0.827614784f, 0.82804507f, 0.82847482f, 0.828904092f,
+  0.829332948f, 0.829761207f, 0.830189049f, 0.830616415f, 0.831043243f,
+  0.831469595f, 0.831895471f, 0.832320869f, 0.83274579f, 0.833170176f,
+  0.833594084f, 0.834017515f, 0.83444041f, 0.834862888f, 0.835284829f,
+  0.835706294f, 0.836127281f, 0.836547732f, 0.836967707f, 0.837387204f,
+  0.837806225f, 0.838224709f, 0.838642716f, 0.839060247f, 0.839477241f,
+  0.839893818f, 0.840309858f, 0.840725362f, 0.841140449f, 0.841554999f,
+  0.841969013f, 0.84238261f, 0.84279567f, 0.843208253f, 0.8436203f,
+  0.84403187f, 0.844442964f, 0.84485358f, 0.84526366f, 0.845673263f,
+  0.84608233f, 0.84649092f, 0.846899033f, 0.847306609f, 0.847713768f,
+  0.848120332f, 0.848526478f, 0.848932028f, 0.849337161f, 0.849741757f,
+  0.850145876f, 0.850549459f, 0.850952566f, 0.851355195f, 0.851757288f,
+  0.852158904f, 0.852559984f, 0.852960587f, 0.853360713f, 0.853760302f,
+  0.854159415f, 0.854557991f, 0.85495609f, 0.855353653f, 0.85575074f,
+  0.856147349f, 0.856543422f, 0.856938958f, 0.857334018f, 0.857728601f,
+  0.858122647f, 0.858516216f, 0.858909249f, 0.859301805f, 0.859693885f,
+  0.860085368f, 0.860476434f, 0.860866964f, 0.861256957f, 0.861646473f,
+  0.862035453f, 0.862423956f, 0.862811923f, 0.863199413f, 0.863586366f,
+  0.863972843f, 0.864358783f, 0.864744246f, 0.865129173f, 0.865513623f,
+  0.865897536f, 0.866280973f, 0.866663873f, 0.867046237f, 0.867428124f,
+  0.867809474f, 0.868190348f, 0.868570685f, 0.868950546f, 0.86932987f,
+  0.869708657f, 0.870086968f, 0.870464802f, 0.87084204f, 0.87121886f,
+  0.871595085f, 0.871970832f, 0.872346044f, 0.872720778f, 0.873094976f,
+  0.873468697f, 0.873841822f, 0.87421453f, 0.874586642f, 0.874958277f,
+  0.875329375f, 0.875699997f, 0.876070082f, 0.876439691f, 0.876808703f,
+  0.877177238f, 0.877545297f, 0.877912819f, 0.878279805f, 0.878646255f,
+  0.879012227f, 0.879377663f, 0.879742622f, 0.880106986f, 0.880470872f,
+  0.880834281f, 0.881197095f, 0.881559432f, 0.881921291f, 0.882282555f,
+  0.882643342f, 0.883003592f, 0.883363366f, 0.883722544f, 0.884081244f,
+  0.884439468f, 0.884797096f, 0.885154247f, 0.885510862f, 0.88586694f,
+  0.886222541f, 0.886577606f, 0.886932135f, 0.887286127f, 0.887639642f,
+  0.887992561f, 0.888345063f, 0.888696969f, 0.889048338f, 0.88939923f,
+  0.889749587f, 0.890099406f, 0.890448749f, 0.890797496f, 0.891145766f,
+  0.891493499f, 0.891840696f, 0.892187417f, 0.892533541f, 0.892879188f,
+  0.893224299f, 0.893568873f, 0.893912971f, 0.894256473f, 0.894599497f,
+  0.894941986f, 0.895283937f, 0.895625353f, 0.895966232f, 0.896306634f,
+  0.8966465f, 0.896985769f, 0.897324562f, 0.897662818f, 0.898000598f,
+  0.898337781f, 0.898674488f, 0.899010599f, 0.899346232f, 0.89968133f,
+  0.900015891f, 0.900349915f, 0.900683403f, 0.901016414f, 0.901348829f,
+  0.901680768f, 0.902012169f, 0.902342975f, 0.902673304f, 0.903003097f,
+  0.903332353f, 0.903661072f, 0.903989315f, 0.904316962f, 0.904644072f,
+  0.904970706f, 0.905296743f, 0.905622303f, 0.905947268f, 0.906271756f,
+  0.906595707f, 0.906919122f, 0.907242f, 0.907564342f, 0.907886088f,
+  0.908207357f, 0.90852809f, 0.908848345f, 0.909168005f, 0.909487128f,
+  0.909805715f, 0.910123765f, 0.910441279f, 0.910758257f, 0.911074758f,
+  0.911390662f, 0.91170603f, 0.912020862f, 0.912335157f, 0.912648976f,
+  0.912962198f, 0.913274884f, 0.913587034f, 0.913898647f, 0.914209783f,
+  0.914520323f, 0.914830327f, 0.915139794f, 0.915448725f, 0.91575712f,
+  0.916064978f, 0.916372299f, 0.916679084f, 0.916985273f, 0.917290986f,
+  0.917596161f, 0.917900801f, 0.918204844f, 0.91850841f, 0.918811381f,
+  0.919113874f, 0.919415772f, 0.919717133f, 0.920017958f, 0.920318305f,
+  0.920618057f, 0.920917213f, 0.921215892f, 0.921514034f, 0.92181164f,
+  0.92210865f, 0.922405183f, 0.92270112f, 0.922996521f, 0.923291445f,
+  0.923585773f, 0.923879504f, 0.924172759f, 0.924465477f, 0.9247576f,
+  0.925049245f, 0.925340295f, 0.925630808f, 0.925920784f, 0.926210225f,
+  0.926499128f, 0.926787496f, 0.927075267f, 0.927362502f, 0.92764926f,
+  0.927935421f, 0.928220987f, 0.928506076f, 0.928790629f, 0.929074585f,
+  0.929358006f, 0.929640889f, 0.929923236f, 0.930205047f, 0.930486262f,
+  0.93076694f, 0.931047082f, 0.931326687f, 0.931605756f, 0.931884289f,
+  0.932162225f, 0.932439625f, 0.932716489f, 0.932992816f, 0.933268547f,
+  0.933543801f, 0.93381846f, 0.934092522f, 0.934366107f, 0.934639156f,
+  0.934911609f, 0.935183525f, 0.935454845f, 0.935725689f, 0.935995936f,
+  0.936265647f, 0.936534822f, 0.93680346f, 0.937071502f, 0.937339008f,
+  0.937605977f, 0.93787235f, 0.938138247f, 0.938403547f, 0.938668311f,
+  0.938932478f, 0.93919611f, 0.939459205f, 0.939721763f, 0.939983726f,
+  0.940245211f, 0.940506041f, 0.940766394f, 0.941026151f, 0.941285372f,
+  0.941544056f, 0.941802204f, 0.942059755f, 0.942316771f, 0.94257319f,
+  0.942829072f, 0.943084419f, 0.943339229f, 0.943593442f, 0.94384712f,
+  0.944100261f, 0.944352806f, 0.944604814f, 0.944856286f, 0.945107222f,
+  0.945357561f, 0.945607305f, 0.945856571f, 0.946105242f, 0.946353376f,
+  0.946600914f, 0.946847916f, 0.947094381f, 0.94734025f, 0.947585583f,
+  0.947830379f, 0.948074579f, 0.948318243f, 0.94856137f, 0.948803902f,
+  0.949045897f, 0.949287295f, 0.949528158f, 0.949768484f, 0.950008273f,
+  0.950247467f, 0.950486064f, 0.950724125f, 0.950961649f, 0.951198637f,
+  0.95143503f, 0.951670885f, 0.951906145f, 0.952140868f, 0.952374995f,
+  0.952608585f, 0.95284164f, 0.953074098f, 0.953306019f, 0.953537405f,
+  0.953768194f, 0.953998446f, 0.954228103f, 0.954457223f, 0.954685748f,
+  0.954913735f, 0.955141187f, 0.955368042f, 0.955594361f, 0.955820084f,
+  0.95604527f, 0.95626986f, 0.956493914f, 0.956717432f, 0.956940353f,
+  0.957162678f, 0.957384527f, 0.95760572f, 0.957826436f, 0.958046496f,
+  0.958266079f, 0.958485067f, 0.958703458f, 0.958921313f, 0.959138632f,
+  0.959355354f, 0.95957154f, 0.95978713f, 0.960002124f, 0.960216641f,
+  0.960430503f, 0.960643888f, 0.960856616f, 0.961068869f, 0.961280465f,
+  0.961491585f, 0.961702049f, 0.961912036f, 0.962121427f, 0.962330222f,
+  0.962538481f, 0.962746143f, 0.962953269f, 0.9631598f, 0.963365793f,
+  0.963571191f, 0.963776052f, 0.963980377f, 0.964184046f, 0.964387238f,
+  0.964589775f, 0.964791834f, 0.964993238f, 0.965194106f, 0.965394437f,
+  0.965594172f, 0.965793371f, 0.965991974f, 0.966189981f, 0.966387451f,
+  0.966584384f, 0.966780722f, 0.966976464f, 0.967171669f, 0.967366278f,
+  0.967560351f, 0.967753828f, 0.967946768f, 0.968139112f, 0.96833086f,
+  0.968522072f, 0.968712747f, 0.968902826f, 0.969092309f, 0.969281256f,
+  0.969469607f, 0.969657362f, 0.96984458f, 0.970031261f, 0.970217347f,
+  0.970402837f, 0.97058779f, 0.970772147f, 0.970955908f, 0.971139133f,
+  0.971321821f, 0.971503913f, 0.97168541f, 0.97186631f, 0.972046733f,
+  0.972226501f, 0.972405732f, 0.972584367f, 0.972762465f, 0.972939968f,
+  0.973116875f, 0.973293245f, 0.973469019f, 0.973644257f, 0.973818898f,
+  0.973992944f, 0.974166453f, 0.974339366f, 0.974511743f, 0.974683523f,
+  0.974854708f, 0.975025356f, 0.975195408f, 0.975364864f, 0.975533783f,
+  0.975702107f, 0.975869894f, 0.976037085f, 0.97620368f, 0.976369739f,
+  0.976535201f, 0.976700068f, 0.976864398f, 0.977028131f, 0.977191329f,
+  0.977353871f, 0.977515936f, 0.977677345f, 0.977838218f, 0.977998495f,
+  0.978158236f, 0.97831738f, 0.978475928f, 0.97863394f, 0.978791356f,
+  0.978948176f, 0.979104459f, 0.979260147f, 0.979415238f, 0.979569793f,
+  0.979723752f, 0.979877114f, 0.980029881f, 0.980182111f, 0.980333805f,
+  0.980484843f, 0.980635345f, 0.980785251f, 0.98093462f, 0.981083393f,
+  0.98123157f, 0.981379211f, 0.981526256f, 0.981672704f, 0.981818557f,
+  0.981963873f, 0.982108593f, 0.982252717f, 0.982396305f, 0.982539296f,
+  0.982681692f, 0.982823551f, 0.982964814f, 0.983105481f, 0.983245611f,
+  0.983385086f, 0.983524024f, 0.983662426f, 0.983800232f, 0.983937442f,
+  0.984074056f, 0.984210074f, 0.984345555f, 0.984480441f, 0.984614789f,
+  0.984748483f, 0.984881639f, 0.98501426f, 0.985146224f, 0.985277653f,
+  0.985408485f, 0.985538721f, 0.985668421f, 0.985797524f, 0.985926032f,
+  0.986053944f, 0.986181319f, 0.986308098f, 0.986434281f, 0.986559927f,
+  0.986684918f, 0.986809373f, 0.986933291f, 0.987056553f, 0.987179279f,
+  0.987301409f, 0.987422943f, 0.987543941f, 0.987664342f, 0.987784147f,
+  0.987903357f, 0.988022029f, 0.988140106f, 0.988257587f, 0.988374472f,
+  0.98849082f, 0.988606513f, 0.988721669f, 0.988836288f, 0.988950253f,
+  0.98906368f, 0.989176512f, 0.989288747f, 0.989400446f, 0.98951149f,
+  0.989621997f, 0.989731967f, 0.989841282f, 0.989950061f, 0.990058184f,
+  0.99016583f, 0.99027282f, 0.990379214f, 0.990485072f, 0.990590334f,
+  0.990695f, 0.990799129f, 0.990902662f, 0.99100554f, 0.991107941f,
+  0.991209686f, 0.991310835f, 0.991411448f, 0.991511464f, 0.991610885f,
+  0.991709769f, 0.991807997f, 0.991905689f, 0.992002785f, 0.992099285f,
+  0.992195249f, 0.992290616f, 0.992385328f, 0.992479563f, 0.992573142f,
+  0.992666125f, 0.992758572f, 0.992850423f, 0.992941678f, 0.993032336f,
+  0.993122458f, 0.993211925f, 0.993300855f, 0.993389189f, 0.993476987f,
+  0.993564129f, 0.993650734f, 0.993736744f, 0.993822157f, 0.993906975f,
+  0.993991196f, 0.994074881f, 0.99415797f, 0.994240463f, 0.99432236f,
+  0.99440366f, 0.994484425f, 0.994564593f, 0.994644165f, 0.994723141f,
+  0.994801521f, 0.994879305f, 0.994956553f, 0.995033205f, 0.99510926f,
+  0.99518472f, 0.995259583f, 0.99533391f, 0.995407641f, 0.995480776f,
+  0.995553315f, 0.995625257f, 0.995696604f, 0.995767415f, 0.995837629f,
+  0.995907247f, 0.995976269f, 0.996044695f, 0.996112585f, 0.996179819f,
+  0.996246517f, 0.996312618f, 0.996378124f, 0.996443033f, 0.996507406f,
+  0.996571124f, 0.996634305f, 0.996696889f, 0.996758878f, 0.996820271f,
+  0.996881127f, 0.996941328f, 0.997000992f, 0.997060061f, 0.997118533f,
+  0.997176409f, 0.997233748f, 0.997290432f, 0.99734658f, 0.997402132f,
+  0.997457087f, 0.997511446f, 0.99756521f, 0.997618437f, 0.997671068f,
+  0.997723043f, 0.997774482f, 0.997825325f, 0.997875631f, 0.997925282f,
+  0.997974396f, 0.998022854f, 0.998070776f, 0.998118103f, 0.998164833f,
+  0.998211026f, 0.998256564f, 0.998301566f, 0.998345912f, 0.998389721f,
+  0.998432934f, 0.998475552f, 0.998517632f, 0.998559058f, 0.998599946f,
+  0.998640239f, 0.998679936f, 0.998719037f, 0.998757541f, 0.99879545f,
+  0.998832822f, 0.998869538f, 0.998905718f, 0.998941302f, 0.99897629f,
+  0.999010682f, 0.999044478f, 0.999077737f, 0.999110341f, 0.999142408f,
+  0.99917388f, 0.999204755f, 0.999235034f, 0.999264777f, 0.999293864f,
+  0.999322355f, 0.999350309f, 0.999377668f, 0.99940443f, 0.999430597f,
+  0.999456167f, 0.999481201f, 0.999505579f, 0.999529421f, 0.999552667f,
+  0.999575317f, 0.999597371f, 0.999618828f, 0.99963969f, 0.999660015f,
+  0.999679685f, 0.999698818f, 0.999717355f, 0.999735296f, 0.999752641f,
+  0.99976939f, 0.999785602f, 0.999801159f, 0.999816179f, 0.999830604f,
+  0.999844432f, 0.999857664f, 0.9998703f, 0.99988234f, 0.999893844f,
+  0.999904692f, 0.999915004f, 0.999924719f, 0.999933839f, 0.999942362f,
+  0.99995029f, 0.999957621f, 0.999964416f, 0.999970615f, 0.999976158f,
+  0.999981165f, 0.999985576f, 0.99998939f, 0.999992669f, 0.999995291f,
+  0.999997377f, 0.999998808f, 0.999999702f, 1.f, 0.999999702f,
+  0.999998808f, 0.999997377f, 0.999995291f, 0.999992669f, 0.99998939f,
+  0.999985576f, 0.999981165f, 0.999976158f, 0.999970615f, 0.999964416f,
+  0.999957621f, 0.99995029f, 0.999942362f, 0.999933839f, 0.999924719f,
+  0.999915004f, 0.999904692f, 0.999893844f, 0.99988234f, 0.9998703f,
+  0.999857664f, 0.999844432f, 0.999830604f, 0.999816179f, 0.999801159f,
+  0.999785602f, 0.99976939f, 0.999752641f, 0.999735296f, 0.999717355f,
+  0.999698818f, 0.999679685f, 0.999660015f, 0.99963969f, 0.999618828f,
+  0.999597371f, 0.999575317f, 0.999552667f, 0.999529421f, 0.999505579f,
+  0.999481201f, 0.999456167f, 0.999430597f, 0.99940443f, 0.999377668f,
+  0.999350309f, 0.999322355f, 0.999293864f, 0.999264777f, 0.999235034f,
+  0.999204755f, 0.99917388f, 0.999142408f, 0.999110341f, 0.999077737f,
+  0.999044478f, 0.999010682f, 0.99897629f, 0.998941302f, 0.998905718f,
+  0.998869538f, 0.998832822f, 0.99879545f, 0.998757541f, 0.998719037f,
+  0.998679936f, 0.998640239f, 0.998599946f, 0.998559058f, 0.998517632f,
+  0.998475552f, 0.998432934f, 0.998389721f, 0.998345912f, 0.998301566f,
+  0.998256564f, 0.998211026f, 0.998164833f, 0.998118103f, 0.998070776f,
+  0.998022854f, 0.997974396f, 0.997925282f, 0.997875631f, 0.997825325f,
+  0.997774482f, 0.997723043f, 0.997671068f, 0.997618437f, 0.99756521f,
+  0.997511446f, 0.997457087f, 0.997402132f, 0.99734658f, 0.997290432f,
+  0.997233748f, 0.997176409f, 0.997118533f, 0.997060061f, 0.997000992f,
+  0.996941328f, 0.996881127f, 0.996820271f, 0.996758878f, 0.996696889f,
+  0.996634305f, 0.996571124f, 0.996507406f, 0.996443033f, 0.996378124f,
+  0.996312618f, 0.996246517f, 0.996179819f, 0.996112585f, 0.996044695f,
+  0.995976269f, 0.995907247f, 0.995837629f, 0.995767415f, 0.995696604f,
+  0.995625257f, 0.995553315f, 0.995480776f, 0.995407641f, 0.99533391f,
+  0.995259583f, 0.99518472f, 0.99510926f, 0.995033205f, 0.994956553f,
+  0.994879305f, 0.994801521f, 0.994723141f, 0.994644165f, 0.994564593f,
+  0.994484425f, 0.99440366f, 0.99432236f, 0.994240463f, 0.99415797f,
+  0.994074881f, 0.993991196f, 0.993906975f, 0.993822157f, 0.993736744f,
+  0.993650734f, 0.993564129f, 0.993476987f, 0.993389189f, 0.993300855f,
+  0.993211925f, 0.993122458f, 0.993032336f, 0.992941678f, 0.992850423f,
+  0.992758572f, 0.992666125f, 0.992573142f, 0.992479563f, 0.992385328f,
+  0.992290616f, 0.992195249f, 0.992099285f, 0.992002785f, 0.991905689f,
+  0.991807997f, 0.991709769f, 0.991610885f, 0.991511464f, 0.991411448f,
+  0.991310835f, 0.991209686f, 0.991107941f, 0.99100554f, 0.990902662f,
+  0.990799129f, 0.990695f, 0.990590334f, 0.990485072f, 0.990379214f,
+  0.99027282f, 0.99016583f, 0.990058184f, 0.989950061f, 0.989841282f,
+  0.989731967f, 0.989621997f, 0.98951149f, 0.989400446f, 0.989288747f,
+  0.989176512f, 0.98906368f, 0.988950253f, 0.988836288f, 0.988721669f,
+  0.988606513f, 0.98849082f, 0.988374472f, 0.988257587f, 0.988140106f,
+  0.988022029f, 0.987903357f, 0.987784147f, 0.987664342f, 0.987543941f,
+  0.987422943f, 0.987301409f, 0.987179279f, 0.987056553f, 0.986933291f,
+  0.986809373f, 0.986684918f, 0.986559927f, 0.986434281f, 0.986308098f,
+  0.986181319f, 0.986053944f, 0.985926032f, 0.985797524f, 0.985668421f,
+  0.985538721f, 0.985408485f, 0.985277653f, 0.985146224f, 0.98501426f,
+  0.984881639f, 0.984748483f, 0.984614789f, 0.984480441f, 0.984345555f,
+  0.984210074f, 0.984074056f, 0.983937442f, 0.983800232f, 0.983662426f,
+  0.983524024f, 0.983385086f, 0.983245611f, 0.983105481f, 0.982964814f,
+  0.982823551f, 0.982681692f, 0.982539296f, 0.982396305f, 0.982252717f,
+  0.982108593f, 0.981963873f, 0.981818557f, 0.981672704f, 0.981526256f,
+  0.981379211f, 0.98123157f, 0.981083393f, 0.98093462f, 0.980785251f,
+  0.980635345f, 0.980484843f, 0.980333805f, 0.980182111f, 0.980029881f,
+  0.979877114f, 0.979723752f, 0.979569793f, 0.979415238f, 0.979260147f,
+  0.979104459f, 0.978948176f, 0.978791356f, 0.97863394f, 0.978475928f,
+  0.97831738f, 0.978158236f, 0.977998495f, 0.977838218f, 0.977677345f,
+  0.977515936f, 0.977353871f, 0.977191329f, 0.977028131f, 0.976864398f,
+  0.976700068f, 0.976535201f, 0.976369739f, 0.97620368f, 0.976037085f,
+  0.975869894f, 0.975702107f, 0.975533783f, 0.975364864f, 0.975195408f,
+  0.975025356f, 0.974854708f, 0.974683523f, 0.974511743f, 0.974339366f,
+  0.974166453f, 0.973992944f, 0.973818898f, 0.973644257f, 0.973469019f,
+  0.973293245f, 0.973116875f, 0.972939968f, 0.972762465f, 0.972584367f,
+  0.972405732f, 0.972226501f, 0.972046733f, 0.97186631f, 0.97168541f,
+  0.971503913f, 0.971321821f, 0.971139133f, 0.970955908f, 0.970772147f,
+  0.97058779f, 0.970402837f, 0.970217347f, 0.970031261f, 0.96984458f,
+  0.969657362f, 0.969469607f, 0.969281256f, 0.969092309f, 0.968902826f,
+  0.968712747f, 0.968522072f, 0.96833086f, 0.968139112f, 0.967946768f,
+  0.967753828f, 0.967560351f, 0.967366278f, 0.967171669f, 0.966976464f,
+  0.966780722f, 0.966584384f, 0.966387451f, 0.966189981f, 0.965991974f,
+  0.965793371f, 0.965594172f, 0.965394437f, 0.965194106f, 0.964993238f,
+  0.964791834f, 0.964589775f, 0.964387238f, 0.964184046f, 0.963980377f,
+  0.963776052f, 0.963571191f, 0.963365793f, 0.9631598f, 0.962953269f,
+  0.962746143f, 0.962538481f, 0.962330222f, 0.962121427f, 0.961912036f,
+  0.961702049f, 0.961491585f, 0.961280465f, 0.961068869f, 0.960856616f,
+  0.960643888f, 0.960430503f, 0.960216641f, 0.960002124f, 0.95978713f,
+  0.95957154f, 0.959355354f, 0.959138632f, 0.958921313f, 0.958703458f,
+  0.958485067f, 0.958266079f, 0.958046496f, 0.957826436f, 0.95760572f,
+  0.957384527f, 0.957162678f, 0.956940353f, 0.956717432f, 0.956493914f,
+  0.95626986f, 0.95604527f, 0.955820084f, 0.955594361f, 0.955368042f,
+  0.955141187f, 0.954913735f, 0.954685748f, 0.954457223f, 0.954228103f,
+  0.953998446f, 0.953768194f, 0.953537405f, 0.953306019f, 0.953074098f,
+  0.95284164f, 0.952608585f, 0.952374995f, 0.952140868f, 0.951906145f,
+  0.951670885f, 0.95143503f, 0.951198637f, 0.950961649f, 0.950724125f,
+  0.950486064f, 0.950247467f, 0.950008273f, 0.949768484f, 0.949528158f,
+  0.949287295f, 0.949045897f, 0.948803902f, 0.94856137f, 0.948318243f,
+  0.948074579f, 0.947830379f, 0.947585583f, 0.94734025f, 0.947094381f,
+  0.946847916f, 0.946600914f, 0.946353376f, 0.946105242f, 0.945856571f,
+  0.945607305f, 0.945357561f, 0.945107222f, 0.944856286f, 0.944604814f,
+  0.944352806f, 0.944100261f, 0.94384712f, 0.943593442f, 0.943339229f,
+  0.943084419f, 0.942829072f, 0.94257319f, 0.942316771f, 0.942059755f,
+  0.941802204f, 0.941544056f, 0.941285372f, 0.941026151f, 0.940766394f,
+  0.940506041f, 0.940245211f, 0.939983726f, 0.939721763f, 0.939459205f,
+  0.93919611f, 0.938932478f, 0.938668311f, 0.938403547f, 0.938138247f,
+  0.93787235f, 0.937605977f, 0.937339008f, 0.937071502f, 0.93680346f,
+  0.936534822f, 0.936265647f, 0.935995936f, 0.935725689f, 0.935454845f,
+  0.935183525f, 0.934911609f, 0.934639156f, 0.934366107f, 0.934092522f,
+  0.93381846f, 0.933543801f, 0.933268547f, 0.932992816f, 0.932716489f,
+  0.932439625f, 0.932162225f, 0.931884289f, 0.931605756f, 0.931326687f,
+  0.931047082f, 0.93076694f, 0.930486262f, 0.930205047f, 0.929923236f,
+  0.929640889f, 0.929358006f, 0.929074585f, 0.928790629f, 0.928506076f,
+  0.928220987f, 0.927935421f, 0.92764926f, 0.927362502f, 0.927075267f,
+  0.926787496f, 0.926499128f, 0.926210225f, 0.925920784f, 0.925630808f,
+  0.925340295f, 0.925049245f, 0.9247576f, 0.924465477f, 0.924172759f,
+  0.923879504f, 0.923585773f, 0.923291445f, 0.922996521f, 0.92270112f,
+  0.922405183f, 0.92210865f, 0.92181164f, 0.921514034f, 0.921215892f,
+  0.920917213f, 0.920618057f, 0.920318305f, 0.920017958f, 0.919717133f,
+  0.919415772f, 0.919113874f, 0.918811381f, 0.91850841f, 0.918204844f,
+  0.917900801f, 0.917596161f, 0.917290986f, 0.916985273f, 0.916679084f,
+  0.916372299f, 0.916064978f, 0.91575712f, 0.915448725f, 0.915139794f,
+  0.914830327f, 0.914520323f, 0.914209783f, 0.913898647f, 0.913587034f,
+  0.913274884f, 0.912962198f, 0.912648976f, 0.912335157f, 0.912020862f,
+  0.91170603f, 0.911390662f, 0.911074758f, 0.910758257f, 0.910441279f,
+  0.910123765f, 0.909805715f, 0.909487128f, 0.909168005f, 0.908848345f,
+  0.90852809f, 0.908207357f, 0.907886088f, 0.907564342f, 0.907242f,
+  0.906919122f, 0.906595707f, 0.906271756f, 0.905947268f, 0.905622303f,
+  0.905296743f, 0.904970706f, 0.904644072f, 0.904316962f, 0.903989315f,
+  0.903661072f, 0.903332353f, 0.903003097f, 0.902673304f, 0.902342975f,
+  0.902012169f, 0.901680768f, 0.901348829f, 0.901016414f, 0.900683403f,
+  0.900349915f, 0.900015891f, 0.89968133f, 0.899346232f, 0.899010599f,
+  0.898674488f, 0.898337781f, 0.898000598f, 0.897662818f, 0.897324562f,
+  0.896985769f, 0.8966465f, 0.896306634f, 0.895966232f, 0.895625353f,
+  0.895283937f, 0.894941986f, 0.894599497f, 0.894256473f, 0.893912971f,
+  0.893568873f, 0.893224299f, 0.892879188f, 0.892533541f, 0.892187417f,
+  0.891840696f, 0.891493499f, 0.891145766f, 0.890797496f, 0.890448749f,
+  0.890099406f, 0.889749587f, 0.88939923f, 0.889048338f, 0.888696969f,
+  0.888345063f, 0.887992561f, 0.887639642f, 0.887286127f, 0.886932135f,
+  0.886577606f, 0.886222541f, 0.88586694f, 0.885510862f, 0.885154247f,
+  0.884797096f, 0.884439468f, 0.884081244f, 0.883722544f, 0.883363366f,
+  0.883003592f, 0.882643342f, 0.882282555f, 0.881921291f, 0.881559432f,
+  0.881197095f, 0.880834281f, 0.880470872f, 0.880106986f, 0.879742622f,
+  0.879377663f, 0.879012227f, 0.878646255f, 0.878279805f, 0.877912819f,
+  0.877545297f, 0.877177238f, 0.876808703f, 0.876439691f, 0.876070082f,
+  0.875699997f, 0.875329375f, 0.874958277f, 0.874586642f, 0.87421453f,
+  0.873841822f, 0.873468697f, 0.873094976f, 0.872720778f, 0.872346044f,
+  0.871970832f, 0.871595085f, 0.87121886f, 0.87084204f, 0.870464802f,
+  0.870086968f, 0.869708657f, 0.86932987f, 0.868950546f, 0.868570685f,
+  0.868190348f, 0.867809474f, 0.867428124f, 0.867046237f, 0.866663873f,
+  0.866280973f, 0.865897536f, 0.865513623f, 0.865129173f, 0.864744246f,
+  0.864358783f, 0.863972843f, 0.863586366f, 0.863199413f, 0.862811923f,
+  0.862423956f, 0.862035453f, 0.861646473f, 0.861256957f, 0.860866964f,
+  0.860476434f, 0.860085368f, 0.859693885f, 0.859301805f, 0.858909249f,
+  0.858516216f, 0.858122647f, 0.857728601f, 0.857334018f, 0.856938958f,
+  0.856543422f, 0.856147349f, 0.85575074f, 0.855353653f, 0.85495609f,
+  0.854557991f, 0.854159415f, 0.853760302f, 0.853360713f, 0.852960587f,
+  0.852559984f, 0.852158904f, 0.851757288f, 0.851355195f, 0.850952566f,
+  0.850549459f, 0.850145876f, 0.849741757f, 0.849337161f, 0.848932028f,
+  0.848526478f, 0.848120332f, 0.847713768f, 0.847306609f, 0.846899033f,
+  0.84649092f, 0.84608233f, 0.845673263f, 0.84526366f, 0.84485358f,
+  0.844442964f, 0.84403187f, 0.8436203f, 0.843208253f, 0.84279567f,
+  0.84238261f, 0.841969013f, 0.841554999f, 0.841140449f, 0.840725362f,
+  0.840309858f, 0.839893818f, 0.839477241f, 0.839060247f, 0.838642716f,
+  0.838224709f, 0.837806225f, 0.837387204f, 0.836967707f, 0.836547732f,
+  0.836127281f, 0.835706294f, 0.835284829f, 0.834862888f, 0.83444041f,
+  0.834017515f, 0.833594084f, 0.833170176f, 0.83274579f, 0.832320869f,
+  0.831895471f, 0.831469595f, 0.831043243f, 0.830616415f, 0.830189049f,
+  0.829761207f, 0.829332948f, 0.828904092f, 0.82847482f, 0.82804507f,
+  0.827614784f, 0.827184021f, 0.826752782f, 0.826321065f, 0.825888872f,
+  0.825456142f, 0.825022995f, 0.824589312f, 0.824155152f, 0.823720515f,
+  0.823285401f, 0.82284981f, 0.822413683f, 0.821977139f, 0.821540058f,
+  0.8211025f, 0.820664465f, 0.820225954f, 0.819786966f, 0.819347501f,
+  0.818907559f, 0.81846714f, 0.818026185f, 0.817584813f, 0.817142904f,
+  0.816700578f, 0.816257715f, 0.815814435f, 0.815370619f, 0.814926326f,
+  0.814481556f, 0.81403631f, 0.813590586f, 0.813144386f, 0.812697768f,
+  0.812250614f, 0.811802983f, 0.811354876f, 0.810906231f, 0.81045717f,
+  0.810007632f, 0.809557617f, 0.809107125f, 0.808656156f, 0.80820471f,
+  0.807752848f, 0.807300448f, 0.806847572f, 0.806394219f, 0.80594039f,
+  0.805486083f, 0.805031359f, 0.804576099f, 0.804120362f, 0.803664207f,
+  0.803207517f, 0.802750409f, 0.802292824f, 0.801834702f, 0.801376164f,
+  0.800917149f, 0.800457656f, 0.799997687f, 0.799537241f, 0.799076378f,
+  0.798614979f, 0.798153162f, 0.797690868f, 0.797228038f, 0.796764791f,
+  0.796301067f, 0.795836926f, 0.795372248f, 0.794907153f, 0.794441521f,
+  0.793975472f, 0.793508947f, 0.793041945f, 0.792574525f, 0.792106569f,
+  0.791638196f, 0.791169345f, 0.790700018f, 0.790230215f, 0.789759994f,
+  0.789289236f, 0.788818061f, 0.78834641f, 0.787874341f, 0.787401736f,
+  0.786928713f, 0.786455214f, 0.785981238f, 0.785506845f, 0.785031915f,
+  0.784556568f, 0.784080803f, 0.783604503f, 0.783127785f, 0.78265059f,
+  0.782172918f, 0.781694829f, 0.781216264f, 0.780737221f, 0.780257761f,
+  0.779777765f, 0.779297352f, 0.778816521f, 0.778335214f, 0.777853429f,
+  0.777371168f, 0.77688849f, 0.776405334f, 0.775921702f, 0.775437653f,
+  0.774953127f, 0.774468124f, 0.773982704f, 0.773496807f, 0.773010433f,
+  0.772523642f, 0.772036374f, 0.771548688f, 0.771060526f, 0.770571887f,
+  0.770082831f, 0.769593298f, 0.769103348f, 0.768612921f, 0.768122017f,
+  0.767630696f, 0.767138898f, 0.766646683f, 0.766153991f, 0.765660882f,
+  0.765167236f, 0.764673233f, 0.764178753f, 0.763683796f, 0.763188422f,
+  0.762692571f, 0.762196302f, 0.761699557f, 0.761202395f, 0.760704756f,
+  0.760206699f, 0.759708166f, 0.759209216f, 0.758709788f, 0.758209884f,
+  0.757709622f, 0.757208824f, 0.756707668f, 0.756205976f, 0.755703926f,
+  0.755201399f, 0.754698396f, 0.754194975f, 0.753691137f, 0.753186822f,
+  0.75268203f, 0.752176821f, 0.751671195f, 0.751165152f, 0.750658631f,
+  0.750151634f, 0.74964422f, 0.749136388f, 0.74862808f, 0.748119354f,
+  0.747610211f, 0.747100592f, 0.746590555f, 0.746080101f, 0.74556917f,
+  0.745057762f, 0.744545996f, 0.744033754f, 0.743521094f, 0.743007958f,
+  0.742494404f, 0.741980433f, 0.741465986f, 0.740951121f, 0.740435839f,
+  0.73992008f, 0.739403903f, 0.73888731f, 0.738370299f, 0.737852812f,
+  0.737334907f, 0.736816585f, 0.736297786f, 0.73577857f, 0.735258937f,
+  0.734738886f, 0.734218359f, 0.733697414f, 0.733176053f, 0.732654274f,
+  0.732132018f, 0.731609404f, 0.731086314f, 0.730562747f, 0.730038822f,
+  0.72951442f, 0.728989601f, 0.728464365f, 0.727938712f, 0.727412641f,
+  0.726886094f, 0.726359129f, 0.725831807f, 0.725303948f, 0.724775732f,
+  0.724247098f, 0.723717988f, 0.72318846f, 0.722658575f, 0.722128212f,
+  0.721597433f, 0.721066177f, 0.720534563f, 0.720002532f, 0.719470024f,
+  0.718937099f, 0.718403816f, 0.717870057f, 0.71733588f, 0.716801286f,
+  0.716266274f, 0.715730846f, 0.715194941f, 0.714658678f, 0.714121997f,
+  0.71358484f, 0.713047326f, 0.712509394f, 0.711970985f, 0.711432219f,
+  0.710892975f, 0.710353374f, 0.709813297f, 0.709272802f, 0.708731949f,
+  0.70819062f, 0.707648933f, 0.707106769f, 0.706564248f, 0.706021249f,
+  0.705477893f, 0.704934061f, 0.70438987f, 0.703845263f, 0.703300178f,
+  0.702754736f, 0.702208877f, 0.7016626f, 0.701115906f, 0.700568795f,
+  0.700021267f, 0.699473321f, 0.698925018f, 0.698376238f, 0.697827101f,
+  0.697277486f, 0.696727514f, 0.696177125f, 0.695626318f, 0.695075095f,
+  0.694523513f, 0.693971455f, 0.693419039f, 0.692866147f, 0.692312896f,
+  0.691759229f, 0.691205204f, 0.690650702f, 0.690095842f, 0.689540565f,
+  0.688984871f, 0.68842876f, 0.687872231f, 0.687315345f, 0.686758041f,
+  0.686200321f, 0.685642183f, 0.685083687f, 0.684524715f, 0.683965385f,
+  0.683405697f, 0.682845533f, 0.682285011f, 0.681724072f, 0.681162715f,
+  0.680601001f, 0.680038869f, 0.679476321f, 0.678913355f, 0.678350031f,
+  0.677786291f, 0.677222192f, 0.676657617f, 0.676092684f, 0.675527394f,
+  0.674961627f, 0.674395502f, 0.673829019f, 0.67326206f, 0.672694743f,
+  0.672127068f, 0.671558976f, 0.670990467f, 0.670421541f, 0.669852257f,
+  0.669282615f, 0.668712497f, 0.668142021f, 0.667571187f, 0.666999936f,
+  0.666428268f, 0.665856242f, 0.665283799f, 0.664710999f, 0.664137781f,
+  0.663564146f, 0.662990153f, 0.662415802f, 0.661840975f, 0.66126585f,
+  0.660690308f, 0.660114348f, 0.659538031f, 0.658961296f, 0.658384204f,
+  0.657806695f, 0.657228827f, 0.656650543f, 0.656071901f, 0.655492842f,
+  0.654913425f, 0.654333591f, 0.6537534f, 0.653172851f, 0.652591884f,
+  0.65201056f, 0.651428819f, 0.65084666f, 0.650264204f, 0.64968133f,
+  0.649098039f, 0.64851439f, 0.647930384f, 0.64734596f, 0.646761179f,
+  0.64617604f, 0.645590484f, 0.645004511f, 0.64441824f, 0.643831551f,
+  0.643244505f, 0.642657042f, 0.642069221f, 0.641481042f, 0.640892446f,
+  0.640303493f, 0.639714181f, 0.639124453f, 0.638534367f, 0.637943923f,
+  0.637353063f, 0.636761844f, 0.636170268f, 0.635578334f, 0.634985983f,
+  0.634393275f, 0.633800209f, 0.633206785f, 0.632612944f, 0.632018745f,
+  0.631424189f, 0.630829215f, 0.630233943f, 0.629638255f, 0.629042208f,
+  0.628445745f, 0.627848983f, 0.627251804f, 0.626654267f, 0.626056373f,
+  0.625458121f, 0.624859512f, 0.624260485f, 0.623661101f, 0.623061359f,
+  0.622461259f, 0.621860802f, 0.621259987f, 0.620658755f, 0.620057225f,
+  0.619455278f, 0.618852973f, 0.61825031f, 0.61764729f, 0.617043912f,
+  0.616440177f, 0.615836084f, 0.615231574f, 0.614626765f, 0.61402154f,
+  0.613416016f, 0.612810075f, 0.612203777f, 0.61159718f, 0.610990167f,
+  0.610382795f, 0.609775066f, 0.609167039f, 0.608558595f, 0.607949793f,
+  0.607340634f, 0.606731117f, 0.606121242f, 0.605511069f, 0.604900479f,
+  0.604289532f, 0.603678226f, 0.603066623f, 0.602454603f, 0.601842225f,
+  0.601229548f, 0.600616455f, 0.600003064f, 0.599389315f, 0.598775208f,
+  0.598160684f, 0.597545862f, 0.596930683f, 0.596315205f, 0.59569931f,
+  0.595083058f, 0.594466507f, 0.593849599f, 0.593232274f, 0.592614651f,
+  0.59199667f, 0.591378391f, 0.590759695f, 0.5901407f, 0.589521289f,
+  0.588901579f, 0.588281572f, 0.587661147f, 0.587040365f, 0.586419284f,
+  0.585797846f, 0.585176051f, 0.584553957f, 0.583931446f, 0.583308637f,
+  0.582685471f, 0.582062006f, 0.581438124f, 0.580813944f, 0.580189407f,
+  0.579564571f, 0.578939319f, 0.578313768f, 0.577687919f, 0.577061653f,
+  0.576435089f, 0.575808167f, 0.575180948f, 0.57455337f, 0.573925436f,
+  0.573297143f, 0.572668552f, 0.572039604f, 0.571410358f, 0.570780754f,
+  0.570150793f, 0.569520533f, 0.568889916f, 0.568258941f, 0.567627668f,
+  0.566996038f, 0.56636411f, 0.565731823f, 0.56509918f, 0.564466238f,
+  0.563832939f, 0.563199341f, 0.562565386f, 0.561931133f, 0.561296523f,
+  0.560661554f, 0.560026288f, 0.559390724f, 0.558754802f, 0.558118522f,
+  0.557481945f, 0.556845009f, 0.556207776f, 0.555570245f, 0.554932356f,
+  0.554294109f, 0.553655565f, 0.553016722f, 0.552377522f, 0.551737964f,
+  0.551098168f, 0.550457954f, 0.549817502f, 0.549176633f, 0.548535526f,
+  0.547894061f, 0.547252297f, 0.546610177f, 0.545967758f, 0.545324981f,
+  0.544681907f, 0.544038534f, 0.543394804f, 0.542750776f, 0.54210645f,
+  0.541461766f, 0.540816784f, 0.540171444f, 0.539525867f, 0.538879931f,
+  0.538233638f, 0.537587047f, 0.536940157f, 0.53629297f, 0.535645485f,
+  0.534997642f, 0.534349442f, 0.533701003f, 0.533052206f, 0.532403111f,
+  0.531753719f, 0.531104028f, 0.53045398f, 0.529803634f, 0.529152989f,
+  0.528501987f, 0.527850747f, 0.527199149f, 0.526547253f, 0.525895f,
+  0.525242507f, 0.524589658f, 0.52393657f, 0.523283124f, 0.52262938f,
+  0.521975279f, 0.521320939f, 0.520666242f, 0.520011246f, 0.519356012f,
+  0.518700421f, 0.518044531f, 0.517388284f, 0.516731799f, 0.516075015f,
+  0.515417874f, 0.514760435f, 0.514102757f, 0.513444722f, 0.512786388f,
+  0.512127757f, 0.511468828f, 0.5108096f, 0.510150075f, 0.509490252f,
+  0.50883013f, 0.508169711f, 0.507508993f, 0.506847978f, 0.506186664f,
+  0.505525053f, 0.504863083f, 0.504200876f, 0.50353837f, 0.502875566f,
+  0.502212465f, 0.501549065f, 0.500885367f, 0.500221372f, 0.499557108f,
+  0.498892546f, 0.498227656f, 0.497562498f, 0.496897042f, 0.496231288f,
+  0.495565265f, 0.494898945f, 0.494232297f, 0.49356541f, 0.492898196f,
+  0.492230713f, 0.491562903f, 0.490894854f, 0.490226477f, 0.489557832f,
+  0.48888889f, 0.488219678f, 0.487550169f, 0.486880362f, 0.486210287f,
+  0.485539913f, 0.484869242f, 0.484198302f, 0.483527064f, 0.482855558f,
+  0.482183784f, 0.481511682f, 0.480839342f, 0.480166674f, 0.479493767f,
+  0.478820562f, 0.47814706f, 0.477473289f, 0.47679922f, 0.476124883f,
+  0.475450277f, 0.474775374f, 0.474100202f, 0.473424762f, 0.472749025f,
+  0.472073019f, 0.471396744f, 0.470720172f, 0.470043331f, 0.469366223f,
+  0.468688816f, 0.468011141f, 0.467333198f, 0.466654986f, 0.465976506f,
+  0.465297729f, 0.464618683f, 0.463939369f, 0.463259786f, 0.462579936f,
+  0.461899787f, 0.4612194f, 0.460538715f, 0.459857762f, 0.45917654f,
+  0.458495051f, 0.457813293f, 0.457131267f, 0.456448972f, 0.45576641f,
+  0.455083579f, 0.45440048f, 0.453717113f, 0.453033477f, 0.452349573f,
+  0.451665431f, 0.450980991f, 0.450296283f, 0.449611336f, 0.448926091f,
+  0.448240608f, 0.447554857f, 0.446868837f, 0.446182549f, 0.445496023f,
+  0.444809198f, 0.444122136f, 0.443434805f, 0.442747235f, 0.442059368f,
+  0.441371262f, 0.440682888f, 0.439994276f, 0.439305395f, 0.438616246f,
+  0.437926829f, 0.437237173f, 0.43654725f, 0.435857087f, 0.435166657f,
+  0.434475958f, 0.433785021f, 0.433093816f, 0.432402372f, 0.43171066f,
+  0.43101871f, 0.430326492f, 0.429634005f, 0.42894128f, 0.428248316f,
+  0.427555084f, 0.426861614f, 0.426167876f, 0.425473899f, 0.424779683f,
+  0.4240852f, 0.423390478f, 0.422695488f, 0.422000259f, 0.421304792f,
+  0.420609087f, 0.419913113f, 0.419216901f, 0.418520421f, 0.417823702f,
+  0.417126775f, 0.416429549f, 0.415732116f, 0.415034413f, 0.414336503f,
+  0.413638324f, 0.412939876f, 0.41224122f, 0.411542326f, 0.410843164f,
+  0.410143793f, 0.409444153f, 0.408744276f, 0.408044159f, 0.407343805f,
+  0.406643212f, 0.40594238f, 0.405241311f, 0.404540002f, 0.403838456f,
+  0.403136671f, 0.402434647f, 0.401732385f, 0.401029885f, 0.400327176f,
+  0.399624199f, 0.398921013f, 0.398217559f, 0.397513896f, 0.396809995f,
+  0.396105856f, 0.395401478f, 0.394696862f, 0.393992037f, 0.393286973f,
+  0.392581671f, 0.391876131f, 0.391170382f, 0.390464395f, 0.38975817f,
+  0.389051735f, 0.388345033f, 0.387638152f, 0.386931002f, 0.386223644f,
+  0.385516047f, 0.384808242f, 0.384100199f, 0.383391917f, 0.382683426f,
+  0.381974727f, 0.381265759f, 0.380556613f, 0.379847199f, 0.379137605f,
+  0.378427744f, 0.377717704f, 0.377007425f, 0.376296908f, 0.375586182f,
+  0.374875218f, 0.374164075f, 0.373452663f, 0.372741073f, 0.372029245f,
+  0.371317208f, 0.370604932f, 0.369892448f, 0.369179755f, 0.368466824f,
+  0.367753685f, 0.367040336f, 0.366326779f, 0.365612984f, 0.364899009f,
+  0.364184797f, 0.363470376f, 0.362755716f, 0.362040877f, 0.3613258f,
+  0.360610515f, 0.359895051f, 0.359179348f, 0.358463407f, 0.357747287f,
+  0.357030958f, 0.356314421f, 0.355597675f, 0.354880691f, 0.354163527f,
+  0.353446156f, 0.352728546f, 0.352010757f, 0.351292759f, 0.350574553f,
+  0.349856138f, 0.349137515f, 0.348418683f, 0.347699642f, 0.346980423f,
+  0.346260965f, 0.345541328f, 0.344821483f, 0.344101429f, 0.343381166f,
+  0.342660725f, 0.341940075f, 0.341219217f, 0.340498149f, 0.339776874f,
+  0.339055419f, 0.338333756f, 0.337611914f, 0.336889863f, 0.336167604f,
+  0.335445136f, 0.334722489f, 0.333999664f, 0.3332766f, 0.332553357f,
+  0.331829935f, 0.331106305f, 0.330382496f, 0.329658449f, 0.328934252f,
+  0.328209847f, 0.327485234f, 0.326760441f, 0.32603547f, 0.32531029f,
+  0.324584931f, 0.323859364f, 0.323133618f, 0.322407693f, 0.321681559f,
+  0.320955247f, 0.320228726f, 0.319502026f, 0.318775147f, 0.31804809f,
+  0.317320824f, 0.316593379f, 0.315865755f, 0.315137923f, 0.314409941f,
+  0.313681751f, 0.312953383f, 0.312224805f, 0.311496079f, 0.310767144f,
+  0.31003806f, 0.309308767f, 0.308579296f, 0.307849646f, 0.307119817f,
+  0.306389809f, 0.305659592f, 0.304929227f, 0.304198682f, 0.303467959f,
+  0.302737027f, 0.302005947f, 0.301274687f, 0.300543249f, 0.299811631f,
+  0.299079835f, 0.298347861f, 0.297615707f, 0.296883374f, 0.296150893f,
+  0.295418203f, 0.294685364f, 0.293952346f, 0.293219149f, 0.292485803f,
+  0.291752249f, 0.291018546f, 0.290284663f, 0.289550632f, 0.288816422f,
+  0.288082033f, 0.287347466f, 0.286612719f, 0.285877824f, 0.285142779f,
+  0.284407526f, 0.283672124f, 0.282936573f, 0.282200843f, 0.281464934f,
+  0.280728877f, 0.27999264f, 0.279256254f, 0.27851969f, 0.277782977f,
+  0.277046084f, 0.276309043f, 0.275571823f, 0.274834454f, 0.274096906f,
+  0.273359209f, 0.272621363f, 0.271883339f, 0.271145165f, 0.270406812f,
+  0.269668311f, 0.26892966f, 0.268190861f, 0.267451882f, 0.266712755f,
+  0.265973479f, 0.265234023f, 0.264494419f, 0.263754666f, 0.263014764f,
+  0.262274712f, 0.261534482f, 0.260794103f, 0.260053605f, 0.259312928f,
+  0.258572072f, 0.257831097f, 0.257089972f, 0.25634867f, 0.255607247f,
+  0.254865646f, 0.254123926f, 0.253382027f, 0.252640009f, 0.251897812f,
+  0.251155496f, 0.250413001f, 0.249670386f, 0.248927608f, 0.248184681f,
+  0.24744162f, 0.246698409f, 0.24595505f, 0.245211542f, 0.244467899f,
+  0.243724108f, 0.242980182f, 0.242236108f, 0.241491884f, 0.240747526f,
+  0.24000302f, 0.239258379f, 0.238513589f, 0.237768665f, 0.237023607f,
+  0.2362784f, 0.235533059f, 0.234787583f, 0.234041959f, 0.233296201f,
+  0.232550308f, 0.231804281f, 0.231058106f, 0.230311811f, 0.229565367f,
+  0.228818789f, 0.228072077f, 0.227325246f, 0.226578265f, 0.225831151f,
+  0.225083917f, 0.224336535f, 0.223589033f, 0.222841397f, 0.222093627f,
+  0.221345723f, 0.220597684f, 0.219849527f, 0.219101235f, 0.218352824f,
+  0.21760428f, 0.2168556f, 0.216106802f, 0.21535787f, 0.214608818f,
+  0.213859633f, 0.213110313f, 0.212360889f, 0.211611331f, 0.210861638f,
+  0.210111842f, 0.209361911f, 0.208611846f, 0.207861677f, 0.207111374f,
+  0.206360951f, 0.205610409f, 0.204859748f, 0.204108968f, 0.203358069f,
+  0.202607036f, 0.201855898f, 0.201104641f, 0.20035325f, 0.199601755f,
+  0.19885014f, 0.198098406f, 0.197346568f, 0.196594596f, 0.195842519f,
+  0.195090324f, 0.194338009f, 0.19358559f, 0.192833051f, 0.192080393f,
+  0.191327631f, 0.19057475f, 0.189821765f, 0.18906866f, 0.188315451f,
+  0.187562123f, 0.18680869f, 0.186055154f, 0.185301498f, 0.184547737f,
+  0.183793873f, 0.183039889f, 0.182285801f, 0.181531608f, 0.180777311f,
+  0.180022895f, 0.17926839f, 0.178513765f, 0.177759051f, 0.177004218f,
+  0.176249295f, 0.175494254f, 0.174739107f, 0.173983872f, 0.173228532f,
+  0.172473088f, 0.171717539f, 0.170961887f, 0.170206144f, 0.169450298f,
+  0.168694347f, 0.167938292f, 0.167182148f, 0.166425899f, 0.16566956f,
+  0.164913118f, 0.164156586f, 0.16339995f, 0.162643224f, 0.161886394f,
+  0.161129475f, 0.160372451f, 0.159615353f, 0.15885815f, 0.158100843f,
+  0.157343462f, 0.156585976f, 0.155828401f, 0.155070737f, 0.154312968f,
+  0.153555125f, 0.152797192f, 0.152039155f, 0.151281044f, 0.150522828f,
+  0.149764538f, 0.149006143f, 0.148247674f, 0.147489116f, 0.146730468f,
+  0.145971745f, 0.145212919f, 0.144454017f, 0.143695027f, 0.142935961f,
+  0.142176807f, 0.141417563f, 0.140658244f, 0.139898837f, 0.139139339f,
+  0.138379768f, 0.137620121f, 0.136860386f, 0.136100575f, 0.135340676f,
+  0.134580702f, 0.133820653f, 0.13306053f, 0.132300317f, 0.13154003f,
+  0.130779669f, 0.130019218f, 0.129258707f, 0.128498107f, 0.127737448f,
+  0.126976699f, 0.126215875f, 0.125454977f, 0.12469402f, 0.123932973f,
+  0.123171858f, 0.122410677f, 0.121649414f, 0.120888084f, 0.120126687f,
+  0.119365215f, 0.118603677f, 0.117842063f, 0.117080383f, 0.116318628f,
+  0.115556814f, 0.114794925f, 0.114032976f, 0.113270953f, 0.112508863f,
+  0.111746714f, 0.110984489f, 0.110222206f, 0.109459855f, 0.108697444f,
+  0.107934967f, 0.107172422f, 0.106409818f, 0.105647154f, 0.104884423f,
+  0.104121633f, 0.103358783f, 0.102595866f, 0.101832896f, 0.10106986f,
+  0.100306772f, 0.0995436162f, 0.0987804085f, 0.0980171412f, 0.0972538143f,
+  0.0964904279f, 0.0957269892f, 0.0949634984f, 0.0941999406f, 0.093436338f,
+  0.0926726758f, 0.0919089541f, 0.0911451876f, 0.0903813615f, 0.0896174833f,
+  0.0888535529f, 0.0880895704f, 0.0873255357f, 0.0865614489f, 0.0857973099f,
+  0.0850331262f, 0.0842688903f, 0.0835046023f, 0.0827402622f, 0.0819758773f,
+  0.0812114477f, 0.080446966f, 0.0796824396f, 0.078917861f, 0.0781532452f,
+  0.0773885772f, 0.0766238645f, 0.0758591071f, 0.0750942975f, 0.0743294507f,
+  0.0735645667f, 0.0727996305f, 0.0720346496f, 0.0712696314f, 0.070504576f,
+  0.0697394684f, 0.068974331f, 0.0682091415f, 0.0674439222f, 0.0666786581f,
+  0.0659133494f, 0.0651480108f, 0.0643826276f, 0.0636172146f, 0.0628517568f,
+  0.0620862655f, 0.061320737f, 0.0605551712f, 0.0597895719f, 0.0590239353f,
+  0.0582582653f, 0.0574925579f, 0.0567268208f, 0.0559610501f, 0.0551952459f,
+  0.0544294082f, 0.0536635369f, 0.0528976358f, 0.052131705f, 0.0513657406f,
+  0.0505997501f, 0.0498337261f, 0.0490676761f, 0.0483015925f, 0.0475354828f,
+  0.046769347f, 0.0460031815f, 0.0452369899f, 0.0444707721f, 0.0437045284f,
+  0.0429382585f, 0.0421719626f, 0.0414056405f, 0.0406392962f, 0.0398729257f,
+  0.0391065367f, 0.0383401215f, 0.037573684f, 0.0368072242f, 0.036040742f,
+  0.0352742374f, 0.0345077142f, 0.0337411724f, 0.0329746082f, 0.0322080255f,
+  0.031441424f, 0.030674804f, 0.0299081653f, 0.029141508f, 0.0283748358f,
+  0.027608145f, 0.0268414393f, 0.0260747187f, 0.0253079813f, 0.024541229f,
+  0.0237744618f, 0.0230076816f, 0.0222408883f, 0.0214740802f, 0.0207072608f,
+  0.0199404284f, 0.0191735849f, 0.0184067301f, 0.0176398642f, 0.0168729872f,
+  0.0161061026f, 0.015339206f, 0.0145723019f, 0.0138053885f, 0.0130384676f,
+  0.0122715384f, 0.0115046017f, 0.0107376594f, 0.00997070968f, 0.00920375437f,
+  0.00843679439f, 0.00766982883f, 0.00690285861f, 0.00613588467f, 0.005368907f,
+  0.00460192608f, 0.00383494259f, 0.00306795677f, 0.00230096909f, 0.00153398013f,
+  0.000766990299f, 0.f, -0.000766990299f, -0.00153398013f, -0.00230096909f,
+  -0.00306795677f, -0.00383494259f, -0.00460192608f, -0.005368907f, -0.00613588467f,
+  -0.00690285861f, -0.00766982883f, -0.00843679439f, -0.00920375437f, -0.00997070968f,
+  -0.0107376594f, -0.0115046017f, -0.0122715384f, -0.0130384676f, -0.0138053885f,
+  -0.0145723019f, -0.015339206f, -0.0161061026f, -0.0168729872f, -0.0176398642f,
+  -0.0184067301f, -0.0191735849f, -0.0199404284f, -0.0207072608f, -0.0214740802f,
+  -0.0222408883f, -0.0230076816f, -0.0237744618f, -0.024541229f, -0.0253079813f,
+  -0.0260747187f, -0.0268414393f, -0.027608145f, -0.0283748358f, -0.029141508f,
+  -0.0299081653f, -0.030674804f, -0.031441424f, -0.0322080255f, -0.0329746082f,
+  -0.0337411724f, -0.0345077142f, -0.0352742374f, -0.036040742f, -0.0368072242f,
+  -0.037573684f, -0.0383401215f, -0.0391065367f, -0.0398729257f, -0.0406392962f,
+  -0.0414056405f, -0.0421719626f, -0.0429382585f, -0.0437045284f, -0.0444707721f,
+  -0.0452369899f, -0.0460031815f, -0.046769347f, -0.0475354828f, -0.0483015925f,
+  -0.0490676761f, -0.0498337261f, -0.0505997501f, -0.0513657406f, -0.052131705f,
+  -0.0528976358f, -0.0536635369f, -0.0544294082f, -0.0551952459f, -0.0559610501f,
+  -0.0567268208f, -0.0574925579f, -0.0582582653f, -0.0590239353f, -0.0597895719f,
+  -0.0605551712f, -0.061320737f, -0.0620862655f, -0.0628517568f, -0.0636172146f,
+  -0.0643826276f, -0.0651480108f, -0.0659133494f, -0.0666786581f, -0.0674439222f,
+  -0.0682091415f, -0.068974331f, -0.0697394684f, -0.070504576f, -0.0712696314f,
+  -0.0720346496f, -0.0727996305f, -0.0735645667f, -0.0743294507f, -0.0750942975f,
+  -0.0758591071f, -0.0766238645f, -0.0773885772f, -0.0781532452f, -0.078917861f,
+  -0.0796824396f, -0.080446966f, -0.0812114477f, -0.0819758773f, -0.0827402622f,
+  -0.0835046023f, -0.0842688903f, -0.0850331262f, -0.0857973099f, -0.0865614489f,
+  -0.0873255357f, -0.0880895704f, -0.0888535529f, -0.0896174833f, -0.0903813615f,
+  -0.0911451876f, -0.0919089541f, -0.0926726758f, -0.093436338f, -0.0941999406f,
+  -0.0949634984f, -0.0957269892f, -0.0964904279f, -0.0972538143f, -0.0980171412f,
+  -0.0987804085f, -0.0995436162f, -0.100306772f, -0.10106986f, -0.101832896f,
+  -0.102595866f, -0.103358783f, -0.104121633f, -0.104884423f, -0.105647154f,
+  -0.106409818f, -0.107172422f, -0.107934967f, -0.108697444f, -0.109459855f,
+  -0.110222206f, -0.110984489f, -0.111746714f, -0.112508863f, -0.113270953f,
+  -0.114032976f, -0.114794925f, -0.115556814f, -0.116318628f, -0.117080383f,
+  -0.117842063f, -0.118603677f, -0.119365215f, -0.120126687f, -0.120888084f,
+  -0.121649414f, -0.122410677f, -0.123171858f, -0.123932973f, -0.12469402f,
+  -0.125454977f, -0.126215875f, -0.126976699f, -0.127737448f, -0.128498107f,
+  -0.129258707f, -0.130019218f, -0.130779669f, -0.13154003f, -0.132300317f,
+  -0.13306053f, -0.133820653f, -0.134580702f, -0.135340676f, -0.136100575f,
+  -0.136860386f, -0.137620121f, -0.138379768f, -0.139139339f, -0.139898837f,
+  -0.140658244f, -0.141417563f, -0.142176807f, -0.142935961f, -0.143695027f,
+  -0.144454017f, -0.145212919f, -0.145971745f, -0.146730468f, -0.147489116f,
+  -0.148247674f, -0.149006143f, -0.149764538f, -0.150522828f, -0.151281044f,
+  -0.152039155f, -0.152797192f, -0.153555125f, -0.154312968f, -0.155070737f,
+  -0.155828401f, -0.156585976f, -0.157343462f, -0.158100843f, -0.15885815f,
+  -0.159615353f, -0.160372451f, -0.161129475f, -0.161886394f, -0.162643224f,
+  -0.16339995f, -0.164156586f, -0.164913118f, -0.16566956f, -0.166425899f,
+  -0.167182148f, -0.167938292f, -0.168694347f, -0.169450298f, -0.170206144f,
+  -0.170961887f, -0.171717539f, -0.172473088f, -0.173228532f, -0.173983872f,
+  -0.174739107f, -0.175494254f, -0.176249295f, -0.177004218f, -0.177759051f,
+  -0.178513765f, -0.17926839f, -0.180022895f, -0.180777311f, -0.181531608f,
+  -0.182285801f, -0.183039889f, -0.183793873f, -0.184547737f, -0.185301498f,
+  -0.186055154f, -0.18680869f, -0.187562123f, -0.188315451f, -0.18906866f,
+  -0.189821765f, -0.19057475f, -0.191327631f, -0.192080393f, -0.192833051f,
+  -0.19358559f, -0.194338009f, -0.195090324f, -0.195842519f, -0.196594596f,
+  -0.197346568f, -0.198098406f, -0.19885014f, -0.199601755f, -0.20035325f,
+  -0.201104641f, -0.201855898f, -0.202607036f, -0.203358069f, -0.204108968f,
+  -0.204859748f, -0.205610409f, -0.206360951f, -0.207111374f, -0.207861677f,
+  -0.208611846f, -0.209361911f, -0.210111842f, -0.210861638f, -0.211611331f,
+  -0.212360889f, -0.213110313f, -0.213859633f, -0.214608818f, -0.21535787f,
+  -0.216106802f, -0.2168556f, -0.21760428f, -0.218352824f, -0.219101235f,
+  -0.219849527f, -0.220597684f, -0.221345723f, -0.222093627f, -0.222841397f,
+  -0.223589033f, -0.224336535f, -0.225083917f, -0.225831151f, -0.226578265f,
+  -0.227325246f, -0.228072077f, -0.228818789f, -0.229565367f, -0.230311811f,
+  -0.231058106f, -0.231804281f, -0.232550308f, -0.233296201f, -0.234041959f,
+  -0.234787583f, -0.235533059f, -0.2362784f, -0.237023607f, -0.237768665f,
+  -0.238513589f, -0.239258379f, -0.24000302f, -0.240747526f, -0.241491884f,
+  -0.242236108f, -0.242980182f, -0.243724108f, -0.244467899f, -0.245211542f,
+  -0.24595505f, -0.246698409f, -0.24744162f, -0.248184681f, -0.248927608f,
+  -0.249670386f, -0.250413001f, -0.251155496f, -0.251897812f, -0.252640009f,
+  -0.253382027f, -0.254123926f, -0.254865646f, -0.255607247f, -0.25634867f,
+  -0.257089972f, -0.257831097f, -0.258572072f, -0.259312928f, -0.260053605f,
+  -0.260794103f, -0.261534482f, -0.262274712f, -0.263014764f, -0.263754666f,
+  -0.264494419f, -0.265234023f, -0.265973479f, -0.266712755f, -0.267451882f,
+  -0.268190861f, -0.26892966f, -0.269668311f, -0.270406812f, -0.271145165f,
+  -0.271883339f, -0.272621363f, -0.273359209f, -0.274096906f, -0.274834454f,
+  -0.275571823f, -0.276309043f, -0.277046084f, -0.277782977f, -0.27851969f,
+  -0.279256254f, -0.27999264f, -0.280728877f, -0.281464934f, -0.282200843f,
+  -0.282936573f, -0.283672124f, -0.284407526f, -0.285142779f, -0.285877824f,
+  -0.286612719f, -0.287347466f, -0.288082033f, -0.288816422f, -0.289550632f,
+  -0.290284663f, -0.291018546f, -0.291752249f, -0.292485803f, -0.293219149f,
+  -0.293952346f, -0.294685364f, -0.295418203f, -0.296150893f, -0.296883374f,
+  -0.297615707f, -0.298347861f, -0.299079835f, -0.299811631f, -0.300543249f,
+  -0.301274687f, -0.302005947f, -0.302737027f, -0.303467959f, -0.304198682f,
+  -0.304929227f, -0.305659592f, -0.306389809f, -0.307119817f, -0.307849646f,
+  -0.308579296f, -0.309308767f, -0.31003806f, -0.310767144f, -0.311496079f,
+  -0.312224805f, -0.312953383f, -0.313681751f, -0.314409941f, -0.315137923f,
+  -0.315865755f, -0.316593379f, -0.317320824f, -0.31804809f, -0.318775147f,
+  -0.319502026f, -0.320228726f, -0.320955247f, -0.321681559f, -0.322407693f,
+  -0.323133618f, -0.323859364f, -0.324584931f, -0.32531029f, -0.32603547f,
+  -0.326760441f, -0.327485234f, -0.328209847f, -0.328934252f, -0.329658449f,
+  -0.330382496f, -0.331106305f, -0.331829935f, -0.332553357f, -0.3332766f,
+  -0.333999664f, -0.334722489f, -0.335445136f, -0.336167604f, -0.336889863f,
+  -0.337611914f, -0.338333756f, -0.339055419f, -0.339776874f, -0.340498149f,
+  -0.341219217f, -0.341940075f, -0.342660725f, -0.343381166f, -0.344101429f,
+  -0.344821483f, -0.345541328f, -0.346260965f, -0.346980423f, -0.347699642f,
+  -0.348418683f, -0.349137515f, -0.349856138f, -0.350574553f, -0.351292759f,
+  -0.352010757f, -0.352728546f, -0.353446156f, -0.354163527f, -0.354880691f,
+  -0.355597675f, -0.356314421f, -0.357030958f, -0.357747287f, -0.358463407f,
+  -0.359179348f, -0.359895051f, -0.360610515f, -0.3613258f, -0.362040877f,
+  -0.362755716f, -0.363470376f, -0.364184797f, -0.364899009f, -0.365612984f,
+  -0.366326779f, -0.367040336f, -0.367753685f, -0.368466824f, -0.369179755f,
+  -0.369892448f, -0.370604932f, -0.371317208f, -0.372029245f, -0.372741073f,
+  -0.373452663f, -0.374164075f, -0.374875218f, -0.375586182f, -0.376296908f,
+  -0.377007425f, -0.377717704f, -0.378427744f, -0.379137605f, -0.379847199f,
+  -0.380556613f, -0.381265759f, -0.381974727f, -0.382683426f, -0.383391917f,
+  -0.384100199f, -0.384808242f, -0.385516047f, -0.386223644f, -0.386931002f,
+  -0.387638152f, -0.388345033f, -0.389051735f, -0.38975817f, -0.390464395f,
+  -0.391170382f, -0.391876131f, -0.392581671f, -0.393286973f, -0.393992037f,
+  -0.394696862f, -0.395401478f, -0.396105856f, -0.396809995f, -0.397513896f,
+  -0.398217559f, -0.398921013f, -0.399624199f, -0.400327176f, -0.401029885f,
+  -0.401732385f, -0.402434647f, -0.403136671f, -0.403838456f, -0.404540002f,
+  -0.405241311f, -0.40594238f, -0.406643212f, -0.407343805f, -0.408044159f,
+  -0.408744276f, -0.409444153f, -0.410143793f, -0.410843164f, -0.411542326f,
+  -0.41224122f, -0.412939876f, -0.413638324f, -0.414336503f, -0.415034413f,
+  -0.415732116f, -0.416429549f, -0.417126775f, -0.417823702f, -0.418520421f,
+  -0.419216901f, -0.419913113f, -0.420609087f, -0.421304792f, -0.422000259f,
+  -0.422695488f, -0.423390478f, -0.4240852f, -0.424779683f, -0.425473899f,
+  -0.426167876f, -0.426861614f, -0.427555084f, -0.428248316f, -0.42894128f,
+  -0.429634005f, -0.430326492f, -0.43101871f, -0.43171066f, -0.432402372f,
+  -0.433093816f, -0.433785021f, -0.434475958f, -0.435166657f, -0.435857087f,
+  -0.43654725f, -0.437237173f, -0.437926829f, -0.438616246f, -0.439305395f,
+  -0.439994276f, -0.440682888f, -0.441371262f, -0.442059368f, -0.442747235f,
+  -0.443434805f, -0.444122136f, -0.444809198f, -0.445496023f, -0.446182549f,
+  -0.446868837f, -0.447554857f, -0.448240608f, -0.448926091f, -0.449611336f,
+  -0.450296283f, -0.450980991f, -0.451665431f, -0.452349573f, -0.453033477f,
+  -0.453717113f, -0.45440048f, -0.455083579f, -0.45576641f, -0.456448972f,
+  -0.457131267f, -0.457813293f, -0.458495051f, -0.45917654f, -0.459857762f,
+  -0.460538715f, -0.4612194f, -0.461899787f, -0.462579936f, -0.463259786f,
+  -0.463939369f, -0.464618683f, -0.465297729f, -0.465976506f, -0.466654986f,
+  -0.467333198f, -0.468011141f, -0.468688816f, -0.469366223f, -0.470043331f,
+  -0.470720172f, -0.471396744f, -0.472073019f, -0.472749025f, -0.473424762f,
+  -0.474100202f, -0.474775374f, -0.475450277f, -0.476124883f, -0.47679922f,
+  -0.477473289f, -0.47814706f, -0.478820562f, -0.479493767f, -0.480166674f,
+  -0.480839342f, -0.481511682f, -0.482183784f, -0.482855558f, -0.483527064f,
+  -0.484198302f, -0.484869242f, -0.485539913f, -0.486210287f, -0.486880362f,
+  -0.487550169f, -0.488219678f, -0.48888889f, -0.489557832f, -0.490226477f,
+  -0.490894854f, -0.491562903f, -0.492230713f, -0.492898196f, -0.49356541f,
+  -0.494232297f, -0.494898945f, -0.495565265f, -0.496231288f, -0.496897042f,
+  -0.497562498f, -0.498227656f, -0.498892546f, -0.499557108f, -0.500221372f,
+  -0.500885367f, -0.501549065f, -0.502212465f, -0.502875566f, -0.50353837f,
+  -0.504200876f, -0.504863083f, -0.505525053f, -0.506186664f, -0.506847978f,
+  -0.507508993f, -0.508169711f, -0.50883013f, -0.509490252f, -0.510150075f,
+  -0.5108096f, -0.511468828f, -0.512127757f, -0.512786388f, -0.513444722f,
+  -0.514102757f, -0.514760435f, -0.515417874f, -0.516075015f, -0.516731799f,
+  -0.517388284f, -0.518044531f, -0.518700421f, -0.519356012f, -0.520011246f,
+  -0.520666242f, -0.521320939f, -0.521975279f, -0.52262938f, -0.523283124f,
+  -0.52393657f, -0.524589658f, -0.525242507f, -0.525895f, -0.526547253f,
+  -0.527199149f, -0.527850747f, -0.528501987f, -0.529152989f, -0.529803634f,
+  -0.53045398f, -0.531104028f, -0.531753719f, -0.532403111f, -0.533052206f,
+  -0.533701003f, -0.534349442f, -0.534997642f, -0.535645485f, -0.53629297f,
+  -0.536940157f, -0.537587047f, -0.538233638f, -0.538879931f, -0.539525867f,
+  -0.540171444f, -0.540816784f, -0.541461766f, -0.54210645f, -0.542750776f,
+  -0.543394804f, -0.544038534f, -0.544681907f, -0.545324981f, -0.545967758f,
+  -0.546610177f, -0.547252297f, -0.547894061f, -0.548535526f, -0.549176633f,
+  -0.549817502f, -0.550457954f, -0.551098168f, -0.551737964f, -0.552377522f,
+  -0.553016722f, -0.553655565f, -0.554294109f, -0.554932356f, -0.555570245f,
+  -0.556207776f, -0.556845009f, -0.557481945f, -0.558118522f, -0.558754802f,
+  -0.559390724f, -0.560026288f, -0.560661554f, -0.561296523f, -0.561931133f,
+  -0.562565386f, -0.563199341f, -0.563832939f, -0.564466238f, -0.56509918f,
+  -0.565731823f, -0.56636411f, -0.566996038f, -0.567627668f, -0.568258941f,
+  -0.568889916f, -0.569520533f, -0.570150793f, -0.570780754f, -0.571410358f,
+  -0.572039604f, -0.572668552f, -0.573297143f, -0.573925436f, -0.57455337f,
+  -0.575180948f, -0.575808167f, -0.576435089f, -0.577061653f, -0.577687919f,
+  -0.578313768f, -0.578939319f, -0.579564571f, -0.580189407f, -0.580813944f,
+  -0.581438124f, -0.582062006f, -0.582685471f, -0.583308637f, -0.583931446f,
+  -0.584553957f, -0.585176051f, -0.585797846f, -0.586419284f, -0.587040365f,
+  -0.587661147f, -0.588281572f, -0.588901579f, -0.589521289f, -0.5901407f,
+  -0.590759695f, -0.591378391f, -0.59199667f, -0.592614651f, -0.593232274f,
+  -0.593849599f, -0.594466507f, -0.595083058f, -0.59569931f, -0.596315205f,
+  -0.596930683f, -0.597545862f, -0.598160684f, -0.598775208f, -0.599389315f,
+  -0.600003064f, -0.600616455f, -0.601229548f, -0.601842225f, -0.602454603f,
+  -0.603066623f, -0.603678226f, -0.604289532f, -0.604900479f, -0.605511069f,
+  -0.606121242f, -0.606731117f, -0.607340634f, -0.607949793f, -0.608558595f,
+  -0.609167039f, -0.609775066f, -0.610382795f, -0.610990167f, -0.61159718f,
+  -0.612203777f, -0.612810075f, -0.613416016f, -0.61402154f, -0.614626765f,
+  -0.615231574f, -0.615836084f, -0.616440177f, -0.617043912f, -0.61764729f,
+  -0.61825031f, -0.618852973f, -0.619455278f, -0.620057225f, -0.620658755f,
+  -0.621259987f, -0.621860802f, -0.622461259f, -0.623061359f, -0.623661101f,
+  -0.624260485f, -0.624859512f, -0.625458121f, -0.626056373f, -0.626654267f,
+  -0.627251804f, -0.627848983f, -0.628445745f, -0.629042208f, -0.629638255f,
+  -0.630233943f, -0.630829215f, -0.631424189f, -0.632018745f, -0.632612944f,
+  -0.633206785f, -0.633800209f, -0.634393275f, -0.634985983f, -0.635578334f,
+  -0.636170268f, -0.636761844f, -0.637353063f, -0.637943923f, -0.638534367f,
+  -0.639124453f, -0.639714181f, -0.640303493f, -0.640892446f, -0.641481042f,
+  -0.642069221f, -0.642657042f, -0.643244505f, -0.643831551f, -0.64441824f,
+  -0.645004511f, -0.645590484f, -0.64617604f, -0.646761179f, -0.64734596f,
+  -0.647930384f, -0.64851439f, -0.649098039f, -0.64968133f, -0.650264204f,
+  -0.65084666f, -0.651428819f, -0.65201056f, -0.652591884f, -0.653172851f,
+  -0.6537534f, -0.654333591f, -0.654913425f, -0.655492842f, -0.656071901f,
+  -0.656650543f, -0.657228827f, -0.657806695f, -0.658384204f, -0.658961296f,
+  -0.659538031f, -0.660114348f, -0.660690308f, -0.66126585f, -0.661840975f,
+  -0.662415802f, -0.662990153f, -0.663564146f, -0.664137781f, -0.664710999f,
+  -0.665283799f, -0.665856242f, -0.666428268f, -0.666999936f, -0.667571187f,
+  -0.668142021f, -0.668712497f, -0.669282615f, -0.669852257f, -0.670421541f,
+  -0.670990467f, -0.671558976f, -0.672127068f, -0.672694743f, -0.67326206f,
+  -0.673829019f, -0.674395502f, -0.674961627f, -0.675527394f, -0.676092684f,
+  -0.676657617f, -0.677222192f, -0.677786291f, -0.678350031f, -0.678913355f,
+  -0.679476321f, -0.680038869f, -0.680601001f, -0.681162715f, -0.681724072f,
+  -0.682285011f, -0.682845533f, -0.683405697f, -0.683965385f, -0.684524715f,
+  -0.685083687f, -0.685642183f, -0.686200321f, -0.686758041f, -0.687315345f,
+  -0.687872231f, -0.68842876f, -0.688984871f, -0.689540565f, -0.690095842f,
+  -0.690650702f, -0.691205204f, -0.691759229f, -0.692312896f, -0.692866147f,
+  -0.693419039f, -0.693971455f, -0.694523513f, -0.695075095f, -0.695626318f,
+  -0.696177125f, -0.696727514f, -0.697277486f, -0.697827101f, -0.698376238f,
+  -0.698925018f, -0.699473321f, -0.700021267f, -0.700568795f, -0.701115906f,
+  -0.7016626f, -0.702208877f, -0.702754736f, -0.703300178f, -0.703845263f,
+  -0.70438987f, -0.704934061f, -0.705477893f, -0.706021249f, -0.706564248f,
+  -0.707106769f, -0.707648933f, -0.70819062f, -0.708731949f, -0.709272802f,
+  -0.709813297f, -0.710353374f, -0.710892975f, -0.711432219f, -0.711970985f,
+  -0.712509394f, -0.713047326f, -0.71358484f, -0.714121997f, -0.714658678f,
+  -0.715194941f, -0.715730846f, -0.716266274f, -0.716801286f, -0.71733588f,
+  -0.717870057f, -0.718403816f, -0.718937099f, -0.719470024f, -0.720002532f,
+  -0.720534563f, -0.721066177f, -0.721597433f, -0.722128212f, -0.722658575f,
+  -0.72318846f, -0.723717988f, -0.724247098f, -0.724775732f, -0.725303948f,
+  -0.725831807f, -0.726359129f, -0.726886094f, -0.727412641f, -0.727938712f,
+  -0.728464365f, -0.728989601f, -0.72951442f, -0.730038822f, -0.730562747f,
+  -0.731086314f, -0.731609404f, -0.732132018f, -0.732654274f, -0.733176053f,
+  -0.733697414f, -0.734218359f, -0.734738886f, -0.735258937f, -0.73577857f,
+  -0.736297786f, -0.736816585f, -0.737334907f, -0.737852812f, -0.738370299f,
+  -0.73888731f, -0.739403903f, -0.73992008f, -0.740435839f, -0.740951121f,
+  -0.741465986f, -0.741980433f, -0.742494404f, -0.743007958f, -0.743521094f,
+  -0.744033754f, -0.744545996f, -0.745057762f, -0.74556917f, -0.746080101f,
+  -0.746590555f, -0.747100592f, -0.747610211f, -0.748119354f, -0.74862808f,
+  -0.749136388f, -0.74964422f, -0.750151634f, -0.750658631f, -0.751165152f,
+  -0.751671195f, -0.752176821f, -0.75268203f, -0.753186822f, -0.753691137f,
+  -0.754194975f, -0.754698396f, -0.755201399f, -0.755703926f, -0.756205976f,
+  -0.756707668f, -0.757208824f, -0.757709622f, -0.758209884f, -0.758709788f,
+  -0.759209216f, -0.759708166f, -0.760206699f, -0.760704756f, -0.761202395f,
+  -0.761699557f, -0.762196302f, -0.762692571f, -0.763188422f, -0.763683796f,
+  -0.764178753f, -0.764673233f, -0.765167236f, -0.765660882f, -0.766153991f,
+  -0.766646683f, -0.767138898f, -0.767630696f, -0.768122017f, -0.768612921f,
+  -0.769103348f, -0.769593298f, -0.770082831f, -0.770571887f, -0.771060526f,
+  -0.771548688f, -0.772036374f, -0.772523642f, -0.773010433f, -0.773496807f,
+  -0.773982704f, -0.774468124f, -0.774953127f, -0.775437653f, -0.775921702f,
+  -0.776405334f, -0.77688849f, -0.777371168f, -0.777853429f, -0.778335214f,
+  -0.778816521f, -0.779297352f, -0.779777765f, -0.780257761f, -0.780737221f,
+  -0.781216264f, -0.781694829f, -0.782172918f, -0.78265059f, -0.783127785f,
+  -0.783604503f, -0.784080803f, -0.784556568f, -0.785031915f, -0.785506845f,
+  -0.785981238f, -0.786455214f, -0.786928713f, -0.787401736f, -0.787874341f,
+  -0.78834641f, -0.788818061f, -0.789289236f, -0.789759994f, -0.790230215f,
+  -0.790700018f, -0.791169345f, -0.791638196f, -0.792106569f, -0.792574525f,
+  -0.793041945f, -0.793508947f, -0.793975472f, -0.794441521f, -0.794907153f,
+  -0.795372248f, -0.795836926f, -0.796301067f, -0.796764791f, -0.797228038f,
+  -0.797690868f, -0.798153162f, -0.798614979f, -0.799076378f, -0.799537241f,
+  -0.799997687f, -0.800457656f, -0.800917149f, -0.801376164f, -0.801834702f,
+  -0.802292824f, -0.802750409f, -0.803207517f, -0.803664207f, -0.804120362f,
+  -0.804576099f, -0.805031359f, -0.805486083f, -0.80594039f, -0.806394219f,
+  -0.806847572f, -0.807300448f, -0.807752848f, -0.80820471f, -0.808656156f,
+  -0.809107125f, -0.809557617f, -0.810007632f, -0.81045717f, -0.810906231f,
+  -0.811354876f, -0.811802983f, -0.812250614f, -0.812697768f, -0.813144386f,
+  -0.813590586f, -0.81403631f, -0.814481556f, -0.814926326f, -0.815370619f,
+  -0.815814435f, -0.816257715f, -0.816700578f, -0.817142904f, -0.817584813f,
+  -0.818026185f, -0.81846714f, -0.818907559f, -0.819347501f, -0.819786966f,
+  -0.820225954f, -0.820664465f, -0.8211025f, -0.821540058f, -0.821977139f,
+  -0.822413683f, -0.82284981f, -0.823285401f, -0.823720515f, -0.824155152f,
+  -0.824589312f, -0.825022995f, -0.825456142f, -0.825888872f, -0.826321065f,
+  -0.826752782f, -0.827184021f, -0.827614784f, -0.82804507f, -0.82847482f,
+  -0.828904092f, -0.829332948f, -0.829761207f, -0.830189049f, -0.830616415f,
+  -0.831043243f, -0.831469595f, -0.831895471f, -0.832320869f, -0.83274579f,
+  -0.833170176f, -0.833594084f, -0.834017515f, -0.83444041f, -0.834862888f,
+  -0.835284829f, -0.835706294f, -0.836127281f, -0.836547732f, -0.836967707f,
+  -0.837387204f, -0.837806225f, -0.838224709f, -0.838642716f, -0.839060247f,
+  -0.839477241f, -0.839893818f, -0.840309858f, -0.840725362f, -0.841140449f,
+  -0.841554999f, -0.841969013f, -0.84238261f, -0.84279567f, -0.843208253f,
+  -0.8436203f, -0.84403187f, -0.844442964f, -0.84485358f, -0.84526366f,
+  -0.845673263f, -0.84608233f, -0.84649092f, -0.846899033f, -0.847306609f,
+  -0.847713768f, -0.848120332f, -0.848526478f, -0.848932028f, -0.849337161f,
+  -0.849741757f, -0.850145876f, -0.850549459f, -0.850952566f, -0.851355195f,
+  -0.851757288f, -0.852158904f, -0.852559984f, -0.852960587f, -0.853360713f,
+  -0.853760302f, -0.854159415f, -0.854557991f, -0.85495609f, -0.855353653f,
+  -0.85575074f, -0.856147349f, -0.856543422f, -0.856938958f, -0.857334018f,
+  -0.857728601f, -0.858122647f, -0.858516216f, -0.858909249f, -0.859301805f,
+  -0.859693885f, -0.860085368f, -0.860476434f, -0.860866964f, -0.861256957f,
+  -0.861646473f, -0.862035453f, -0.862423956f, -0.862811923f, -0.863199413f,
+  -0.863586366f, -0.863972843f, -0.864358783f, -0.864744246f, -0.865129173f,
+  -0.865513623f, -0.865897536f, -0.866280973f, -0.866663873f, -0.867046237f,
+  -0.867428124f, -0.867809474f, -0.868190348f, -0.868570685f, -0.868950546f,
+  -0.86932987f, -0.869708657f, -0.870086968f, -0.870464802f, -0.87084204f,
+  -0.87121886f, -0.871595085f, -0.871970832f, -0.872346044f, -0.872720778f,
+  -0.873094976f, -0.873468697f, -0.873841822f, -0.87421453f, -0.874586642f,
+  -0.874958277f, -0.875329375f, -0.875699997f, -0.876070082f, -0.876439691f,
+  -0.876808703f, -0.877177238f, -0.877545297f, -0.877912819f, -0.878279805f,
+  -0.878646255f, -0.879012227f, -0.879377663f, -0.879742622f, -0.880106986f,
+  -0.880470872f, -0.880834281f, -0.881197095f, -0.881559432f, -0.881921291f,
+  -0.882282555f, -0.882643342f, -0.883003592f, -0.883363366f, -0.883722544f,
+  -0.884081244f, -0.884439468f, -0.884797096f, -0.885154247f, -0.885510862f,
+  -0.88586694f, -0.886222541f, -0.886577606f, -0.886932135f, -0.887286127f,
+  -0.887639642f, -0.887992561f, -0.888345063f, -0.888696969f, -0.889048338f,
+  -0.88939923f, -0.889749587f, -0.890099406f, -0.890448749f, -0.890797496f,
+  -0.891145766f, -0.891493499f, -0.891840696f, -0.892187417f, -0.892533541f,
+  -0.892879188f, -0.893224299f, -0.893568873f, -0.893912971f, -0.894256473f,
+  -0.894599497f, -0.894941986f, -0.895283937f, -0.895625353f, -0.895966232f,
+  -0.896306634f, -0.8966465f, -0.896985769f, -0.897324562f, -0.897662818f,
+  -0.898000598f, -0.898337781f, -0.898674488f, -0.899010599f, -0.899346232f,
+  -0.89968133f, -0.900015891f, -0.900349915f, -0.900683403f, -0.901016414f,
+  -0.901348829f, -0.901680768f, -0.902012169f, -0.902342975f, -0.902673304f,
+  -0.903003097f, -0.903332353f, -0.903661072f, -0.903989315f, -0.904316962f,
+  -0.904644072f, -0.904970706f, -0.905296743f, -0.905622303f, -0.905947268f,
+  -0.906271756f, -0.906595707f, -0.906919122f, -0.907242f, -0.907564342f,
+  -0.907886088f, -0.908207357f, -0.90852809f, -0.908848345f, -0.909168005f,
+  -0.909487128f, -0.909805715f, -0.910123765f, -0.910441279f, -0.910758257f,
+  -0.911074758f, -0.911390662f, -0.91170603f, -0.912020862f, -0.912335157f,
+  -0.912648976f, -0.912962198f, -0.913274884f, -0.913587034f, -0.913898647f,
+  -0.914209783f, -0.914520323f, -0.914830327f, -0.915139794f, -0.915448725f,
+  -0.91575712f, -0.916064978f, -0.916372299f, -0.916679084f, -0.916985273f,
+  -0.917290986f, -0.917596161f, -0.917900801f, -0.918204844f, -0.91850841f,
+  -0.918811381f, -0.919113874f, -0.919415772f, -0.919717133f, -0.920017958f,
+  -0.920318305f, -0.920618057f, -0.920917213f, -0.921215892f, -0.921514034f,
+  -0.92181164f, -0.92210865f, -0.922405183f, -0.92270112f, -0.922996521f,
+  -0.923291445f, -0.923585773f, -0.923879504f, -0.924172759f, -0.924465477f,
+  -0.9247576f, -0.925049245f, -0.925340295f, -0.925630808f, -0.925920784f,
+  -0.926210225f, -0.926499128f, -0.926787496f, -0.927075267f, -0.927362502f,
+  -0.92764926f, -0.927935421f, -0.928220987f, -0.928506076f, -0.928790629f,
+  -0.929074585f, -0.929358006f, -0.929640889f, -0.929923236f, -0.930205047f,
+  -0.930486262f, -0.93076694f, -0.931047082f, -0.931326687f, -0.931605756f,
+  -0.931884289f, -0.932162225f, -0.932439625f, -0.932716489f, -0.932992816f,
+  -0.933268547f, -0.933543801f, -0.93381846f, -0.934092522f, -0.934366107f,
+  -0.934639156f, -0.934911609f, -0.935183525f, -0.935454845f, -0.935725689f,
+  -0.935995936f, -0.936265647f, -0.936534822f, -0.93680346f, -0.937071502f,
+  -0.937339008f, -0.937605977f, -0.93787235f, -0.938138247f, -0.938403547f,
+  -0.938668311f, -0.938932478f, -0.93919611f, -0.939459205f, -0.939721763f,
+  -0.939983726f, -0.940245211f, -0.940506041f, -0.940766394f, -0.941026151f,
+  -0.941285372f, -0.941544056f, -0.941802204f, -0.942059755f, -0.942316771f,
+  -0.94257319f, -0.942829072f, -0.943084419f, -0.943339229f, -0.943593442f,
+  -0.94384712f, -0.944100261f, -0.944352806f, -0.944604814f, -0.944856286f,
+  -0.945107222f, -0.945357561f, -0.945607305f, -0.945856571f, -0.946105242f,
+  -0.946353376f, -0.946600914f, -0.946847916f, -0.947094381f, -0.94734025f,
+  -0.947585583f, -0.947830379f, -0.948074579f, -0.948318243f, -0.94856137f,
+  -0.948803902f, -0.949045897f, -0.949287295f, -0.949528158f, -0.949768484f,
+  -0.950008273f, -0.950247467f, -0.950486064f, -0.950724125f, -0.950961649f,
+  -0.951198637f, -0.95143503f, -0.951670885f, -0.951906145f, -0.952140868f,
+  -0.952374995f, -0.952608585f, -0.95284164f, -0.953074098f, -0.953306019f,
+  -0.953537405f, -0.953768194f, -0.953998446f, -0.954228103f, -0.954457223f,
+  -0.954685748f, -0.954913735f, -0.955141187f, -0.955368042f, -0.955594361f,
+  -0.955820084f, -0.95604527f, -0.95626986f, -0.956493914f, -0.956717432f,
+  -0.956940353f, -0.957162678f, -0.957384527f, -0.95760572f, -0.957826436f,
+  -0.958046496f, -0.958266079f, -0.958485067f, -0.958703458f, -0.958921313f,
+  -0.959138632f, -0.959355354f, -0.95957154f, -0.95978713f, -0.960002124f,
+  -0.960216641f, -0.960430503f, -0.960643888f, -0.960856616f, -0.961068869f,
+  -0.961280465f, -0.961491585f, -0.961702049f, -0.961912036f, -0.962121427f,
+  -0.962330222f, -0.962538481f, -0.962746143f, -0.962953269f, -0.9631598f,
+  -0.963365793f, -0.963571191f, -0.963776052f, -0.963980377f, -0.964184046f,
+  -0.964387238f, -0.964589775f, -0.964791834f, -0.964993238f, -0.965194106f,
+  -0.965394437f, -0.965594172f, -0.965793371f, -0.965991974f, -0.966189981f,
+  -0.966387451f, -0.966584384f, -0.966780722f, -0.966976464f, -0.967171669f,
+  -0.967366278f, -0.967560351f, -0.967753828f, -0.967946768f, -0.968139112f,
+  -0.96833086f, -0.968522072f, -0.968712747f, -0.968902826f, -0.969092309f,
+  -0.969281256f, -0.969469607f, -0.969657362f, -0.96984458f, -0.970031261f,
+  -0.970217347f, -0.970402837f, -0.97058779f, -0.970772147f, -0.970955908f,
+  -0.971139133f, -0.971321821f, -0.971503913f, -0.97168541f, -0.97186631f,
+  -0.972046733f, -0.972226501f, -0.972405732f, -0.972584367f, -0.972762465f,
+  -0.972939968f, -0.973116875f, -0.973293245f, -0.973469019f, -0.973644257f,
+  -0.973818898f, -0.973992944f, -0.974166453f, -0.974339366f, -0.974511743f,
+  -0.974683523f, -0.974854708f, -0.975025356f, -0.975195408f, -0.975364864f,
+  -0.975533783f, -0.975702107f, -0.975869894f, -0.976037085f, -0.97620368f,
+  -0.976369739f, -0.976535201f, -0.976700068f, -0.976864398f, -0.977028131f,
+  -0.977191329f, -0.977353871f, -0.977515936f, -0.977677345f, -0.977838218f,
+  -0.977998495f, -0.978158236f, -0.97831738f, -0.978475928f, -0.97863394f,
+  -0.978791356f, -0.978948176f, -0.979104459f, -0.979260147f, -0.979415238f,
+  -0.979569793f, -0.979723752f, -0.979877114f, -0.980029881f, -0.980182111f,
+  -0.980333805f, -0.980484843f, -0.980635345f, -0.980785251f, -0.98093462f,
+  -0.981083393f, -0.98123157f, -0.981379211f, -0.981526256f, -0.981672704f,
+  -0.981818557f, -0.981963873f, -0.982108593f, -0.982252717f, -0.982396305f,
+  -0.982539296f, -0.982681692f, -0.982823551f, -0.982964814f, -0.983105481f,
+  -0.983245611f, -0.983385086f, -0.983524024f, -0.983662426f, -0.983800232f,
+  -0.983937442f, -0.984074056f, -0.984210074f, -0.984345555f, -0.984480441f,
+  -0.984614789f, -0.984748483f, -0.984881639f, -0.98501426f, -0.985146224f,
+  -0.985277653f, -0.985408485f, -0.985538721f, -0.985668421f, -0.985797524f,
+  -0.985926032f, -0.986053944f, -0.986181319f, -0.986308098f, -0.986434281f,
+  -0.986559927f, -0.986684918f, -0.986809373f, -0.986933291f, -0.987056553f,
+  -0.987179279f, -0.987301409f, -0.987422943f, -0.987543941f, -0.987664342f,
+  -0.987784147f, -0.987903357f, -0.988022029f, -0.988140106f, -0.988257587f,
+  -0.988374472f, -0.98849082f, -0.988606513f, -0.988721669f, -0.988836288f,
+  -0.988950253f, -0.98906368f, -0.989176512f, -0.989288747f, -0.989400446f,
+  -0.98951149f, -0.989621997f, -0.989731967f, -0.989841282f, -0.989950061f,
+  -0.990058184f, -0.99016583f, -0.99027282f, -0.990379214f, -0.990485072f,
+  -0.990590334f, -0.990695f, -0.990799129f, -0.990902662f, -0.99100554f,
+  -0.991107941f, -0.991209686f, -0.991310835f, -0.991411448f, -0.991511464f,
+  -0.991610885f, -0.991709769f, -0.991807997f, -0.991905689f, -0.992002785f,
+  -0.992099285f, -0.992195249f, -0.992290616f, -0.992385328f, -0.992479563f,
+  -0.992573142f, -0.992666125f, -0.992758572f, -0.992850423f, -0.992941678f,
+  -0.993032336f, -0.993122458f, -0.993211925f, -0.993300855f, -0.993389189f,
+  -0.993476987f, -0.993564129f, -0.993650734f, -0.993736744f, -0.993822157f,
+  -0.993906975f, -0.993991196f, -0.994074881f, -0.99415797f, -0.994240463f,
+  -0.99432236f, -0.99440366f, -0.994484425f, -0.994564593f, -0.994644165f,
+  -0.994723141f, -0.994801521f, -0.994879305f, -0.994956553f, -0.995033205f,
+  -0.99510926f, -0.99518472f, -0.995259583f, -0.99533391f, -0.995407641f,
+  -0.995480776f, -0.995553315f, -0.995625257f, -0.995696604f, -0.995767415f,
+  -0.995837629f, -0.995907247f, -0.995976269f, -0.996044695f, -0.996112585f,
+  -0.996179819f, -0.996246517f, -0.996312618f, -0.996378124f, -0.996443033f,
+  -0.996507406f, -0.996571124f, -0.996634305f, -0.996696889f, -0.996758878f,
+  -0.996820271f, -0.996881127f, -0.996941328f, -0.997000992f, -0.997060061f,
+  -0.997118533f, -0.997176409f, -0.997233748f, -0.997290432f, -0.99734658f,
+  -0.997402132f, -0.997457087f, -0.997511446f, -0.99756521f, -0.997618437f,
+  -0.997671068f, -0.997723043f, -0.997774482f, -0.997825325f, -0.997875631f,
+  -0.997925282f, -0.997974396f, -0.998022854f, -0.998070776f, -0.998118103f,
+  -0.998164833f, -0.998211026f, -0.998256564f, -0.998301566f, -0.998345912f,
+  -0.998389721f, -0.998432934f, -0.998475552f, -0.998517632f, -0.998559058f,
+  -0.998599946f, -0.998640239f, -0.998679936f, -0.998719037f, -0.998757541f,
+  -0.99879545f, -0.998832822f, -0.998869538f, -0.998905718f, -0.998941302f,
+  -0.99897629f, -0.999010682f, -0.999044478f, -0.999077737f, -0.999110341f,
+  -0.999142408f, -0.99917388f, -0.999204755f, -0.999235034f, -0.999264777f,
+  -0.999293864f, -0.999322355f, -0.999350309f, -0.999377668f, -0.99940443f,
+  -0.999430597f, -0.999456167f, -0.999481201f, -0.999505579f, -0.999529421f,
+  -0.999552667f, -0.999575317f, -0.999597371f, -0.999618828f, -0.99963969f,
+  -0.999660015f, -0.999679685f, -0.999698818f, -0.999717355f, -0.999735296f,
+  -0.999752641f, -0.99976939f, -0.999785602f, -0.999801159f, -0.999816179f,
+  -0.999830604f, -0.999844432f, -0.999857664f, -0.9998703f, -0.99988234f,
+  -0.999893844f, -0.999904692f, -0.999915004f, -0.999924719f, -0.999933839f,
+  -0.999942362f, -0.99995029f, -0.999957621f, -0.999964416f, -0.999970615f,
+  -0.999976158f, -0.999981165f, -0.999985576f, -0.99998939f, -0.999992669f,
+  -0.999995291f, -0.999997377f, -0.999998808f, -0.999999702f, -1.f,
+  -0.999999702f, -0.999998808f, -0.999997377f, -0.999995291f, -0.999992669f,
+  -0.99998939f, -0.999985576f, -0.999981165f, -0.999976158f, -0.999970615f,
+  -0.999964416f, -0.999957621f, -0.99995029f, -0.999942362f, -0.999933839f,
+  -0.999924719f, -0.999915004f, -0.999904692f, -0.999893844f, -0.99988234f,
+  -0.9998703f, -0.999857664f, -0.999844432f, -0.999830604f, -0.999816179f,
+  -0.999801159f, -0.999785602f, -0.99976939f, -0.999752641f, -0.999735296f,
+  -0.999717355f, -0.999698818f, -0.999679685f, -0.999660015f, -0.99963969f,
+  -0.999618828f, -0.999597371f, -0.999575317f, -0.999552667f, -0.999529421f,
+  -0.999505579f, -0.999481201f, -0.999456167f, -0.999430597f, -0.99940443f,
+  -0.999377668f, -0.999350309f, -0.999322355f, -0.999293864f, -0.999264777f,
+  -0.999235034f, -0.999204755f, -0.99917388f, -0.999142408f, -0.999110341f,
+  -0.999077737f, -0.999044478f, -0.999010682f, -0.99897629f, -0.998941302f,
+  -0.998905718f, -0.998869538f, -0.998832822f, -0.99879545f, -0.998757541f,
+  -0.998719037f, -0.998679936f, -0.998640239f, -0.998599946f, -0.998559058f,
+  -0.998517632f, -0.998475552f, -0.998432934f, -0.998389721f, -0.998345912f,
+  -0.998301566f, -0.998256564f, -0.998211026f, -0.998164833f, -0.998118103f,
+  -0.998070776f, -0.998022854f, -0.997974396f, -0.997925282f, -0.997875631f,
+  -0.997825325f, -0.997774482f, -0.997723043f, -0.997671068f, -0.997618437f,
+  -0.99756521f, -0.997511446f, -0.997457087f, -0.997402132f, -0.99734658f,
+  -0.997290432f, -0.997233748f, -0.997176409f, -0.997118533f, -0.997060061f,
+  -0.997000992f, -0.996941328f, -0.996881127f, -0.996820271f, -0.996758878f,
+  -0.996696889f, -0.996634305f, -0.996571124f, -0.996507406f, -0.996443033f,
+  -0.996378124f, -0.996312618f, -0.996246517f, -0.996179819f, -0.996112585f,
+  -0.996044695f, -0.995976269f, -0.995907247f, -0.995837629f, -0.995767415f,
+  -0.995696604f, -0.995625257f, -0.995553315f, -0.995480776f, -0.995407641f,
+  -0.99533391f, -0.995259583f, -0.99518472f, -0.99510926f, -0.995033205f,
+  -0.994956553f, -0.994879305f, -0.994801521f, -0.994723141f, -0.994644165f,
+  -0.994564593f, -0.994484425f, -0.99440366f, -0.99432236f, -0.994240463f,
+  -0.99415797f, -0.994074881f, -0.993991196f, -0.993906975f, -0.993822157f,
+  -0.993736744f, -0.993650734f, -0.993564129f, -0.993476987f, -0.993389189f,
+  -0.993300855f, -0.993211925f, -0.993122458f, -0.993032336f, -0.992941678f,
+  -0.992850423f, -0.992758572f, -0.992666125f, -0.992573142f, -0.992479563f,
+  -0.992385328f, -0.992290616f, -0.992195249f, -0.992099285f, -0.992002785f,
+  -0.991905689f, -0.991807997f, -0.991709769f, -0.991610885f, -0.991511464f,
+  -0.991411448f, -0.991310835f, -0.991209686f, -0.991107941f, -0.99100554f,
+  -0.990902662f, -0.990799129f, -0.990695f, -0.990590334f, -0.990485072f,
+  -0.990379214f, -0.99027282f, -0.99016583f, -0.990058184f, -0.989950061f,
+  -0.989841282f, -0.989731967f, -0.989621997f, -0.98951149f, -0.989400446f,
+  -0.989288747f, -0.989176512f, -0.98906368f, -0.988950253f, -0.988836288f,
+  -0.988721669f, -0.988606513f, -0.98849082f, -0.988374472f, -0.988257587f,
+  -0.988140106f, -0.988022029f, -0.987903357f, -0.987784147f, -0.987664342f,
+  -0.987543941f, -0.987422943f, -0.987301409f, -0.987179279f, -0.987056553f,
+  -0.986933291f, -0.986809373f, -0.986684918f, -0.986559927f, -0.986434281f,
+  -0.986308098f, -0.986181319f, -0.986053944f, -0.985926032f, -0.985797524f,
+  -0.985668421f, -0.985538721f, -0.985408485f, -0.985277653f, -0.985146224f,
+  -0.98501426f, -0.984881639f, -0.984748483f, -0.984614789f, -0.984480441f,
+  -0.984345555f, -0.984210074f, -0.984074056f, -0.983937442f, -0.983800232f,
+  -0.983662426f, -0.983524024f, -0.983385086f, -0.983245611f, -0.983105481f,
+  -0.982964814f, -0.982823551f, -0.982681692f, -0.982539296f, -0.982396305f,
+  -0.982252717f, -0.982108593f, -0.981963873f, -0.981818557f, -0.981672704f,
+  -0.981526256f, -0.981379211f, -0.98123157f, -0.981083393f, -0.98093462f,
+  -0.980785251f, -0.980635345f, -0.980484843f, -0.980333805f, -0.980182111f,
+  -0.980029881f, -0.979877114f, -0.979723752f, -0.979569793f, -0.979415238f,
+  -0.979260147f, -0.979104459f, -0.978948176f, -0.978791356f, -0.97863394f,
+  -0.978475928f, -0.97831738f, -0.978158236f, -0.977998495f, -0.977838218f,
+  -0.977677345f, -0.977515936f, -0.977353871f, -0.977191329f, -0.977028131f,
+  -0.976864398f, -0.976700068f, -0.976535201f, -0.976369739f, -0.97620368f,
+  -0.976037085f, -0.975869894f, -0.975702107f, -0.975533783f, -0.975364864f,
+  -0.975195408f, -0.975025356f, -0.974854708f, -0.974683523f, -0.974511743f,
+  -0.974339366f, -0.974166453f, -0.973992944f, -0.973818898f, -0.973644257f,
+  -0.973469019f, -0.973293245f, -0.973116875f, -0.972939968f, -0.972762465f,
+  -0.972584367f, -0.972405732f, -0.972226501f, -0.972046733f, -0.97186631f,
+  -0.97168541f, -0.971503913f, -0.971321821f, -0.971139133f, -0.970955908f,
+  -0.970772147f, -0.97058779f, -0.970402837f, -0.970217347f, -0.970031261f,
+  -0.96984458f, -0.969657362f, -0.969469607f, -0.969281256f, -0.969092309f,
+  -0.968902826f, -0.968712747f, -0.968522072f, -0.96833086f, -0.968139112f,
+  -0.967946768f, -0.967753828f, -0.967560351f, -0.967366278f, -0.967171669f,
+  -0.966976464f, -0.966780722f, -0.966584384f, -0.966387451f, -0.966189981f,
+  -0.965991974f, -0.965793371f, -0.965594172f, -0.965394437f, -0.965194106f,
+  -0.964993238f, -0.964791834f, -0.964589775f, -0.964387238f, -0.964184046f,
+  -0.963980377f, -0.963776052f, -0.963571191f, -0.963365793f, -0.9631598f,
+  -0.962953269f, -0.962746143f, -0.962538481f, -0.962330222f, -0.962121427f,
+  -0.961912036f, -0.961702049f, -0.961491585f, -0.961280465f, -0.961068869f,
+  -0.960856616f, -0.960643888f, -0.960430503f, -0.960216641f, -0.960002124f,
+  -0.95978713f, -0.95957154f, -0.959355354f, -0.959138632f, -0.958921313f,
+  -0.958703458f, -0.958485067f, -0.958266079f, -0.958046496f, -0.957826436f,
+  -0.95760572f, -0.957384527f, -0.957162678f, -0.956940353f, -0.956717432f,
+  -0.956493914f, -0.95626986f, -0.95604527f, -0.955820084f, -0.955594361f,
+  -0.955368042f, -0.955141187f, -0.954913735f, -0.954685748f, -0.954457223f,
+  -0.954228103f, -0.953998446f, -0.953768194f, -0.953537405f, -0.953306019f,
+  -0.953074098f, -0.95284164f, -0.952608585f, -0.952374995f, -0.952140868f,
+  -0.951906145f, -0.951670885f, -0.95143503f, -0.951198637f, -0.950961649f,
+  -0.950724125f, -0.950486064f, -0.950247467f, -0.950008273f, -0.949768484f,
+  -0.949528158f, -0.949287295f, -0.949045897f, -0.948803902f, -0.94856137f,
+  -0.948318243f, -0.948074579f, -0.947830379f, -0.947585583f, -0.94734025f,
+  -0.947094381f, -0.946847916f, -0.946600914f, -0.946353376f, -0.946105242f,
+  -0.945856571f, -0.945607305f, -0.945357561f, -0.945107222f, -0.944856286f,
+  -0.944604814f, -0.944352806f, -0.944100261f, -0.94384712f, -0.943593442f,
+  -0.943339229f, -0.943084419f, -0.942829072f, -0.94257319f, -0.942316771f,
+  -0.942059755f, -0.941802204f, -0.941544056f, -0.941285372f, -0.941026151f,
+  -0.940766394f, -0.940506041f, -0.940245211f, -0.939983726f, -0.939721763f,
+  -0.939459205f, -0.93919611f, -0.938932478f, -0.938668311f, -0.938403547f,
+  -0.938138247f, -0.93787235f, -0.937605977f, -0.937339008f, -0.937071502f,
+  -0.93680346f, -0.936534822f, -0.936265647f, -0.935995936f, -0.935725689f,
+  -0.935454845f, -0.935183525f, -0.934911609f, -0.934639156f, -0.934366107f,
+  -0.934092522f, -0.93381846f, -0.933543801f, -0.933268547f, -0.932992816f,
+  -0.932716489f, -0.932439625f, -0.932162225f, -0.931884289f, -0.931605756f,
+  -0.931326687f, -0.931047082f, -0.93076694f, -0.930486262f, -0.930205047f,
+  -0.929923236f, -0.929640889f, -0.929358006f, -0.929074585f, -0.928790629f,
+  -0.928506076f, -0.928220987f, -0.927935421f, -0.92764926f, -0.927362502f,
+  -0.927075267f, -0.926787496f, -0.926499128f, -0.926210225f, -0.925920784f,
+  -0.925630808f, -0.925340295f, -0.925049245f, -0.9247576f, -0.924465477f,
+  -0.924172759f, -0.923879504f, -0.923585773f, -0.923291445f, -0.922996521f,
+  -0.92270112f, -0.922405183f, -0.92210865f, -0.92181164f, -0.921514034f,
+  -0.921215892f, -0.920917213f, -0.920618057f, -0.920318305f, -0.920017958f,
+  -0.919717133f, -0.919415772f, -0.919113874f, -0.918811381f, -0.91850841f,
+  -0.918204844f, -0.917900801f, -0.917596161f, -0.917290986f, -0.916985273f,
+  -0.916679084f, -0.916372299f, -0.916064978f, -0.91575712f, -0.915448725f,
+  -0.915139794f, -0.914830327f, -0.914520323f, -0.914209783f, -0.913898647f,
+  -0.913587034f, -0.913274884f, -0.912962198f, -0.912648976f, -0.912335157f,
+  -0.912020862f, -0.91170603f, -0.911390662f, -0.911074758f, -0.910758257f,
+  -0.910441279f, -0.910123765f, -0.909805715f, -0.909487128f, -0.909168005f,
+  -0.908848345f, -0.90852809f, -0.908207357f, -0.907886088f, -0.907564342f,
+  -0.907242f, -0.906919122f, -0.906595707f, -0.906271756f, -0.905947268f,
+  -0.905622303f, -0.905296743f, -0.904970706f, -0.904644072f, -0.904316962f,
+  -0.903989315f, -0.903661072f, -0.903332353f, -0.903003097f, -0.902673304f,
+  -0.902342975f, -0.902012169f, -0.901680768f, -0.901348829f, -0.901016414f,
+  -0.900683403f, -0.900349915f, -0.900015891f, -0.89968133f, -0.899346232f,
+  -0.899010599f, -0.898674488f, -0.898337781f, -0.898000598f, -0.897662818f,
+  -0.897324562f, -0.896985769f, -0.8966465f, -0.896306634f, -0.895966232f,
+  -0.895625353f, -0.895283937f, -0.894941986f, -0.894599497f, -0.894256473f,
+  -0.893912971f, -0.893568873f, -0.893224299f, -0.892879188f, -0.892533541f,
+  -0.892187417f, -0.891840696f, -0.891493499f, -0.891145766f, -0.890797496f,
+  -0.890448749f, -0.890099406f, -0.889749587f, -0.88939923f, -0.889048338f,
+  -0.888696969f, -0.888345063f, -0.887992561f, -0.887639642f, -0.887286127f,
+  -0.886932135f, -0.886577606f, -0.886222541f, -0.88586694f, -0.885510862f,
+  -0.885154247f, -0.884797096f, -0.884439468f, -0.884081244f, -0.883722544f,
+  -0.883363366f, -0.883003592f, -0.882643342f, -0.882282555f, -0.881921291f,
+  -0.881559432f, -0.881197095f, -0.880834281f, -0.880470872f, -0.880106986f,
+  -0.879742622f, -0.879377663f, -0.879012227f, -0.878646255f, -0.878279805f,
+  -0.877912819f, -0.877545297f, -0.877177238f, -0.876808703f, -0.876439691f,
+  -0.876070082f, -0.875699997f, -0.875329375f, -0.874958277f, -0.874586642f,
+  -0.87421453f, -0.873841822f, -0.873468697f, -0.873094976f, -0.872720778f,
+  -0.872346044f, -0.871970832f, -0.871595085f, -0.87121886f, -0.87084204f,
+  -0.870464802f, -0.870086968f, -0.869708657f, -0.86932987f, -0.868950546f,
+  -0.868570685f, -0.868190348f, -0.867809474f, -0.867428124f, -0.867046237f,
+  -0.866663873f, -0.866280973f, -0.865897536f, -0.865513623f, -0.865129173f,
+  -0.864744246f, -0.864358783f, -0.863972843f, -0.863586366f, -0.863199413f,
+  -0.862811923f, -0.862423956f, -0.862035453f, -0.861646473f, -0.861256957f,
+  -0.860866964f, -0.860476434f, -0.860085368f, -0.859693885f, -0.859301805f,
+  -0.858909249f, -0.858516216f, -0.858122647f, -0.857728601f, -0.857334018f,
+  -0.856938958f, -0.856543422f, -0.856147349f, -0.85575074f, -0.855353653f,
+  -0.85495609f, -0.854557991f, -0.854159415f, -0.853760302f, -0.853360713f,
+  -0.852960587f, -0.852559984f, -0.852158904f, -0.851757288f, -0.851355195f,
+  -0.850952566f, -0.850549459f, -0.850145876f, -0.849741757f, -0.849337161f,
+  -0.848932028f, -0.848526478f, -0.848120332f, -0.847713768f, -0.847306609f,
+  -0.846899033f, -0.84649092f, -0.84608233f, -0.845673263f, -0.84526366f,
+  -0.84485358f, -0.844442964f, -0.84403187f, -0.8436203f, -0.843208253f,
+  -0.84279567f, -0.84238261f, -0.841969013f, -0.841554999f, -0.841140449f,
+  -0.840725362f, -0.840309858f, -0.839893818f, -0.839477241f, -0.839060247f,
+  -0.838642716f, -0.838224709f, -0.837806225f, -0.837387204f, -0.836967707f,
+  -0.836547732f, -0.836127281f, -0.835706294f, -0.835284829f, -0.834862888f,
+  -0.83444041f, -0.834017515f, -0.833594084f, -0.833170176f, -0.83274579f,
+  -0.832320869f, -0.831895471f, -0.831469595f, -0.831043243f, -0.830616415f,
+  -0.830189049f, -0.829761207f, -0.829332948f, -0.828904092f, -0.82847482f,
+  -0.82804507f, -0.827614784f, -0.827184021f, -0.826752782f, -0.826321065f,
+  -0.825888872f, -0.825456142f, -0.825022995f, -0.824589312f, -0.824155152f,
+  -0.823720515f, -0.823285401f, -0.82284981f, -0.822413683f, -0.821977139f,
+  -0.821540058f, -0.8211025f, -0.820664465f, -0.820225954f, -0.819786966f,
+  -0.819347501f, -0.818907559f, -0.81846714f, -0.818026185f, -0.817584813f,
+  -0.817142904f, -0.816700578f, -0.816257715f, -0.815814435f, -0.815370619f,
+  -0.814926326f, -0.814481556f, -0.81403631f, -0.813590586f, -0.813144386f,
+  -0.812697768f, -0.812250614f, -0.811802983f, -0.811354876f, -0.810906231f,
+  -0.81045717f, -0.810007632f, -0.809557617f, -0.809107125f, -0.808656156f,
+  -0.80820471f, -0.807752848f, -0.807300448f, -0.806847572f, -0.806394219f,
+  -0.80594039f, -0.805486083f, -0.805031359f, -0.804576099f, -0.804120362f,
+  -0.803664207f, -0.803207517f, -0.802750409f, -0.802292824f, -0.801834702f,
+  -0.801376164f, -0.800917149f, -0.800457656f, -0.799997687f, -0.799537241f,
+  -0.799076378f, -0.798614979f, -0.798153162f, -0.797690868f, -0.797228038f,
+  -0.796764791f, -0.796301067f, -0.795836926f, -0.795372248f, -0.794907153f,
+  -0.794441521f, -0.793975472f, -0.793508947f, -0.793041945f, -0.792574525f,
+  -0.792106569f, -0.791638196f, -0.791169345f, -0.790700018f, -0.790230215f,
+  -0.789759994f, -0.789289236f, -0.788818061f, -0.78834641f, -0.787874341f,
+  -0.787401736f, -0.786928713f, -0.786455214f, -0.785981238f, -0.785506845f,
+  -0.785031915f, -0.784556568f, -0.784080803f, -0.783604503f, -0.783127785f,
+  -0.78265059f, -0.782172918f, -0.781694829f, -0.781216264f, -0.780737221f,
+  -0.780257761f, -0.779777765f, -0.779297352f, -0.778816521f, -0.778335214f,
+  -0.777853429f, -0.777371168f, -0.77688849f, -0.776405334f, -0.775921702f,
+  -0.775437653f, -0.774953127f, -0.774468124f, -0.773982704f, -0.773496807f,
+  -0.773010433f, -0.772523642f, -0.772036374f, -0.771548688f, -0.771060526f,
+  -0.770571887f, -0.770082831f, -0.769593298f, -0.769103348f, -0.768612921f,
+  -0.768122017f, -0.767630696f, -0.767138898f, -0.766646683f, -0.766153991f,
+  -0.765660882f, -0.765167236f, -0.764673233f, -0.764178753f, -0.763683796f,
+  -0.763188422f, -0.762692571f, -0.762196302f, -0.761699557f, -0.761202395f,
+  -0.760704756f, -0.760206699f, -0.759708166f, -0.759209216f, -0.758709788f,
+  -0.758209884f, -0.757709622f, -0.757208824f, -0.756707668f, -0.756205976f,
+  -0.755703926f, -0.755201399f, -0.754698396f, -0.754194975f, -0.753691137f,
+  -0.753186822f, -0.75268203f, -0.752176821f, -0.751671195f, -0.751165152f,
+  -0.750658631f, -0.750151634f, -0.74964422f, -0.749136388f, -0.74862808f,
+  -0.748119354f, -0.747610211f, -0.747100592f, -0.746590555f, -0.746080101f,
+  -0.74556917f, -0.745057762f, -0.744545996f, -0.744033754f, -0.743521094f,
+  -0.743007958f, -0.742494404f, -0.741980433f, -0.741465986f, -0.740951121f,
+  -0.740435839f, -0.73992008f, -0.739403903f, -0.73888731f, -0.738370299f,
+  -0.737852812f, -0.737334907f, -0.736816585f, -0.736297786f, -0.73577857f,
+  -0.735258937f, -0.734738886f, -0.734218359f, -0.733697414f, -0.733176053f,
+  -0.732654274f, -0.732132018f, -0.731609404f, -0.731086314f, -0.730562747f,
+  -0.730038822f, -0.72951442f, -0.728989601f, -0.728464365f, -0.727938712f,
+  -0.727412641f, -0.726886094f, -0.726359129f, -0.725831807f, -0.725303948f,
+  -0.724775732f, -0.724247098f, -0.723717988f, -0.72318846f, -0.722658575f,
+  -0.722128212f, -0.721597433f, -0.721066177f, -0.720534563f, -0.720002532f,
+  -0.719470024f, -0.718937099f, -0.718403816f, -0.717870057f, -0.71733588f,
+  -0.716801286f, -0.716266274f, -0.715730846f, -0.715194941f, -0.714658678f,
+  -0.714121997f, -0.71358484f, -0.713047326f, -0.712509394f, -0.711970985f,
+  -0.711432219f, -0.710892975f, -0.710353374f, -0.709813297f, -0.709272802f,
+  -0.708731949f, -0.70819062f, -0.707648933f, -0.707106769f, -0.706564248f,
+  -0.706021249f, -0.705477893f, -0.704934061f, -0.70438987f, -0.703845263f,
+  -0.703300178f, -0.702754736f, -0.702208877f, -0.7016626f, -0.701115906f,
+  -0.700568795f, -0.700021267f, -0.699473321f, -0.698925018f, -0.698376238f,
+  -0.697827101f, -0.697277486f, -0.696727514f, -0.696177125f, -0.695626318f,
+  -0.695075095f, -0.694523513f, -0.693971455f, -0.693419039f, -0.692866147f,
+  -0.692312896f, -0.691759229f, -0.691205204f, -0.690650702f, -0.690095842f,
+  -0.689540565f, -0.688984871f, -0.68842876f, -0.687872231f, -0.687315345f,
+  -0.686758041f, -0.686200321f, -0.685642183f, -0.685083687f, -0.684524715f,
+  -0.683965385f, -0.683405697f, -0.682845533f, -0.682285011f, -0.681724072f,
+  -0.681162715f, -0.680601001f, -0.680038869f, -0.679476321f, -0.678913355f,
+  -0.678350031f, -0.677786291f, -0.677222192f, -0.676657617f, -0.676092684f,
+  -0.675527394f, -0.674961627f, -0.674395502f, -0.673829019f, -0.67326206f,
+  -0.672694743f, -0.672127068f, -0.671558976f, -0.670990467f, -0.670421541f,
+  -0.669852257f, -0.669282615f, -0.668712497f, -0.668142021f, -0.667571187f,
+  -0.666999936f, -0.666428268f, -0.665856242f, -0.665283799f, -0.664710999f,
+  -0.664137781f, -0.663564146f, -0.662990153f, -0.662415802f, -0.661840975f,
+  -0.66126585f, -0.660690308f, -0.660114348f, -0.659538031f, -0.658961296f,
+  -0.658384204f, -0.657806695f, -0.657228827f, -0.656650543f, -0.656071901f,
+  -0.655492842f, -0.654913425f, -0.654333591f, -0.6537534f, -0.653172851f,
+  -0.652591884f, -0.65201056f, -0.651428819f, -0.65084666f, -0.650264204f,
+  -0.64968133f, -0.649098039f, -0.64851439f, -0.647930384f, -0.64734596f,
+  -0.646761179f, -0.64617604f, -0.645590484f, -0.645004511f, -0.64441824f,
+  -0.643831551f, -0.643244505f, -0.642657042f, -0.642069221f, -0.641481042f,
+  -0.640892446f, -0.640303493f, -0.639714181f, -0.639124453f, -0.638534367f,
+  -0.637943923f, -0.637353063f, -0.636761844f, -0.636170268f, -0.635578334f,
+  -0.634985983f, -0.634393275f, -0.633800209f, -0.633206785f, -0.632612944f,
+  -0.632018745f, -0.631424189f, -0.630829215f, -0.630233943f, -0.629638255f,
+  -0.629042208f, -0.628445745f, -0.627848983f, -0.627251804f, -0.626654267f,
+  -0.626056373f, -0.625458121f, -0.624859512f, -0.624260485f, -0.623661101f,
+  -0.623061359f, -0.622461259f, -0.621860802f, -0.621259987f, -0.620658755f,
+  -0.620057225f, -0.619455278f, -0.618852973f, -0.61825031f, -0.61764729f,
+  -0.617043912f, -0.616440177f, -0.615836084f, -0.615231574f, -0.614626765f,
+  -0.61402154f, -0.613416016f, -0.612810075f, -0.612203777f, -0.61159718f,
+  -0.610990167f, -0.610382795f, -0.609775066f, -0.609167039f, -0.608558595f,
+  -0.607949793f, -0.607340634f, -0.606731117f, -0.606121242f, -0.605511069f,
+  -0.604900479f, -0.604289532f, -0.603678226f, -0.603066623f, -0.602454603f,
+  -0.601842225f, -0.601229548f, -0.600616455f, -0.600003064f, -0.599389315f,
+  -0.598775208f, -0.598160684f, -0.597545862f, -0.596930683f, -0.596315205f,
+  -0.59569931f, -0.595083058f, -0.594466507f, -0.593849599f, -0.593232274f,
+  -0.592614651f, -0.59199667f, -0.591378391f, -0.590759695f, -0.5901407f,
+  -0.589521289f, -0.588901579f, -0.588281572f, -0.587661147f, -0.587040365f,
+  -0.586419284f, -0.585797846f, -0.585176051f, -0.584553957f, -0.583931446f,
+  -0.583308637f, -0.582685471f, -0.582062006f, -0.581438124f, -0.580813944f,
+  -0.580189407f, -0.579564571f, -0.578939319f, -0.578313768f, -0.577687919f,
+  -0.577061653f, -0.576435089f, -0.575808167f, -0.575180948f, -0.57455337f,
+  -0.573925436f, -0.573297143f, -0.572668552f, -0.572039604f, -0.571410358f,
+  -0.570780754f, -0.570150793f, -0.569520533f, -0.568889916f, -0.568258941f,
+  -0.567627668f, -0.566996038f, -0.56636411f, -0.565731823f, -0.56509918f,
+  -0.564466238f, -0.563832939f, -0.563199341f, -0.562565386f, -0.561931133f,
+  -0.561296523f, -0.560661554f, -0.560026288f, -0.559390724f, -0.558754802f,
+  -0.558118522f, -0.557481945f, -0.556845009f, -0.556207776f, -0.555570245f,
+  -0.554932356f, -0.554294109f, -0.553655565f, -0.553016722f, -0.552377522f,
+  -0.551737964f, -0.551098168f, -0.550457954f, -0.549817502f, -0.549176633f,
+  -0.548535526f, -0.547894061f, -0.547252297f, -0.546610177f, -0.545967758f,
+  -0.545324981f, -0.544681907f, -0.544038534f, -0.543394804f, -0.542750776f,
+  -0.54210645f, -0.541461766f, -0.540816784f, -0.540171444f, -0.539525867f,
+  -0.538879931f, -0.538233638f, -0.537587047f, -0.536940157f, -0.53629297f,
+  -0.535645485f, -0.534997642f, -0.534349442f, -0.533701003f, -0.533052206f,
+  -0.532403111f, -0.531753719f, -0.531104028f, -0.53045398f, -0.529803634f,
+  -0.529152989f, -0.528501987f, -0.527850747f, -0.527199149f, -0.526547253f,
+  -0.525895f, -0.525242507f, -0.524589658f, -0.52393657f, -0.523283124f,
+  -0.52262938f, -0.521975279f, -0.521320939f, -0.520666242f, -0.520011246f,
+  -0.519356012f, -0.518700421f, -0.518044531f, -0.517388284f, -0.516731799f,
+  -0.516075015f, -0.515417874f, -0.514760435f, -0.514102757f, -0.513444722f,
+  -0.512786388f, -0.512127757f, -0.511468828f, -0.5108096f, -0.510150075f,
+  -0.509490252f, -0.50883013f, -0.508169711f, -0.507508993f, -0.506847978f,
+  -0.506186664f, -0.505525053f, -0.504863083f, -0.504200876f, -0.50353837f,
+  -0.502875566f, -0.502212465f, -0.501549065f, -0.500885367f, -0.500221372f,
+  -0.499557108f, -0.498892546f, -0.498227656f, -0.497562498f, -0.496897042f,
+  -0.496231288f, -0.495565265f, -0.494898945f, -0.494232297f, -0.49356541f,
+  -0.492898196f, -0.492230713f, -0.491562903f, -0.490894854f, -0.490226477f,
+  -0.489557832f, -0.48888889f, -0.488219678f, -0.487550169f, -0.486880362f,
+  -0.486210287f, -0.485539913f, -0.484869242f, -0.484198302f, -0.483527064f,
+  -0.482855558f, -0.482183784f, -0.481511682f, -0.480839342f, -0.480166674f,
+  -0.479493767f, -0.478820562f, -0.47814706f, -0.477473289f, -0.47679922f,
+  -0.476124883f, -0.475450277f, -0.474775374f, -0.474100202f, -0.473424762f,
+  -0.472749025f, -0.472073019f, -0.471396744f, -0.470720172f, -0.470043331f,
+  -0.469366223f, -0.468688816f, -0.468011141f, -0.467333198f, -0.466654986f,
+  -0.465976506f, -0.465297729f, -0.464618683f, -0.463939369f, -0.463259786f,
+  -0.462579936f, -0.461899787f, -0.4612194f, -0.460538715f, -0.459857762f,
+  -0.45917654f, -0.458495051f, -0.457813293f, -0.457131267f, -0.456448972f,
+  -0.45576641f, -0.455083579f, -0.45440048f, -0.453717113f, -0.453033477f,
+  -0.452349573f, -0.451665431f, -0.450980991f, -0.450296283f, -0.449611336f,
+  -0.448926091f, -0.448240608f, -0.447554857f, -0.446868837f, -0.446182549f,
+  -0.445496023f, -0.444809198f, -0.444122136f, -0.443434805f, -0.442747235f,
+  -0.442059368f, -0.441371262f, -0.440682888f, -0.439994276f, -0.439305395f,
+  -0.438616246f, -0.437926829f, -0.437237173f, -0.43654725f, -0.435857087f,
+  -0.435166657f, -0.434475958f, -0.433785021f, -0.433093816f, -0.432402372f,
+  -0.43171066f, -0.43101871f, -0.430326492f, -0.429634005f, -0.42894128f,
+  -0.428248316f, -0.427555084f, -0.426861614f, -0.426167876f, -0.425473899f,
+  -0.424779683f, -0.4240852f, -0.423390478f, -0.422695488f, -0.422000259f,
+  -0.421304792f, -0.420609087f, -0.419913113f, -0.419216901f, -0.418520421f,
+  -0.417823702f, -0.417126775f, -0.416429549f, -0.415732116f, -0.415034413f,
+  -0.414336503f, -0.413638324f, -0.412939876f, -0.41224122f, -0.411542326f,
+  -0.410843164f, -0.410143793f, -0.409444153f, -0.408744276f, -0.408044159f,
+  -0.407343805f, -0.406643212f, -0.40594238f, -0.405241311f, -0.404540002f,
+  -0.403838456f, -0.403136671f, -0.402434647f, -0.401732385f, -0.401029885f,
+  -0.400327176f, -0.399624199f, -0.398921013f, -0.398217559f, -0.397513896f,
+  -0.396809995f, -0.396105856f, -0.395401478f, -0.394696862f, -0.393992037f,
+  -0.393286973f, -0.392581671f, -0.391876131f, -0.391170382f, -0.390464395f,
+  -0.38975817f, -0.389051735f, -0.388345033f, -0.387638152f, -0.386931002f,
+  -0.386223644f, -0.385516047f, -0.384808242f, -0.384100199f, -0.383391917f,
+  -0.382683426f, -0.381974727f, -0.381265759f, -0.380556613f, -0.379847199f,
+  -0.379137605f, -0.378427744f, -0.377717704f, -0.377007425f, -0.376296908f,
+  -0.375586182f, -0.374875218f, -0.374164075f, -0.373452663f, -0.372741073f,
+  -0.372029245f, -0.371317208f, -0.370604932f, -0.369892448f, -0.369179755f,
+  -0.368466824f, -0.367753685f, -0.367040336f, -0.366326779f, -0.365612984f,
+  -0.364899009f, -0.364184797f, -0.363470376f, -0.362755716f, -0.362040877f,
+  -0.3613258f, -0.360610515f, -0.359895051f, -0.359179348f, -0.358463407f,
+  -0.357747287f, -0.357030958f, -0.356314421f, -0.355597675f, -0.354880691f,
+  -0.354163527f, -0.353446156f, -0.352728546f, -0.352010757f, -0.351292759f,
+  -0.350574553f, -0.349856138f, -0.349137515f, -0.348418683f, -0.347699642f,
+  -0.346980423f, -0.346260965f, -0.345541328f, -0.344821483f, -0.344101429f,
+  -0.343381166f, -0.342660725f, -0.341940075f, -0.341219217f, -0.340498149f,
+  -0.339776874f, -0.339055419f, -0.338333756f, -0.337611914f, -0.336889863f,
+  -0.336167604f, -0.335445136f, -0.334722489f, -0.333999664f, -0.3332766f,
+  -0.332553357f, -0.331829935f, -0.331106305f, -0.330382496f, -0.329658449f,
+  -0.328934252f, -0.328209847f, -0.327485234f, -0.326760441f, -0.32603547f,
+  -0.32531029f, -0.324584931f, -0.323859364f, -0.323133618f, -0.322407693f,
+  -0.321681559f, -0.320955247f, -0.320228726f, -0.319502026f, -0.318775147f,
+  -0.31804809f, -0.317320824f, -0.316593379f, -0.315865755f, -0.315137923f,
+  -0.314409941f, -0.313681751f, -0.312953383f, -0.312224805f, -0.311496079f,
+  -0.310767144f, -0.31003806f, -0.309308767f, -0.308579296f, -0.307849646f,
+  -0.307119817f, -0.306389809f, -0.305659592f, -0.304929227f, -0.304198682f,
+  -0.303467959f, -0.302737027f, -0.302005947f, -0.301274687f, -0.300543249f,
+  -0.299811631f, -0.299079835f, -0.298347861f, -0.297615707f, -0.296883374f,
+  -0.296150893f, -0.295418203f, -0.294685364f, -0.293952346f, -0.293219149f,
+  -0.292485803f, -0.291752249f, -0.291018546f, -0.290284663f, -0.289550632f,
+  -0.288816422f, -0.288082033f, -0.287347466f, -0.286612719f, -0.285877824f,
+  -0.285142779f, -0.284407526f, -0.283672124f, -0.282936573f, -0.282200843f,
+  -0.281464934f, -0.280728877f, -0.27999264f, -0.279256254f, -0.27851969f,
+  -0.277782977f, -0.277046084f, -0.276309043f, -0.275571823f, -0.274834454f,
+  -0.274096906f, -0.273359209f, -0.272621363f, -0.271883339f, -0.271145165f,
+  -0.270406812f, -0.269668311f, -0.26892966f, -0.268190861f, -0.267451882f,
+  -0.266712755f, -0.265973479f, -0.265234023f, -0.264494419f, -0.263754666f,
+  -0.263014764f, -0.262274712f, -0.261534482f, -0.260794103f, -0.260053605f,
+  -0.259312928f, -0.258572072f, -0.257831097f, -0.257089972f, -0.25634867f,
+  -0.255607247f, -0.254865646f, -0.254123926f, -0.253382027f, -0.252640009f,
+  -0.251897812f, -0.251155496f, -0.250413001f, -0.249670386f, -0.248927608f,
+  -0.248184681f, -0.24744162f, -0.246698409f, -0.24595505f, -0.245211542f,
+  -0.244467899f, -0.243724108f, -0.242980182f, -0.242236108f, -0.241491884f,
+  -0.240747526f, -0.24000302f, -0.239258379f, -0.238513589f, -0.237768665f,
+  -0.237023607f, -0.2362784f, -0.235533059f, -0.234787583f, -0.234041959f,
+  -0.233296201f, -0.232550308f, -0.231804281f, -0.231058106f, -0.230311811f,
+  -0.229565367f, -0.228818789f, -0.228072077f, -0.227325246f, -0.226578265f,
+  -0.225831151f, -0.225083917f, -0.224336535f, -0.223589033f, -0.222841397f,
+  -0.222093627f, -0.221345723f, -0.220597684f, -0.219849527f, -0.219101235f,
+  -0.218352824f, -0.21760428f, -0.2168556f, -0.216106802f, -0.21535787f,
+  -0.214608818f, -0.213859633f, -0.213110313f, -0.212360889f, -0.211611331f,
+  -0.210861638f, -0.210111842f, -0.209361911f, -0.208611846f, -0.207861677f,
+  -0.207111374f, -0.206360951f, -0.205610409f, -0.204859748f, -0.204108968f,
+  -0.203358069f, -0.202607036f, -0.201855898f, -0.201104641f, -0.20035325f,
+  -0.199601755f, -0.19885014f, -0.198098406f, -0.197346568f, -0.196594596f,
+  -0.195842519f, -0.195090324f, -0.194338009f, -0.19358559f, -0.192833051f,
+  -0.192080393f, -0.191327631f, -0.19057475f, -0.189821765f, -0.18906866f,
+  -0.188315451f, -0.187562123f, -0.18680869f, -0.186055154f, -0.185301498f,
+  -0.184547737f, -0.183793873f, -0.183039889f, -0.182285801f, -0.181531608f,
+  -0.180777311f, -0.180022895f, -0.17926839f, -0.178513765f, -0.177759051f,
+  -0.177004218f, -0.176249295f, -0.175494254f, -0.174739107f, -0.173983872f,
+  -0.173228532f, -0.172473088f, -0.171717539f, -0.170961887f, -0.170206144f,
+  -0.169450298f, -0.168694347f, -0.167938292f, -0.167182148f, -0.166425899f,
+  -0.16566956f, -0.164913118f, -0.164156586f, -0.16339995f, -0.162643224f,
+  -0.161886394f, -0.161129475f, -0.160372451f, -0.159615353f, -0.15885815f,
+  -0.158100843f, -0.157343462f, -0.156585976f, -0.155828401f, -0.155070737f,
+  -0.154312968f, -0.153555125f, -0.152797192f, -0.152039155f, -0.151281044f,
+  -0.150522828f, -0.149764538f, -0.149006143f, -0.148247674f, -0.147489116f,
+  -0.146730468f, -0.145971745f, -0.145212919f, -0.144454017f, -0.143695027f,
+  -0.142935961f, -0.142176807f, -0.141417563f, -0.140658244f, -0.139898837f,
+  -0.139139339f, -0.138379768f, -0.137620121f, -0.136860386f, -0.136100575f,
+  -0.135340676f, -0.134580702f, -0.133820653f, -0.13306053f, -0.132300317f,
+  -0.13154003f, -0.130779669f, -0.130019218f, -0.129258707f, -0.128498107f,
+  -0.127737448f, -0.126976699f, -0.126215875f, -0.125454977f, -0.12469402f,
+  -0.123932973f, -0.123171858f, -0.122410677f, -0.121649414f, -0.120888084f,
+  -0.120126687f, -0.119365215f, -0.118603677f, -0.117842063f, -0.117080383f,
+  -0.116318628f, -0.115556814f, -0.114794925f, -0.114032976f, -0.113270953f,
+  -0.112508863f, -0.111746714f, -0.110984489f, -0.110222206f, -0.109459855f,
+  -0.108697444f, -0.107934967f, -0.107172422f, -0.106409818f, -0.105647154f,
+  -0.104884423f, -0.104121633f, -0.103358783f, -0.102595866f, -0.101832896f,
+  -0.10106986f, -0.100306772f, -0.0995436162f, -0.0987804085f, -0.0980171412f,
+  -0.0972538143f, -0.0964904279f, -0.0957269892f, -0.0949634984f, -0.0941999406f,
+  -0.093436338f, -0.0926726758f, -0.0919089541f, -0.0911451876f, -0.0903813615f,
+  -0.0896174833f, -0.0888535529f, -0.0880895704f, -0.0873255357f, -0.0865614489f,
+  -0.0857973099f, -0.0850331262f, -0.0842688903f, -0.0835046023f, -0.0827402622f,
+  -0.0819758773f, -0.0812114477f, -0.080446966f, -0.0796824396f, -0.078917861f,
+  -0.0781532452f, -0.0773885772f, -0.0766238645f, -0.0758591071f, -0.0750942975f,
+  -0.0743294507f, -0.0735645667f, -0.0727996305f, -0.0720346496f, -0.0712696314f,
+  -0.070504576f, -0.0697394684f, -0.068974331f, -0.0682091415f, -0.0674439222f,
+  -0.0666786581f, -0.0659133494f, -0.0651480108f, -0.0643826276f, -0.0636172146f,
+  -0.0628517568f, -0.0620862655f, -0.061320737f, -0.0605551712f, -0.0597895719f,
+  -0.0590239353f, -0.0582582653f, -0.0574925579f, -0.0567268208f, -0.0559610501f,
+  -0.0551952459f, -0.0544294082f, -0.0536635369f, -0.0528976358f, -0.052131705f,
+  -0.0513657406f, -0.0505997501f, -0.0498337261f, -0.0490676761f, -0.0483015925f,
+  -0.0475354828f, -0.046769347f, -0.0460031815f, -0.0452369899f, -0.0444707721f,
+  -0.0437045284f, -0.0429382585f, -0.0421719626f, -0.0414056405f, -0.0406392962f,
+  -0.0398729257f, -0.0391065367f, -0.0383401215f, -0.037573684f, -0.0368072242f,
+  -0.036040742f, -0.0352742374f, -0.0345077142f, -0.0337411724f, -0.0329746082f,
+  -0.0322080255f, -0.031441424f, -0.030674804f, -0.0299081653f, -0.029141508f,
+  -0.0283748358f, -0.027608145f, -0.0268414393f, -0.0260747187f, -0.0253079813f,
+  -0.024541229f, -0.0237744618f, -0.0230076816f, -0.0222408883f, -0.0214740802f,
+  -0.0207072608f, -0.0199404284f, -0.0191735849f, -0.0184067301f, -0.0176398642f,
+  -0.0168729872f, -0.0161061026f, -0.015339206f, -0.0145723019f, -0.0138053885f,
+  -0.0130384676f, -0.0122715384f, -0.0115046017f, -0.0107376594f, -0.00997070968f,
+  -0.00920375437f, -0.00843679439f, -0.00766982883f, -0.00690285861f, -0.00613588467f,
+  -0.005368907f, -0.00460192608f, -0.00383494259f, -0.00306795677f, -0.00230096909f,
+  -0.00153398013f, -0.000766990299f, 0.f, 0.000766990299f, 0.00153398013f,
+  0.00230096909f, 0.00306795677f, 0.00383494259f, 0.00460192608f, 0.005368907f,
+  0.00613588467f, 0.00690285861f, 0.00766982883f, 0.00843679439f, 0.00920375437f,
+  0.00997070968f, 0.0107376594f, 0.0115046017f, 0.0122715384f, 0.0130384676f,
+  0.0138053885f, 0.0145723019f, 0.015339206f, 0.0161061026f, 0.0168729872f,
+  0.0176398642f, 0.0184067301f, 0.0191735849f, 0.0199404284f, 0.0207072608f,
+  0.0214740802f, 0.0222408883f, 0.0230076816f, 0.0237744618f, 0.024541229f,
+  0.0253079813f, 0.0260747187f, 0.0268414393f, 0.027608145f, 0.0283748358f,
+  0.029141508f, 0.0299081653f, 0.030674804f, 0.031441424f, 0.0322080255f,
+  0.0329746082f, 0.0337411724f, 0.0345077142f, 0.0352742374f, 0.036040742f,
+  0.0368072242f, 0.037573684f, 0.0383401215f, 0.0391065367f, 0.0398729257f,
+  0.0406392962f, 0.0414056405f, 0.0421719626f, 0.0429382585f, 0.0437045284f,
+  0.0444707721f, 0.0452369899f, 0.0460031815f, 0.046769347f, 0.0475354828f,
+  0.0483015925f, 0.0490676761f, 0.0498337261f, 0.0505997501f, 0.0513657406f,
+  0.052131705f, 0.0528976358f, 0.0536635369f, 0.0544294082f, 0.0551952459f,
+  0.0559610501f, 0.0567268208f, 0.0574925579f, 0.0582582653f, 0.0590239353f,
+  0.0597895719f, 0.0605551712f, 0.061320737f, 0.0620862655f, 0.0628517568f,
+  0.0636172146f, 0.0643826276f, 0.0651480108f, 0.0659133494f, 0.0666786581f,
+  0.0674439222f, 0.0682091415f, 0.068974331f, 0.0697394684f, 0.070504576f,
+  0.0712696314f, 0.0720346496f, 0.0727996305f, 0.0735645667f, 0.0743294507f,
+  0.0750942975f, 0.0758591071f, 0.0766238645f, 0.0773885772f, 0.0781532452f,
+  0.078917861f, 0.0796824396f, 0.080446966f, 0.0812114477f, 0.0819758773f,
+  0.0827402622f, 0.0835046023f, 0.0842688903f, 0.0850331262f, 0.0857973099f,
+  0.0865614489f, 0.0873255357f, 0.0880895704f, 0.0888535529f, 0.0896174833f,
+  0.0903813615f, 0.0911451876f, 0.0919089541f, 0.0926726758f, 0.093436338f,
+  0.0941999406f, 0.0949634984f, 0.0957269892f, 0.0964904279f, 0.0972538143f,
+  0.0980171412f, 0.0987804085f, 0.0995436162f, 0.100306772f, 0.10106986f,
+  0.101832896f, 0.102595866f, 0.103358783f, 0.104121633f, 0.104884423f,
+  0.105647154f, 0.106409818f, 0.107172422f, 0.107934967f, 0.108697444f,
+  0.109459855f, 0.110222206f, 0.110984489f, 0.111746714f, 0.112508863f,
+  0.113270953f, 0.114032976f, 0.114794925f, 0.115556814f, 0.116318628f,
+  0.117080383f, 0.117842063f, 0.118603677f, 0.119365215f, 0.120126687f,
+  0.120888084f, 0.121649414f, 0.122410677f, 0.123171858f, 0.123932973f,
+  0.12469402f, 0.125454977f, 0.126215875f, 0.126976699f, 0.127737448f,
+  0.128498107f, 0.129258707f, 0.130019218f, 0.130779669f, 0.13154003f,
+  0.132300317f, 0.13306053f, 0.133820653f, 0.134580702f, 0.135340676f,
+  0.136100575f, 0.136860386f, 0.137620121f, 0.138379768f, 0.139139339f,
+  0.139898837f, 0.140658244f, 0.141417563f, 0.142176807f, 0.142935961f,
+  0.143695027f, 0.144454017f, 0.145212919f, 0.145971745f, 0.146730468f,
+  0.147489116f, 0.148247674f, 0.149006143f, 0.149764538f, 0.150522828f,
+  0.151281044f, 0.152039155f, 0.152797192f, 0.153555125f, 0.154312968f,
+  0.155070737f, 0.155828401f, 0.156585976f, 0.157343462f, 0.158100843f,
+  0.15885815f, 0.159615353f, 0.160372451f, 0.161129475f, 0.161886394f,
+  0.162643224f, 0.16339995f, 0.164156586f, 0.164913118f, 0.16566956f,
+  0.166425899f, 0.167182148f, 0.167938292f, 0.168694347f, 0.169450298f,
+  0.170206144f, 0.170961887f, 0.171717539f, 0.172473088f, 0.173228532f,
+  0.173983872f, 0.174739107f, 0.175494254f, 0.176249295f, 0.177004218f,
+  0.177759051f, 0.178513765f, 0.17926839f, 0.180022895f, 0.180777311f,
+  0.181531608f, 0.182285801f, 0.183039889f, 0.183793873f, 0.184547737f,
+  0.185301498f, 0.186055154f, 0.18680869f, 0.187562123f, 0.188315451f,
+  0.18906866f, 0.189821765f, 0.19057475f, 0.191327631f, 0.192080393f,
+  0.192833051f, 0.19358559f, 0.194338009f, 0.195090324f, 0.195842519f,
+  0.196594596f, 0.197346568f, 0.198098406f, 0.19885014f, 0.199601755f,
+  0.20035325f, 0.201104641f, 0.201855898f, 0.202607036f, 0.203358069f,
+  0.204108968f, 0.204859748f, 0.205610409f, 0.206360951f, 0.207111374f,
+  0.207861677f, 0.208611846f, 0.209361911f, 0.210111842f, 0.210861638f,
+  0.211611331f, 0.212360889f, 0.213110313f, 0.213859633f, 0.214608818f,
+  0.21535787f, 0.216106802f, 0.2168556f, 0.21760428f, 0.218352824f,
+  0.219101235f, 0.219849527f, 0.220597684f, 0.221345723f, 0.222093627f,
+  0.222841397f, 0.223589033f, 0.224336535f, 0.225083917f, 0.225831151f,
+  0.226578265f, 0.227325246f, 0.228072077f, 0.228818789f, 0.229565367f,
+  0.230311811f, 0.231058106f, 0.231804281f, 0.232550308f, 0.233296201f,
+  0.234041959f, 0.234787583f, 0.235533059f, 0.2362784f, 0.237023607f,
+  0.237768665f, 0.238513589f, 0.239258379f, 0.24000302f, 0.240747526f,
+  0.241491884f, 0.242236108f, 0.242980182f, 0.243724108f, 0.244467899f,
+  0.245211542f, 0.24595505f, 0.246698409f, 0.24744162f, 0.248184681f,
+  0.248927608f, 0.249670386f, 0.250413001f, 0.251155496f, 0.251897812f,
+  0.252640009f, 0.253382027f, 0.254123926f, 0.254865646f, 0.255607247f,
+  0.25634867f, 0.257089972f, 0.257831097f, 0.258572072f, 0.259312928f,
+  0.260053605f, 0.260794103f, 0.261534482f, 0.262274712f, 0.263014764f,
+  0.263754666f, 0.264494419f, 0.265234023f, 0.265973479f, 0.266712755f,
+  0.267451882f, 0.268190861f, 0.26892966f, 0.269668311f, 0.270406812f,
+  0.271145165f, 0.271883339f, 0.272621363f, 0.273359209f, 0.274096906f,
+  0.274834454f, 0.275571823f, 0.276309043f, 0.277046084f, 0.277782977f,
+  0.27851969f, 0.279256254f, 0.27999264f, 0.280728877f, 0.281464934f,
+  0.282200843f, 0.282936573f, 0.283672124f, 0.284407526f, 0.285142779f,
+  0.285877824f, 0.286612719f, 0.287347466f, 0.288082033f, 0.288816422f,
+  0.289550632f, 0.290284663f, 0.291018546f, 0.291752249f, 0.292485803f,
+  0.293219149f, 0.293952346f, 0.294685364f, 0.295418203f, 0.296150893f,
+  0.296883374f, 0.297615707f, 0.298347861f, 0.299079835f, 0.299811631f,
+  0.300543249f, 0.301274687f, 0.302005947f, 0.302737027f, 0.303467959f,
+  0.304198682f, 0.304929227f, 0.305659592f, 0.306389809f, 0.307119817f,
+  0.307849646f, 0.308579296f, 0.309308767f, 0.31003806f, 0.310767144f,
+  0.311496079f, 0.312224805f, 0.312953383f, 0.313681751f, 0.314409941f,
+  0.315137923f, 0.315865755f, 0.316593379f, 0.317320824f, 0.31804809f,
+  0.318775147f, 0.319502026f, 0.320228726f, 0.320955247f, 0.321681559f,
+  0.322407693f, 0.323133618f, 0.323859364f, 0.324584931f, 0.32531029f,
+  0.32603547f, 0.326760441f, 0.327485234f, 0.328209847f, 0.328934252f,
+  0.329658449f, 0.330382496f, 0.331106305f, 0.331829935f, 0.332553357f,
+  0.3332766f, 0.333999664f, 0.334722489f, 0.335445136f, 0.336167604f,
+  0.336889863f, 0.337611914f, 0.338333756f, 0.339055419f, 0.339776874f,
+  0.340498149f, 0.341219217f, 0.341940075f, 0.342660725f, 0.343381166f,
+  0.344101429f, 0.344821483f, 0.345541328f, 0.346260965f, 0.346980423f,
+  0.347699642f, 0.348418683f, 0.349137515f, 0.349856138f, 0.350574553f,
+  0.351292759f, 0.352010757f, 0.352728546f, 0.353446156f, 0.354163527f,
+  0.354880691f, 0.355597675f, 0.356314421f, 0.357030958f, 0.357747287f,
+  0.358463407f, 0.359179348f, 0.359895051f, 0.360610515f, 0.3613258f,
+  0.362040877f, 0.362755716f, 0.363470376f, 0.364184797f, 0.364899009f,
+  0.365612984f, 0.366326779f, 0.367040336f, 0.367753685f, 0.368466824f,
+  0.369179755f, 0.369892448f, 0.370604932f, 0.371317208f, 0.372029245f,
+  0.372741073f, 0.373452663f, 0.374164075f, 0.374875218f, 0.375586182f,
+  0.376296908f, 0.377007425f, 0.377717704f, 0.378427744f, 0.379137605f,
+  0.379847199f, 0.380556613f, 0.381265759f, 0.381974727f, 0.382683426f,
+  0.383391917f, 0.384100199f, 0.384808242f, 0.385516047f, 0.386223644f,
+  0.386931002f, 0.387638152f, 0.388345033f, 0.389051735f, 0.38975817f,
+  0.390464395f, 0.391170382f, 0.391876131f, 0.392581671f, 0.393286973f,
+  0.393992037f, 0.394696862f, 0.395401478f, 0.396105856f, 0.396809995f,
+  0.397513896f, 0.398217559f, 0.398921013f, 0.399624199f, 0.400327176f,
+  0.401029885f, 0.401732385f, 0.402434647f, 0.403136671f, 0.403838456f,
+  0.404540002f, 0.405241311f, 0.40594238f, 0.406643212f, 0.407343805f,
+  0.408044159f, 0.408744276f, 0.409444153f, 0.410143793f, 0.410843164f,
+  0.411542326f, 0.41224122f, 0.412939876f, 0.413638324f, 0.414336503f,
+  0.415034413f, 0.415732116f, 0.416429549f, 0.417126775f, 0.417823702f,
+  0.418520421f, 0.419216901f, 0.419913113f, 0.420609087f, 0.421304792f,
+  0.422000259f, 0.422695488f, 0.423390478f, 0.4240852f, 0.424779683f,
+  0.425473899f, 0.426167876f, 0.426861614f, 0.427555084f, 0.428248316f,
+  0.42894128f, 0.429634005f, 0.430326492f, 0.43101871f, 0.43171066f,
+  0.432402372f, 0.433093816f, 0.433785021f, 0.434475958f, 0.435166657f,
+  0.435857087f, 0.43654725f, 0.437237173f, 0.437926829f, 0.438616246f,
+  0.439305395f, 0.439994276f, 0.440682888f, 0.441371262f, 0.442059368f,
+  0.442747235f, 0.443434805f, 0.444122136f, 0.444809198f, 0.445496023f,
+  0.446182549f, 0.446868837f, 0.447554857f, 0.448240608f, 0.448926091f,
+  0.449611336f, 0.450296283f, 0.450980991f, 0.451665431f, 0.452349573f,
+  0.453033477f, 0.453717113f, 0.45440048f, 0.455083579f, 0.45576641f,
+  0.456448972f, 0.457131267f, 0.457813293f, 0.458495051f, 0.45917654f,
+  0.459857762f, 0.460538715f, 0.4612194f, 0.461899787f, 0.462579936f,
+  0.463259786f, 0.463939369f, 0.464618683f, 0.465297729f, 0.465976506f,
+  0.466654986f, 0.467333198f, 0.468011141f, 0.468688816f, 0.469366223f,
+  0.470043331f, 0.470720172f, 0.471396744f, 0.472073019f, 0.472749025f,
+  0.473424762f, 0.474100202f, 0.474775374f, 0.475450277f, 0.476124883f,
+  0.47679922f, 0.477473289f, 0.47814706f, 0.478820562f, 0.479493767f,
+  0.480166674f, 0.480839342f, 0.481511682f, 0.482183784f, 0.482855558f,
+  0.483527064f, 0.484198302f, 0.484869242f, 0.485539913f, 0.486210287f,
+  0.486880362f, 0.487550169f, 0.488219678f, 0.48888889f, 0.489557832f,
+  0.490226477f, 0.490894854f, 0.491562903f, 0.492230713f, 0.492898196f,
+  0.49356541f, 0.494232297f, 0.494898945f, 0.495565265f, 0.496231288f,
+  0.496897042f, 0.497562498f, 0.498227656f, 0.498892546f, 0.499557108f,
+  0.500221372f, 0.500885367f, 0.501549065f, 0.502212465f, 0.502875566f,
+  0.50353837f, 0.504200876f, 0.504863083f, 0.505525053f, 0.506186664f,
+  0.506847978f, 0.507508993f, 0.508169711f, 0.50883013f, 0.509490252f,
+  0.510150075f, 0.5108096f, 0.511468828f, 0.512127757f, 0.512786388f,
+  0.513444722f, 0.514102757f, 0.514760435f, 0.515417874f, 0.516075015f,
+  0.516731799f, 0.517388284f, 0.518044531f, 0.518700421f, 0.519356012f,
+  0.520011246f, 0.520666242f, 0.521320939f, 0.521975279f, 0.52262938f,
+  0.523283124f, 0.52393657f, 0.524589658f, 0.525242507f, 0.525895f,
+  0.526547253f, 0.527199149f, 0.527850747f, 0.528501987f, 0.529152989f,
+  0.529803634f, 0.53045398f, 0.531104028f, 0.531753719f, 0.532403111f,
+  0.533052206f, 0.533701003f, 0.534349442f, 0.534997642f, 0.535645485f,
+  0.53629297f, 0.536940157f, 0.537587047f, 0.538233638f, 0.538879931f,
+  0.539525867f, 0.540171444f, 0.540816784f, 0.541461766f, 0.54210645f,
+  0.542750776f, 0.543394804f, 0.544038534f, 0.544681907f, 0.545324981f,
+  0.545967758f, 0.546610177f, 0.547252297f, 0.547894061f, 0.548535526f,
+  0.549176633f, 0.549817502f, 0.550457954f, 0.551098168f, 0.551737964f,
+  0.552377522f, 0.553016722f, 0.553655565f, 0.554294109f, 0.554932356f,
+  0.555570245f, 0.556207776f, 0.556845009f, 0.557481945f, 0.558118522f,
+  0.558754802f, 0.559390724f, 0.560026288f, 0.560661554f, 0.561296523f,
+  0.561931133f, 0.562565386f, 0.563199341f, 0.563832939f, 0.564466238f,
+  0.56509918f, 0.565731823f, 0.56636411f, 0.566996038f, 0.567627668f,
+  0.568258941f, 0.568889916f, 0.569520533f, 0.570150793f, 0.570780754f,
+  0.571410358f, 0.572039604f, 0.572668552f, 0.573297143f, 0.573925436f,
+  0.57455337f, 0.575180948f, 0.575808167f, 0.576435089f, 0.577061653f,
+  0.577687919f, 0.578313768f, 0.578939319f, 0.579564571f, 0.580189407f,
+  0.580813944f, 0.581438124f, 0.582062006f, 0.582685471f, 0.583308637f,
+  0.583931446f, 0.584553957f, 0.585176051f, 0.585797846f, 0.586419284f,
+  0.587040365f, 0.587661147f, 0.588281572f, 0.588901579f, 0.589521289f,
+  0.5901407f, 0.590759695f, 0.591378391f, 0.59199667f, 0.592614651f,
+  0.593232274f, 0.593849599f, 0.594466507f, 0.595083058f, 0.59569931f,
+  0.596315205f, 0.596930683f, 0.597545862f, 0.598160684f, 0.598775208f,
+  0.599389315f, 0.600003064f, 0.600616455f, 0.601229548f, 0.601842225f,
+  0.602454603f, 0.603066623f, 0.603678226f, 0.604289532f, 0.604900479f,
+  0.605511069f, 0.606121242f, 0.606731117f, 0.607340634f, 0.607949793f,
+  0.608558595f, 0.609167039f, 0.609775066f, 0.610382795f, 0.610990167f,
+  0.61159718f, 0.612203777f, 0.612810075f, 0.613416016f, 0.61402154f,
+  0.614626765f, 0.615231574f, 0.615836084f, 0.616440177f, 0.617043912f,
+  0.61764729f, 0.61825031f, 0.618852973f, 0.619455278f, 0.620057225f,
+  0.620658755f, 0.621259987f, 0.621860802f, 0.622461259f, 0.623061359f,
+  0.623661101f, 0.624260485f, 0.624859512f, 0.625458121f, 0.626056373f,
+  0.626654267f, 0.627251804f, 0.627848983f, 0.628445745f, 0.629042208f,
+  0.629638255f, 0.630233943f, 0.630829215f, 0.631424189f, 0.632018745f,
+  0.632612944f, 0.633206785f, 0.633800209f, 0.634393275f, 0.634985983f,
+  0.635578334f, 0.636170268f, 0.636761844f, 0.637353063f, 0.637943923f,
+  0.638534367f, 0.639124453f, 0.639714181f, 0.640303493f, 0.640892446f,
+  0.641481042f, 0.642069221f, 0.642657042f, 0.643244505f, 0.643831551f,
+  0.64441824f, 0.645004511f, 0.645590484f, 0.64617604f, 0.646761179f,
+  0.64734596f, 0.647930384f, 0.64851439f, 0.649098039f, 0.64968133f,
+  0.650264204f, 0.65084666f, 0.651428819f, 0.65201056f, 0.652591884f,
+  0.653172851f, 0.6537534f, 0.654333591f, 0.654913425f, 0.655492842f,
+  0.656071901f, 0.656650543f, 0.657228827f, 0.657806695f, 0.658384204f,
+  0.658961296f, 0.659538031f, 0.660114348f, 0.660690308f, 0.66126585f,
+  0.661840975f, 0.662415802f, 0.662990153f, 0.663564146f, 0.664137781f,
+  0.664710999f, 0.665283799f, 0.665856242f, 0.666428268f, 0.666999936f,
+  0.667571187f, 0.668142021f, 0.668712497f, 0.669282615f, 0.669852257f,
+  0.670421541f, 0.670990467f, 0.671558976f, 0.672127068f, 0.672694743f,
+  0.67326206f, 0.673829019f, 0.674395502f, 0.674961627f, 0.675527394f,
+  0.676092684f, 0.676657617f, 0.677222192f, 0.677786291f, 0.678350031f,
+  0.678913355f, 0.679476321f, 0.680038869f, 0.680601001f, 0.681162715f,
+  0.681724072f, 0.682285011f, 0.682845533f, 0.683405697f, 0.683965385f,
+  0.684524715f, 0.685083687f, 0.685642183f, 0.686200321f, 0.686758041f,
+  0.687315345f, 0.687872231f, 0.68842876f, 0.688984871f, 0.689540565f,
+  0.690095842f, 0.690650702f, 0.691205204f, 0.691759229f, 0.692312896f,
+  0.692866147f, 0.693419039f, 0.693971455f, 0.694523513f, 0.695075095f,
+  0.695626318f, 0.696177125f, 0.696727514f, 0.697277486f, 0.697827101f,
+  0.698376238f, 0.698925018f, 0.699473321f, 0.700021267f, 0.700568795f,
+  0.701115906f, 0.7016626f, 0.702208877f, 0.702754736f, 0.703300178f,
+  0.703845263f, 0.70438987f, 0.704934061f, 0.705477893f, 0.706021249f,
+  0.706564248f, 0.707106769f, 0.707648933f, 0.70819062f, 0.708731949f,
+  0.709272802f, 0.709813297f, 0.710353374f, 0.710892975f, 0.711432219f,
+  0.711970985f, 0.712509394f, 0.713047326f, 0.71358484f, 0.714121997f,
+  0.714658678f, 0.715194941f, 0.715730846f, 0.716266274f, 0.716801286f,
+  0.71733588f, 0.717870057f, 0.718403816f, 0.718937099f, 0.719470024f,
+  0.720002532f, 0.720534563f, 0.721066177f, 0.721597433f, 0.722128212f,
+  0.722658575f, 0.72318846f, 0.723717988f, 0.724247098f, 0.724775732f,
+  0.725303948f, 0.725831807f, 0.726359129f, 0.726886094f, 0.727412641f,
+  0.727938712f, 0.728464365f, 0.728989601f, 0.72951442f, 0.730038822f,
+  0.730562747f, 0.731086314f, 0.731609404f, 0.732132018f, 0.732654274f,
+  0.733176053f, 0.733697414f, 0.734218359f, 0.734738886f, 0.735258937f,
+  0.73577857f, 0.736297786f, 0.736816585f, 0.737334907f, 0.737852812f,
+  0.738370299f, 0.73888731f, 0.739403903f, 0.73992008f, 0.740435839f,
+  0.740951121f, 0.741465986f, 0.741980433f, 0.742494404f, 0.743007958f,
+  0.743521094f, 0.744033754f, 0.744545996f, 0.745057762f, 0.74556917f,
+  0.746080101f, 0.746590555f, 0.747100592f, 0.747610211f, 0.748119354f,
+  0.74862808f, 0.749136388f, 0.74964422f, 0.750151634f, 0.750658631f,
+  0.751165152f, 0.751671195f, 0.752176821f, 0.75268203f, 0.753186822f,
+  0.753691137f, 0.754194975f, 0.754698396f, 0.755201399f, 0.755703926f,
+  0.756205976f, 0.756707668f, 0.757208824f, 0.757709622f, 0.758209884f,
+  0.758709788f, 0.759209216f, 0.759708166f, 0.760206699f, 0.760704756f,
+  0.761202395f, 0.761699557f, 0.762196302f, 0.762692571f, 0.763188422f,
+  0.763683796f, 0.764178753f, 0.764673233f, 0.765167236f, 0.765660882f,
+  0.766153991f, 0.766646683f, 0.767138898f, 0.767630696f, 0.768122017f,
+  0.768612921f, 0.769103348f, 0.769593298f, 0.770082831f, 0.770571887f,
+  0.771060526f, 0.771548688f, 0.772036374f, 0.772523642f, 0.773010433f,
+  0.773496807f, 0.773982704f, 0.774468124f, 0.774953127f, 0.775437653f,
+  0.775921702f, 0.776405334f, 0.77688849f, 0.777371168f, 0.777853429f,
+  0.778335214f, 0.778816521f, 0.779297352f, 0.779777765f, 0.780257761f,
+  0.780737221f, 0.781216264f, 0.781694829f, 0.782172918f, 0.78265059f,
+  0.783127785f, 0.783604503f, 0.784080803f, 0.784556568f, 0.785031915f,
+  0.785506845f, 0.785981238f, 0.786455214f, 0.786928713f, 0.787401736f,
+  0.787874341f, 0.78834641f, 0.788818061f, 0.789289236f, 0.789759994f,
+  0.790230215f, 0.790700018f, 0.791169345f, 0.791638196f, 0.792106569f,
+  0.792574525f, 0.793041945f, 0.793508947f, 0.793975472f, 0.794441521f,
+  0.794907153f, 0.795372248f, 0.795836926f, 0.796301067f, 0.796764791f,
+  0.797228038f, 0.797690868f, 0.798153162f, 0.798614979f, 0.799076378f,
+  0.799537241f, 0.799997687f, 0.800457656f, 0.800917149f, 0.801376164f,
+  0.801834702f, 0.802292824f, 0.802750409f, 0.803207517f, 0.803664207f,
+  0.804120362f, 0.804576099f, 0.805031359f, 0.805486083f, 0.80594039f,
+  0.806394219f, 0.806847572f, 0.807300448f, 0.807752848f, 0.80820471f,
+  0.808656156f, 0.809107125f, 0.809557617f, 0.810007632f, 0.81045717f,
+  0.810906231f, 0.811354876f, 0.811802983f, 0.812250614f, 0.812697768f,
+  0.813144386f, 0.813590586f, 0.81403631f, 0.814481556f, 0.814926326f,
+  0.815370619f, 0.815814435f, 0.816257715f, 0.816700578f, 0.817142904f,
+  0.817584813f, 0.818026185f, 0.81846714f, 0.818907559f, 0.819347501f,
+  0.819786966f, 0.820225954f, 0.820664465f, 0.8211025f, 0.821540058f,
+  0.821977139f, 0.822413683f, 0.82284981f, 0.823285401f, 0.823720515f,
+  0.824155152f, 0.824589312f, 0.825022995f, 0.825456142f, 0.825888872f,
+  0.826321065f, 0.826752782f, 0.827184021f, 0.827614784f, 0.82804507f,
+  0.82847482f, 0.828904092f, 0.829332948f, 0.829761207f, 0.830189049f,
+  0.830616415f, 0.831043243f, 0.831469595f, 0.831895471f, 0.832320869f,
+  0.83274579f, 0.833170176f, 0.833594084f, 0.834017515f, 0.83444041f,
+  0.834862888f, 0.835284829f, 0.835706294f, 0.836127281f, 0.836547732f,
+  0.836967707f, 0.837387204f, 0.837806225f, 0.838224709f, 0.838642716f,
+  0.839060247f, 0.839477241f, 0.839893818f, 0.840309858f, 0.840725362f,
+  0.841140449f, 0.841554999f, 0.841969013f, 0.84238261f, 0.84279567f,
+  0.843208253f, 0.8436203f, 0.84403187f, 0.844442964f, 0.84485358f,
+  0.84526366f, 0.845673263f, 0.84608233f, 0.84649092f, 0.846899033f,
+  0.847306609f, 0.847713768f, 0.848120332f, 0.848526478f, 0.848932028f,
+  0.849337161f, 0.849741757f, 0.850145876f, 0.850549459f, 0.850952566f,
+  0.851355195f, 0.851757288f, 0.852158904f, 0.852559984f, 0.852960587f,
+  0.853360713f, 0.853760302f, 0.854159415f, 0.854557991f, 0.85495609f,
+  0.855353653f, 0.85575074f, 0.856147349f, 0.856543422f, 0.856938958f,
+  0.857334018f, 0.857728601f, 0.858122647f, 0.858516216f, 0.858909249f,
+  0.859301805f, 0.859693885f, 0.860085368f, 0.860476434f, 0.860866964f,
+  0.861256957f, 0.861646473f, 0.862035453f, 0.862423956f, 0.862811923f,
+  0.863199413f, 0.863586366f, 0.863972843f, 0.864358783f, 0.864744246f,
+  0.865129173f, 0.865513623f, 0.865897536f, 0.866280973f, 0.866663873f,
+  0.867046237f, 0.867428124f, 0.867809474f, 0.868190348f, 0.868570685f,
+  0.868950546f, 0.86932987f, 0.869708657f, 0.870086968f, 0.870464802f,
+  0.87084204f, 0.87121886f, 0.871595085f, 0.871970832f, 0.872346044f,
+  0.872720778f, 0.873094976f, 0.873468697f, 0.873841822f, 0.87421453f,
+  0.874586642f, 0.874958277f, 0.875329375f, 0.875699997f, 0.876070082f,
+  0.876439691f, 0.876808703f, 0.877177238f, 0.877545297f, 0.877912819f,
+  0.878279805f, 0.878646255f, 0.879012227f, 0.879377663f, 0.879742622f,
+  0.880106986f, 0.880470872f, 0.880834281f, 0.881197095f, 0.881559432f,
+  0.881921291f, 0.882282555f, 0.882643342f, 0.883003592f, 0.883363366f,
+  0.883722544f, 0.884081244f, 0.884439468f, 0.884797096f, 0.885154247f,
+  0.885510862f, 0.88586694f, 0.886222541f, 0.886577606f, 0.886932135f,
+  0.887286127f, 0.887639642f, 0.887992561f, 0.888345063f, 0.888696969f,
+  0.889048338f, 0.88939923f, 0.889749587f, 0.890099406f, 0.890448749f,
+  0.890797496f, 0.891145766f, 0.891493499f, 0.891840696f, 0.892187417f,
+  0.892533541f, 0.892879188f, 0.893224299f, 0.893568873f, 0.893912971f,
+  0.894256473f, 0.894599497f, 0.894941986f, 0.895283937f, 0.895625353f,
+  0.895966232f, 0.896306634f, 0.8966465f, 0.896985769f, 0.897324562f,
+  0.897662818f, 0.898000598f, 0.898337781f, 0.898674488f, 0.899010599f,
+  0.899346232f, 0.89968133f, 0.900015891f, 0.900349915f, 0.900683403f,
+  0.901016414f, 0.901348829f, 0.901680768f, 0.902012169f, 0.902342975f,
+  0.902673304f, 0.903003097f, 0.903332353f, 0.903661072f, 0.903989315f,
+  0.904316962f, 0.904644072f, 0.904970706f, 0.905296743f, 0.905622303f,
+  0.905947268f, 0.906271756f, 0.906595707f, 0.906919122f, 0.907242f,
+  0.907564342f, 0.907886088f, 0.908207357f, 0.90852809f, 0.908848345f,
+  0.909168005f, 0.909487128f, 0.909805715f, 0.910123765f, 0.910441279f,
+  0.910758257f, 0.911074758f, 0.911390662f, 0.91170603f, 0.912020862f,
+  0.912335157f, 0.912648976f, 0.912962198f, 0.913274884f, 0.913587034f,
+  0.913898647f, 0.914209783f, 0.914520323f, 0.914830327f, 0.915139794f,
+  0.915448725f, 0.91575712f, 0.916064978f, 0.916372299f, 0.916679084f,
+  0.916985273f, 0.917290986f, 0.917596161f, 0.917900801f, 0.918204844f,
+  0.91850841f, 0.918811381f, 0.919113874f, 0.919415772f, 0.919717133f,
+  0.920017958f, 0.920318305f, 0.920618057f, 0.920917213f, 0.921215892f,
+  0.921514034f, 0.92181164f, 0.92210865f, 0.922405183f, 0.92270112f,
+  0.922996521f, 0.923291445f, 0.923585773f, 0.923879504f, 0.924172759f,
+  0.924465477f, 0.9247576f, 0.925049245f, 0.925340295f, 0.925630808f,
+  0.925920784f, 0.926210225f, 0.926499128f, 0.926787496f, 0.927075267f,
+  0.927362502f, 0.92764926f, 0.927935421f, 0.928220987f, 0.928506076f,
+  0.928790629f, 0.929074585f, 0.929358006f, 0.929640889f, 0.929923236f,
+  0.930205047f, 0.930486262f, 0.93076694f, 0.931047082f, 0.931326687f,
+  0.931605756f, 0.931884289f, 0.932162225f, 0.932439625f, 0.932716489f,
+  0.932992816f, 0.933268547f, 0.933543801f, 0.93381846f, 0.934092522f,
+  0.934366107f, 0.934639156f, 0.934911609f, 0.935183525f, 0.935454845f,
+  0.935725689f, 0.935995936f, 0.936265647f, 0.936534822f, 0.93680346f,
+  0.937071502f, 0.937339008f, 0.937605977f, 0.93787235f, 0.938138247f,
+  0.938403547f, 0.938668311f, 0.938932478f, 0.93919611f, 0.939459205f,
+  0.939721763f, 0.939983726f, 0.940245211f, 0.940506041f, 0.940766394f,
+  0.941026151f, 0.941285372f, 0.941544056f, 0.941802204f, 0.942059755f,
+  0.942316771f, 0.94257319f, 0.942829072f, 0.943084419f, 0.943339229f,
+  0.943593442f, 0.94384712f, 0.944100261f, 0.944352806f, 0.944604814f,
+  0.944856286f, 0.945107222f, 0.945357561f, 0.945607305f, 0.945856571f,
+  0.946105242f, 0.946353376f, 0.946600914f, 0.946847916f, 0.947094381f,
+  0.94734025f, 0.947585583f, 0.947830379f, 0.948074579f, 0.948318243f,
+  0.94856137f, 0.948803902f, 0.949045897f, 0.949287295f, 0.949528158f,
+  0.949768484f, 0.950008273f, 0.950247467f, 0.950486064f, 0.950724125f,
+  0.950961649f, 0.951198637f, 0.95143503f, 0.951670885f, 0.951906145f,
+  0.952140868f, 0.952374995f, 0.952608585f, 0.95284164f, 0.953074098f,
+  0.953306019f, 0.953537405f, 0.953768194f, 0.953998446f, 0.954228103f,
+  0.954457223f, 0.954685748f, 0.954913735f, 0.955141187f, 0.955368042f,
+  0.955594361f, 0.955820084f, 0.95604527f, 0.95626986f, 0.956493914f,
+  0.956717432f, 0.956940353f, 0.957162678f, 0.957384527f, 0.95760572f,
+  0.957826436f, 0.958046496f, 0.958266079f, 0.958485067f, 0.958703458f,
+  0.958921313f, 0.959138632f, 0.959355354f, 0.95957154f, 0.95978713f,
+  0.960002124f, 0.960216641f, 0.960430503f, 0.960643888f, 0.960856616f,
+  0.961068869f, 0.961280465f, 0.961491585f, 0.961702049f, 0.961912036f,
+  0.962121427f, 0.962330222f, 0.962538481f, 0.962746143f, 0.962953269f,
+  0.9631598f, 0.963365793f, 0.963571191f, 0.963776052f, 0.963980377f,
+  0.964184046f, 0.964387238f, 0.964589775f, 0.964791834f, 0.964993238f,
+  0.965194106f, 0.965394437f, 0.965594172f, 0.965793371f, 0.965991974f,
+  0.966189981f, 0.966387451f, 0.966584384f, 0.966780722f, 0.966976464f,
+  0.967171669f, 0.967366278f, 0.967560351f, 0.967753828f, 0.967946768f,
+  0.968139112f, 0.96833086f, 0.968522072f, 0.968712747f, 0.968902826f,
+  0.969092309f, 0.969281256f, 0.969469607f, 0.969657362f, 0.96984458f,
+  0.970031261f, 0.970217347f, 0.970402837f, 0.97058779f, 0.970772147f,
+  0.970955908f, 0.971139133f, 0.971321821f, 0.971503913f, 0.97168541f,
+  0.97186631f, 0.972046733f, 0.972226501f, 0.972405732f, 0.972584367f,
+  0.972762465f, 0.972939968f, 0.973116875f, 0.973293245f, 0.973469019f,
+  0.973644257f, 0.973818898f, 0.973992944f, 0.974166453f, 0.974339366f,
+  0.974511743f, 0.974683523f, 0.974854708f, 0.975025356f, 0.975195408f,
+  0.975364864f, 0.975533783f, 0.975702107f, 0.975869894f, 0.976037085f,
+  0.97620368f, 0.976369739f, 0.976535201f, 0.976700068f, 0.976864398f,
+  0.977028131f, 0.977191329f, 0.977353871f, 0.977515936f, 0.977677345f,
+  0.977838218f, 0.977998495f, 0.978158236f, 0.97831738f, 0.978475928f,
+  0.97863394f, 0.978791356f, 0.978948176f, 0.979104459f, 0.979260147f,
+  0.979415238f, 0.979569793f, 0.979723752f, 0.979877114f, 0.980029881f,
+  0.980182111f, 0.980333805f, 0.980484843f, 0.980635345f, 0.980785251f,
+  0.98093462f, 0.981083393f, 0.98123157f, 0.981379211f, 0.981526256f,
+  0.981672704f, 0.981818557f, 0.981963873f, 0.982108593f, 0.982252717f,
+  0.982396305f, 0.982539296f, 0.982681692f, 0.982823551f, 0.982964814f,
+  0.983105481f, 0.983245611f, 0.983385086f, 0.983524024f, 0.983662426f,
+  0.983800232f, 0.983937442f, 0.984074056f, 0.984210074f, 0.984345555f,
+  0.984480441f, 0.984614789f, 0.984748483f, 0.984881639f, 0.98501426f,
+  0.985146224f, 0.985277653f, 0.985408485f, 0.985538721f, 0.985668421f,
+  0.985797524f, 0.985926032f, 0.986053944f, 0.986181319f, 0.986308098f,
+  0.986434281f, 0.986559927f, 0.986684918f, 0.986809373f, 0.986933291f,
+  0.987056553f, 0.987179279f, 0.987301409f, 0.987422943f, 0.987543941f,
+  0.987664342f, 0.987784147f, 0.987903357f, 0.988022029f, 0.988140106f,
+  0.988257587f, 0.988374472f, 0.98849082f, 0.988606513f, 0.988721669f,
+  0.988836288f, 0.988950253f, 0.98906368f, 0.989176512f, 0.989288747f,
+  0.989400446f, 0.98951149f, 0.989621997f, 0.989731967f, 0.989841282f,
+  0.989950061f, 0.990058184f, 0.99016583f, 0.99027282f, 0.990379214f,
+  0.990485072f, 0.990590334f, 0.990695f, 0.990799129f, 0.990902662f,
+  0.99100554f, 0.991107941f, 0.991209686f, 0.991310835f, 0.991411448f,
+  0.991511464f, 0.991610885f, 0.991709769f, 0.991807997f, 0.991905689f,
+  0.992002785f, 0.992099285f, 0.992195249f, 0.992290616f, 0.992385328f,
+  0.992479563f, 0.992573142f, 0.992666125f, 0.992758572f, 0.992850423f,
+  0.992941678f, 0.993032336f, 0.993122458f, 0.993211925f, 0.993300855f,
+  0.993389189f, 0.993476987f, 0.993564129f, 0.993650734f, 0.993736744f,
+  0.993822157f, 0.993906975f, 0.993991196f, 0.994074881f, 0.99415797f,
+  0.994240463f, 0.99432236f, 0.99440366f, 0.994484425f, 0.994564593f,
+  0.994644165f, 0.994723141f, 0.994801521f, 0.994879305f, 0.994956553f,
+  0.995033205f, 0.99510926f, 0.99518472f, 0.995259583f, 0.99533391f,
+  0.995407641f, 0.995480776f, 0.995553315f, 0.995625257f, 0.995696604f,
+  0.995767415f, 0.995837629f, 0.995907247f, 0.995976269f, 0.996044695f,
+  0.996112585f, 0.996179819f, 0.996246517f, 0.996312618f, 0.996378124f,
+  0.996443033f, 0.996507406f, 0.996571124f, 0.996634305f, 0.996696889f,
+  0.996758878f, 0.996820271f, 0.996881127f, 0.996941328f, 0.997000992f,
+  0.997060061f, 0.997118533f, 0.997176409f, 0.997233748f, 0.997290432f,
+  0.99734658f, 0.997402132f, 0.997457087f, 0.997511446f, 0.99756521f,
+  0.997618437f, 0.997671068f, 0.997723043f, 0.997774482f, 0.997825325f,
+  0.997875631f, 0.997925282f, 0.997974396f, 0.998022854f, 0.998070776f,
+  0.998118103f, 0.998164833f, 0.998211026f, 0.998256564f, 0.998301566f,
+  0.998345912f, 0.998389721f, 0.998432934f, 0.998475552f, 0.998517632f,
+  0.998559058f, 0.998599946f, 0.998640239f, 0.998679936f, 0.998719037f,
+  0.998757541f, 0.99879545f, 0.998832822f, 0.998869538f, 0.998905718f,
+  0.998941302f, 0.99897629f, 0.999010682f, 0.999044478f, 0.999077737f,
+  0.999110341f, 0.999142408f, 0.99917388f, 0.999204755f, 0.999235034f,
+  0.999264777f, 0.999293864f, 0.999322355f, 0.999350309f, 0.999377668f,
+  0.99940443f, 0.999430597f, 0.999456167f, 0.999481201f, 0.999505579f,
+  0.999529421f, 0.999552667f, 0.999575317f, 0.999597371f, 0.999618828f,
+  0.99963969f, 0.999660015f, 0.999679685f, 0.999698818f, 0.999717355f,
+  0.999735296f, 0.999752641f, 0.99976939f, 0.999785602f, 0.999801159f,
+  0.999816179f, 0.999830604f, 0.999844432f, 0.999857664f, 0.9998703f,
+  0.99988234f, 0.999893844f, 0.999904692f, 0.999915004f, 0.999924719f,
+  0.999933839f, 0.999942362f, 0.99995029f, 0.999957621f, 0.999964416f,
+  0.999970615f, 0.999976158f, 0.999981165f, 0.999985576f, 0.99998939f,
+  0.999992669f, 0.999995291f, 0.999997377f, 0.999998808f, 0.999999702f,
+  1.f
+};
+
+static const float * const fft_static_sin[6] =
+{
+  fft_static_sin_256,
+  fft_static_sin_512,
+  fft_static_sin_1024,
+  fft_static_sin_2048,
+  fft_static_sin_4096,
+  fft_static_sin_8192
+};
+
+#endif /* RTA_FLOAT_TYPE */
+
+#if (RTA_REAL_TYPE == RTA_DOUBLE_TYPE)
+
+#define FFT_STATIC_SIN 1
+
+static const double fft_static_sin_256[321] =
+{
+  0, 0.024541228522912288, 0.049067674327418015,
+  0.073564563599667426, 0.098017140329560604, 0.1224106751992162,
+  0.14673047445536175, 0.17096188876030122, 0.19509032201612825,
+  0.2191012401568698, 0.24298017990326387, 0.26671275747489837,
+  0.29028467725446233, 0.31368174039889152, 0.33688985339222005,
+  0.35989503653498811, 0.38268343236508978, 0.40524131400498986,
+  0.42755509343028208, 0.44961132965460654, 0.47139673682599764,
+  0.49289819222978404, 0.51410274419322166, 0.53499761988709715,
+  0.55557023301960218, 0.57580819141784534, 0.59569930449243336,
+  0.61523159058062682, 0.63439328416364549, 0.65317284295377676,
+  0.67155895484701833, 0.68954054473706683, 0.70710678118654746,
+  0.72424708295146689, 0.74095112535495911, 0.75720884650648446,
+  0.77301045336273699, 0.78834642762660623, 0.80320753148064483,
+  0.81758481315158371, 0.83146961230254524, 0.84485356524970701,
+  0.85772861000027212, 0.87008699110871135, 0.88192126434835494,
+  0.89322430119551532, 0.90398929312344334, 0.91420975570353069,
+  0.92387953251128674, 0.93299279883473885, 0.94154406518302081,
+  0.94952818059303667, 0.95694033573220894, 0.96377606579543984,
+  0.97003125319454397, 0.97570213003852857, 0.98078528040323043,
+  0.98527764238894122, 0.98917650996478101, 0.99247953459870997,
+  0.99518472667219682, 0.99729045667869021, 0.99879545620517241,
+  0.99969881869620425, 1, 0.99969881869620425,
+  0.99879545620517241, 0.99729045667869021, 0.99518472667219693,
+  0.99247953459870997, 0.98917650996478101, 0.98527764238894122,
+  0.98078528040323043, 0.97570213003852857, 0.97003125319454397,
+  0.96377606579543984, 0.95694033573220882, 0.94952818059303667,
+  0.94154406518302081, 0.93299279883473896, 0.92387953251128674,
+  0.91420975570353069, 0.90398929312344334, 0.89322430119551532,
+  0.88192126434835505, 0.87008699110871146, 0.85772861000027212,
+  0.84485356524970712, 0.83146961230254524, 0.81758481315158371,
+  0.80320753148064494, 0.78834642762660634, 0.77301045336273699,
+  0.75720884650648457, 0.74095112535495911, 0.724247082951467,
+  0.70710678118654757, 0.68954054473706694, 0.67155895484701833,
+  0.65317284295377676, 0.63439328416364549, 0.61523159058062682,
+  0.59569930449243347, 0.57580819141784534, 0.55557023301960229,
+  0.53499761988709726, 0.51410274419322166, 0.49289819222978409,
+  0.47139673682599781, 0.4496113296546066, 0.4275550934302822,
+  0.40524131400498986, 0.38268343236508984, 0.35989503653498828,
+  0.33688985339222005, 0.31368174039889157, 0.29028467725446233,
+  0.26671275747489842, 0.24298017990326398, 0.21910124015686977,
+  0.19509032201612833, 0.17096188876030136, 0.14673047445536175,
+  0.12241067519921628, 0.09801714032956077, 0.073564563599667454,
+  0.049067674327418126, 0.024541228522912264, 0,
+  -0.024541228522912288, -0.049067674327418015, -0.073564563599667426,
+  -0.098017140329560604, -0.1224106751992162, -0.14673047445536175,
+  -0.17096188876030122, -0.19509032201612825, -0.2191012401568698,
+  -0.24298017990326387, -0.26671275747489837, -0.29028467725446233,
+  -0.31368174039889152, -0.33688985339222005, -0.35989503653498811,
+  -0.38268343236508978, -0.40524131400498986, -0.42755509343028208,
+  -0.44961132965460654, -0.47139673682599764, -0.49289819222978404,
+  -0.51410274419322166, -0.53499761988709715, -0.55557023301960218,
+  -0.57580819141784534, -0.59569930449243336, -0.61523159058062682,
+  -0.63439328416364549, -0.65317284295377676, -0.67155895484701833,
+  -0.68954054473706683, -0.70710678118654746, -0.72424708295146689,
+  -0.74095112535495911, -0.75720884650648446, -0.77301045336273699,
+  -0.78834642762660623, -0.80320753148064483, -0.81758481315158371,
+  -0.83146961230254524, -0.84485356524970701, -0.85772861000027212,
+  -0.87008699110871135, -0.88192126434835494, -0.89322430119551532,
+  -0.90398929312344334, -0.91420975570353069, -0.92387953251128674,
+  -0.93299279883473885, -0.94154406518302081, -0.94952818059303667,
+  -0.95694033573220894, -0.96377606579543984, -0.97003125319454397,
+  -0.97570213003852857, -0.98078528040323043, -0.98527764238894122,
+  -0.98917650996478101, -0.99247953459870997, -0.99518472667219682,
+  -0.99729045667869021, -0.99879545620517241, -0.99969881869620425,
+  -1, -0.99969881869620425, -0.99879545620517241,
+  -0.99729045667869021, -0.99518472667219693, -0.99247953459870997,
+  -0.98917650996478101, -0.98527764238894122, -0.98078528040323043,
+  -0.97570213003852857, -0.97003125319454397, -0.96377606579543984,
+  -0.95694033573220882, -0.94952818059303667, -0.94154406518302081,
+  -0.93299279883473896, -0.92387953251128674, -0.91420975570353069,
+  -0.90398929312344334, -0.89322430119551532, -0.88192126434835505,
+  -0.87008699110871146, -0.85772861000027212, -0.84485356524970712,
+  -0.83146961230254524, -0.81758481315158371, -0.80320753148064494,
+  -0.78834642762660634, -0.77301045336273699, -0.75720884650648457,
+  -0.74095112535495911, -0.724247082951467, -0.70710678118654757,
+  -0.68954054473706694, -0.67155895484701833, -0.65317284295377676,
+  -0.63439328416364549, -0.61523159058062682, -0.59569930449243347,
+  -0.57580819141784534, -0.55557023301960229, -0.53499761988709726,
+  -0.51410274419322166, -0.49289819222978409, -0.47139673682599781,
+  -0.4496113296546066, -0.4275550934302822, -0.40524131400498986,
+  -0.38268343236508984, -0.35989503653498828, -0.33688985339222005,
+  -0.31368174039889157, -0.29028467725446233, -0.26671275747489842,
+  -0.24298017990326398, -0.21910124015686977, -0.19509032201612833,
+  -0.17096188876030136, -0.14673047445536175, -0.12241067519921628,
+  -0.09801714032956077, -0.073564563599667454, -0.049067674327418126,
+  -0.024541228522912264, 0, 0.024541228522912288,
+  0.049067674327418015, 0.073564563599667426, 0.098017140329560604,
+  0.1224106751992162, 0.14673047445536175, 0.17096188876030122,
+  0.19509032201612825, 0.2191012401568698, 0.24298017990326387,
+  0.26671275747489837, 0.29028467725446233, 0.31368174039889152,
+  0.33688985339222005, 0.35989503653498811, 0.38268343236508978,
+  0.40524131400498986, 0.42755509343028208, 0.44961132965460654,
+  0.47139673682599764, 0.49289819222978404, 0.51410274419322166,
+  0.53499761988709715, 0.55557023301960218, 0.57580819141784534,
+  0.59569930449243336, 0.61523159058062682, 0.63439328416364549,
+  0.65317284295377676, 0.67155895484701833, 0.68954054473706683,
+  0.70710678118654746, 0.72424708295146689, 0.74095112535495911,
+  0.75720884650648446, 0.77301045336273699, 0.78834642762660623,
+  0.80320753148064483, 0.81758481315158371, 0.83146961230254524,
+  0.84485356524970701, 0.85772861000027212, 0.87008699110871135,
+  0.88192126434835494, 0.89322430119551532, 0.90398929312344334,
+  0.91420975570353069, 0.92387953251128674, 0.93299279883473885,
+  0.94154406518302081, 0.94952818059303667, 0.95694033573220894,
+  0.96377606579543984, 0.97003125319454397, 0.97570213003852857,
+  0.98078528040323043, 0.98527764238894122, 0.98917650996478101,
+  0.99247953459870997, 0.99518472667219682, 0.99729045667869021,
+  0.99879545620517241, 0.99969881869620425, 1
+};
+
+static const double fft_static_sin_512[641] =
+{
+  0, 0.012271538285719925, 0.024541228522912288,
+  0.036807222941358832, 0.049067674327418015, 0.061320736302208578,
+  0.073564563599667426, 0.085797312344439894, 0.098017140329560604,
+  0.11022220729388306, 0.1224106751992162, 0.13458070850712617,
+  0.14673047445536175, 0.15885814333386145, 0.17096188876030122,
+  0.18303988795514095, 0.19509032201612825, 0.20711137619221856,
+  0.2191012401568698, 0.23105810828067111, 0.24298017990326387,
+  0.25486565960451457, 0.26671275747489837, 0.27851968938505306,
+  0.29028467725446233, 0.30200594931922808, 0.31368174039889152,
+  0.32531029216226293, 0.33688985339222005, 0.34841868024943456,
+  0.35989503653498811, 0.37131719395183754, 0.38268343236508978,
+  0.3939920400610481, 0.40524131400498986, 0.41642956009763715,
+  0.42755509343028208, 0.43861623853852766, 0.44961132965460654,
+  0.46053871095824001, 0.47139673682599764, 0.48218377207912272,
+  0.49289819222978404, 0.50353838372571758, 0.51410274419322166,
+  0.52458968267846895, 0.53499761988709715, 0.54532498842204646,
+  0.55557023301960218, 0.56573181078361312, 0.57580819141784534,
+  0.58579785745643886, 0.59569930449243336, 0.60551104140432555,
+  0.61523159058062682, 0.62485948814238634, 0.63439328416364549,
+  0.64383154288979139, 0.65317284295377676, 0.66241577759017178,
+  0.67155895484701833, 0.68060099779545302, 0.68954054473706683,
+  0.69837624940897292, 0.70710678118654746, 0.71573082528381859,
+  0.72424708295146689, 0.73265427167241282, 0.74095112535495911,
+  0.74913639452345926, 0.75720884650648446, 0.76516726562245896,
+  0.77301045336273699, 0.78073722857209438, 0.78834642762660623,
+  0.79583690460888346, 0.80320753148064483, 0.81045719825259477,
+  0.81758481315158371, 0.82458930278502529, 0.83146961230254524,
+  0.83822470555483797, 0.84485356524970701, 0.8513551931052652,
+  0.85772861000027212, 0.8639728561215867, 0.87008699110871135,
+  0.8760700941954066, 0.88192126434835494, 0.88763962040285393,
+  0.89322430119551532, 0.89867446569395382, 0.90398929312344334,
+  0.90916798309052227, 0.91420975570353069, 0.91911385169005777,
+  0.92387953251128674, 0.92850608047321548, 0.93299279883473885,
+  0.93733901191257496, 0.94154406518302081, 0.94560732538052128,
+  0.94952818059303667, 0.95330604035419375, 0.95694033573220894,
+  0.96043051941556579, 0.96377606579543984, 0.96697647104485207,
+  0.97003125319454397, 0.97293995220556007, 0.97570213003852857,
+  0.97831737071962765, 0.98078528040323043, 0.98310548743121629,
+  0.98527764238894122, 0.98730141815785843, 0.98917650996478101,
+  0.99090263542778001, 0.99247953459870997, 0.99390697000235606,
+  0.99518472667219682, 0.996312612182778, 0.99729045667869021,
+  0.99811811290014918, 0.99879545620517241, 0.99932238458834954,
+  0.99969881869620425, 0.9999247018391445, 1,
+  0.9999247018391445, 0.99969881869620425, 0.99932238458834954,
+  0.99879545620517241, 0.99811811290014918, 0.99729045667869021,
+  0.996312612182778, 0.99518472667219693, 0.99390697000235606,
+  0.99247953459870997, 0.99090263542778001, 0.98917650996478101,
+  0.98730141815785843, 0.98527764238894122, 0.98310548743121629,
+  0.98078528040323043, 0.97831737071962765, 0.97570213003852857,
+  0.97293995220556018, 0.97003125319454397, 0.96697647104485207,
+  0.96377606579543984, 0.96043051941556579, 0.95694033573220882,
+  0.95330604035419386, 0.94952818059303667, 0.94560732538052128,
+  0.94154406518302081, 0.93733901191257496, 0.93299279883473896,
+  0.92850608047321559, 0.92387953251128674, 0.91911385169005777,
+  0.91420975570353069, 0.90916798309052238, 0.90398929312344334,
+  0.89867446569395382, 0.89322430119551532, 0.88763962040285393,
+  0.88192126434835505, 0.8760700941954066, 0.87008699110871146,
+  0.86397285612158681, 0.85772861000027212, 0.8513551931052652,
+  0.84485356524970712, 0.83822470555483808, 0.83146961230254524,
+  0.82458930278502529, 0.81758481315158371, 0.81045719825259477,
+  0.80320753148064494, 0.79583690460888357, 0.78834642762660634,
+  0.78073722857209449, 0.77301045336273699, 0.76516726562245896,
+  0.75720884650648457, 0.74913639452345937, 0.74095112535495911,
+  0.73265427167241282, 0.724247082951467, 0.71573082528381859,
+  0.70710678118654757, 0.69837624940897292, 0.68954054473706694,
+  0.68060099779545313, 0.67155895484701833, 0.66241577759017178,
+  0.65317284295377676, 0.6438315428897915, 0.63439328416364549,
+  0.62485948814238645, 0.61523159058062682, 0.60551104140432555,
+  0.59569930449243347, 0.58579785745643886, 0.57580819141784534,
+  0.56573181078361323, 0.55557023301960229, 0.54532498842204646,
+  0.53499761988709726, 0.52458968267846884, 0.51410274419322166,
+  0.50353838372571758, 0.49289819222978409, 0.48218377207912283,
+  0.47139673682599781, 0.46053871095824001, 0.4496113296546066,
+  0.43861623853852771, 0.4275550934302822, 0.41642956009763732,
+  0.40524131400498986, 0.3939920400610481, 0.38268343236508984,
+  0.3713171939518376, 0.35989503653498828, 0.34841868024943451,
+  0.33688985339222005, 0.32531029216226298, 0.31368174039889157,
+  0.3020059493192282, 0.29028467725446233, 0.27851968938505306,
+  0.26671275747489842, 0.25486565960451463, 0.24298017990326398,
+  0.23105810828067128, 0.21910124015686977, 0.20711137619221856,
+  0.19509032201612833, 0.18303988795514106, 0.17096188876030136,
+  0.15885814333386139, 0.14673047445536175, 0.13458070850712622,
+  0.12241067519921628, 0.11022220729388318, 0.09801714032956077,
+  0.08579731234443988, 0.073564563599667454, 0.061320736302208648,
+  0.049067674327418126, 0.036807222941358991, 0.024541228522912264,
+  0.012271538285719944, 0, -0.012271538285719925,
+  -0.024541228522912288, -0.036807222941358832, -0.049067674327418015,
+  -0.061320736302208578, -0.073564563599667426, -0.085797312344439894,
+  -0.098017140329560604, -0.11022220729388306, -0.1224106751992162,
+  -0.13458070850712617, -0.14673047445536175, -0.15885814333386145,
+  -0.17096188876030122, -0.18303988795514095, -0.19509032201612825,
+  -0.20711137619221856, -0.2191012401568698, -0.23105810828067111,
+  -0.24298017990326387, -0.25486565960451457, -0.26671275747489837,
+  -0.27851968938505306, -0.29028467725446233, -0.30200594931922808,
+  -0.31368174039889152, -0.32531029216226293, -0.33688985339222005,
+  -0.34841868024943456, -0.35989503653498811, -0.37131719395183754,
+  -0.38268343236508978, -0.3939920400610481, -0.40524131400498986,
+  -0.41642956009763715, -0.42755509343028208, -0.43861623853852766,
+  -0.44961132965460654, -0.46053871095824001, -0.47139673682599764,
+  -0.48218377207912272, -0.49289819222978404, -0.50353838372571758,
+  -0.51410274419322166, -0.52458968267846895, -0.53499761988709715,
+  -0.54532498842204646, -0.55557023301960218, -0.56573181078361312,
+  -0.57580819141784534, -0.58579785745643886, -0.59569930449243336,
+  -0.60551104140432555, -0.61523159058062682, -0.62485948814238634,
+  -0.63439328416364549, -0.64383154288979139, -0.65317284295377676,
+  -0.66241577759017178, -0.67155895484701833, -0.68060099779545302,
+  -0.68954054473706683, -0.69837624940897292, -0.70710678118654746,
+  -0.71573082528381859, -0.72424708295146689, -0.73265427167241282,
+  -0.74095112535495911, -0.74913639452345926, -0.75720884650648446,
+  -0.76516726562245896, -0.77301045336273699, -0.78073722857209438,
+  -0.78834642762660623, -0.79583690460888346, -0.80320753148064483,
+  -0.81045719825259477, -0.81758481315158371, -0.82458930278502529,
+  -0.83146961230254524, -0.83822470555483797, -0.84485356524970701,
+  -0.8513551931052652, -0.85772861000027212, -0.8639728561215867,
+  -0.87008699110871135, -0.8760700941954066, -0.88192126434835494,
+  -0.88763962040285393, -0.89322430119551532, -0.89867446569395382,
+  -0.90398929312344334, -0.90916798309052227, -0.91420975570353069,
+  -0.91911385169005777, -0.92387953251128674, -0.92850608047321548,
+  -0.93299279883473885, -0.93733901191257496, -0.94154406518302081,
+  -0.94560732538052128, -0.94952818059303667, -0.95330604035419375,
+  -0.95694033573220894, -0.96043051941556579, -0.96377606579543984,
+  -0.96697647104485207, -0.97003125319454397, -0.97293995220556007,
+  -0.97570213003852857, -0.97831737071962765, -0.98078528040323043,
+  -0.98310548743121629, -0.98527764238894122, -0.98730141815785843,
+  -0.98917650996478101, -0.99090263542778001, -0.99247953459870997,
+  -0.99390697000235606, -0.99518472667219682, -0.996312612182778,
+  -0.99729045667869021, -0.99811811290014918, -0.99879545620517241,
+  -0.99932238458834954, -0.99969881869620425, -0.9999247018391445,
+  -1, -0.9999247018391445, -0.99969881869620425,
+  -0.99932238458834954, -0.99879545620517241, -0.99811811290014918,
+  -0.99729045667869021, -0.996312612182778, -0.99518472667219693,
+  -0.99390697000235606, -0.99247953459870997, -0.99090263542778001,
+  -0.98917650996478101, -0.98730141815785843, -0.98527764238894122,
+  -0.98310548743121629, -0.98078528040323043, -0.97831737071962765,
+  -0.97570213003852857, -0.97293995220556018, -0.97003125319454397,
+  -0.96697647104485207, -0.96377606579543984, -0.96043051941556579,
+  -0.95694033573220882, -0.95330604035419386, -0.94952818059303667,
+  -0.94560732538052128, -0.94154406518302081, -0.93733901191257496,
+  -0.93299279883473896, -0.92850608047321559, -0.92387953251128674,
+  -0.91911385169005777, -0.91420975570353069, -0.90916798309052238,
+  -0.90398929312344334, -0.89867446569395382, -0.89322430119551532,
+  -0.88763962040285393, -0.88192126434835505, -0.8760700941954066,
+  -0.87008699110871146, -0.86397285612158681, -0.85772861000027212,
+  -0.8513551931052652, -0.84485356524970712, -0.83822470555483808,
+  -0.83146961230254524, -0.82458930278502529, -0.81758481315158371,
+  -0.81045719825259477, -0.80320753148064494, -0.79583690460888357,
+  -0.78834642762660634, -0.78073722857209449, -0.77301045336273699,
+  -0.76516726562245896, -0.75720884650648457, -0.74913639452345937,
+  -0.74095112535495911, -0.73265427167241282, -0.724247082951467,
+  -0.71573082528381859, -0.70710678118654757, -0.69837624940897292,
+  -0.68954054473706694, -0.68060099779545313, -0.67155895484701833,
+  -0.66241577759017178, -0.65317284295377676, -0.6438315428897915,
+  -0.63439328416364549, -0.62485948814238645, -0.61523159058062682,
+  -0.60551104140432555, -0.59569930449243347, -0.58579785745643886,
+  -0.57580819141784534, -0.56573181078361323, -0.55557023301960229,
+  -0.54532498842204646, -0.53499761988709726, -0.52458968267846884,
+  -0.51410274419322166, -0.50353838372571758, -0.49289819222978409,
+  -0.48218377207912283, -0.47139673682599781, -0.46053871095824001,
+  -0.4496113296546066, -0.43861623853852771, -0.4275550934302822,
+  -0.41642956009763732, -0.40524131400498986, -0.3939920400610481,
+  -0.38268343236508984, -0.3713171939518376, -0.35989503653498828,
+  -0.34841868024943451, -0.33688985339222005, -0.32531029216226298,
+  -0.31368174039889157, -0.3020059493192282, -0.29028467725446233,
+  -0.27851968938505306, -0.26671275747489842, -0.25486565960451463,
+  -0.24298017990326398, -0.23105810828067128, -0.21910124015686977,
+  -0.20711137619221856, -0.19509032201612833, -0.18303988795514106,
+  -0.17096188876030136, -0.15885814333386139, -0.14673047445536175,
+  -0.13458070850712622, -0.12241067519921628, -0.11022220729388318,
+  -0.09801714032956077, -0.08579731234443988, -0.073564563599667454,
+  -0.061320736302208648, -0.049067674327418126, -0.036807222941358991,
+  -0.024541228522912264, -0.012271538285719944, 0,
+  0.012271538285719925, 0.024541228522912288, 0.036807222941358832,
+  0.049067674327418015, 0.061320736302208578, 0.073564563599667426,
+  0.085797312344439894, 0.098017140329560604, 0.11022220729388306,
+  0.1224106751992162, 0.13458070850712617, 0.14673047445536175,
+  0.15885814333386145, 0.17096188876030122, 0.18303988795514095,
+  0.19509032201612825, 0.20711137619221856, 0.2191012401568698,
+  0.23105810828067111, 0.24298017990326387, 0.25486565960451457,
+  0.26671275747489837, 0.27851968938505306, 0.29028467725446233,
+  0.30200594931922808, 0.31368174039889152, 0.32531029216226293,
+  0.33688985339222005, 0.34841868024943456, 0.35989503653498811,
+  0.37131719395183754, 0.38268343236508978, 0.3939920400610481,
+  0.40524131400498986, 0.41642956009763715, 0.42755509343028208,
+  0.43861623853852766, 0.44961132965460654, 0.46053871095824001,
+  0.47139673682599764, 0.48218377207912272, 0.49289819222978404,
+  0.50353838372571758, 0.51410274419322166, 0.52458968267846895,
+  0.53499761988709715, 0.54532498842204646, 0.55557023301960218,
+  0.56573181078361312, 0.57580819141784534, 0.58579785745643886,
+  0.59569930449243336, 0.60551104140432555, 0.61523159058062682,
+  0.62485948814238634, 0.63439328416364549, 0.64383154288979139,
+  0.65317284295377676, 0.66241577759017178, 0.67155895484701833,
+  0.68060099779545302, 0.68954054473706683, 0.69837624940897292,
+  0.70710678118654746, 0.71573082528381859, 0.72424708295146689,
+  0.73265427167241282, 0.74095112535495911, 0.74913639452345926,
+  0.75720884650648446, 0.76516726562245896, 0.77301045336273699,
+  0.78073722857209438, 0.78834642762660623, 0.79583690460888346,
+  0.80320753148064483, 0.81045719825259477, 0.81758481315158371,
+  0.82458930278502529, 0.83146961230254524, 0.83822470555483797,
+  0.84485356524970701, 0.8513551931052652, 0.85772861000027212,
+  0.8639728561215867, 0.87008699110871135, 0.8760700941954066,
+  0.88192126434835494, 0.88763962040285393, 0.89322430119551532,
+  0.89867446569395382, 0.90398929312344334, 0.90916798309052227,
+  0.91420975570353069, 0.91911385169005777, 0.92387953251128674,
+  0.92850608047321548, 0.93299279883473885, 0.93733901191257496,
+  0.94154406518302081, 0.94560732538052128, 0.94952818059303667,
+  0.95330604035419375, 0.95694033573220894, 0.96043051941556579,
+  0.96377606579543984, 0.96697647104485207, 0.97003125319454397,
+  0.97293995220556007, 0.97570213003852857, 0.97831737071962765,
+  0.98078528040323043, 0.98310548743121629, 0.98527764238894122,
+  0.98730141815785843, 0.98917650996478101, 0.99090263542778001,
+  0.99247953459870997, 0.99390697000235606, 0.99518472667219682,
+  0.996312612182778, 0.99729045667869021, 0.99811811290014918,
+  0.99879545620517241, 0.99932238458834954, 0.99969881869620425,
+  0.9999247018391445, 1
+};
+
+static const double fft_static_sin_1024[1281] =
+{
+  0, 0.0061358846491544753, 0.012271538285719925,
+  0.01840672990580482, 0.024541228522912288, 0.030674803176636626,
+  0.036807222941358832, 0.04293825693494082, 0.049067674327418015,
+  0.055195244349689934, 0.061320736302208578, 0.067443919563664051,
+  0.073564563599667426, 0.079682437971430126, 0.085797312344439894,
+  0.091908956497132724, 0.098017140329560604, 0.10412163387205459,
+  0.11022220729388306, 0.11631863091190475, 0.1224106751992162,
+  0.12849811079379317, 0.13458070850712617, 0.14065823933284921,
+  0.14673047445536175, 0.15279718525844344, 0.15885814333386145,
+  0.16491312048996992, 0.17096188876030122, 0.17700422041214875,
+  0.18303988795514095, 0.18906866414980619, 0.19509032201612825,
+  0.2011046348420919, 0.20711137619221856, 0.21311031991609136,
+  0.2191012401568698, 0.22508391135979283, 0.23105810828067111,
+  0.2370236059943672, 0.24298017990326387, 0.24892760574572015,
+  0.25486565960451457, 0.26079411791527551, 0.26671275747489837,
+  0.27262135544994898, 0.27851968938505306, 0.28440753721127188,
+  0.29028467725446233, 0.29615088824362379, 0.30200594931922808,
+  0.30784964004153487, 0.31368174039889152, 0.31950203081601569,
+  0.32531029216226293, 0.33110630575987643, 0.33688985339222005,
+  0.34266071731199438, 0.34841868024943456, 0.35416352542049034,
+  0.35989503653498811, 0.36561299780477385, 0.37131719395183754,
+  0.37700741021641826, 0.38268343236508978, 0.38834504669882625,
+  0.3939920400610481, 0.39962419984564679, 0.40524131400498986,
+  0.41084317105790391, 0.41642956009763715, 0.42200027079979968,
+  0.42755509343028208, 0.43309381885315196, 0.43861623853852766,
+  0.4441221445704292, 0.44961132965460654, 0.45508358712634384,
+  0.46053871095824001, 0.46597649576796618, 0.47139673682599764,
+  0.47679923006332209, 0.48218377207912272, 0.487550160148436,
+  0.49289819222978404, 0.49822766697278187, 0.50353838372571758,
+  0.50883014254310699, 0.51410274419322166, 0.51935599016558964,
+  0.52458968267846895, 0.52980362468629461, 0.53499761988709715,
+  0.54017147272989285, 0.54532498842204646, 0.55045797293660481,
+  0.55557023301960218, 0.56066157619733603, 0.56573181078361312,
+  0.57078074588696726, 0.57580819141784534, 0.58081395809576453,
+  0.58579785745643886, 0.59075970185887416, 0.59569930449243336,
+  0.60061647938386897, 0.60551104140432555, 0.61038280627630948,
+  0.61523159058062682, 0.6200572117632891, 0.62485948814238634,
+  0.62963823891492698, 0.63439328416364549, 0.63912444486377573,
+  0.64383154288979139, 0.64851440102211244, 0.65317284295377676,
+  0.65780669329707864, 0.66241577759017178, 0.66699992230363747,
+  0.67155895484701833, 0.67609270357531592, 0.68060099779545302,
+  0.68508366777270036, 0.68954054473706683, 0.693971460889654,
+  0.69837624940897292, 0.7027547444572253, 0.70710678118654746,
+  0.71143219574521643, 0.71573082528381859, 0.72000250796138165,
+  0.72424708295146689, 0.7284643904482252, 0.73265427167241282,
+  0.73681656887736979, 0.74095112535495911, 0.74505778544146595,
+  0.74913639452345926, 0.75318679904361241, 0.75720884650648446,
+  0.76120238548426178, 0.76516726562245896, 0.76910333764557959,
+  0.77301045336273699, 0.77688846567323244, 0.78073722857209438,
+  0.78455659715557524, 0.78834642762660623, 0.79210657730021239,
+  0.79583690460888346, 0.79953726910790501, 0.80320753148064483,
+  0.80684755354379922, 0.81045719825259477, 0.8140363297059483,
+  0.81758481315158371, 0.82110251499110465, 0.82458930278502529,
+  0.8280450452577558, 0.83146961230254524, 0.83486287498638001,
+  0.83822470555483797, 0.84155497743689833, 0.84485356524970701,
+  0.84812034480329712, 0.8513551931052652, 0.85455798836540053,
+  0.85772861000027212, 0.86086693863776731, 0.8639728561215867,
+  0.86704624551569265, 0.87008699110871135, 0.87309497841829009,
+  0.8760700941954066, 0.87901222642863341, 0.88192126434835494,
+  0.88479709843093779, 0.88763962040285393, 0.89044872324475788,
+  0.89322430119551532, 0.89596624975618511, 0.89867446569395382,
+  0.90134884704602203, 0.90398929312344334, 0.90659570451491533,
+  0.90916798309052227, 0.91170603200542988, 0.91420975570353069,
+  0.9166790599210427, 0.91911385169005777, 0.9215140393420419,
+  0.92387953251128674, 0.92621024213831127, 0.92850608047321548,
+  0.93076696107898371, 0.93299279883473885, 0.9351835099389475,
+  0.93733901191257496, 0.93945922360218992, 0.94154406518302081,
+  0.94359345816196039, 0.94560732538052128, 0.94758559101774109,
+  0.94952818059303667, 0.95143502096900834, 0.95330604035419375,
+  0.95514116830577067, 0.95694033573220894, 0.9587034748958716,
+  0.96043051941556579, 0.96212140426904158, 0.96377606579543984,
+  0.9653944416976894, 0.96697647104485207, 0.96852209427441727,
+  0.97003125319454397, 0.97150389098625178, 0.97293995220556007,
+  0.97433938278557586, 0.97570213003852857, 0.97702814265775439,
+  0.97831737071962765, 0.97956976568544052, 0.98078528040323043,
+  0.98196386910955524, 0.98310548743121629, 0.98421009238692903,
+  0.98527764238894122, 0.98630809724459867, 0.98730141815785843,
+  0.98825756773074946, 0.98917650996478101, 0.99005821026229712,
+  0.99090263542778001, 0.99170975366909953, 0.99247953459870997,
+  0.9932119492347945, 0.99390697000235606, 0.99456457073425542,
+  0.99518472667219682, 0.99576741446765982, 0.996312612182778,
+  0.99682029929116567, 0.99729045667869021, 0.99772306664419164,
+  0.99811811290014918, 0.99847558057329477, 0.99879545620517241,
+  0.99907772775264536, 0.99932238458834954, 0.99952941750109314,
+  0.99969881869620425, 0.9998305817958234, 0.9999247018391445,
+  0.99998117528260111, 1, 0.99998117528260111,
+  0.9999247018391445, 0.9998305817958234, 0.99969881869620425,
+  0.99952941750109314, 0.99932238458834954, 0.99907772775264536,
+  0.99879545620517241, 0.99847558057329477, 0.99811811290014918,
+  0.99772306664419164, 0.99729045667869021, 0.99682029929116567,
+  0.996312612182778, 0.99576741446765982, 0.99518472667219693,
+  0.99456457073425542, 0.99390697000235606, 0.9932119492347945,
+  0.99247953459870997, 0.99170975366909953, 0.99090263542778001,
+  0.99005821026229712, 0.98917650996478101, 0.98825756773074946,
+  0.98730141815785843, 0.98630809724459867, 0.98527764238894122,
+  0.98421009238692903, 0.98310548743121629, 0.98196386910955524,
+  0.98078528040323043, 0.97956976568544052, 0.97831737071962765,
+  0.97702814265775439, 0.97570213003852857, 0.97433938278557586,
+  0.97293995220556018, 0.97150389098625178, 0.97003125319454397,
+  0.96852209427441738, 0.96697647104485207, 0.9653944416976894,
+  0.96377606579543984, 0.96212140426904158, 0.96043051941556579,
+  0.9587034748958716, 0.95694033573220882, 0.95514116830577078,
+  0.95330604035419386, 0.95143502096900834, 0.94952818059303667,
+  0.94758559101774109, 0.94560732538052128, 0.94359345816196039,
+  0.94154406518302081, 0.93945922360218992, 0.93733901191257496,
+  0.93518350993894761, 0.93299279883473896, 0.93076696107898371,
+  0.92850608047321559, 0.92621024213831138, 0.92387953251128674,
+  0.92151403934204201, 0.91911385169005777, 0.9166790599210427,
+  0.91420975570353069, 0.91170603200542988, 0.90916798309052238,
+  0.90659570451491533, 0.90398929312344334, 0.90134884704602203,
+  0.89867446569395382, 0.89596624975618522, 0.89322430119551532,
+  0.89044872324475788, 0.88763962040285393, 0.88479709843093779,
+  0.88192126434835505, 0.87901222642863353, 0.8760700941954066,
+  0.87309497841829009, 0.87008699110871146, 0.86704624551569265,
+  0.86397285612158681, 0.86086693863776731, 0.85772861000027212,
+  0.85455798836540053, 0.8513551931052652, 0.84812034480329723,
+  0.84485356524970712, 0.84155497743689844, 0.83822470555483808,
+  0.83486287498638001, 0.83146961230254524, 0.8280450452577558,
+  0.82458930278502529, 0.82110251499110465, 0.81758481315158371,
+  0.81403632970594841, 0.81045719825259477, 0.80684755354379933,
+  0.80320753148064494, 0.79953726910790501, 0.79583690460888357,
+  0.79210657730021239, 0.78834642762660634, 0.78455659715557524,
+  0.78073722857209449, 0.77688846567323244, 0.77301045336273699,
+  0.7691033376455797, 0.76516726562245896, 0.76120238548426178,
+  0.75720884650648457, 0.75318679904361252, 0.74913639452345937,
+  0.74505778544146606, 0.74095112535495911, 0.7368165688773699,
+  0.73265427167241282, 0.7284643904482252, 0.724247082951467,
+  0.72000250796138165, 0.71573082528381859, 0.71143219574521643,
+  0.70710678118654757, 0.7027547444572253, 0.69837624940897292,
+  0.693971460889654, 0.68954054473706694, 0.68508366777270036,
+  0.68060099779545313, 0.67609270357531603, 0.67155895484701833,
+  0.66699992230363747, 0.66241577759017178, 0.65780669329707864,
+  0.65317284295377676, 0.64851440102211255, 0.6438315428897915,
+  0.63912444486377573, 0.63439328416364549, 0.6296382389149271,
+  0.62485948814238645, 0.62005721176328921, 0.61523159058062682,
+  0.61038280627630948, 0.60551104140432555, 0.60061647938386897,
+  0.59569930449243347, 0.59075970185887428, 0.58579785745643886,
+  0.58081395809576453, 0.57580819141784534, 0.57078074588696737,
+  0.56573181078361323, 0.56066157619733603, 0.55557023301960229,
+  0.55045797293660481, 0.54532498842204646, 0.54017147272989297,
+  0.53499761988709726, 0.52980362468629483, 0.52458968267846884,
+  0.51935599016558953, 0.51410274419322166, 0.50883014254310699,
+  0.50353838372571758, 0.49822766697278187, 0.49289819222978409,
+  0.48755016014843605, 0.48218377207912283, 0.47679923006332225,
+  0.47139673682599781, 0.46597649576796613, 0.46053871095824001,
+  0.45508358712634384, 0.4496113296546066, 0.44412214457042926,
+  0.43861623853852771, 0.43309381885315201, 0.4275550934302822,
+  0.42200027079979979, 0.41642956009763732, 0.41084317105790391,
+  0.40524131400498986, 0.39962419984564679, 0.3939920400610481,
+  0.3883450466988263, 0.38268343236508984, 0.37700741021641831,
+  0.3713171939518376, 0.36561299780477396, 0.35989503653498828,
+  0.35416352542049051, 0.34841868024943451, 0.34266071731199438,
+  0.33688985339222005, 0.33110630575987643, 0.32531029216226298,
+  0.31950203081601575, 0.31368174039889157, 0.30784964004153498,
+  0.3020059493192282, 0.29615088824362396, 0.29028467725446233,
+  0.28440753721127182, 0.27851968938505306, 0.27262135544994898,
+  0.26671275747489842, 0.26079411791527557, 0.25486565960451463,
+  0.24892760574572026, 0.24298017990326398, 0.23702360599436734,
+  0.23105810828067128, 0.22508391135979278, 0.21910124015686977,
+  0.21311031991609136, 0.20711137619221856, 0.20110463484209196,
+  0.19509032201612833, 0.18906866414980628, 0.18303988795514106,
+  0.17700422041214886, 0.17096188876030136, 0.16491312048997009,
+  0.15885814333386139, 0.15279718525844341, 0.14673047445536175,
+  0.14065823933284924, 0.13458070850712622, 0.12849811079379322,
+  0.12241067519921628, 0.11631863091190488, 0.11022220729388318,
+  0.10412163387205473, 0.09801714032956077, 0.091908956497132696,
+  0.08579731234443988, 0.079682437971430126, 0.073564563599667454,
+  0.067443919563664106, 0.061320736302208648, 0.055195244349690031,
+  0.049067674327418126, 0.042938256934940959, 0.036807222941358991,
+  0.030674803176636581, 0.024541228522912264, 0.01840672990580482,
+  0.012271538285719944, 0.0061358846491545152, 0,
+  -0.0061358846491544753, -0.012271538285719925, -0.01840672990580482,
+  -0.024541228522912288, -0.030674803176636626, -0.036807222941358832,
+  -0.04293825693494082, -0.049067674327418015, -0.055195244349689934,
+  -0.061320736302208578, -0.067443919563664051, -0.073564563599667426,
+  -0.079682437971430126, -0.085797312344439894, -0.091908956497132724,
+  -0.098017140329560604, -0.10412163387205459, -0.11022220729388306,
+  -0.11631863091190475, -0.1224106751992162, -0.12849811079379317,
+  -0.13458070850712617, -0.14065823933284921, -0.14673047445536175,
+  -0.15279718525844344, -0.15885814333386145, -0.16491312048996992,
+  -0.17096188876030122, -0.17700422041214875, -0.18303988795514095,
+  -0.18906866414980619, -0.19509032201612825, -0.2011046348420919,
+  -0.20711137619221856, -0.21311031991609136, -0.2191012401568698,
+  -0.22508391135979283, -0.23105810828067111, -0.2370236059943672,
+  -0.24298017990326387, -0.24892760574572015, -0.25486565960451457,
+  -0.26079411791527551, -0.26671275747489837, -0.27262135544994898,
+  -0.27851968938505306, -0.28440753721127188, -0.29028467725446233,
+  -0.29615088824362379, -0.30200594931922808, -0.30784964004153487,
+  -0.31368174039889152, -0.31950203081601569, -0.32531029216226293,
+  -0.33110630575987643, -0.33688985339222005, -0.34266071731199438,
+  -0.34841868024943456, -0.35416352542049034, -0.35989503653498811,
+  -0.36561299780477385, -0.37131719395183754, -0.37700741021641826,
+  -0.38268343236508978, -0.38834504669882625, -0.3939920400610481,
+  -0.39962419984564679, -0.40524131400498986, -0.41084317105790391,
+  -0.41642956009763715, -0.42200027079979968, -0.42755509343028208,
+  -0.43309381885315196, -0.43861623853852766, -0.4441221445704292,
+  -0.44961132965460654, -0.45508358712634384, -0.46053871095824001,
+  -0.46597649576796618, -0.47139673682599764, -0.47679923006332209,
+  -0.48218377207912272, -0.487550160148436, -0.49289819222978404,
+  -0.49822766697278187, -0.50353838372571758, -0.50883014254310699,
+  -0.51410274419322166, -0.51935599016558964, -0.52458968267846895,
+  -0.52980362468629461, -0.53499761988709715, -0.54017147272989285,
+  -0.54532498842204646, -0.55045797293660481, -0.55557023301960218,
+  -0.56066157619733603, -0.56573181078361312, -0.57078074588696726,
+  -0.57580819141784534, -0.58081395809576453, -0.58579785745643886,
+  -0.59075970185887416, -0.59569930449243336, -0.60061647938386897,
+  -0.60551104140432555, -0.61038280627630948, -0.61523159058062682,
+  -0.6200572117632891, -0.62485948814238634, -0.62963823891492698,
+  -0.63439328416364549, -0.63912444486377573, -0.64383154288979139,
+  -0.64851440102211244, -0.65317284295377676, -0.65780669329707864,
+  -0.66241577759017178, -0.66699992230363747, -0.67155895484701833,
+  -0.67609270357531592, -0.68060099779545302, -0.68508366777270036,
+  -0.68954054473706683, -0.693971460889654, -0.69837624940897292,
+  -0.7027547444572253, -0.70710678118654746, -0.71143219574521643,
+  -0.71573082528381859, -0.72000250796138165, -0.72424708295146689,
+  -0.7284643904482252, -0.73265427167241282, -0.73681656887736979,
+  -0.74095112535495911, -0.74505778544146595, -0.74913639452345926,
+  -0.75318679904361241, -0.75720884650648446, -0.76120238548426178,
+  -0.76516726562245896, -0.76910333764557959, -0.77301045336273699,
+  -0.77688846567323244, -0.78073722857209438, -0.78455659715557524,
+  -0.78834642762660623, -0.79210657730021239, -0.79583690460888346,
+  -0.79953726910790501, -0.80320753148064483, -0.80684755354379922,
+  -0.81045719825259477, -0.8140363297059483, -0.81758481315158371,
+  -0.82110251499110465, -0.82458930278502529, -0.8280450452577558,
+  -0.83146961230254524, -0.83486287498638001, -0.83822470555483797,
+  -0.84155497743689833, -0.84485356524970701, -0.84812034480329712,
+  -0.8513551931052652, -0.85455798836540053, -0.85772861000027212,
+  -0.86086693863776731, -0.8639728561215867, -0.86704624551569265,
+  -0.87008699110871135, -0.87309497841829009, -0.8760700941954066,
+  -0.87901222642863341, -0.88192126434835494, -0.88479709843093779,
+  -0.88763962040285393, -0.89044872324475788, -0.89322430119551532,
+  -0.89596624975618511, -0.89867446569395382, -0.90134884704602203,
+  -0.90398929312344334, -0.90659570451491533, -0.90916798309052227,
+  -0.91170603200542988, -0.91420975570353069, -0.9166790599210427,
+  -0.91911385169005777, -0.9215140393420419, -0.92387953251128674,
+  -0.92621024213831127, -0.92850608047321548, -0.93076696107898371,
+  -0.93299279883473885, -0.9351835099389475, -0.93733901191257496,
+  -0.93945922360218992, -0.94154406518302081, -0.94359345816196039,
+  -0.94560732538052128, -0.94758559101774109, -0.94952818059303667,
+  -0.95143502096900834, -0.95330604035419375, -0.95514116830577067,
+  -0.95694033573220894, -0.9587034748958716, -0.96043051941556579,
+  -0.96212140426904158, -0.96377606579543984, -0.9653944416976894,
+  -0.96697647104485207, -0.96852209427441727, -0.97003125319454397,
+  -0.97150389098625178, -0.97293995220556007, -0.97433938278557586,
+  -0.97570213003852857, -0.97702814265775439, -0.97831737071962765,
+  -0.97956976568544052, -0.98078528040323043, -0.98196386910955524,
+  -0.98310548743121629, -0.98421009238692903, -0.98527764238894122,
+  -0.98630809724459867, -0.98730141815785843, -0.98825756773074946,
+  -0.98917650996478101, -0.99005821026229712, -0.99090263542778001,
+  -0.99170975366909953, -0.99247953459870997, -0.9932119492347945,
+  -0.99390697000235606, -0.99456457073425542, -0.99518472667219682,
+  -0.99576741446765982, -0.996312612182778, -0.99682029929116567,
+  -0.99729045667869021, -0.99772306664419164, -0.99811811290014918,
+  -0.99847558057329477, -0.99879545620517241, -0.99907772775264536,
+  -0.99932238458834954, -0.99952941750109314, -0.99969881869620425,
+  -0.9998305817958234, -0.9999247018391445, -0.99998117528260111,
+  -1, -0.99998117528260111, -0.9999247018391445,
+  -0.9998305817958234, -0.99969881869620425, -0.99952941750109314,
+  -0.99932238458834954, -0.99907772775264536, -0.99879545620517241,
+  -0.99847558057329477, -0.99811811290014918, -0.99772306664419164,
+  -0.99729045667869021, -0.99682029929116567, -0.996312612182778,
+  -0.99576741446765982, -0.99518472667219693, -0.99456457073425542,
+  -0.99390697000235606, -0.9932119492347945, -0.99247953459870997,
+  -0.99170975366909953, -0.99090263542778001, -0.99005821026229712,
+  -0.98917650996478101, -0.98825756773074946, -0.98730141815785843,
+  -0.98630809724459867, -0.98527764238894122, -0.98421009238692903,
+  -0.98310548743121629, -0.98196386910955524, -0.98078528040323043,
+  -0.97956976568544052, -0.97831737071962765, -0.97702814265775439,
+  -0.97570213003852857, -0.97433938278557586, -0.97293995220556018,
+  -0.97150389098625178, -0.97003125319454397, -0.96852209427441738,
+  -0.96697647104485207, -0.9653944416976894, -0.96377606579543984,
+  -0.96212140426904158, -0.96043051941556579, -0.9587034748958716,
+  -0.95694033573220882, -0.95514116830577078, -0.95330604035419386,
+  -0.95143502096900834, -0.94952818059303667, -0.94758559101774109,
+  -0.94560732538052128, -0.94359345816196039, -0.94154406518302081,
+  -0.93945922360218992, -0.93733901191257496, -0.93518350993894761,
+  -0.93299279883473896, -0.93076696107898371, -0.92850608047321559,
+  -0.92621024213831138, -0.92387953251128674, -0.92151403934204201,
+  -0.91911385169005777, -0.9166790599210427, -0.91420975570353069,
+  -0.91170603200542988, -0.90916798309052238, -0.90659570451491533,
+  -0.90398929312344334, -0.90134884704602203, -0.89867446569395382,
+  -0.89596624975618522, -0.89322430119551532, -0.89044872324475788,
+  -0.88763962040285393, -0.88479709843093779, -0.88192126434835505,
+  -0.87901222642863353, -0.8760700941954066, -0.87309497841829009,
+  -0.87008699110871146, -0.86704624551569265, -0.86397285612158681,
+  -0.86086693863776731, -0.85772861000027212, -0.85455798836540053,
+  -0.8513551931052652, -0.84812034480329723, -0.84485356524970712,
+  -0.84155497743689844, -0.83822470555483808, -0.83486287498638001,
+  -0.83146961230254524, -0.8280450452577558, -0.82458930278502529,
+  -0.82110251499110465, -0.81758481315158371, -0.81403632970594841,
+  -0.81045719825259477, -0.80684755354379933, -0.80320753148064494,
+  -0.79953726910790501, -0.79583690460888357, -0.79210657730021239,
+  -0.78834642762660634, -0.78455659715557524, -0.78073722857209449,
+  -0.77688846567323244, -0.77301045336273699, -0.7691033376455797,
+  -0.76516726562245896, -0.76120238548426178, -0.75720884650648457,
+  -0.75318679904361252, -0.74913639452345937, -0.74505778544146606,
+  -0.74095112535495911, -0.7368165688773699, -0.73265427167241282,
+  -0.7284643904482252, -0.724247082951467, -0.72000250796138165,
+  -0.71573082528381859, -0.71143219574521643, -0.70710678118654757,
+  -0.7027547444572253, -0.69837624940897292, -0.693971460889654,
+  -0.68954054473706694, -0.68508366777270036, -0.68060099779545313,
+  -0.67609270357531603, -0.67155895484701833, -0.66699992230363747,
+  -0.66241577759017178, -0.65780669329707864, -0.65317284295377676,
+  -0.64851440102211255, -0.6438315428897915, -0.63912444486377573,
+  -0.63439328416364549, -0.6296382389149271, -0.62485948814238645,
+  -0.62005721176328921, -0.61523159058062682, -0.61038280627630948,
+  -0.60551104140432555, -0.60061647938386897, -0.59569930449243347,
+  -0.59075970185887428, -0.58579785745643886, -0.58081395809576453,
+  -0.57580819141784534, -0.57078074588696737, -0.56573181078361323,
+  -0.56066157619733603, -0.55557023301960229, -0.55045797293660481,
+  -0.54532498842204646, -0.54017147272989297, -0.53499761988709726,
+  -0.52980362468629483, -0.52458968267846884, -0.51935599016558953,
+  -0.51410274419322166, -0.50883014254310699, -0.50353838372571758,
+  -0.49822766697278187, -0.49289819222978409, -0.48755016014843605,
+  -0.48218377207912283, -0.47679923006332225, -0.47139673682599781,
+  -0.46597649576796613, -0.46053871095824001, -0.45508358712634384,
+  -0.4496113296546066, -0.44412214457042926, -0.43861623853852771,
+  -0.43309381885315201, -0.4275550934302822, -0.42200027079979979,
+  -0.41642956009763732, -0.41084317105790391, -0.40524131400498986,
+  -0.39962419984564679, -0.3939920400610481, -0.3883450466988263,
+  -0.38268343236508984, -0.37700741021641831, -0.3713171939518376,
+  -0.36561299780477396, -0.35989503653498828, -0.35416352542049051,
+  -0.34841868024943451, -0.34266071731199438, -0.33688985339222005,
+  -0.33110630575987643, -0.32531029216226298, -0.31950203081601575,
+  -0.31368174039889157, -0.30784964004153498, -0.3020059493192282,
+  -0.29615088824362396, -0.29028467725446233, -0.28440753721127182,
+  -0.27851968938505306, -0.27262135544994898, -0.26671275747489842,
+  -0.26079411791527557, -0.25486565960451463, -0.24892760574572026,
+  -0.24298017990326398, -0.23702360599436734, -0.23105810828067128,
+  -0.22508391135979278, -0.21910124015686977, -0.21311031991609136,
+  -0.20711137619221856, -0.20110463484209196, -0.19509032201612833,
+  -0.18906866414980628, -0.18303988795514106, -0.17700422041214886,
+  -0.17096188876030136, -0.16491312048997009, -0.15885814333386139,
+  -0.15279718525844341, -0.14673047445536175, -0.14065823933284924,
+  -0.13458070850712622, -0.12849811079379322, -0.12241067519921628,
+  -0.11631863091190488, -0.11022220729388318, -0.10412163387205473,
+  -0.09801714032956077, -0.091908956497132696, -0.08579731234443988,
+  -0.079682437971430126, -0.073564563599667454, -0.067443919563664106,
+  -0.061320736302208648, -0.055195244349690031, -0.049067674327418126,
+  -0.042938256934940959, -0.036807222941358991, -0.030674803176636581,
+  -0.024541228522912264, -0.01840672990580482, -0.012271538285719944,
+  -0.0061358846491545152, 0, 0.0061358846491544753,
+  0.012271538285719925, 0.01840672990580482, 0.024541228522912288,
+  0.030674803176636626, 0.036807222941358832, 0.04293825693494082,
+  0.049067674327418015, 0.055195244349689934, 0.061320736302208578,
+  0.067443919563664051, 0.073564563599667426, 0.079682437971430126,
+  0.085797312344439894, 0.091908956497132724, 0.098017140329560604,
+  0.10412163387205459, 0.11022220729388306, 0.11631863091190475,
+  0.1224106751992162, 0.12849811079379317, 0.13458070850712617,
+  0.14065823933284921, 0.14673047445536175, 0.15279718525844344,
+  0.15885814333386145, 0.16491312048996992, 0.17096188876030122,
+  0.17700422041214875, 0.18303988795514095, 0.18906866414980619,
+  0.19509032201612825, 0.2011046348420919, 0.20711137619221856,
+  0.21311031991609136, 0.2191012401568698, 0.22508391135979283,
+  0.23105810828067111, 0.2370236059943672, 0.24298017990326387,
+  0.24892760574572015, 0.25486565960451457, 0.26079411791527551,
+  0.26671275747489837, 0.27262135544994898, 0.27851968938505306,
+  0.28440753721127188, 0.29028467725446233, 0.29615088824362379,
+  0.30200594931922808, 0.30784964004153487, 0.31368174039889152,
+  0.31950203081601569, 0.32531029216226293, 0.33110630575987643,
+  0.33688985339222005, 0.34266071731199438, 0.34841868024943456,
+  0.35416352542049034, 0.35989503653498811, 0.36561299780477385,
+  0.37131719395183754, 0.37700741021641826, 0.38268343236508978,
+  0.38834504669882625, 0.3939920400610481, 0.39962419984564679,
+  0.40524131400498986, 0.41084317105790391, 0.41642956009763715,
+  0.42200027079979968, 0.42755509343028208, 0.43309381885315196,
+  0.43861623853852766, 0.4441221445704292, 0.44961132965460654,
+  0.45508358712634384, 0.46053871095824001, 0.46597649576796618,
+  0.47139673682599764, 0.47679923006332209, 0.48218377207912272,
+  0.487550160148436, 0.49289819222978404, 0.49822766697278187,
+  0.50353838372571758, 0.50883014254310699, 0.51410274419322166,
+  0.51935599016558964, 0.52458968267846895, 0.52980362468629461,
+  0.53499761988709715, 0.54017147272989285, 0.54532498842204646,
+  0.55045797293660481, 0.55557023301960218, 0.56066157619733603,
+  0.56573181078361312, 0.57078074588696726, 0.57580819141784534,
+  0.58081395809576453, 0.58579785745643886, 0.59075970185887416,
+  0.59569930449243336, 0.60061647938386897, 0.60551104140432555,
+  0.61038280627630948, 0.61523159058062682, 0.6200572117632891,
+  0.62485948814238634, 0.62963823891492698, 0.63439328416364549,
+  0.63912444486377573, 0.64383154288979139, 0.64851440102211244,
+  0.65317284295377676, 0.65780669329707864, 0.66241577759017178,
+  0.66699992230363747, 0.67155895484701833, 0.67609270357531592,
+  0.68060099779545302, 0.68508366777270036, 0.68954054473706683,
+  0.693971460889654, 0.69837624940897292, 0.7027547444572253,
+  0.70710678118654746, 0.71143219574521643, 0.71573082528381859,
+  0.72000250796138165, 0.72424708295146689, 0.7284643904482252,
+  0.73265427167241282, 0.73681656887736979, 0.74095112535495911,
+  0.74505778544146595, 0.74913639452345926, 0.75318679904361241,
+  0.75720884650648446, 0.76120238548426178, 0.76516726562245896,
+  0.76910333764557959, 0.77301045336273699, 0.77688846567323244,
+  0.78073722857209438, 0.78455659715557524, 0.78834642762660623,
+  0.79210657730021239, 0.79583690460888346, 0.79953726910790501,
+  0.80320753148064483, 0.80684755354379922, 0.81045719825259477,
+  0.8140363297059483, 0.81758481315158371, 0.82110251499110465,
+  0.82458930278502529, 0.8280450452577558, 0.83146961230254524,
+  0.83486287498638001, 0.83822470555483797, 0.84155497743689833,
+  0.84485356524970701, 0.84812034480329712, 0.8513551931052652,
+  0.85455798836540053, 0.85772861000027212, 0.86086693863776731,
+  0.8639728561215867, 0.86704624551569265, 0.87008699110871135,
+  0.87309497841829009, 0.8760700941954066, 0.87901222642863341,
+  0.88192126434835494, 0.88479709843093779, 0.88763962040285393,
+  0.89044872324475788, 0.89322430119551532, 0.89596624975618511,
+  0.89867446569395382, 0.90134884704602203, 0.90398929312344334,
+  0.90659570451491533, 0.90916798309052227, 0.91170603200542988,
+  0.91420975570353069, 0.9166790599210427, 0.91911385169005777,
+  0.9215140393420419, 0.92387953251128674, 0.92621024213831127,
+  0.92850608047321548, 0.93076696107898371, 0.93299279883473885,
+  0.9351835099389475, 0.93733901191257496, 0.93945922360218992,
+  0.94154406518302081, 0.94359345816196039, 0.94560732538052128,
+  0.94758559101774109, 0.94952818059303667, 0.95143502096900834,
+  0.95330604035419375, 0.95514116830577067, 0.95694033573220894,
+  0.9587034748958716, 0.96043051941556579, 0.96212140426904158,
+  0.96377606579543984, 0.9653944416976894, 0.96697647104485207,
+  0.96852209427441727, 0.97003125319454397, 0.97150389098625178,
+  0.97293995220556007, 0.97433938278557586, 0.97570213003852857,
+  0.97702814265775439, 0.97831737071962765, 0.97956976568544052,
+  0.98078528040323043, 0.98196386910955524, 0.98310548743121629,
+  0.98421009238692903, 0.98527764238894122, 0.98630809724459867,
+  0.98730141815785843, 0.98825756773074946, 0.98917650996478101,
+  0.99005821026229712, 0.99090263542778001, 0.99170975366909953,
+  0.99247953459870997, 0.9932119492347945, 0.99390697000235606,
+  0.99456457073425542, 0.99518472667219682, 0.99576741446765982,
+  0.996312612182778, 0.99682029929116567, 0.99729045667869021,
+  0.99772306664419164, 0.99811811290014918, 0.99847558057329477,
+  0.99879545620517241, 0.99907772775264536, 0.99932238458834954,
+  0.99952941750109314, 0.99969881869620425, 0.9998305817958234,
+  0.9999247018391445, 0.99998117528260111, 1
+};
+
+static const double fft_static_sin_2048[2561] =
+{
+  0, 0.0030679567629659761, 0.0061358846491544753,
+  0.0092037547820598194, 0.012271538285719925, 0.0153392062849881,
+  0.01840672990580482, 0.021474080275469508, 0.024541228522912288,
+  0.02760814577896574, 0.030674803176636626, 0.03374117185137758,
+  0.036807222941358832, 0.039872927587739811, 0.04293825693494082,
+  0.046003182130914623, 0.049067674327418015, 0.052131704680283324,
+  0.055195244349689934, 0.058258264500435752, 0.061320736302208578,
+  0.064382630929857465, 0.067443919563664051, 0.070504573389613856,
+  0.073564563599667426, 0.076623861392031492, 0.079682437971430126,
+  0.082740264549375692, 0.085797312344439894, 0.0888535525825246,
+  0.091908956497132724, 0.094963495329638992, 0.098017140329560604,
+  0.10106986275482782, 0.10412163387205459, 0.10717242495680884,
+  0.11022220729388306, 0.11327095217756435, 0.11631863091190475,
+  0.11936521481099135, 0.1224106751992162, 0.12545498341154623,
+  0.12849811079379317, 0.13154002870288312, 0.13458070850712617,
+  0.13762012158648604, 0.14065823933284921, 0.14369503315029447,
+  0.14673047445536175, 0.14976453467732151, 0.15279718525844344,
+  0.15582839765426523, 0.15885814333386145, 0.16188639378011183,
+  0.16491312048996992, 0.16793829497473117, 0.17096188876030122,
+  0.17398387338746382, 0.17700422041214875, 0.18002290140569951,
+  0.18303988795514095, 0.18605515166344663, 0.18906866414980619,
+  0.19208039704989244, 0.19509032201612825, 0.19809841071795356,
+  0.2011046348420919, 0.20410896609281687, 0.20711137619221856,
+  0.21011183688046961, 0.21311031991609136, 0.21610679707621952,
+  0.2191012401568698, 0.22209362097320351, 0.22508391135979283,
+  0.22807208317088573, 0.23105810828067111, 0.23404195858354343,
+  0.2370236059943672, 0.2400030224487415, 0.24298017990326387,
+  0.24595505033579459, 0.24892760574572015, 0.25189781815421697,
+  0.25486565960451457, 0.25783110216215899, 0.26079411791527551,
+  0.26375467897483135, 0.26671275747489837, 0.26966832557291509,
+  0.27262135544994898, 0.27557181931095814, 0.27851968938505306,
+  0.28146493792575794, 0.28440753721127188, 0.28734745954472951,
+  0.29028467725446233, 0.29321916269425863, 0.29615088824362379,
+  0.29907982630804048, 0.30200594931922808, 0.30492922973540237,
+  0.30784964004153487, 0.31076715274961147, 0.31368174039889152,
+  0.31659337555616585, 0.31950203081601569, 0.32240767880106985,
+  0.32531029216226293, 0.3282098435790925, 0.33110630575987643,
+  0.33399965144200938, 0.33688985339222005, 0.33977688440682685,
+  0.34266071731199438, 0.34554132496398909, 0.34841868024943456,
+  0.35129275608556709, 0.35416352542049034, 0.35703096123342998,
+  0.35989503653498811, 0.36275572436739723, 0.36561299780477385,
+  0.36846682995337232, 0.37131719395183754, 0.37416406297145793,
+  0.37700741021641826, 0.37984720892405116, 0.38268343236508978,
+  0.38551605384391885, 0.38834504669882625, 0.39117038430225387,
+  0.3939920400610481, 0.39680998741671031, 0.39962419984564679,
+  0.40243465085941843, 0.40524131400498986, 0.40804416286497869,
+  0.41084317105790391, 0.4136383122384345, 0.41642956009763715,
+  0.41921688836322391, 0.42200027079979968, 0.42477968120910881,
+  0.42755509343028208, 0.43032648134008261, 0.43309381885315196,
+  0.43585707992225547, 0.43861623853852766, 0.44137126873171667,
+  0.4441221445704292, 0.44686884016237416, 0.44961132965460654,
+  0.45234958723377089, 0.45508358712634384, 0.45781330359887717,
+  0.46053871095824001, 0.46325978355186015, 0.46597649576796618,
+  0.4686888220358279, 0.47139673682599764, 0.47410021465054997,
+  0.47679923006332209, 0.47949375766015301, 0.48218377207912272,
+  0.48486924800079106, 0.487550160148436, 0.49022648328829116,
+  0.49289819222978404, 0.49556526182577254, 0.49822766697278187,
+  0.50088538261124071, 0.50353838372571758, 0.50618664534515523,
+  0.50883014254310699, 0.5114688504379703, 0.51410274419322166,
+  0.51673179901764987, 0.51935599016558964, 0.52197529293715439,
+  0.52458968267846895, 0.52719913478190128, 0.52980362468629461,
+  0.5324031278771979, 0.53499761988709715, 0.53758707629564539,
+  0.54017147272989285, 0.54275078486451589, 0.54532498842204646,
+  0.54789405917310019, 0.55045797293660481, 0.55301670558002747,
+  0.55557023301960218, 0.5581185312205561, 0.56066157619733603,
+  0.56319934401383409, 0.56573181078361312, 0.56825895267013149,
+  0.57078074588696726, 0.5732971666980422, 0.57580819141784534,
+  0.57831379641165559, 0.58081395809576453, 0.58330865293769829,
+  0.58579785745643886, 0.58828154822264522, 0.59075970185887416,
+  0.5932322950397998, 0.59569930449243336, 0.59816070699634227,
+  0.60061647938386897, 0.60306659854034816, 0.60551104140432555,
+  0.60794978496777363, 0.61038280627630948, 0.61281008242940971,
+  0.61523159058062682, 0.61764730793780387, 0.6200572117632891,
+  0.62246127937414997, 0.62485948814238634, 0.62725181549514408,
+  0.62963823891492698, 0.63201873593980906, 0.63439328416364549,
+  0.6367618612362842, 0.63912444486377573, 0.64148101280858316,
+  0.64383154288979139, 0.64617601298331628, 0.64851440102211244,
+  0.65084668499638088, 0.65317284295377676, 0.65549285299961535,
+  0.65780669329707864, 0.66011434206742048, 0.66241577759017178,
+  0.66471097820334479, 0.66699992230363747, 0.66928258834663601,
+  0.67155895484701833, 0.67382900037875604, 0.67609270357531592,
+  0.67835004312986147, 0.68060099779545302, 0.68284554638524808,
+  0.68508366777270036, 0.68731534089175905, 0.68954054473706683,
+  0.69175925836415775, 0.693971460889654, 0.69617713149146299,
+  0.69837624940897292, 0.70056879394324834, 0.7027547444572253,
+  0.70493408037590488, 0.70710678118654746, 0.70927282643886558,
+  0.71143219574521643, 0.71358486878079352, 0.71573082528381859,
+  0.71787004505573171, 0.72000250796138165, 0.72212819392921535,
+  0.72424708295146689, 0.72635915508434601, 0.7284643904482252,
+  0.73056276922782759, 0.73265427167241282, 0.73473887809596339,
+  0.73681656887736979, 0.73888732446061511, 0.74095112535495911,
+  0.74300795213512172, 0.74505778544146595, 0.74710060598018013,
+  0.74913639452345926, 0.75116513190968637, 0.75318679904361241,
+  0.75520137689653655, 0.75720884650648446, 0.75920918897838796,
+  0.76120238548426178, 0.76318841726338127, 0.76516726562245896,
+  0.7671389119358204, 0.76910333764557959, 0.77106052426181371,
+  0.77301045336273699, 0.77495310659487382, 0.77688846567323244,
+  0.77881651238147587, 0.78073722857209438, 0.78265059616657573,
+  0.78455659715557524, 0.78645521359908577, 0.78834642762660623,
+  0.79023022143731003, 0.79210657730021239, 0.79397547755433717,
+  0.79583690460888346, 0.79769084094339104, 0.79953726910790501,
+  0.80137617172314013, 0.80320753148064483, 0.80503133114296366,
+  0.80684755354379922, 0.80865618158817498, 0.81045719825259477,
+  0.81225058658520388, 0.8140363297059483, 0.81581441080673378,
+  0.81758481315158371, 0.8193475200767969, 0.82110251499110465,
+  0.82284978137582632, 0.82458930278502529, 0.82632106284566342,
+  0.8280450452577558, 0.82976123379452305, 0.83146961230254524,
+  0.83317016470191319, 0.83486287498638001, 0.83654772722351189,
+  0.83822470555483797, 0.83989379419599941, 0.84155497743689833,
+  0.84320823964184544, 0.84485356524970701, 0.84649093877405202,
+  0.84812034480329712, 0.84974176800085244, 0.8513551931052652,
+  0.85296060493036363, 0.85455798836540053, 0.85614732837519447,
+  0.85772861000027212, 0.85930181835700836, 0.86086693863776731,
+  0.8624239561110405, 0.8639728561215867, 0.86551362409056898,
+  0.86704624551569265, 0.8685707059713409, 0.87008699110871135,
+  0.87159508665595109, 0.87309497841829009, 0.87458665227817611,
+  0.8760700941954066, 0.87754529020726124, 0.87901222642863341,
+  0.88047088905216075, 0.88192126434835494, 0.88336333866573158,
+  0.88479709843093779, 0.88622253014888064, 0.88763962040285393,
+  0.88904835585466457, 0.89044872324475788, 0.89184070939234272,
+  0.89322430119551532, 0.89459948563138258, 0.89596624975618511,
+  0.89732458070541832, 0.89867446569395382, 0.90001589201616028,
+  0.90134884704602203, 0.90267331823725883, 0.90398929312344334,
+  0.90529675931811882, 0.90659570451491533, 0.90788611648766615,
+  0.90916798309052227, 0.91044129225806714, 0.91170603200542988,
+  0.9129621904283981, 0.91420975570353069, 0.91544871608826783,
+  0.9166790599210427, 0.91790077562139039, 0.91911385169005777,
+  0.92031827670911048, 0.9215140393420419, 0.92270112833387852,
+  0.92387953251128674, 0.92504924078267758, 0.92621024213831127,
+  0.92736252565040111, 0.92850608047321548, 0.92964089584318133,
+  0.93076696107898371, 0.93188426558166815, 0.93299279883473885,
+  0.93409255040425887, 0.9351835099389475, 0.93626566717027826,
+  0.93733901191257496, 0.93840353406310806, 0.93945922360218992,
+  0.9405060705932683, 0.94154406518302081, 0.94257319760144687,
+  0.94359345816196039, 0.94460483726148026, 0.94560732538052128,
+  0.94660091308328353, 0.94758559101774109, 0.94856134991573027,
+  0.94952818059303667, 0.9504860739494817, 0.95143502096900834,
+  0.95237501271976588, 0.95330604035419375, 0.95422809510910567,
+  0.95514116830577067, 0.95604525134999641, 0.95694033573220894,
+  0.95782641302753291, 0.9587034748958716, 0.95957151308198452,
+  0.96043051941556579, 0.96128048581132064, 0.96212140426904158,
+  0.96295326687368388, 0.96377606579543984, 0.96458979328981265,
+  0.9653944416976894, 0.96619000344541262, 0.96697647104485207,
+  0.96775383709347551, 0.96852209427441727, 0.96928123535654853,
+  0.97003125319454397, 0.97077214072895035, 0.97150389098625178,
+  0.97222649707893627, 0.97293995220556007, 0.97364424965081187,
+  0.97433938278557586, 0.97502534506699412, 0.97570213003852857,
+  0.97636973133002114, 0.97702814265775439, 0.97767735782450993,
+  0.97831737071962765, 0.9789481753190622, 0.97956976568544052,
+  0.98018213596811732, 0.98078528040323043, 0.98137919331375456,
+  0.98196386910955524, 0.98253930228744124, 0.98310548743121629,
+  0.98366241921173025, 0.98421009238692903, 0.98474850180190421,
+  0.98527764238894122, 0.98579750916756737, 0.98630809724459867,
+  0.98680940181418542, 0.98730141815785843, 0.98778414164457218,
+  0.98825756773074946, 0.98872169196032378, 0.98917650996478101,
+  0.98962201746320078, 0.99005821026229712, 0.99048508425645698,
+  0.99090263542778001, 0.99131085984611544, 0.99170975366909953,
+  0.9920993131421918, 0.99247953459870997, 0.9928504144598651,
+  0.9932119492347945, 0.9935641355205953, 0.99390697000235606,
+  0.9942404494531879, 0.99456457073425542, 0.99487933079480562,
+  0.99518472667219682, 0.99548075549192694, 0.99576741446765982,
+  0.99604470090125197, 0.996312612182778, 0.99657114579055484,
+  0.99682029929116567, 0.99706007033948296, 0.99729045667869021,
+  0.99751145614030345, 0.99772306664419164, 0.997925286198596,
+  0.99811811290014918, 0.99830154493389289, 0.99847558057329477,
+  0.99864021818026527, 0.99879545620517241, 0.99894129318685687,
+  0.99907772775264536, 0.99920475861836389, 0.99932238458834954,
+  0.99943060455546173, 0.99952941750109314, 0.99961882249517864,
+  0.99969881869620425, 0.99976940535121528, 0.9998305817958234,
+  0.99988234745421256, 0.9999247018391445, 0.9999576445519639,
+  0.99998117528260111, 0.99999529380957619, 1,
+  0.99999529380957619, 0.99998117528260111, 0.9999576445519639,
+  0.9999247018391445, 0.99988234745421256, 0.9998305817958234,
+  0.99976940535121528, 0.99969881869620425, 0.99961882249517864,
+  0.99952941750109314, 0.99943060455546173, 0.99932238458834954,
+  0.99920475861836389, 0.99907772775264536, 0.99894129318685687,
+  0.99879545620517241, 0.99864021818026527, 0.99847558057329477,
+  0.99830154493389289, 0.99811811290014918, 0.997925286198596,
+  0.99772306664419164, 0.99751145614030345, 0.99729045667869021,
+  0.99706007033948296, 0.99682029929116567, 0.99657114579055484,
+  0.996312612182778, 0.99604470090125197, 0.99576741446765982,
+  0.99548075549192694, 0.99518472667219693, 0.99487933079480562,
+  0.99456457073425542, 0.9942404494531879, 0.99390697000235606,
+  0.9935641355205953, 0.9932119492347945, 0.9928504144598651,
+  0.99247953459870997, 0.9920993131421918, 0.99170975366909953,
+  0.99131085984611544, 0.99090263542778001, 0.99048508425645709,
+  0.99005821026229712, 0.98962201746320089, 0.98917650996478101,
+  0.98872169196032378, 0.98825756773074946, 0.98778414164457218,
+  0.98730141815785843, 0.98680940181418553, 0.98630809724459867,
+  0.98579750916756748, 0.98527764238894122, 0.98474850180190421,
+  0.98421009238692903, 0.98366241921173025, 0.98310548743121629,
+  0.98253930228744124, 0.98196386910955524, 0.98137919331375456,
+  0.98078528040323043, 0.98018213596811743, 0.97956976568544052,
+  0.9789481753190622, 0.97831737071962765, 0.97767735782450993,
+  0.97702814265775439, 0.97636973133002114, 0.97570213003852857,
+  0.97502534506699412, 0.97433938278557586, 0.97364424965081198,
+  0.97293995220556018, 0.97222649707893627, 0.97150389098625178,
+  0.97077214072895035, 0.97003125319454397, 0.96928123535654853,
+  0.96852209427441738, 0.96775383709347551, 0.96697647104485207,
+  0.9661900034454125, 0.9653944416976894, 0.96458979328981276,
+  0.96377606579543984, 0.96295326687368388, 0.96212140426904158,
+  0.96128048581132064, 0.96043051941556579, 0.95957151308198452,
+  0.9587034748958716, 0.95782641302753291, 0.95694033573220882,
+  0.95604525134999641, 0.95514116830577078, 0.95422809510910567,
+  0.95330604035419386, 0.95237501271976588, 0.95143502096900834,
+  0.9504860739494817, 0.94952818059303667, 0.94856134991573027,
+  0.94758559101774109, 0.94660091308328353, 0.94560732538052128,
+  0.94460483726148026, 0.94359345816196039, 0.94257319760144687,
+  0.94154406518302081, 0.9405060705932683, 0.93945922360218992,
+  0.93840353406310806, 0.93733901191257496, 0.93626566717027826,
+  0.93518350993894761, 0.93409255040425898, 0.93299279883473896,
+  0.93188426558166815, 0.93076696107898371, 0.92964089584318133,
+  0.92850608047321559, 0.92736252565040111, 0.92621024213831138,
+  0.92504924078267758, 0.92387953251128674, 0.92270112833387863,
+  0.92151403934204201, 0.92031827670911059, 0.91911385169005777,
+  0.9179007756213905, 0.9166790599210427, 0.91544871608826783,
+  0.91420975570353069, 0.91296219042839821, 0.91170603200542988,
+  0.91044129225806725, 0.90916798309052238, 0.90788611648766626,
+  0.90659570451491533, 0.90529675931811882, 0.90398929312344334,
+  0.90267331823725883, 0.90134884704602203, 0.90001589201616028,
+  0.89867446569395382, 0.89732458070541832, 0.89596624975618522,
+  0.8945994856313827, 0.89322430119551532, 0.89184070939234272,
+  0.89044872324475788, 0.88904835585466457, 0.88763962040285393,
+  0.88622253014888064, 0.88479709843093779, 0.88336333866573158,
+  0.88192126434835505, 0.88047088905216075, 0.87901222642863353,
+  0.87754529020726135, 0.8760700941954066, 0.87458665227817611,
+  0.87309497841829009, 0.87159508665595098, 0.87008699110871146,
+  0.8685707059713409, 0.86704624551569265, 0.86551362409056909,
+  0.86397285612158681, 0.86242395611104061, 0.86086693863776731,
+  0.85930181835700847, 0.85772861000027212, 0.85614732837519447,
+  0.85455798836540053, 0.85296060493036363, 0.8513551931052652,
+  0.84974176800085255, 0.84812034480329723, 0.84649093877405213,
+  0.84485356524970712, 0.84320823964184544, 0.84155497743689844,
+  0.83989379419599952, 0.83822470555483808, 0.83654772722351201,
+  0.83486287498638001, 0.83317016470191319, 0.83146961230254524,
+  0.82976123379452305, 0.8280450452577558, 0.82632106284566353,
+  0.82458930278502529, 0.82284978137582643, 0.82110251499110465,
+  0.8193475200767969, 0.81758481315158371, 0.81581441080673378,
+  0.81403632970594841, 0.81225058658520388, 0.81045719825259477,
+  0.80865618158817498, 0.80684755354379933, 0.80503133114296366,
+  0.80320753148064494, 0.80137617172314024, 0.79953726910790501,
+  0.79769084094339116, 0.79583690460888357, 0.79397547755433717,
+  0.79210657730021239, 0.79023022143731003, 0.78834642762660634,
+  0.78645521359908577, 0.78455659715557524, 0.78265059616657573,
+  0.78073722857209449, 0.77881651238147598, 0.77688846567323244,
+  0.77495310659487393, 0.77301045336273699, 0.77106052426181382,
+  0.7691033376455797, 0.7671389119358204, 0.76516726562245896,
+  0.76318841726338127, 0.76120238548426178, 0.75920918897838807,
+  0.75720884650648457, 0.75520137689653655, 0.75318679904361252,
+  0.75116513190968648, 0.74913639452345937, 0.74710060598018013,
+  0.74505778544146606, 0.74300795213512172, 0.74095112535495911,
+  0.73888732446061511, 0.7368165688773699, 0.7347388780959635,
+  0.73265427167241282, 0.73056276922782759, 0.7284643904482252,
+  0.72635915508434601, 0.724247082951467, 0.72212819392921535,
+  0.72000250796138165, 0.71787004505573171, 0.71573082528381859,
+  0.71358486878079364, 0.71143219574521643, 0.70927282643886569,
+  0.70710678118654757, 0.70493408037590499, 0.7027547444572253,
+  0.70056879394324845, 0.69837624940897292, 0.69617713149146299,
+  0.693971460889654, 0.69175925836415775, 0.68954054473706694,
+  0.68731534089175916, 0.68508366777270036, 0.68284554638524808,
+  0.68060099779545313, 0.67835004312986158, 0.67609270357531603,
+  0.67382900037875615, 0.67155895484701833, 0.66928258834663601,
+  0.66699992230363747, 0.6647109782033449, 0.66241577759017178,
+  0.66011434206742048, 0.65780669329707864, 0.65549285299961546,
+  0.65317284295377676, 0.65084668499638099, 0.64851440102211255,
+  0.64617601298331639, 0.6438315428897915, 0.64148101280858316,
+  0.63912444486377573, 0.6367618612362842, 0.63439328416364549,
+  0.63201873593980906, 0.6296382389149271, 0.62725181549514419,
+  0.62485948814238645, 0.62246127937415008, 0.62005721176328921,
+  0.61764730793780398, 0.61523159058062682, 0.61281008242940971,
+  0.61038280627630948, 0.60794978496777374, 0.60551104140432555,
+  0.60306659854034828, 0.60061647938386897, 0.59816070699634238,
+  0.59569930449243347, 0.5932322950397998, 0.59075970185887428,
+  0.58828154822264533, 0.58579785745643886, 0.58330865293769829,
+  0.58081395809576453, 0.57831379641165559, 0.57580819141784534,
+  0.57329716669804232, 0.57078074588696737, 0.56825895267013149,
+  0.56573181078361323, 0.56319934401383409, 0.56066157619733603,
+  0.5581185312205561, 0.55557023301960229, 0.55301670558002758,
+  0.55045797293660481, 0.54789405917310019, 0.54532498842204646,
+  0.542750784864516, 0.54017147272989297, 0.53758707629564551,
+  0.53499761988709726, 0.53240312787719801, 0.52980362468629483,
+  0.52719913478190139, 0.52458968267846884, 0.52197529293715439,
+  0.51935599016558953, 0.51673179901764998, 0.51410274419322166,
+  0.51146885043797052, 0.50883014254310699, 0.50618664534515545,
+  0.50353838372571758, 0.50088538261124094, 0.49822766697278187,
+  0.49556526182577249, 0.49289819222978409, 0.4902264832882911,
+  0.48755016014843605, 0.48486924800079112, 0.48218377207912283,
+  0.47949375766015301, 0.47679923006332225, 0.47410021465055002,
+  0.47139673682599781, 0.46868882203582796, 0.46597649576796613,
+  0.46325978355186026, 0.46053871095824001, 0.45781330359887729,
+  0.45508358712634384, 0.452349587233771, 0.4496113296546066,
+  0.44686884016237433, 0.44412214457042926, 0.44137126873171662,
+  0.43861623853852771, 0.43585707992225547, 0.43309381885315201,
+  0.43032648134008261, 0.4275550934302822, 0.42477968120910881,
+  0.42200027079979979, 0.41921688836322396, 0.41642956009763732,
+  0.41363831223843456, 0.41084317105790391, 0.40804416286497874,
+  0.40524131400498986, 0.40243465085941854, 0.39962419984564679,
+  0.39680998741671042, 0.3939920400610481, 0.39117038430225398,
+  0.3883450466988263, 0.38551605384391902, 0.38268343236508984,
+  0.37984720892405111, 0.37700741021641831, 0.37416406297145799,
+  0.3713171939518376, 0.36846682995337232, 0.36561299780477396,
+  0.36275572436739723, 0.35989503653498828, 0.35703096123343003,
+  0.35416352542049051, 0.35129275608556715, 0.34841868024943451,
+  0.34554132496398915, 0.34266071731199438, 0.33977688440682696,
+  0.33688985339222005, 0.33399965144200949, 0.33110630575987643,
+  0.32820984357909266, 0.32531029216226298, 0.32240767880107002,
+  0.31950203081601575, 0.31659337555616585, 0.31368174039889157,
+  0.31076715274961147, 0.30784964004153498, 0.30492922973540243,
+  0.3020059493192282, 0.29907982630804048, 0.29615088824362396,
+  0.29321916269425868, 0.29028467725446233, 0.28734745954472957,
+  0.28440753721127182, 0.28146493792575805, 0.27851968938505306,
+  0.27557181931095825, 0.27262135544994898, 0.2696683255729152,
+  0.26671275747489842, 0.26375467897483151, 0.26079411791527557,
+  0.25783110216215893, 0.25486565960451463, 0.25189781815421691,
+  0.24892760574572026, 0.24595505033579459, 0.24298017990326398,
+  0.2400030224487415, 0.23702360599436734, 0.23404195858354346,
+  0.23105810828067128, 0.22807208317088579, 0.22508391135979278,
+  0.22209362097320359, 0.21910124015686977, 0.2161067970762196,
+  0.21311031991609136, 0.21011183688046972, 0.20711137619221856,
+  0.20410896609281701, 0.20110463484209196, 0.19809841071795373,
+  0.19509032201612833, 0.19208039704989238, 0.18906866414980628,
+  0.18605515166344663, 0.18303988795514106, 0.18002290140569951,
+  0.17700422041214886, 0.17398387338746385, 0.17096188876030136,
+  0.16793829497473123, 0.16491312048997009, 0.16188639378011188,
+  0.15885814333386139, 0.15582839765426532, 0.15279718525844341,
+  0.14976453467732162, 0.14673047445536175, 0.14369503315029458,
+  0.14065823933284924, 0.13762012158648618, 0.13458070850712622,
+  0.13154002870288328, 0.12849811079379322, 0.12545498341154621,
+  0.12241067519921628, 0.11936521481099135, 0.11631863091190488,
+  0.11327095217756436, 0.11022220729388318, 0.10717242495680887,
+  0.10412163387205473, 0.10106986275482788, 0.09801714032956077,
+  0.094963495329639061, 0.091908956497132696, 0.088853552582524684,
+  0.08579731234443988, 0.082740264549375803, 0.079682437971430126,
+  0.076623861392031617, 0.073564563599667454, 0.070504573389614009,
+  0.067443919563664106, 0.06438263092985741, 0.061320736302208648,
+  0.058258264500435732, 0.055195244349690031, 0.052131704680283317,
+  0.049067674327418126, 0.046003182130914644, 0.042938256934940959,
+  0.039872927587739845, 0.036807222941358991, 0.033741171851377642,
+  0.030674803176636581, 0.02760814577896582, 0.024541228522912264,
+  0.021474080275469605, 0.01840672990580482, 0.01533920628498822,
+  0.012271538285719944, 0.0092037547820599599, 0.0061358846491545152,
+  0.0030679567629661379, 0, -0.0030679567629659761,
+  -0.0061358846491544753, -0.0092037547820598194, -0.012271538285719925,
+  -0.0153392062849881, -0.01840672990580482, -0.021474080275469508,
+  -0.024541228522912288, -0.02760814577896574, -0.030674803176636626,
+  -0.03374117185137758, -0.036807222941358832, -0.039872927587739811,
+  -0.04293825693494082, -0.046003182130914623, -0.049067674327418015,
+  -0.052131704680283324, -0.055195244349689934, -0.058258264500435752,
+  -0.061320736302208578, -0.064382630929857465, -0.067443919563664051,
+  -0.070504573389613856, -0.073564563599667426, -0.076623861392031492,
+  -0.079682437971430126, -0.082740264549375692, -0.085797312344439894,
+  -0.0888535525825246, -0.091908956497132724, -0.094963495329638992,
+  -0.098017140329560604, -0.10106986275482782, -0.10412163387205459,
+  -0.10717242495680884, -0.11022220729388306, -0.11327095217756435,
+  -0.11631863091190475, -0.11936521481099135, -0.1224106751992162,
+  -0.12545498341154623, -0.12849811079379317, -0.13154002870288312,
+  -0.13458070850712617, -0.13762012158648604, -0.14065823933284921,
+  -0.14369503315029447, -0.14673047445536175, -0.14976453467732151,
+  -0.15279718525844344, -0.15582839765426523, -0.15885814333386145,
+  -0.16188639378011183, -0.16491312048996992, -0.16793829497473117,
+  -0.17096188876030122, -0.17398387338746382, -0.17700422041214875,
+  -0.18002290140569951, -0.18303988795514095, -0.18605515166344663,
+  -0.18906866414980619, -0.19208039704989244, -0.19509032201612825,
+  -0.19809841071795356, -0.2011046348420919, -0.20410896609281687,
+  -0.20711137619221856, -0.21011183688046961, -0.21311031991609136,
+  -0.21610679707621952, -0.2191012401568698, -0.22209362097320351,
+  -0.22508391135979283, -0.22807208317088573, -0.23105810828067111,
+  -0.23404195858354343, -0.2370236059943672, -0.2400030224487415,
+  -0.24298017990326387, -0.24595505033579459, -0.24892760574572015,
+  -0.25189781815421697, -0.25486565960451457, -0.25783110216215899,
+  -0.26079411791527551, -0.26375467897483135, -0.26671275747489837,
+  -0.26966832557291509, -0.27262135544994898, -0.27557181931095814,
+  -0.27851968938505306, -0.28146493792575794, -0.28440753721127188,
+  -0.28734745954472951, -0.29028467725446233, -0.29321916269425863,
+  -0.29615088824362379, -0.29907982630804048, -0.30200594931922808,
+  -0.30492922973540237, -0.30784964004153487, -0.31076715274961147,
+  -0.31368174039889152, -0.31659337555616585, -0.31950203081601569,
+  -0.32240767880106985, -0.32531029216226293, -0.3282098435790925,
+  -0.33110630575987643, -0.33399965144200938, -0.33688985339222005,
+  -0.33977688440682685, -0.34266071731199438, -0.34554132496398909,
+  -0.34841868024943456, -0.35129275608556709, -0.35416352542049034,
+  -0.35703096123342998, -0.35989503653498811, -0.36275572436739723,
+  -0.36561299780477385, -0.36846682995337232, -0.37131719395183754,
+  -0.37416406297145793, -0.37700741021641826, -0.37984720892405116,
+  -0.38268343236508978, -0.38551605384391885, -0.38834504669882625,
+  -0.39117038430225387, -0.3939920400610481, -0.39680998741671031,
+  -0.39962419984564679, -0.40243465085941843, -0.40524131400498986,
+  -0.40804416286497869, -0.41084317105790391, -0.4136383122384345,
+  -0.41642956009763715, -0.41921688836322391, -0.42200027079979968,
+  -0.42477968120910881, -0.42755509343028208, -0.43032648134008261,
+  -0.43309381885315196, -0.43585707992225547, -0.43861623853852766,
+  -0.44137126873171667, -0.4441221445704292, -0.44686884016237416,
+  -0.44961132965460654, -0.45234958723377089, -0.45508358712634384,
+  -0.45781330359887717, -0.46053871095824001, -0.46325978355186015,
+  -0.46597649576796618, -0.4686888220358279, -0.47139673682599764,
+  -0.47410021465054997, -0.47679923006332209, -0.47949375766015301,
+  -0.48218377207912272, -0.48486924800079106, -0.487550160148436,
+  -0.49022648328829116, -0.49289819222978404, -0.49556526182577254,
+  -0.49822766697278187, -0.50088538261124071, -0.50353838372571758,
+  -0.50618664534515523, -0.50883014254310699, -0.5114688504379703,
+  -0.51410274419322166, -0.51673179901764987, -0.51935599016558964,
+  -0.52197529293715439, -0.52458968267846895, -0.52719913478190128,
+  -0.52980362468629461, -0.5324031278771979, -0.53499761988709715,
+  -0.53758707629564539, -0.54017147272989285, -0.54275078486451589,
+  -0.54532498842204646, -0.54789405917310019, -0.55045797293660481,
+  -0.55301670558002747, -0.55557023301960218, -0.5581185312205561,
+  -0.56066157619733603, -0.56319934401383409, -0.56573181078361312,
+  -0.56825895267013149, -0.57078074588696726, -0.5732971666980422,
+  -0.57580819141784534, -0.57831379641165559, -0.58081395809576453,
+  -0.58330865293769829, -0.58579785745643886, -0.58828154822264522,
+  -0.59075970185887416, -0.5932322950397998, -0.59569930449243336,
+  -0.59816070699634227, -0.60061647938386897, -0.60306659854034816,
+  -0.60551104140432555, -0.60794978496777363, -0.61038280627630948,
+  -0.61281008242940971, -0.61523159058062682, -0.61764730793780387,
+  -0.6200572117632891, -0.62246127937414997, -0.62485948814238634,
+  -0.62725181549514408, -0.62963823891492698, -0.63201873593980906,
+  -0.63439328416364549, -0.6367618612362842, -0.63912444486377573,
+  -0.64148101280858316, -0.64383154288979139, -0.64617601298331628,
+  -0.64851440102211244, -0.65084668499638088, -0.65317284295377676,
+  -0.65549285299961535, -0.65780669329707864, -0.66011434206742048,
+  -0.66241577759017178, -0.66471097820334479, -0.66699992230363747,
+  -0.66928258834663601, -0.67155895484701833, -0.67382900037875604,
+  -0.67609270357531592, -0.67835004312986147, -0.68060099779545302,
+  -0.68284554638524808, -0.68508366777270036, -0.68731534089175905,
+  -0.68954054473706683, -0.69175925836415775, -0.693971460889654,
+  -0.69617713149146299, -0.69837624940897292, -0.70056879394324834,
+  -0.7027547444572253, -0.70493408037590488, -0.70710678118654746,
+  -0.70927282643886558, -0.71143219574521643, -0.71358486878079352,
+  -0.71573082528381859, -0.71787004505573171, -0.72000250796138165,
+  -0.72212819392921535, -0.72424708295146689, -0.72635915508434601,
+  -0.7284643904482252, -0.73056276922782759, -0.73265427167241282,
+  -0.73473887809596339, -0.73681656887736979, -0.73888732446061511,
+  -0.74095112535495911, -0.74300795213512172, -0.74505778544146595,
+  -0.74710060598018013, -0.74913639452345926, -0.75116513190968637,
+  -0.75318679904361241, -0.75520137689653655, -0.75720884650648446,
+  -0.75920918897838796, -0.76120238548426178, -0.76318841726338127,
+  -0.76516726562245896, -0.7671389119358204, -0.76910333764557959,
+  -0.77106052426181371, -0.77301045336273699, -0.77495310659487382,
+  -0.77688846567323244, -0.77881651238147587, -0.78073722857209438,
+  -0.78265059616657573, -0.78455659715557524, -0.78645521359908577,
+  -0.78834642762660623, -0.79023022143731003, -0.79210657730021239,
+  -0.79397547755433717, -0.79583690460888346, -0.79769084094339104,
+  -0.79953726910790501, -0.80137617172314013, -0.80320753148064483,
+  -0.80503133114296366, -0.80684755354379922, -0.80865618158817498,
+  -0.81045719825259477, -0.81225058658520388, -0.8140363297059483,
+  -0.81581441080673378, -0.81758481315158371, -0.8193475200767969,
+  -0.82110251499110465, -0.82284978137582632, -0.82458930278502529,
+  -0.82632106284566342, -0.8280450452577558, -0.82976123379452305,
+  -0.83146961230254524, -0.83317016470191319, -0.83486287498638001,
+  -0.83654772722351189, -0.83822470555483797, -0.83989379419599941,
+  -0.84155497743689833, -0.84320823964184544, -0.84485356524970701,
+  -0.84649093877405202, -0.84812034480329712, -0.84974176800085244,
+  -0.8513551931052652, -0.85296060493036363, -0.85455798836540053,
+  -0.85614732837519447, -0.85772861000027212, -0.85930181835700836,
+  -0.86086693863776731, -0.8624239561110405, -0.8639728561215867,
+  -0.86551362409056898, -0.86704624551569265, -0.8685707059713409,
+  -0.87008699110871135, -0.87159508665595109, -0.87309497841829009,
+  -0.87458665227817611, -0.8760700941954066, -0.87754529020726124,
+  -0.87901222642863341, -0.88047088905216075, -0.88192126434835494,
+  -0.88336333866573158, -0.88479709843093779, -0.88622253014888064,
+  -0.88763962040285393, -0.88904835585466457, -0.89044872324475788,
+  -0.89184070939234272, -0.89322430119551532, -0.89459948563138258,
+  -0.89596624975618511, -0.89732458070541832, -0.89867446569395382,
+  -0.90001589201616028, -0.90134884704602203, -0.90267331823725883,
+  -0.90398929312344334, -0.90529675931811882, -0.90659570451491533,
+  -0.90788611648766615, -0.90916798309052227, -0.91044129225806714,
+  -0.91170603200542988, -0.9129621904283981, -0.91420975570353069,
+  -0.91544871608826783, -0.9166790599210427, -0.91790077562139039,
+  -0.91911385169005777, -0.92031827670911048, -0.9215140393420419,
+  -0.92270112833387852, -0.92387953251128674, -0.92504924078267758,
+  -0.92621024213831127, -0.92736252565040111, -0.92850608047321548,
+  -0.92964089584318133, -0.93076696107898371, -0.93188426558166815,
+  -0.93299279883473885, -0.93409255040425887, -0.9351835099389475,
+  -0.93626566717027826, -0.93733901191257496, -0.93840353406310806,
+  -0.93945922360218992, -0.9405060705932683, -0.94154406518302081,
+  -0.94257319760144687, -0.94359345816196039, -0.94460483726148026,
+  -0.94560732538052128, -0.94660091308328353, -0.94758559101774109,
+  -0.94856134991573027, -0.94952818059303667, -0.9504860739494817,
+  -0.95143502096900834, -0.95237501271976588, -0.95330604035419375,
+  -0.95422809510910567, -0.95514116830577067, -0.95604525134999641,
+  -0.95694033573220894, -0.95782641302753291, -0.9587034748958716,
+  -0.95957151308198452, -0.96043051941556579, -0.96128048581132064,
+  -0.96212140426904158, -0.96295326687368388, -0.96377606579543984,
+  -0.96458979328981265, -0.9653944416976894, -0.96619000344541262,
+  -0.96697647104485207, -0.96775383709347551, -0.96852209427441727,
+  -0.96928123535654853, -0.97003125319454397, -0.97077214072895035,
+  -0.97150389098625178, -0.97222649707893627, -0.97293995220556007,
+  -0.97364424965081187, -0.97433938278557586, -0.97502534506699412,
+  -0.97570213003852857, -0.97636973133002114, -0.97702814265775439,
+  -0.97767735782450993, -0.97831737071962765, -0.9789481753190622,
+  -0.97956976568544052, -0.98018213596811732, -0.98078528040323043,
+  -0.98137919331375456, -0.98196386910955524, -0.98253930228744124,
+  -0.98310548743121629, -0.98366241921173025, -0.98421009238692903,
+  -0.98474850180190421, -0.98527764238894122, -0.98579750916756737,
+  -0.98630809724459867, -0.98680940181418542, -0.98730141815785843,
+  -0.98778414164457218, -0.98825756773074946, -0.98872169196032378,
+  -0.98917650996478101, -0.98962201746320078, -0.99005821026229712,
+  -0.99048508425645698, -0.99090263542778001, -0.99131085984611544,
+  -0.99170975366909953, -0.9920993131421918, -0.99247953459870997,
+  -0.9928504144598651, -0.9932119492347945, -0.9935641355205953,
+  -0.99390697000235606, -0.9942404494531879, -0.99456457073425542,
+  -0.99487933079480562, -0.99518472667219682, -0.99548075549192694,
+  -0.99576741446765982, -0.99604470090125197, -0.996312612182778,
+  -0.99657114579055484, -0.99682029929116567, -0.99706007033948296,
+  -0.99729045667869021, -0.99751145614030345, -0.99772306664419164,
+  -0.997925286198596, -0.99811811290014918, -0.99830154493389289,
+  -0.99847558057329477, -0.99864021818026527, -0.99879545620517241,
+  -0.99894129318685687, -0.99907772775264536, -0.99920475861836389,
+  -0.99932238458834954, -0.99943060455546173, -0.99952941750109314,
+  -0.99961882249517864, -0.99969881869620425, -0.99976940535121528,
+  -0.9998305817958234, -0.99988234745421256, -0.9999247018391445,
+  -0.9999576445519639, -0.99998117528260111, -0.99999529380957619,
+  -1, -0.99999529380957619, -0.99998117528260111,
+  -0.9999576445519639, -0.9999247018391445, -0.99988234745421256,
+  -0.9998305817958234, -0.99976940535121528, -0.99969881869620425,
+  -0.99961882249517864, -0.99952941750109314, -0.99943060455546173,
+  -0.99932238458834954, -0.99920475861836389, -0.99907772775264536,
+  -0.99894129318685687, -0.99879545620517241, -0.99864021818026527,
+  -0.99847558057329477, -0.99830154493389289, -0.99811811290014918,
+  -0.997925286198596, -0.99772306664419164, -0.99751145614030345,
+  -0.99729045667869021, -0.99706007033948296, -0.99682029929116567,
+  -0.99657114579055484, -0.996312612182778, -0.99604470090125197,
+  -0.99576741446765982, -0.99548075549192694, -0.99518472667219693,
+  -0.99487933079480562, -0.99456457073425542, -0.9942404494531879,
+  -0.99390697000235606, -0.9935641355205953, -0.9932119492347945,
+  -0.9928504144598651, -0.99247953459870997, -0.9920993131421918,
+  -0.99170975366909953, -0.99131085984611544, -0.99090263542778001,
+  -0.99048508425645709, -0.99005821026229712, -0.98962201746320089,
+  -0.98917650996478101, -0.98872169196032378, -0.98825756773074946,
+  -0.98778414164457218, -0.98730141815785843, -0.98680940181418553,
+  -0.98630809724459867, -0.98579750916756748, -0.98527764238894122,
+  -0.98474850180190421, -0.98421009238692903, -0.98366241921173025,
+  -0.98310548743121629, -0.98253930228744124, -0.98196386910955524,
+  -0.98137919331375456, -0.98078528040323043, -0.98018213596811743,
+  -0.97956976568544052, -0.9789481753190622, -0.97831737071962765,
+  -0.97767735782450993, -0.97702814265775439, -0.97636973133002114,
+  -0.97570213003852857, -0.97502534506699412, -0.97433938278557586,
+  -0.97364424965081198, -0.97293995220556018, -0.97222649707893627,
+  -0.97150389098625178, -0.97077214072895035, -0.97003125319454397,
+  -0.96928123535654853, -0.96852209427441738, -0.96775383709347551,
+  -0.96697647104485207, -0.9661900034454125, -0.9653944416976894,
+  -0.96458979328981276, -0.96377606579543984, -0.96295326687368388,
+  -0.96212140426904158, -0.96128048581132064, -0.96043051941556579,
+  -0.95957151308198452, -0.9587034748958716, -0.95782641302753291,
+  -0.95694033573220882, -0.95604525134999641, -0.95514116830577078,
+  -0.95422809510910567, -0.95330604035419386, -0.95237501271976588,
+  -0.95143502096900834, -0.9504860739494817, -0.94952818059303667,
+  -0.94856134991573027, -0.94758559101774109, -0.94660091308328353,
+  -0.94560732538052128, -0.94460483726148026, -0.94359345816196039,
+  -0.94257319760144687, -0.94154406518302081, -0.9405060705932683,
+  -0.93945922360218992, -0.93840353406310806, -0.93733901191257496,
+  -0.93626566717027826, -0.93518350993894761, -0.93409255040425898,
+  -0.93299279883473896, -0.93188426558166815, -0.93076696107898371,
+  -0.92964089584318133, -0.92850608047321559, -0.92736252565040111,
+  -0.92621024213831138, -0.92504924078267758, -0.92387953251128674,
+  -0.92270112833387863, -0.92151403934204201, -0.92031827670911059,
+  -0.91911385169005777, -0.9179007756213905, -0.9166790599210427,
+  -0.91544871608826783, -0.91420975570353069, -0.91296219042839821,
+  -0.91170603200542988, -0.91044129225806725, -0.90916798309052238,
+  -0.90788611648766626, -0.90659570451491533, -0.90529675931811882,
+  -0.90398929312344334, -0.90267331823725883, -0.90134884704602203,
+  -0.90001589201616028, -0.89867446569395382, -0.89732458070541832,
+  -0.89596624975618522, -0.8945994856313827, -0.89322430119551532,
+  -0.89184070939234272, -0.89044872324475788, -0.88904835585466457,
+  -0.88763962040285393, -0.88622253014888064, -0.88479709843093779,
+  -0.88336333866573158, -0.88192126434835505, -0.88047088905216075,
+  -0.87901222642863353, -0.87754529020726135, -0.8760700941954066,
+  -0.87458665227817611, -0.87309497841829009, -0.87159508665595098,
+  -0.87008699110871146, -0.8685707059713409, -0.86704624551569265,
+  -0.86551362409056909, -0.86397285612158681, -0.86242395611104061,
+  -0.86086693863776731, -0.85930181835700847, -0.85772861000027212,
+  -0.85614732837519447, -0.85455798836540053, -0.85296060493036363,
+  -0.8513551931052652, -0.84974176800085255, -0.84812034480329723,
+  -0.84649093877405213, -0.84485356524970712, -0.84320823964184544,
+  -0.84155497743689844, -0.83989379419599952, -0.83822470555483808,
+  -0.83654772722351201, -0.83486287498638001, -0.83317016470191319,
+  -0.83146961230254524, -0.82976123379452305, -0.8280450452577558,
+  -0.82632106284566353, -0.82458930278502529, -0.82284978137582643,
+  -0.82110251499110465, -0.8193475200767969, -0.81758481315158371,
+  -0.81581441080673378, -0.81403632970594841, -0.81225058658520388,
+  -0.81045719825259477, -0.80865618158817498, -0.80684755354379933,
+  -0.80503133114296366, -0.80320753148064494, -0.80137617172314024,
+  -0.79953726910790501, -0.79769084094339116, -0.79583690460888357,
+  -0.79397547755433717, -0.79210657730021239, -0.79023022143731003,
+  -0.78834642762660634, -0.78645521359908577, -0.78455659715557524,
+  -0.78265059616657573, -0.78073722857209449, -0.77881651238147598,
+  -0.77688846567323244, -0.77495310659487393, -0.77301045336273699,
+  -0.77106052426181382, -0.7691033376455797, -0.7671389119358204,
+  -0.76516726562245896, -0.76318841726338127, -0.76120238548426178,
+  -0.75920918897838807, -0.75720884650648457, -0.75520137689653655,
+  -0.75318679904361252, -0.75116513190968648, -0.74913639452345937,
+  -0.74710060598018013, -0.74505778544146606, -0.74300795213512172,
+  -0.74095112535495911, -0.73888732446061511, -0.7368165688773699,
+  -0.7347388780959635, -0.73265427167241282, -0.73056276922782759,
+  -0.7284643904482252, -0.72635915508434601, -0.724247082951467,
+  -0.72212819392921535, -0.72000250796138165, -0.71787004505573171,
+  -0.71573082528381859, -0.71358486878079364, -0.71143219574521643,
+  -0.70927282643886569, -0.70710678118654757, -0.70493408037590499,
+  -0.7027547444572253, -0.70056879394324845, -0.69837624940897292,
+  -0.69617713149146299, -0.693971460889654, -0.69175925836415775,
+  -0.68954054473706694, -0.68731534089175916, -0.68508366777270036,
+  -0.68284554638524808, -0.68060099779545313, -0.67835004312986158,
+  -0.67609270357531603, -0.67382900037875615, -0.67155895484701833,
+  -0.66928258834663601, -0.66699992230363747, -0.6647109782033449,
+  -0.66241577759017178, -0.66011434206742048, -0.65780669329707864,
+  -0.65549285299961546, -0.65317284295377676, -0.65084668499638099,
+  -0.64851440102211255, -0.64617601298331639, -0.6438315428897915,
+  -0.64148101280858316, -0.63912444486377573, -0.6367618612362842,
+  -0.63439328416364549, -0.63201873593980906, -0.6296382389149271,
+  -0.62725181549514419, -0.62485948814238645, -0.62246127937415008,
+  -0.62005721176328921, -0.61764730793780398, -0.61523159058062682,
+  -0.61281008242940971, -0.61038280627630948, -0.60794978496777374,
+  -0.60551104140432555, -0.60306659854034828, -0.60061647938386897,
+  -0.59816070699634238, -0.59569930449243347, -0.5932322950397998,
+  -0.59075970185887428, -0.58828154822264533, -0.58579785745643886,
+  -0.58330865293769829, -0.58081395809576453, -0.57831379641165559,
+  -0.57580819141784534, -0.57329716669804232, -0.57078074588696737,
+  -0.56825895267013149, -0.56573181078361323, -0.56319934401383409,
+  -0.56066157619733603, -0.5581185312205561, -0.55557023301960229,
+  -0.55301670558002758, -0.55045797293660481, -0.54789405917310019,
+  -0.54532498842204646, -0.542750784864516, -0.54017147272989297,
+  -0.53758707629564551, -0.53499761988709726, -0.53240312787719801,
+  -0.52980362468629483, -0.52719913478190139, -0.52458968267846884,
+  -0.52197529293715439, -0.51935599016558953, -0.51673179901764998,
+  -0.51410274419322166, -0.51146885043797052, -0.50883014254310699,
+  -0.50618664534515545, -0.50353838372571758, -0.50088538261124094,
+  -0.49822766697278187, -0.49556526182577249, -0.49289819222978409,
+  -0.4902264832882911, -0.48755016014843605, -0.48486924800079112,
+  -0.48218377207912283, -0.47949375766015301, -0.47679923006332225,
+  -0.47410021465055002, -0.47139673682599781, -0.46868882203582796,
+  -0.46597649576796613, -0.46325978355186026, -0.46053871095824001,
+  -0.45781330359887729, -0.45508358712634384, -0.452349587233771,
+  -0.4496113296546066, -0.44686884016237433, -0.44412214457042926,
+  -0.44137126873171662, -0.43861623853852771, -0.43585707992225547,
+  -0.43309381885315201, -0.43032648134008261, -0.4275550934302822,
+  -0.42477968120910881, -0.42200027079979979, -0.41921688836322396,
+  -0.41642956009763732, -0.41363831223843456, -0.41084317105790391,
+  -0.40804416286497874, -0.40524131400498986, -0.40243465085941854,
+  -0.39962419984564679, -0.39680998741671042, -0.3939920400610481,
+  -0.39117038430225398, -0.3883450466988263, -0.38551605384391902,
+  -0.38268343236508984, -0.37984720892405111, -0.37700741021641831,
+  -0.37416406297145799, -0.3713171939518376, -0.36846682995337232,
+  -0.36561299780477396, -0.36275572436739723, -0.35989503653498828,
+  -0.35703096123343003, -0.35416352542049051, -0.35129275608556715,
+  -0.34841868024943451, -0.34554132496398915, -0.34266071731199438,
+  -0.33977688440682696, -0.33688985339222005, -0.33399965144200949,
+  -0.33110630575987643, -0.32820984357909266, -0.32531029216226298,
+  -0.32240767880107002, -0.31950203081601575, -0.31659337555616585,
+  -0.31368174039889157, -0.31076715274961147, -0.30784964004153498,
+  -0.30492922973540243, -0.3020059493192282, -0.29907982630804048,
+  -0.29615088824362396, -0.29321916269425868, -0.29028467725446233,
+  -0.28734745954472957, -0.28440753721127182, -0.28146493792575805,
+  -0.27851968938505306, -0.27557181931095825, -0.27262135544994898,
+  -0.2696683255729152, -0.26671275747489842, -0.26375467897483151,
+  -0.26079411791527557, -0.25783110216215893, -0.25486565960451463,
+  -0.25189781815421691, -0.24892760574572026, -0.24595505033579459,
+  -0.24298017990326398, -0.2400030224487415, -0.23702360599436734,
+  -0.23404195858354346, -0.23105810828067128, -0.22807208317088579,
+  -0.22508391135979278, -0.22209362097320359, -0.21910124015686977,
+  -0.2161067970762196, -0.21311031991609136, -0.21011183688046972,
+  -0.20711137619221856, -0.20410896609281701, -0.20110463484209196,
+  -0.19809841071795373, -0.19509032201612833, -0.19208039704989238,
+  -0.18906866414980628, -0.18605515166344663, -0.18303988795514106,
+  -0.18002290140569951, -0.17700422041214886, -0.17398387338746385,
+  -0.17096188876030136, -0.16793829497473123, -0.16491312048997009,
+  -0.16188639378011188, -0.15885814333386139, -0.15582839765426532,
+  -0.15279718525844341, -0.14976453467732162, -0.14673047445536175,
+  -0.14369503315029458, -0.14065823933284924, -0.13762012158648618,
+  -0.13458070850712622, -0.13154002870288328, -0.12849811079379322,
+  -0.12545498341154621, -0.12241067519921628, -0.11936521481099135,
+  -0.11631863091190488, -0.11327095217756436, -0.11022220729388318,
+  -0.10717242495680887, -0.10412163387205473, -0.10106986275482788,
+  -0.09801714032956077, -0.094963495329639061, -0.091908956497132696,
+  -0.088853552582524684, -0.08579731234443988, -0.082740264549375803,
+  -0.079682437971430126, -0.076623861392031617, -0.073564563599667454,
+  -0.070504573389614009, -0.067443919563664106, -0.06438263092985741,
+  -0.061320736302208648, -0.058258264500435732, -0.055195244349690031,
+  -0.052131704680283317, -0.049067674327418126, -0.046003182130914644,
+  -0.042938256934940959, -0.039872927587739845, -0.036807222941358991,
+  -0.033741171851377642, -0.030674803176636581, -0.02760814577896582,
+  -0.024541228522912264, -0.021474080275469605, -0.01840672990580482,
+  -0.01533920628498822, -0.012271538285719944, -0.0092037547820599599,
+  -0.0061358846491545152, -0.0030679567629661379, 0,
+  0.0030679567629659761, 0.0061358846491544753, 0.0092037547820598194,
+  0.012271538285719925, 0.0153392062849881, 0.01840672990580482,
+  0.021474080275469508, 0.024541228522912288, 0.02760814577896574,
+  0.030674803176636626, 0.03374117185137758, 0.036807222941358832,
+  0.039872927587739811, 0.04293825693494082, 0.046003182130914623,
+  0.049067674327418015, 0.052131704680283324, 0.055195244349689934,
+  0.058258264500435752, 0.061320736302208578, 0.064382630929857465,
+  0.067443919563664051, 0.070504573389613856, 0.073564563599667426,
+  0.076623861392031492, 0.079682437971430126, 0.082740264549375692,
+  0.085797312344439894, 0.0888535525825246, 0.091908956497132724,
+  0.094963495329638992, 0.098017140329560604, 0.10106986275482782,
+  0.10412163387205459, 0.10717242495680884, 0.11022220729388306,
+  0.11327095217756435, 0.11631863091190475, 0.11936521481099135,
+  0.1224106751992162, 0.12545498341154623, 0.12849811079379317,
+  0.13154002870288312, 0.13458070850712617, 0.13762012158648604,
+  0.14065823933284921, 0.14369503315029447, 0.14673047445536175,
+  0.14976453467732151, 0.15279718525844344, 0.15582839765426523,
+  0.15885814333386145, 0.16188639378011183, 0.16491312048996992,
+  0.16793829497473117, 0.17096188876030122, 0.17398387338746382,
+  0.17700422041214875, 0.18002290140569951, 0.18303988795514095,
+  0.18605515166344663, 0.18906866414980619, 0.19208039704989244,
+  0.19509032201612825, 0.19809841071795356, 0.2011046348420919,
+  0.20410896609281687, 0.20711137619221856, 0.21011183688046961,
+  0.21311031991609136, 0.21610679707621952, 0.2191012401568698,
+  0.22209362097320351, 0.22508391135979283, 0.22807208317088573,
+  0.23105810828067111, 0.23404195858354343, 0.2370236059943672,
+  0.2400030224487415, 0.24298017990326387, 0.24595505033579459,
+  0.24892760574572015, 0.25189781815421697, 0.25486565960451457,
+  0.25783110216215899, 0.26079411791527551, 0.26375467897483135,
+  0.26671275747489837, 0.26966832557291509, 0.27262135544994898,
+  0.27557181931095814, 0.27851968938505306, 0.28146493792575794,
+  0.28440753721127188, 0.28734745954472951, 0.29028467725446233,
+  0.29321916269425863, 0.29615088824362379, 0.29907982630804048,
+  0.30200594931922808, 0.30492922973540237, 0.30784964004153487,
+  0.31076715274961147, 0.31368174039889152, 0.31659337555616585,
+  0.31950203081601569, 0.32240767880106985, 0.32531029216226293,
+  0.3282098435790925, 0.33110630575987643, 0.33399965144200938,
+  0.33688985339222005, 0.33977688440682685, 0.34266071731199438,
+  0.34554132496398909, 0.34841868024943456, 0.35129275608556709,
+  0.35416352542049034, 0.35703096123342998, 0.35989503653498811,
+  0.36275572436739723, 0.36561299780477385, 0.36846682995337232,
+  0.37131719395183754, 0.37416406297145793, 0.37700741021641826,
+  0.37984720892405116, 0.38268343236508978, 0.38551605384391885,
+  0.38834504669882625, 0.39117038430225387, 0.3939920400610481,
+  0.39680998741671031, 0.39962419984564679, 0.40243465085941843,
+  0.40524131400498986, 0.40804416286497869, 0.41084317105790391,
+  0.4136383122384345, 0.41642956009763715, 0.41921688836322391,
+  0.42200027079979968, 0.42477968120910881, 0.42755509343028208,
+  0.43032648134008261, 0.43309381885315196, 0.43585707992225547,
+  0.43861623853852766, 0.44137126873171667, 0.4441221445704292,
+  0.44686884016237416, 0.44961132965460654, 0.45234958723377089,
+  0.45508358712634384, 0.45781330359887717, 0.46053871095824001,
+  0.46325978355186015, 0.46597649576796618, 0.4686888220358279,
+  0.47139673682599764, 0.47410021465054997, 0.47679923006332209,
+  0.47949375766015301, 0.48218377207912272, 0.48486924800079106,
+  0.487550160148436, 0.49022648328829116, 0.49289819222978404,
+  0.49556526182577254, 0.49822766697278187, 0.50088538261124071,
+  0.50353838372571758, 0.50618664534515523, 0.50883014254310699,
+  0.5114688504379703, 0.51410274419322166, 0.51673179901764987,
+  0.51935599016558964, 0.52197529293715439, 0.52458968267846895,
+  0.52719913478190128, 0.52980362468629461, 0.5324031278771979,
+  0.53499761988709715, 0.53758707629564539, 0.54017147272989285,
+  0.54275078486451589, 0.54532498842204646, 0.54789405917310019,
+  0.55045797293660481, 0.55301670558002747, 0.55557023301960218,
+  0.5581185312205561, 0.56066157619733603, 0.56319934401383409,
+  0.56573181078361312, 0.56825895267013149, 0.57078074588696726,
+  0.5732971666980422, 0.57580819141784534, 0.57831379641165559,
+  0.58081395809576453, 0.58330865293769829, 0.58579785745643886,
+  0.58828154822264522, 0.59075970185887416, 0.5932322950397998,
+  0.59569930449243336, 0.59816070699634227, 0.60061647938386897,
+  0.60306659854034816, 0.60551104140432555, 0.60794978496777363,
+  0.61038280627630948, 0.61281008242940971, 0.61523159058062682,
+  0.61764730793780387, 0.6200572117632891, 0.62246127937414997,
+  0.62485948814238634, 0.62725181549514408, 0.62963823891492698,
+  0.63201873593980906, 0.63439328416364549, 0.6367618612362842,
+  0.63912444486377573, 0.64148101280858316, 0.64383154288979139,
+  0.64617601298331628, 0.64851440102211244, 0.65084668499638088,
+  0.65317284295377676, 0.65549285299961535, 0.65780669329707864,
+  0.66011434206742048, 0.66241577759017178, 0.66471097820334479,
+  0.66699992230363747, 0.66928258834663601, 0.67155895484701833,
+  0.67382900037875604, 0.67609270357531592, 0.67835004312986147,
+  0.68060099779545302, 0.68284554638524808, 0.68508366777270036,
+  0.68731534089175905, 0.68954054473706683, 0.69175925836415775,
+  0.693971460889654, 0.69617713149146299, 0.69837624940897292,
+  0.70056879394324834, 0.7027547444572253, 0.70493408037590488,
+  0.70710678118654746, 0.70927282643886558, 0.71143219574521643,
+  0.71358486878079352, 0.71573082528381859, 0.71787004505573171,
+  0.72000250796138165, 0.72212819392921535, 0.72424708295146689,
+  0.72635915508434601, 0.7284643904482252, 0.73056276922782759,
+  0.73265427167241282, 0.73473887809596339, 0.73681656887736979,
+  0.73888732446061511, 0.74095112535495911, 0.74300795213512172,
+  0.74505778544146595, 0.74710060598018013, 0.74913639452345926,
+  0.75116513190968637, 0.75318679904361241, 0.75520137689653655,
+  0.75720884650648446, 0.75920918897838796, 0.76120238548426178,
+  0.76318841726338127, 0.76516726562245896, 0.7671389119358204,
+  0.76910333764557959, 0.77106052426181371, 0.77301045336273699,
+  0.77495310659487382, 0.77688846567323244, 0.77881651238147587,
+  0.78073722857209438, 0.78265059616657573, 0.78455659715557524,
+  0.78645521359908577, 0.78834642762660623, 0.79023022143731003,
+  0.79210657730021239, 0.79397547755433717, 0.79583690460888346,
+  0.79769084094339104, 0.79953726910790501, 0.80137617172314013,
+  0.80320753148064483, 0.80503133114296366, 0.80684755354379922,
+  0.80865618158817498, 0.81045719825259477, 0.81225058658520388,
+  0.8140363297059483, 0.81581441080673378, 0.81758481315158371,
+  0.8193475200767969, 0.82110251499110465, 0.82284978137582632,
+  0.82458930278502529, 0.82632106284566342, 0.8280450452577558,
+  0.82976123379452305, 0.83146961230254524, 0.83317016470191319,
+  0.83486287498638001, 0.83654772722351189, 0.83822470555483797,
+  0.83989379419599941, 0.84155497743689833, 0.84320823964184544,
+  0.84485356524970701, 0.84649093877405202, 0.84812034480329712,
+  0.84974176800085244, 0.8513551931052652, 0.85296060493036363,
+  0.85455798836540053, 0.85614732837519447, 0.85772861000027212,
+  0.85930181835700836, 0.86086693863776731, 0.8624239561110405,
+  0.8639728561215867, 0.86551362409056898, 0.86704624551569265,
+  0.8685707059713409, 0.87008699110871135, 0.87159508665595109,
+  0.87309497841829009, 0.87458665227817611, 0.8760700941954066,
+  0.87754529020726124, 0.87901222642863341, 0.88047088905216075,
+  0.88192126434835494, 0.88336333866573158, 0.88479709843093779,
+  0.88622253014888064, 0.88763962040285393, 0.88904835585466457,
+  0.89044872324475788, 0.89184070939234272, 0.89322430119551532,
+  0.89459948563138258, 0.89596624975618511, 0.89732458070541832,
+  0.89867446569395382, 0.90001589201616028, 0.90134884704602203,
+  0.90267331823725883, 0.90398929312344334, 0.90529675931811882,
+  0.90659570451491533, 0.90788611648766615, 0.90916798309052227,
+  0.91044129225806714, 0.91170603200542988, 0.9129621904283981,
+  0.91420975570353069, 0.91544871608826783, 0.9166790599210427,
+  0.91790077562139039, 0.91911385169005777, 0.92031827670911048,
+  0.9215140393420419, 0.92270112833387852, 0.92387953251128674,
+  0.92504924078267758, 0.92621024213831127, 0.92736252565040111,
+  0.92850608047321548, 0.92964089584318133, 0.93076696107898371,
+  0.93188426558166815, 0.93299279883473885, 0.93409255040425887,
+  0.9351835099389475, 0.93626566717027826, 0.93733901191257496,
+  0.93840353406310806, 0.93945922360218992, 0.9405060705932683,
+  0.94154406518302081, 0.94257319760144687, 0.94359345816196039,
+  0.94460483726148026, 0.94560732538052128, 0.94660091308328353,
+  0.94758559101774109, 0.94856134991573027, 0.94952818059303667,
+  0.9504860739494817, 0.95143502096900834, 0.95237501271976588,
+  0.95330604035419375, 0.95422809510910567, 0.95514116830577067,
+  0.95604525134999641, 0.95694033573220894, 0.95782641302753291,
+  0.9587034748958716, 0.95957151308198452, 0.96043051941556579,
+  0.96128048581132064, 0.96212140426904158, 0.96295326687368388,
+  0.96377606579543984, 0.96458979328981265, 0.9653944416976894,
+  0.96619000344541262, 0.96697647104485207, 0.96775383709347551,
+  0.96852209427441727, 0.96928123535654853, 0.97003125319454397,
+  0.97077214072895035, 0.97150389098625178, 0.97222649707893627,
+  0.97293995220556007, 0.97364424965081187, 0.97433938278557586,
+  0.97502534506699412, 0.97570213003852857, 0.97636973133002114,
+  0.97702814265775439, 0.97767735782450993, 0.97831737071962765,
+  0.9789481753190622, 0.97956976568544052, 0.98018213596811732,
+  0.98078528040323043, 0.98137919331375456, 0.98196386910955524,
+  0.98253930228744124, 0.98310548743121629, 0.98366241921173025,
+  0.98421009238692903, 0.98474850180190421, 0.98527764238894122,
+  0.98579750916756737, 0.98630809724459867, 0.98680940181418542,
+  0.98730141815785843, 0.98778414164457218, 0.98825756773074946,
+  0.98872169196032378, 0.98917650996478101, 0.98962201746320078,
+  0.99005821026229712, 0.99048508425645698, 0.99090263542778001,
+  0.99131085984611544, 0.99170975366909953, 0.9920993131421918,
+  0.99247953459870997, 0.9928504144598651, 0.9932119492347945,
+  0.9935641355205953, 0.99390697000235606, 0.9942404494531879,
+  0.99456457073425542, 0.99487933079480562, 0.99518472667219682,
+  0.99548075549192694, 0.99576741446765982, 0.99604470090125197,
+  0.996312612182778, 0.99657114579055484, 0.99682029929116567,
+  0.99706007033948296, 0.99729045667869021, 0.99751145614030345,
+  0.99772306664419164, 0.997925286198596, 0.99811811290014918,
+  0.99830154493389289, 0.99847558057329477, 0.99864021818026527,
+  0.99879545620517241, 0.99894129318685687, 0.99907772775264536,
+  0.99920475861836389, 0.99932238458834954, 0.99943060455546173,
+  0.99952941750109314, 0.99961882249517864, 0.99969881869620425,
+  0.99976940535121528, 0.9998305817958234, 0.99988234745421256,
+  0.9999247018391445, 0.9999576445519639, 0.99998117528260111,
+  0.99999529380957619, 1
+};
+
+static const double fft_static_sin_4096[5121] =
+{
+  0, 0.0015339801862847655, 0.0030679567629659761,
+  0.0046019261204485705, 0.0061358846491544753, 0.007669828739531097,
+  0.0092037547820598194, 0.010737659167264491, 0.012271538285719925,
+  0.013805388528060391, 0.0153392062849881, 0.01687298794728171,
+  0.01840672990580482, 0.019940428551514441, 0.021474080275469508,
+  0.023007681468839369, 0.024541228522912288, 0.026074717829103901,
+  0.02760814577896574, 0.029141508764193722, 0.030674803176636626,
+  0.032208025408304586, 0.03374117185137758, 0.035274238898213947,
+  0.036807222941358832, 0.038340120373552694, 0.039872927587739811,
+  0.041405640977076739, 0.04293825693494082, 0.044470771854938668,
+  0.046003182130914623, 0.047535484156959303, 0.049067674327418015,
+  0.050599749036899282, 0.052131704680283324, 0.05366353765273052,
+  0.055195244349689934, 0.056726821166907748, 0.058258264500435752,
+  0.059789570746639868, 0.061320736302208578, 0.062851757564161406,
+  0.064382630929857465, 0.065913352797003805, 0.067443919563664051,
+  0.068974327628266746, 0.070504573389613856, 0.072034653246889332,
+  0.073564563599667426, 0.075094300847921305, 0.076623861392031492,
+  0.078153241632794232, 0.079682437971430126, 0.081211446809592441,
+  0.082740264549375692, 0.084268887593324071, 0.085797312344439894,
+  0.087325535206192059, 0.0888535525825246, 0.090381360877864983,
+  0.091908956497132724, 0.093436335845747787, 0.094963495329638992,
+  0.096490431355252593, 0.098017140329560604, 0.099543618660069319,
+  0.10106986275482782, 0.10259586902243628, 0.10412163387205459,
+  0.10564715371341062, 0.10717242495680884, 0.10869744401313872,
+  0.11022220729388306, 0.11174671121112659, 0.11327095217756435,
+  0.11479492660651008, 0.11631863091190475, 0.11784206150832498,
+  0.11936521481099135, 0.12088808723577708, 0.1224106751992162,
+  0.12393297511851216, 0.12545498341154623, 0.12697669649688587,
+  0.12849811079379317, 0.13001922272223335, 0.13154002870288312,
+  0.13306052515713906, 0.13458070850712617, 0.1361005751757062,
+  0.13762012158648604, 0.1391393441638262, 0.14065823933284921,
+  0.14217680351944803, 0.14369503315029447, 0.14521292465284746,
+  0.14673047445536175, 0.14824767898689603, 0.14976453467732151,
+  0.15128103795733022, 0.15279718525844344, 0.1543129730130201,
+  0.15582839765426523, 0.15734345561623825, 0.15885814333386145,
+  0.16037245724292828, 0.16188639378011183, 0.16339994938297323,
+  0.16491312048996992, 0.1664259035404641, 0.16793829497473117,
+  0.16945029123396796, 0.17096188876030122, 0.17247308399679595,
+  0.17398387338746382, 0.17549425337727143, 0.17700422041214875,
+  0.17851377093899751, 0.18002290140569951, 0.18153160826112497,
+  0.18303988795514095, 0.18454773693861962, 0.18605515166344663,
+  0.1875621285825296, 0.18906866414980619, 0.19057475482025274,
+  0.19208039704989244, 0.19358558729580361, 0.19509032201612825,
+  0.19659459767008022, 0.19809841071795356, 0.19960175762113097,
+  0.2011046348420919, 0.20260703884442113, 0.20410896609281687,
+  0.20561041305309924, 0.20711137619221856, 0.20861185197826349,
+  0.21011183688046961, 0.21161132736922755, 0.21311031991609136,
+  0.21460881099378676, 0.21610679707621952, 0.21760427463848364,
+  0.2191012401568698, 0.22059769010887351, 0.22209362097320351,
+  0.22358902922978999, 0.22508391135979283, 0.22657826384561,
+  0.22807208317088573, 0.22956536582051887, 0.23105810828067111,
+  0.23255030703877524, 0.23404195858354343, 0.23553305940497549,
+  0.2370236059943672, 0.23851359484431842, 0.2400030224487415,
+  0.24149188530286933, 0.24298017990326387, 0.24446790274782415,
+  0.24595505033579459, 0.24744161916777327, 0.24892760574572015,
+  0.25041300657296522, 0.25189781815421697, 0.25338203699557016,
+  0.25486565960451457, 0.25634868248994291, 0.25783110216215899,
+  0.25931291513288623, 0.26079411791527551, 0.26227470702391359,
+  0.26375467897483135, 0.26523403028551179, 0.26671275747489837,
+  0.26819085706340318, 0.26966832557291509, 0.27114515952680801,
+  0.27262135544994898, 0.27409690986870638, 0.27557181931095814,
+  0.2770460803060999, 0.27851968938505306, 0.27999264308027322,
+  0.28146493792575794, 0.28293657045705539, 0.28440753721127188,
+  0.28587783472708062, 0.28734745954472951, 0.28881640820604948,
+  0.29028467725446233, 0.29175226323498926, 0.29321916269425863,
+  0.29468537218051433, 0.29615088824362379, 0.2976157074350862,
+  0.29907982630804048, 0.30054324141727345, 0.30200594931922808,
+  0.30346794657201132, 0.30492922973540237, 0.30638979537086092,
+  0.30784964004153487, 0.30930876031226873, 0.31076715274961147,
+  0.31222481392182488, 0.31368174039889152, 0.31513792875252244,
+  0.31659337555616585, 0.31804807738501495, 0.31950203081601569,
+  0.32095523242787521, 0.32240767880106985, 0.32385936651785285,
+  0.32531029216226293, 0.32676045232013173, 0.3282098435790925,
+  0.32965846252858749, 0.33110630575987643, 0.33255336986604422,
+  0.33399965144200938, 0.3354451470845316, 0.33688985339222005,
+  0.33833376696554113, 0.33977688440682685, 0.34121920232028236,
+  0.34266071731199438, 0.34410142598993881, 0.34554132496398909,
+  0.34698041084592368, 0.34841868024943456, 0.34985612979013492,
+  0.35129275608556709, 0.35272855575521073, 0.35416352542049034,
+  0.35559766170478385, 0.35703096123342998, 0.35846342063373654,
+  0.35989503653498811, 0.36132580556845428, 0.36275572436739723,
+  0.36418478956707989, 0.36561299780477385, 0.36704034571976718,
+  0.36846682995337232, 0.3698924471489341, 0.37131719395183754,
+  0.37274106700951576, 0.37416406297145793, 0.37558617848921722,
+  0.37700741021641826, 0.37842775480876556, 0.37984720892405116,
+  0.38126576922216238, 0.38268343236508978, 0.38410019501693504,
+  0.38551605384391885, 0.38693100551438858, 0.38834504669882625,
+  0.38975817406985641, 0.39117038430225387, 0.39258167407295147,
+  0.3939920400610481, 0.39540147894781635, 0.39680998741671031,
+  0.39821756215337356, 0.39962419984564679, 0.40102989718357562,
+  0.40243465085941843, 0.40383845756765407, 0.40524131400498986,
+  0.40664321687036903, 0.40804416286497869, 0.40944414869225759,
+  0.41084317105790391, 0.41224122666988289, 0.4136383122384345,
+  0.41503442447608163, 0.41642956009763715, 0.41782371582021227,
+  0.41921688836322391, 0.42060907444840251, 0.42200027079979968,
+  0.42339047414379605, 0.42477968120910881, 0.42616788872679962,
+  0.42755509343028208, 0.42894129205532949, 0.43032648134008261,
+  0.43171065802505726, 0.43309381885315196, 0.43447596056965565,
+  0.43585707992225547, 0.43723717366104409, 0.43861623853852766,
+  0.43999427130963326, 0.44137126873171667, 0.44274722756457002,
+  0.4441221445704292, 0.44549601651398174, 0.44686884016237416,
+  0.44824061228521989, 0.44961132965460654, 0.45098098904510386,
+  0.45234958723377089, 0.45371712100016387, 0.45508358712634384,
+  0.45644898239688392, 0.45781330359887717, 0.45917654752194409,
+  0.46053871095824001, 0.46189979070246273, 0.46325978355186015,
+  0.46461868630623782, 0.46597649576796618, 0.46733320874198842,
+  0.4686888220358279, 0.47004333245959562, 0.47139673682599764,
+  0.47274903195034279, 0.47410021465054997, 0.47545028174715587,
+  0.47679923006332209, 0.47814705642484301, 0.47949375766015301,
+  0.48083933060033396, 0.48218377207912272, 0.48352707893291874,
+  0.48486924800079106, 0.48621027612448642, 0.487550160148436,
+  0.48888889691976317, 0.49022648328829116, 0.4915629161065499,
+  0.49289819222978404, 0.49423230851595967, 0.49556526182577254,
+  0.49689704902265447, 0.49822766697278187, 0.49955711254508184,
+  0.50088538261124071, 0.50221247404571079, 0.50353838372571758,
+  0.50486310853126759, 0.50618664534515523, 0.50750899105297087,
+  0.50883014254310699, 0.51015009670676681, 0.5114688504379703,
+  0.51278640063356296, 0.51410274419322166, 0.51541787801946293,
+  0.51673179901764987, 0.51804450409599934, 0.51935599016558964,
+  0.52066625414036716, 0.52197529293715439, 0.52328310347565643,
+  0.52458968267846895, 0.52589502747108463, 0.52719913478190128,
+  0.52850200154222848, 0.52980362468629461, 0.531104001151255,
+  0.5324031278771979, 0.53370100180715296, 0.53499761988709715,
+  0.53629297906596318, 0.53758707629564539, 0.53887990853100842,
+  0.54017147272989285, 0.54146176585312344, 0.54275078486451589,
+  0.54403852673088382, 0.54532498842204646, 0.54661016691083486,
+  0.54789405917310019, 0.54917666218771966, 0.55045797293660481,
+  0.55173798840470734, 0.55301670558002747, 0.55429412145362,
+  0.55557023301960218, 0.5568450372751601, 0.5581185312205561,
+  0.55939071185913614, 0.56066157619733603, 0.56193112124468947,
+  0.56319934401383409, 0.5644662415205195, 0.56573181078361312,
+  0.56699604882510868, 0.56825895267013149, 0.56952051934694714,
+  0.57078074588696726, 0.57203962932475705, 0.5732971666980422,
+  0.57455335504771576, 0.57580819141784534, 0.57706167285567944,
+  0.57831379641165559, 0.57956455913940563, 0.58081395809576453,
+  0.58206199034077544, 0.58330865293769829, 0.58455394295301533,
+  0.58579785745643886, 0.58704039352091797, 0.58828154822264522,
+  0.58952131864106394, 0.59075970185887416, 0.59199669496204099,
+  0.5932322950397998, 0.59446649918466443, 0.59569930449243336,
+  0.5969307080621965, 0.59816070699634227, 0.59938929840056454,
+  0.60061647938386897, 0.60184224705858003, 0.60306659854034816,
+  0.60428953094815596, 0.60551104140432555, 0.60673112703452448,
+  0.60794978496777363, 0.60916701233645321, 0.61038280627630948,
+  0.61159716392646191, 0.61281008242940971, 0.61402155893103838,
+  0.61523159058062682, 0.61644017453085365, 0.61764730793780387,
+  0.61885298796097632, 0.6200572117632891, 0.62125997651108755,
+  0.62246127937414997, 0.62366111752569453, 0.62485948814238634,
+  0.62605638840434352, 0.62725181549514408, 0.62844576660183271,
+  0.62963823891492698, 0.63082922962842447, 0.63201873593980906,
+  0.63320675505005719, 0.63439328416364549, 0.63557832048855611,
+  0.6367618612362842, 0.63794390362184406, 0.63912444486377573,
+  0.64030348218415167, 0.64148101280858316, 0.64265703396622686,
+  0.64383154288979139, 0.64500453681554393, 0.64617601298331628,
+  0.64734596863651206, 0.64851440102211244, 0.64968130739068319,
+  0.65084668499638088, 0.6520105310969595, 0.65317284295377676,
+  0.65433361783180044, 0.65549285299961535, 0.65665054572942894,
+  0.65780669329707864, 0.65896129298203732, 0.66011434206742048,
+  0.66126583783999227, 0.66241577759017178, 0.66356415861203977,
+  0.66471097820334479, 0.66585623366550972, 0.66699992230363747,
+  0.66814204142651845, 0.66928258834663601, 0.67042156038017309,
+  0.67155895484701833, 0.67269476907077286, 0.67382900037875604,
+  0.67496164610201193, 0.67609270357531592, 0.67722217013718033,
+  0.67835004312986147, 0.67947631989936497, 0.68060099779545302,
+  0.68172407417164971, 0.68284554638524808, 0.6839654117973154,
+  0.68508366777270036, 0.68620031168003859, 0.68731534089175905,
+  0.68842875278409044, 0.68954054473706683, 0.6906507141345346,
+  0.69175925836415775, 0.69286617481742463, 0.693971460889654,
+  0.69507511398000088, 0.69617713149146299, 0.69727751083088652,
+  0.69837624940897292, 0.69947334464028377, 0.70056879394324834,
+  0.70166259474016845, 0.7027547444572253, 0.70384524052448494,
+  0.70493408037590488, 0.70602126144933974, 0.70710678118654746,
+  0.70819063703319529, 0.70927282643886558, 0.71035334685706231,
+  0.71143219574521643, 0.71250937056469232, 0.71358486878079352,
+  0.71465868786276898, 0.71573082528381859, 0.71680127852109954,
+  0.71787004505573171, 0.71893712237280438, 0.72000250796138165,
+  0.72106619931450811, 0.72212819392921535, 0.72318848930652735,
+  0.72424708295146689, 0.72530397237306066, 0.72635915508434601,
+  0.72741262860237577, 0.7284643904482252, 0.7295144381469969,
+  0.73056276922782759, 0.73160938122389252, 0.73265427167241282,
+  0.73369743811466026, 0.73473887809596339, 0.73577858916571348,
+  0.73681656887736979, 0.73785281478846598, 0.73888732446061511,
+  0.73992009545951609, 0.74095112535495911, 0.74198041172083096,
+  0.74300795213512172, 0.74403374417992918, 0.74505778544146595,
+  0.74608007351006378, 0.74710060598018013, 0.74811938045040349,
+  0.74913639452345926, 0.75015164580621496, 0.75116513190968637,
+  0.7521768504490427, 0.75318679904361241, 0.75419497531688917,
+  0.75520137689653655, 0.75620600141439454, 0.75720884650648446,
+  0.75820990981301528, 0.75920918897838796, 0.76020668165120242,
+  0.76120238548426178, 0.7621962981345789, 0.76318841726338127,
+  0.76417874053611667, 0.76516726562245896, 0.76615399019631281,
+  0.7671389119358204, 0.76812202852336531, 0.76910333764557959,
+  0.7700828369933479, 0.77106052426181371, 0.77203639715038441,
+  0.77301045336273699, 0.77398269060682279, 0.77495310659487382,
+  0.77592169904340758, 0.77688846567323244, 0.77785340420945304,
+  0.77881651238147587, 0.77977778792301444, 0.78073722857209438,
+  0.78169483207105939, 0.78265059616657573, 0.7836045186096382,
+  0.78455659715557524, 0.78550682956405393, 0.78645521359908577,
+  0.78740174702903132, 0.78834642762660623, 0.78928925316888565,
+  0.79023022143731003, 0.79116933021769009, 0.79210657730021239,
+  0.79304196047944364, 0.79397547755433717, 0.79490712632823701,
+  0.79583690460888346, 0.79676481020841872, 0.79769084094339104,
+  0.79861499463476082, 0.79953726910790501, 0.80045766219262271,
+  0.80137617172314013, 0.80229279553811572, 0.80320753148064483,
+  0.8041203773982657, 0.80503133114296366, 0.80594039057117628,
+  0.80684755354379922, 0.80775281792619036, 0.80865618158817498,
+  0.80955764240405126, 0.81045719825259477, 0.81135484701706373,
+  0.81225058658520388, 0.81314441484925359, 0.8140363297059483,
+  0.81492632905652662, 0.81581441080673378, 0.81670057286682785,
+  0.81758481315158371, 0.81846712958029866, 0.8193475200767969,
+  0.82022598256943469, 0.82110251499110465, 0.82197711527924155,
+  0.82284978137582632, 0.82372051122739132, 0.82458930278502529,
+  0.82545615400437744, 0.82632106284566342, 0.82718402727366902,
+  0.8280450452577558, 0.82890411477186487, 0.82976123379452305,
+  0.8306164003088462, 0.83146961230254524, 0.83232086776792968,
+  0.83317016470191319, 0.83401750110601813, 0.83486287498638001,
+  0.8357062843537526, 0.83654772722351189, 0.83738720161566194,
+  0.83822470555483797, 0.83906023707031263, 0.83989379419599941,
+  0.84072537497045807, 0.84155497743689833, 0.84238259964318596,
+  0.84320823964184544, 0.84403189549006641, 0.84485356524970701,
+  0.84567324698729907, 0.84649093877405202, 0.84730663868585832,
+  0.84812034480329712, 0.84893205521163961, 0.84974176800085244,
+  0.85054948126560337, 0.8513551931052652, 0.85215890162391983,
+  0.85296060493036363, 0.8537603011381113, 0.85455798836540053,
+  0.85535366473519603, 0.85614732837519447, 0.85693897741782865,
+  0.85772861000027212, 0.85851622426444274, 0.85930181835700836,
+  0.86008539042939014, 0.86086693863776731, 0.8616464611430813,
+  0.8624239561110405, 0.86319942171212416, 0.8639728561215867,
+  0.86474425751946238, 0.86551362409056898, 0.86628095402451299,
+  0.86704624551569265, 0.86780949676330321, 0.8685707059713409,
+  0.86932987134860673, 0.87008699110871135, 0.87084206347007886,
+  0.87159508665595109, 0.87234605889439154, 0.87309497841829009,
+  0.87384184346536675, 0.87458665227817611, 0.87532940310411078,
+  0.8760700941954066, 0.87680872380914576, 0.87754529020726124,
+  0.87827979165654146, 0.87901222642863341, 0.87974259280004741,
+  0.88047088905216075, 0.88119711347122198, 0.88192126434835494,
+  0.88264333997956279, 0.88336333866573158, 0.88408125871263499,
+  0.88479709843093779, 0.88551085613619995, 0.88622253014888064,
+  0.88693211879434208, 0.88763962040285393, 0.88834503330959624,
+  0.88904835585466457, 0.88974958638307289, 0.89044872324475788,
+  0.89114576479458318, 0.89184070939234272, 0.89253355540276469,
+  0.89322430119551532, 0.89391294514520325, 0.89459948563138258,
+  0.89528392103855758, 0.89596624975618511, 0.89664647017868015,
+  0.89732458070541832, 0.89800057974073988, 0.89867446569395382,
+  0.89934623697934146, 0.90001589201616028, 0.90068342922864686,
+  0.90134884704602203, 0.90201214390249307, 0.90267331823725883,
+  0.90333236849451182, 0.90398929312344334, 0.90464409057824624,
+  0.90529675931811882, 0.90594729780726846, 0.90659570451491533,
+  0.90724197791529593, 0.90788611648766615, 0.90852811871630612,
+  0.90916798309052227, 0.90980570810465222, 0.91044129225806714,
+  0.91107473405517625, 0.91170603200542988, 0.91233518462332275,
+  0.9129621904283981, 0.91358704794525081, 0.91420975570353069,
+  0.91483031223794609, 0.91544871608826783, 0.91606496579933161,
+  0.9166790599210427, 0.91729099700837791, 0.91790077562139039,
+  0.91850839432521225, 0.91911385169005777, 0.91971714629122736,
+  0.92031827670911048, 0.92091724152918952, 0.9215140393420419,
+  0.92210866874334507, 0.92270112833387852, 0.92329141671952764,
+  0.92387953251128674, 0.9244654743252626, 0.92504924078267758,
+  0.92563083050987272, 0.92621024213831127, 0.92678747430458175,
+  0.92736252565040111, 0.92793539482261789, 0.92850608047321548,
+  0.92907458125931575, 0.92964089584318133, 0.93020502289221907,
+  0.93076696107898371, 0.93132670908118043, 0.93188426558166815,
+  0.93243962926846236, 0.93299279883473885, 0.93354377297883617,
+  0.93409255040425887, 0.93463912981968078, 0.9351835099389475,
+  0.93572568948108037, 0.93626566717027826, 0.93680344173592156,
+  0.93733901191257496, 0.93787237643998989, 0.93840353406310806,
+  0.93893248353206449, 0.93945922360218992, 0.93998375303401394,
+  0.9405060705932683, 0.94102617505088926, 0.94154406518302081,
+  0.94205973977101731, 0.94257319760144687, 0.94308443746609349,
+  0.94359345816196039, 0.94410025849127266, 0.94460483726148026,
+  0.94510719328526061, 0.94560732538052128, 0.94610523237040334,
+  0.94660091308328353, 0.94709436635277722, 0.94758559101774109,
+  0.94807458592227623, 0.94856134991573027, 0.94904588185270056,
+  0.94952818059303667, 0.950008245001843, 0.9504860739494817,
+  0.95096166631157508, 0.95143502096900834, 0.95190613680793223,
+  0.95237501271976588, 0.95284164760119872, 0.95330604035419375,
+  0.95376818988599033, 0.95422809510910567, 0.95468575494133834,
+  0.95514116830577067, 0.95559433413077111, 0.95604525134999641,
+  0.95649391890239499, 0.95694033573220894, 0.95738450078897586,
+  0.95782641302753291, 0.95826607140801767, 0.9587034748958716,
+  0.95913862246184189, 0.95957151308198452, 0.96000214573766585,
+  0.96043051941556579, 0.96085663310767966, 0.96128048581132064,
+  0.96170207652912254, 0.96212140426904158, 0.96253846804435916,
+  0.96295326687368388, 0.96336579978095405, 0.96377606579543984,
+  0.96418406395174572, 0.96458979328981265, 0.96499325285492032,
+  0.9653944416976894, 0.96579335887408357, 0.96619000344541262,
+  0.96658437447833312, 0.96697647104485207, 0.96736629222232851,
+  0.96775383709347551, 0.96813910474636233, 0.96852209427441727,
+  0.96890280477642887, 0.96928123535654853, 0.96965738512429245,
+  0.97003125319454397, 0.9704028386875555, 0.97077214072895035,
+  0.97113915844972509, 0.97150389098625178, 0.9718663374802794,
+  0.97222649707893627, 0.97258436893473221, 0.97293995220556007,
+  0.97329324605469825, 0.97364424965081187, 0.97399296216795583,
+  0.97433938278557586, 0.97468351068851067, 0.97502534506699412,
+  0.97536488511665687, 0.97570213003852857, 0.97603707903903902,
+  0.97636973133002114, 0.97670008612871184, 0.97702814265775439,
+  0.97735390014519996, 0.97767735782450993, 0.97799851493455714,
+  0.97831737071962765, 0.9786339244294231, 0.9789481753190622,
+  0.97926012264908202, 0.97956976568544052, 0.97987710369951764,
+  0.98018213596811732, 0.98048486177346938, 0.98078528040323043,
+  0.98108339115048659, 0.98137919331375456, 0.98167268619698311,
+  0.98196386910955524, 0.98225274136628937, 0.98253930228744124,
+  0.98282355119870524, 0.98310548743121629, 0.98338511032155118,
+  0.98366241921173025, 0.98393741344921892, 0.98421009238692903,
+  0.98448045538322093, 0.98474850180190421, 0.98501423101223984,
+  0.98527764238894122, 0.98553873531217606, 0.98579750916756737,
+  0.98605396334619544, 0.98630809724459867, 0.98655991026477541,
+  0.98680940181418542, 0.98705657130575097, 0.98730141815785843,
+  0.98754394179435923, 0.98778414164457218, 0.98802201714328353,
+  0.98825756773074946, 0.98849079285269659, 0.98872169196032378,
+  0.98895026451030299, 0.98917650996478101, 0.98940042779138038,
+  0.98962201746320078, 0.98984127845882053, 0.99005821026229712,
+  0.99027281236316911, 0.99048508425645698, 0.99069502544266463,
+  0.99090263542778001, 0.99110791372327678, 0.99131085984611544,
+  0.9915114733187439, 0.99170975366909953, 0.99190570043060933,
+  0.9920993131421918, 0.99229059134825737, 0.99247953459870997,
+  0.99266614244894802, 0.9928504144598651, 0.99303235019785141,
+  0.9932119492347945, 0.99338921114808065, 0.9935641355205953,
+  0.9937367219407246, 0.99390697000235606, 0.99407487930487937,
+  0.9942404494531879, 0.9944036800576791, 0.99456457073425542,
+  0.9947231211043257, 0.99487933079480562, 0.99503319943811863,
+  0.99518472667219682, 0.99533391214048228, 0.99548075549192694,
+  0.99562525638099431, 0.99576741446765982, 0.99590722941741172,
+  0.99604470090125197, 0.99617982859569687, 0.996312612182778,
+  0.99644305135004263, 0.99657114579055484, 0.99669689520289606,
+  0.99682029929116567, 0.99694135776498216, 0.99706007033948296,
+  0.99717643673532619, 0.99729045667869021, 0.9974021299012753,
+  0.99751145614030345, 0.99761843513851955, 0.99772306664419164,
+  0.99782535041111164, 0.997925286198596, 0.99802287377148624,
+  0.99811811290014918, 0.99821100336047819, 0.99830154493389289,
+  0.99838973740734016, 0.99847558057329477, 0.99855907422975931,
+  0.99864021818026527, 0.99871901223387294, 0.99879545620517241,
+  0.99886954991428356, 0.99894129318685687, 0.99901068585407338,
+  0.99907772775264536, 0.99914241872481691, 0.99920475861836389,
+  0.99926474728659442, 0.99932238458834954, 0.99937767038800285,
+  0.99943060455546173, 0.99948118696616695, 0.99952941750109314,
+  0.99957529604674922, 0.99961882249517864, 0.99965999674395922,
+  0.99969881869620425, 0.99973528826056168, 0.99976940535121528,
+  0.99980116988788426, 0.9998305817958234, 0.99985764100582386,
+  0.99988234745421256, 0.9999047010828529, 0.9999247018391445,
+  0.99994234967602391, 0.9999576445519639, 0.99997058643097414,
+  0.99998117528260111, 0.9999894110819284, 0.99999529380957619,
+  0.99999882345170188, 1, 0.99999882345170188,
+  0.99999529380957619, 0.9999894110819284, 0.99998117528260111,
+  0.99997058643097414, 0.9999576445519639, 0.99994234967602391,
+  0.9999247018391445, 0.9999047010828529, 0.99988234745421256,
+  0.99985764100582386, 0.9998305817958234, 0.99980116988788426,
+  0.99976940535121528, 0.99973528826056168, 0.99969881869620425,
+  0.99965999674395922, 0.99961882249517864, 0.99957529604674922,
+  0.99952941750109314, 0.99948118696616695, 0.99943060455546173,
+  0.99937767038800285, 0.99932238458834954, 0.99926474728659442,
+  0.99920475861836389, 0.99914241872481691, 0.99907772775264536,
+  0.99901068585407338, 0.99894129318685687, 0.99886954991428356,
+  0.99879545620517241, 0.99871901223387294, 0.99864021818026527,
+  0.99855907422975931, 0.99847558057329477, 0.99838973740734016,
+  0.99830154493389289, 0.99821100336047819, 0.99811811290014918,
+  0.99802287377148624, 0.997925286198596, 0.99782535041111164,
+  0.99772306664419164, 0.99761843513851955, 0.99751145614030345,
+  0.9974021299012753, 0.99729045667869021, 0.99717643673532619,
+  0.99706007033948296, 0.99694135776498216, 0.99682029929116567,
+  0.99669689520289606, 0.99657114579055484, 0.99644305135004263,
+  0.996312612182778, 0.99617982859569698, 0.99604470090125197,
+  0.99590722941741172, 0.99576741446765982, 0.99562525638099431,
+  0.99548075549192694, 0.99533391214048228, 0.99518472667219693,
+  0.99503319943811863, 0.99487933079480562, 0.9947231211043257,
+  0.99456457073425542, 0.9944036800576791, 0.9942404494531879,
+  0.99407487930487937, 0.99390697000235606, 0.9937367219407246,
+  0.9935641355205953, 0.99338921114808065, 0.9932119492347945,
+  0.99303235019785141, 0.9928504144598651, 0.99266614244894802,
+  0.99247953459870997, 0.99229059134825737, 0.9920993131421918,
+  0.99190570043060933, 0.99170975366909953, 0.9915114733187439,
+  0.99131085984611544, 0.99110791372327689, 0.99090263542778001,
+  0.99069502544266463, 0.99048508425645709, 0.99027281236316911,
+  0.99005821026229712, 0.98984127845882053, 0.98962201746320089,
+  0.98940042779138038, 0.98917650996478101, 0.98895026451030299,
+  0.98872169196032378, 0.98849079285269659, 0.98825756773074946,
+  0.98802201714328353, 0.98778414164457218, 0.98754394179435923,
+  0.98730141815785843, 0.98705657130575097, 0.98680940181418553,
+  0.98655991026477541, 0.98630809724459867, 0.98605396334619544,
+  0.98579750916756748, 0.98553873531217606, 0.98527764238894122,
+  0.98501423101223984, 0.98474850180190421, 0.98448045538322093,
+  0.98421009238692903, 0.98393741344921892, 0.98366241921173025,
+  0.98338511032155118, 0.98310548743121629, 0.98282355119870524,
+  0.98253930228744124, 0.98225274136628937, 0.98196386910955524,
+  0.98167268619698311, 0.98137919331375456, 0.98108339115048671,
+  0.98078528040323043, 0.98048486177346938, 0.98018213596811743,
+  0.97987710369951764, 0.97956976568544052, 0.97926012264908202,
+  0.9789481753190622, 0.97863392442942321, 0.97831737071962765,
+  0.97799851493455714, 0.97767735782450993, 0.97735390014519996,
+  0.97702814265775439, 0.97670008612871184, 0.97636973133002114,
+  0.97603707903903902, 0.97570213003852857, 0.97536488511665698,
+  0.97502534506699412, 0.97468351068851067, 0.97433938278557586,
+  0.97399296216795583, 0.97364424965081198, 0.97329324605469825,
+  0.97293995220556018, 0.97258436893473221, 0.97222649707893627,
+  0.9718663374802794, 0.97150389098625178, 0.97113915844972509,
+  0.97077214072895035, 0.9704028386875555, 0.97003125319454397,
+  0.96965738512429245, 0.96928123535654853, 0.96890280477642887,
+  0.96852209427441738, 0.96813910474636244, 0.96775383709347551,
+  0.96736629222232851, 0.96697647104485207, 0.96658437447833312,
+  0.9661900034454125, 0.96579335887408368, 0.9653944416976894,
+  0.96499325285492032, 0.96458979328981276, 0.96418406395174583,
+  0.96377606579543984, 0.96336579978095405, 0.96295326687368388,
+  0.96253846804435916, 0.96212140426904158, 0.96170207652912254,
+  0.96128048581132064, 0.96085663310767966, 0.96043051941556579,
+  0.96000214573766596, 0.95957151308198452, 0.95913862246184189,
+  0.9587034748958716, 0.95826607140801767, 0.95782641302753291,
+  0.95738450078897586, 0.95694033573220882, 0.9564939189023951,
+  0.95604525134999641, 0.95559433413077111, 0.95514116830577078,
+  0.95468575494133834, 0.95422809510910567, 0.95376818988599033,
+  0.95330604035419386, 0.95284164760119872, 0.95237501271976588,
+  0.95190613680793235, 0.95143502096900834, 0.95096166631157508,
+  0.9504860739494817, 0.950008245001843, 0.94952818059303667,
+  0.94904588185270056, 0.94856134991573027, 0.94807458592227623,
+  0.94758559101774109, 0.94709436635277722, 0.94660091308328353,
+  0.94610523237040345, 0.94560732538052128, 0.94510719328526061,
+  0.94460483726148026, 0.94410025849127266, 0.94359345816196039,
+  0.94308443746609349, 0.94257319760144687, 0.94205973977101731,
+  0.94154406518302081, 0.94102617505088926, 0.9405060705932683,
+  0.93998375303401405, 0.93945922360218992, 0.9389324835320646,
+  0.93840353406310806, 0.93787237643998989, 0.93733901191257496,
+  0.93680344173592156, 0.93626566717027826, 0.93572568948108037,
+  0.93518350993894761, 0.93463912981968078, 0.93409255040425898,
+  0.93354377297883617, 0.93299279883473896, 0.93243962926846236,
+  0.93188426558166815, 0.93132670908118043, 0.93076696107898371,
+  0.93020502289221907, 0.92964089584318133, 0.92907458125931586,
+  0.92850608047321559, 0.92793539482261789, 0.92736252565040111,
+  0.92678747430458175, 0.92621024213831138, 0.92563083050987272,
+  0.92504924078267758, 0.9244654743252626, 0.92387953251128674,
+  0.92329141671952764, 0.92270112833387863, 0.92210866874334518,
+  0.92151403934204201, 0.92091724152918952, 0.92031827670911059,
+  0.91971714629122736, 0.91911385169005777, 0.91850839432521225,
+  0.9179007756213905, 0.91729099700837791, 0.9166790599210427,
+  0.91606496579933172, 0.91544871608826783, 0.9148303122379462,
+  0.91420975570353069, 0.91358704794525081, 0.91296219042839821,
+  0.91233518462332275, 0.91170603200542988, 0.91107473405517636,
+  0.91044129225806725, 0.90980570810465222, 0.90916798309052238,
+  0.90852811871630612, 0.90788611648766626, 0.90724197791529582,
+  0.90659570451491533, 0.90594729780726846, 0.90529675931811882,
+  0.90464409057824624, 0.90398929312344334, 0.90333236849451182,
+  0.90267331823725883, 0.90201214390249318, 0.90134884704602203,
+  0.90068342922864697, 0.90001589201616028, 0.89934623697934157,
+  0.89867446569395382, 0.89800057974073988, 0.89732458070541832,
+  0.89664647017868015, 0.89596624975618522, 0.89528392103855758,
+  0.8945994856313827, 0.89391294514520325, 0.89322430119551532,
+  0.89253355540276458, 0.89184070939234272, 0.89114576479458318,
+  0.89044872324475788, 0.88974958638307278, 0.88904835585466457,
+  0.88834503330959635, 0.88763962040285393, 0.88693211879434219,
+  0.88622253014888064, 0.88551085613619995, 0.88479709843093779,
+  0.88408125871263499, 0.88336333866573158, 0.88264333997956279,
+  0.88192126434835505, 0.88119711347122209, 0.88047088905216075,
+  0.87974259280004741, 0.87901222642863353, 0.87827979165654158,
+  0.87754529020726135, 0.87680872380914565, 0.8760700941954066,
+  0.87532940310411089, 0.87458665227817611, 0.87384184346536686,
+  0.87309497841829009, 0.87234605889439154, 0.87159508665595098,
+  0.87084206347007898, 0.87008699110871146, 0.86932987134860684,
+  0.8685707059713409, 0.86780949676330332, 0.86704624551569265,
+  0.86628095402451299, 0.86551362409056909, 0.86474425751946238,
+  0.86397285612158681, 0.86319942171212416, 0.86242395611104061,
+  0.8616464611430813, 0.86086693863776731, 0.86008539042939014,
+  0.85930181835700847, 0.85851622426444274, 0.85772861000027212,
+  0.85693897741782876, 0.85614732837519447, 0.85535366473519603,
+  0.85455798836540053, 0.85376030113811141, 0.85296060493036363,
+  0.85215890162391983, 0.8513551931052652, 0.85054948126560348,
+  0.84974176800085255, 0.84893205521163961, 0.84812034480329723,
+  0.84730663868585832, 0.84649093877405213, 0.84567324698729907,
+  0.84485356524970712, 0.84403189549006641, 0.84320823964184544,
+  0.84238259964318585, 0.84155497743689844, 0.84072537497045807,
+  0.83989379419599952, 0.83906023707031274, 0.83822470555483808,
+  0.83738720161566194, 0.83654772722351201, 0.8357062843537526,
+  0.83486287498638001, 0.83401750110601813, 0.83317016470191319,
+  0.83232086776792968, 0.83146961230254524, 0.83061640030884631,
+  0.82976123379452305, 0.82890411477186487, 0.8280450452577558,
+  0.82718402727366913, 0.82632106284566353, 0.82545615400437755,
+  0.82458930278502529, 0.82372051122739143, 0.82284978137582643,
+  0.82197711527924155, 0.82110251499110465, 0.82022598256943469,
+  0.8193475200767969, 0.81846712958029866, 0.81758481315158371,
+  0.81670057286682785, 0.81581441080673378, 0.81492632905652662,
+  0.81403632970594841, 0.81314441484925359, 0.81225058658520388,
+  0.81135484701706373, 0.81045719825259477, 0.80955764240405126,
+  0.80865618158817498, 0.80775281792619036, 0.80684755354379933,
+  0.80594039057117628, 0.80503133114296366, 0.80412037739826581,
+  0.80320753148064494, 0.80229279553811572, 0.80137617172314024,
+  0.80045766219262282, 0.79953726910790501, 0.79861499463476082,
+  0.79769084094339116, 0.79676481020841883, 0.79583690460888357,
+  0.79490712632823701, 0.79397547755433717, 0.79304196047944364,
+  0.79210657730021239, 0.7911693302176902, 0.79023022143731003,
+  0.78928925316888565, 0.78834642762660634, 0.78740174702903143,
+  0.78645521359908577, 0.78550682956405393, 0.78455659715557524,
+  0.7836045186096382, 0.78265059616657573, 0.78169483207105939,
+  0.78073722857209449, 0.77977778792301455, 0.77881651238147598,
+  0.77785340420945315, 0.77688846567323244, 0.77592169904340769,
+  0.77495310659487393, 0.7739826906068229, 0.77301045336273699,
+  0.77203639715038452, 0.77106052426181382, 0.7700828369933479,
+  0.7691033376455797, 0.76812202852336542, 0.7671389119358204,
+  0.76615399019631292, 0.76516726562245896, 0.76417874053611667,
+  0.76318841726338127, 0.7621962981345789, 0.76120238548426178,
+  0.76020668165120242, 0.75920918897838807, 0.75820990981301528,
+  0.75720884650648457, 0.75620600141439454, 0.75520137689653655,
+  0.75419497531688917, 0.75318679904361252, 0.75217685044904281,
+  0.75116513190968648, 0.75015164580621507, 0.74913639452345937,
+  0.7481193804504036, 0.74710060598018013, 0.74608007351006378,
+  0.74505778544146606, 0.74403374417992929, 0.74300795213512172,
+  0.74198041172083107, 0.74095112535495911, 0.7399200954595162,
+  0.73888732446061511, 0.73785281478846598, 0.7368165688773699,
+  0.73577858916571359, 0.7347388780959635, 0.73369743811466037,
+  0.73265427167241282, 0.73160938122389263, 0.73056276922782759,
+  0.72951443814699701, 0.7284643904482252, 0.72741262860237577,
+  0.72635915508434601, 0.72530397237306077, 0.724247082951467,
+  0.72318848930652746, 0.72212819392921535, 0.72106619931450811,
+  0.72000250796138165, 0.71893712237280449, 0.71787004505573171,
+  0.71680127852109954, 0.71573082528381859, 0.71465868786276909,
+  0.71358486878079364, 0.71250937056469232, 0.71143219574521643,
+  0.71035334685706242, 0.70927282643886569, 0.7081906370331954,
+  0.70710678118654757, 0.70602126144933974, 0.70493408037590499,
+  0.70384524052448494, 0.7027547444572253, 0.70166259474016857,
+  0.70056879394324845, 0.69947334464028377, 0.69837624940897292,
+  0.69727751083088663, 0.69617713149146299, 0.69507511398000088,
+  0.693971460889654, 0.69286617481742474, 0.69175925836415775,
+  0.69065071413453472, 0.68954054473706694, 0.68842875278409055,
+  0.68731534089175916, 0.6862003116800387, 0.68508366777270036,
+  0.68396541179731551, 0.68284554638524808, 0.68172407417164982,
+  0.68060099779545313, 0.67947631989936508, 0.67835004312986158,
+  0.67722217013718045, 0.67609270357531603, 0.67496164610201204,
+  0.67382900037875615, 0.67269476907077297, 0.67155895484701833,
+  0.67042156038017309, 0.66928258834663601, 0.66814204142651856,
+  0.66699992230363747, 0.66585623366550972, 0.6647109782033449,
+  0.66356415861203988, 0.66241577759017178, 0.66126583783999227,
+  0.66011434206742048, 0.65896129298203732, 0.65780669329707864,
+  0.65665054572942905, 0.65549285299961546, 0.65433361783180055,
+  0.65317284295377676, 0.6520105310969595, 0.65084668499638099,
+  0.64968130739068319, 0.64851440102211255, 0.64734596863651206,
+  0.64617601298331639, 0.64500453681554404, 0.6438315428897915,
+  0.64265703396622686, 0.64148101280858316, 0.64030348218415167,
+  0.63912444486377573, 0.63794390362184417, 0.6367618612362842,
+  0.63557832048855623, 0.63439328416364549, 0.63320675505005719,
+  0.63201873593980906, 0.63082922962842447, 0.6296382389149271,
+  0.62844576660183271, 0.62725181549514419, 0.62605638840434352,
+  0.62485948814238645, 0.62366111752569464, 0.62246127937415008,
+  0.62125997651108766, 0.62005721176328921, 0.61885298796097632,
+  0.61764730793780398, 0.61644017453085365, 0.61523159058062682,
+  0.61402155893103849, 0.61281008242940971, 0.61159716392646202,
+  0.61038280627630948, 0.60916701233645321, 0.60794978496777374,
+  0.60673112703452448, 0.60551104140432555, 0.60428953094815607,
+  0.60306659854034828, 0.60184224705858003, 0.60061647938386897,
+  0.59938929840056454, 0.59816070699634238, 0.5969307080621965,
+  0.59569930449243347, 0.59446649918466454, 0.5932322950397998,
+  0.59199669496204099, 0.59075970185887428, 0.58952131864106394,
+  0.58828154822264533, 0.58704039352091808, 0.58579785745643886,
+  0.58455394295301533, 0.58330865293769829, 0.58206199034077555,
+  0.58081395809576453, 0.57956455913940574, 0.57831379641165559,
+  0.57706167285567955, 0.57580819141784534, 0.57455335504771576,
+  0.57329716669804232, 0.57203962932475705, 0.57078074588696737,
+  0.56952051934694725, 0.56825895267013149, 0.56699604882510868,
+  0.56573181078361323, 0.5644662415205195, 0.56319934401383409,
+  0.56193112124468947, 0.56066157619733603, 0.55939071185913614,
+  0.5581185312205561, 0.5568450372751601, 0.55557023301960229,
+  0.55429412145362011, 0.55301670558002758, 0.55173798840470745,
+  0.55045797293660481, 0.54917666218771977, 0.54789405917310019,
+  0.54661016691083486, 0.54532498842204646, 0.54403852673088393,
+  0.542750784864516, 0.54146176585312356, 0.54017147272989297,
+  0.53887990853100842, 0.53758707629564551, 0.53629297906596318,
+  0.53499761988709726, 0.53370100180715296, 0.53240312787719801,
+  0.531104001151255, 0.52980362468629483, 0.52850200154222848,
+  0.52719913478190139, 0.52589502747108474, 0.52458968267846884,
+  0.52328310347565643, 0.52197529293715439, 0.52066625414036727,
+  0.51935599016558953, 0.51804450409599934, 0.51673179901764998,
+  0.51541787801946315, 0.51410274419322166, 0.51278640063356307,
+  0.51146885043797052, 0.5101500967067667, 0.50883014254310699,
+  0.50750899105297087, 0.50618664534515545, 0.50486310853126748,
+  0.50353838372571758, 0.5022124740457109, 0.50088538261124094,
+  0.49955711254508189, 0.49822766697278187, 0.49689704902265464,
+  0.49556526182577249, 0.49423230851595973, 0.49289819222978409,
+  0.49156291610655006, 0.4902264832882911, 0.48888889691976323,
+  0.48755016014843605, 0.48621027612448653, 0.48486924800079112,
+  0.48352707893291874, 0.48218377207912283, 0.4808393306003339,
+  0.47949375766015301, 0.47814705642484312, 0.47679923006332225,
+  0.47545028174715587, 0.47410021465055002, 0.4727490319503429,
+  0.47139673682599781, 0.47004333245959562, 0.46868882203582796,
+  0.46733320874198853, 0.46597649576796613, 0.46461868630623782,
+  0.46325978355186026, 0.46189979070246284, 0.46053871095824001,
+  0.45917654752194415, 0.45781330359887729, 0.45644898239688386,
+  0.45508358712634384, 0.45371712100016393, 0.452349587233771,
+  0.45098098904510381, 0.4496113296546066, 0.44824061228522,
+  0.44686884016237433, 0.44549601651398174, 0.44412214457042926,
+  0.44274722756457013, 0.44137126873171662, 0.43999427130963326,
+  0.43861623853852771, 0.4372371736610442, 0.43585707992225547,
+  0.43447596056965571, 0.43309381885315201, 0.43171065802505737,
+  0.43032648134008261, 0.42894129205532955, 0.4275550934302822,
+  0.42616788872679962, 0.42477968120910881, 0.4233904741437961,
+  0.42200027079979979, 0.42060907444840251, 0.41921688836322396,
+  0.41782371582021238, 0.41642956009763732, 0.41503442447608163,
+  0.41363831223843456, 0.412241226669883, 0.41084317105790391,
+  0.40944414869225759, 0.40804416286497874, 0.40664321687036914,
+  0.40524131400498986, 0.40383845756765413, 0.40243465085941854,
+  0.40102989718357579, 0.39962419984564679, 0.39821756215337362,
+  0.39680998741671042, 0.3954014789478163, 0.3939920400610481,
+  0.39258167407295153, 0.39117038430225398, 0.38975817406985641,
+  0.3883450466988263, 0.38693100551438869, 0.38551605384391902,
+  0.38410019501693504, 0.38268343236508984, 0.38126576922216249,
+  0.37984720892405111, 0.37842775480876562, 0.37700741021641831,
+  0.37558617848921733, 0.37416406297145799, 0.37274106700951581,
+  0.3713171939518376, 0.36989244714893427, 0.36846682995337232,
+  0.36704034571976724, 0.36561299780477396, 0.36418478956707984,
+  0.36275572436739723, 0.36132580556845434, 0.35989503653498828,
+  0.35846342063373654, 0.35703096123343003, 0.35559766170478396,
+  0.35416352542049051, 0.35272855575521073, 0.35129275608556715,
+  0.34985612979013503, 0.34841868024943451, 0.34698041084592368,
+  0.34554132496398915, 0.34410142598993898, 0.34266071731199438,
+  0.34121920232028241, 0.33977688440682696, 0.33833376696554129,
+  0.33688985339222005, 0.33544514708453166, 0.33399965144200949,
+  0.33255336986604422, 0.33110630575987643, 0.32965846252858755,
+  0.32820984357909266, 0.32676045232013179, 0.32531029216226298,
+  0.32385936651785296, 0.32240767880107002, 0.32095523242787521,
+  0.31950203081601575, 0.31804807738501506, 0.31659337555616585,
+  0.31513792875252244, 0.31368174039889157, 0.31222481392182505,
+  0.31076715274961147, 0.30930876031226878, 0.30784964004153498,
+  0.30638979537086108, 0.30492922973540243, 0.30346794657201137,
+  0.3020059493192282, 0.3005432414172734, 0.29907982630804048,
+  0.29761570743508631, 0.29615088824362396, 0.29468537218051433,
+  0.29321916269425868, 0.29175226323498937, 0.29028467725446233,
+  0.28881640820604948, 0.28734745954472957, 0.28587783472708073,
+  0.28440753721127182, 0.28293657045705539, 0.28146493792575805,
+  0.27999264308027338, 0.27851968938505306, 0.27704608030609995,
+  0.27557181931095825, 0.27409690986870633, 0.27262135544994898,
+  0.27114515952680807, 0.2696683255729152, 0.26819085706340318,
+  0.26671275747489842, 0.2652340302855119, 0.26375467897483151,
+  0.26227470702391359, 0.26079411791527557, 0.25931291513288635,
+  0.25783110216215893, 0.25634868248994291, 0.25486565960451463,
+  0.25338203699557027, 0.25189781815421691, 0.25041300657296528,
+  0.24892760574572026, 0.24744161916777344, 0.24595505033579459,
+  0.24446790274782421, 0.24298017990326398, 0.2414918853028693,
+  0.2400030224487415, 0.2385135948443185, 0.23702360599436734,
+  0.23553305940497546, 0.23404195858354346, 0.23255030703877533,
+  0.23105810828067128, 0.22956536582051887, 0.22807208317088579,
+  0.22657826384561011, 0.22508391135979278, 0.22358902922979002,
+  0.22209362097320359, 0.22059769010887365, 0.21910124015686977,
+  0.21760427463848367, 0.2161067970762196, 0.21460881099378692,
+  0.21311031991609136, 0.21161132736922761, 0.21011183688046972,
+  0.20861185197826346, 0.20711137619221856, 0.20561041305309932,
+  0.20410896609281701, 0.20260703884442111, 0.20110463484209196,
+  0.19960175762113105, 0.19809841071795373, 0.19659459767008022,
+  0.19509032201612833, 0.19358558729580375, 0.19208039704989238,
+  0.1905747548202528, 0.18906866414980628, 0.18756212858252974,
+  0.18605515166344663, 0.18454773693861964, 0.18303988795514106,
+  0.18153160826112513, 0.18002290140569951, 0.17851377093899759,
+  0.17700422041214886, 0.17549425337727137, 0.17398387338746385,
+  0.17247308399679603, 0.17096188876030136, 0.16945029123396793,
+  0.16793829497473123, 0.16642590354046422, 0.16491312048997009,
+  0.16339994938297323, 0.16188639378011188, 0.1603724572429284,
+  0.15885814333386139, 0.15734345561623828, 0.15582839765426532,
+  0.15431297301302024, 0.15279718525844341, 0.15128103795733025,
+  0.14976453467732162, 0.1482476789868962, 0.14673047445536175,
+  0.14521292465284752, 0.14369503315029458, 0.142176803519448,
+  0.14065823933284924, 0.13913934416382628, 0.13762012158648618,
+  0.1361005751757062, 0.13458070850712622, 0.13306052515713918,
+  0.13154002870288328, 0.13001922272223335, 0.12849811079379322,
+  0.12697669649688598, 0.12545498341154621, 0.1239329751185122,
+  0.12241067519921628, 0.12088808723577722, 0.11936521481099135,
+  0.11784206150832502, 0.11631863091190488, 0.11479492660651025,
+  0.11327095217756436, 0.11174671121112666, 0.11022220729388318,
+  0.10869744401313867, 0.10717242495680887, 0.1056471537134107,
+  0.10412163387205473, 0.10259586902243628, 0.10106986275482788,
+  0.099543618660069444, 0.09801714032956077, 0.096490431355252607,
+  0.094963495329639061, 0.093436335845747912, 0.091908956497132696,
+  0.090381360877865011, 0.088853552582524684, 0.087325535206192226,
+  0.08579731234443988, 0.084268887593324127, 0.082740264549375803,
+  0.081211446809592386, 0.079682437971430126, 0.078153241632794315,
+  0.076623861392031617, 0.075094300847921291, 0.073564563599667454,
+  0.072034653246889416, 0.070504573389614009, 0.068974327628266732,
+  0.067443919563664106, 0.06591335279700393, 0.06438263092985741,
+  0.06285175756416142, 0.061320736302208648, 0.059789570746640007,
+  0.058258264500435732, 0.056726821166907783, 0.055195244349690031,
+  0.053663537652730679, 0.052131704680283317, 0.050599749036899337,
+  0.049067674327418126, 0.047535484156959261, 0.046003182130914644,
+  0.044470771854938744, 0.042938256934940959, 0.041405640977076712,
+  0.039872927587739845, 0.038340120373552791, 0.036807222941358991,
+  0.035274238898213947, 0.033741171851377642, 0.032208025408304704,
+  0.030674803176636581, 0.02914150876419374, 0.02760814577896582,
+  0.02607471782910404, 0.024541228522912264, 0.02300768146883941,
+  0.021474080275469605, 0.019940428551514598, 0.01840672990580482,
+  0.016872987947281773, 0.01533920628498822, 0.013805388528060349,
+  0.012271538285719944, 0.010737659167264572, 0.0092037547820599599,
+  0.0076698287395310771, 0.0061358846491545152, 0.004601926120448672,
+  0.0030679567629661379, 0.0015339801862847662, 0,
+  -0.0015339801862847655, -0.0030679567629659761, -0.0046019261204485705,
+  -0.0061358846491544753, -0.007669828739531097, -0.0092037547820598194,
+  -0.010737659167264491, -0.012271538285719925, -0.013805388528060391,
+  -0.0153392062849881, -0.01687298794728171, -0.01840672990580482,
+  -0.019940428551514441, -0.021474080275469508, -0.023007681468839369,
+  -0.024541228522912288, -0.026074717829103901, -0.02760814577896574,
+  -0.029141508764193722, -0.030674803176636626, -0.032208025408304586,
+  -0.03374117185137758, -0.035274238898213947, -0.036807222941358832,
+  -0.038340120373552694, -0.039872927587739811, -0.041405640977076739,
+  -0.04293825693494082, -0.044470771854938668, -0.046003182130914623,
+  -0.047535484156959303, -0.049067674327418015, -0.050599749036899282,
+  -0.052131704680283324, -0.05366353765273052, -0.055195244349689934,
+  -0.056726821166907748, -0.058258264500435752, -0.059789570746639868,
+  -0.061320736302208578, -0.062851757564161406, -0.064382630929857465,
+  -0.065913352797003805, -0.067443919563664051, -0.068974327628266746,
+  -0.070504573389613856, -0.072034653246889332, -0.073564563599667426,
+  -0.075094300847921305, -0.076623861392031492, -0.078153241632794232,
+  -0.079682437971430126, -0.081211446809592441, -0.082740264549375692,
+  -0.084268887593324071, -0.085797312344439894, -0.087325535206192059,
+  -0.0888535525825246, -0.090381360877864983, -0.091908956497132724,
+  -0.093436335845747787, -0.094963495329638992, -0.096490431355252593,
+  -0.098017140329560604, -0.099543618660069319, -0.10106986275482782,
+  -0.10259586902243628, -0.10412163387205459, -0.10564715371341062,
+  -0.10717242495680884, -0.10869744401313872, -0.11022220729388306,
+  -0.11174671121112659, -0.11327095217756435, -0.11479492660651008,
+  -0.11631863091190475, -0.11784206150832498, -0.11936521481099135,
+  -0.12088808723577708, -0.1224106751992162, -0.12393297511851216,
+  -0.12545498341154623, -0.12697669649688587, -0.12849811079379317,
+  -0.13001922272223335, -0.13154002870288312, -0.13306052515713906,
+  -0.13458070850712617, -0.1361005751757062, -0.13762012158648604,
+  -0.1391393441638262, -0.14065823933284921, -0.14217680351944803,
+  -0.14369503315029447, -0.14521292465284746, -0.14673047445536175,
+  -0.14824767898689603, -0.14976453467732151, -0.15128103795733022,
+  -0.15279718525844344, -0.1543129730130201, -0.15582839765426523,
+  -0.15734345561623825, -0.15885814333386145, -0.16037245724292828,
+  -0.16188639378011183, -0.16339994938297323, -0.16491312048996992,
+  -0.1664259035404641, -0.16793829497473117, -0.16945029123396796,
+  -0.17096188876030122, -0.17247308399679595, -0.17398387338746382,
+  -0.17549425337727143, -0.17700422041214875, -0.17851377093899751,
+  -0.18002290140569951, -0.18153160826112497, -0.18303988795514095,
+  -0.18454773693861962, -0.18605515166344663, -0.1875621285825296,
+  -0.18906866414980619, -0.19057475482025274, -0.19208039704989244,
+  -0.19358558729580361, -0.19509032201612825, -0.19659459767008022,
+  -0.19809841071795356, -0.19960175762113097, -0.2011046348420919,
+  -0.20260703884442113, -0.20410896609281687, -0.20561041305309924,
+  -0.20711137619221856, -0.20861185197826349, -0.21011183688046961,
+  -0.21161132736922755, -0.21311031991609136, -0.21460881099378676,
+  -0.21610679707621952, -0.21760427463848364, -0.2191012401568698,
+  -0.22059769010887351, -0.22209362097320351, -0.22358902922978999,
+  -0.22508391135979283, -0.22657826384561, -0.22807208317088573,
+  -0.22956536582051887, -0.23105810828067111, -0.23255030703877524,
+  -0.23404195858354343, -0.23553305940497549, -0.2370236059943672,
+  -0.23851359484431842, -0.2400030224487415, -0.24149188530286933,
+  -0.24298017990326387, -0.24446790274782415, -0.24595505033579459,
+  -0.24744161916777327, -0.24892760574572015, -0.25041300657296522,
+  -0.25189781815421697, -0.25338203699557016, -0.25486565960451457,
+  -0.25634868248994291, -0.25783110216215899, -0.25931291513288623,
+  -0.26079411791527551, -0.26227470702391359, -0.26375467897483135,
+  -0.26523403028551179, -0.26671275747489837, -0.26819085706340318,
+  -0.26966832557291509, -0.27114515952680801, -0.27262135544994898,
+  -0.27409690986870638, -0.27557181931095814, -0.2770460803060999,
+  -0.27851968938505306, -0.27999264308027322, -0.28146493792575794,
+  -0.28293657045705539, -0.28440753721127188, -0.28587783472708062,
+  -0.28734745954472951, -0.28881640820604948, -0.29028467725446233,
+  -0.29175226323498926, -0.29321916269425863, -0.29468537218051433,
+  -0.29615088824362379, -0.2976157074350862, -0.29907982630804048,
+  -0.30054324141727345, -0.30200594931922808, -0.30346794657201132,
+  -0.30492922973540237, -0.30638979537086092, -0.30784964004153487,
+  -0.30930876031226873, -0.31076715274961147, -0.31222481392182488,
+  -0.31368174039889152, -0.31513792875252244, -0.31659337555616585,
+  -0.31804807738501495, -0.31950203081601569, -0.32095523242787521,
+  -0.32240767880106985, -0.32385936651785285, -0.32531029216226293,
+  -0.32676045232013173, -0.3282098435790925, -0.32965846252858749,
+  -0.33110630575987643, -0.33255336986604422, -0.33399965144200938,
+  -0.3354451470845316, -0.33688985339222005, -0.33833376696554113,
+  -0.33977688440682685, -0.34121920232028236, -0.34266071731199438,
+  -0.34410142598993881, -0.34554132496398909, -0.34698041084592368,
+  -0.34841868024943456, -0.34985612979013492, -0.35129275608556709,
+  -0.35272855575521073, -0.35416352542049034, -0.35559766170478385,
+  -0.35703096123342998, -0.35846342063373654, -0.35989503653498811,
+  -0.36132580556845428, -0.36275572436739723, -0.36418478956707989,
+  -0.36561299780477385, -0.36704034571976718, -0.36846682995337232,
+  -0.3698924471489341, -0.37131719395183754, -0.37274106700951576,
+  -0.37416406297145793, -0.37558617848921722, -0.37700741021641826,
+  -0.37842775480876556, -0.37984720892405116, -0.38126576922216238,
+  -0.38268343236508978, -0.38410019501693504, -0.38551605384391885,
+  -0.38693100551438858, -0.38834504669882625, -0.38975817406985641,
+  -0.39117038430225387, -0.39258167407295147, -0.3939920400610481,
+  -0.39540147894781635, -0.39680998741671031, -0.39821756215337356,
+  -0.39962419984564679, -0.40102989718357562, -0.40243465085941843,
+  -0.40383845756765407, -0.40524131400498986, -0.40664321687036903,
+  -0.40804416286497869, -0.40944414869225759, -0.41084317105790391,
+  -0.41224122666988289, -0.4136383122384345, -0.41503442447608163,
+  -0.41642956009763715, -0.41782371582021227, -0.41921688836322391,
+  -0.42060907444840251, -0.42200027079979968, -0.42339047414379605,
+  -0.42477968120910881, -0.42616788872679962, -0.42755509343028208,
+  -0.42894129205532949, -0.43032648134008261, -0.43171065802505726,
+  -0.43309381885315196, -0.43447596056965565, -0.43585707992225547,
+  -0.43723717366104409, -0.43861623853852766, -0.43999427130963326,
+  -0.44137126873171667, -0.44274722756457002, -0.4441221445704292,
+  -0.44549601651398174, -0.44686884016237416, -0.44824061228521989,
+  -0.44961132965460654, -0.45098098904510386, -0.45234958723377089,
+  -0.45371712100016387, -0.45508358712634384, -0.45644898239688392,
+  -0.45781330359887717, -0.45917654752194409, -0.46053871095824001,
+  -0.46189979070246273, -0.46325978355186015, -0.46461868630623782,
+  -0.46597649576796618, -0.46733320874198842, -0.4686888220358279,
+  -0.47004333245959562, -0.47139673682599764, -0.47274903195034279,
+  -0.47410021465054997, -0.47545028174715587, -0.47679923006332209,
+  -0.47814705642484301, -0.47949375766015301, -0.48083933060033396,
+  -0.48218377207912272, -0.48352707893291874, -0.48486924800079106,
+  -0.48621027612448642, -0.487550160148436, -0.48888889691976317,
+  -0.49022648328829116, -0.4915629161065499, -0.49289819222978404,
+  -0.49423230851595967, -0.49556526182577254, -0.49689704902265447,
+  -0.49822766697278187, -0.49955711254508184, -0.50088538261124071,
+  -0.50221247404571079, -0.50353838372571758, -0.50486310853126759,
+  -0.50618664534515523, -0.50750899105297087, -0.50883014254310699,
+  -0.51015009670676681, -0.5114688504379703, -0.51278640063356296,
+  -0.51410274419322166, -0.51541787801946293, -0.51673179901764987,
+  -0.51804450409599934, -0.51935599016558964, -0.52066625414036716,
+  -0.52197529293715439, -0.52328310347565643, -0.52458968267846895,
+  -0.52589502747108463, -0.52719913478190128, -0.52850200154222848,
+  -0.52980362468629461, -0.531104001151255, -0.5324031278771979,
+  -0.53370100180715296, -0.53499761988709715, -0.53629297906596318,
+  -0.53758707629564539, -0.53887990853100842, -0.54017147272989285,
+  -0.54146176585312344, -0.54275078486451589, -0.54403852673088382,
+  -0.54532498842204646, -0.54661016691083486, -0.54789405917310019,
+  -0.54917666218771966, -0.55045797293660481, -0.55173798840470734,
+  -0.55301670558002747, -0.55429412145362, -0.55557023301960218,
+  -0.5568450372751601, -0.5581185312205561, -0.55939071185913614,
+  -0.56066157619733603, -0.56193112124468947, -0.56319934401383409,
+  -0.5644662415205195, -0.56573181078361312, -0.56699604882510868,
+  -0.56825895267013149, -0.56952051934694714, -0.57078074588696726,
+  -0.57203962932475705, -0.5732971666980422, -0.57455335504771576,
+  -0.57580819141784534, -0.57706167285567944, -0.57831379641165559,
+  -0.57956455913940563, -0.58081395809576453, -0.58206199034077544,
+  -0.58330865293769829, -0.58455394295301533, -0.58579785745643886,
+  -0.58704039352091797, -0.58828154822264522, -0.58952131864106394,
+  -0.59075970185887416, -0.59199669496204099, -0.5932322950397998,
+  -0.59446649918466443, -0.59569930449243336, -0.5969307080621965,
+  -0.59816070699634227, -0.59938929840056454, -0.60061647938386897,
+  -0.60184224705858003, -0.60306659854034816, -0.60428953094815596,
+  -0.60551104140432555, -0.60673112703452448, -0.60794978496777363,
+  -0.60916701233645321, -0.61038280627630948, -0.61159716392646191,
+  -0.61281008242940971, -0.61402155893103838, -0.61523159058062682,
+  -0.61644017453085365, -0.61764730793780387, -0.61885298796097632,
+  -0.6200572117632891, -0.62125997651108755, -0.62246127937414997,
+  -0.62366111752569453, -0.62485948814238634, -0.62605638840434352,
+  -0.62725181549514408, -0.62844576660183271, -0.62963823891492698,
+  -0.63082922962842447, -0.63201873593980906, -0.63320675505005719,
+  -0.63439328416364549, -0.63557832048855611, -0.6367618612362842,
+  -0.63794390362184406, -0.63912444486377573, -0.64030348218415167,
+  -0.64148101280858316, -0.64265703396622686, -0.64383154288979139,
+  -0.64500453681554393, -0.64617601298331628, -0.64734596863651206,
+  -0.64851440102211244, -0.64968130739068319, -0.65084668499638088,
+  -0.6520105310969595, -0.65317284295377676, -0.65433361783180044,
+  -0.65549285299961535, -0.65665054572942894, -0.65780669329707864,
+  -0.65896129298203732, -0.66011434206742048, -0.66126583783999227,
+  -0.66241577759017178, -0.66356415861203977, -0.66471097820334479,
+  -0.66585623366550972, -0.66699992230363747, -0.66814204142651845,
+  -0.66928258834663601, -0.67042156038017309, -0.67155895484701833,
+  -0.67269476907077286, -0.67382900037875604, -0.67496164610201193,
+  -0.67609270357531592, -0.67722217013718033, -0.67835004312986147,
+  -0.67947631989936497, -0.68060099779545302, -0.68172407417164971,
+  -0.68284554638524808, -0.6839654117973154, -0.68508366777270036,
+  -0.68620031168003859, -0.68731534089175905, -0.68842875278409044,
+  -0.68954054473706683, -0.6906507141345346, -0.69175925836415775,
+  -0.69286617481742463, -0.693971460889654, -0.69507511398000088,
+  -0.69617713149146299, -0.69727751083088652, -0.69837624940897292,
+  -0.69947334464028377, -0.70056879394324834, -0.70166259474016845,
+  -0.7027547444572253, -0.70384524052448494, -0.70493408037590488,
+  -0.70602126144933974, -0.70710678118654746, -0.70819063703319529,
+  -0.70927282643886558, -0.71035334685706231, -0.71143219574521643,
+  -0.71250937056469232, -0.71358486878079352, -0.71465868786276898,
+  -0.71573082528381859, -0.71680127852109954, -0.71787004505573171,
+  -0.71893712237280438, -0.72000250796138165, -0.72106619931450811,
+  -0.72212819392921535, -0.72318848930652735, -0.72424708295146689,
+  -0.72530397237306066, -0.72635915508434601, -0.72741262860237577,
+  -0.7284643904482252, -0.7295144381469969, -0.73056276922782759,
+  -0.73160938122389252, -0.73265427167241282, -0.73369743811466026,
+  -0.73473887809596339, -0.73577858916571348, -0.73681656887736979,
+  -0.73785281478846598, -0.73888732446061511, -0.73992009545951609,
+  -0.74095112535495911, -0.74198041172083096, -0.74300795213512172,
+  -0.74403374417992918, -0.74505778544146595, -0.74608007351006378,
+  -0.74710060598018013, -0.74811938045040349, -0.74913639452345926,
+  -0.75015164580621496, -0.75116513190968637, -0.7521768504490427,
+  -0.75318679904361241, -0.75419497531688917, -0.75520137689653655,
+  -0.75620600141439454, -0.75720884650648446, -0.75820990981301528,
+  -0.75920918897838796, -0.76020668165120242, -0.76120238548426178,
+  -0.7621962981345789, -0.76318841726338127, -0.76417874053611667,
+  -0.76516726562245896, -0.76615399019631281, -0.7671389119358204,
+  -0.76812202852336531, -0.76910333764557959, -0.7700828369933479,
+  -0.77106052426181371, -0.77203639715038441, -0.77301045336273699,
+  -0.77398269060682279, -0.77495310659487382, -0.77592169904340758,
+  -0.77688846567323244, -0.77785340420945304, -0.77881651238147587,
+  -0.77977778792301444, -0.78073722857209438, -0.78169483207105939,
+  -0.78265059616657573, -0.7836045186096382, -0.78455659715557524,
+  -0.78550682956405393, -0.78645521359908577, -0.78740174702903132,
+  -0.78834642762660623, -0.78928925316888565, -0.79023022143731003,
+  -0.79116933021769009, -0.79210657730021239, -0.79304196047944364,
+  -0.79397547755433717, -0.79490712632823701, -0.79583690460888346,
+  -0.79676481020841872, -0.79769084094339104, -0.79861499463476082,
+  -0.79953726910790501, -0.80045766219262271, -0.80137617172314013,
+  -0.80229279553811572, -0.80320753148064483, -0.8041203773982657,
+  -0.80503133114296366, -0.80594039057117628, -0.80684755354379922,
+  -0.80775281792619036, -0.80865618158817498, -0.80955764240405126,
+  -0.81045719825259477, -0.81135484701706373, -0.81225058658520388,
+  -0.81314441484925359, -0.8140363297059483, -0.81492632905652662,
+  -0.81581441080673378, -0.81670057286682785, -0.81758481315158371,
+  -0.81846712958029866, -0.8193475200767969, -0.82022598256943469,
+  -0.82110251499110465, -0.82197711527924155, -0.82284978137582632,
+  -0.82372051122739132, -0.82458930278502529, -0.82545615400437744,
+  -0.82632106284566342, -0.82718402727366902, -0.8280450452577558,
+  -0.82890411477186487, -0.82976123379452305, -0.8306164003088462,
+  -0.83146961230254524, -0.83232086776792968, -0.83317016470191319,
+  -0.83401750110601813, -0.83486287498638001, -0.8357062843537526,
+  -0.83654772722351189, -0.83738720161566194, -0.83822470555483797,
+  -0.83906023707031263, -0.83989379419599941, -0.84072537497045807,
+  -0.84155497743689833, -0.84238259964318596, -0.84320823964184544,
+  -0.84403189549006641, -0.84485356524970701, -0.84567324698729907,
+  -0.84649093877405202, -0.84730663868585832, -0.84812034480329712,
+  -0.84893205521163961, -0.84974176800085244, -0.85054948126560337,
+  -0.8513551931052652, -0.85215890162391983, -0.85296060493036363,
+  -0.8537603011381113, -0.85455798836540053, -0.85535366473519603,
+  -0.85614732837519447, -0.85693897741782865, -0.85772861000027212,
+  -0.85851622426444274, -0.85930181835700836, -0.86008539042939014,
+  -0.86086693863776731, -0.8616464611430813, -0.8624239561110405,
+  -0.86319942171212416, -0.8639728561215867, -0.86474425751946238,
+  -0.86551362409056898, -0.86628095402451299, -0.86704624551569265,
+  -0.86780949676330321, -0.8685707059713409, -0.86932987134860673,
+  -0.87008699110871135, -0.87084206347007886, -0.87159508665595109,
+  -0.87234605889439154, -0.87309497841829009, -0.87384184346536675,
+  -0.87458665227817611, -0.87532940310411078, -0.8760700941954066,
+  -0.87680872380914576, -0.87754529020726124, -0.87827979165654146,
+  -0.87901222642863341, -0.87974259280004741, -0.88047088905216075,
+  -0.88119711347122198, -0.88192126434835494, -0.88264333997956279,
+  -0.88336333866573158, -0.88408125871263499, -0.88479709843093779,
+  -0.88551085613619995, -0.88622253014888064, -0.88693211879434208,
+  -0.88763962040285393, -0.88834503330959624, -0.88904835585466457,
+  -0.88974958638307289, -0.89044872324475788, -0.89114576479458318,
+  -0.89184070939234272, -0.89253355540276469, -0.89322430119551532,
+  -0.89391294514520325, -0.89459948563138258, -0.89528392103855758,
+  -0.89596624975618511, -0.89664647017868015, -0.89732458070541832,
+  -0.89800057974073988, -0.89867446569395382, -0.89934623697934146,
+  -0.90001589201616028, -0.90068342922864686, -0.90134884704602203,
+  -0.90201214390249307, -0.90267331823725883, -0.90333236849451182,
+  -0.90398929312344334, -0.90464409057824624, -0.90529675931811882,
+  -0.90594729780726846, -0.90659570451491533, -0.90724197791529593,
+  -0.90788611648766615, -0.90852811871630612, -0.90916798309052227,
+  -0.90980570810465222, -0.91044129225806714, -0.91107473405517625,
+  -0.91170603200542988, -0.91233518462332275, -0.9129621904283981,
+  -0.91358704794525081, -0.91420975570353069, -0.91483031223794609,
+  -0.91544871608826783, -0.91606496579933161, -0.9166790599210427,
+  -0.91729099700837791, -0.91790077562139039, -0.91850839432521225,
+  -0.91911385169005777, -0.91971714629122736, -0.92031827670911048,
+  -0.92091724152918952, -0.9215140393420419, -0.92210866874334507,
+  -0.92270112833387852, -0.92329141671952764, -0.92387953251128674,
+  -0.9244654743252626, -0.92504924078267758, -0.92563083050987272,
+  -0.92621024213831127, -0.92678747430458175, -0.92736252565040111,
+  -0.92793539482261789, -0.92850608047321548, -0.92907458125931575,
+  -0.92964089584318133, -0.93020502289221907, -0.93076696107898371,
+  -0.93132670908118043, -0.93188426558166815, -0.93243962926846236,
+  -0.93299279883473885, -0.93354377297883617, -0.93409255040425887,
+  -0.93463912981968078, -0.9351835099389475, -0.93572568948108037,
+  -0.93626566717027826, -0.93680344173592156, -0.93733901191257496,
+  -0.93787237643998989, -0.93840353406310806, -0.93893248353206449,
+  -0.93945922360218992, -0.93998375303401394, -0.9405060705932683,
+  -0.94102617505088926, -0.94154406518302081, -0.94205973977101731,
+  -0.94257319760144687, -0.94308443746609349, -0.94359345816196039,
+  -0.94410025849127266, -0.94460483726148026, -0.94510719328526061,
+  -0.94560732538052128, -0.94610523237040334, -0.94660091308328353,
+  -0.94709436635277722, -0.94758559101774109, -0.94807458592227623,
+  -0.94856134991573027, -0.94904588185270056, -0.94952818059303667,
+  -0.950008245001843, -0.9504860739494817, -0.95096166631157508,
+  -0.95143502096900834, -0.95190613680793223, -0.95237501271976588,
+  -0.95284164760119872, -0.95330604035419375, -0.95376818988599033,
+  -0.95422809510910567, -0.95468575494133834, -0.95514116830577067,
+  -0.95559433413077111, -0.95604525134999641, -0.95649391890239499,
+  -0.95694033573220894, -0.95738450078897586, -0.95782641302753291,
+  -0.95826607140801767, -0.9587034748958716, -0.95913862246184189,
+  -0.95957151308198452, -0.96000214573766585, -0.96043051941556579,
+  -0.96085663310767966, -0.96128048581132064, -0.96170207652912254,
+  -0.96212140426904158, -0.96253846804435916, -0.96295326687368388,
+  -0.96336579978095405, -0.96377606579543984, -0.96418406395174572,
+  -0.96458979328981265, -0.96499325285492032, -0.9653944416976894,
+  -0.96579335887408357, -0.96619000344541262, -0.96658437447833312,
+  -0.96697647104485207, -0.96736629222232851, -0.96775383709347551,
+  -0.96813910474636233, -0.96852209427441727, -0.96890280477642887,
+  -0.96928123535654853, -0.96965738512429245, -0.97003125319454397,
+  -0.9704028386875555, -0.97077214072895035, -0.97113915844972509,
+  -0.97150389098625178, -0.9718663374802794, -0.97222649707893627,
+  -0.97258436893473221, -0.97293995220556007, -0.97329324605469825,
+  -0.97364424965081187, -0.97399296216795583, -0.97433938278557586,
+  -0.97468351068851067, -0.97502534506699412, -0.97536488511665687,
+  -0.97570213003852857, -0.97603707903903902, -0.97636973133002114,
+  -0.97670008612871184, -0.97702814265775439, -0.97735390014519996,
+  -0.97767735782450993, -0.97799851493455714, -0.97831737071962765,
+  -0.9786339244294231, -0.9789481753190622, -0.97926012264908202,
+  -0.97956976568544052, -0.97987710369951764, -0.98018213596811732,
+  -0.98048486177346938, -0.98078528040323043, -0.98108339115048659,
+  -0.98137919331375456, -0.98167268619698311, -0.98196386910955524,
+  -0.98225274136628937, -0.98253930228744124, -0.98282355119870524,
+  -0.98310548743121629, -0.98338511032155118, -0.98366241921173025,
+  -0.98393741344921892, -0.98421009238692903, -0.98448045538322093,
+  -0.98474850180190421, -0.98501423101223984, -0.98527764238894122,
+  -0.98553873531217606, -0.98579750916756737, -0.98605396334619544,
+  -0.98630809724459867, -0.98655991026477541, -0.98680940181418542,
+  -0.98705657130575097, -0.98730141815785843, -0.98754394179435923,
+  -0.98778414164457218, -0.98802201714328353, -0.98825756773074946,
+  -0.98849079285269659, -0.98872169196032378, -0.98895026451030299,
+  -0.98917650996478101, -0.98940042779138038, -0.98962201746320078,
+  -0.98984127845882053, -0.99005821026229712, -0.99027281236316911,
+  -0.99048508425645698, -0.99069502544266463, -0.99090263542778001,
+  -0.99110791372327678, -0.99131085984611544, -0.9915114733187439,
+  -0.99170975366909953, -0.99190570043060933, -0.9920993131421918,
+  -0.99229059134825737, -0.99247953459870997, -0.99266614244894802,
+  -0.9928504144598651, -0.99303235019785141, -0.9932119492347945,
+  -0.99338921114808065, -0.9935641355205953, -0.9937367219407246,
+  -0.99390697000235606, -0.99407487930487937, -0.9942404494531879,
+  -0.9944036800576791, -0.99456457073425542, -0.9947231211043257,
+  -0.99487933079480562, -0.99503319943811863, -0.99518472667219682,
+  -0.99533391214048228, -0.99548075549192694, -0.99562525638099431,
+  -0.99576741446765982, -0.99590722941741172, -0.99604470090125197,
+  -0.99617982859569687, -0.996312612182778, -0.99644305135004263,
+  -0.99657114579055484, -0.99669689520289606, -0.99682029929116567,
+  -0.99694135776498216, -0.99706007033948296, -0.99717643673532619,
+  -0.99729045667869021, -0.9974021299012753, -0.99751145614030345,
+  -0.99761843513851955, -0.99772306664419164, -0.99782535041111164,
+  -0.997925286198596, -0.99802287377148624, -0.99811811290014918,
+  -0.99821100336047819, -0.99830154493389289, -0.99838973740734016,
+  -0.99847558057329477, -0.99855907422975931, -0.99864021818026527,
+  -0.99871901223387294, -0.99879545620517241, -0.99886954991428356,
+  -0.99894129318685687, -0.99901068585407338, -0.99907772775264536,
+  -0.99914241872481691, -0.99920475861836389, -0.99926474728659442,
+  -0.99932238458834954, -0.99937767038800285, -0.99943060455546173,
+  -0.99948118696616695, -0.99952941750109314, -0.99957529604674922,
+  -0.99961882249517864, -0.99965999674395922, -0.99969881869620425,
+  -0.99973528826056168, -0.99976940535121528, -0.99980116988788426,
+  -0.9998305817958234, -0.99985764100582386, -0.99988234745421256,
+  -0.9999047010828529, -0.9999247018391445, -0.99994234967602391,
+  -0.9999576445519639, -0.99997058643097414, -0.99998117528260111,
+  -0.9999894110819284, -0.99999529380957619, -0.99999882345170188,
+  -1, -0.99999882345170188, -0.99999529380957619,
+  -0.9999894110819284, -0.99998117528260111, -0.99997058643097414,
+  -0.9999576445519639, -0.99994234967602391, -0.9999247018391445,
+  -0.9999047010828529, -0.99988234745421256, -0.99985764100582386,
+  -0.9998305817958234, -0.99980116988788426, -0.99976940535121528,
+  -0.99973528826056168, -0.99969881869620425, -0.99965999674395922,
+  -0.99961882249517864, -0.99957529604674922, -0.99952941750109314,
+  -0.99948118696616695, -0.99943060455546173, -0.99937767038800285,
+  -0.99932238458834954, -0.99926474728659442, -0.99920475861836389,
+  -0.99914241872481691, -0.99907772775264536, -0.99901068585407338,
+  -0.99894129318685687, -0.99886954991428356, -0.99879545620517241,
+  -0.99871901223387294, -0.99864021818026527, -0.99855907422975931,
+  -0.99847558057329477, -0.99838973740734016, -0.99830154493389289,
+  -0.99821100336047819, -0.99811811290014918, -0.99802287377148624,
+  -0.997925286198596, -0.99782535041111164, -0.99772306664419164,
+  -0.99761843513851955, -0.99751145614030345, -0.9974021299012753,
+  -0.99729045667869021, -0.99717643673532619, -0.99706007033948296,
+  -0.99694135776498216, -0.99682029929116567, -0.99669689520289606,
+  -0.99657114579055484, -0.99644305135004263, -0.996312612182778,
+  -0.99617982859569698, -0.99604470090125197, -0.99590722941741172,
+  -0.99576741446765982, -0.99562525638099431, -0.99548075549192694,
+  -0.99533391214048228, -0.99518472667219693, -0.99503319943811863,
+  -0.99487933079480562, -0.9947231211043257, -0.99456457073425542,
+  -0.9944036800576791, -0.9942404494531879, -0.99407487930487937,
+  -0.99390697000235606, -0.9937367219407246, -0.9935641355205953,
+  -0.99338921114808065, -0.9932119492347945, -0.99303235019785141,
+  -0.9928504144598651, -0.99266614244894802, -0.99247953459870997,
+  -0.99229059134825737, -0.9920993131421918, -0.99190570043060933,
+  -0.99170975366909953, -0.9915114733187439, -0.99131085984611544,
+  -0.99110791372327689, -0.99090263542778001, -0.99069502544266463,
+  -0.99048508425645709, -0.99027281236316911, -0.99005821026229712,
+  -0.98984127845882053, -0.98962201746320089, -0.98940042779138038,
+  -0.98917650996478101, -0.98895026451030299, -0.98872169196032378,
+  -0.98849079285269659, -0.98825756773074946, -0.98802201714328353,
+  -0.98778414164457218, -0.98754394179435923, -0.98730141815785843,
+  -0.98705657130575097, -0.98680940181418553, -0.98655991026477541,
+  -0.98630809724459867, -0.98605396334619544, -0.98579750916756748,
+  -0.98553873531217606, -0.98527764238894122, -0.98501423101223984,
+  -0.98474850180190421, -0.98448045538322093, -0.98421009238692903,
+  -0.98393741344921892, -0.98366241921173025, -0.98338511032155118,
+  -0.98310548743121629, -0.98282355119870524, -0.98253930228744124,
+  -0.98225274136628937, -0.98196386910955524, -0.98167268619698311,
+  -0.98137919331375456, -0.98108339115048671, -0.98078528040323043,
+  -0.98048486177346938, -0.98018213596811743, -0.97987710369951764,
+  -0.97956976568544052, -0.97926012264908202, -0.9789481753190622,
+  -0.97863392442942321, -0.97831737071962765, -0.97799851493455714,
+  -0.97767735782450993, -0.97735390014519996, -0.97702814265775439,
+  -0.97670008612871184, -0.97636973133002114, -0.97603707903903902,
+  -0.97570213003852857, -0.97536488511665698, -0.97502534506699412,
+  -0.97468351068851067, -0.97433938278557586, -0.97399296216795583,
+  -0.97364424965081198, -0.97329324605469825, -0.97293995220556018,
+  -0.97258436893473221, -0.97222649707893627, -0.9718663374802794,
+  -0.97150389098625178, -0.97113915844972509, -0.97077214072895035,
+  -0.9704028386875555, -0.97003125319454397, -0.96965738512429245,
+  -0.96928123535654853, -0.96890280477642887, -0.96852209427441738,
+  -0.96813910474636244, -0.96775383709347551, -0.96736629222232851,
+  -0.96697647104485207, -0.96658437447833312, -0.9661900034454125,
+  -0.96579335887408368, -0.9653944416976894, -0.96499325285492032,
+  -0.96458979328981276, -0.96418406395174583, -0.96377606579543984,
+  -0.96336579978095405, -0.96295326687368388, -0.96253846804435916,
+  -0.96212140426904158, -0.96170207652912254, -0.96128048581132064,
+  -0.96085663310767966, -0.96043051941556579, -0.96000214573766596,
+  -0.95957151308198452, -0.95913862246184189, -0.9587034748958716,
+  -0.95826607140801767, -0.95782641302753291, -0.95738450078897586,
+  -0.95694033573220882, -0.9564939189023951, -0.95604525134999641,
+  -0.95559433413077111, -0.95514116830577078, -0.95468575494133834,
+  -0.95422809510910567, -0.95376818988599033, -0.95330604035419386,
+  -0.95284164760119872, -0.95237501271976588, -0.95190613680793235,
+  -0.95143502096900834, -0.95096166631157508, -0.9504860739494817,
+  -0.950008245001843, -0.94952818059303667, -0.94904588185270056,
+  -0.94856134991573027, -0.94807458592227623, -0.94758559101774109,
+  -0.94709436635277722, -0.94660091308328353, -0.94610523237040345,
+  -0.94560732538052128, -0.94510719328526061, -0.94460483726148026,
+  -0.94410025849127266, -0.94359345816196039, -0.94308443746609349,
+  -0.94257319760144687, -0.94205973977101731, -0.94154406518302081,
+  -0.94102617505088926, -0.9405060705932683, -0.93998375303401405,
+  -0.93945922360218992, -0.9389324835320646, -0.93840353406310806,
+  -0.93787237643998989, -0.93733901191257496, -0.93680344173592156,
+  -0.93626566717027826, -0.93572568948108037, -0.93518350993894761,
+  -0.93463912981968078, -0.93409255040425898, -0.93354377297883617,
+  -0.93299279883473896, -0.93243962926846236, -0.93188426558166815,
+  -0.93132670908118043, -0.93076696107898371, -0.93020502289221907,
+  -0.92964089584318133, -0.92907458125931586, -0.92850608047321559,
+  -0.92793539482261789, -0.92736252565040111, -0.92678747430458175,
+  -0.92621024213831138, -0.92563083050987272, -0.92504924078267758,
+  -0.9244654743252626, -0.92387953251128674, -0.92329141671952764,
+  -0.92270112833387863, -0.92210866874334518, -0.92151403934204201,
+  -0.92091724152918952, -0.92031827670911059, -0.91971714629122736,
+  -0.91911385169005777, -0.91850839432521225, -0.9179007756213905,
+  -0.91729099700837791, -0.9166790599210427, -0.91606496579933172,
+  -0.91544871608826783, -0.9148303122379462, -0.91420975570353069,
+  -0.91358704794525081, -0.91296219042839821, -0.91233518462332275,
+  -0.91170603200542988, -0.91107473405517636, -0.91044129225806725,
+  -0.90980570810465222, -0.90916798309052238, -0.90852811871630612,
+  -0.90788611648766626, -0.90724197791529582, -0.90659570451491533,
+  -0.90594729780726846, -0.90529675931811882, -0.90464409057824624,
+  -0.90398929312344334, -0.90333236849451182, -0.90267331823725883,
+  -0.90201214390249318, -0.90134884704602203, -0.90068342922864697,
+  -0.90001589201616028, -0.89934623697934157, -0.89867446569395382,
+  -0.89800057974073988, -0.89732458070541832, -0.89664647017868015,
+  -0.89596624975618522, -0.89528392103855758, -0.8945994856313827,
+  -0.89391294514520325, -0.89322430119551532, -0.89253355540276458,
+  -0.89184070939234272, -0.89114576479458318, -0.89044872324475788,
+  -0.88974958638307278, -0.88904835585466457, -0.88834503330959635,
+  -0.88763962040285393, -0.88693211879434219, -0.88622253014888064,
+  -0.88551085613619995, -0.88479709843093779, -0.88408125871263499,
+  -0.88336333866573158, -0.88264333997956279, -0.88192126434835505,
+  -0.88119711347122209, -0.88047088905216075, -0.87974259280004741,
+  -0.87901222642863353, -0.87827979165654158, -0.87754529020726135,
+  -0.87680872380914565, -0.8760700941954066, -0.87532940310411089,
+  -0.87458665227817611, -0.87384184346536686, -0.87309497841829009,
+  -0.87234605889439154, -0.87159508665595098, -0.87084206347007898,
+  -0.87008699110871146, -0.86932987134860684, -0.8685707059713409,
+  -0.86780949676330332, -0.86704624551569265, -0.86628095402451299,
+  -0.86551362409056909, -0.86474425751946238, -0.86397285612158681,
+  -0.86319942171212416, -0.86242395611104061, -0.8616464611430813,
+  -0.86086693863776731, -0.86008539042939014, -0.85930181835700847,
+  -0.85851622426444274, -0.85772861000027212, -0.85693897741782876,
+  -0.85614732837519447, -0.85535366473519603, -0.85455798836540053,
+  -0.85376030113811141, -0.85296060493036363, -0.85215890162391983,
+  -0.8513551931052652, -0.85054948126560348, -0.84974176800085255,
+  -0.84893205521163961, -0.84812034480329723, -0.84730663868585832,
+  -0.84649093877405213, -0.84567324698729907, -0.84485356524970712,
+  -0.84403189549006641, -0.84320823964184544, -0.84238259964318585,
+  -0.84155497743689844, -0.84072537497045807, -0.83989379419599952,
+  -0.83906023707031274, -0.83822470555483808, -0.83738720161566194,
+  -0.83654772722351201, -0.8357062843537526, -0.83486287498638001,
+  -0.83401750110601813, -0.83317016470191319, -0.83232086776792968,
+  -0.83146961230254524, -0.83061640030884631, -0.82976123379452305,
+  -0.82890411477186487, -0.8280450452577558, -0.82718402727366913,
+  -0.82632106284566353, -0.82545615400437755, -0.82458930278502529,
+  -0.82372051122739143, -0.82284978137582643, -0.82197711527924155,
+  -0.82110251499110465, -0.82022598256943469, -0.8193475200767969,
+  -0.81846712958029866, -0.81758481315158371, -0.81670057286682785,
+  -0.81581441080673378, -0.81492632905652662, -0.81403632970594841,
+  -0.81314441484925359, -0.81225058658520388, -0.81135484701706373,
+  -0.81045719825259477, -0.80955764240405126, -0.80865618158817498,
+  -0.80775281792619036, -0.80684755354379933, -0.80594039057117628,
+  -0.80503133114296366, -0.80412037739826581, -0.80320753148064494,
+  -0.80229279553811572, -0.80137617172314024, -0.80045766219262282,
+  -0.79953726910790501, -0.79861499463476082, -0.79769084094339116,
+  -0.79676481020841883, -0.79583690460888357, -0.79490712632823701,
+  -0.79397547755433717, -0.79304196047944364, -0.79210657730021239,
+  -0.7911693302176902, -0.79023022143731003, -0.78928925316888565,
+  -0.78834642762660634, -0.78740174702903143, -0.78645521359908577,
+  -0.78550682956405393, -0.78455659715557524, -0.7836045186096382,
+  -0.78265059616657573, -0.78169483207105939, -0.78073722857209449,
+  -0.77977778792301455, -0.77881651238147598, -0.77785340420945315,
+  -0.77688846567323244, -0.77592169904340769, -0.77495310659487393,
+  -0.7739826906068229, -0.77301045336273699, -0.77203639715038452,
+  -0.77106052426181382, -0.7700828369933479, -0.7691033376455797,
+  -0.76812202852336542, -0.7671389119358204, -0.76615399019631292,
+  -0.76516726562245896, -0.76417874053611667, -0.76318841726338127,
+  -0.7621962981345789, -0.76120238548426178, -0.76020668165120242,
+  -0.75920918897838807, -0.75820990981301528, -0.75720884650648457,
+  -0.75620600141439454, -0.75520137689653655, -0.75419497531688917,
+  -0.75318679904361252, -0.75217685044904281, -0.75116513190968648,
+  -0.75015164580621507, -0.74913639452345937, -0.7481193804504036,
+  -0.74710060598018013, -0.74608007351006378, -0.74505778544146606,
+  -0.74403374417992929, -0.74300795213512172, -0.74198041172083107,
+  -0.74095112535495911, -0.7399200954595162, -0.73888732446061511,
+  -0.73785281478846598, -0.7368165688773699, -0.73577858916571359,
+  -0.7347388780959635, -0.73369743811466037, -0.73265427167241282,
+  -0.73160938122389263, -0.73056276922782759, -0.72951443814699701,
+  -0.7284643904482252, -0.72741262860237577, -0.72635915508434601,
+  -0.72530397237306077, -0.724247082951467, -0.72318848930652746,
+  -0.72212819392921535, -0.72106619931450811, -0.72000250796138165,
+  -0.71893712237280449, -0.71787004505573171, -0.71680127852109954,
+  -0.71573082528381859, -0.71465868786276909, -0.71358486878079364,
+  -0.71250937056469232, -0.71143219574521643, -0.71035334685706242,
+  -0.70927282643886569, -0.7081906370331954, -0.70710678118654757,
+  -0.70602126144933974, -0.70493408037590499, -0.70384524052448494,
+  -0.7027547444572253, -0.70166259474016857, -0.70056879394324845,
+  -0.69947334464028377, -0.69837624940897292, -0.69727751083088663,
+  -0.69617713149146299, -0.69507511398000088, -0.693971460889654,
+  -0.69286617481742474, -0.69175925836415775, -0.69065071413453472,
+  -0.68954054473706694, -0.68842875278409055, -0.68731534089175916,
+  -0.6862003116800387, -0.68508366777270036, -0.68396541179731551,
+  -0.68284554638524808, -0.68172407417164982, -0.68060099779545313,
+  -0.67947631989936508, -0.67835004312986158, -0.67722217013718045,
+  -0.67609270357531603, -0.67496164610201204, -0.67382900037875615,
+  -0.67269476907077297, -0.67155895484701833, -0.67042156038017309,
+  -0.66928258834663601, -0.66814204142651856, -0.66699992230363747,
+  -0.66585623366550972, -0.6647109782033449, -0.66356415861203988,
+  -0.66241577759017178, -0.66126583783999227, -0.66011434206742048,
+  -0.65896129298203732, -0.65780669329707864, -0.65665054572942905,
+  -0.65549285299961546, -0.65433361783180055, -0.65317284295377676,
+  -0.6520105310969595, -0.65084668499638099, -0.64968130739068319,
+  -0.64851440102211255, -0.64734596863651206, -0.64617601298331639,
+  -0.64500453681554404, -0.6438315428897915, -0.64265703396622686,
+  -0.64148101280858316, -0.64030348218415167, -0.63912444486377573,
+  -0.63794390362184417, -0.6367618612362842, -0.63557832048855623,
+  -0.63439328416364549, -0.63320675505005719, -0.63201873593980906,
+  -0.63082922962842447, -0.6296382389149271, -0.62844576660183271,
+  -0.62725181549514419, -0.62605638840434352, -0.62485948814238645,
+  -0.62366111752569464, -0.62246127937415008, -0.62125997651108766,
+  -0.62005721176328921, -0.61885298796097632, -0.61764730793780398,
+  -0.61644017453085365, -0.61523159058062682, -0.61402155893103849,
+  -0.61281008242940971, -0.61159716392646202, -0.61038280627630948,
+  -0.60916701233645321, -0.60794978496777374, -0.60673112703452448,
+  -0.60551104140432555, -0.60428953094815607, -0.60306659854034828,
+  -0.60184224705858003, -0.60061647938386897, -0.59938929840056454,
+  -0.59816070699634238, -0.5969307080621965, -0.59569930449243347,
+  -0.59446649918466454, -0.5932322950397998, -0.59199669496204099,
+  -0.59075970185887428, -0.58952131864106394, -0.58828154822264533,
+  -0.58704039352091808, -0.58579785745643886, -0.58455394295301533,
+  -0.58330865293769829, -0.58206199034077555, -0.58081395809576453,
+  -0.57956455913940574, -0.57831379641165559, -0.57706167285567955,
+  -0.57580819141784534, -0.57455335504771576, -0.57329716669804232,
+  -0.57203962932475705, -0.57078074588696737, -0.56952051934694725,
+  -0.56825895267013149, -0.56699604882510868, -0.56573181078361323,
+  -0.5644662415205195, -0.56319934401383409, -0.56193112124468947,
+  -0.56066157619733603, -0.55939071185913614, -0.5581185312205561,
+  -0.5568450372751601, -0.55557023301960229, -0.55429412145362011,
+  -0.55301670558002758, -0.55173798840470745, -0.55045797293660481,
+  -0.54917666218771977, -0.54789405917310019, -0.54661016691083486,
+  -0.54532498842204646, -0.54403852673088393, -0.542750784864516,
+  -0.54146176585312356, -0.54017147272989297, -0.53887990853100842,
+  -0.53758707629564551, -0.53629297906596318, -0.53499761988709726,
+  -0.53370100180715296, -0.53240312787719801, -0.531104001151255,
+  -0.52980362468629483, -0.52850200154222848, -0.52719913478190139,
+  -0.52589502747108474, -0.52458968267846884, -0.52328310347565643,
+  -0.52197529293715439, -0.52066625414036727, -0.51935599016558953,
+  -0.51804450409599934, -0.51673179901764998, -0.51541787801946315,
+  -0.51410274419322166, -0.51278640063356307, -0.51146885043797052,
+  -0.5101500967067667, -0.50883014254310699, -0.50750899105297087,
+  -0.50618664534515545, -0.50486310853126748, -0.50353838372571758,
+  -0.5022124740457109, -0.50088538261124094, -0.49955711254508189,
+  -0.49822766697278187, -0.49689704902265464, -0.49556526182577249,
+  -0.49423230851595973, -0.49289819222978409, -0.49156291610655006,
+  -0.4902264832882911, -0.48888889691976323, -0.48755016014843605,
+  -0.48621027612448653, -0.48486924800079112, -0.48352707893291874,
+  -0.48218377207912283, -0.4808393306003339, -0.47949375766015301,
+  -0.47814705642484312, -0.47679923006332225, -0.47545028174715587,
+  -0.47410021465055002, -0.4727490319503429, -0.47139673682599781,
+  -0.47004333245959562, -0.46868882203582796, -0.46733320874198853,
+  -0.46597649576796613, -0.46461868630623782, -0.46325978355186026,
+  -0.46189979070246284, -0.46053871095824001, -0.45917654752194415,
+  -0.45781330359887729, -0.45644898239688386, -0.45508358712634384,
+  -0.45371712100016393, -0.452349587233771, -0.45098098904510381,
+  -0.4496113296546066, -0.44824061228522, -0.44686884016237433,
+  -0.44549601651398174, -0.44412214457042926, -0.44274722756457013,
+  -0.44137126873171662, -0.43999427130963326, -0.43861623853852771,
+  -0.4372371736610442, -0.43585707992225547, -0.43447596056965571,
+  -0.43309381885315201, -0.43171065802505737, -0.43032648134008261,
+  -0.42894129205532955, -0.4275550934302822, -0.42616788872679962,
+  -0.42477968120910881, -0.4233904741437961, -0.42200027079979979,
+  -0.42060907444840251, -0.41921688836322396, -0.41782371582021238,
+  -0.41642956009763732, -0.41503442447608163, -0.41363831223843456,
+  -0.412241226669883, -0.41084317105790391, -0.40944414869225759,
+  -0.40804416286497874, -0.40664321687036914, -0.40524131400498986,
+  -0.40383845756765413, -0.40243465085941854, -0.40102989718357579,
+  -0.39962419984564679, -0.39821756215337362, -0.39680998741671042,
+  -0.3954014789478163, -0.3939920400610481, -0.39258167407295153,
+  -0.39117038430225398, -0.38975817406985641, -0.3883450466988263,
+  -0.38693100551438869, -0.38551605384391902, -0.38410019501693504,
+  -0.38268343236508984, -0.38126576922216249, -0.37984720892405111,
+  -0.37842775480876562, -0.37700741021641831, -0.37558617848921733,
+  -0.37416406297145799, -0.37274106700951581, -0.3713171939518376,
+  -0.36989244714893427, -0.36846682995337232, -0.36704034571976724,
+  -0.36561299780477396, -0.36418478956707984, -0.36275572436739723,
+  -0.36132580556845434, -0.35989503653498828, -0.35846342063373654,
+  -0.35703096123343003, -0.35559766170478396, -0.35416352542049051,
+  -0.35272855575521073, -0.35129275608556715, -0.34985612979013503,
+  -0.34841868024943451, -0.34698041084592368, -0.34554132496398915,
+  -0.34410142598993898, -0.34266071731199438, -0.34121920232028241,
+  -0.33977688440682696, -0.33833376696554129, -0.33688985339222005,
+  -0.33544514708453166, -0.33399965144200949, -0.33255336986604422,
+  -0.33110630575987643, -0.32965846252858755, -0.32820984357909266,
+  -0.32676045232013179, -0.32531029216226298, -0.32385936651785296,
+  -0.32240767880107002, -0.32095523242787521, -0.31950203081601575,
+  -0.31804807738501506, -0.31659337555616585, -0.31513792875252244,
+  -0.31368174039889157, -0.31222481392182505, -0.31076715274961147,
+  -0.30930876031226878, -0.30784964004153498, -0.30638979537086108,
+  -0.30492922973540243, -0.30346794657201137, -0.3020059493192282,
+  -0.3005432414172734, -0.29907982630804048, -0.29761570743508631,
+  -0.29615088824362396, -0.29468537218051433, -0.29321916269425868,
+  -0.29175226323498937, -0.29028467725446233, -0.28881640820604948,
+  -0.28734745954472957, -0.28587783472708073, -0.28440753721127182,
+  -0.28293657045705539, -0.28146493792575805, -0.27999264308027338,
+  -0.27851968938505306, -0.27704608030609995, -0.27557181931095825,
+  -0.27409690986870633, -0.27262135544994898, -0.27114515952680807,
+  -0.2696683255729152, -0.26819085706340318, -0.26671275747489842,
+  -0.2652340302855119, -0.26375467897483151, -0.26227470702391359,
+  -0.26079411791527557, -0.25931291513288635, -0.25783110216215893,
+  -0.25634868248994291, -0.25486565960451463, -0.25338203699557027,
+  -0.25189781815421691, -0.25041300657296528, -0.24892760574572026,
+  -0.24744161916777344, -0.24595505033579459, -0.24446790274782421,
+  -0.24298017990326398, -0.2414918853028693, -0.2400030224487415,
+  -0.2385135948443185, -0.23702360599436734, -0.23553305940497546,
+  -0.23404195858354346, -0.23255030703877533, -0.23105810828067128,
+  -0.22956536582051887, -0.22807208317088579, -0.22657826384561011,
+  -0.22508391135979278, -0.22358902922979002, -0.22209362097320359,
+  -0.22059769010887365, -0.21910124015686977, -0.21760427463848367,
+  -0.2161067970762196, -0.21460881099378692, -0.21311031991609136,
+  -0.21161132736922761, -0.21011183688046972, -0.20861185197826346,
+  -0.20711137619221856, -0.20561041305309932, -0.20410896609281701,
+  -0.20260703884442111, -0.20110463484209196, -0.19960175762113105,
+  -0.19809841071795373, -0.19659459767008022, -0.19509032201612833,
+  -0.19358558729580375, -0.19208039704989238, -0.1905747548202528,
+  -0.18906866414980628, -0.18756212858252974, -0.18605515166344663,
+  -0.18454773693861964, -0.18303988795514106, -0.18153160826112513,
+  -0.18002290140569951, -0.17851377093899759, -0.17700422041214886,
+  -0.17549425337727137, -0.17398387338746385, -0.17247308399679603,
+  -0.17096188876030136, -0.16945029123396793, -0.16793829497473123,
+  -0.16642590354046422, -0.16491312048997009, -0.16339994938297323,
+  -0.16188639378011188, -0.1603724572429284, -0.15885814333386139,
+  -0.15734345561623828, -0.15582839765426532, -0.15431297301302024,
+  -0.15279718525844341, -0.15128103795733025, -0.14976453467732162,
+  -0.1482476789868962, -0.14673047445536175, -0.14521292465284752,
+  -0.14369503315029458, -0.142176803519448, -0.14065823933284924,
+  -0.13913934416382628, -0.13762012158648618, -0.1361005751757062,
+  -0.13458070850712622, -0.13306052515713918, -0.13154002870288328,
+  -0.13001922272223335, -0.12849811079379322, -0.12697669649688598,
+  -0.12545498341154621, -0.1239329751185122, -0.12241067519921628,
+  -0.12088808723577722, -0.11936521481099135, -0.11784206150832502,
+  -0.11631863091190488, -0.11479492660651025, -0.11327095217756436,
+  -0.11174671121112666, -0.11022220729388318, -0.10869744401313867,
+  -0.10717242495680887, -0.1056471537134107, -0.10412163387205473,
+  -0.10259586902243628, -0.10106986275482788, -0.099543618660069444,
+  -0.09801714032956077, -0.096490431355252607, -0.094963495329639061,
+  -0.093436335845747912, -0.091908956497132696, -0.090381360877865011,
+  -0.088853552582524684, -0.087325535206192226, -0.08579731234443988,
+  -0.084268887593324127, -0.082740264549375803, -0.081211446809592386,
+  -0.079682437971430126, -0.078153241632794315, -0.076623861392031617,
+  -0.075094300847921291, -0.073564563599667454, -0.072034653246889416,
+  -0.070504573389614009, -0.068974327628266732, -0.067443919563664106,
+  -0.06591335279700393, -0.06438263092985741, -0.06285175756416142,
+  -0.061320736302208648, -0.059789570746640007, -0.058258264500435732,
+  -0.056726821166907783, -0.055195244349690031, -0.053663537652730679,
+  -0.052131704680283317, -0.050599749036899337, -0.049067674327418126,
+  -0.047535484156959261, -0.046003182130914644, -0.044470771854938744,
+  -0.042938256934940959, -0.041405640977076712, -0.039872927587739845,
+  -0.038340120373552791, -0.036807222941358991, -0.035274238898213947,
+  -0.033741171851377642, -0.032208025408304704, -0.030674803176636581,
+  -0.02914150876419374, -0.02760814577896582, -0.02607471782910404,
+  -0.024541228522912264, -0.02300768146883941, -0.021474080275469605,
+  -0.019940428551514598, -0.01840672990580482, -0.016872987947281773,
+  -0.01533920628498822, -0.013805388528060349, -0.012271538285719944,
+  -0.010737659167264572, -0.0092037547820599599, -0.0076698287395310771,
+  -0.0061358846491545152, -0.004601926120448672, -0.0030679567629661379,
+  -0.0015339801862847662, 0, 0.0015339801862847655,
+  0.0030679567629659761, 0.0046019261204485705, 0.0061358846491544753,
+  0.007669828739531097, 0.0092037547820598194, 0.010737659167264491,
+  0.012271538285719925, 0.013805388528060391, 0.0153392062849881,
+  0.01687298794728171, 0.01840672990580482, 0.019940428551514441,
+  0.021474080275469508, 0.023007681468839369, 0.024541228522912288,
+  0.026074717829103901, 0.02760814577896574, 0.029141508764193722,
+  0.030674803176636626, 0.032208025408304586, 0.03374117185137758,
+  0.035274238898213947, 0.036807222941358832, 0.038340120373552694,
+  0.039872927587739811, 0.041405640977076739, 0.04293825693494082,
+  0.044470771854938668, 0.046003182130914623, 0.047535484156959303,
+  0.049067674327418015, 0.050599749036899282, 0.052131704680283324,
+  0.05366353765273052, 0.055195244349689934, 0.056726821166907748,
+  0.058258264500435752, 0.059789570746639868, 0.061320736302208578,
+  0.062851757564161406, 0.064382630929857465, 0.065913352797003805,
+  0.067443919563664051, 0.068974327628266746, 0.070504573389613856,
+  0.072034653246889332, 0.073564563599667426, 0.075094300847921305,
+  0.076623861392031492, 0.078153241632794232, 0.079682437971430126,
+  0.081211446809592441, 0.082740264549375692, 0.084268887593324071,
+  0.085797312344439894, 0.087325535206192059, 0.0888535525825246,
+  0.090381360877864983, 0.091908956497132724, 0.093436335845747787,
+  0.094963495329638992, 0.096490431355252593, 0.098017140329560604,
+  0.099543618660069319, 0.10106986275482782, 0.10259586902243628,
+  0.10412163387205459, 0.10564715371341062, 0.10717242495680884,
+  0.10869744401313872, 0.11022220729388306, 0.11174671121112659,
+  0.11327095217756435, 0.11479492660651008, 0.11631863091190475,
+  0.11784206150832498, 0.11936521481099135, 0.12088808723577708,
+  0.1224106751992162, 0.12393297511851216, 0.12545498341154623,
+  0.12697669649688587, 0.12849811079379317, 0.13001922272223335,
+  0.13154002870288312, 0.13306052515713906, 0.13458070850712617,
+  0.1361005751757062, 0.13762012158648604, 0.1391393441638262,
+  0.14065823933284921, 0.14217680351944803, 0.14369503315029447,
+  0.14521292465284746, 0.14673047445536175, 0.14824767898689603,
+  0.14976453467732151, 0.15128103795733022, 0.15279718525844344,
+  0.1543129730130201, 0.15582839765426523, 0.15734345561623825,
+  0.15885814333386145, 0.16037245724292828, 0.16188639378011183,
+  0.16339994938297323, 0.16491312048996992, 0.1664259035404641,
+  0.16793829497473117, 0.16945029123396796, 0.17096188876030122,
+  0.17247308399679595, 0.17398387338746382, 0.17549425337727143,
+  0.17700422041214875, 0.17851377093899751, 0.18002290140569951,
+  0.18153160826112497, 0.18303988795514095, 0.18454773693861962,
+  0.18605515166344663, 0.1875621285825296, 0.18906866414980619,
+  0.19057475482025274, 0.19208039704989244, 0.19358558729580361,
+  0.19509032201612825, 0.19659459767008022, 0.19809841071795356,
+  0.19960175762113097, 0.2011046348420919, 0.20260703884442113,
+  0.20410896609281687, 0.20561041305309924, 0.20711137619221856,
+  0.20861185197826349, 0.21011183688046961, 0.21161132736922755,
+  0.21311031991609136, 0.21460881099378676, 0.21610679707621952,
+  0.21760427463848364, 0.2191012401568698, 0.22059769010887351,
+  0.22209362097320351, 0.22358902922978999, 0.22508391135979283,
+  0.22657826384561, 0.22807208317088573, 0.22956536582051887,
+  0.23105810828067111, 0.23255030703877524, 0.23404195858354343,
+  0.23553305940497549, 0.2370236059943672, 0.23851359484431842,
+  0.2400030224487415, 0.24149188530286933, 0.24298017990326387,
+  0.24446790274782415, 0.24595505033579459, 0.24744161916777327,
+  0.24892760574572015, 0.25041300657296522, 0.25189781815421697,
+  0.25338203699557016, 0.25486565960451457, 0.25634868248994291,
+  0.25783110216215899, 0.25931291513288623, 0.26079411791527551,
+  0.26227470702391359, 0.26375467897483135, 0.26523403028551179,
+  0.26671275747489837, 0.26819085706340318, 0.26966832557291509,
+  0.27114515952680801, 0.27262135544994898, 0.27409690986870638,
+  0.27557181931095814, 0.2770460803060999, 0.27851968938505306,
+  0.27999264308027322, 0.28146493792575794, 0.28293657045705539,
+  0.28440753721127188, 0.28587783472708062, 0.28734745954472951,
+  0.28881640820604948, 0.29028467725446233, 0.29175226323498926,
+  0.29321916269425863, 0.29468537218051433, 0.29615088824362379,
+  0.2976157074350862, 0.29907982630804048, 0.30054324141727345,
+  0.30200594931922808, 0.30346794657201132, 0.30492922973540237,
+  0.30638979537086092, 0.30784964004153487, 0.30930876031226873,
+  0.31076715274961147, 0.31222481392182488, 0.31368174039889152,
+  0.31513792875252244, 0.31659337555616585, 0.31804807738501495,
+  0.31950203081601569, 0.32095523242787521, 0.32240767880106985,
+  0.32385936651785285, 0.32531029216226293, 0.32676045232013173,
+  0.3282098435790925, 0.32965846252858749, 0.33110630575987643,
+  0.33255336986604422, 0.33399965144200938, 0.3354451470845316,
+  0.33688985339222005, 0.33833376696554113, 0.33977688440682685,
+  0.34121920232028236, 0.34266071731199438, 0.34410142598993881,
+  0.34554132496398909, 0.34698041084592368, 0.34841868024943456,
+  0.34985612979013492, 0.35129275608556709, 0.35272855575521073,
+  0.35416352542049034, 0.35559766170478385, 0.35703096123342998,
+  0.35846342063373654, 0.35989503653498811, 0.36132580556845428,
+  0.36275572436739723, 0.36418478956707989, 0.36561299780477385,
+  0.36704034571976718, 0.36846682995337232, 0.3698924471489341,
+  0.37131719395183754, 0.37274106700951576, 0.37416406297145793,
+  0.37558617848921722, 0.37700741021641826, 0.37842775480876556,
+  0.37984720892405116, 0.38126576922216238, 0.38268343236508978,
+  0.38410019501693504, 0.38551605384391885, 0.38693100551438858,
+  0.38834504669882625, 0.38975817406985641, 0.39117038430225387,
+  0.39258167407295147, 0.3939920400610481, 0.39540147894781635,
+  0.39680998741671031, 0.39821756215337356, 0.39962419984564679,
+  0.40102989718357562, 0.40243465085941843, 0.40383845756765407,
+  0.40524131400498986, 0.40664321687036903, 0.40804416286497869,
+  0.40944414869225759, 0.41084317105790391, 0.41224122666988289,
+  0.4136383122384345, 0.41503442447608163, 0.41642956009763715,
+  0.41782371582021227, 0.41921688836322391, 0.42060907444840251,
+  0.42200027079979968, 0.42339047414379605, 0.42477968120910881,
+  0.42616788872679962, 0.42755509343028208, 0.42894129205532949,
+  0.43032648134008261, 0.43171065802505726, 0.43309381885315196,
+  0.43447596056965565, 0.43585707992225547, 0.43723717366104409,
+  0.43861623853852766, 0.43999427130963326, 0.44137126873171667,
+  0.44274722756457002, 0.4441221445704292, 0.44549601651398174,
+  0.44686884016237416, 0.44824061228521989, 0.44961132965460654,
+  0.45098098904510386, 0.45234958723377089, 0.45371712100016387,
+  0.45508358712634384, 0.45644898239688392, 0.45781330359887717,
+  0.45917654752194409, 0.46053871095824001, 0.46189979070246273,
+  0.46325978355186015, 0.46461868630623782, 0.46597649576796618,
+  0.46733320874198842, 0.4686888220358279, 0.47004333245959562,
+  0.47139673682599764, 0.47274903195034279, 0.47410021465054997,
+  0.47545028174715587, 0.47679923006332209, 0.47814705642484301,
+  0.47949375766015301, 0.48083933060033396, 0.48218377207912272,
+  0.48352707893291874, 0.48486924800079106, 0.48621027612448642,
+  0.487550160148436, 0.48888889691976317, 0.49022648328829116,
+  0.4915629161065499, 0.49289819222978404, 0.49423230851595967,
+  0.49556526182577254, 0.49689704902265447, 0.49822766697278187,
+  0.49955711254508184, 0.50088538261124071, 0.50221247404571079,
+  0.50353838372571758, 0.50486310853126759, 0.50618664534515523,
+  0.50750899105297087, 0.50883014254310699, 0.51015009670676681,
+  0.5114688504379703, 0.51278640063356296, 0.51410274419322166,
+  0.51541787801946293, 0.51673179901764987, 0.51804450409599934,
+  0.51935599016558964, 0.52066625414036716, 0.52197529293715439,
+  0.52328310347565643, 0.52458968267846895, 0.52589502747108463,
+  0.52719913478190128, 0.52850200154222848, 0.52980362468629461,
+  0.531104001151255, 0.5324031278771979, 0.53370100180715296,
+  0.53499761988709715, 0.53629297906596318, 0.53758707629564539,
+  0.53887990853100842, 0.54017147272989285, 0.54146176585312344,
+  0.54275078486451589, 0.54403852673088382, 0.54532498842204646,
+  0.54661016691083486, 0.54789405917310019, 0.54917666218771966,
+  0.55045797293660481, 0.55173798840470734, 0.55301670558002747,
+  0.55429412145362, 0.55557023301960218, 0.5568450372751601,
+  0.5581185312205561, 0.55939071185913614, 0.56066157619733603,
+  0.56193112124468947, 0.56319934401383409, 0.5644662415205195,
+  0.56573181078361312, 0.56699604882510868, 0.56825895267013149,
+  0.56952051934694714, 0.57078074588696726, 0.57203962932475705,
+  0.5732971666980422, 0.57455335504771576, 0.57580819141784534,
+  0.57706167285567944, 0.57831379641165559, 0.57956455913940563,
+  0.58081395809576453, 0.58206199034077544, 0.58330865293769829,
+  0.58455394295301533, 0.58579785745643886, 0.58704039352091797,
+  0.58828154822264522, 0.58952131864106394, 0.59075970185887416,
+  0.59199669496204099, 0.5932322950397998, 0.59446649918466443,
+  0.59569930449243336, 0.5969307080621965, 0.59816070699634227,
+  0.59938929840056454, 0.60061647938386897, 0.60184224705858003,
+  0.60306659854034816, 0.60428953094815596, 0.60551104140432555,
+  0.60673112703452448, 0.60794978496777363, 0.60916701233645321,
+  0.61038280627630948, 0.61159716392646191, 0.61281008242940971,
+  0.61402155893103838, 0.61523159058062682, 0.61644017453085365,
+  0.61764730793780387, 0.61885298796097632, 0.6200572117632891,
+  0.62125997651108755, 0.62246127937414997, 0.62366111752569453,
+  0.62485948814238634, 0.62605638840434352, 0.62725181549514408,
+  0.62844576660183271, 0.62963823891492698, 0.63082922962842447,
+  0.63201873593980906, 0.63320675505005719, 0.63439328416364549,
+  0.63557832048855611, 0.6367618612362842, 0.63794390362184406,
+  0.63912444486377573, 0.64030348218415167, 0.64148101280858316,
+  0.64265703396622686, 0.64383154288979139, 0.64500453681554393,
+  0.64617601298331628, 0.64734596863651206, 0.64851440102211244,
+  0.64968130739068319, 0.65084668499638088, 0.6520105310969595,
+  0.65317284295377676, 0.65433361783180044, 0.65549285299961535,
+  0.65665054572942894, 0.65780669329707864, 0.65896129298203732,
+  0.66011434206742048, 0.66126583783999227, 0.66241577759017178,
+  0.66356415861203977, 0.66471097820334479, 0.66585623366550972,
+  0.66699992230363747, 0.66814204142651845, 0.66928258834663601,
+  0.67042156038017309, 0.67155895484701833, 0.67269476907077286,
+  0.67382900037875604, 0.67496164610201193, 0.67609270357531592,
+  0.67722217013718033, 0.67835004312986147, 0.67947631989936497,
+  0.68060099779545302, 0.68172407417164971, 0.68284554638524808,
+  0.6839654117973154, 0.68508366777270036, 0.68620031168003859,
+  0.68731534089175905, 0.68842875278409044, 0.68954054473706683,
+  0.6906507141345346, 0.69175925836415775, 0.69286617481742463,
+  0.693971460889654, 0.69507511398000088, 0.69617713149146299,
+  0.69727751083088652, 0.69837624940897292, 0.69947334464028377,
+  0.70056879394324834, 0.70166259474016845, 0.7027547444572253,
+  0.70384524052448494, 0.70493408037590488, 0.70602126144933974,
+  0.70710678118654746, 0.70819063703319529, 0.70927282643886558,
+  0.71035334685706231, 0.71143219574521643, 0.71250937056469232,
+  0.71358486878079352, 0.71465868786276898, 0.71573082528381859,
+  0.71680127852109954, 0.71787004505573171, 0.71893712237280438,
+  0.72000250796138165, 0.72106619931450811, 0.72212819392921535,
+  0.72318848930652735, 0.72424708295146689, 0.72530397237306066,
+  0.72635915508434601, 0.72741262860237577, 0.7284643904482252,
+  0.7295144381469969, 0.73056276922782759, 0.73160938122389252,
+  0.73265427167241282, 0.73369743811466026, 0.73473887809596339,
+  0.73577858916571348, 0.73681656887736979, 0.73785281478846598,
+  0.73888732446061511, 0.73992009545951609, 0.74095112535495911,
+  0.74198041172083096, 0.74300795213512172, 0.74403374417992918,
+  0.74505778544146595, 0.74608007351006378, 0.74710060598018013,
+  0.74811938045040349, 0.74913639452345926, 0.75015164580621496,
+  0.75116513190968637, 0.7521768504490427, 0.75318679904361241,
+  0.75419497531688917, 0.75520137689653655, 0.75620600141439454,
+  0.75720884650648446, 0.75820990981301528, 0.75920918897838796,
+  0.76020668165120242, 0.76120238548426178, 0.7621962981345789,
+  0.76318841726338127, 0.76417874053611667, 0.76516726562245896,
+  0.76615399019631281, 0.7671389119358204, 0.76812202852336531,
+  0.76910333764557959, 0.7700828369933479, 0.77106052426181371,
+  0.77203639715038441, 0.77301045336273699, 0.77398269060682279,
+  0.77495310659487382, 0.77592169904340758, 0.77688846567323244,
+  0.77785340420945304, 0.77881651238147587, 0.77977778792301444,
+  0.78073722857209438, 0.78169483207105939, 0.78265059616657573,
+  0.7836045186096382, 0.78455659715557524, 0.78550682956405393,
+  0.78645521359908577, 0.78740174702903132, 0.78834642762660623,
+  0.78928925316888565, 0.79023022143731003, 0.79116933021769009,
+  0.79210657730021239, 0.79304196047944364, 0.79397547755433717,
+  0.79490712632823701, 0.79583690460888346, 0.79676481020841872,
+  0.79769084094339104, 0.79861499463476082, 0.79953726910790501,
+  0.80045766219262271, 0.80137617172314013, 0.80229279553811572,
+  0.80320753148064483, 0.8041203773982657, 0.80503133114296366,
+  0.80594039057117628, 0.80684755354379922, 0.80775281792619036,
+  0.80865618158817498, 0.80955764240405126, 0.81045719825259477,
+  0.81135484701706373, 0.81225058658520388, 0.81314441484925359,
+  0.8140363297059483, 0.81492632905652662, 0.81581441080673378,
+  0.81670057286682785, 0.81758481315158371, 0.81846712958029866,
+  0.8193475200767969, 0.82022598256943469, 0.82110251499110465,
+  0.82197711527924155, 0.82284978137582632, 0.82372051122739132,
+  0.82458930278502529, 0.82545615400437744, 0.82632106284566342,
+  0.82718402727366902, 0.8280450452577558, 0.82890411477186487,
+  0.82976123379452305, 0.8306164003088462, 0.83146961230254524,
+  0.83232086776792968, 0.83317016470191319, 0.83401750110601813,
+  0.83486287498638001, 0.8357062843537526, 0.83654772722351189,
+  0.83738720161566194, 0.83822470555483797, 0.83906023707031263,
+  0.83989379419599941, 0.84072537497045807, 0.84155497743689833,
+  0.84238259964318596, 0.84320823964184544, 0.84403189549006641,
+  0.84485356524970701, 0.84567324698729907, 0.84649093877405202,
+  0.84730663868585832, 0.84812034480329712, 0.84893205521163961,
+  0.84974176800085244, 0.85054948126560337, 0.8513551931052652,
+  0.85215890162391983, 0.85296060493036363, 0.8537603011381113,
+  0.85455798836540053, 0.85535366473519603, 0.85614732837519447,
+  0.85693897741782865, 0.85772861000027212, 0.85851622426444274,
+  0.85930181835700836, 0.86008539042939014, 0.86086693863776731,
+  0.8616464611430813, 0.8624239561110405, 0.86319942171212416,
+  0.8639728561215867, 0.86474425751946238, 0.86551362409056898,
+  0.86628095402451299, 0.86704624551569265, 0.86780949676330321,
+  0.8685707059713409, 0.86932987134860673, 0.87008699110871135,
+  0.87084206347007886, 0.87159508665595109, 0.87234605889439154,
+  0.87309497841829009, 0.87384184346536675, 0.87458665227817611,
+  0.87532940310411078, 0.8760700941954066, 0.87680872380914576,
+  0.87754529020726124, 0.87827979165654146, 0.87901222642863341,
+  0.87974259280004741, 0.88047088905216075, 0.88119711347122198,
+  0.88192126434835494, 0.88264333997956279, 0.88336333866573158,
+  0.88408125871263499, 0.88479709843093779, 0.88551085613619995,
+  0.88622253014888064, 0.88693211879434208, 0.88763962040285393,
+  0.88834503330959624, 0.88904835585466457, 0.88974958638307289,
+  0.89044872324475788, 0.89114576479458318, 0.89184070939234272,
+  0.89253355540276469, 0.89322430119551532, 0.89391294514520325,
+  0.89459948563138258, 0.89528392103855758, 0.89596624975618511,
+  0.89664647017868015, 0.89732458070541832, 0.89800057974073988,
+  0.89867446569395382, 0.89934623697934146, 0.90001589201616028,
+  0.90068342922864686, 0.90134884704602203, 0.90201214390249307,
+  0.90267331823725883, 0.90333236849451182, 0.90398929312344334,
+  0.90464409057824624, 0.90529675931811882, 0.90594729780726846,
+  0.90659570451491533, 0.90724197791529593, 0.90788611648766615,
+  0.90852811871630612, 0.90916798309052227, 0.90980570810465222,
+  0.91044129225806714, 0.91107473405517625, 0.91170603200542988,
+  0.91233518462332275, 0.9129621904283981, 0.91358704794525081,
+  0.91420975570353069, 0.91483031223794609, 0.91544871608826783,
+  0.91606496579933161, 0.9166790599210427, 0.91729099700837791,
+  0.91790077562139039, 0.91850839432521225, 0.91911385169005777,
+  0.91971714629122736, 0.92031827670911048, 0.92091724152918952,
+  0.9215140393420419, 0.92210866874334507, 0.92270112833387852,
+  0.92329141671952764, 0.92387953251128674, 0.9244654743252626,
+  0.92504924078267758, 0.92563083050987272, 0.92621024213831127,
+  0.92678747430458175, 0.92736252565040111, 0.92793539482261789,
+  0.92850608047321548, 0.92907458125931575, 0.92964089584318133,
+  0.93020502289221907, 0.93076696107898371, 0.93132670908118043,
+  0.93188426558166815, 0.93243962926846236, 0.93299279883473885,
+  0.93354377297883617, 0.93409255040425887, 0.93463912981968078,
+  0.9351835099389475, 0.93572568948108037, 0.93626566717027826,
+  0.93680344173592156, 0.93733901191257496, 0.93787237643998989,
+  0.93840353406310806, 0.93893248353206449, 0.93945922360218992,
+  0.93998375303401394, 0.9405060705932683, 0.94102617505088926,
+  0.94154406518302081, 0.94205973977101731, 0.94257319760144687,
+  0.94308443746609349, 0.94359345816196039, 0.94410025849127266,
+  0.94460483726148026, 0.94510719328526061, 0.94560732538052128,
+  0.94610523237040334, 0.94660091308328353, 0.94709436635277722,
+  0.94758559101774109, 0.94807458592227623, 0.94856134991573027,
+  0.94904588185270056, 0.94952818059303667, 0.950008245001843,
+  0.9504860739494817, 0.95096166631157508, 0.95143502096900834,
+  0.95190613680793223, 0.95237501271976588, 0.95284164760119872,
+  0.95330604035419375, 0.95376818988599033, 0.95422809510910567,
+  0.95468575494133834, 0.95514116830577067, 0.95559433413077111,
+  0.95604525134999641, 0.95649391890239499, 0.95694033573220894,
+  0.95738450078897586, 0.95782641302753291, 0.95826607140801767,
+  0.9587034748958716, 0.95913862246184189, 0.95957151308198452,
+  0.96000214573766585, 0.96043051941556579, 0.96085663310767966,
+  0.96128048581132064, 0.96170207652912254, 0.96212140426904158,
+  0.96253846804435916, 0.96295326687368388, 0.96336579978095405,
+  0.96377606579543984, 0.96418406395174572, 0.96458979328981265,
+  0.96499325285492032, 0.9653944416976894, 0.96579335887408357,
+  0.96619000344541262, 0.96658437447833312, 0.96697647104485207,
+  0.96736629222232851, 0.96775383709347551, 0.96813910474636233,
+  0.96852209427441727, 0.96890280477642887, 0.96928123535654853,
+  0.96965738512429245, 0.97003125319454397, 0.9704028386875555,
+  0.97077214072895035, 0.97113915844972509, 0.97150389098625178,
+  0.9718663374802794, 0.97222649707893627, 0.97258436893473221,
+  0.97293995220556007, 0.97329324605469825, 0.97364424965081187,
+  0.97399296216795583, 0.97433938278557586, 0.97468351068851067,
+  0.97502534506699412, 0.97536488511665687, 0.97570213003852857,
+  0.97603707903903902, 0.97636973133002114, 0.97670008612871184,
+  0.97702814265775439, 0.97735390014519996, 0.97767735782450993,
+  0.97799851493455714, 0.97831737071962765, 0.9786339244294231,
+  0.9789481753190622, 0.97926012264908202, 0.97956976568544052,
+  0.97987710369951764, 0.98018213596811732, 0.98048486177346938,
+  0.98078528040323043, 0.98108339115048659, 0.98137919331375456,
+  0.98167268619698311, 0.98196386910955524, 0.98225274136628937,
+  0.98253930228744124, 0.98282355119870524, 0.98310548743121629,
+  0.98338511032155118, 0.98366241921173025, 0.98393741344921892,
+  0.98421009238692903, 0.98448045538322093, 0.98474850180190421,
+  0.98501423101223984, 0.98527764238894122, 0.98553873531217606,
+  0.98579750916756737, 0.98605396334619544, 0.98630809724459867,
+  0.98655991026477541, 0.98680940181418542, 0.98705657130575097,
+  0.98730141815785843, 0.98754394179435923, 0.98778414164457218,
+  0.98802201714328353, 0.98825756773074946, 0.98849079285269659,
+  0.98872169196032378, 0.98895026451030299, 0.98917650996478101,
+  0.98940042779138038, 0.98962201746320078, 0.98984127845882053,
+  0.99005821026229712, 0.99027281236316911, 0.99048508425645698,
+  0.99069502544266463, 0.99090263542778001, 0.99110791372327678,
+  0.99131085984611544, 0.9915114733187439, 0.99170975366909953,
+  0.99190570043060933, 0.9920993131421918, 0.99229059134825737,
+  0.99247953459870997, 0.99266614244894802, 0.9928504144598651,
+  0.99303235019785141, 0.9932119492347945, 0.99338921114808065,
+  0.9935641355205953, 0.9937367219407246, 0.99390697000235606,
+  0.99407487930487937, 0.9942404494531879, 0.9944036800576791,
+  0.99456457073425542, 0.9947231211043257, 0.99487933079480562,
+  0.99503319943811863, 0.99518472667219682, 0.99533391214048228,
+  0.99548075549192694, 0.99562525638099431, 0.99576741446765982,
+  0.99590722941741172, 0.99604470090125197, 0.99617982859569687,
+  0.996312612182778, 0.99644305135004263, 0.99657114579055484,
+  0.99669689520289606, 0.99682029929116567, 0.99694135776498216,
+  0.99706007033948296, 0.99717643673532619, 0.99729045667869021,
+  0.9974021299012753, 0.99751145614030345, 0.99761843513851955,
+  0.99772306664419164, 0.99782535041111164, 0.997925286198596,
+  0.99802287377148624, 0.99811811290014918, 0.99821100336047819,
+  0.99830154493389289, 0.99838973740734016, 0.99847558057329477,
+  0.99855907422975931, 0.99864021818026527, 0.99871901223387294,
+  0.99879545620517241, 0.99886954991428356, 0.99894129318685687,
+  0.99901068585407338, 0.99907772775264536, 0.99914241872481691,
+  0.99920475861836389, 0.99926474728659442, 0.99932238458834954,
+  0.99937767038800285, 0.99943060455546173, 0.99948118696616695,
+  0.99952941750109314, 0.99957529604674922, 0.99961882249517864,
+  0.99965999674395922, 0.99969881869620425, 0.99973528826056168,
+  0.99976940535121528, 0.99980116988788426, 0.9998305817958234,
+  0.99985764100582386, 0.99988234745421256, 0.9999047010828529,
+  0.9999247018391445, 0.99994234967602391, 0.9999576445519639,
+  0.99997058643097414, 0.99998117528260111, 0.9999894110819284,
+  0.99999529380957619, 0.99999882345170188, 1
+};
+
+static const double fft_static_sin_8192[10241] =
+{
+  0, 0.00076699031874270449, 0.0015339801862847655,
+  0.002300969151425805, 0.0030679567629659761, 0.0038349425697062275,
+  0.0046019261204485705, 0.0053689069639963425, 0.0061358846491544753,
+  0.0069028587247297558, 0.007669828739531097, 0.0084367942423697988,
+  0.0092037547820598194, 0.0099707099074180308, 0.010737659167264491,
+  0.011504602110422714, 0.012271538285719925, 0.013038467241987334,
+  0.013805388528060391, 0.014572301692779064, 0.0153392062849881,
+  0.016106101853537287, 0.01687298794728171, 0.017639864115082053,
+  0.01840672990580482, 0.019173584868322623, 0.019940428551514441,
+  0.020707260504265895, 0.021474080275469508, 0.022240887414024961,
+  0.023007681468839369, 0.023774461988827555, 0.024541228522912288,
+  0.025307980620024571, 0.026074717829103901, 0.026841439699098531,
+  0.02760814577896574, 0.028374835617672099, 0.029141508764193722,
+  0.029908164767516555, 0.030674803176636626, 0.031441423540560301,
+  0.032208025408304586, 0.032974608328897335, 0.03374117185137758,
+  0.03450771552479575, 0.035274238898213947, 0.036040741520706229,
+  0.036807222941358832, 0.037573682709270494, 0.038340120373552694,
+  0.039106535483329888, 0.039872927587739811, 0.040639296235933736,
+  0.041405640977076739, 0.042171961360347947, 0.04293825693494082,
+  0.043704527250063421, 0.044470771854938668, 0.04523699029880459,
+  0.046003182130914623, 0.046769346900537863, 0.047535484156959303,
+  0.048301593449480144, 0.049067674327418015, 0.049833726340107277,
+  0.050599749036899282, 0.051365741967162593, 0.052131704680283324,
+  0.052897636725665324, 0.05366353765273052, 0.054429407010919133,
+  0.055195244349689934, 0.055961049218520569, 0.056726821166907748,
+  0.057492559744367566, 0.058258264500435752, 0.059023934984667931,
+  0.059789570746639868, 0.060555171335947788, 0.061320736302208578,
+  0.062086265195060088, 0.062851757564161406, 0.063617212959193106,
+  0.064382630929857465, 0.065148011025878833, 0.065913352797003805,
+  0.066678655793001557, 0.067443919563664051, 0.068209143658806329,
+  0.068974327628266746, 0.069739471021907307, 0.070504573389613856,
+  0.071269634281296401, 0.072034653246889332, 0.072799629836351673,
+  0.073564563599667426, 0.074329454086845756, 0.075094300847921305,
+  0.075859103432954447, 0.076623861392031492, 0.077388574275265049,
+  0.078153241632794232, 0.078917863014784942, 0.079682437971430126,
+  0.080446966052950014, 0.081211446809592441, 0.081975879791633066,
+  0.082740264549375692, 0.083504600633152432, 0.084268887593324071,
+  0.085033124980280275, 0.085797312344439894, 0.08656144923625117,
+  0.087325535206192059, 0.088089569804770507, 0.0888535525825246,
+  0.089617483090022959, 0.090381360877864983, 0.091145185496681005,
+  0.091908956497132724, 0.09267267342991331, 0.093436335845747787,
+  0.094199943295393204, 0.094963495329638992, 0.095726991499307162,
+  0.096490431355252593, 0.097253814448363271, 0.098017140329560604,
+  0.098780408549799623, 0.099543618660069319, 0.10030677021139286,
+  0.10106986275482782, 0.10183289584146653, 0.10259586902243628,
+  0.10335878184889961, 0.10412163387205459, 0.10488442464313497,
+  0.10564715371341062, 0.10640982063418768, 0.10717242495680884,
+  0.10793496623265365, 0.10869744401313872, 0.10945985784971798,
+  0.11022220729388306, 0.11098449189716339, 0.11174671121112659,
+  0.11250886478737869, 0.11327095217756435, 0.1140329729333672,
+  0.11479492660651008, 0.11555681274875526, 0.11631863091190475,
+  0.11708038064780059, 0.11784206150832498, 0.11860367304540072,
+  0.11936521481099135, 0.1201266863571015, 0.12088808723577708,
+  0.12164941699910553, 0.1224106751992162, 0.12317186138828048,
+  0.12393297511851216, 0.12469401594216764, 0.12545498341154623,
+  0.12621587707899035, 0.12697669649688587, 0.12773744121766231,
+  0.12849811079379317, 0.12925870477779614, 0.13001922272223335,
+  0.13077966417971171, 0.13154002870288312, 0.13230031584444465,
+  0.13306052515713906, 0.13382065619375472, 0.13458070850712617,
+  0.13534068165013421, 0.1361005751757062, 0.13686038863681638,
+  0.13762012158648604, 0.13837977357778389, 0.1391393441638262,
+  0.13989883289777721, 0.14065823933284921, 0.14141756302230302,
+  0.14217680351944803, 0.14293596037764267, 0.14369503315029447,
+  0.14445402139086047, 0.14521292465284746, 0.14597174248981221,
+  0.14673047445536175, 0.14748912010315357, 0.14824767898689603,
+  0.14900615066034845, 0.14976453467732151, 0.1505228305916774,
+  0.15128103795733022, 0.15203915632824605, 0.15279718525844344,
+  0.15355512430199345, 0.1543129730130201, 0.15507073094570051,
+  0.15582839765426523, 0.15658597269299843, 0.15734345561623825,
+  0.15810084597837698, 0.15885814333386145, 0.15961534723719306,
+  0.16037245724292828, 0.16112947290567881, 0.16188639378011183,
+  0.16264321942095031, 0.16339994938297323, 0.16415658322101581,
+  0.16491312048996992, 0.16566956074478412, 0.1664259035404641,
+  0.16718214843207294, 0.16793829497473117, 0.16869434272361733,
+  0.16945029123396796, 0.17020614006107807, 0.17096188876030122,
+  0.17171753688704997, 0.17247308399679595, 0.17322852964507032,
+  0.17398387338746382, 0.1747391147796272, 0.17549425337727143,
+  0.17624928873616791, 0.17700422041214875, 0.17775904796110717,
+  0.17851377093899751, 0.17926838890183575, 0.18002290140569951,
+  0.18077730800672859, 0.18153160826112497, 0.1822858017251533,
+  0.18303988795514095, 0.18379386650747845, 0.18454773693861962,
+  0.1853014988050819, 0.18605515166344663, 0.18680869507035927,
+  0.1875621285825296, 0.18831545175673212, 0.18906866414980619,
+  0.18982176531865641, 0.19057475482025274, 0.1913276322116309,
+  0.19208039704989244, 0.19283304889220523, 0.19358558729580361,
+  0.1943380118179886, 0.19509032201612825, 0.19584251744765785,
+  0.19659459767008022, 0.19734656224096592, 0.19809841071795356,
+  0.19885014265875009, 0.19960175762113097, 0.20035325516294045,
+  0.2011046348420919, 0.20185589621656805, 0.20260703884442113,
+  0.20335806228377332, 0.20410896609281687, 0.20485974982981442,
+  0.20561041305309924, 0.20636095532107551, 0.20711137619221856,
+  0.20786167522507507, 0.20861185197826349, 0.20936190601047416,
+  0.21011183688046961, 0.21086164414708486, 0.21161132736922755,
+  0.21236088610587842, 0.21311031991609136, 0.21385962835899375,
+  0.21460881099378676, 0.21535786737974555, 0.21610679707621952,
+  0.21685559964263262, 0.21760427463848364, 0.21835282162334632,
+  0.2191012401568698, 0.2198495297987787, 0.22059769010887351,
+  0.22134572064703081, 0.22209362097320351, 0.22284139064742112,
+  0.22358902922978999, 0.2243365362804936, 0.22508391135979283,
+  0.22583115402802617, 0.22657826384561, 0.22732524037303886,
+  0.22807208317088573, 0.22881879179980222, 0.22956536582051887,
+  0.23031180479384544, 0.23105810828067111, 0.23180427584196478,
+  0.23255030703877524, 0.23329620143223159, 0.23404195858354343,
+  0.23478757805400097, 0.23553305940497549, 0.23627840219791957,
+  0.2370236059943672, 0.23776867035593419, 0.23851359484431842,
+  0.23925837902129998, 0.2400030224487415, 0.24074752468858843,
+  0.24149188530286933, 0.24223610385369601, 0.24298017990326387,
+  0.24372411301385216, 0.24446790274782415, 0.24521154866762754,
+  0.24595505033579459, 0.24669840731494241, 0.24744161916777327,
+  0.24818468545707478, 0.24892760574572015, 0.24967037959666855,
+  0.25041300657296522, 0.25115548623774192, 0.25189781815421697,
+  0.25264000188569552, 0.25338203699557016, 0.25412392304732062,
+  0.25486565960451457, 0.25560724623080738, 0.25634868248994291,
+  0.25708996794575312, 0.25783110216215899, 0.25857208470317034,
+  0.25931291513288623, 0.26005359301549519, 0.26079411791527551,
+  0.26153448939659552, 0.26227470702391359, 0.263014770361779,
+  0.26375467897483135, 0.26449443242780163, 0.26523403028551179,
+  0.26597347211287559, 0.26671275747489837, 0.26745188593667762,
+  0.26819085706340318, 0.26892967042035726, 0.26966832557291509,
+  0.27040682208654482, 0.27114515952680801, 0.27188333745935972,
+  0.27262135544994898, 0.27335921306441868, 0.27409690986870638,
+  0.27483444542884394, 0.27557181931095814, 0.27630903108127108,
+  0.2770460803060999, 0.27778296655185769, 0.27851968938505306,
+  0.27925624837229118, 0.27999264308027322, 0.28072887307579719,
+  0.28146493792575794, 0.28220083719714756, 0.28293657045705539,
+  0.28367213727266843, 0.28440753721127188, 0.28514276984024867,
+  0.28587783472708062, 0.28661273143934779, 0.28734745954472951,
+  0.28808201861100413, 0.28881640820604948, 0.28955062789784303,
+  0.29028467725446233, 0.29101855584408509, 0.29175226323498926,
+  0.29248579899555388, 0.29321916269425863, 0.29395235389968466,
+  0.29468537218051433, 0.29541821710553201, 0.29615088824362379,
+  0.29688338516377827, 0.2976157074350862, 0.2983478546267414,
+  0.29907982630804048, 0.29981162204838335, 0.30054324141727345,
+  0.30127468398431795, 0.30200594931922808, 0.30273703699181914,
+  0.30346794657201132, 0.30419867762982911, 0.30492922973540237,
+  0.30565960245896612, 0.30638979537086092, 0.3071198080415331,
+  0.30784964004153487, 0.30857929094152509, 0.30930876031226873,
+  0.31003804772463789, 0.31076715274961147, 0.31149607495827591,
+  0.31222481392182488, 0.3129533692115602, 0.31368174039889152,
+  0.31440992705533666, 0.31513792875252244, 0.31586574506218396,
+  0.31659337555616585, 0.31732081980642174, 0.31804807738501495,
+  0.31877514786411848, 0.31950203081601569, 0.32022872581309986,
+  0.32095523242787521, 0.32168155023295658, 0.32240767880106985,
+  0.32313361770505233, 0.32385936651785285, 0.32458492481253215,
+  0.32531029216226293, 0.32603546814033024, 0.32676045232013173,
+  0.327485244275178, 0.3282098435790925, 0.3289342498056122,
+  0.32965846252858749, 0.33038248132198278, 0.33110630575987643,
+  0.33182993541646111, 0.33255336986604422, 0.33327660868304793,
+  0.33399965144200938, 0.33472249771758122, 0.3354451470845316,
+  0.33616759911774452, 0.33688985339222005, 0.33761190948307462,
+  0.33833376696554113, 0.33905542541496964, 0.33977688440682685,
+  0.34049814351669716, 0.34121920232028236, 0.34194006039340219,
+  0.34266071731199438, 0.34338117265211504, 0.34410142598993881,
+  0.34482147690175929, 0.34554132496398909, 0.34626096975316001,
+  0.34698041084592368, 0.34769964781905138, 0.34841868024943456,
+  0.34913750771408497, 0.34985612979013492, 0.35057454605483751,
+  0.35129275608556709, 0.35201075945981908, 0.35272855575521073,
+  0.35344614454948081, 0.35416352542049034, 0.35488069794622279,
+  0.35559766170478385, 0.35631441627440241, 0.35703096123342998,
+  0.3577472961603419, 0.35846342063373654, 0.3591793342323365,
+  0.35989503653498811, 0.36061052712066227, 0.36132580556845428,
+  0.36204087145758418, 0.36275572436739723, 0.36347036387736376,
+  0.36418478956707989, 0.36489900101626732, 0.36561299780477385,
+  0.36632677951257359, 0.36704034571976718, 0.36775369600658198,
+  0.36846682995337232, 0.36917974714062002, 0.3698924471489341,
+  0.37060492955905167, 0.37131719395183754, 0.37202923990828501,
+  0.37274106700951576, 0.3734526748367803, 0.37416406297145793,
+  0.37487523099505754, 0.37558617848921722, 0.37629690503570479,
+  0.37700741021641826, 0.37771769361338564, 0.37842775480876556,
+  0.37913759338484732, 0.37984720892405116, 0.38055660100892852,
+  0.38126576922216238, 0.38197471314656722, 0.38268343236508978,
+  0.38339192646080866, 0.38410019501693504, 0.38480823761681288,
+  0.38551605384391885, 0.38622364328186298, 0.38693100551438858,
+  0.38763814012537273, 0.38834504669882625, 0.38905172481889438,
+  0.38975817406985641, 0.39046439403612659, 0.39117038430225387,
+  0.39187614445292235, 0.39258167407295147, 0.3932869727472964,
+  0.3939920400610481, 0.39469687559943356, 0.39540147894781635,
+  0.39610584969169627, 0.39680998741671031, 0.39751389170863233,
+  0.39821756215337356, 0.39892099833698291, 0.39962419984564679,
+  0.40032716626569009, 0.40102989718357562, 0.40173239218590501,
+  0.40243465085941843, 0.4031366727909953, 0.40383845756765407,
+  0.404540004776553, 0.40524131400498986, 0.40594238484040251,
+  0.40664321687036903, 0.40734380968260797, 0.40804416286497869,
+  0.40874427600548136, 0.40944414869225759, 0.41014378051359024,
+  0.41084317105790391, 0.41154231991376522, 0.41224122666988289,
+  0.41293989091510808, 0.4136383122384345, 0.4143364902289991,
+  0.41503442447608163, 0.41573211456910536, 0.41642956009763715,
+  0.41712676065138787, 0.41782371582021227, 0.4185204251941097,
+  0.41921688836322391, 0.41991310491784362, 0.42060907444840251,
+  0.42130479654547964, 0.42200027079979968, 0.42269549680223295,
+  0.42339047414379605, 0.42408520241565156, 0.42477968120910881,
+  0.4254739101156238, 0.42616788872679962, 0.42686161663438643,
+  0.42755509343028208, 0.42824831870653196, 0.42894129205532949,
+  0.42963401306901638, 0.43032648134008261, 0.43101869646116703,
+  0.43171065802505726, 0.43240236562469014, 0.43309381885315196,
+  0.43378501730367852, 0.43447596056965565, 0.43516664824461926,
+  0.43585707992225547, 0.4365472551964012, 0.43723717366104409,
+  0.43792683491032286, 0.43861623853852766, 0.43930538414009995,
+  0.43999427130963326, 0.4406828996418729, 0.44137126873171667,
+  0.4420593781742147, 0.44274722756457002, 0.44343481649813848,
+  0.4441221445704292, 0.44480921137710488, 0.44549601651398174,
+  0.44618255957703007, 0.44686884016237416, 0.44755485786629301,
+  0.44824061228521989, 0.44892610301574326, 0.44961132965460654,
+  0.45029629179870861, 0.45098098904510386, 0.45166542099100249,
+  0.45234958723377089, 0.45303348737093158, 0.45371712100016387,
+  0.45440048771930358, 0.45508358712634384, 0.45576641881943464,
+  0.45644898239688392, 0.45713127745715698, 0.45781330359887717,
+  0.45849506042082627, 0.45917654752194409, 0.45985776450132954,
+  0.46053871095824001, 0.46121938649209238, 0.46189979070246273,
+  0.46257992318908681, 0.46325978355186015, 0.46393937139083852,
+  0.46461868630623782, 0.4652977278984346, 0.46597649576796618,
+  0.46665498951553092, 0.46733320874198842, 0.46801115304835983,
+  0.4686888220358279, 0.46936621530573752, 0.47004333245959562,
+  0.4707201730990716, 0.47139673682599764, 0.47207302324236866,
+  0.47274903195034279, 0.47342476255224153, 0.47410021465054997,
+  0.47477538784791712, 0.47545028174715587, 0.47612489595124358,
+  0.47679923006332209, 0.47747328368669806, 0.47814705642484301,
+  0.47882054788139389, 0.47949375766015301, 0.48016668536508839,
+  0.48083933060033396, 0.48151169297018986, 0.48218377207912272,
+  0.48285556753176567, 0.48352707893291874, 0.48419830588754903,
+  0.48486924800079106, 0.48553990487794696, 0.48621027612448642,
+  0.48688036134604734, 0.487550160148436, 0.48821967213762679,
+  0.48888889691976317, 0.48955783410115744, 0.49022648328829116,
+  0.49089484408781509, 0.4915629161065499, 0.49223069895148602,
+  0.49289819222978404, 0.49356539554877477, 0.49423230851595967,
+  0.49489893073901126, 0.49556526182577254, 0.49623130138425825,
+  0.49689704902265447, 0.49756250434931915, 0.49822766697278187,
+  0.49889253650174459, 0.49955711254508184, 0.50022139471184068,
+  0.50088538261124071, 0.50154907585267539, 0.50221247404571079,
+  0.50287557680008699, 0.50353838372571758, 0.50420089443269034,
+  0.50486310853126759, 0.50552502563188539, 0.50618664534515523,
+  0.50684796728186321, 0.50750899105297087, 0.5081697162696146,
+  0.50883014254310699, 0.50949026948493636, 0.51015009670676681,
+  0.51080962382043904, 0.5114688504379703, 0.51212777617155469,
+  0.51278640063356296, 0.51344472343654346, 0.51410274419322166,
+  0.5147604625165012, 0.51541787801946293, 0.51607499031536663,
+  0.51673179901764987, 0.51738830373992906, 0.51804450409599934,
+  0.51870039969983495, 0.51935599016558964, 0.52001127510759604,
+  0.52066625414036716, 0.52132092687859566, 0.52197529293715439,
+  0.52262935193109661, 0.52328310347565643, 0.5239365471862486,
+  0.52458968267846895, 0.52524250956809471, 0.52589502747108463,
+  0.52654723600357944, 0.52719913478190128, 0.52785072342255523,
+  0.52850200154222848, 0.52915296875779061, 0.52980362468629461,
+  0.53045396894497632, 0.531104001151255, 0.53175372092273332,
+  0.5324031278771979, 0.53305222163261945, 0.53370100180715296,
+  0.53434946801913752, 0.53499761988709715, 0.53564545702974109,
+  0.53629297906596318, 0.53694018561484291, 0.53758707629564539,
+  0.5382336507278217, 0.53887990853100842, 0.53952584932502889,
+  0.54017147272989285, 0.54081677836579667, 0.54146176585312344,
+  0.54210643481244392, 0.54275078486451589, 0.5433948156302848,
+  0.54403852673088382, 0.54468191778763453, 0.54532498842204646,
+  0.54596773825581757, 0.54661016691083486, 0.54725227400917409,
+  0.54789405917310019, 0.54853552202506739, 0.54917666218771966,
+  0.54981747928389091, 0.55045797293660481, 0.55109814276907543,
+  0.55173798840470734, 0.55237750946709607, 0.55301670558002747,
+  0.55365557636747931, 0.55429412145362, 0.55493234046281037,
+  0.55557023301960218, 0.55620779874873993, 0.5568450372751601,
+  0.55748194822399155, 0.5581185312205561, 0.55875478589036831,
+  0.55939071185913614, 0.56002630875276038, 0.56066157619733603,
+  0.56129651381915147, 0.56193112124468947, 0.56256539810062656,
+  0.56319934401383409, 0.56383295861137817, 0.5644662415205195,
+  0.56509919236871398, 0.56573181078361312, 0.56636409639306384,
+  0.56699604882510868, 0.56762766770798623, 0.56825895267013149,
+  0.56888990334017586, 0.56952051934694714, 0.5701508003194703,
+  0.57078074588696726, 0.57141035567885723, 0.57203962932475705,
+  0.57266856645448116, 0.5732971666980422, 0.57392542968565075,
+  0.57455335504771576, 0.57518094241484508, 0.57580819141784534,
+  0.57643510168772183, 0.57706167285567944, 0.5776879045531228,
+  0.57831379641165559, 0.57893934806308178, 0.57956455913940563,
+  0.58018942927283168, 0.58081395809576453, 0.58143814524081017,
+  0.58206199034077544, 0.58268549302866846, 0.58330865293769829,
+  0.58393146970127618, 0.58455394295301533, 0.58517607232673041,
+  0.58579785745643886, 0.5864192979763605, 0.58704039352091797,
+  0.58766114372473666, 0.58828154822264522, 0.58890160664967572,
+  0.58952131864106394, 0.59014068383224882, 0.59075970185887416,
+  0.59137837235678758, 0.59199669496204099, 0.59261466931089113,
+  0.5932322950397998, 0.59384957178543363, 0.59446649918466443,
+  0.59508307687456996, 0.59569930449243336, 0.59631518167574371,
+  0.5969307080621965, 0.59754588328969316, 0.59816070699634227,
+  0.59877517882045872, 0.59938929840056454, 0.60000306537538894,
+  0.60061647938386897, 0.6012295400651485, 0.60184224705858003,
+  0.60245460000372375, 0.60306659854034816, 0.60367824230843037,
+  0.60428953094815596, 0.60490046409991982, 0.60551104140432555,
+  0.60612126250218612, 0.60673112703452448, 0.60734063464257293,
+  0.60794978496777363, 0.60855857765177945, 0.60916701233645321,
+  0.60977508866386843, 0.61038280627630948, 0.61099016481627166,
+  0.61159716392646191, 0.61220380324979795, 0.61281008242940971,
+  0.61341600110863859, 0.61402155893103838, 0.61462675554037505,
+  0.61523159058062682, 0.61583606369598509, 0.61644017453085365,
+  0.61704392272984976, 0.61764730793780387, 0.61825032979976025,
+  0.61885298796097632, 0.61945528206692402, 0.6200572117632891,
+  0.62065877669597214, 0.62125997651108755, 0.62186081085496536,
+  0.62246127937414997, 0.62306138171540126, 0.62366111752569453,
+  0.62426048645222065, 0.62485948814238634, 0.62545812224381436,
+  0.62605638840434352, 0.62665428627202935, 0.62725181549514408,
+  0.62784897572217646, 0.62844576660183271, 0.629042187783036,
+  0.62963823891492698, 0.63023391964686437, 0.63082922962842447,
+  0.63142416850940186, 0.63201873593980906, 0.63261293156987741,
+  0.63320675505005719, 0.63380020603101728, 0.63439328416364549,
+  0.63498598909904946, 0.63557832048855611, 0.63617027798371217,
+  0.6367618612362842, 0.63735306989825913, 0.63794390362184406,
+  0.63853436205946679, 0.63912444486377573, 0.63971415168764045,
+  0.64030348218415167, 0.64089243600662138, 0.64148101280858316,
+  0.64206921224379254, 0.64265703396622686, 0.64324447763008585,
+  0.64383154288979139, 0.64441822939998838, 0.64500453681554393,
+  0.64559046479154869, 0.64617601298331628, 0.64676118104638392,
+  0.64734596863651206, 0.64793037540968534, 0.64851440102211244,
+  0.64909804513022595, 0.64968130739068319, 0.65026418746036585,
+  0.65084668499638088, 0.65142879965605982, 0.6520105310969595,
+  0.65259187897686244, 0.65317284295377676, 0.65375342268593606,
+  0.65433361783180044, 0.65491342805005603, 0.65549285299961535,
+  0.6560718923396176, 0.65665054572942894, 0.65722881282864254,
+  0.65780669329707864, 0.65838418679478505, 0.65896129298203732,
+  0.65953801151933866, 0.66011434206742048, 0.6606902842872423,
+  0.66126583783999227, 0.66184100238708687, 0.66241577759017178,
+  0.66299016311112147, 0.66356415861203977, 0.66413776375526001,
+  0.66471097820334479, 0.66528380161908718, 0.66585623366550972,
+  0.66642827400586524, 0.66699992230363747, 0.66757117822254031,
+  0.66814204142651845, 0.66871251157974798, 0.66928258834663601,
+  0.66985227139182102, 0.67042156038017309, 0.67099045497679422,
+  0.67155895484701833, 0.67212705965641173, 0.67269476907077286,
+  0.67326208275613297, 0.67382900037875604, 0.67439552160513905,
+  0.67496164610201193, 0.67552737353633852, 0.67609270357531592,
+  0.67665763588637495, 0.67722217013718033, 0.6777863059956315,
+  0.67835004312986147, 0.67891338120823841, 0.67947631989936497,
+  0.68003885887207893, 0.68060099779545302, 0.68116273633879543,
+  0.68172407417164971, 0.68228501096379557, 0.68284554638524808,
+  0.68340568010625868, 0.6839654117973154, 0.6845247411291423,
+  0.68508366777270036, 0.68564219139918747, 0.68620031168003859,
+  0.68675802828692589, 0.68731534089175905, 0.68787224916668555,
+  0.68842875278409044, 0.68898485141659704, 0.68954054473706683,
+  0.69009583241859995, 0.6906507141345346, 0.69120518955844845,
+  0.69175925836415775, 0.69231292022571822, 0.69286617481742463,
+  0.69341902181381176, 0.693971460889654, 0.69452349171996552,
+  0.69507511398000088, 0.69562632734525487, 0.69617713149146299,
+  0.6967275260946012, 0.69727751083088652, 0.69782708537677729,
+  0.69837624940897292, 0.69892500260441415, 0.69947334464028377,
+  0.70002127519400625, 0.70056879394324834, 0.70111590056591866,
+  0.70166259474016845, 0.70220887614439187, 0.7027547444572253,
+  0.70330019935754873, 0.70384524052448494, 0.70438986763740041,
+  0.70493408037590488, 0.7054778784198521, 0.70602126144933974,
+  0.70656422914470951, 0.70710678118654746, 0.70764891725568435,
+  0.70819063703319529, 0.70873194020040065, 0.70927282643886558,
+  0.70981329543040084, 0.71035334685706231, 0.71089298040115168,
+  0.71143219574521643, 0.71197099257204999, 0.71250937056469232,
+  0.71304732940642923, 0.71358486878079352, 0.71412198837156471,
+  0.71465868786276898, 0.71519496693868001, 0.71573082528381859,
+  0.71626626258295312, 0.71680127852109954, 0.71733587278352173,
+  0.71787004505573171, 0.71840379502348972, 0.71893712237280438,
+  0.71947002678993299, 0.72000250796138165, 0.72053456557390527,
+  0.72106619931450811, 0.72159740887044366, 0.72212819392921535,
+  0.72265855417857561, 0.72318848930652735, 0.72371799900132339,
+  0.72424708295146689, 0.72477574084571128, 0.72530397237306066,
+  0.72583177722277037, 0.72635915508434601, 0.72688610564754497,
+  0.72741262860237577, 0.72793872363909862, 0.7284643904482252,
+  0.72898962872051931, 0.7295144381469969, 0.73003881841892615,
+  0.73056276922782759, 0.73108629026547423, 0.73160938122389252,
+  0.73213204179536129, 0.73265427167241282, 0.73317607054783274,
+  0.73369743811466026, 0.73421837406618817, 0.73473887809596339,
+  0.73525894989778673, 0.73577858916571348, 0.73629779559405306,
+  0.73681656887736979, 0.73733490871048279, 0.73785281478846598,
+  0.73837028680664851, 0.73888732446061511, 0.73940392744620576,
+  0.73992009545951609, 0.74043582819689802, 0.74095112535495911,
+  0.74146598663056329, 0.74198041172083096, 0.74249440032313918,
+  0.74300795213512172, 0.74352106685466912, 0.74403374417992918,
+  0.74454598380930725, 0.74505778544146595, 0.74556914877532543,
+  0.74608007351006378, 0.74659055934511731, 0.74710060598018013,
+  0.74761021311520515, 0.74811938045040349, 0.74862810768624533,
+  0.74913639452345926, 0.74964424066303348, 0.75015164580621496,
+  0.75065860965451059, 0.75116513190968637, 0.75167121227376843,
+  0.7521768504490427, 0.75268204613805523, 0.75318679904361241,
+  0.75369110886878121, 0.75419497531688917, 0.75469839809152439,
+  0.75520137689653655, 0.75570391143603588, 0.75620600141439454,
+  0.75670764653624567, 0.75720884650648446, 0.75770960103026808,
+  0.75820990981301528, 0.75870977256040739, 0.75920918897838796,
+  0.75970815877316344, 0.76020668165120242, 0.76070475731923692,
+  0.76120238548426178, 0.76169956585353527, 0.7621962981345789,
+  0.76269258203517787, 0.76318841726338127, 0.76368380352750187,
+  0.76417874053611667, 0.76467322799806714, 0.76516726562245896,
+  0.76566085311866239, 0.76615399019631281, 0.76664667656531038,
+  0.7671389119358204, 0.76763069601827327, 0.76812202852336531,
+  0.76861290916205827, 0.76910333764557959, 0.76959331368542294,
+  0.7700828369933479, 0.7705719072813807, 0.77106052426181371,
+  0.7715486876472063, 0.77203639715038441, 0.77252365248444133,
+  0.77301045336273699, 0.77349679949889905, 0.77398269060682279,
+  0.77446812640067086, 0.77495310659487382, 0.77543763090413043,
+  0.77592169904340758, 0.77640531072794039, 0.77688846567323244,
+  0.7773711635950562, 0.77785340420945304, 0.77833518723273309,
+  0.77881651238147587, 0.7792973793725303, 0.77977778792301444,
+  0.78025773775031659, 0.78073722857209438, 0.78121626010627609,
+  0.78169483207105939, 0.7821729441849129, 0.78265059616657573,
+  0.78312778773505731, 0.7836045186096382, 0.78408078850986995,
+  0.78455659715557524, 0.78503194426684808, 0.78550682956405393,
+  0.78598125276783015, 0.78645521359908577, 0.7869287117790017,
+  0.78740174702903132, 0.78787431907090011, 0.78834642762660623,
+  0.78881807241842017, 0.78928925316888565, 0.78975996960081907,
+  0.79023022143731003, 0.79070000840172161, 0.79116933021769009,
+  0.79163818660912577, 0.79210657730021239, 0.79257450201540758,
+  0.79304196047944364, 0.79350895241732666, 0.79397547755433717,
+  0.79444153561603059, 0.79490712632823701, 0.79537224941706119,
+  0.79583690460888346, 0.79630109163035911, 0.79676481020841872,
+  0.7972280600702687, 0.79769084094339104, 0.79815315255554375,
+  0.79861499463476082, 0.79907636690935235, 0.79953726910790501,
+  0.79999770095928191, 0.80045766219262271, 0.8009171525373443,
+  0.80137617172314013, 0.80183471947998131, 0.80229279553811572,
+  0.80275039962806916, 0.80320753148064483, 0.80366419082692409,
+  0.8041203773982657, 0.804576090926307, 0.80503133114296366,
+  0.80548609778042912, 0.80594039057117628, 0.80639420924795624,
+  0.80684755354379922, 0.80730042319201445, 0.80775281792619036,
+  0.80820473748019472, 0.80865618158817498, 0.80910714998455813,
+  0.80955764240405126, 0.81000765858164114, 0.81045719825259477,
+  0.81090626115245967, 0.81135484701706373, 0.81180295558251536,
+  0.81225058658520388, 0.81269773976179949, 0.81314441484925359,
+  0.81359061158479851, 0.8140363297059483, 0.81448156895049861,
+  0.81492632905652662, 0.81537060976239129, 0.81581441080673378,
+  0.81625773192847739, 0.81670057286682785, 0.81714293336127297,
+  0.81758481315158371, 0.81802621197781344, 0.81846712958029866,
+  0.81890756569965895, 0.8193475200767969, 0.81978699245289899,
+  0.82022598256943469, 0.82066449016815746, 0.82110251499110465,
+  0.82154005678059761, 0.82197711527924155, 0.82241369022992639,
+  0.82284978137582632, 0.82328538846040011, 0.82372051122739132,
+  0.82415514942082857, 0.82458930278502529, 0.82502297106458022,
+  0.82545615400437744, 0.82588885134958678, 0.82632106284566342,
+  0.82675278823834852, 0.82718402727366902, 0.8276147796979384,
+  0.8280450452577558, 0.82847482370000713, 0.82890411477186487,
+  0.82933291822078825, 0.82976123379452305, 0.83018906124110237,
+  0.8306164003088462, 0.83104325074636232, 0.83146961230254524,
+  0.83189548472657759, 0.83232086776792968, 0.83274576117635946,
+  0.83317016470191319, 0.83359407809492514, 0.83401750110601813,
+  0.83444043348610319, 0.83486287498638001, 0.83528482535833737,
+  0.8357062843537526, 0.83612725172469216, 0.83654772722351189,
+  0.83696771060285702, 0.83738720161566194, 0.83780620001515094,
+  0.83822470555483797, 0.8386427179885273, 0.83906023707031263,
+  0.83947726255457855, 0.83989379419599941, 0.84030983174954077,
+  0.84072537497045807, 0.84114042361429808, 0.84155497743689833,
+  0.84196903619438768, 0.84238259964318596, 0.84279566754000412,
+  0.84320823964184544, 0.84362031570600404, 0.84403189549006641,
+  0.84444297875191066, 0.84485356524970701, 0.84526365474191822,
+  0.84567324698729907, 0.84608234174489694, 0.84649093877405202,
+  0.84689903783439735, 0.84730663868585832, 0.84771374108865427,
+  0.84812034480329712, 0.84852644959059265, 0.84893205521163961,
+  0.84933716142783067, 0.84974176800085244, 0.85014587469268521,
+  0.85054948126560337, 0.85095258748217573, 0.8513551931052652,
+  0.85175729789802912, 0.85215890162391983, 0.85256000404668397,
+  0.85296060493036363, 0.85336070403929543, 0.8537603011381113,
+  0.85415939599173873, 0.85455798836540053, 0.85495607802461482,
+  0.85535366473519603, 0.85575074826325392, 0.85614732837519447,
+  0.85654340483771996, 0.85693897741782865, 0.85733404588281559,
+  0.85772861000027212, 0.85812266953808602, 0.85851622426444274,
+  0.8589092739478239, 0.85930181835700836, 0.85969385726107261,
+  0.86008539042939014, 0.86047641763163207, 0.86086693863776731,
+  0.86125695321806206, 0.8616464611430813, 0.86203546218368721,
+  0.8624239561110405, 0.86281194269660033, 0.86319942171212416,
+  0.86358639292966799, 0.8639728561215867, 0.86435881106053403,
+  0.86474425751946238, 0.86512919527162369, 0.86551362409056898,
+  0.86589754375014882, 0.86628095402451299, 0.86666385468811102,
+  0.86704624551569265, 0.86742812628230692, 0.86780949676330321,
+  0.86819035673433131, 0.8685707059713409, 0.86895054425058238,
+  0.86932987134860673, 0.86970868704226556, 0.87008699110871135,
+  0.87046478332539767, 0.87084206347007886, 0.8712188313208109,
+  0.87159508665595109, 0.8719708292541577, 0.87234605889439154,
+  0.8727207753559143, 0.87309497841829009, 0.87346866786138488,
+  0.87384184346536675, 0.8742145050107063, 0.87458665227817611,
+  0.87495828504885154, 0.87532940310411078, 0.8757000062256346,
+  0.8760700941954066, 0.87643966679571361, 0.87680872380914576,
+  0.87717726501859594, 0.87754529020726124, 0.87791279915864173,
+  0.87827979165654146, 0.87864626748506813, 0.87901222642863341,
+  0.87937766827195318, 0.87974259280004741, 0.88010699979824036,
+  0.88047088905216075, 0.88083426034774204, 0.88119711347122198,
+  0.88155944820914378, 0.88192126434835494, 0.8822825616760086,
+  0.88264333997956279, 0.88300359904678072, 0.88336333866573158,
+  0.88372255862478966, 0.88408125871263499, 0.8844394387182537,
+  0.88479709843093779, 0.88515423764028511, 0.88551085613619995,
+  0.88586695370889279, 0.88622253014888064, 0.88657758524698704,
+  0.88693211879434208, 0.88728613058238315, 0.88763962040285393,
+  0.88799258804780556, 0.88834503330959624, 0.88869695598089171,
+  0.88904835585466457, 0.88939923272419552, 0.88974958638307289,
+  0.89009941662519221, 0.89044872324475788, 0.89079750603628149,
+  0.89114576479458318, 0.89149349931479138, 0.89184070939234272,
+  0.89218739482298248, 0.89253355540276469, 0.89287919092805168,
+  0.89322430119551532, 0.89356888600213602, 0.89391294514520325,
+  0.89425647842231604, 0.89459948563138258, 0.89494196657062075,
+  0.89528392103855758, 0.89562534883403, 0.89596624975618511,
+  0.89630662360447966, 0.89664647017868015, 0.89698578927886397,
+  0.89732458070541832, 0.89766284425904075, 0.89800057974073988,
+  0.89833778695183419, 0.89867446569395382, 0.89901061576903907,
+  0.89934623697934146, 0.89968132912742393, 0.90001589201616028,
+  0.9003499254487356, 0.90068342922864686, 0.90101640315970233,
+  0.90134884704602203, 0.90168076069203773, 0.90201214390249307,
+  0.9023429964824442, 0.90267331823725883, 0.90300310897261704,
+  0.90333236849451182, 0.90366109660924798, 0.90398929312344334,
+  0.90431695784402832, 0.90464409057824624, 0.90497069113365325,
+  0.90529675931811882, 0.90562229493982516, 0.90594729780726846,
+  0.90627176772925766, 0.90659570451491533, 0.90691910797367803,
+  0.90724197791529593, 0.90756431414983252, 0.90788611648766615,
+  0.9082073847394887, 0.90852811871630612, 0.90884831822943912,
+  0.90916798309052227, 0.90948711311150543, 0.90980570810465222,
+  0.91012376788254157, 0.91044129225806714, 0.91075828104443757,
+  0.91107473405517625, 0.91139065110412232, 0.91170603200542988,
+  0.91202087657356823, 0.91233518462332275, 0.9126489559697939,
+  0.9129621904283981, 0.91327488781486776, 0.91358704794525081,
+  0.91389867063591168, 0.91420975570353069, 0.91452030296510445,
+  0.91483031223794609, 0.91513978333968526, 0.91544871608826783,
+  0.91575711030195672, 0.91606496579933161, 0.91637228239928914,
+  0.9166790599210427, 0.91698529818412289, 0.91729099700837791,
+  0.91759615621397295, 0.91790077562139039, 0.9182048550514309,
+  0.91850839432521225, 0.91881139326416994, 0.91911385169005777,
+  0.91941576942494696, 0.91971714629122736, 0.92001798211160657,
+  0.92031827670911048, 0.92061802990708386, 0.92091724152918952,
+  0.92121591139940873, 0.9215140393420419, 0.92181162518170812,
+  0.92210866874334507, 0.92240516985220988, 0.92270112833387852,
+  0.92299654401424625, 0.92329141671952764, 0.92358574627625656,
+  0.92387953251128674, 0.9241727752517912, 0.9244654743252626,
+  0.92475762955951391, 0.92504924078267758, 0.9253403078232062,
+  0.92563083050987272, 0.92592080867176996, 0.92621024213831127,
+  0.92649913073923051, 0.92678747430458175, 0.9270752726647401,
+  0.92736252565040111, 0.92764923309258118, 0.92793539482261789,
+  0.92822101067216944, 0.92850608047321548, 0.92879060405805702,
+  0.92907458125931575, 0.9293580119099355, 0.92964089584318133,
+  0.92992323289263956, 0.93020502289221907, 0.93048626567614978,
+  0.93076696107898371, 0.93104710893559517, 0.93132670908118043,
+  0.93160576135125783, 0.93188426558166815, 0.93216222160857432,
+  0.93243962926846236, 0.93271648839814025, 0.93299279883473885,
+  0.93326856041571205, 0.93354377297883617, 0.93381843636221096,
+  0.93409255040425887, 0.9343661149437259, 0.93463912981968078,
+  0.93491159487151609, 0.9351835099389475, 0.93545487486201462,
+  0.93572568948108037, 0.9359959536368313, 0.93626566717027826,
+  0.9365348299227555, 0.93680344173592156, 0.93707150245175919,
+  0.93733901191257496, 0.93760596996099999, 0.93787237643998989,
+  0.93813823119282436, 0.93840353406310806, 0.93866828489477017,
+  0.93893248353206449, 0.9391961298195699, 0.93945922360218992,
+  0.93972176472515334, 0.93998375303401394, 0.94024518837465088,
+  0.9405060705932683, 0.94076639953639607, 0.94102617505088926,
+  0.94128539698392866, 0.94154406518302081, 0.94180217949599765,
+  0.94205973977101731, 0.94231674585656378, 0.94257319760144687,
+  0.94282909485480271, 0.94308443746609349, 0.94333922528510772,
+  0.94359345816196039, 0.94384713594709269, 0.94410025849127266,
+  0.94435282564559475, 0.94460483726148026, 0.94485629319067721,
+  0.94510719328526061, 0.94535753739763229, 0.94560732538052128,
+  0.94585655708698391, 0.94610523237040334, 0.94635335108449059,
+  0.94660091308328353, 0.946847918221148, 0.94709436635277722,
+  0.94734025733319194, 0.94758559101774109, 0.94783036726210101,
+  0.94807458592227623, 0.94831824685459909, 0.94856134991573027,
+  0.94880389496265838, 0.94904588185270056, 0.94928731044350201,
+  0.94952818059303667, 0.94976849215960668, 0.950008245001843,
+  0.95024743897870523, 0.9504860739494817, 0.95072414977378961,
+  0.95096166631157508, 0.95119862342311323, 0.95143502096900834,
+  0.95167085881019386, 0.95190613680793223, 0.95214085482381583,
+  0.95237501271976588, 0.95260861035803324, 0.95284164760119872,
+  0.9530741243121722, 0.95330604035419375, 0.95353739559083328,
+  0.95376818988599033, 0.95399842310389449, 0.95422809510910567,
+  0.95445720576651349, 0.95468575494133834, 0.95491374249913052,
+  0.95514116830577067, 0.95536803222747024, 0.95559433413077111,
+  0.95582007388254542, 0.95604525134999641, 0.95626986640065814,
+  0.95649391890239499, 0.95671740872340305, 0.95694033573220894,
+  0.9571626997976701, 0.95738450078897586, 0.95760573857564624,
+  0.95782641302753291, 0.9580465240148186, 0.95826607140801767,
+  0.9584850550779761, 0.9587034748958716, 0.95892133073321306,
+  0.95913862246184189, 0.95935534995393079, 0.95957151308198452,
+  0.9597871117188399, 0.96000214573766585, 0.96021661501196343,
+  0.96043051941556579, 0.96064385882263847, 0.96085663310767966,
+  0.96106884214551935, 0.96128048581132064, 0.961491563980579,
+  0.96170207652912254, 0.9619120233331121, 0.96212140426904158,
+  0.9623302192137374, 0.96253846804435916, 0.96274615063839941,
+  0.96295326687368388, 0.96315981662837136, 0.96336579978095405,
+  0.96357121621025721, 0.96377606579543984, 0.96398034841599411,
+  0.96418406395174572, 0.96438721228285429, 0.96458979328981265,
+  0.9647918068534479, 0.96499325285492032, 0.96519413117572472,
+  0.9653944416976894, 0.96559418430297683, 0.96579335887408357,
+  0.96599196529384057, 0.96619000344541262, 0.96638747321229879,
+  0.96658437447833312, 0.96678070712768327, 0.96697647104485207,
+  0.96717166611467664, 0.96736629222232851, 0.96756034925331436,
+  0.96775383709347551, 0.9679467556289878, 0.96813910474636233,
+  0.9683308843324453, 0.96852209427441727, 0.96871273445979478,
+  0.96890280477642887, 0.9690923051125061, 0.96928123535654853,
+  0.96946959539741295, 0.96965738512429245, 0.96984460442671483,
+  0.97003125319454397, 0.97021733131797916, 0.9704028386875555,
+  0.97058777519414363, 0.97077214072895035, 0.97095593518351797,
+  0.97113915844972509, 0.97132181041978616, 0.97150389098625178,
+  0.97168540004200854, 0.9718663374802794, 0.9720467031946235,
+  0.97222649707893627, 0.97240571902744977, 0.97258436893473221,
+  0.97276244669568857, 0.97293995220556007, 0.97311688535992513,
+  0.97329324605469825, 0.97346903418613095, 0.97364424965081187,
+  0.9738188923456661, 0.97399296216795583, 0.97416645901528032,
+  0.97433938278557586, 0.97451173337711572, 0.97468351068851067,
+  0.97485471461870843, 0.97502534506699412, 0.97519540193299037,
+  0.97536488511665687, 0.97553379451829136, 0.97570213003852857,
+  0.97586989157834103, 0.97603707903903902, 0.97620369232227056,
+  0.97636973133002114, 0.97653519596461447, 0.97670008612871184,
+  0.97686440172531264, 0.97702814265775439, 0.97719130882971228,
+  0.97735390014519996, 0.97751591650856928, 0.97767735782450993,
+  0.97783822399805043, 0.97799851493455714, 0.97815823053973505,
+  0.97831737071962765, 0.97847593538061683, 0.9786339244294231,
+  0.97879133777310567, 0.9789481753190622, 0.97910443697502925,
+  0.97926012264908202, 0.97941523224963478, 0.97956976568544052,
+  0.97972372286559117, 0.97987710369951764, 0.98002990809698998,
+  0.98018213596811732, 0.98033378722334796, 0.98048486177346938,
+  0.98063535952960812, 0.98078528040323043, 0.98093462430614164,
+  0.98108339115048659, 0.98123158084874973, 0.98137919331375456,
+  0.98152622845866466, 0.98167268619698311, 0.9818185664425525,
+  0.98196386910955524, 0.98210859411251361, 0.98225274136628937,
+  0.98239631078608469, 0.98253930228744124, 0.98268171578624086,
+  0.98282355119870524, 0.98296480844139644, 0.98310548743121629,
+  0.98324558808540707, 0.98338511032155118, 0.98352405405757126,
+  0.98366241921173025, 0.98380020570263149, 0.98393741344921892,
+  0.98407404237077645, 0.98421009238692903, 0.9843455634176419,
+  0.98448045538322093, 0.9846147682043126, 0.98474850180190421,
+  0.9848816560973237, 0.98501423101223984, 0.98514622646866223,
+  0.98527764238894122, 0.98540847869576842, 0.98553873531217606,
+  0.98566841216153755, 0.98579750916756737, 0.98592602625432113,
+  0.98605396334619544, 0.98618132036792827, 0.98630809724459867,
+  0.98643429390162707, 0.98655991026477541, 0.98668494626014669,
+  0.98680940181418542, 0.98693327685367771, 0.98705657130575097,
+  0.98717928509787434, 0.98730141815785843, 0.98742297041385541,
+  0.98754394179435923, 0.98766433222820571, 0.98778414164457218,
+  0.98790336997297779, 0.98802201714328353, 0.98814008308569257,
+  0.98825756773074946, 0.98837447100934128, 0.98849079285269659,
+  0.98860653319238645, 0.98872169196032378, 0.98883626908876354,
+  0.98895026451030299, 0.98906367815788154, 0.98917650996478101,
+  0.98928875986462517, 0.98940042779138038, 0.98951151367935519,
+  0.98962201746320078, 0.98973193907791057, 0.98984127845882053,
+  0.98995003554160899, 0.99005821026229712, 0.9901658025572484,
+  0.99027281236316911, 0.99037923961710816, 0.99048508425645698,
+  0.99059034621895015, 0.99069502544266463, 0.99079912186602037,
+  0.99090263542778001, 0.99100556606704937, 0.99110791372327678,
+  0.99120967833625406, 0.99131085984611544, 0.99141145819333854,
+  0.9915114733187439, 0.99161090516349537, 0.99170975366909953,
+  0.99180801877740643, 0.99190570043060933, 0.99200279857124452,
+  0.9920993131421918, 0.99219524408667392, 0.99229059134825737,
+  0.99238535487085167, 0.99247953459870997, 0.99257313047642881,
+  0.99266614244894802, 0.99275857046155114, 0.9928504144598651,
+  0.99294167438986047, 0.99303235019785141, 0.99312244183049558,
+  0.9932119492347945, 0.99330087235809328, 0.99338921114808065,
+  0.99347696555278919, 0.9935641355205953, 0.99365072100021912,
+  0.9937367219407246, 0.99382213829151966, 0.99390697000235606,
+  0.99399121702332938, 0.99407487930487937, 0.99415795679778973,
+  0.9942404494531879, 0.99432235722254581, 0.9944036800576791,
+  0.9944844179107476, 0.99456457073425542, 0.99464413848105071,
+  0.9947231211043257, 0.99480151855761711, 0.99487933079480562,
+  0.99495655777011638, 0.99503319943811863, 0.99510925575372611,
+  0.99518472667219682, 0.99525961214913339, 0.99533391214048228,
+  0.9954076266025349, 0.99548075549192694, 0.99555329876563847,
+  0.99562525638099431, 0.99569662829566352, 0.99576741446765982,
+  0.99583761485534161, 0.99590722941741172, 0.99597625811291779,
+  0.99604470090125197, 0.99611255774215113, 0.99617982859569687,
+  0.99624651342231552, 0.996312612182778, 0.99637812483820021,
+  0.99644305135004263, 0.99650739168011082, 0.99657114579055484,
+  0.9966343136438699, 0.99669689520289606, 0.996758890430818,
+  0.99682029929116567, 0.99688112174781385, 0.99694135776498216,
+  0.99700100730723529, 0.99706007033948296, 0.99711854682697998,
+  0.99717643673532619, 0.99723374003046616, 0.99729045667869021,
+  0.99734658664663323, 0.9974021299012753, 0.99745708640994191,
+  0.99751145614030345, 0.99756523906037575, 0.99761843513851955,
+  0.997671044343441, 0.99772306664419164, 0.99777450201016782,
+  0.99782535041111164, 0.99787561181711015, 0.997925286198596,
+  0.99797437352634699, 0.99802287377148624, 0.99807078690548234,
+  0.99811811290014918, 0.99816485172764624, 0.99821100336047819,
+  0.99825656777149518, 0.99830154493389289, 0.99834593482121237,
+  0.99838973740734016, 0.99843295266650844, 0.99847558057329477,
+  0.99851762110262221, 0.99855907422975931, 0.99859993993032037,
+  0.99864021818026527, 0.99867990895589909, 0.99871901223387294,
+  0.99875752799118334, 0.99879545620517241, 0.99883279685352799,
+  0.99886954991428356, 0.99890571536581829, 0.99894129318685687,
+  0.99897628335646982, 0.99901068585407338, 0.99904450065942929,
+  0.99907772775264536, 0.99911036711417489, 0.99914241872481691,
+  0.99917388256571638, 0.99920475861836389, 0.99923504686459585,
+  0.99926474728659442, 0.99929385986688779, 0.99932238458834954,
+  0.99935032143419944, 0.99937767038800285, 0.9994044314336713,
+  0.99943060455546173, 0.99945618973797734, 0.99948118696616695,
+  0.99950559622532531, 0.99952941750109314, 0.99955265077945699,
+  0.99957529604674922, 0.99959735328964838, 0.99961882249517864,
+  0.9996397036507102, 0.99965999674395922, 0.99967970176298793,
+  0.99969881869620425, 0.99971734753236219, 0.99973528826056168,
+  0.99975264087024884, 0.99976940535121528, 0.99978558169359921,
+  0.99980116988788426, 0.99981616992490041, 0.9998305817958234,
+  0.99984440549217524, 0.99985764100582386, 0.99987028832898295,
+  0.99988234745421256, 0.99989381837441849, 0.9999047010828529,
+  0.99991499557311347, 0.9999247018391445, 0.999933819875236,
+  0.99994234967602391, 0.99995029123649048, 0.9999576445519639,
+  0.99996440961811828, 0.99997058643097414, 0.99997617498689761,
+  0.99998117528260111, 0.9999855873151432, 0.9999894110819284,
+  0.99999264658070719, 0.99999529380957619, 0.99999735276697821,
+  0.99999882345170188, 0.99999970586288223, 1,
+  0.99999970586288223, 0.99999882345170188, 0.99999735276697821,
+  0.99999529380957619, 0.99999264658070719, 0.9999894110819284,
+  0.9999855873151432, 0.99998117528260111, 0.99997617498689761,
+  0.99997058643097414, 0.99996440961811828, 0.9999576445519639,
+  0.99995029123649048, 0.99994234967602391, 0.999933819875236,
+  0.9999247018391445, 0.99991499557311347, 0.9999047010828529,
+  0.99989381837441849, 0.99988234745421256, 0.99987028832898295,
+  0.99985764100582386, 0.99984440549217524, 0.9998305817958234,
+  0.99981616992490041, 0.99980116988788426, 0.99978558169359921,
+  0.99976940535121528, 0.99975264087024884, 0.99973528826056168,
+  0.99971734753236219, 0.99969881869620425, 0.99967970176298793,
+  0.99965999674395922, 0.9996397036507102, 0.99961882249517864,
+  0.99959735328964838, 0.99957529604674922, 0.99955265077945699,
+  0.99952941750109314, 0.99950559622532531, 0.99948118696616695,
+  0.99945618973797734, 0.99943060455546173, 0.9994044314336713,
+  0.99937767038800285, 0.99935032143419944, 0.99932238458834954,
+  0.99929385986688779, 0.99926474728659442, 0.99923504686459585,
+  0.99920475861836389, 0.99917388256571638, 0.99914241872481691,
+  0.99911036711417489, 0.99907772775264536, 0.99904450065942929,
+  0.99901068585407338, 0.99897628335646982, 0.99894129318685687,
+  0.99890571536581829, 0.99886954991428356, 0.99883279685352799,
+  0.99879545620517241, 0.99875752799118334, 0.99871901223387294,
+  0.99867990895589909, 0.99864021818026527, 0.99859993993032037,
+  0.99855907422975931, 0.99851762110262221, 0.99847558057329477,
+  0.99843295266650844, 0.99838973740734016, 0.99834593482121237,
+  0.99830154493389289, 0.99825656777149518, 0.99821100336047819,
+  0.99816485172764624, 0.99811811290014918, 0.99807078690548234,
+  0.99802287377148624, 0.99797437352634699, 0.997925286198596,
+  0.99787561181711015, 0.99782535041111164, 0.99777450201016782,
+  0.99772306664419164, 0.997671044343441, 0.99761843513851955,
+  0.99756523906037575, 0.99751145614030345, 0.99745708640994191,
+  0.9974021299012753, 0.99734658664663323, 0.99729045667869021,
+  0.99723374003046628, 0.99717643673532619, 0.99711854682697998,
+  0.99706007033948296, 0.99700100730723529, 0.99694135776498216,
+  0.99688112174781385, 0.99682029929116567, 0.996758890430818,
+  0.99669689520289606, 0.9966343136438699, 0.99657114579055484,
+  0.99650739168011082, 0.99644305135004263, 0.99637812483820021,
+  0.996312612182778, 0.99624651342231552, 0.99617982859569698,
+  0.99611255774215113, 0.99604470090125197, 0.99597625811291779,
+  0.99590722941741172, 0.99583761485534161, 0.99576741446765982,
+  0.99569662829566352, 0.99562525638099431, 0.99555329876563847,
+  0.99548075549192694, 0.9954076266025349, 0.99533391214048228,
+  0.99525961214913339, 0.99518472667219693, 0.99510925575372611,
+  0.99503319943811863, 0.99495655777011638, 0.99487933079480562,
+  0.99480151855761711, 0.9947231211043257, 0.99464413848105071,
+  0.99456457073425542, 0.9944844179107476, 0.9944036800576791,
+  0.99432235722254581, 0.9942404494531879, 0.99415795679778973,
+  0.99407487930487937, 0.99399121702332938, 0.99390697000235606,
+  0.99382213829151966, 0.9937367219407246, 0.99365072100021912,
+  0.9935641355205953, 0.99347696555278919, 0.99338921114808065,
+  0.99330087235809328, 0.9932119492347945, 0.99312244183049558,
+  0.99303235019785141, 0.99294167438986047, 0.9928504144598651,
+  0.99275857046155114, 0.99266614244894802, 0.99257313047642881,
+  0.99247953459870997, 0.99238535487085167, 0.99229059134825737,
+  0.99219524408667392, 0.9920993131421918, 0.99200279857124452,
+  0.99190570043060933, 0.99180801877740643, 0.99170975366909953,
+  0.99161090516349537, 0.9915114733187439, 0.99141145819333854,
+  0.99131085984611544, 0.99120967833625406, 0.99110791372327689,
+  0.99100556606704937, 0.99090263542778001, 0.99079912186602037,
+  0.99069502544266463, 0.99059034621895015, 0.99048508425645709,
+  0.99037923961710816, 0.99027281236316911, 0.9901658025572484,
+  0.99005821026229712, 0.98995003554160899, 0.98984127845882053,
+  0.98973193907791057, 0.98962201746320089, 0.98951151367935519,
+  0.98940042779138038, 0.98928875986462517, 0.98917650996478101,
+  0.98906367815788154, 0.98895026451030299, 0.98883626908876354,
+  0.98872169196032378, 0.98860653319238645, 0.98849079285269659,
+  0.98837447100934128, 0.98825756773074946, 0.98814008308569257,
+  0.98802201714328353, 0.98790336997297779, 0.98778414164457218,
+  0.98766433222820571, 0.98754394179435923, 0.98742297041385541,
+  0.98730141815785843, 0.98717928509787434, 0.98705657130575097,
+  0.98693327685367771, 0.98680940181418553, 0.98668494626014669,
+  0.98655991026477541, 0.98643429390162718, 0.98630809724459867,
+  0.98618132036792827, 0.98605396334619544, 0.98592602625432113,
+  0.98579750916756748, 0.98566841216153755, 0.98553873531217606,
+  0.98540847869576842, 0.98527764238894122, 0.98514622646866223,
+  0.98501423101223984, 0.9848816560973237, 0.98474850180190421,
+  0.9846147682043126, 0.98448045538322093, 0.9843455634176419,
+  0.98421009238692903, 0.98407404237077645, 0.98393741344921892,
+  0.9838002057026316, 0.98366241921173025, 0.98352405405757126,
+  0.98338511032155118, 0.98324558808540707, 0.98310548743121629,
+  0.98296480844139644, 0.98282355119870524, 0.98268171578624086,
+  0.98253930228744124, 0.98239631078608469, 0.98225274136628937,
+  0.98210859411251361, 0.98196386910955524, 0.9818185664425525,
+  0.98167268619698311, 0.98152622845866477, 0.98137919331375456,
+  0.98123158084874973, 0.98108339115048671, 0.98093462430614164,
+  0.98078528040323043, 0.98063535952960812, 0.98048486177346938,
+  0.98033378722334796, 0.98018213596811743, 0.98002990809699009,
+  0.97987710369951764, 0.97972372286559117, 0.97956976568544052,
+  0.97941523224963478, 0.97926012264908202, 0.97910443697502925,
+  0.9789481753190622, 0.97879133777310567, 0.97863392442942321,
+  0.97847593538061683, 0.97831737071962765, 0.97815823053973505,
+  0.97799851493455714, 0.97783822399805043, 0.97767735782450993,
+  0.97751591650856928, 0.97735390014519996, 0.97719130882971228,
+  0.97702814265775439, 0.97686440172531264, 0.97670008612871184,
+  0.97653519596461447, 0.97636973133002114, 0.97620369232227056,
+  0.97603707903903902, 0.97586989157834103, 0.97570213003852857,
+  0.97553379451829136, 0.97536488511665698, 0.97519540193299037,
+  0.97502534506699412, 0.97485471461870843, 0.97468351068851067,
+  0.97451173337711572, 0.97433938278557586, 0.97416645901528032,
+  0.97399296216795583, 0.9738188923456661, 0.97364424965081198,
+  0.97346903418613107, 0.97329324605469825, 0.97311688535992513,
+  0.97293995220556018, 0.97276244669568857, 0.97258436893473221,
+  0.97240571902744977, 0.97222649707893627, 0.9720467031946235,
+  0.9718663374802794, 0.97168540004200854, 0.97150389098625178,
+  0.97132181041978616, 0.97113915844972509, 0.97095593518351797,
+  0.97077214072895035, 0.97058777519414363, 0.9704028386875555,
+  0.97021733131797916, 0.97003125319454397, 0.96984460442671483,
+  0.96965738512429245, 0.96946959539741306, 0.96928123535654853,
+  0.96909230511250621, 0.96890280477642887, 0.96871273445979478,
+  0.96852209427441738, 0.96833088433244519, 0.96813910474636244,
+  0.9679467556289878, 0.96775383709347551, 0.96756034925331436,
+  0.96736629222232851, 0.96717166611467664, 0.96697647104485207,
+  0.96678070712768327, 0.96658437447833312, 0.9663874732122989,
+  0.9661900034454125, 0.96599196529384057, 0.96579335887408368,
+  0.96559418430297683, 0.9653944416976894, 0.96519413117572472,
+  0.96499325285492032, 0.9647918068534479, 0.96458979328981276,
+  0.96438721228285429, 0.96418406395174583, 0.96398034841599411,
+  0.96377606579543984, 0.96357121621025732, 0.96336579978095405,
+  0.96315981662837136, 0.96295326687368388, 0.96274615063839941,
+  0.96253846804435916, 0.9623302192137374, 0.96212140426904158,
+  0.96191202333311221, 0.96170207652912254, 0.961491563980579,
+  0.96128048581132064, 0.96106884214551935, 0.96085663310767966,
+  0.96064385882263859, 0.96043051941556579, 0.96021661501196343,
+  0.96000214573766596, 0.9597871117188399, 0.95957151308198452,
+  0.95935534995393079, 0.95913862246184189, 0.95892133073321317,
+  0.9587034748958716, 0.9584850550779761, 0.95826607140801767,
+  0.9580465240148186, 0.95782641302753291, 0.95760573857564635,
+  0.95738450078897586, 0.95716269979767021, 0.95694033573220882,
+  0.95671740872340305, 0.9564939189023951, 0.95626986640065803,
+  0.95604525134999641, 0.95582007388254542, 0.95559433413077111,
+  0.95536803222747035, 0.95514116830577078, 0.95491374249913052,
+  0.95468575494133834, 0.95445720576651349, 0.95422809510910567,
+  0.95399842310389449, 0.95376818988599033, 0.95353739559083328,
+  0.95330604035419386, 0.9530741243121722, 0.95284164760119872,
+  0.95260861035803335, 0.95237501271976588, 0.95214085482381583,
+  0.95190613680793235, 0.95167085881019386, 0.95143502096900834,
+  0.95119862342311323, 0.95096166631157508, 0.95072414977378961,
+  0.9504860739494817, 0.95024743897870523, 0.950008245001843,
+  0.94976849215960668, 0.94952818059303667, 0.94928731044350212,
+  0.94904588185270056, 0.94880389496265849, 0.94856134991573027,
+  0.94831824685459909, 0.94807458592227623, 0.94783036726210101,
+  0.94758559101774109, 0.94734025733319205, 0.94709436635277722,
+  0.946847918221148, 0.94660091308328353, 0.94635335108449059,
+  0.94610523237040345, 0.94585655708698391, 0.94560732538052128,
+  0.94535753739763229, 0.94510719328526061, 0.94485629319067721,
+  0.94460483726148026, 0.94435282564559475, 0.94410025849127266,
+  0.94384713594709269, 0.94359345816196039, 0.94333922528510772,
+  0.94308443746609349, 0.94282909485480271, 0.94257319760144687,
+  0.94231674585656378, 0.94205973977101731, 0.94180217949599765,
+  0.94154406518302081, 0.94128539698392866, 0.94102617505088926,
+  0.94076639953639607, 0.9405060705932683, 0.94024518837465088,
+  0.93998375303401405, 0.93972176472515334, 0.93945922360218992,
+  0.9391961298195699, 0.9389324835320646, 0.93866828489477017,
+  0.93840353406310806, 0.93813823119282436, 0.93787237643998989,
+  0.93760596996099999, 0.93733901191257496, 0.93707150245175919,
+  0.93680344173592156, 0.9365348299227555, 0.93626566717027826,
+  0.93599595363683141, 0.93572568948108037, 0.93545487486201462,
+  0.93518350993894761, 0.93491159487151609, 0.93463912981968078,
+  0.93436611494372579, 0.93409255040425898, 0.93381843636221096,
+  0.93354377297883617, 0.93326856041571205, 0.93299279883473896,
+  0.93271648839814025, 0.93243962926846236, 0.93216222160857443,
+  0.93188426558166815, 0.93160576135125783, 0.93132670908118043,
+  0.93104710893559528, 0.93076696107898371, 0.93048626567614978,
+  0.93020502289221907, 0.92992323289263967, 0.92964089584318133,
+  0.9293580119099355, 0.92907458125931586, 0.92879060405805702,
+  0.92850608047321559, 0.92822101067216944, 0.92793539482261789,
+  0.92764923309258118, 0.92736252565040111, 0.9270752726647401,
+  0.92678747430458175, 0.92649913073923051, 0.92621024213831138,
+  0.92592080867177007, 0.92563083050987272, 0.92534030782320631,
+  0.92504924078267758, 0.92475762955951391, 0.9244654743252626,
+  0.9241727752517912, 0.92387953251128674, 0.92358574627625667,
+  0.92329141671952764, 0.92299654401424625, 0.92270112833387863,
+  0.92240516985220988, 0.92210866874334518, 0.92181162518170812,
+  0.92151403934204201, 0.92121591139940873, 0.92091724152918952,
+  0.92061802990708397, 0.92031827670911059, 0.92001798211160657,
+  0.91971714629122736, 0.91941576942494707, 0.91911385169005777,
+  0.91881139326417005, 0.91850839432521225, 0.9182048550514309,
+  0.9179007756213905, 0.91759615621397295, 0.91729099700837791,
+  0.916985298184123, 0.9166790599210427, 0.91637228239928914,
+  0.91606496579933172, 0.91575711030195672, 0.91544871608826783,
+  0.91513978333968526, 0.9148303122379462, 0.91452030296510445,
+  0.91420975570353069, 0.91389867063591168, 0.91358704794525081,
+  0.91327488781486776, 0.91296219042839821, 0.9126489559697939,
+  0.91233518462332275, 0.91202087657356834, 0.91170603200542988,
+  0.91139065110412243, 0.91107473405517636, 0.91075828104443757,
+  0.91044129225806725, 0.91012376788254168, 0.90980570810465222,
+  0.90948711311150543, 0.90916798309052238, 0.90884831822943912,
+  0.90852811871630612, 0.9082073847394887, 0.90788611648766626,
+  0.90756431414983263, 0.90724197791529582, 0.90691910797367814,
+  0.90659570451491533, 0.90627176772925766, 0.90594729780726846,
+  0.90562229493982527, 0.90529675931811882, 0.90497069113365325,
+  0.90464409057824624, 0.90431695784402832, 0.90398929312344334,
+  0.90366109660924798, 0.90333236849451182, 0.90300310897261715,
+  0.90267331823725883, 0.9023429964824442, 0.90201214390249318,
+  0.90168076069203773, 0.90134884704602203, 0.90101640315970233,
+  0.90068342922864697, 0.9003499254487356, 0.90001589201616028,
+  0.89968132912742393, 0.89934623697934157, 0.89901061576903907,
+  0.89867446569395382, 0.89833778695183431, 0.89800057974073988,
+  0.89766284425904086, 0.89732458070541832, 0.89698578927886397,
+  0.89664647017868015, 0.89630662360447955, 0.89596624975618522,
+  0.89562534883403011, 0.89528392103855758, 0.89494196657062075,
+  0.8945994856313827, 0.89425647842231604, 0.89391294514520325,
+  0.89356888600213591, 0.89322430119551532, 0.89287919092805168,
+  0.89253355540276458, 0.89218739482298248, 0.89184070939234272,
+  0.89149349931479138, 0.89114576479458318, 0.89079750603628149,
+  0.89044872324475788, 0.89009941662519232, 0.88974958638307278,
+  0.88939923272419552, 0.88904835585466457, 0.8886969559808916,
+  0.88834503330959635, 0.88799258804780556, 0.88763962040285393,
+  0.88728613058238315, 0.88693211879434219, 0.88657758524698704,
+  0.88622253014888064, 0.88586695370889279, 0.88551085613619995,
+  0.88515423764028511, 0.88479709843093779, 0.88443943871825381,
+  0.88408125871263499, 0.88372255862478966, 0.88336333866573158,
+  0.88300359904678083, 0.88264333997956279, 0.88228256167600871,
+  0.88192126434835505, 0.88155944820914378, 0.88119711347122209,
+  0.88083426034774204, 0.88047088905216075, 0.88010699979824036,
+  0.87974259280004741, 0.87937766827195329, 0.87901222642863353,
+  0.87864626748506813, 0.87827979165654158, 0.87791279915864184,
+  0.87754529020726135, 0.87717726501859594, 0.87680872380914565,
+  0.87643966679571361, 0.8760700941954066, 0.8757000062256346,
+  0.87532940310411089, 0.87495828504885165, 0.87458665227817611,
+  0.8742145050107063, 0.87384184346536686, 0.87346866786138488,
+  0.87309497841829009, 0.8727207753559143, 0.87234605889439154,
+  0.87197082925415781, 0.87159508665595098, 0.87121883132081102,
+  0.87084206347007898, 0.87046478332539767, 0.87008699110871146,
+  0.86970868704226567, 0.86932987134860684, 0.86895054425058238,
+  0.8685707059713409, 0.86819035673433131, 0.86780949676330332,
+  0.86742812628230692, 0.86704624551569265, 0.86666385468811113,
+  0.86628095402451299, 0.86589754375014882, 0.86551362409056909,
+  0.8651291952716238, 0.86474425751946238, 0.86435881106053403,
+  0.86397285612158681, 0.8635863929296681, 0.86319942171212416,
+  0.86281194269660033, 0.86242395611104061, 0.86203546218368721,
+  0.8616464611430813, 0.86125695321806217, 0.86086693863776731,
+  0.86047641763163207, 0.86008539042939014, 0.85969385726107261,
+  0.85930181835700847, 0.8589092739478239, 0.85851622426444274,
+  0.85812266953808614, 0.85772861000027212, 0.85733404588281559,
+  0.85693897741782876, 0.85654340483771996, 0.85614732837519447,
+  0.85575074826325392, 0.85535366473519603, 0.85495607802461493,
+  0.85455798836540053, 0.85415939599173885, 0.85376030113811141,
+  0.85336070403929543, 0.85296060493036363, 0.85256000404668408,
+  0.85215890162391983, 0.85175729789802912, 0.8513551931052652,
+  0.85095258748217573, 0.85054948126560348, 0.85014587469268521,
+  0.84974176800085255, 0.84933716142783078, 0.84893205521163961,
+  0.84852644959059265, 0.84812034480329723, 0.84771374108865438,
+  0.84730663868585832, 0.84689903783439724, 0.84649093877405213,
+  0.84608234174489705, 0.84567324698729907, 0.84526365474191822,
+  0.84485356524970712, 0.84444297875191066, 0.84403189549006641,
+  0.84362031570600415, 0.84320823964184544, 0.84279566754000412,
+  0.84238259964318585, 0.84196903619438768, 0.84155497743689844,
+  0.84114042361429808, 0.84072537497045807, 0.84030983174954077,
+  0.83989379419599952, 0.83947726255457855, 0.83906023707031274,
+  0.8386427179885273, 0.83822470555483808, 0.83780620001515094,
+  0.83738720161566194, 0.83696771060285702, 0.83654772722351201,
+  0.83612725172469227, 0.8357062843537526, 0.83528482535833737,
+  0.83486287498638001, 0.83444043348610319, 0.83401750110601813,
+  0.83359407809492514, 0.83317016470191319, 0.83274576117635946,
+  0.83232086776792968, 0.83189548472657759, 0.83146961230254524,
+  0.83104325074636232, 0.83061640030884631, 0.83018906124110237,
+  0.82976123379452305, 0.82933291822078825, 0.82890411477186487,
+  0.82847482370000713, 0.8280450452577558, 0.8276147796979384,
+  0.82718402727366913, 0.82675278823834852, 0.82632106284566353,
+  0.82588885134958678, 0.82545615400437755, 0.82502297106458022,
+  0.82458930278502529, 0.82415514942082857, 0.82372051122739143,
+  0.82328538846040011, 0.82284978137582643, 0.82241369022992639,
+  0.82197711527924155, 0.82154005678059761, 0.82110251499110465,
+  0.82066449016815746, 0.82022598256943469, 0.81978699245289899,
+  0.8193475200767969, 0.81890756569965895, 0.81846712958029866,
+  0.81802621197781344, 0.81758481315158371, 0.81714293336127297,
+  0.81670057286682785, 0.81625773192847739, 0.81581441080673378,
+  0.81537060976239129, 0.81492632905652662, 0.81448156895049861,
+  0.81403632970594841, 0.81359061158479851, 0.81314441484925359,
+  0.81269773976179949, 0.81225058658520388, 0.81180295558251547,
+  0.81135484701706373, 0.81090626115245967, 0.81045719825259477,
+  0.81000765858164114, 0.80955764240405126, 0.80910714998455824,
+  0.80865618158817498, 0.80820473748019472, 0.80775281792619036,
+  0.80730042319201445, 0.80684755354379933, 0.80639420924795624,
+  0.80594039057117628, 0.80548609778042923, 0.80503133114296366,
+  0.80457609092630711, 0.80412037739826581, 0.80366419082692409,
+  0.80320753148064494, 0.80275039962806916, 0.80229279553811572,
+  0.80183471947998131, 0.80137617172314024, 0.8009171525373443,
+  0.80045766219262282, 0.79999770095928191, 0.79953726910790501,
+  0.79907636690935235, 0.79861499463476082, 0.79815315255554375,
+  0.79769084094339116, 0.79722806007026881, 0.79676481020841883,
+  0.79630109163035911, 0.79583690460888357, 0.79537224941706131,
+  0.79490712632823701, 0.79444153561603059, 0.79397547755433717,
+  0.79350895241732666, 0.79304196047944364, 0.79257450201540769,
+  0.79210657730021239, 0.79163818660912588, 0.7911693302176902,
+  0.79070000840172161, 0.79023022143731003, 0.78975996960081907,
+  0.78928925316888565, 0.78881807241842028, 0.78834642762660634,
+  0.78787431907090022, 0.78740174702903143, 0.78692871177900181,
+  0.78645521359908577, 0.78598125276783015, 0.78550682956405393,
+  0.78503194426684808, 0.78455659715557524, 0.78408078850986995,
+  0.7836045186096382, 0.78312778773505731, 0.78265059616657573,
+  0.78217294418491301, 0.78169483207105939, 0.78121626010627609,
+  0.78073722857209449, 0.78025773775031659, 0.77977778792301455,
+  0.7792973793725303, 0.77881651238147598, 0.77833518723273321,
+  0.77785340420945315, 0.77737116359505631, 0.77688846567323244,
+  0.77640531072794039, 0.77592169904340769, 0.77543763090413054,
+  0.77495310659487393, 0.77446812640067086, 0.7739826906068229,
+  0.77349679949889905, 0.77301045336273699, 0.77252365248444133,
+  0.77203639715038452, 0.7715486876472063, 0.77106052426181382,
+  0.77057190728138081, 0.7700828369933479, 0.76959331368542294,
+  0.7691033376455797, 0.76861290916205838, 0.76812202852336542,
+  0.76763069601827338, 0.7671389119358204, 0.76664667656531038,
+  0.76615399019631292, 0.7656608531186625, 0.76516726562245896,
+  0.76467322799806714, 0.76417874053611667, 0.76368380352750187,
+  0.76318841726338127, 0.76269258203517798, 0.7621962981345789,
+  0.76169956585353538, 0.76120238548426178, 0.76070475731923692,
+  0.76020668165120242, 0.75970815877316344, 0.75920918897838807,
+  0.75870977256040739, 0.75820990981301528, 0.75770960103026808,
+  0.75720884650648457, 0.75670764653624567, 0.75620600141439454,
+  0.75570391143603588, 0.75520137689653655, 0.7546983980915245,
+  0.75419497531688917, 0.75369110886878121, 0.75318679904361252,
+  0.75268204613805534, 0.75217685044904281, 0.75167121227376843,
+  0.75116513190968648, 0.7506586096545107, 0.75015164580621507,
+  0.74964424066303348, 0.74913639452345937, 0.74862810768624544,
+  0.7481193804504036, 0.74761021311520515, 0.74710060598018013,
+  0.74659055934511731, 0.74608007351006378, 0.74556914877532543,
+  0.74505778544146606, 0.74454598380930737, 0.74403374417992929,
+  0.74352106685466912, 0.74300795213512172, 0.74249440032313918,
+  0.74198041172083107, 0.74146598663056329, 0.74095112535495911,
+  0.74043582819689802, 0.7399200954595162, 0.73940392744620576,
+  0.73888732446061511, 0.73837028680664862, 0.73785281478846598,
+  0.73733490871048291, 0.7368165688773699, 0.73629779559405317,
+  0.73577858916571359, 0.73525894989778684, 0.7347388780959635,
+  0.73421837406618828, 0.73369743811466037, 0.73317607054783274,
+  0.73265427167241282, 0.73213204179536129, 0.73160938122389263,
+  0.73108629026547434, 0.73056276922782759, 0.73003881841892626,
+  0.72951443814699701, 0.72898962872051942, 0.7284643904482252,
+  0.72793872363909862, 0.72741262860237577, 0.72688610564754497,
+  0.72635915508434601, 0.72583177722277037, 0.72530397237306077,
+  0.72477574084571128, 0.724247082951467, 0.7237179990013235,
+  0.72318848930652746, 0.72265855417857561, 0.72212819392921535,
+  0.72159740887044377, 0.72106619931450811, 0.72053456557390527,
+  0.72000250796138165, 0.71947002678993299, 0.71893712237280449,
+  0.71840379502348983, 0.71787004505573171, 0.71733587278352173,
+  0.71680127852109954, 0.71626626258295312, 0.71573082528381859,
+  0.71519496693868012, 0.71465868786276909, 0.71412198837156482,
+  0.71358486878079364, 0.71304732940642934, 0.71250937056469232,
+  0.7119709925720501, 0.71143219574521643, 0.71089298040115168,
+  0.71035334685706242, 0.70981329543040084, 0.70927282643886569,
+  0.70873194020040065, 0.7081906370331954, 0.70764891725568435,
+  0.70710678118654757, 0.70656422914470962, 0.70602126144933974,
+  0.70547787841985221, 0.70493408037590499, 0.70438986763740041,
+  0.70384524052448494, 0.70330019935754873, 0.7027547444572253,
+  0.70220887614439187, 0.70166259474016857, 0.70111590056591866,
+  0.70056879394324845, 0.70002127519400636, 0.69947334464028377,
+  0.69892500260441415, 0.69837624940897292, 0.69782708537677729,
+  0.69727751083088663, 0.6967275260946012, 0.69617713149146299,
+  0.69562632734525487, 0.69507511398000088, 0.69452349171996552,
+  0.693971460889654, 0.69341902181381188, 0.69286617481742474,
+  0.69231292022571822, 0.69175925836415775, 0.69120518955844845,
+  0.69065071413453472, 0.69009583241859995, 0.68954054473706694,
+  0.68898485141659715, 0.68842875278409055, 0.68787224916668555,
+  0.68731534089175916, 0.68675802828692589, 0.6862003116800387,
+  0.68564219139918747, 0.68508366777270036, 0.6845247411291423,
+  0.68396541179731551, 0.68340568010625879, 0.68284554638524808,
+  0.68228501096379557, 0.68172407417164982, 0.68116273633879543,
+  0.68060099779545313, 0.68003885887207904, 0.67947631989936508,
+  0.67891338120823841, 0.67835004312986158, 0.6777863059956315,
+  0.67722217013718045, 0.67665763588637495, 0.67609270357531603,
+  0.67552737353633863, 0.67496164610201204, 0.67439552160513905,
+  0.67382900037875615, 0.67326208275613297, 0.67269476907077297,
+  0.67212705965641184, 0.67155895484701833, 0.67099045497679422,
+  0.67042156038017309, 0.66985227139182113, 0.66928258834663601,
+  0.66871251157974809, 0.66814204142651856, 0.66757117822254031,
+  0.66699992230363747, 0.66642827400586535, 0.66585623366550972,
+  0.66528380161908718, 0.6647109782033449, 0.66413776375526001,
+  0.66356415861203988, 0.66299016311112147, 0.66241577759017178,
+  0.66184100238708687, 0.66126583783999227, 0.6606902842872423,
+  0.66011434206742048, 0.65953801151933877, 0.65896129298203732,
+  0.65838418679478505, 0.65780669329707864, 0.65722881282864265,
+  0.65665054572942905, 0.65607189233961771, 0.65549285299961546,
+  0.65491342805005615, 0.65433361783180055, 0.65375342268593617,
+  0.65317284295377676, 0.65259187897686255, 0.6520105310969595,
+  0.65142879965605982, 0.65084668499638099, 0.65026418746036596,
+  0.64968130739068319, 0.64909804513022606, 0.64851440102211255,
+  0.64793037540968546, 0.64734596863651206, 0.64676118104638392,
+  0.64617601298331639, 0.6455904647915488, 0.64500453681554404,
+  0.64441822939998838, 0.6438315428897915, 0.64324447763008585,
+  0.64265703396622686, 0.64206921224379254, 0.64148101280858316,
+  0.64089243600662138, 0.64030348218415167, 0.63971415168764045,
+  0.63912444486377573, 0.63853436205946679, 0.63794390362184417,
+  0.63735306989825913, 0.6367618612362842, 0.63617027798371217,
+  0.63557832048855623, 0.63498598909904946, 0.63439328416364549,
+  0.63380020603101728, 0.63320675505005719, 0.63261293156987752,
+  0.63201873593980906, 0.63142416850940186, 0.63082922962842447,
+  0.63023391964686448, 0.6296382389149271, 0.629042187783036,
+  0.62844576660183271, 0.62784897572217657, 0.62725181549514419,
+  0.62665428627202946, 0.62605638840434352, 0.62545812224381436,
+  0.62485948814238645, 0.62426048645222065, 0.62366111752569464,
+  0.62306138171540137, 0.62246127937415008, 0.62186081085496536,
+  0.62125997651108766, 0.62065877669597214, 0.62005721176328921,
+  0.61945528206692402, 0.61885298796097632, 0.61825032979976025,
+  0.61764730793780398, 0.61704392272984976, 0.61644017453085365,
+  0.61583606369598509, 0.61523159058062682, 0.61462675554037505,
+  0.61402155893103849, 0.61341600110863859, 0.61281008242940971,
+  0.61220380324979806, 0.61159716392646202, 0.61099016481627177,
+  0.61038280627630948, 0.60977508866386843, 0.60916701233645321,
+  0.60855857765177945, 0.60794978496777374, 0.60734063464257293,
+  0.60673112703452448, 0.60612126250218623, 0.60551104140432555,
+  0.60490046409991993, 0.60428953094815607, 0.60367824230843037,
+  0.60306659854034828, 0.60245460000372386, 0.60184224705858003,
+  0.60122954006514862, 0.60061647938386897, 0.60000306537538906,
+  0.59938929840056454, 0.59877517882045872, 0.59816070699634238,
+  0.59754588328969327, 0.5969307080621965, 0.59631518167574382,
+  0.59569930449243347, 0.59508307687456996, 0.59446649918466454,
+  0.59384957178543363, 0.5932322950397998, 0.59261466931089113,
+  0.59199669496204099, 0.59137837235678758, 0.59075970185887428,
+  0.59014068383224894, 0.58952131864106394, 0.58890160664967584,
+  0.58828154822264533, 0.58766114372473677, 0.58704039352091808,
+  0.5864192979763605, 0.58579785745643886, 0.58517607232673041,
+  0.58455394295301533, 0.5839314697012763, 0.58330865293769829,
+  0.58268549302866846, 0.58206199034077555, 0.58143814524081028,
+  0.58081395809576453, 0.58018942927283168, 0.57956455913940574,
+  0.57893934806308189, 0.57831379641165559, 0.5776879045531228,
+  0.57706167285567955, 0.57643510168772183, 0.57580819141784534,
+  0.57518094241484519, 0.57455335504771576, 0.57392542968565075,
+  0.57329716669804232, 0.57266856645448116, 0.57203962932475705,
+  0.57141035567885734, 0.57078074588696737, 0.5701508003194703,
+  0.56952051934694725, 0.56888990334017597, 0.56825895267013149,
+  0.56762766770798623, 0.56699604882510868, 0.56636409639306395,
+  0.56573181078361323, 0.56509919236871409, 0.5644662415205195,
+  0.56383295861137817, 0.56319934401383409, 0.56256539810062656,
+  0.56193112124468947, 0.56129651381915147, 0.56066157619733603,
+  0.56002630875276038, 0.55939071185913614, 0.55875478589036831,
+  0.5581185312205561, 0.55748194822399166, 0.5568450372751601,
+  0.55620779874873993, 0.55557023301960229, 0.55493234046281037,
+  0.55429412145362011, 0.55365557636747931, 0.55301670558002758,
+  0.55237750946709607, 0.55173798840470745, 0.55109814276907543,
+  0.55045797293660481, 0.54981747928389102, 0.54917666218771977,
+  0.54853552202506739, 0.54789405917310019, 0.54725227400917409,
+  0.54661016691083486, 0.54596773825581768, 0.54532498842204646,
+  0.54468191778763453, 0.54403852673088393, 0.5433948156302848,
+  0.542750784864516, 0.54210643481244403, 0.54146176585312356,
+  0.54081677836579667, 0.54017147272989297, 0.53952584932502901,
+  0.53887990853100842, 0.5382336507278217, 0.53758707629564551,
+  0.53694018561484302, 0.53629297906596318, 0.53564545702974109,
+  0.53499761988709726, 0.53434946801913752, 0.53370100180715296,
+  0.53305222163261967, 0.53240312787719801, 0.53175372092273332,
+  0.531104001151255, 0.53045396894497632, 0.52980362468629483,
+  0.52915296875779072, 0.52850200154222848, 0.52785072342255546,
+  0.52719913478190139, 0.52654723600357933, 0.52589502747108474,
+  0.52524250956809471, 0.52458968267846884, 0.5239365471862486,
+  0.52328310347565643, 0.52262935193109672, 0.52197529293715439,
+  0.52132092687859555, 0.52066625414036727, 0.52001127510759604,
+  0.51935599016558953, 0.51870039969983517, 0.51804450409599934,
+  0.51738830373992906, 0.51673179901764998, 0.51607499031536663,
+  0.51541787801946315, 0.5147604625165012, 0.51410274419322166,
+  0.51344472343654357, 0.51278640063356307, 0.51212777617155469,
+  0.51146885043797052, 0.51080962382043904, 0.5101500967067667,
+  0.50949026948493636, 0.50883014254310699, 0.50816971626961471,
+  0.50750899105297087, 0.50684796728186332, 0.50618664534515545,
+  0.50552502563188551, 0.50486310853126748, 0.50420089443269056,
+  0.50353838372571758, 0.50287557680008688, 0.5022124740457109,
+  0.50154907585267539, 0.50088538261124094, 0.50022139471184068,
+  0.49955711254508189, 0.49889253650174475, 0.49822766697278187,
+  0.49756250434931909, 0.49689704902265464, 0.49623130138425831,
+  0.49556526182577249, 0.49489893073901131, 0.49423230851595973,
+  0.49356539554877488, 0.49289819222978409, 0.49223069895148608,
+  0.49156291610655006, 0.49089484408781514, 0.4902264832882911,
+  0.48955783410115755, 0.48888889691976323, 0.48821967213762674,
+  0.48755016014843605, 0.4868803613460474, 0.48621027612448653,
+  0.48553990487794702, 0.48486924800079112, 0.48419830588754914,
+  0.48352707893291874, 0.48285556753176567, 0.48218377207912283,
+  0.48151169297018992, 0.4808393306003339, 0.48016668536508844,
+  0.47949375766015301, 0.47882054788139405, 0.47814705642484312,
+  0.47747328368669806, 0.47679923006332225, 0.47612489595124363,
+  0.47545028174715587, 0.47477538784791723, 0.47410021465055002,
+  0.47342476255224153, 0.4727490319503429, 0.47207302324236866,
+  0.47139673682599781, 0.47072017309907171, 0.47004333245959562,
+  0.46936621530573763, 0.46868882203582796, 0.46801115304835983,
+  0.46733320874198853, 0.46665498951553097, 0.46597649576796613,
+  0.46529772789843465, 0.46461868630623782, 0.46393937139083846,
+  0.46325978355186026, 0.46257992318908681, 0.46189979070246284,
+  0.46121938649209243, 0.46053871095824001, 0.45985776450132965,
+  0.45917654752194415, 0.45849506042082622, 0.45781330359887729,
+  0.45713127745715698, 0.45644898239688386, 0.45576641881943475,
+  0.45508358712634384, 0.45440048771930375, 0.45371712100016393,
+  0.45303348737093158, 0.452349587233771, 0.45166542099100254,
+  0.45098098904510381, 0.45029629179870873, 0.4496113296546066,
+  0.44892610301574326, 0.44824061228522, 0.44755485786629301,
+  0.44686884016237433, 0.44618255957703012, 0.44549601651398174,
+  0.444809211377105, 0.44412214457042926, 0.44343481649813843,
+  0.44274722756457013, 0.44205937817421476, 0.44137126873171662,
+  0.44068289964187302, 0.43999427130963326, 0.43930538414010006,
+  0.43861623853852771, 0.43792683491032286, 0.4372371736610442,
+  0.43654725519640125, 0.43585707992225547, 0.43516664824461937,
+  0.43447596056965571, 0.43378501730367852, 0.43309381885315201,
+  0.43240236562469014, 0.43171065802505737, 0.43101869646116708,
+  0.43032648134008261, 0.4296340130690165, 0.42894129205532955,
+  0.42824831870653191, 0.4275550934302822, 0.42686161663438649,
+  0.42616788872679962, 0.42547391011562391, 0.42477968120910881,
+  0.42408520241565167, 0.4233904741437961, 0.42269549680223295,
+  0.42200027079979979, 0.4213047965454797, 0.42060907444840251,
+  0.41991310491784373, 0.41921688836322396, 0.4185204251941097,
+  0.41782371582021238, 0.41712676065138787, 0.41642956009763732,
+  0.41573211456910542, 0.41503442447608163, 0.41433649022899921,
+  0.41363831223843456, 0.41293989091510802, 0.412241226669883,
+  0.41154231991376528, 0.41084317105790391, 0.41014378051359035,
+  0.40944414869225759, 0.40874427600548152, 0.40804416286497874,
+  0.40734380968260797, 0.40664321687036914, 0.40594238484040257,
+  0.40524131400498986, 0.40454000477655311, 0.40383845756765413,
+  0.40313667279099524, 0.40243465085941854, 0.40173239218590501,
+  0.40102989718357579, 0.40032716626569015, 0.39962419984564679,
+  0.39892099833698302, 0.39821756215337362, 0.39751389170863233,
+  0.39680998741671042, 0.39610584969169632, 0.3954014789478163,
+  0.39469687559943367, 0.3939920400610481, 0.39328697274729657,
+  0.39258167407295153, 0.39187614445292235, 0.39117038430225398,
+  0.39046439403612665, 0.38975817406985641, 0.3890517248188945,
+  0.3883450466988263, 0.38763814012537268, 0.38693100551438869,
+  0.38622364328186298, 0.38551605384391902, 0.38480823761681293,
+  0.38410019501693504, 0.38339192646080877, 0.38268343236508984,
+  0.38197471314656722, 0.38126576922216249, 0.38055660100892857,
+  0.37984720892405111, 0.37913759338484743, 0.37842775480876562,
+  0.37771769361338581, 0.37700741021641831, 0.37629690503570479,
+  0.37558617848921733, 0.3748752309950576, 0.37416406297145799,
+  0.37345267483678041, 0.37274106700951581, 0.37202923990828496,
+  0.3713171939518376, 0.37060492955905167, 0.36989244714893427,
+  0.36917974714062007, 0.36846682995337232, 0.36775369600658209,
+  0.36704034571976724, 0.36632677951257359, 0.36561299780477396,
+  0.36489900101626738, 0.36418478956707984, 0.36347036387736387,
+  0.36275572436739723, 0.36204087145758435, 0.36132580556845434,
+  0.36061052712066227, 0.35989503653498828, 0.35917933423233656,
+  0.35846342063373654, 0.35774729616034201, 0.35703096123343003,
+  0.35631441627440236, 0.35559766170478396, 0.35488069794622279,
+  0.35416352542049051, 0.35344614454948087, 0.35272855575521073,
+  0.35201075945981924, 0.35129275608556715, 0.35057454605483757,
+  0.34985612979013503, 0.34913750771408503, 0.34841868024943451,
+  0.34769964781905149, 0.34698041084592368, 0.34626096975316017,
+  0.34554132496398915, 0.34482147690175929, 0.34410142598993898,
+  0.3433811726521151, 0.34266071731199438, 0.3419400603934023,
+  0.34121920232028241, 0.3404981435166971, 0.33977688440682696,
+  0.33905542541496964, 0.33833376696554129, 0.33761190948307468,
+  0.33688985339222005, 0.33616759911774469, 0.33544514708453166,
+  0.33472249771758122, 0.33399965144200949, 0.33327660868304798,
+  0.33255336986604422, 0.33182993541646122, 0.33110630575987643,
+  0.33038248132198295, 0.32965846252858755, 0.3289342498056122,
+  0.32820984357909266, 0.32748524427517806, 0.32676045232013179,
+  0.32603546814033035, 0.32531029216226298, 0.32458492481253215,
+  0.32385936651785296, 0.32313361770505233, 0.32240767880107002,
+  0.32168155023295664, 0.32095523242787521, 0.32022872581310002,
+  0.31950203081601575, 0.31877514786411848, 0.31804807738501506,
+  0.31732081980642179, 0.31659337555616585, 0.31586574506218407,
+  0.31513792875252244, 0.31440992705533682, 0.31368174039889157,
+  0.3129533692115602, 0.31222481392182505, 0.31149607495827597,
+  0.31076715274961147, 0.310038047724638, 0.30930876031226878,
+  0.30857929094152503, 0.30784964004153498, 0.3071198080415331,
+  0.30638979537086108, 0.30565960245896623, 0.30492922973540243,
+  0.30419867762982927, 0.30346794657201137, 0.30273703699181914,
+  0.3020059493192282, 0.301274683984318, 0.3005432414172734,
+  0.29981162204838346, 0.29907982630804048, 0.29834785462674157,
+  0.29761570743508631, 0.29688338516377827, 0.29615088824362396,
+  0.29541821710553207, 0.29468537218051433, 0.29395235389968477,
+  0.29321916269425868, 0.29248579899555383, 0.29175226323498937,
+  0.29101855584408509, 0.29028467725446233, 0.28955062789784314,
+  0.28881640820604948, 0.2880820186110043, 0.28734745954472957,
+  0.28661273143934779, 0.28587783472708073, 0.28514276984024872,
+  0.28440753721127182, 0.28367213727266855, 0.28293657045705539,
+  0.2822008371971475, 0.28146493792575805, 0.28072887307579719,
+  0.27999264308027338, 0.27925624837229124, 0.27851968938505306,
+  0.2777829665518578, 0.27704608030609995, 0.27630903108127103,
+  0.27557181931095825, 0.27483444542884394, 0.27409690986870633,
+  0.27335921306441879, 0.27262135544994898, 0.27188333745935989,
+  0.27114515952680807, 0.27040682208654482, 0.2696683255729152,
+  0.26892967042035731, 0.26819085706340318, 0.26745188593667774,
+  0.26671275747489842, 0.26597347211287553, 0.2652340302855119,
+  0.26449443242780163, 0.26375467897483151, 0.26301477036177906,
+  0.26227470702391359, 0.26153448939659563, 0.26079411791527557,
+  0.26005359301549513, 0.25931291513288635, 0.25857208470317039,
+  0.25783110216215893, 0.25708996794575323, 0.25634868248994291,
+  0.25560724623080755, 0.25486565960451463, 0.25412392304732062,
+  0.25338203699557027, 0.25264000188569558, 0.25189781815421691,
+  0.25115548623774203, 0.25041300657296528, 0.24967037959666852,
+  0.24892760574572026, 0.24818468545707478, 0.24744161916777344,
+  0.2466984073149425, 0.24595505033579459, 0.24521154866762768,
+  0.24446790274782421, 0.24372411301385213, 0.24298017990326398,
+  0.24223610385369604, 0.2414918853028693, 0.24074752468858854,
+  0.2400030224487415, 0.23925837902130012, 0.2385135948443185,
+  0.23776867035593421, 0.23702360599436734, 0.23627840219791962,
+  0.23553305940497546, 0.23478757805400108, 0.23404195858354346,
+  0.23329620143223156, 0.23255030703877533, 0.23180427584196478,
+  0.23105810828067128, 0.23031180479384553, 0.22956536582051887,
+  0.22881879179980236, 0.22807208317088579, 0.22732524037303883,
+  0.22657826384561011, 0.2258311540280262, 0.22508391135979278,
+  0.22433653628049369, 0.22358902922979002, 0.22284139064742128,
+  0.22209362097320359, 0.22134572064703081, 0.22059769010887365,
+  0.21984952979877875, 0.21910124015686977, 0.21835282162334643,
+  0.21760427463848367, 0.21685559964263257, 0.2161067970762196,
+  0.21535786737974555, 0.21460881099378692, 0.21385962835899383,
+  0.21311031991609136, 0.21236088610587858, 0.21161132736922761,
+  0.21086164414708483, 0.21011183688046972, 0.20936190601047419,
+  0.20861185197826346, 0.20786167522507515, 0.20711137619221856,
+  0.20636095532107568, 0.20561041305309932, 0.20485974982981442,
+  0.20410896609281701, 0.20335806228377337, 0.20260703884442111,
+  0.20185589621656816, 0.20110463484209196, 0.20035325516294042,
+  0.19960175762113105, 0.19885014265875012, 0.19809841071795373,
+  0.197346562240966, 0.19659459767008022, 0.19584251744765799,
+  0.19509032201612833, 0.1943380118179886, 0.19358558729580375,
+  0.19283304889220529, 0.19208039704989238, 0.19132763221163099,
+  0.1905747548202528, 0.18982176531865658, 0.18906866414980628,
+  0.18831545175673212, 0.18756212858252974, 0.18680869507035933,
+  0.18605515166344663, 0.18530149880508201, 0.18454773693861964,
+  0.18379386650747839, 0.18303988795514106, 0.18228580172515332,
+  0.18153160826112513, 0.18077730800672867, 0.18002290140569951,
+  0.17926838890183588, 0.17851377093899759, 0.17775904796110714,
+  0.17700422041214886, 0.17624928873616794, 0.17549425337727137,
+  0.17473911477962731, 0.17398387338746385, 0.17322852964507049,
+  0.17247308399679603, 0.17171753688704997, 0.17096188876030136,
+  0.17020614006107812, 0.16945029123396793, 0.16869434272361744,
+  0.16793829497473123, 0.16718214843207288, 0.16642590354046422,
+  0.16566956074478414, 0.16491312048997009, 0.16415658322101589,
+  0.16339994938297323, 0.16264321942095045, 0.16188639378011188,
+  0.16112947290567878, 0.1603724572429284, 0.15961534723719309,
+  0.15885814333386139, 0.15810084597837709, 0.15734345561623828,
+  0.15658597269299859, 0.15582839765426532, 0.15507073094570051,
+  0.15431297301302024, 0.1535551243019935, 0.15279718525844341,
+  0.15203915632824616, 0.15128103795733025, 0.15052283059167737,
+  0.14976453467732162, 0.14900615066034847, 0.1482476789868962,
+  0.14748912010315368, 0.14673047445536175, 0.14597174248981237,
+  0.14521292465284752, 0.14445402139086044, 0.14369503315029458,
+  0.1429359603776427, 0.142176803519448, 0.14141756302230313,
+  0.14065823933284924, 0.13989883289777738, 0.13913934416382628,
+  0.13837977357778389, 0.13762012158648618, 0.13686038863681643,
+  0.1361005751757062, 0.13534068165013433, 0.13458070850712622,
+  0.13382065619375469, 0.13306052515713918, 0.13230031584444468,
+  0.13154002870288328, 0.13077966417971179, 0.13001922272223335,
+  0.12925870477779627, 0.12849811079379322, 0.12773744121766228,
+  0.12697669649688598, 0.1262158770789904, 0.12545498341154621,
+  0.12469401594216777, 0.1239329751185122, 0.12317186138828065,
+  0.12241067519921628, 0.12164941699910554, 0.12088808723577722,
+  0.12012668635710158, 0.11936521481099135, 0.11860367304540084,
+  0.11784206150832502, 0.11708038064780055, 0.11631863091190488,
+  0.11555681274875529, 0.11479492660651025, 0.1140329729333673,
+  0.11327095217756436, 0.11250886478737883, 0.11174671121112666,
+  0.11098449189716338, 0.11022220729388318, 0.10945985784971803,
+  0.10869744401313867, 0.10793496623265376, 0.10717242495680887,
+  0.10640982063418784, 0.1056471537134107, 0.10488442464313497,
+  0.10412163387205473, 0.1033587818488997, 0.10259586902243628,
+  0.10183289584146667, 0.10106986275482788, 0.10030677021139282,
+  0.099543618660069444, 0.098780408549799664, 0.09801714032956077,
+  0.097253814448363354, 0.096490431355252607, 0.095726991499307315,
+  0.094963495329639061, 0.09419994329539319, 0.093436335845747912,
+  0.092672673429913366, 0.091908956497132696, 0.09114518549668113,
+  0.090381360877865011, 0.089617483090022917, 0.088853552582524684,
+  0.088089569804770507, 0.087325535206192226, 0.086561449236251239,
+  0.08579731234443988, 0.085033124980280414, 0.084268887593324127,
+  0.083504600633152404, 0.082740264549375803, 0.081975879791633108,
+  0.081211446809592386, 0.080446966052950097, 0.079682437971430126,
+  0.078917863014785095, 0.078153241632794315, 0.077388574275265049,
+  0.076623861392031617, 0.075859103432954503, 0.075094300847921291,
+  0.074329454086845867, 0.073564563599667454, 0.072799629836351618,
+  0.072034653246889416, 0.071269634281296415, 0.070504573389614009,
+  0.069739471021907376, 0.068974327628266732, 0.068209143658806454,
+  0.067443919563664106, 0.066678655793001543, 0.06591335279700393,
+  0.06514801102587886, 0.06438263092985741, 0.06361721295919319,
+  0.06285175756416142, 0.062086265195060247, 0.061320736302208648,
+  0.060555171335947781, 0.059789570746640007, 0.059023934984667986,
+  0.058258264500435732, 0.057492559744367684, 0.056726821166907783,
+  0.05596104921852052, 0.055195244349690031, 0.054429407010919147,
+  0.053663537652730679, 0.052897636725665401, 0.052131704680283317,
+  0.051365741967162731, 0.050599749036899337, 0.049833726340107257,
+  0.049067674327418126, 0.048301593449480172, 0.047535484156959261,
+  0.04676934690053796, 0.046003182130914644, 0.04523699029880475,
+  0.044470771854938744, 0.043704527250063421, 0.042938256934940959,
+  0.042171961360348002, 0.041405640977076712, 0.040639296235933854,
+  0.039872927587739845, 0.039106535483329839, 0.038340120373552791,
+  0.037573682709270514, 0.036807222941358991, 0.036040741520706299,
+  0.035274238898213947, 0.034507715524795889, 0.033741171851377642,
+  0.032974608328897315, 0.032208025408304704, 0.031441423540560343,
+  0.030674803176636581, 0.029908164767516655, 0.02914150876419374,
+  0.028374835617672258, 0.02760814577896582, 0.026841439699098527,
+  0.02607471782910404, 0.02530798062002463, 0.024541228522912264,
+  0.023774461988827676, 0.02300768146883941, 0.022240887414024919,
+  0.021474080275469605, 0.020707260504265912, 0.019940428551514598,
+  0.019173584868322699, 0.01840672990580482, 0.017639864115082195,
+  0.016872987947281773, 0.016106101853537263, 0.01533920628498822,
+  0.014572301692779104, 0.013805388528060349, 0.013038467241987433,
+  0.012271538285719944, 0.011504602110422875, 0.010737659167264572,
+  0.0099707099074180291, 0.0092037547820599599, 0.0084367942423698595,
+  0.0076698287395310771, 0.0069028587247298772, 0.0061358846491545152,
+  0.0053689069639963026, 0.004601926120448672, 0.0038349425697062479,
+  0.0030679567629661379, 0.0023009691514258865, 0.0015339801862847662,
+  0.00076699031874284641, 0, -0.00076699031874270449,
+  -0.0015339801862847655, -0.002300969151425805, -0.0030679567629659761,
+  -0.0038349425697062275, -0.0046019261204485705, -0.0053689069639963425,
+  -0.0061358846491544753, -0.0069028587247297558, -0.007669828739531097,
+  -0.0084367942423697988, -0.0092037547820598194, -0.0099707099074180308,
+  -0.010737659167264491, -0.011504602110422714, -0.012271538285719925,
+  -0.013038467241987334, -0.013805388528060391, -0.014572301692779064,
+  -0.0153392062849881, -0.016106101853537287, -0.01687298794728171,
+  -0.017639864115082053, -0.01840672990580482, -0.019173584868322623,
+  -0.019940428551514441, -0.020707260504265895, -0.021474080275469508,
+  -0.022240887414024961, -0.023007681468839369, -0.023774461988827555,
+  -0.024541228522912288, -0.025307980620024571, -0.026074717829103901,
+  -0.026841439699098531, -0.02760814577896574, -0.028374835617672099,
+  -0.029141508764193722, -0.029908164767516555, -0.030674803176636626,
+  -0.031441423540560301, -0.032208025408304586, -0.032974608328897335,
+  -0.03374117185137758, -0.03450771552479575, -0.035274238898213947,
+  -0.036040741520706229, -0.036807222941358832, -0.037573682709270494,
+  -0.038340120373552694, -0.039106535483329888, -0.039872927587739811,
+  -0.040639296235933736, -0.041405640977076739, -0.042171961360347947,
+  -0.04293825693494082, -0.043704527250063421, -0.044470771854938668,
+  -0.04523699029880459, -0.046003182130914623, -0.046769346900537863,
+  -0.047535484156959303, -0.048301593449480144, -0.049067674327418015,
+  -0.049833726340107277, -0.050599749036899282, -0.051365741967162593,
+  -0.052131704680283324, -0.052897636725665324, -0.05366353765273052,
+  -0.054429407010919133, -0.055195244349689934, -0.055961049218520569,
+  -0.056726821166907748, -0.057492559744367566, -0.058258264500435752,
+  -0.059023934984667931, -0.059789570746639868, -0.060555171335947788,
+  -0.061320736302208578, -0.062086265195060088, -0.062851757564161406,
+  -0.063617212959193106, -0.064382630929857465, -0.065148011025878833,
+  -0.065913352797003805, -0.066678655793001557, -0.067443919563664051,
+  -0.068209143658806329, -0.068974327628266746, -0.069739471021907307,
+  -0.070504573389613856, -0.071269634281296401, -0.072034653246889332,
+  -0.072799629836351673, -0.073564563599667426, -0.074329454086845756,
+  -0.075094300847921305, -0.075859103432954447, -0.076623861392031492,
+  -0.077388574275265049, -0.078153241632794232, -0.078917863014784942,
+  -0.079682437971430126, -0.080446966052950014, -0.081211446809592441,
+  -0.081975879791633066, -0.082740264549375692, -0.083504600633152432,
+  -0.084268887593324071, -0.085033124980280275, -0.085797312344439894,
+  -0.08656144923625117, -0.087325535206192059, -0.088089569804770507,
+  -0.0888535525825246, -0.089617483090022959, -0.090381360877864983,
+  -0.091145185496681005, -0.091908956497132724, -0.09267267342991331,
+  -0.093436335845747787, -0.094199943295393204, -0.094963495329638992,
+  -0.095726991499307162, -0.096490431355252593, -0.097253814448363271,
+  -0.098017140329560604, -0.098780408549799623, -0.099543618660069319,
+  -0.10030677021139286, -0.10106986275482782, -0.10183289584146653,
+  -0.10259586902243628, -0.10335878184889961, -0.10412163387205459,
+  -0.10488442464313497, -0.10564715371341062, -0.10640982063418768,
+  -0.10717242495680884, -0.10793496623265365, -0.10869744401313872,
+  -0.10945985784971798, -0.11022220729388306, -0.11098449189716339,
+  -0.11174671121112659, -0.11250886478737869, -0.11327095217756435,
+  -0.1140329729333672, -0.11479492660651008, -0.11555681274875526,
+  -0.11631863091190475, -0.11708038064780059, -0.11784206150832498,
+  -0.11860367304540072, -0.11936521481099135, -0.1201266863571015,
+  -0.12088808723577708, -0.12164941699910553, -0.1224106751992162,
+  -0.12317186138828048, -0.12393297511851216, -0.12469401594216764,
+  -0.12545498341154623, -0.12621587707899035, -0.12697669649688587,
+  -0.12773744121766231, -0.12849811079379317, -0.12925870477779614,
+  -0.13001922272223335, -0.13077966417971171, -0.13154002870288312,
+  -0.13230031584444465, -0.13306052515713906, -0.13382065619375472,
+  -0.13458070850712617, -0.13534068165013421, -0.1361005751757062,
+  -0.13686038863681638, -0.13762012158648604, -0.13837977357778389,
+  -0.1391393441638262, -0.13989883289777721, -0.14065823933284921,
+  -0.14141756302230302, -0.14217680351944803, -0.14293596037764267,
+  -0.14369503315029447, -0.14445402139086047, -0.14521292465284746,
+  -0.14597174248981221, -0.14673047445536175, -0.14748912010315357,
+  -0.14824767898689603, -0.14900615066034845, -0.14976453467732151,
+  -0.1505228305916774, -0.15128103795733022, -0.15203915632824605,
+  -0.15279718525844344, -0.15355512430199345, -0.1543129730130201,
+  -0.15507073094570051, -0.15582839765426523, -0.15658597269299843,
+  -0.15734345561623825, -0.15810084597837698, -0.15885814333386145,
+  -0.15961534723719306, -0.16037245724292828, -0.16112947290567881,
+  -0.16188639378011183, -0.16264321942095031, -0.16339994938297323,
+  -0.16415658322101581, -0.16491312048996992, -0.16566956074478412,
+  -0.1664259035404641, -0.16718214843207294, -0.16793829497473117,
+  -0.16869434272361733, -0.16945029123396796, -0.17020614006107807,
+  -0.17096188876030122, -0.17171753688704997, -0.17247308399679595,
+  -0.17322852964507032, -0.17398387338746382, -0.1747391147796272,
+  -0.17549425337727143, -0.17624928873616791, -0.17700422041214875,
+  -0.17775904796110717, -0.17851377093899751, -0.17926838890183575,
+  -0.18002290140569951, -0.18077730800672859, -0.18153160826112497,
+  -0.1822858017251533, -0.18303988795514095, -0.18379386650747845,
+  -0.18454773693861962, -0.1853014988050819, -0.18605515166344663,
+  -0.18680869507035927, -0.1875621285825296, -0.18831545175673212,
+  -0.18906866414980619, -0.18982176531865641, -0.19057475482025274,
+  -0.1913276322116309, -0.19208039704989244, -0.19283304889220523,
+  -0.19358558729580361, -0.1943380118179886, -0.19509032201612825,
+  -0.19584251744765785, -0.19659459767008022, -0.19734656224096592,
+  -0.19809841071795356, -0.19885014265875009, -0.19960175762113097,
+  -0.20035325516294045, -0.2011046348420919, -0.20185589621656805,
+  -0.20260703884442113, -0.20335806228377332, -0.20410896609281687,
+  -0.20485974982981442, -0.20561041305309924, -0.20636095532107551,
+  -0.20711137619221856, -0.20786167522507507, -0.20861185197826349,
+  -0.20936190601047416, -0.21011183688046961, -0.21086164414708486,
+  -0.21161132736922755, -0.21236088610587842, -0.21311031991609136,
+  -0.21385962835899375, -0.21460881099378676, -0.21535786737974555,
+  -0.21610679707621952, -0.21685559964263262, -0.21760427463848364,
+  -0.21835282162334632, -0.2191012401568698, -0.2198495297987787,
+  -0.22059769010887351, -0.22134572064703081, -0.22209362097320351,
+  -0.22284139064742112, -0.22358902922978999, -0.2243365362804936,
+  -0.22508391135979283, -0.22583115402802617, -0.22657826384561,
+  -0.22732524037303886, -0.22807208317088573, -0.22881879179980222,
+  -0.22956536582051887, -0.23031180479384544, -0.23105810828067111,
+  -0.23180427584196478, -0.23255030703877524, -0.23329620143223159,
+  -0.23404195858354343, -0.23478757805400097, -0.23553305940497549,
+  -0.23627840219791957, -0.2370236059943672, -0.23776867035593419,
+  -0.23851359484431842, -0.23925837902129998, -0.2400030224487415,
+  -0.24074752468858843, -0.24149188530286933, -0.24223610385369601,
+  -0.24298017990326387, -0.24372411301385216, -0.24446790274782415,
+  -0.24521154866762754, -0.24595505033579459, -0.24669840731494241,
+  -0.24744161916777327, -0.24818468545707478, -0.24892760574572015,
+  -0.24967037959666855, -0.25041300657296522, -0.25115548623774192,
+  -0.25189781815421697, -0.25264000188569552, -0.25338203699557016,
+  -0.25412392304732062, -0.25486565960451457, -0.25560724623080738,
+  -0.25634868248994291, -0.25708996794575312, -0.25783110216215899,
+  -0.25857208470317034, -0.25931291513288623, -0.26005359301549519,
+  -0.26079411791527551, -0.26153448939659552, -0.26227470702391359,
+  -0.263014770361779, -0.26375467897483135, -0.26449443242780163,
+  -0.26523403028551179, -0.26597347211287559, -0.26671275747489837,
+  -0.26745188593667762, -0.26819085706340318, -0.26892967042035726,
+  -0.26966832557291509, -0.27040682208654482, -0.27114515952680801,
+  -0.27188333745935972, -0.27262135544994898, -0.27335921306441868,
+  -0.27409690986870638, -0.27483444542884394, -0.27557181931095814,
+  -0.27630903108127108, -0.2770460803060999, -0.27778296655185769,
+  -0.27851968938505306, -0.27925624837229118, -0.27999264308027322,
+  -0.28072887307579719, -0.28146493792575794, -0.28220083719714756,
+  -0.28293657045705539, -0.28367213727266843, -0.28440753721127188,
+  -0.28514276984024867, -0.28587783472708062, -0.28661273143934779,
+  -0.28734745954472951, -0.28808201861100413, -0.28881640820604948,
+  -0.28955062789784303, -0.29028467725446233, -0.29101855584408509,
+  -0.29175226323498926, -0.29248579899555388, -0.29321916269425863,
+  -0.29395235389968466, -0.29468537218051433, -0.29541821710553201,
+  -0.29615088824362379, -0.29688338516377827, -0.2976157074350862,
+  -0.2983478546267414, -0.29907982630804048, -0.29981162204838335,
+  -0.30054324141727345, -0.30127468398431795, -0.30200594931922808,
+  -0.30273703699181914, -0.30346794657201132, -0.30419867762982911,
+  -0.30492922973540237, -0.30565960245896612, -0.30638979537086092,
+  -0.3071198080415331, -0.30784964004153487, -0.30857929094152509,
+  -0.30930876031226873, -0.31003804772463789, -0.31076715274961147,
+  -0.31149607495827591, -0.31222481392182488, -0.3129533692115602,
+  -0.31368174039889152, -0.31440992705533666, -0.31513792875252244,
+  -0.31586574506218396, -0.31659337555616585, -0.31732081980642174,
+  -0.31804807738501495, -0.31877514786411848, -0.31950203081601569,
+  -0.32022872581309986, -0.32095523242787521, -0.32168155023295658,
+  -0.32240767880106985, -0.32313361770505233, -0.32385936651785285,
+  -0.32458492481253215, -0.32531029216226293, -0.32603546814033024,
+  -0.32676045232013173, -0.327485244275178, -0.3282098435790925,
+  -0.3289342498056122, -0.32965846252858749, -0.33038248132198278,
+  -0.33110630575987643, -0.33182993541646111, -0.33255336986604422,
+  -0.33327660868304793, -0.33399965144200938, -0.33472249771758122,
+  -0.3354451470845316, -0.33616759911774452, -0.33688985339222005,
+  -0.33761190948307462, -0.33833376696554113, -0.33905542541496964,
+  -0.33977688440682685, -0.34049814351669716, -0.34121920232028236,
+  -0.34194006039340219, -0.34266071731199438, -0.34338117265211504,
+  -0.34410142598993881, -0.34482147690175929, -0.34554132496398909,
+  -0.34626096975316001, -0.34698041084592368, -0.34769964781905138,
+  -0.34841868024943456, -0.34913750771408497, -0.34985612979013492,
+  -0.35057454605483751, -0.35129275608556709, -0.35201075945981908,
+  -0.35272855575521073, -0.35344614454948081, -0.35416352542049034,
+  -0.35488069794622279, -0.35559766170478385, -0.35631441627440241,
+  -0.35703096123342998, -0.3577472961603419, -0.35846342063373654,
+  -0.3591793342323365, -0.35989503653498811, -0.36061052712066227,
+  -0.36132580556845428, -0.36204087145758418, -0.36275572436739723,
+  -0.36347036387736376, -0.36418478956707989, -0.36489900101626732,
+  -0.36561299780477385, -0.36632677951257359, -0.36704034571976718,
+  -0.36775369600658198, -0.36846682995337232, -0.36917974714062002,
+  -0.3698924471489341, -0.37060492955905167, -0.37131719395183754,
+  -0.37202923990828501, -0.37274106700951576, -0.3734526748367803,
+  -0.37416406297145793, -0.37487523099505754, -0.37558617848921722,
+  -0.37629690503570479, -0.37700741021641826, -0.37771769361338564,
+  -0.37842775480876556, -0.37913759338484732, -0.37984720892405116,
+  -0.38055660100892852, -0.38126576922216238, -0.38197471314656722,
+  -0.38268343236508978, -0.38339192646080866, -0.38410019501693504,
+  -0.38480823761681288, -0.38551605384391885, -0.38622364328186298,
+  -0.38693100551438858, -0.38763814012537273, -0.38834504669882625,
+  -0.38905172481889438, -0.38975817406985641, -0.39046439403612659,
+  -0.39117038430225387, -0.39187614445292235, -0.39258167407295147,
+  -0.3932869727472964, -0.3939920400610481, -0.39469687559943356,
+  -0.39540147894781635, -0.39610584969169627, -0.39680998741671031,
+  -0.39751389170863233, -0.39821756215337356, -0.39892099833698291,
+  -0.39962419984564679, -0.40032716626569009, -0.40102989718357562,
+  -0.40173239218590501, -0.40243465085941843, -0.4031366727909953,
+  -0.40383845756765407, -0.404540004776553, -0.40524131400498986,
+  -0.40594238484040251, -0.40664321687036903, -0.40734380968260797,
+  -0.40804416286497869, -0.40874427600548136, -0.40944414869225759,
+  -0.41014378051359024, -0.41084317105790391, -0.41154231991376522,
+  -0.41224122666988289, -0.41293989091510808, -0.4136383122384345,
+  -0.4143364902289991, -0.41503442447608163, -0.41573211456910536,
+  -0.41642956009763715, -0.41712676065138787, -0.41782371582021227,
+  -0.4185204251941097, -0.41921688836322391, -0.41991310491784362,
+  -0.42060907444840251, -0.42130479654547964, -0.42200027079979968,
+  -0.42269549680223295, -0.42339047414379605, -0.42408520241565156,
+  -0.42477968120910881, -0.4254739101156238, -0.42616788872679962,
+  -0.42686161663438643, -0.42755509343028208, -0.42824831870653196,
+  -0.42894129205532949, -0.42963401306901638, -0.43032648134008261,
+  -0.43101869646116703, -0.43171065802505726, -0.43240236562469014,
+  -0.43309381885315196, -0.43378501730367852, -0.43447596056965565,
+  -0.43516664824461926, -0.43585707992225547, -0.4365472551964012,
+  -0.43723717366104409, -0.43792683491032286, -0.43861623853852766,
+  -0.43930538414009995, -0.43999427130963326, -0.4406828996418729,
+  -0.44137126873171667, -0.4420593781742147, -0.44274722756457002,
+  -0.44343481649813848, -0.4441221445704292, -0.44480921137710488,
+  -0.44549601651398174, -0.44618255957703007, -0.44686884016237416,
+  -0.44755485786629301, -0.44824061228521989, -0.44892610301574326,
+  -0.44961132965460654, -0.45029629179870861, -0.45098098904510386,
+  -0.45166542099100249, -0.45234958723377089, -0.45303348737093158,
+  -0.45371712100016387, -0.45440048771930358, -0.45508358712634384,
+  -0.45576641881943464, -0.45644898239688392, -0.45713127745715698,
+  -0.45781330359887717, -0.45849506042082627, -0.45917654752194409,
+  -0.45985776450132954, -0.46053871095824001, -0.46121938649209238,
+  -0.46189979070246273, -0.46257992318908681, -0.46325978355186015,
+  -0.46393937139083852, -0.46461868630623782, -0.4652977278984346,
+  -0.46597649576796618, -0.46665498951553092, -0.46733320874198842,
+  -0.46801115304835983, -0.4686888220358279, -0.46936621530573752,
+  -0.47004333245959562, -0.4707201730990716, -0.47139673682599764,
+  -0.47207302324236866, -0.47274903195034279, -0.47342476255224153,
+  -0.47410021465054997, -0.47477538784791712, -0.47545028174715587,
+  -0.47612489595124358, -0.47679923006332209, -0.47747328368669806,
+  -0.47814705642484301, -0.47882054788139389, -0.47949375766015301,
+  -0.48016668536508839, -0.48083933060033396, -0.48151169297018986,
+  -0.48218377207912272, -0.48285556753176567, -0.48352707893291874,
+  -0.48419830588754903, -0.48486924800079106, -0.48553990487794696,
+  -0.48621027612448642, -0.48688036134604734, -0.487550160148436,
+  -0.48821967213762679, -0.48888889691976317, -0.48955783410115744,
+  -0.49022648328829116, -0.49089484408781509, -0.4915629161065499,
+  -0.49223069895148602, -0.49289819222978404, -0.49356539554877477,
+  -0.49423230851595967, -0.49489893073901126, -0.49556526182577254,
+  -0.49623130138425825, -0.49689704902265447, -0.49756250434931915,
+  -0.49822766697278187, -0.49889253650174459, -0.49955711254508184,
+  -0.50022139471184068, -0.50088538261124071, -0.50154907585267539,
+  -0.50221247404571079, -0.50287557680008699, -0.50353838372571758,
+  -0.50420089443269034, -0.50486310853126759, -0.50552502563188539,
+  -0.50618664534515523, -0.50684796728186321, -0.50750899105297087,
+  -0.5081697162696146, -0.50883014254310699, -0.50949026948493636,
+  -0.51015009670676681, -0.51080962382043904, -0.5114688504379703,
+  -0.51212777617155469, -0.51278640063356296, -0.51344472343654346,
+  -0.51410274419322166, -0.5147604625165012, -0.51541787801946293,
+  -0.51607499031536663, -0.51673179901764987, -0.51738830373992906,
+  -0.51804450409599934, -0.51870039969983495, -0.51935599016558964,
+  -0.52001127510759604, -0.52066625414036716, -0.52132092687859566,
+  -0.52197529293715439, -0.52262935193109661, -0.52328310347565643,
+  -0.5239365471862486, -0.52458968267846895, -0.52524250956809471,
+  -0.52589502747108463, -0.52654723600357944, -0.52719913478190128,
+  -0.52785072342255523, -0.52850200154222848, -0.52915296875779061,
+  -0.52980362468629461, -0.53045396894497632, -0.531104001151255,
+  -0.53175372092273332, -0.5324031278771979, -0.53305222163261945,
+  -0.53370100180715296, -0.53434946801913752, -0.53499761988709715,
+  -0.53564545702974109, -0.53629297906596318, -0.53694018561484291,
+  -0.53758707629564539, -0.5382336507278217, -0.53887990853100842,
+  -0.53952584932502889, -0.54017147272989285, -0.54081677836579667,
+  -0.54146176585312344, -0.54210643481244392, -0.54275078486451589,
+  -0.5433948156302848, -0.54403852673088382, -0.54468191778763453,
+  -0.54532498842204646, -0.54596773825581757, -0.54661016691083486,
+  -0.54725227400917409, -0.54789405917310019, -0.54853552202506739,
+  -0.54917666218771966, -0.54981747928389091, -0.55045797293660481,
+  -0.55109814276907543, -0.55173798840470734, -0.55237750946709607,
+  -0.55301670558002747, -0.55365557636747931, -0.55429412145362,
+  -0.55493234046281037, -0.55557023301960218, -0.55620779874873993,
+  -0.5568450372751601, -0.55748194822399155, -0.5581185312205561,
+  -0.55875478589036831, -0.55939071185913614, -0.56002630875276038,
+  -0.56066157619733603, -0.56129651381915147, -0.56193112124468947,
+  -0.56256539810062656, -0.56319934401383409, -0.56383295861137817,
+  -0.5644662415205195, -0.56509919236871398, -0.56573181078361312,
+  -0.56636409639306384, -0.56699604882510868, -0.56762766770798623,
+  -0.56825895267013149, -0.56888990334017586, -0.56952051934694714,
+  -0.5701508003194703, -0.57078074588696726, -0.57141035567885723,
+  -0.57203962932475705, -0.57266856645448116, -0.5732971666980422,
+  -0.57392542968565075, -0.57455335504771576, -0.57518094241484508,
+  -0.57580819141784534, -0.57643510168772183, -0.57706167285567944,
+  -0.5776879045531228, -0.57831379641165559, -0.57893934806308178,
+  -0.57956455913940563, -0.58018942927283168, -0.58081395809576453,
+  -0.58143814524081017, -0.58206199034077544, -0.58268549302866846,
+  -0.58330865293769829, -0.58393146970127618, -0.58455394295301533,
+  -0.58517607232673041, -0.58579785745643886, -0.5864192979763605,
+  -0.58704039352091797, -0.58766114372473666, -0.58828154822264522,
+  -0.58890160664967572, -0.58952131864106394, -0.59014068383224882,
+  -0.59075970185887416, -0.59137837235678758, -0.59199669496204099,
+  -0.59261466931089113, -0.5932322950397998, -0.59384957178543363,
+  -0.59446649918466443, -0.59508307687456996, -0.59569930449243336,
+  -0.59631518167574371, -0.5969307080621965, -0.59754588328969316,
+  -0.59816070699634227, -0.59877517882045872, -0.59938929840056454,
+  -0.60000306537538894, -0.60061647938386897, -0.6012295400651485,
+  -0.60184224705858003, -0.60245460000372375, -0.60306659854034816,
+  -0.60367824230843037, -0.60428953094815596, -0.60490046409991982,
+  -0.60551104140432555, -0.60612126250218612, -0.60673112703452448,
+  -0.60734063464257293, -0.60794978496777363, -0.60855857765177945,
+  -0.60916701233645321, -0.60977508866386843, -0.61038280627630948,
+  -0.61099016481627166, -0.61159716392646191, -0.61220380324979795,
+  -0.61281008242940971, -0.61341600110863859, -0.61402155893103838,
+  -0.61462675554037505, -0.61523159058062682, -0.61583606369598509,
+  -0.61644017453085365, -0.61704392272984976, -0.61764730793780387,
+  -0.61825032979976025, -0.61885298796097632, -0.61945528206692402,
+  -0.6200572117632891, -0.62065877669597214, -0.62125997651108755,
+  -0.62186081085496536, -0.62246127937414997, -0.62306138171540126,
+  -0.62366111752569453, -0.62426048645222065, -0.62485948814238634,
+  -0.62545812224381436, -0.62605638840434352, -0.62665428627202935,
+  -0.62725181549514408, -0.62784897572217646, -0.62844576660183271,
+  -0.629042187783036, -0.62963823891492698, -0.63023391964686437,
+  -0.63082922962842447, -0.63142416850940186, -0.63201873593980906,
+  -0.63261293156987741, -0.63320675505005719, -0.63380020603101728,
+  -0.63439328416364549, -0.63498598909904946, -0.63557832048855611,
+  -0.63617027798371217, -0.6367618612362842, -0.63735306989825913,
+  -0.63794390362184406, -0.63853436205946679, -0.63912444486377573,
+  -0.63971415168764045, -0.64030348218415167, -0.64089243600662138,
+  -0.64148101280858316, -0.64206921224379254, -0.64265703396622686,
+  -0.64324447763008585, -0.64383154288979139, -0.64441822939998838,
+  -0.64500453681554393, -0.64559046479154869, -0.64617601298331628,
+  -0.64676118104638392, -0.64734596863651206, -0.64793037540968534,
+  -0.64851440102211244, -0.64909804513022595, -0.64968130739068319,
+  -0.65026418746036585, -0.65084668499638088, -0.65142879965605982,
+  -0.6520105310969595, -0.65259187897686244, -0.65317284295377676,
+  -0.65375342268593606, -0.65433361783180044, -0.65491342805005603,
+  -0.65549285299961535, -0.6560718923396176, -0.65665054572942894,
+  -0.65722881282864254, -0.65780669329707864, -0.65838418679478505,
+  -0.65896129298203732, -0.65953801151933866, -0.66011434206742048,
+  -0.6606902842872423, -0.66126583783999227, -0.66184100238708687,
+  -0.66241577759017178, -0.66299016311112147, -0.66356415861203977,
+  -0.66413776375526001, -0.66471097820334479, -0.66528380161908718,
+  -0.66585623366550972, -0.66642827400586524, -0.66699992230363747,
+  -0.66757117822254031, -0.66814204142651845, -0.66871251157974798,
+  -0.66928258834663601, -0.66985227139182102, -0.67042156038017309,
+  -0.67099045497679422, -0.67155895484701833, -0.67212705965641173,
+  -0.67269476907077286, -0.67326208275613297, -0.67382900037875604,
+  -0.67439552160513905, -0.67496164610201193, -0.67552737353633852,
+  -0.67609270357531592, -0.67665763588637495, -0.67722217013718033,
+  -0.6777863059956315, -0.67835004312986147, -0.67891338120823841,
+  -0.67947631989936497, -0.68003885887207893, -0.68060099779545302,
+  -0.68116273633879543, -0.68172407417164971, -0.68228501096379557,
+  -0.68284554638524808, -0.68340568010625868, -0.6839654117973154,
+  -0.6845247411291423, -0.68508366777270036, -0.68564219139918747,
+  -0.68620031168003859, -0.68675802828692589, -0.68731534089175905,
+  -0.68787224916668555, -0.68842875278409044, -0.68898485141659704,
+  -0.68954054473706683, -0.69009583241859995, -0.6906507141345346,
+  -0.69120518955844845, -0.69175925836415775, -0.69231292022571822,
+  -0.69286617481742463, -0.69341902181381176, -0.693971460889654,
+  -0.69452349171996552, -0.69507511398000088, -0.69562632734525487,
+  -0.69617713149146299, -0.6967275260946012, -0.69727751083088652,
+  -0.69782708537677729, -0.69837624940897292, -0.69892500260441415,
+  -0.69947334464028377, -0.70002127519400625, -0.70056879394324834,
+  -0.70111590056591866, -0.70166259474016845, -0.70220887614439187,
+  -0.7027547444572253, -0.70330019935754873, -0.70384524052448494,
+  -0.70438986763740041, -0.70493408037590488, -0.7054778784198521,
+  -0.70602126144933974, -0.70656422914470951, -0.70710678118654746,
+  -0.70764891725568435, -0.70819063703319529, -0.70873194020040065,
+  -0.70927282643886558, -0.70981329543040084, -0.71035334685706231,
+  -0.71089298040115168, -0.71143219574521643, -0.71197099257204999,
+  -0.71250937056469232, -0.71304732940642923, -0.71358486878079352,
+  -0.71412198837156471, -0.71465868786276898, -0.71519496693868001,
+  -0.71573082528381859, -0.71626626258295312, -0.71680127852109954,
+  -0.71733587278352173, -0.71787004505573171, -0.71840379502348972,
+  -0.71893712237280438, -0.71947002678993299, -0.72000250796138165,
+  -0.72053456557390527, -0.72106619931450811, -0.72159740887044366,
+  -0.72212819392921535, -0.72265855417857561, -0.72318848930652735,
+  -0.72371799900132339, -0.72424708295146689, -0.72477574084571128,
+  -0.72530397237306066, -0.72583177722277037, -0.72635915508434601,
+  -0.72688610564754497, -0.72741262860237577, -0.72793872363909862,
+  -0.7284643904482252, -0.72898962872051931, -0.7295144381469969,
+  -0.73003881841892615, -0.73056276922782759, -0.73108629026547423,
+  -0.73160938122389252, -0.73213204179536129, -0.73265427167241282,
+  -0.73317607054783274, -0.73369743811466026, -0.73421837406618817,
+  -0.73473887809596339, -0.73525894989778673, -0.73577858916571348,
+  -0.73629779559405306, -0.73681656887736979, -0.73733490871048279,
+  -0.73785281478846598, -0.73837028680664851, -0.73888732446061511,
+  -0.73940392744620576, -0.73992009545951609, -0.74043582819689802,
+  -0.74095112535495911, -0.74146598663056329, -0.74198041172083096,
+  -0.74249440032313918, -0.74300795213512172, -0.74352106685466912,
+  -0.74403374417992918, -0.74454598380930725, -0.74505778544146595,
+  -0.74556914877532543, -0.74608007351006378, -0.74659055934511731,
+  -0.74710060598018013, -0.74761021311520515, -0.74811938045040349,
+  -0.74862810768624533, -0.74913639452345926, -0.74964424066303348,
+  -0.75015164580621496, -0.75065860965451059, -0.75116513190968637,
+  -0.75167121227376843, -0.7521768504490427, -0.75268204613805523,
+  -0.75318679904361241, -0.75369110886878121, -0.75419497531688917,
+  -0.75469839809152439, -0.75520137689653655, -0.75570391143603588,
+  -0.75620600141439454, -0.75670764653624567, -0.75720884650648446,
+  -0.75770960103026808, -0.75820990981301528, -0.75870977256040739,
+  -0.75920918897838796, -0.75970815877316344, -0.76020668165120242,
+  -0.76070475731923692, -0.76120238548426178, -0.76169956585353527,
+  -0.7621962981345789, -0.76269258203517787, -0.76318841726338127,
+  -0.76368380352750187, -0.76417874053611667, -0.76467322799806714,
+  -0.76516726562245896, -0.76566085311866239, -0.76615399019631281,
+  -0.76664667656531038, -0.7671389119358204, -0.76763069601827327,
+  -0.76812202852336531, -0.76861290916205827, -0.76910333764557959,
+  -0.76959331368542294, -0.7700828369933479, -0.7705719072813807,
+  -0.77106052426181371, -0.7715486876472063, -0.77203639715038441,
+  -0.77252365248444133, -0.77301045336273699, -0.77349679949889905,
+  -0.77398269060682279, -0.77446812640067086, -0.77495310659487382,
+  -0.77543763090413043, -0.77592169904340758, -0.77640531072794039,
+  -0.77688846567323244, -0.7773711635950562, -0.77785340420945304,
+  -0.77833518723273309, -0.77881651238147587, -0.7792973793725303,
+  -0.77977778792301444, -0.78025773775031659, -0.78073722857209438,
+  -0.78121626010627609, -0.78169483207105939, -0.7821729441849129,
+  -0.78265059616657573, -0.78312778773505731, -0.7836045186096382,
+  -0.78408078850986995, -0.78455659715557524, -0.78503194426684808,
+  -0.78550682956405393, -0.78598125276783015, -0.78645521359908577,
+  -0.7869287117790017, -0.78740174702903132, -0.78787431907090011,
+  -0.78834642762660623, -0.78881807241842017, -0.78928925316888565,
+  -0.78975996960081907, -0.79023022143731003, -0.79070000840172161,
+  -0.79116933021769009, -0.79163818660912577, -0.79210657730021239,
+  -0.79257450201540758, -0.79304196047944364, -0.79350895241732666,
+  -0.79397547755433717, -0.79444153561603059, -0.79490712632823701,
+  -0.79537224941706119, -0.79583690460888346, -0.79630109163035911,
+  -0.79676481020841872, -0.7972280600702687, -0.79769084094339104,
+  -0.79815315255554375, -0.79861499463476082, -0.79907636690935235,
+  -0.79953726910790501, -0.79999770095928191, -0.80045766219262271,
+  -0.8009171525373443, -0.80137617172314013, -0.80183471947998131,
+  -0.80229279553811572, -0.80275039962806916, -0.80320753148064483,
+  -0.80366419082692409, -0.8041203773982657, -0.804576090926307,
+  -0.80503133114296366, -0.80548609778042912, -0.80594039057117628,
+  -0.80639420924795624, -0.80684755354379922, -0.80730042319201445,
+  -0.80775281792619036, -0.80820473748019472, -0.80865618158817498,
+  -0.80910714998455813, -0.80955764240405126, -0.81000765858164114,
+  -0.81045719825259477, -0.81090626115245967, -0.81135484701706373,
+  -0.81180295558251536, -0.81225058658520388, -0.81269773976179949,
+  -0.81314441484925359, -0.81359061158479851, -0.8140363297059483,
+  -0.81448156895049861, -0.81492632905652662, -0.81537060976239129,
+  -0.81581441080673378, -0.81625773192847739, -0.81670057286682785,
+  -0.81714293336127297, -0.81758481315158371, -0.81802621197781344,
+  -0.81846712958029866, -0.81890756569965895, -0.8193475200767969,
+  -0.81978699245289899, -0.82022598256943469, -0.82066449016815746,
+  -0.82110251499110465, -0.82154005678059761, -0.82197711527924155,
+  -0.82241369022992639, -0.82284978137582632, -0.82328538846040011,
+  -0.82372051122739132, -0.82415514942082857, -0.82458930278502529,
+  -0.82502297106458022, -0.82545615400437744, -0.82588885134958678,
+  -0.82632106284566342, -0.82675278823834852, -0.82718402727366902,
+  -0.8276147796979384, -0.8280450452577558, -0.82847482370000713,
+  -0.82890411477186487, -0.82933291822078825, -0.82976123379452305,
+  -0.83018906124110237, -0.8306164003088462, -0.83104325074636232,
+  -0.83146961230254524, -0.83189548472657759, -0.83232086776792968,
+  -0.83274576117635946, -0.83317016470191319, -0.83359407809492514,
+  -0.83401750110601813, -0.83444043348610319, -0.83486287498638001,
+  -0.83528482535833737, -0.8357062843537526, -0.83612725172469216,
+  -0.83654772722351189, -0.83696771060285702, -0.83738720161566194,
+  -0.83780620001515094, -0.83822470555483797, -0.8386427179885273,
+  -0.83906023707031263, -0.83947726255457855, -0.83989379419599941,
+  -0.84030983174954077, -0.84072537497045807, -0.84114042361429808,
+  -0.84155497743689833, -0.84196903619438768, -0.84238259964318596,
+  -0.84279566754000412, -0.84320823964184544, -0.84362031570600404,
+  -0.84403189549006641, -0.84444297875191066, -0.84485356524970701,
+  -0.84526365474191822, -0.84567324698729907, -0.84608234174489694,
+  -0.84649093877405202, -0.84689903783439735, -0.84730663868585832,
+  -0.84771374108865427, -0.84812034480329712, -0.84852644959059265,
+  -0.84893205521163961, -0.84933716142783067, -0.84974176800085244,
+  -0.85014587469268521, -0.85054948126560337, -0.85095258748217573,
+  -0.8513551931052652, -0.85175729789802912, -0.85215890162391983,
+  -0.85256000404668397, -0.85296060493036363, -0.85336070403929543,
+  -0.8537603011381113, -0.85415939599173873, -0.85455798836540053,
+  -0.85495607802461482, -0.85535366473519603, -0.85575074826325392,
+  -0.85614732837519447, -0.85654340483771996, -0.85693897741782865,
+  -0.85733404588281559, -0.85772861000027212, -0.85812266953808602,
+  -0.85851622426444274, -0.8589092739478239, -0.85930181835700836,
+  -0.85969385726107261, -0.86008539042939014, -0.86047641763163207,
+  -0.86086693863776731, -0.86125695321806206, -0.8616464611430813,
+  -0.86203546218368721, -0.8624239561110405, -0.86281194269660033,
+  -0.86319942171212416, -0.86358639292966799, -0.8639728561215867,
+  -0.86435881106053403, -0.86474425751946238, -0.86512919527162369,
+  -0.86551362409056898, -0.86589754375014882, -0.86628095402451299,
+  -0.86666385468811102, -0.86704624551569265, -0.86742812628230692,
+  -0.86780949676330321, -0.86819035673433131, -0.8685707059713409,
+  -0.86895054425058238, -0.86932987134860673, -0.86970868704226556,
+  -0.87008699110871135, -0.87046478332539767, -0.87084206347007886,
+  -0.8712188313208109, -0.87159508665595109, -0.8719708292541577,
+  -0.87234605889439154, -0.8727207753559143, -0.87309497841829009,
+  -0.87346866786138488, -0.87384184346536675, -0.8742145050107063,
+  -0.87458665227817611, -0.87495828504885154, -0.87532940310411078,
+  -0.8757000062256346, -0.8760700941954066, -0.87643966679571361,
+  -0.87680872380914576, -0.87717726501859594, -0.87754529020726124,
+  -0.87791279915864173, -0.87827979165654146, -0.87864626748506813,
+  -0.87901222642863341, -0.87937766827195318, -0.87974259280004741,
+  -0.88010699979824036, -0.88047088905216075, -0.88083426034774204,
+  -0.88119711347122198, -0.88155944820914378, -0.88192126434835494,
+  -0.8822825616760086, -0.88264333997956279, -0.88300359904678072,
+  -0.88336333866573158, -0.88372255862478966, -0.88408125871263499,
+  -0.8844394387182537, -0.88479709843093779, -0.88515423764028511,
+  -0.88551085613619995, -0.88586695370889279, -0.88622253014888064,
+  -0.88657758524698704, -0.88693211879434208, -0.88728613058238315,
+  -0.88763962040285393, -0.88799258804780556, -0.88834503330959624,
+  -0.88869695598089171, -0.88904835585466457, -0.88939923272419552,
+  -0.88974958638307289, -0.89009941662519221, -0.89044872324475788,
+  -0.89079750603628149, -0.89114576479458318, -0.89149349931479138,
+  -0.89184070939234272, -0.89218739482298248, -0.89253355540276469,
+  -0.89287919092805168, -0.89322430119551532, -0.89356888600213602,
+  -0.89391294514520325, -0.89425647842231604, -0.89459948563138258,
+  -0.89494196657062075, -0.89528392103855758, -0.89562534883403,
+  -0.89596624975618511, -0.89630662360447966, -0.89664647017868015,
+  -0.89698578927886397, -0.89732458070541832, -0.89766284425904075,
+  -0.89800057974073988, -0.89833778695183419, -0.89867446569395382,
+  -0.89901061576903907, -0.89934623697934146, -0.89968132912742393,
+  -0.90001589201616028, -0.9003499254487356, -0.90068342922864686,
+  -0.90101640315970233, -0.90134884704602203, -0.90168076069203773,
+  -0.90201214390249307, -0.9023429964824442, -0.90267331823725883,
+  -0.90300310897261704, -0.90333236849451182, -0.90366109660924798,
+  -0.90398929312344334, -0.90431695784402832, -0.90464409057824624,
+  -0.90497069113365325, -0.90529675931811882, -0.90562229493982516,
+  -0.90594729780726846, -0.90627176772925766, -0.90659570451491533,
+  -0.90691910797367803, -0.90724197791529593, -0.90756431414983252,
+  -0.90788611648766615, -0.9082073847394887, -0.90852811871630612,
+  -0.90884831822943912, -0.90916798309052227, -0.90948711311150543,
+  -0.90980570810465222, -0.91012376788254157, -0.91044129225806714,
+  -0.91075828104443757, -0.91107473405517625, -0.91139065110412232,
+  -0.91170603200542988, -0.91202087657356823, -0.91233518462332275,
+  -0.9126489559697939, -0.9129621904283981, -0.91327488781486776,
+  -0.91358704794525081, -0.91389867063591168, -0.91420975570353069,
+  -0.91452030296510445, -0.91483031223794609, -0.91513978333968526,
+  -0.91544871608826783, -0.91575711030195672, -0.91606496579933161,
+  -0.91637228239928914, -0.9166790599210427, -0.91698529818412289,
+  -0.91729099700837791, -0.91759615621397295, -0.91790077562139039,
+  -0.9182048550514309, -0.91850839432521225, -0.91881139326416994,
+  -0.91911385169005777, -0.91941576942494696, -0.91971714629122736,
+  -0.92001798211160657, -0.92031827670911048, -0.92061802990708386,
+  -0.92091724152918952, -0.92121591139940873, -0.9215140393420419,
+  -0.92181162518170812, -0.92210866874334507, -0.92240516985220988,
+  -0.92270112833387852, -0.92299654401424625, -0.92329141671952764,
+  -0.92358574627625656, -0.92387953251128674, -0.9241727752517912,
+  -0.9244654743252626, -0.92475762955951391, -0.92504924078267758,
+  -0.9253403078232062, -0.92563083050987272, -0.92592080867176996,
+  -0.92621024213831127, -0.92649913073923051, -0.92678747430458175,
+  -0.9270752726647401, -0.92736252565040111, -0.92764923309258118,
+  -0.92793539482261789, -0.92822101067216944, -0.92850608047321548,
+  -0.92879060405805702, -0.92907458125931575, -0.9293580119099355,
+  -0.92964089584318133, -0.92992323289263956, -0.93020502289221907,
+  -0.93048626567614978, -0.93076696107898371, -0.93104710893559517,
+  -0.93132670908118043, -0.93160576135125783, -0.93188426558166815,
+  -0.93216222160857432, -0.93243962926846236, -0.93271648839814025,
+  -0.93299279883473885, -0.93326856041571205, -0.93354377297883617,
+  -0.93381843636221096, -0.93409255040425887, -0.9343661149437259,
+  -0.93463912981968078, -0.93491159487151609, -0.9351835099389475,
+  -0.93545487486201462, -0.93572568948108037, -0.9359959536368313,
+  -0.93626566717027826, -0.9365348299227555, -0.93680344173592156,
+  -0.93707150245175919, -0.93733901191257496, -0.93760596996099999,
+  -0.93787237643998989, -0.93813823119282436, -0.93840353406310806,
+  -0.93866828489477017, -0.93893248353206449, -0.9391961298195699,
+  -0.93945922360218992, -0.93972176472515334, -0.93998375303401394,
+  -0.94024518837465088, -0.9405060705932683, -0.94076639953639607,
+  -0.94102617505088926, -0.94128539698392866, -0.94154406518302081,
+  -0.94180217949599765, -0.94205973977101731, -0.94231674585656378,
+  -0.94257319760144687, -0.94282909485480271, -0.94308443746609349,
+  -0.94333922528510772, -0.94359345816196039, -0.94384713594709269,
+  -0.94410025849127266, -0.94435282564559475, -0.94460483726148026,
+  -0.94485629319067721, -0.94510719328526061, -0.94535753739763229,
+  -0.94560732538052128, -0.94585655708698391, -0.94610523237040334,
+  -0.94635335108449059, -0.94660091308328353, -0.946847918221148,
+  -0.94709436635277722, -0.94734025733319194, -0.94758559101774109,
+  -0.94783036726210101, -0.94807458592227623, -0.94831824685459909,
+  -0.94856134991573027, -0.94880389496265838, -0.94904588185270056,
+  -0.94928731044350201, -0.94952818059303667, -0.94976849215960668,
+  -0.950008245001843, -0.95024743897870523, -0.9504860739494817,
+  -0.95072414977378961, -0.95096166631157508, -0.95119862342311323,
+  -0.95143502096900834, -0.95167085881019386, -0.95190613680793223,
+  -0.95214085482381583, -0.95237501271976588, -0.95260861035803324,
+  -0.95284164760119872, -0.9530741243121722, -0.95330604035419375,
+  -0.95353739559083328, -0.95376818988599033, -0.95399842310389449,
+  -0.95422809510910567, -0.95445720576651349, -0.95468575494133834,
+  -0.95491374249913052, -0.95514116830577067, -0.95536803222747024,
+  -0.95559433413077111, -0.95582007388254542, -0.95604525134999641,
+  -0.95626986640065814, -0.95649391890239499, -0.95671740872340305,
+  -0.95694033573220894, -0.9571626997976701, -0.95738450078897586,
+  -0.95760573857564624, -0.95782641302753291, -0.9580465240148186,
+  -0.95826607140801767, -0.9584850550779761, -0.9587034748958716,
+  -0.95892133073321306, -0.95913862246184189, -0.95935534995393079,
+  -0.95957151308198452, -0.9597871117188399, -0.96000214573766585,
+  -0.96021661501196343, -0.96043051941556579, -0.96064385882263847,
+  -0.96085663310767966, -0.96106884214551935, -0.96128048581132064,
+  -0.961491563980579, -0.96170207652912254, -0.9619120233331121,
+  -0.96212140426904158, -0.9623302192137374, -0.96253846804435916,
+  -0.96274615063839941, -0.96295326687368388, -0.96315981662837136,
+  -0.96336579978095405, -0.96357121621025721, -0.96377606579543984,
+  -0.96398034841599411, -0.96418406395174572, -0.96438721228285429,
+  -0.96458979328981265, -0.9647918068534479, -0.96499325285492032,
+  -0.96519413117572472, -0.9653944416976894, -0.96559418430297683,
+  -0.96579335887408357, -0.96599196529384057, -0.96619000344541262,
+  -0.96638747321229879, -0.96658437447833312, -0.96678070712768327,
+  -0.96697647104485207, -0.96717166611467664, -0.96736629222232851,
+  -0.96756034925331436, -0.96775383709347551, -0.9679467556289878,
+  -0.96813910474636233, -0.9683308843324453, -0.96852209427441727,
+  -0.96871273445979478, -0.96890280477642887, -0.9690923051125061,
+  -0.96928123535654853, -0.96946959539741295, -0.96965738512429245,
+  -0.96984460442671483, -0.97003125319454397, -0.97021733131797916,
+  -0.9704028386875555, -0.97058777519414363, -0.97077214072895035,
+  -0.97095593518351797, -0.97113915844972509, -0.97132181041978616,
+  -0.97150389098625178, -0.97168540004200854, -0.9718663374802794,
+  -0.9720467031946235, -0.97222649707893627, -0.97240571902744977,
+  -0.97258436893473221, -0.97276244669568857, -0.97293995220556007,
+  -0.97311688535992513, -0.97329324605469825, -0.97346903418613095,
+  -0.97364424965081187, -0.9738188923456661, -0.97399296216795583,
+  -0.97416645901528032, -0.97433938278557586, -0.97451173337711572,
+  -0.97468351068851067, -0.97485471461870843, -0.97502534506699412,
+  -0.97519540193299037, -0.97536488511665687, -0.97553379451829136,
+  -0.97570213003852857, -0.97586989157834103, -0.97603707903903902,
+  -0.97620369232227056, -0.97636973133002114, -0.97653519596461447,
+  -0.97670008612871184, -0.97686440172531264, -0.97702814265775439,
+  -0.97719130882971228, -0.97735390014519996, -0.97751591650856928,
+  -0.97767735782450993, -0.97783822399805043, -0.97799851493455714,
+  -0.97815823053973505, -0.97831737071962765, -0.97847593538061683,
+  -0.9786339244294231, -0.97879133777310567, -0.9789481753190622,
+  -0.97910443697502925, -0.97926012264908202, -0.97941523224963478,
+  -0.97956976568544052, -0.97972372286559117, -0.97987710369951764,
+  -0.98002990809698998, -0.98018213596811732, -0.98033378722334796,
+  -0.98048486177346938, -0.98063535952960812, -0.98078528040323043,
+  -0.98093462430614164, -0.98108339115048659, -0.98123158084874973,
+  -0.98137919331375456, -0.98152622845866466, -0.98167268619698311,
+  -0.9818185664425525, -0.98196386910955524, -0.98210859411251361,
+  -0.98225274136628937, -0.98239631078608469, -0.98253930228744124,
+  -0.98268171578624086, -0.98282355119870524, -0.98296480844139644,
+  -0.98310548743121629, -0.98324558808540707, -0.98338511032155118,
+  -0.98352405405757126, -0.98366241921173025, -0.98380020570263149,
+  -0.98393741344921892, -0.98407404237077645, -0.98421009238692903,
+  -0.9843455634176419, -0.98448045538322093, -0.9846147682043126,
+  -0.98474850180190421, -0.9848816560973237, -0.98501423101223984,
+  -0.98514622646866223, -0.98527764238894122, -0.98540847869576842,
+  -0.98553873531217606, -0.98566841216153755, -0.98579750916756737,
+  -0.98592602625432113, -0.98605396334619544, -0.98618132036792827,
+  -0.98630809724459867, -0.98643429390162707, -0.98655991026477541,
+  -0.98668494626014669, -0.98680940181418542, -0.98693327685367771,
+  -0.98705657130575097, -0.98717928509787434, -0.98730141815785843,
+  -0.98742297041385541, -0.98754394179435923, -0.98766433222820571,
+  -0.98778414164457218, -0.98790336997297779, -0.98802201714328353,
+  -0.98814008308569257, -0.98825756773074946, -0.98837447100934128,
+  -0.98849079285269659, -0.98860653319238645, -0.98872169196032378,
+  -0.98883626908876354, -0.98895026451030299, -0.98906367815788154,
+  -0.98917650996478101, -0.98928875986462517, -0.98940042779138038,
+  -0.98951151367935519, -0.98962201746320078, -0.98973193907791057,
+  -0.98984127845882053, -0.98995003554160899, -0.99005821026229712,
+  -0.9901658025572484, -0.99027281236316911, -0.99037923961710816,
+  -0.99048508425645698, -0.99059034621895015, -0.99069502544266463,
+  -0.99079912186602037, -0.99090263542778001, -0.99100556606704937,
+  -0.99110791372327678, -0.99120967833625406, -0.99131085984611544,
+  -0.99141145819333854, -0.9915114733187439, -0.99161090516349537,
+  -0.99170975366909953, -0.99180801877740643, -0.99190570043060933,
+  -0.99200279857124452, -0.9920993131421918, -0.99219524408667392,
+  -0.99229059134825737, -0.99238535487085167, -0.99247953459870997,
+  -0.99257313047642881, -0.99266614244894802, -0.99275857046155114,
+  -0.9928504144598651, -0.99294167438986047, -0.99303235019785141,
+  -0.99312244183049558, -0.9932119492347945, -0.99330087235809328,
+  -0.99338921114808065, -0.99347696555278919, -0.9935641355205953,
+  -0.99365072100021912, -0.9937367219407246, -0.99382213829151966,
+  -0.99390697000235606, -0.99399121702332938, -0.99407487930487937,
+  -0.99415795679778973, -0.9942404494531879, -0.99432235722254581,
+  -0.9944036800576791, -0.9944844179107476, -0.99456457073425542,
+  -0.99464413848105071, -0.9947231211043257, -0.99480151855761711,
+  -0.99487933079480562, -0.99495655777011638, -0.99503319943811863,
+  -0.99510925575372611, -0.99518472667219682, -0.99525961214913339,
+  -0.99533391214048228, -0.9954076266025349, -0.99548075549192694,
+  -0.99555329876563847, -0.99562525638099431, -0.99569662829566352,
+  -0.99576741446765982, -0.99583761485534161, -0.99590722941741172,
+  -0.99597625811291779, -0.99604470090125197, -0.99611255774215113,
+  -0.99617982859569687, -0.99624651342231552, -0.996312612182778,
+  -0.99637812483820021, -0.99644305135004263, -0.99650739168011082,
+  -0.99657114579055484, -0.9966343136438699, -0.99669689520289606,
+  -0.996758890430818, -0.99682029929116567, -0.99688112174781385,
+  -0.99694135776498216, -0.99700100730723529, -0.99706007033948296,
+  -0.99711854682697998, -0.99717643673532619, -0.99723374003046616,
+  -0.99729045667869021, -0.99734658664663323, -0.9974021299012753,
+  -0.99745708640994191, -0.99751145614030345, -0.99756523906037575,
+  -0.99761843513851955, -0.997671044343441, -0.99772306664419164,
+  -0.99777450201016782, -0.99782535041111164, -0.99787561181711015,
+  -0.997925286198596, -0.99797437352634699, -0.99802287377148624,
+  -0.99807078690548234, -0.99811811290014918, -0.99816485172764624,
+  -0.99821100336047819, -0.99825656777149518, -0.99830154493389289,
+  -0.99834593482121237, -0.99838973740734016, -0.99843295266650844,
+  -0.99847558057329477, -0.99851762110262221, -0.99855907422975931,
+  -0.99859993993032037, -0.99864021818026527, -0.99867990895589909,
+  -0.99871901223387294, -0.99875752799118334, -0.99879545620517241,
+  -0.99883279685352799, -0.99886954991428356, -0.99890571536581829,
+  -0.99894129318685687, -0.99897628335646982, -0.99901068585407338,
+  -0.99904450065942929, -0.99907772775264536, -0.99911036711417489,
+  -0.99914241872481691, -0.99917388256571638, -0.99920475861836389,
+  -0.99923504686459585, -0.99926474728659442, -0.99929385986688779,
+  -0.99932238458834954, -0.99935032143419944, -0.99937767038800285,
+  -0.9994044314336713, -0.99943060455546173, -0.99945618973797734,
+  -0.99948118696616695, -0.99950559622532531, -0.99952941750109314,
+  -0.99955265077945699, -0.99957529604674922, -0.99959735328964838,
+  -0.99961882249517864, -0.9996397036507102, -0.99965999674395922,
+  -0.99967970176298793, -0.99969881869620425, -0.99971734753236219,
+  -0.99973528826056168, -0.99975264087024884, -0.99976940535121528,
+  -0.99978558169359921, -0.99980116988788426, -0.99981616992490041,
+  -0.9998305817958234, -0.99984440549217524, -0.99985764100582386,
+  -0.99987028832898295, -0.99988234745421256, -0.99989381837441849,
+  -0.9999047010828529, -0.99991499557311347, -0.9999247018391445,
+  -0.999933819875236, -0.99994234967602391, -0.99995029123649048,
+  -0.9999576445519639, -0.99996440961811828, -0.99997058643097414,
+  -0.99997617498689761, -0.99998117528260111, -0.9999855873151432,
+  -0.9999894110819284, -0.99999264658070719, -0.99999529380957619,
+  -0.99999735276697821, -0.99999882345170188, -0.99999970586288223,
+  -1, -0.99999970586288223, -0.99999882345170188,
+  -0.99999735276697821, -0.99999529380957619, -0.99999264658070719,
+  -0.9999894110819284, -0.9999855873151432, -0.99998117528260111,
+  -0.99997617498689761, -0.99997058643097414, -0.99996440961811828,
+  -0.9999576445519639, -0.99995029123649048, -0.99994234967602391,
+  -0.999933819875236, -0.9999247018391445, -0.99991499557311347,
+  -0.9999047010828529, -0.99989381837441849, -0.99988234745421256,
+  -0.99987028832898295, -0.99985764100582386, -0.99984440549217524,
+  -0.9998305817958234, -0.99981616992490041, -0.99980116988788426,
+  -0.99978558169359921, -0.99976940535121528, -0.99975264087024884,
+  -0.99973528826056168, -0.99971734753236219, -0.99969881869620425,
+  -0.99967970176298793, -0.99965999674395922, -0.9996397036507102,
+  -0.99961882249517864, -0.99959735328964838, -0.99957529604674922,
+  -0.99955265077945699, -0.99952941750109314, -0.99950559622532531,
+  -0.99948118696616695, -0.99945618973797734, -0.99943060455546173,
+  -0.9994044314336713, -0.99937767038800285, -0.99935032143419944,
+  -0.99932238458834954, -0.99929385986688779, -0.99926474728659442,
+  -0.99923504686459585, -0.99920475861836389, -0.99917388256571638,
+  -0.99914241872481691, -0.99911036711417489, -0.99907772775264536,
+  -0.99904450065942929, -0.99901068585407338, -0.99897628335646982,
+  -0.99894129318685687, -0.99890571536581829, -0.99886954991428356,
+  -0.99883279685352799, -0.99879545620517241, -0.99875752799118334,
+  -0.99871901223387294, -0.99867990895589909, -0.99864021818026527,
+  -0.99859993993032037, -0.99855907422975931, -0.99851762110262221,
+  -0.99847558057329477, -0.99843295266650844, -0.99838973740734016,
+  -0.99834593482121237, -0.99830154493389289, -0.99825656777149518,
+  -0.99821100336047819, -0.99816485172764624, -0.99811811290014918,
+  -0.99807078690548234, -0.99802287377148624, -0.99797437352634699,
+  -0.997925286198596, -0.99787561181711015, -0.99782535041111164,
+  -0.99777450201016782, -0.99772306664419164, -0.997671044343441,
+  -0.99761843513851955, -0.99756523906037575, -0.99751145614030345,
+  -0.99745708640994191, -0.9974021299012753, -0.99734658664663323,
+  -0.99729045667869021, -0.99723374003046628, -0.99717643673532619,
+  -0.99711854682697998, -0.99706007033948296, -0.99700100730723529,
+  -0.99694135776498216, -0.99688112174781385, -0.99682029929116567,
+  -0.996758890430818, -0.99669689520289606, -0.9966343136438699,
+  -0.99657114579055484, -0.99650739168011082, -0.99644305135004263,
+  -0.99637812483820021, -0.996312612182778, -0.99624651342231552,
+  -0.99617982859569698, -0.99611255774215113, -0.99604470090125197,
+  -0.99597625811291779, -0.99590722941741172, -0.99583761485534161,
+  -0.99576741446765982, -0.99569662829566352, -0.99562525638099431,
+  -0.99555329876563847, -0.99548075549192694, -0.9954076266025349,
+  -0.99533391214048228, -0.99525961214913339, -0.99518472667219693,
+  -0.99510925575372611, -0.99503319943811863, -0.99495655777011638,
+  -0.99487933079480562, -0.99480151855761711, -0.9947231211043257,
+  -0.99464413848105071, -0.99456457073425542, -0.9944844179107476,
+  -0.9944036800576791, -0.99432235722254581, -0.9942404494531879,
+  -0.99415795679778973, -0.99407487930487937, -0.99399121702332938,
+  -0.99390697000235606, -0.99382213829151966, -0.9937367219407246,
+  -0.99365072100021912, -0.9935641355205953, -0.99347696555278919,
+  -0.99338921114808065, -0.99330087235809328, -0.9932119492347945,
+  -0.99312244183049558, -0.99303235019785141, -0.99294167438986047,
+  -0.9928504144598651, -0.99275857046155114, -0.99266614244894802,
+  -0.99257313047642881, -0.99247953459870997, -0.99238535487085167,
+  -0.99229059134825737, -0.99219524408667392, -0.9920993131421918,
+  -0.99200279857124452, -0.99190570043060933, -0.99180801877740643,
+  -0.99170975366909953, -0.99161090516349537, -0.9915114733187439,
+  -0.99141145819333854, -0.99131085984611544, -0.99120967833625406,
+  -0.99110791372327689, -0.99100556606704937, -0.99090263542778001,
+  -0.99079912186602037, -0.99069502544266463, -0.99059034621895015,
+  -0.99048508425645709, -0.99037923961710816, -0.99027281236316911,
+  -0.9901658025572484, -0.99005821026229712, -0.98995003554160899,
+  -0.98984127845882053, -0.98973193907791057, -0.98962201746320089,
+  -0.98951151367935519, -0.98940042779138038, -0.98928875986462517,
+  -0.98917650996478101, -0.98906367815788154, -0.98895026451030299,
+  -0.98883626908876354, -0.98872169196032378, -0.98860653319238645,
+  -0.98849079285269659, -0.98837447100934128, -0.98825756773074946,
+  -0.98814008308569257, -0.98802201714328353, -0.98790336997297779,
+  -0.98778414164457218, -0.98766433222820571, -0.98754394179435923,
+  -0.98742297041385541, -0.98730141815785843, -0.98717928509787434,
+  -0.98705657130575097, -0.98693327685367771, -0.98680940181418553,
+  -0.98668494626014669, -0.98655991026477541, -0.98643429390162718,
+  -0.98630809724459867, -0.98618132036792827, -0.98605396334619544,
+  -0.98592602625432113, -0.98579750916756748, -0.98566841216153755,
+  -0.98553873531217606, -0.98540847869576842, -0.98527764238894122,
+  -0.98514622646866223, -0.98501423101223984, -0.9848816560973237,
+  -0.98474850180190421, -0.9846147682043126, -0.98448045538322093,
+  -0.9843455634176419, -0.98421009238692903, -0.98407404237077645,
+  -0.98393741344921892, -0.9838002057026316, -0.98366241921173025,
+  -0.98352405405757126, -0.98338511032155118, -0.98324558808540707,
+  -0.98310548743121629, -0.98296480844139644, -0.98282355119870524,
+  -0.98268171578624086, -0.98253930228744124, -0.98239631078608469,
+  -0.98225274136628937, -0.98210859411251361, -0.98196386910955524,
+  -0.9818185664425525, -0.98167268619698311, -0.98152622845866477,
+  -0.98137919331375456, -0.98123158084874973, -0.98108339115048671,
+  -0.98093462430614164, -0.98078528040323043, -0.98063535952960812,
+  -0.98048486177346938, -0.98033378722334796, -0.98018213596811743,
+  -0.98002990809699009, -0.97987710369951764, -0.97972372286559117,
+  -0.97956976568544052, -0.97941523224963478, -0.97926012264908202,
+  -0.97910443697502925, -0.9789481753190622, -0.97879133777310567,
+  -0.97863392442942321, -0.97847593538061683, -0.97831737071962765,
+  -0.97815823053973505, -0.97799851493455714, -0.97783822399805043,
+  -0.97767735782450993, -0.97751591650856928, -0.97735390014519996,
+  -0.97719130882971228, -0.97702814265775439, -0.97686440172531264,
+  -0.97670008612871184, -0.97653519596461447, -0.97636973133002114,
+  -0.97620369232227056, -0.97603707903903902, -0.97586989157834103,
+  -0.97570213003852857, -0.97553379451829136, -0.97536488511665698,
+  -0.97519540193299037, -0.97502534506699412, -0.97485471461870843,
+  -0.97468351068851067, -0.97451173337711572, -0.97433938278557586,
+  -0.97416645901528032, -0.97399296216795583, -0.9738188923456661,
+  -0.97364424965081198, -0.97346903418613107, -0.97329324605469825,
+  -0.97311688535992513, -0.97293995220556018, -0.97276244669568857,
+  -0.97258436893473221, -0.97240571902744977, -0.97222649707893627,
+  -0.9720467031946235, -0.9718663374802794, -0.97168540004200854,
+  -0.97150389098625178, -0.97132181041978616, -0.97113915844972509,
+  -0.97095593518351797, -0.97077214072895035, -0.97058777519414363,
+  -0.9704028386875555, -0.97021733131797916, -0.97003125319454397,
+  -0.96984460442671483, -0.96965738512429245, -0.96946959539741306,
+  -0.96928123535654853, -0.96909230511250621, -0.96890280477642887,
+  -0.96871273445979478, -0.96852209427441738, -0.96833088433244519,
+  -0.96813910474636244, -0.9679467556289878, -0.96775383709347551,
+  -0.96756034925331436, -0.96736629222232851, -0.96717166611467664,
+  -0.96697647104485207, -0.96678070712768327, -0.96658437447833312,
+  -0.9663874732122989, -0.9661900034454125, -0.96599196529384057,
+  -0.96579335887408368, -0.96559418430297683, -0.9653944416976894,
+  -0.96519413117572472, -0.96499325285492032, -0.9647918068534479,
+  -0.96458979328981276, -0.96438721228285429, -0.96418406395174583,
+  -0.96398034841599411, -0.96377606579543984, -0.96357121621025732,
+  -0.96336579978095405, -0.96315981662837136, -0.96295326687368388,
+  -0.96274615063839941, -0.96253846804435916, -0.9623302192137374,
+  -0.96212140426904158, -0.96191202333311221, -0.96170207652912254,
+  -0.961491563980579, -0.96128048581132064, -0.96106884214551935,
+  -0.96085663310767966, -0.96064385882263859, -0.96043051941556579,
+  -0.96021661501196343, -0.96000214573766596, -0.9597871117188399,
+  -0.95957151308198452, -0.95935534995393079, -0.95913862246184189,
+  -0.95892133073321317, -0.9587034748958716, -0.9584850550779761,
+  -0.95826607140801767, -0.9580465240148186, -0.95782641302753291,
+  -0.95760573857564635, -0.95738450078897586, -0.95716269979767021,
+  -0.95694033573220882, -0.95671740872340305, -0.9564939189023951,
+  -0.95626986640065803, -0.95604525134999641, -0.95582007388254542,
+  -0.95559433413077111, -0.95536803222747035, -0.95514116830577078,
+  -0.95491374249913052, -0.95468575494133834, -0.95445720576651349,
+  -0.95422809510910567, -0.95399842310389449, -0.95376818988599033,
+  -0.95353739559083328, -0.95330604035419386, -0.9530741243121722,
+  -0.95284164760119872, -0.95260861035803335, -0.95237501271976588,
+  -0.95214085482381583, -0.95190613680793235, -0.95167085881019386,
+  -0.95143502096900834, -0.95119862342311323, -0.95096166631157508,
+  -0.95072414977378961, -0.9504860739494817, -0.95024743897870523,
+  -0.950008245001843, -0.94976849215960668, -0.94952818059303667,
+  -0.94928731044350212, -0.94904588185270056, -0.94880389496265849,
+  -0.94856134991573027, -0.94831824685459909, -0.94807458592227623,
+  -0.94783036726210101, -0.94758559101774109, -0.94734025733319205,
+  -0.94709436635277722, -0.946847918221148, -0.94660091308328353,
+  -0.94635335108449059, -0.94610523237040345, -0.94585655708698391,
+  -0.94560732538052128, -0.94535753739763229, -0.94510719328526061,
+  -0.94485629319067721, -0.94460483726148026, -0.94435282564559475,
+  -0.94410025849127266, -0.94384713594709269, -0.94359345816196039,
+  -0.94333922528510772, -0.94308443746609349, -0.94282909485480271,
+  -0.94257319760144687, -0.94231674585656378, -0.94205973977101731,
+  -0.94180217949599765, -0.94154406518302081, -0.94128539698392866,
+  -0.94102617505088926, -0.94076639953639607, -0.9405060705932683,
+  -0.94024518837465088, -0.93998375303401405, -0.93972176472515334,
+  -0.93945922360218992, -0.9391961298195699, -0.9389324835320646,
+  -0.93866828489477017, -0.93840353406310806, -0.93813823119282436,
+  -0.93787237643998989, -0.93760596996099999, -0.93733901191257496,
+  -0.93707150245175919, -0.93680344173592156, -0.9365348299227555,
+  -0.93626566717027826, -0.93599595363683141, -0.93572568948108037,
+  -0.93545487486201462, -0.93518350993894761, -0.93491159487151609,
+  -0.93463912981968078, -0.93436611494372579, -0.93409255040425898,
+  -0.93381843636221096, -0.93354377297883617, -0.93326856041571205,
+  -0.93299279883473896, -0.93271648839814025, -0.93243962926846236,
+  -0.93216222160857443, -0.93188426558166815, -0.93160576135125783,
+  -0.93132670908118043, -0.93104710893559528, -0.93076696107898371,
+  -0.93048626567614978, -0.93020502289221907, -0.92992323289263967,
+  -0.92964089584318133, -0.9293580119099355, -0.92907458125931586,
+  -0.92879060405805702, -0.92850608047321559, -0.92822101067216944,
+  -0.92793539482261789, -0.92764923309258118, -0.92736252565040111,
+  -0.9270752726647401, -0.92678747430458175, -0.92649913073923051,
+  -0.92621024213831138, -0.92592080867177007, -0.92563083050987272,
+  -0.92534030782320631, -0.92504924078267758, -0.92475762955951391,
+  -0.9244654743252626, -0.9241727752517912, -0.92387953251128674,
+  -0.92358574627625667, -0.92329141671952764, -0.92299654401424625,
+  -0.92270112833387863, -0.92240516985220988, -0.92210866874334518,
+  -0.92181162518170812, -0.92151403934204201, -0.92121591139940873,
+  -0.92091724152918952, -0.92061802990708397, -0.92031827670911059,
+  -0.92001798211160657, -0.91971714629122736, -0.91941576942494707,
+  -0.91911385169005777, -0.91881139326417005, -0.91850839432521225,
+  -0.9182048550514309, -0.9179007756213905, -0.91759615621397295,
+  -0.91729099700837791, -0.916985298184123, -0.9166790599210427,
+  -0.91637228239928914, -0.91606496579933172, -0.91575711030195672,
+  -0.91544871608826783, -0.91513978333968526, -0.9148303122379462,
+  -0.91452030296510445, -0.91420975570353069, -0.91389867063591168,
+  -0.91358704794525081, -0.91327488781486776, -0.91296219042839821,
+  -0.9126489559697939, -0.91233518462332275, -0.91202087657356834,
+  -0.91170603200542988, -0.91139065110412243, -0.91107473405517636,
+  -0.91075828104443757, -0.91044129225806725, -0.91012376788254168,
+  -0.90980570810465222, -0.90948711311150543, -0.90916798309052238,
+  -0.90884831822943912, -0.90852811871630612, -0.9082073847394887,
+  -0.90788611648766626, -0.90756431414983263, -0.90724197791529582,
+  -0.90691910797367814, -0.90659570451491533, -0.90627176772925766,
+  -0.90594729780726846, -0.90562229493982527, -0.90529675931811882,
+  -0.90497069113365325, -0.90464409057824624, -0.90431695784402832,
+  -0.90398929312344334, -0.90366109660924798, -0.90333236849451182,
+  -0.90300310897261715, -0.90267331823725883, -0.9023429964824442,
+  -0.90201214390249318, -0.90168076069203773, -0.90134884704602203,
+  -0.90101640315970233, -0.90068342922864697, -0.9003499254487356,
+  -0.90001589201616028, -0.89968132912742393, -0.89934623697934157,
+  -0.89901061576903907, -0.89867446569395382, -0.89833778695183431,
+  -0.89800057974073988, -0.89766284425904086, -0.89732458070541832,
+  -0.89698578927886397, -0.89664647017868015, -0.89630662360447955,
+  -0.89596624975618522, -0.89562534883403011, -0.89528392103855758,
+  -0.89494196657062075, -0.8945994856313827, -0.89425647842231604,
+  -0.89391294514520325, -0.89356888600213591, -0.89322430119551532,
+  -0.89287919092805168, -0.89253355540276458, -0.89218739482298248,
+  -0.89184070939234272, -0.89149349931479138, -0.89114576479458318,
+  -0.89079750603628149, -0.89044872324475788, -0.89009941662519232,
+  -0.88974958638307278, -0.88939923272419552, -0.88904835585466457,
+  -0.8886969559808916, -0.88834503330959635, -0.88799258804780556,
+  -0.88763962040285393, -0.88728613058238315, -0.88693211879434219,
+  -0.88657758524698704, -0.88622253014888064, -0.88586695370889279,
+  -0.88551085613619995, -0.88515423764028511, -0.88479709843093779,
+  -0.88443943871825381, -0.88408125871263499, -0.88372255862478966,
+  -0.88336333866573158, -0.88300359904678083, -0.88264333997956279,
+  -0.88228256167600871, -0.88192126434835505, -0.88155944820914378,
+  -0.88119711347122209, -0.88083426034774204, -0.88047088905216075,
+  -0.88010699979824036, -0.87974259280004741, -0.87937766827195329,
+  -0.87901222642863353, -0.87864626748506813, -0.87827979165654158,
+  -0.87791279915864184, -0.87754529020726135, -0.87717726501859594,
+  -0.87680872380914565, -0.87643966679571361, -0.8760700941954066,
+  -0.8757000062256346, -0.87532940310411089, -0.87495828504885165,
+  -0.87458665227817611, -0.8742145050107063, -0.87384184346536686,
+  -0.87346866786138488, -0.87309497841829009, -0.8727207753559143,
+  -0.87234605889439154, -0.87197082925415781, -0.87159508665595098,
+  -0.87121883132081102, -0.87084206347007898, -0.87046478332539767,
+  -0.87008699110871146, -0.86970868704226567, -0.86932987134860684,
+  -0.86895054425058238, -0.8685707059713409, -0.86819035673433131,
+  -0.86780949676330332, -0.86742812628230692, -0.86704624551569265,
+  -0.86666385468811113, -0.86628095402451299, -0.86589754375014882,
+  -0.86551362409056909, -0.8651291952716238, -0.86474425751946238,
+  -0.86435881106053403, -0.86397285612158681, -0.8635863929296681,
+  -0.86319942171212416, -0.86281194269660033, -0.86242395611104061,
+  -0.86203546218368721, -0.8616464611430813, -0.86125695321806217,
+  -0.86086693863776731, -0.86047641763163207, -0.86008539042939014,
+  -0.85969385726107261, -0.85930181835700847, -0.8589092739478239,
+  -0.85851622426444274, -0.85812266953808614, -0.85772861000027212,
+  -0.85733404588281559, -0.85693897741782876, -0.85654340483771996,
+  -0.85614732837519447, -0.85575074826325392, -0.85535366473519603,
+  -0.85495607802461493, -0.85455798836540053, -0.85415939599173885,
+  -0.85376030113811141, -0.85336070403929543, -0.85296060493036363,
+  -0.85256000404668408, -0.85215890162391983, -0.85175729789802912,
+  -0.8513551931052652, -0.85095258748217573, -0.85054948126560348,
+  -0.85014587469268521, -0.84974176800085255, -0.84933716142783078,
+  -0.84893205521163961, -0.84852644959059265, -0.84812034480329723,
+  -0.84771374108865438, -0.84730663868585832, -0.84689903783439724,
+  -0.84649093877405213, -0.84608234174489705, -0.84567324698729907,
+  -0.84526365474191822, -0.84485356524970712, -0.84444297875191066,
+  -0.84403189549006641, -0.84362031570600415, -0.84320823964184544,
+  -0.84279566754000412, -0.84238259964318585, -0.84196903619438768,
+  -0.84155497743689844, -0.84114042361429808, -0.84072537497045807,
+  -0.84030983174954077, -0.83989379419599952, -0.83947726255457855,
+  -0.83906023707031274, -0.8386427179885273, -0.83822470555483808,
+  -0.83780620001515094, -0.83738720161566194, -0.83696771060285702,
+  -0.83654772722351201, -0.83612725172469227, -0.8357062843537526,
+  -0.83528482535833737, -0.83486287498638001, -0.83444043348610319,
+  -0.83401750110601813, -0.83359407809492514, -0.83317016470191319,
+  -0.83274576117635946, -0.83232086776792968, -0.83189548472657759,
+  -0.83146961230254524, -0.83104325074636232, -0.83061640030884631,
+  -0.83018906124110237, -0.82976123379452305, -0.82933291822078825,
+  -0.82890411477186487, -0.82847482370000713, -0.8280450452577558,
+  -0.8276147796979384, -0.82718402727366913, -0.82675278823834852,
+  -0.82632106284566353, -0.82588885134958678, -0.82545615400437755,
+  -0.82502297106458022, -0.82458930278502529, -0.82415514942082857,
+  -0.82372051122739143, -0.82328538846040011, -0.82284978137582643,
+  -0.82241369022992639, -0.82197711527924155, -0.82154005678059761,
+  -0.82110251499110465, -0.82066449016815746, -0.82022598256943469,
+  -0.81978699245289899, -0.8193475200767969, -0.81890756569965895,
+  -0.81846712958029866, -0.81802621197781344, -0.81758481315158371,
+  -0.81714293336127297, -0.81670057286682785, -0.81625773192847739,
+  -0.81581441080673378, -0.81537060976239129, -0.81492632905652662,
+  -0.81448156895049861, -0.81403632970594841, -0.81359061158479851,
+  -0.81314441484925359, -0.81269773976179949, -0.81225058658520388,
+  -0.81180295558251547, -0.81135484701706373, -0.81090626115245967,
+  -0.81045719825259477, -0.81000765858164114, -0.80955764240405126,
+  -0.80910714998455824, -0.80865618158817498, -0.80820473748019472,
+  -0.80775281792619036, -0.80730042319201445, -0.80684755354379933,
+  -0.80639420924795624, -0.80594039057117628, -0.80548609778042923,
+  -0.80503133114296366, -0.80457609092630711, -0.80412037739826581,
+  -0.80366419082692409, -0.80320753148064494, -0.80275039962806916,
+  -0.80229279553811572, -0.80183471947998131, -0.80137617172314024,
+  -0.8009171525373443, -0.80045766219262282, -0.79999770095928191,
+  -0.79953726910790501, -0.79907636690935235, -0.79861499463476082,
+  -0.79815315255554375, -0.79769084094339116, -0.79722806007026881,
+  -0.79676481020841883, -0.79630109163035911, -0.79583690460888357,
+  -0.79537224941706131, -0.79490712632823701, -0.79444153561603059,
+  -0.79397547755433717, -0.79350895241732666, -0.79304196047944364,
+  -0.79257450201540769, -0.79210657730021239, -0.79163818660912588,
+  -0.7911693302176902, -0.79070000840172161, -0.79023022143731003,
+  -0.78975996960081907, -0.78928925316888565, -0.78881807241842028,
+  -0.78834642762660634, -0.78787431907090022, -0.78740174702903143,
+  -0.78692871177900181, -0.78645521359908577, -0.78598125276783015,
+  -0.78550682956405393, -0.78503194426684808, -0.78455659715557524,
+  -0.78408078850986995, -0.7836045186096382, -0.78312778773505731,
+  -0.78265059616657573, -0.78217294418491301, -0.78169483207105939,
+  -0.78121626010627609, -0.78073722857209449, -0.78025773775031659,
+  -0.77977778792301455, -0.7792973793725303, -0.77881651238147598,
+  -0.77833518723273321, -0.77785340420945315, -0.77737116359505631,
+  -0.77688846567323244, -0.77640531072794039, -0.77592169904340769,
+  -0.77543763090413054, -0.77495310659487393, -0.77446812640067086,
+  -0.7739826906068229, -0.77349679949889905, -0.77301045336273699,
+  -0.77252365248444133, -0.77203639715038452, -0.7715486876472063,
+  -0.77106052426181382, -0.77057190728138081, -0.7700828369933479,
+  -0.76959331368542294, -0.7691033376455797, -0.76861290916205838,
+  -0.76812202852336542, -0.76763069601827338, -0.7671389119358204,
+  -0.76664667656531038, -0.76615399019631292, -0.7656608531186625,
+  -0.76516726562245896, -0.76467322799806714, -0.76417874053611667,
+  -0.76368380352750187, -0.76318841726338127, -0.76269258203517798,
+  -0.7621962981345789, -0.76169956585353538, -0.76120238548426178,
+  -0.76070475731923692, -0.76020668165120242, -0.75970815877316344,
+  -0.75920918897838807, -0.75870977256040739, -0.75820990981301528,
+  -0.75770960103026808, -0.75720884650648457, -0.75670764653624567,
+  -0.75620600141439454, -0.75570391143603588, -0.75520137689653655,
+  -0.7546983980915245, -0.75419497531688917, -0.75369110886878121,
+  -0.75318679904361252, -0.75268204613805534, -0.75217685044904281,
+  -0.75167121227376843, -0.75116513190968648, -0.7506586096545107,
+  -0.75015164580621507, -0.74964424066303348, -0.74913639452345937,
+  -0.74862810768624544, -0.7481193804504036, -0.74761021311520515,
+  -0.74710060598018013, -0.74659055934511731, -0.74608007351006378,
+  -0.74556914877532543, -0.74505778544146606, -0.74454598380930737,
+  -0.74403374417992929, -0.74352106685466912, -0.74300795213512172,
+  -0.74249440032313918, -0.74198041172083107, -0.74146598663056329,
+  -0.74095112535495911, -0.74043582819689802, -0.7399200954595162,
+  -0.73940392744620576, -0.73888732446061511, -0.73837028680664862,
+  -0.73785281478846598, -0.73733490871048291, -0.7368165688773699,
+  -0.73629779559405317, -0.73577858916571359, -0.73525894989778684,
+  -0.7347388780959635, -0.73421837406618828, -0.73369743811466037,
+  -0.73317607054783274, -0.73265427167241282, -0.73213204179536129,
+  -0.73160938122389263, -0.73108629026547434, -0.73056276922782759,
+  -0.73003881841892626, -0.72951443814699701, -0.72898962872051942,
+  -0.7284643904482252, -0.72793872363909862, -0.72741262860237577,
+  -0.72688610564754497, -0.72635915508434601, -0.72583177722277037,
+  -0.72530397237306077, -0.72477574084571128, -0.724247082951467,
+  -0.7237179990013235, -0.72318848930652746, -0.72265855417857561,
+  -0.72212819392921535, -0.72159740887044377, -0.72106619931450811,
+  -0.72053456557390527, -0.72000250796138165, -0.71947002678993299,
+  -0.71893712237280449, -0.71840379502348983, -0.71787004505573171,
+  -0.71733587278352173, -0.71680127852109954, -0.71626626258295312,
+  -0.71573082528381859, -0.71519496693868012, -0.71465868786276909,
+  -0.71412198837156482, -0.71358486878079364, -0.71304732940642934,
+  -0.71250937056469232, -0.7119709925720501, -0.71143219574521643,
+  -0.71089298040115168, -0.71035334685706242, -0.70981329543040084,
+  -0.70927282643886569, -0.70873194020040065, -0.7081906370331954,
+  -0.70764891725568435, -0.70710678118654757, -0.70656422914470962,
+  -0.70602126144933974, -0.70547787841985221, -0.70493408037590499,
+  -0.70438986763740041, -0.70384524052448494, -0.70330019935754873,
+  -0.7027547444572253, -0.70220887614439187, -0.70166259474016857,
+  -0.70111590056591866, -0.70056879394324845, -0.70002127519400636,
+  -0.69947334464028377, -0.69892500260441415, -0.69837624940897292,
+  -0.69782708537677729, -0.69727751083088663, -0.6967275260946012,
+  -0.69617713149146299, -0.69562632734525487, -0.69507511398000088,
+  -0.69452349171996552, -0.693971460889654, -0.69341902181381188,
+  -0.69286617481742474, -0.69231292022571822, -0.69175925836415775,
+  -0.69120518955844845, -0.69065071413453472, -0.69009583241859995,
+  -0.68954054473706694, -0.68898485141659715, -0.68842875278409055,
+  -0.68787224916668555, -0.68731534089175916, -0.68675802828692589,
+  -0.6862003116800387, -0.68564219139918747, -0.68508366777270036,
+  -0.6845247411291423, -0.68396541179731551, -0.68340568010625879,
+  -0.68284554638524808, -0.68228501096379557, -0.68172407417164982,
+  -0.68116273633879543, -0.68060099779545313, -0.68003885887207904,
+  -0.67947631989936508, -0.67891338120823841, -0.67835004312986158,
+  -0.6777863059956315, -0.67722217013718045, -0.67665763588637495,
+  -0.67609270357531603, -0.67552737353633863, -0.67496164610201204,
+  -0.67439552160513905, -0.67382900037875615, -0.67326208275613297,
+  -0.67269476907077297, -0.67212705965641184, -0.67155895484701833,
+  -0.67099045497679422, -0.67042156038017309, -0.66985227139182113,
+  -0.66928258834663601, -0.66871251157974809, -0.66814204142651856,
+  -0.66757117822254031, -0.66699992230363747, -0.66642827400586535,
+  -0.66585623366550972, -0.66528380161908718, -0.6647109782033449,
+  -0.66413776375526001, -0.66356415861203988, -0.66299016311112147,
+  -0.66241577759017178, -0.66184100238708687, -0.66126583783999227,
+  -0.6606902842872423, -0.66011434206742048, -0.65953801151933877,
+  -0.65896129298203732, -0.65838418679478505, -0.65780669329707864,
+  -0.65722881282864265, -0.65665054572942905, -0.65607189233961771,
+  -0.65549285299961546, -0.65491342805005615, -0.65433361783180055,
+  -0.65375342268593617, -0.65317284295377676, -0.65259187897686255,
+  -0.6520105310969595, -0.65142879965605982, -0.65084668499638099,
+  -0.65026418746036596, -0.64968130739068319, -0.64909804513022606,
+  -0.64851440102211255, -0.64793037540968546, -0.64734596863651206,
+  -0.64676118104638392, -0.64617601298331639, -0.6455904647915488,
+  -0.64500453681554404, -0.64441822939998838, -0.6438315428897915,
+  -0.64324447763008585, -0.64265703396622686, -0.64206921224379254,
+  -0.64148101280858316, -0.64089243600662138, -0.64030348218415167,
+  -0.63971415168764045, -0.63912444486377573, -0.63853436205946679,
+  -0.63794390362184417, -0.63735306989825913, -0.6367618612362842,
+  -0.63617027798371217, -0.63557832048855623, -0.63498598909904946,
+  -0.63439328416364549, -0.63380020603101728, -0.63320675505005719,
+  -0.63261293156987752, -0.63201873593980906, -0.63142416850940186,
+  -0.63082922962842447, -0.63023391964686448, -0.6296382389149271,
+  -0.629042187783036, -0.62844576660183271, -0.62784897572217657,
+  -0.62725181549514419, -0.62665428627202946, -0.62605638840434352,
+  -0.62545812224381436, -0.62485948814238645, -0.62426048645222065,
+  -0.62366111752569464, -0.62306138171540137, -0.62246127937415008,
+  -0.62186081085496536, -0.62125997651108766, -0.62065877669597214,
+  -0.62005721176328921, -0.61945528206692402, -0.61885298796097632,
+  -0.61825032979976025, -0.61764730793780398, -0.61704392272984976,
+  -0.61644017453085365, -0.61583606369598509, -0.61523159058062682,
+  -0.61462675554037505, -0.61402155893103849, -0.61341600110863859,
+  -0.61281008242940971, -0.61220380324979806, -0.61159716392646202,
+  -0.61099016481627177, -0.61038280627630948, -0.60977508866386843,
+  -0.60916701233645321, -0.60855857765177945, -0.60794978496777374,
+  -0.60734063464257293, -0.60673112703452448, -0.60612126250218623,
+  -0.60551104140432555, -0.60490046409991993, -0.60428953094815607,
+  -0.60367824230843037, -0.60306659854034828, -0.60245460000372386,
+  -0.60184224705858003, -0.60122954006514862, -0.60061647938386897,
+  -0.60000306537538906, -0.59938929840056454, -0.59877517882045872,
+  -0.59816070699634238, -0.59754588328969327, -0.5969307080621965,
+  -0.59631518167574382, -0.59569930449243347, -0.59508307687456996,
+  -0.59446649918466454, -0.59384957178543363, -0.5932322950397998,
+  -0.59261466931089113, -0.59199669496204099, -0.59137837235678758,
+  -0.59075970185887428, -0.59014068383224894, -0.58952131864106394,
+  -0.58890160664967584, -0.58828154822264533, -0.58766114372473677,
+  -0.58704039352091808, -0.5864192979763605, -0.58579785745643886,
+  -0.58517607232673041, -0.58455394295301533, -0.5839314697012763,
+  -0.58330865293769829, -0.58268549302866846, -0.58206199034077555,
+  -0.58143814524081028, -0.58081395809576453, -0.58018942927283168,
+  -0.57956455913940574, -0.57893934806308189, -0.57831379641165559,
+  -0.5776879045531228, -0.57706167285567955, -0.57643510168772183,
+  -0.57580819141784534, -0.57518094241484519, -0.57455335504771576,
+  -0.57392542968565075, -0.57329716669804232, -0.57266856645448116,
+  -0.57203962932475705, -0.57141035567885734, -0.57078074588696737,
+  -0.5701508003194703, -0.56952051934694725, -0.56888990334017597,
+  -0.56825895267013149, -0.56762766770798623, -0.56699604882510868,
+  -0.56636409639306395, -0.56573181078361323, -0.56509919236871409,
+  -0.5644662415205195, -0.56383295861137817, -0.56319934401383409,
+  -0.56256539810062656, -0.56193112124468947, -0.56129651381915147,
+  -0.56066157619733603, -0.56002630875276038, -0.55939071185913614,
+  -0.55875478589036831, -0.5581185312205561, -0.55748194822399166,
+  -0.5568450372751601, -0.55620779874873993, -0.55557023301960229,
+  -0.55493234046281037, -0.55429412145362011, -0.55365557636747931,
+  -0.55301670558002758, -0.55237750946709607, -0.55173798840470745,
+  -0.55109814276907543, -0.55045797293660481, -0.54981747928389102,
+  -0.54917666218771977, -0.54853552202506739, -0.54789405917310019,
+  -0.54725227400917409, -0.54661016691083486, -0.54596773825581768,
+  -0.54532498842204646, -0.54468191778763453, -0.54403852673088393,
+  -0.5433948156302848, -0.542750784864516, -0.54210643481244403,
+  -0.54146176585312356, -0.54081677836579667, -0.54017147272989297,
+  -0.53952584932502901, -0.53887990853100842, -0.5382336507278217,
+  -0.53758707629564551, -0.53694018561484302, -0.53629297906596318,
+  -0.53564545702974109, -0.53499761988709726, -0.53434946801913752,
+  -0.53370100180715296, -0.53305222163261967, -0.53240312787719801,
+  -0.53175372092273332, -0.531104001151255, -0.53045396894497632,
+  -0.52980362468629483, -0.52915296875779072, -0.52850200154222848,
+  -0.52785072342255546, -0.52719913478190139, -0.52654723600357933,
+  -0.52589502747108474, -0.52524250956809471, -0.52458968267846884,
+  -0.5239365471862486, -0.52328310347565643, -0.52262935193109672,
+  -0.52197529293715439, -0.52132092687859555, -0.52066625414036727,
+  -0.52001127510759604, -0.51935599016558953, -0.51870039969983517,
+  -0.51804450409599934, -0.51738830373992906, -0.51673179901764998,
+  -0.51607499031536663, -0.51541787801946315, -0.5147604625165012,
+  -0.51410274419322166, -0.51344472343654357, -0.51278640063356307,
+  -0.51212777617155469, -0.51146885043797052, -0.51080962382043904,
+  -0.5101500967067667, -0.50949026948493636, -0.50883014254310699,
+  -0.50816971626961471, -0.50750899105297087, -0.50684796728186332,
+  -0.50618664534515545, -0.50552502563188551, -0.50486310853126748,
+  -0.50420089443269056, -0.50353838372571758, -0.50287557680008688,
+  -0.5022124740457109, -0.50154907585267539, -0.50088538261124094,
+  -0.50022139471184068, -0.49955711254508189, -0.49889253650174475,
+  -0.49822766697278187, -0.49756250434931909, -0.49689704902265464,
+  -0.49623130138425831, -0.49556526182577249, -0.49489893073901131,
+  -0.49423230851595973, -0.49356539554877488, -0.49289819222978409,
+  -0.49223069895148608, -0.49156291610655006, -0.49089484408781514,
+  -0.4902264832882911, -0.48955783410115755, -0.48888889691976323,
+  -0.48821967213762674, -0.48755016014843605, -0.4868803613460474,
+  -0.48621027612448653, -0.48553990487794702, -0.48486924800079112,
+  -0.48419830588754914, -0.48352707893291874, -0.48285556753176567,
+  -0.48218377207912283, -0.48151169297018992, -0.4808393306003339,
+  -0.48016668536508844, -0.47949375766015301, -0.47882054788139405,
+  -0.47814705642484312, -0.47747328368669806, -0.47679923006332225,
+  -0.47612489595124363, -0.47545028174715587, -0.47477538784791723,
+  -0.47410021465055002, -0.47342476255224153, -0.4727490319503429,
+  -0.47207302324236866, -0.47139673682599781, -0.47072017309907171,
+  -0.47004333245959562, -0.46936621530573763, -0.46868882203582796,
+  -0.46801115304835983, -0.46733320874198853, -0.46665498951553097,
+  -0.46597649576796613, -0.46529772789843465, -0.46461868630623782,
+  -0.46393937139083846, -0.46325978355186026, -0.46257992318908681,
+  -0.46189979070246284, -0.46121938649209243, -0.46053871095824001,
+  -0.45985776450132965, -0.45917654752194415, -0.45849506042082622,
+  -0.45781330359887729, -0.45713127745715698, -0.45644898239688386,
+  -0.45576641881943475, -0.45508358712634384, -0.45440048771930375,
+  -0.45371712100016393, -0.45303348737093158, -0.452349587233771,
+  -0.45166542099100254, -0.45098098904510381, -0.45029629179870873,
+  -0.4496113296546066, -0.44892610301574326, -0.44824061228522,
+  -0.44755485786629301, -0.44686884016237433, -0.44618255957703012,
+  -0.44549601651398174, -0.444809211377105, -0.44412214457042926,
+  -0.44343481649813843, -0.44274722756457013, -0.44205937817421476,
+  -0.44137126873171662, -0.44068289964187302, -0.43999427130963326,
+  -0.43930538414010006, -0.43861623853852771, -0.43792683491032286,
+  -0.4372371736610442, -0.43654725519640125, -0.43585707992225547,
+  -0.43516664824461937, -0.43447596056965571, -0.43378501730367852,
+  -0.43309381885315201, -0.43240236562469014, -0.43171065802505737,
+  -0.43101869646116708, -0.43032648134008261, -0.4296340130690165,
+  -0.42894129205532955, -0.42824831870653191, -0.4275550934302822,
+  -0.42686161663438649, -0.42616788872679962, -0.42547391011562391,
+  -0.42477968120910881, -0.42408520241565167, -0.4233904741437961,
+  -0.42269549680223295, -0.42200027079979979, -0.4213047965454797,
+  -0.42060907444840251, -0.41991310491784373, -0.41921688836322396,
+  -0.4185204251941097, -0.41782371582021238, -0.41712676065138787,
+  -0.41642956009763732, -0.41573211456910542, -0.41503442447608163,
+  -0.41433649022899921, -0.41363831223843456, -0.41293989091510802,
+  -0.412241226669883, -0.41154231991376528, -0.41084317105790391,
+  -0.41014378051359035, -0.40944414869225759, -0.40874427600548152,
+  -0.40804416286497874, -0.40734380968260797, -0.40664321687036914,
+  -0.40594238484040257, -0.40524131400498986, -0.40454000477655311,
+  -0.40383845756765413, -0.40313667279099524, -0.40243465085941854,
+  -0.40173239218590501, -0.40102989718357579, -0.40032716626569015,
+  -0.39962419984564679, -0.39892099833698302, -0.39821756215337362,
+  -0.39751389170863233, -0.39680998741671042, -0.39610584969169632,
+  -0.3954014789478163, -0.39469687559943367, -0.3939920400610481,
+  -0.39328697274729657, -0.39258167407295153, -0.39187614445292235,
+  -0.39117038430225398, -0.39046439403612665, -0.38975817406985641,
+  -0.3890517248188945, -0.3883450466988263, -0.38763814012537268,
+  -0.38693100551438869, -0.38622364328186298, -0.38551605384391902,
+  -0.38480823761681293, -0.38410019501693504, -0.38339192646080877,
+  -0.38268343236508984, -0.38197471314656722, -0.38126576922216249,
+  -0.38055660100892857, -0.37984720892405111, -0.37913759338484743,
+  -0.37842775480876562, -0.37771769361338581, -0.37700741021641831,
+  -0.37629690503570479, -0.37558617848921733, -0.3748752309950576,
+  -0.37416406297145799, -0.37345267483678041, -0.37274106700951581,
+  -0.37202923990828496, -0.3713171939518376, -0.37060492955905167,
+  -0.36989244714893427, -0.36917974714062007, -0.36846682995337232,
+  -0.36775369600658209, -0.36704034571976724, -0.36632677951257359,
+  -0.36561299780477396, -0.36489900101626738, -0.36418478956707984,
+  -0.36347036387736387, -0.36275572436739723, -0.36204087145758435,
+  -0.36132580556845434, -0.36061052712066227, -0.35989503653498828,
+  -0.35917933423233656, -0.35846342063373654, -0.35774729616034201,
+  -0.35703096123343003, -0.35631441627440236, -0.35559766170478396,
+  -0.35488069794622279, -0.35416352542049051, -0.35344614454948087,
+  -0.35272855575521073, -0.35201075945981924, -0.35129275608556715,
+  -0.35057454605483757, -0.34985612979013503, -0.34913750771408503,
+  -0.34841868024943451, -0.34769964781905149, -0.34698041084592368,
+  -0.34626096975316017, -0.34554132496398915, -0.34482147690175929,
+  -0.34410142598993898, -0.3433811726521151, -0.34266071731199438,
+  -0.3419400603934023, -0.34121920232028241, -0.3404981435166971,
+  -0.33977688440682696, -0.33905542541496964, -0.33833376696554129,
+  -0.33761190948307468, -0.33688985339222005, -0.33616759911774469,
+  -0.33544514708453166, -0.33472249771758122, -0.33399965144200949,
+  -0.33327660868304798, -0.33255336986604422, -0.33182993541646122,
+  -0.33110630575987643, -0.33038248132198295, -0.32965846252858755,
+  -0.3289342498056122, -0.32820984357909266, -0.32748524427517806,
+  -0.32676045232013179, -0.32603546814033035, -0.32531029216226298,
+  -0.32458492481253215, -0.32385936651785296, -0.32313361770505233,
+  -0.32240767880107002, -0.32168155023295664, -0.32095523242787521,
+  -0.32022872581310002, -0.31950203081601575, -0.31877514786411848,
+  -0.31804807738501506, -0.31732081980642179, -0.31659337555616585,
+  -0.31586574506218407, -0.31513792875252244, -0.31440992705533682,
+  -0.31368174039889157, -0.3129533692115602, -0.31222481392182505,
+  -0.31149607495827597, -0.31076715274961147, -0.310038047724638,
+  -0.30930876031226878, -0.30857929094152503, -0.30784964004153498,
+  -0.3071198080415331, -0.30638979537086108, -0.30565960245896623,
+  -0.30492922973540243, -0.30419867762982927, -0.30346794657201137,
+  -0.30273703699181914, -0.3020059493192282, -0.301274683984318,
+  -0.3005432414172734, -0.29981162204838346, -0.29907982630804048,
+  -0.29834785462674157, -0.29761570743508631, -0.29688338516377827,
+  -0.29615088824362396, -0.29541821710553207, -0.29468537218051433,
+  -0.29395235389968477, -0.29321916269425868, -0.29248579899555383,
+  -0.29175226323498937, -0.29101855584408509, -0.29028467725446233,
+  -0.28955062789784314, -0.28881640820604948, -0.2880820186110043,
+  -0.28734745954472957, -0.28661273143934779, -0.28587783472708073,
+  -0.28514276984024872, -0.28440753721127182, -0.28367213727266855,
+  -0.28293657045705539, -0.2822008371971475, -0.28146493792575805,
+  -0.28072887307579719, -0.27999264308027338, -0.27925624837229124,
+  -0.27851968938505306, -0.2777829665518578, -0.27704608030609995,
+  -0.27630903108127103, -0.27557181931095825, -0.27483444542884394,
+  -0.27409690986870633, -0.27335921306441879, -0.27262135544994898,
+  -0.27188333745935989, -0.27114515952680807, -0.27040682208654482,
+  -0.2696683255729152, -0.26892967042035731, -0.26819085706340318,
+  -0.26745188593667774, -0.26671275747489842, -0.26597347211287553,
+  -0.2652340302855119, -0.26449443242780163, -0.26375467897483151,
+  -0.26301477036177906, -0.26227470702391359, -0.26153448939659563,
+  -0.26079411791527557, -0.26005359301549513, -0.25931291513288635,
+  -0.25857208470317039, -0.25783110216215893, -0.25708996794575323,
+  -0.25634868248994291, -0.25560724623080755, -0.25486565960451463,
+  -0.25412392304732062, -0.25338203699557027, -0.25264000188569558,
+  -0.25189781815421691, -0.25115548623774203, -0.25041300657296528,
+  -0.24967037959666852, -0.24892760574572026, -0.24818468545707478,
+  -0.24744161916777344, -0.2466984073149425, -0.24595505033579459,
+  -0.24521154866762768, -0.24446790274782421, -0.24372411301385213,
+  -0.24298017990326398, -0.24223610385369604, -0.2414918853028693,
+  -0.24074752468858854, -0.2400030224487415, -0.23925837902130012,
+  -0.2385135948443185, -0.23776867035593421, -0.23702360599436734,
+  -0.23627840219791962, -0.23553305940497546, -0.23478757805400108,
+  -0.23404195858354346, -0.23329620143223156, -0.23255030703877533,
+  -0.23180427584196478, -0.23105810828067128, -0.23031180479384553,
+  -0.22956536582051887, -0.22881879179980236, -0.22807208317088579,
+  -0.22732524037303883, -0.22657826384561011, -0.2258311540280262,
+  -0.22508391135979278, -0.22433653628049369, -0.22358902922979002,
+  -0.22284139064742128, -0.22209362097320359, -0.22134572064703081,
+  -0.22059769010887365, -0.21984952979877875, -0.21910124015686977,
+  -0.21835282162334643, -0.21760427463848367, -0.21685559964263257,
+  -0.2161067970762196, -0.21535786737974555, -0.21460881099378692,
+  -0.21385962835899383, -0.21311031991609136, -0.21236088610587858,
+  -0.21161132736922761, -0.21086164414708483, -0.21011183688046972,
+  -0.20936190601047419, -0.20861185197826346, -0.20786167522507515,
+  -0.20711137619221856, -0.20636095532107568, -0.20561041305309932,
+  -0.20485974982981442, -0.20410896609281701, -0.20335806228377337,
+  -0.20260703884442111, -0.20185589621656816, -0.20110463484209196,
+  -0.20035325516294042, -0.19960175762113105, -0.19885014265875012,
+  -0.19809841071795373, -0.197346562240966, -0.19659459767008022,
+  -0.19584251744765799, -0.19509032201612833, -0.1943380118179886,
+  -0.19358558729580375, -0.19283304889220529, -0.19208039704989238,
+  -0.19132763221163099, -0.1905747548202528, -0.18982176531865658,
+  -0.18906866414980628, -0.18831545175673212, -0.18756212858252974,
+  -0.18680869507035933, -0.18605515166344663, -0.18530149880508201,
+  -0.18454773693861964, -0.18379386650747839, -0.18303988795514106,
+  -0.18228580172515332, -0.18153160826112513, -0.18077730800672867,
+  -0.18002290140569951, -0.17926838890183588, -0.17851377093899759,
+  -0.17775904796110714, -0.17700422041214886, -0.17624928873616794,
+  -0.17549425337727137, -0.17473911477962731, -0.17398387338746385,
+  -0.17322852964507049, -0.17247308399679603, -0.17171753688704997,
+  -0.17096188876030136, -0.17020614006107812, -0.16945029123396793,
+  -0.16869434272361744, -0.16793829497473123, -0.16718214843207288,
+  -0.16642590354046422, -0.16566956074478414, -0.16491312048997009,
+  -0.16415658322101589, -0.16339994938297323, -0.16264321942095045,
+  -0.16188639378011188, -0.16112947290567878, -0.1603724572429284,
+  -0.15961534723719309, -0.15885814333386139, -0.15810084597837709,
+  -0.15734345561623828, -0.15658597269299859, -0.15582839765426532,
+  -0.15507073094570051, -0.15431297301302024, -0.1535551243019935,
+  -0.15279718525844341, -0.15203915632824616, -0.15128103795733025,
+  -0.15052283059167737, -0.14976453467732162, -0.14900615066034847,
+  -0.1482476789868962, -0.14748912010315368, -0.14673047445536175,
+  -0.14597174248981237, -0.14521292465284752, -0.14445402139086044,
+  -0.14369503315029458, -0.1429359603776427, -0.142176803519448,
+  -0.14141756302230313, -0.14065823933284924, -0.13989883289777738,
+  -0.13913934416382628, -0.13837977357778389, -0.13762012158648618,
+  -0.13686038863681643, -0.1361005751757062, -0.13534068165013433,
+  -0.13458070850712622, -0.13382065619375469, -0.13306052515713918,
+  -0.13230031584444468, -0.13154002870288328, -0.13077966417971179,
+  -0.13001922272223335, -0.12925870477779627, -0.12849811079379322,
+  -0.12773744121766228, -0.12697669649688598, -0.1262158770789904,
+  -0.12545498341154621, -0.12469401594216777, -0.1239329751185122,
+  -0.12317186138828065, -0.12241067519921628, -0.12164941699910554,
+  -0.12088808723577722, -0.12012668635710158, -0.11936521481099135,
+  -0.11860367304540084, -0.11784206150832502, -0.11708038064780055,
+  -0.11631863091190488, -0.11555681274875529, -0.11479492660651025,
+  -0.1140329729333673, -0.11327095217756436, -0.11250886478737883,
+  -0.11174671121112666, -0.11098449189716338, -0.11022220729388318,
+  -0.10945985784971803, -0.10869744401313867, -0.10793496623265376,
+  -0.10717242495680887, -0.10640982063418784, -0.1056471537134107,
+  -0.10488442464313497, -0.10412163387205473, -0.1033587818488997,
+  -0.10259586902243628, -0.10183289584146667, -0.10106986275482788,
+  -0.10030677021139282, -0.099543618660069444, -0.098780408549799664,
+  -0.09801714032956077, -0.097253814448363354, -0.096490431355252607,
+  -0.095726991499307315, -0.094963495329639061, -0.09419994329539319,
+  -0.093436335845747912, -0.092672673429913366, -0.091908956497132696,
+  -0.09114518549668113, -0.090381360877865011, -0.089617483090022917,
+  -0.088853552582524684, -0.088089569804770507, -0.087325535206192226,
+  -0.086561449236251239, -0.08579731234443988, -0.085033124980280414,
+  -0.084268887593324127, -0.083504600633152404, -0.082740264549375803,
+  -0.081975879791633108, -0.081211446809592386, -0.080446966052950097,
+  -0.079682437971430126, -0.078917863014785095, -0.078153241632794315,
+  -0.077388574275265049, -0.076623861392031617, -0.075859103432954503,
+  -0.075094300847921291, -0.074329454086845867, -0.073564563599667454,
+  -0.072799629836351618, -0.072034653246889416, -0.071269634281296415,
+  -0.070504573389614009, -0.069739471021907376, -0.068974327628266732,
+  -0.068209143658806454, -0.067443919563664106, -0.066678655793001543,
+  -0.06591335279700393, -0.06514801102587886, -0.06438263092985741,
+  -0.06361721295919319, -0.06285175756416142, -0.062086265195060247,
+  -0.061320736302208648, -0.060555171335947781, -0.059789570746640007,
+  -0.059023934984667986, -0.058258264500435732, -0.057492559744367684,
+  -0.056726821166907783, -0.05596104921852052, -0.055195244349690031,
+  -0.054429407010919147, -0.053663537652730679, -0.052897636725665401,
+  -0.052131704680283317, -0.051365741967162731, -0.050599749036899337,
+  -0.049833726340107257, -0.049067674327418126, -0.048301593449480172,
+  -0.047535484156959261, -0.04676934690053796, -0.046003182130914644,
+  -0.04523699029880475, -0.044470771854938744, -0.043704527250063421,
+  -0.042938256934940959, -0.042171961360348002, -0.041405640977076712,
+  -0.040639296235933854, -0.039872927587739845, -0.039106535483329839,
+  -0.038340120373552791, -0.037573682709270514, -0.036807222941358991,
+  -0.036040741520706299, -0.035274238898213947, -0.034507715524795889,
+  -0.033741171851377642, -0.032974608328897315, -0.032208025408304704,
+  -0.031441423540560343, -0.030674803176636581, -0.029908164767516655,
+  -0.02914150876419374, -0.028374835617672258, -0.02760814577896582,
+  -0.026841439699098527, -0.02607471782910404, -0.02530798062002463,
+  -0.024541228522912264, -0.023774461988827676, -0.02300768146883941,
+  -0.022240887414024919, -0.021474080275469605, -0.020707260504265912,
+  -0.019940428551514598, -0.019173584868322699, -0.01840672990580482,
+  -0.017639864115082195, -0.016872987947281773, -0.016106101853537263,
+  -0.01533920628498822, -0.014572301692779104, -0.013805388528060349,
+  -0.013038467241987433, -0.012271538285719944, -0.011504602110422875,
+  -0.010737659167264572, -0.0099707099074180291, -0.0092037547820599599,
+  -0.0084367942423698595, -0.0076698287395310771, -0.0069028587247298772,
+  -0.0061358846491545152, -0.0053689069639963026, -0.004601926120448672,
+  -0.0038349425697062479, -0.0030679567629661379, -0.0023009691514258865,
+  -0.0015339801862847662, -0.00076699031874284641, 0,
+  0.00076699031874270449, 0.0015339801862847655, 0.002300969151425805,
+  0.0030679567629659761, 0.0038349425697062275, 0.0046019261204485705,
+  0.0053689069639963425, 0.0061358846491544753, 0.0069028587247297558,
+  0.007669828739531097, 0.0084367942423697988, 0.0092037547820598194,
+  0.0099707099074180308, 0.010737659167264491, 0.011504602110422714,
+  0.012271538285719925, 0.013038467241987334, 0.013805388528060391,
+  0.014572301692779064, 0.0153392062849881, 0.016106101853537287,
+  0.01687298794728171, 0.017639864115082053, 0.01840672990580482,
+  0.019173584868322623, 0.019940428551514441, 0.020707260504265895,
+  0.021474080275469508, 0.022240887414024961, 0.023007681468839369,
+  0.023774461988827555, 0.024541228522912288, 0.025307980620024571,
+  0.026074717829103901, 0.026841439699098531, 0.02760814577896574,
+  0.028374835617672099, 0.029141508764193722, 0.029908164767516555,
+  0.030674803176636626, 0.031441423540560301, 0.032208025408304586,
+  0.032974608328897335, 0.03374117185137758, 0.03450771552479575,
+  0.035274238898213947, 0.036040741520706229, 0.036807222941358832,
+  0.037573682709270494, 0.038340120373552694, 0.039106535483329888,
+  0.039872927587739811, 0.040639296235933736, 0.041405640977076739,
+  0.042171961360347947, 0.04293825693494082, 0.043704527250063421,
+  0.044470771854938668, 0.04523699029880459, 0.046003182130914623,
+  0.046769346900537863, 0.047535484156959303, 0.048301593449480144,
+  0.049067674327418015, 0.049833726340107277, 0.050599749036899282,
+  0.051365741967162593, 0.052131704680283324, 0.052897636725665324,
+  0.05366353765273052, 0.054429407010919133, 0.055195244349689934,
+  0.055961049218520569, 0.056726821166907748, 0.057492559744367566,
+  0.058258264500435752, 0.059023934984667931, 0.059789570746639868,
+  0.060555171335947788, 0.061320736302208578, 0.062086265195060088,
+  0.062851757564161406, 0.063617212959193106, 0.064382630929857465,
+  0.065148011025878833, 0.065913352797003805, 0.066678655793001557,
+  0.067443919563664051, 0.068209143658806329, 0.068974327628266746,
+  0.069739471021907307, 0.070504573389613856, 0.071269634281296401,
+  0.072034653246889332, 0.072799629836351673, 0.073564563599667426,
+  0.074329454086845756, 0.075094300847921305, 0.075859103432954447,
+  0.076623861392031492, 0.077388574275265049, 0.078153241632794232,
+  0.078917863014784942, 0.079682437971430126, 0.080446966052950014,
+  0.081211446809592441, 0.081975879791633066, 0.082740264549375692,
+  0.083504600633152432, 0.084268887593324071, 0.085033124980280275,
+  0.085797312344439894, 0.08656144923625117, 0.087325535206192059,
+  0.088089569804770507, 0.0888535525825246, 0.089617483090022959,
+  0.090381360877864983, 0.091145185496681005, 0.091908956497132724,
+  0.09267267342991331, 0.093436335845747787, 0.094199943295393204,
+  0.094963495329638992, 0.095726991499307162, 0.096490431355252593,
+  0.097253814448363271, 0.098017140329560604, 0.098780408549799623,
+  0.099543618660069319, 0.10030677021139286, 0.10106986275482782,
+  0.10183289584146653, 0.10259586902243628, 0.10335878184889961,
+  0.10412163387205459, 0.10488442464313497, 0.10564715371341062,
+  0.10640982063418768, 0.10717242495680884, 0.10793496623265365,
+  0.10869744401313872, 0.10945985784971798, 0.11022220729388306,
+  0.11098449189716339, 0.11174671121112659, 0.11250886478737869,
+  0.11327095217756435, 0.1140329729333672, 0.11479492660651008,
+  0.11555681274875526, 0.11631863091190475, 0.11708038064780059,
+  0.11784206150832498, 0.11860367304540072, 0.11936521481099135,
+  0.1201266863571015, 0.12088808723577708, 0.12164941699910553,
+  0.1224106751992162, 0.12317186138828048, 0.12393297511851216,
+  0.12469401594216764, 0.12545498341154623, 0.12621587707899035,
+  0.12697669649688587, 0.12773744121766231, 0.12849811079379317,
+  0.12925870477779614, 0.13001922272223335, 0.13077966417971171,
+  0.13154002870288312, 0.13230031584444465, 0.13306052515713906,
+  0.13382065619375472, 0.13458070850712617, 0.13534068165013421,
+  0.1361005751757062, 0.13686038863681638, 0.13762012158648604,
+  0.13837977357778389, 0.1391393441638262, 0.13989883289777721,
+  0.14065823933284921, 0.14141756302230302, 0.14217680351944803,
+  0.14293596037764267, 0.14369503315029447, 0.14445402139086047,
+  0.14521292465284746, 0.14597174248981221, 0.14673047445536175,
+  0.14748912010315357, 0.14824767898689603, 0.14900615066034845,
+  0.14976453467732151, 0.1505228305916774, 0.15128103795733022,
+  0.15203915632824605, 0.15279718525844344, 0.15355512430199345,
+  0.1543129730130201, 0.15507073094570051, 0.15582839765426523,
+  0.15658597269299843, 0.15734345561623825, 0.15810084597837698,
+  0.15885814333386145, 0.15961534723719306, 0.16037245724292828,
+  0.16112947290567881, 0.16188639378011183, 0.16264321942095031,
+  0.16339994938297323, 0.16415658322101581, 0.16491312048996992,
+  0.16566956074478412, 0.1664259035404641, 0.16718214843207294,
+  0.16793829497473117, 0.16869434272361733, 0.16945029123396796,
+  0.17020614006107807, 0.17096188876030122, 0.17171753688704997,
+  0.17247308399679595, 0.17322852964507032, 0.17398387338746382,
+  0.1747391147796272, 0.17549425337727143, 0.17624928873616791,
+  0.17700422041214875, 0.17775904796110717, 0.17851377093899751,
+  0.17926838890183575, 0.18002290140569951, 0.18077730800672859,
+  0.18153160826112497, 0.1822858017251533, 0.18303988795514095,
+  0.18379386650747845, 0.18454773693861962, 0.1853014988050819,
+  0.18605515166344663, 0.18680869507035927, 0.1875621285825296,
+  0.18831545175673212, 0.18906866414980619, 0.18982176531865641,
+  0.19057475482025274, 0.1913276322116309, 0.19208039704989244,
+  0.19283304889220523, 0.19358558729580361, 0.1943380118179886,
+  0.19509032201612825, 0.19584251744765785, 0.19659459767008022,
+  0.19734656224096592, 0.19809841071795356, 0.19885014265875009,
+  0.19960175762113097, 0.20035325516294045, 0.2011046348420919,
+  0.20185589621656805, 0.20260703884442113, 0.20335806228377332,
+  0.20410896609281687, 0.20485974982981442, 0.20561041305309924,
+  0.20636095532107551, 0.20711137619221856, 0.20786167522507507,
+  0.20861185197826349, 0.20936190601047416, 0.21011183688046961,
+  0.21086164414708486, 0.21161132736922755, 0.21236088610587842,
+  0.21311031991609136, 0.21385962835899375, 0.21460881099378676,
+  0.21535786737974555, 0.21610679707621952, 0.21685559964263262,
+  0.21760427463848364, 0.21835282162334632, 0.2191012401568698,
+  0.2198495297987787, 0.22059769010887351, 0.22134572064703081,
+  0.22209362097320351, 0.22284139064742112, 0.22358902922978999,
+  0.2243365362804936, 0.22508391135979283, 0.22583115402802617,
+  0.22657826384561, 0.22732524037303886, 0.22807208317088573,
+  0.22881879179980222, 0.22956536582051887, 0.23031180479384544,
+  0.23105810828067111, 0.23180427584196478, 0.23255030703877524,
+  0.23329620143223159, 0.23404195858354343, 0.23478757805400097,
+  0.23553305940497549, 0.23627840219791957, 0.2370236059943672,
+  0.23776867035593419, 0.23851359484431842, 0.23925837902129998,
+  0.2400030224487415, 0.24074752468858843, 0.24149188530286933,
+  0.24223610385369601, 0.24298017990326387, 0.24372411301385216,
+  0.24446790274782415, 0.24521154866762754, 0.24595505033579459,
+  0.24669840731494241, 0.24744161916777327, 0.24818468545707478,
+  0.24892760574572015, 0.24967037959666855, 0.25041300657296522,
+  0.25115548623774192, 0.25189781815421697, 0.25264000188569552,
+  0.25338203699557016, 0.25412392304732062, 0.25486565960451457,
+  0.25560724623080738, 0.25634868248994291, 0.25708996794575312,
+  0.25783110216215899, 0.25857208470317034, 0.25931291513288623,
+  0.26005359301549519, 0.26079411791527551, 0.26153448939659552,
+  0.26227470702391359, 0.263014770361779, 0.26375467897483135,
+  0.26449443242780163, 0.26523403028551179, 0.26597347211287559,
+  0.26671275747489837, 0.26745188593667762, 0.26819085706340318,
+  0.26892967042035726, 0.26966832557291509, 0.27040682208654482,
+  0.27114515952680801, 0.27188333745935972, 0.27262135544994898,
+  0.27335921306441868, 0.27409690986870638, 0.27483444542884394,
+  0.27557181931095814, 0.27630903108127108, 0.2770460803060999,
+  0.27778296655185769, 0.27851968938505306, 0.27925624837229118,
+  0.27999264308027322, 0.28072887307579719, 0.28146493792575794,
+  0.28220083719714756, 0.28293657045705539, 0.28367213727266843,
+  0.28440753721127188, 0.28514276984024867, 0.28587783472708062,
+  0.28661273143934779, 0.28734745954472951, 0.28808201861100413,
+  0.28881640820604948, 0.28955062789784303, 0.29028467725446233,
+  0.29101855584408509, 0.29175226323498926, 0.29248579899555388,
+  0.29321916269425863, 0.29395235389968466, 0.29468537218051433,
+  0.29541821710553201, 0.29615088824362379, 0.29688338516377827,
+  0.2976157074350862, 0.2983478546267414, 0.29907982630804048,
+  0.29981162204838335, 0.30054324141727345, 0.30127468398431795,
+  0.30200594931922808, 0.30273703699181914, 0.30346794657201132,
+  0.30419867762982911, 0.30492922973540237, 0.30565960245896612,
+  0.30638979537086092, 0.3071198080415331, 0.30784964004153487,
+  0.30857929094152509, 0.30930876031226873, 0.31003804772463789,
+  0.31076715274961147, 0.31149607495827591, 0.31222481392182488,
+  0.3129533692115602, 0.31368174039889152, 0.31440992705533666,
+  0.31513792875252244, 0.31586574506218396, 0.31659337555616585,
+  0.31732081980642174, 0.31804807738501495, 0.31877514786411848,
+  0.31950203081601569, 0.32022872581309986, 0.32095523242787521,
+  0.32168155023295658, 0.32240767880106985, 0.32313361770505233,
+  0.32385936651785285, 0.32458492481253215, 0.32531029216226293,
+  0.32603546814033024, 0.32676045232013173, 0.327485244275178,
+  0.3282098435790925, 0.3289342498056122, 0.32965846252858749,
+  0.33038248132198278, 0.33110630575987643, 0.33182993541646111,
+  0.33255336986604422, 0.33327660868304793, 0.33399965144200938,
+  0.33472249771758122, 0.3354451470845316, 0.33616759911774452,
+  0.33688985339222005, 0.33761190948307462, 0.33833376696554113,
+  0.33905542541496964, 0.33977688440682685, 0.34049814351669716,
+  0.34121920232028236, 0.34194006039340219, 0.34266071731199438,
+  0.34338117265211504, 0.34410142598993881, 0.34482147690175929,
+  0.34554132496398909, 0.34626096975316001, 0.34698041084592368,
+  0.34769964781905138, 0.34841868024943456, 0.34913750771408497,
+  0.34985612979013492, 0.35057454605483751, 0.35129275608556709,
+  0.35201075945981908, 0.35272855575521073, 0.35344614454948081,
+  0.35416352542049034, 0.35488069794622279, 0.35559766170478385,
+  0.35631441627440241, 0.35703096123342998, 0.3577472961603419,
+  0.35846342063373654, 0.3591793342323365, 0.35989503653498811,
+  0.36061052712066227, 0.36132580556845428, 0.36204087145758418,
+  0.36275572436739723, 0.36347036387736376, 0.36418478956707989,
+  0.36489900101626732, 0.36561299780477385, 0.36632677951257359,
+  0.36704034571976718, 0.36775369600658198, 0.36846682995337232,
+  0.36917974714062002, 0.3698924471489341, 0.37060492955905167,
+  0.37131719395183754, 0.37202923990828501, 0.37274106700951576,
+  0.3734526748367803, 0.37416406297145793, 0.37487523099505754,
+  0.37558617848921722, 0.37629690503570479, 0.37700741021641826,
+  0.37771769361338564, 0.37842775480876556, 0.37913759338484732,
+  0.37984720892405116, 0.38055660100892852, 0.38126576922216238,
+  0.38197471314656722, 0.38268343236508978, 0.38339192646080866,
+  0.38410019501693504, 0.38480823761681288, 0.38551605384391885,
+  0.38622364328186298, 0.38693100551438858, 0.38763814012537273,
+  0.38834504669882625, 0.38905172481889438, 0.38975817406985641,
+  0.39046439403612659, 0.39117038430225387, 0.39187614445292235,
+  0.39258167407295147, 0.3932869727472964, 0.3939920400610481,
+  0.39469687559943356, 0.39540147894781635, 0.39610584969169627,
+  0.39680998741671031, 0.39751389170863233, 0.39821756215337356,
+  0.39892099833698291, 0.39962419984564679, 0.40032716626569009,
+  0.40102989718357562, 0.40173239218590501, 0.40243465085941843,
+  0.4031366727909953, 0.40383845756765407, 0.404540004776553,
+  0.40524131400498986, 0.40594238484040251, 0.40664321687036903,
+  0.40734380968260797, 0.40804416286497869, 0.40874427600548136,
+  0.40944414869225759, 0.41014378051359024, 0.41084317105790391,
+  0.41154231991376522, 0.41224122666988289, 0.41293989091510808,
+  0.4136383122384345, 0.4143364902289991, 0.41503442447608163,
+  0.41573211456910536, 0.41642956009763715, 0.41712676065138787,
+  0.41782371582021227, 0.4185204251941097, 0.41921688836322391,
+  0.41991310491784362, 0.42060907444840251, 0.42130479654547964,
+  0.42200027079979968, 0.42269549680223295, 0.42339047414379605,
+  0.42408520241565156, 0.42477968120910881, 0.4254739101156238,
+  0.42616788872679962, 0.42686161663438643, 0.42755509343028208,
+  0.42824831870653196, 0.42894129205532949, 0.42963401306901638,
+  0.43032648134008261, 0.43101869646116703, 0.43171065802505726,
+  0.43240236562469014, 0.43309381885315196, 0.43378501730367852,
+  0.43447596056965565, 0.43516664824461926, 0.43585707992225547,
+  0.4365472551964012, 0.43723717366104409, 0.43792683491032286,
+  0.43861623853852766, 0.43930538414009995, 0.43999427130963326,
+  0.4406828996418729, 0.44137126873171667, 0.4420593781742147,
+  0.44274722756457002, 0.44343481649813848, 0.4441221445704292,
+  0.44480921137710488, 0.44549601651398174, 0.44618255957703007,
+  0.44686884016237416, 0.44755485786629301, 0.44824061228521989,
+  0.44892610301574326, 0.44961132965460654, 0.45029629179870861,
+  0.45098098904510386, 0.45166542099100249, 0.45234958723377089,
+  0.45303348737093158, 0.45371712100016387, 0.45440048771930358,
+  0.45508358712634384, 0.45576641881943464, 0.45644898239688392,
+  0.45713127745715698, 0.45781330359887717, 0.45849506042082627,
+  0.45917654752194409, 0.45985776450132954, 0.46053871095824001,
+  0.46121938649209238, 0.46189979070246273, 0.46257992318908681,
+  0.46325978355186015, 0.46393937139083852, 0.46461868630623782,
+  0.4652977278984346, 0.46597649576796618, 0.46665498951553092,
+  0.46733320874198842, 0.46801115304835983, 0.4686888220358279,
+  0.46936621530573752, 0.47004333245959562, 0.4707201730990716,
+  0.47139673682599764, 0.47207302324236866, 0.47274903195034279,
+  0.47342476255224153, 0.47410021465054997, 0.47477538784791712,
+  0.47545028174715587, 0.47612489595124358, 0.47679923006332209,
+  0.47747328368669806, 0.47814705642484301, 0.47882054788139389,
+  0.47949375766015301, 0.48016668536508839, 0.48083933060033396,
+  0.48151169297018986, 0.48218377207912272, 0.48285556753176567,
+  0.48352707893291874, 0.48419830588754903, 0.48486924800079106,
+  0.48553990487794696, 0.48621027612448642, 0.48688036134604734,
+  0.487550160148436, 0.48821967213762679, 0.48888889691976317,
+  0.48955783410115744, 0.49022648328829116, 0.49089484408781509,
+  0.4915629161065499, 0.49223069895148602, 0.49289819222978404,
+  0.49356539554877477, 0.49423230851595967, 0.49489893073901126,
+  0.49556526182577254, 0.49623130138425825, 0.49689704902265447,
+  0.49756250434931915, 0.49822766697278187, 0.49889253650174459,
+  0.49955711254508184, 0.50022139471184068, 0.50088538261124071,
+  0.50154907585267539, 0.50221247404571079, 0.50287557680008699,
+  0.50353838372571758, 0.50420089443269034, 0.50486310853126759,
+  0.50552502563188539, 0.50618664534515523, 0.50684796728186321,
+  0.50750899105297087, 0.5081697162696146, 0.50883014254310699,
+  0.50949026948493636, 0.51015009670676681, 0.51080962382043904,
+  0.5114688504379703, 0.51212777617155469, 0.51278640063356296,
+  0.51344472343654346, 0.51410274419322166, 0.5147604625165012,
+  0.51541787801946293, 0.51607499031536663, 0.51673179901764987,
+  0.51738830373992906, 0.51804450409599934, 0.51870039969983495,
+  0.51935599016558964, 0.52001127510759604, 0.52066625414036716,
+  0.52132092687859566, 0.52197529293715439, 0.52262935193109661,
+  0.52328310347565643, 0.5239365471862486, 0.52458968267846895,
+  0.52524250956809471, 0.52589502747108463, 0.52654723600357944,
+  0.52719913478190128, 0.52785072342255523, 0.52850200154222848,
+  0.52915296875779061, 0.52980362468629461, 0.53045396894497632,
+  0.531104001151255, 0.53175372092273332, 0.5324031278771979,
+  0.53305222163261945, 0.53370100180715296, 0.53434946801913752,
+  0.53499761988709715, 0.53564545702974109, 0.53629297906596318,
+  0.53694018561484291, 0.53758707629564539, 0.5382336507278217,
+  0.53887990853100842, 0.53952584932502889, 0.54017147272989285,
+  0.54081677836579667, 0.54146176585312344, 0.54210643481244392,
+  0.54275078486451589, 0.5433948156302848, 0.54403852673088382,
+  0.54468191778763453, 0.54532498842204646, 0.54596773825581757,
+  0.54661016691083486, 0.54725227400917409, 0.54789405917310019,
+  0.54853552202506739, 0.54917666218771966, 0.54981747928389091,
+  0.55045797293660481, 0.55109814276907543, 0.55173798840470734,
+  0.55237750946709607, 0.55301670558002747, 0.55365557636747931,
+  0.55429412145362, 0.55493234046281037, 0.55557023301960218,
+  0.55620779874873993, 0.5568450372751601, 0.55748194822399155,
+  0.5581185312205561, 0.55875478589036831, 0.55939071185913614,
+  0.56002630875276038, 0.56066157619733603, 0.56129651381915147,
+  0.56193112124468947, 0.56256539810062656, 0.56319934401383409,
+  0.56383295861137817, 0.5644662415205195, 0.56509919236871398,
+  0.56573181078361312, 0.56636409639306384, 0.56699604882510868,
+  0.56762766770798623, 0.56825895267013149, 0.56888990334017586,
+  0.56952051934694714, 0.5701508003194703, 0.57078074588696726,
+  0.57141035567885723, 0.57203962932475705, 0.57266856645448116,
+  0.5732971666980422, 0.57392542968565075, 0.57455335504771576,
+  0.57518094241484508, 0.57580819141784534, 0.57643510168772183,
+  0.57706167285567944, 0.5776879045531228, 0.57831379641165559,
+  0.57893934806308178, 0.57956455913940563, 0.58018942927283168,
+  0.58081395809576453, 0.58143814524081017, 0.58206199034077544,
+  0.58268549302866846, 0.58330865293769829, 0.58393146970127618,
+  0.58455394295301533, 0.58517607232673041, 0.58579785745643886,
+  0.5864192979763605, 0.58704039352091797, 0.58766114372473666,
+  0.58828154822264522, 0.58890160664967572, 0.58952131864106394,
+  0.59014068383224882, 0.59075970185887416, 0.59137837235678758,
+  0.59199669496204099, 0.59261466931089113, 0.5932322950397998,
+  0.59384957178543363, 0.59446649918466443, 0.59508307687456996,
+  0.59569930449243336, 0.59631518167574371, 0.5969307080621965,
+  0.59754588328969316, 0.59816070699634227, 0.59877517882045872,
+  0.59938929840056454, 0.60000306537538894, 0.60061647938386897,
+  0.6012295400651485, 0.60184224705858003, 0.60245460000372375,
+  0.60306659854034816, 0.60367824230843037, 0.60428953094815596,
+  0.60490046409991982, 0.60551104140432555, 0.60612126250218612,
+  0.60673112703452448, 0.60734063464257293, 0.60794978496777363,
+  0.60855857765177945, 0.60916701233645321, 0.60977508866386843,
+  0.61038280627630948, 0.61099016481627166, 0.61159716392646191,
+  0.61220380324979795, 0.61281008242940971, 0.61341600110863859,
+  0.61402155893103838, 0.61462675554037505, 0.61523159058062682,
+  0.61583606369598509, 0.61644017453085365, 0.61704392272984976,
+  0.61764730793780387, 0.61825032979976025, 0.61885298796097632,
+  0.61945528206692402, 0.6200572117632891, 0.62065877669597214,
+  0.62125997651108755, 0.62186081085496536, 0.62246127937414997,
+  0.62306138171540126, 0.62366111752569453, 0.62426048645222065,
+  0.62485948814238634, 0.62545812224381436, 0.62605638840434352,
+  0.62665428627202935, 0.62725181549514408, 0.62784897572217646,
+  0.62844576660183271, 0.629042187783036, 0.62963823891492698,
+  0.63023391964686437, 0.63082922962842447, 0.63142416850940186,
+  0.63201873593980906, 0.63261293156987741, 0.63320675505005719,
+  0.63380020603101728, 0.63439328416364549, 0.63498598909904946,
+  0.63557832048855611, 0.63617027798371217, 0.6367618612362842,
+  0.63735306989825913, 0.63794390362184406, 0.63853436205946679,
+  0.63912444486377573, 0.63971415168764045, 0.64030348218415167,
+  0.64089243600662138, 0.64148101280858316, 0.64206921224379254,
+  0.64265703396622686, 0.64324447763008585, 0.64383154288979139,
+  0.64441822939998838, 0.64500453681554393, 0.64559046479154869,
+  0.64617601298331628, 0.64676118104638392, 0.64734596863651206,
+  0.64793037540968534, 0.64851440102211244, 0.64909804513022595,
+  0.64968130739068319, 0.65026418746036585, 0.65084668499638088,
+  0.65142879965605982, 0.6520105310969595, 0.65259187897686244,
+  0.65317284295377676, 0.65375342268593606, 0.65433361783180044,
+  0.65491342805005603, 0.65549285299961535, 0.6560718923396176,
+  0.65665054572942894, 0.65722881282864254, 0.65780669329707864,
+  0.65838418679478505, 0.65896129298203732, 0.65953801151933866,
+  0.66011434206742048, 0.6606902842872423, 0.66126583783999227,
+  0.66184100238708687, 0.66241577759017178, 0.66299016311112147,
+  0.66356415861203977, 0.66413776375526001, 0.66471097820334479,
+  0.66528380161908718, 0.66585623366550972, 0.66642827400586524,
+  0.66699992230363747, 0.66757117822254031, 0.66814204142651845,
+  0.66871251157974798, 0.66928258834663601, 0.66985227139182102,
+  0.67042156038017309, 0.67099045497679422, 0.67155895484701833,
+  0.67212705965641173, 0.67269476907077286, 0.67326208275613297,
+  0.67382900037875604, 0.67439552160513905, 0.67496164610201193,
+  0.67552737353633852, 0.67609270357531592, 0.67665763588637495,
+  0.67722217013718033, 0.6777863059956315, 0.67835004312986147,
+  0.67891338120823841, 0.67947631989936497, 0.68003885887207893,
+  0.68060099779545302, 0.68116273633879543, 0.68172407417164971,
+  0.68228501096379557, 0.68284554638524808, 0.68340568010625868,
+  0.6839654117973154, 0.6845247411291423, 0.68508366777270036,
+  0.68564219139918747, 0.68620031168003859, 0.68675802828692589,
+  0.68731534089175905, 0.68787224916668555, 0.68842875278409044,
+  0.68898485141659704, 0.68954054473706683, 0.69009583241859995,
+  0.6906507141345346, 0.69120518955844845, 0.69175925836415775,
+  0.69231292022571822, 0.69286617481742463, 0.69341902181381176,
+  0.693971460889654, 0.69452349171996552, 0.69507511398000088,
+  0.69562632734525487, 0.69617713149146299, 0.6967275260946012,
+  0.69727751083088652, 0.69782708537677729, 0.69837624940897292,
+  0.69892500260441415, 0.69947334464028377, 0.70002127519400625,
+  0.70056879394324834, 0.70111590056591866, 0.70166259474016845,
+  0.70220887614439187, 0.7027547444572253, 0.70330019935754873,
+  0.70384524052448494, 0.70438986763740041, 0.70493408037590488,
+  0.7054778784198521, 0.70602126144933974, 0.70656422914470951,
+  0.70710678118654746, 0.70764891725568435, 0.70819063703319529,
+  0.70873194020040065, 0.70927282643886558, 0.70981329543040084,
+  0.71035334685706231, 0.71089298040115168, 0.71143219574521643,
+  0.71197099257204999, 0.71250937056469232, 0.71304732940642923,
+  0.71358486878079352, 0.71412198837156471, 0.71465868786276898,
+  0.71519496693868001, 0.71573082528381859, 0.71626626258295312,
+  0.71680127852109954, 0.71733587278352173, 0.71787004505573171,
+  0.71840379502348972, 0.71893712237280438, 0.71947002678993299,
+  0.72000250796138165, 0.72053456557390527, 0.72106619931450811,
+  0.72159740887044366, 0.72212819392921535, 0.72265855417857561,
+  0.72318848930652735, 0.72371799900132339, 0.72424708295146689,
+  0.72477574084571128, 0.72530397237306066, 0.72583177722277037,
+  0.72635915508434601, 0.72688610564754497, 0.72741262860237577,
+  0.72793872363909862, 0.7284643904482252, 0.72898962872051931,
+  0.7295144381469969, 0.73003881841892615, 0.73056276922782759,
+  0.73108629026547423, 0.73160938122389252, 0.73213204179536129,
+  0.73265427167241282, 0.73317607054783274, 0.73369743811466026,
+  0.73421837406618817, 0.73473887809596339, 0.73525894989778673,
+  0.73577858916571348, 0.73629779559405306, 0.73681656887736979,
+  0.73733490871048279, 0.73785281478846598, 0.73837028680664851,
+  0.73888732446061511, 0.73940392744620576, 0.73992009545951609,
+  0.74043582819689802, 0.74095112535495911, 0.74146598663056329,
+  0.74198041172083096, 0.74249440032313918, 0.74300795213512172,
+  0.74352106685466912, 0.74403374417992918, 0.74454598380930725,
+  0.74505778544146595, 0.74556914877532543, 0.74608007351006378,
+  0.74659055934511731, 0.74710060598018013, 0.74761021311520515,
+  0.74811938045040349, 0.74862810768624533, 0.74913639452345926,
+  0.74964424066303348, 0.75015164580621496, 0.75065860965451059,
+  0.75116513190968637, 0.75167121227376843, 0.7521768504490427,
+  0.75268204613805523, 0.75318679904361241, 0.75369110886878121,
+  0.75419497531688917, 0.75469839809152439, 0.75520137689653655,
+  0.75570391143603588, 0.75620600141439454, 0.75670764653624567,
+  0.75720884650648446, 0.75770960103026808, 0.75820990981301528,
+  0.75870977256040739, 0.75920918897838796, 0.75970815877316344,
+  0.76020668165120242, 0.76070475731923692, 0.76120238548426178,
+  0.76169956585353527, 0.7621962981345789, 0.76269258203517787,
+  0.76318841726338127, 0.76368380352750187, 0.76417874053611667,
+  0.76467322799806714, 0.76516726562245896, 0.76566085311866239,
+  0.76615399019631281, 0.76664667656531038, 0.7671389119358204,
+  0.76763069601827327, 0.76812202852336531, 0.76861290916205827,
+  0.76910333764557959, 0.76959331368542294, 0.7700828369933479,
+  0.7705719072813807, 0.77106052426181371, 0.7715486876472063,
+  0.77203639715038441, 0.77252365248444133, 0.77301045336273699,
+  0.77349679949889905, 0.77398269060682279, 0.77446812640067086,
+  0.77495310659487382, 0.77543763090413043, 0.77592169904340758,
+  0.77640531072794039, 0.77688846567323244, 0.7773711635950562,
+  0.77785340420945304, 0.77833518723273309, 0.77881651238147587,
+  0.7792973793725303, 0.77977778792301444, 0.78025773775031659,
+  0.78073722857209438, 0.78121626010627609, 0.78169483207105939,
+  0.7821729441849129, 0.78265059616657573, 0.78312778773505731,
+  0.7836045186096382, 0.78408078850986995, 0.78455659715557524,
+  0.78503194426684808, 0.78550682956405393, 0.78598125276783015,
+  0.78645521359908577, 0.7869287117790017, 0.78740174702903132,
+  0.78787431907090011, 0.78834642762660623, 0.78881807241842017,
+  0.78928925316888565, 0.78975996960081907, 0.79023022143731003,
+  0.79070000840172161, 0.79116933021769009, 0.79163818660912577,
+  0.79210657730021239, 0.79257450201540758, 0.79304196047944364,
+  0.79350895241732666, 0.79397547755433717, 0.79444153561603059,
+  0.79490712632823701, 0.79537224941706119, 0.79583690460888346,
+  0.79630109163035911, 0.79676481020841872, 0.7972280600702687,
+  0.79769084094339104, 0.79815315255554375, 0.79861499463476082,
+  0.79907636690935235, 0.79953726910790501, 0.79999770095928191,
+  0.80045766219262271, 0.8009171525373443, 0.80137617172314013,
+  0.80183471947998131, 0.80229279553811572, 0.80275039962806916,
+  0.80320753148064483, 0.80366419082692409, 0.8041203773982657,
+  0.804576090926307, 0.80503133114296366, 0.80548609778042912,
+  0.80594039057117628, 0.80639420924795624, 0.80684755354379922,
+  0.80730042319201445, 0.80775281792619036, 0.80820473748019472,
+  0.80865618158817498, 0.80910714998455813, 0.80955764240405126,
+  0.81000765858164114, 0.81045719825259477, 0.81090626115245967,
+  0.81135484701706373, 0.81180295558251536, 0.81225058658520388,
+  0.81269773976179949, 0.81314441484925359, 0.81359061158479851,
+  0.8140363297059483, 0.81448156895049861, 0.81492632905652662,
+  0.81537060976239129, 0.81581441080673378, 0.81625773192847739,
+  0.81670057286682785, 0.81714293336127297, 0.81758481315158371,
+  0.81802621197781344, 0.81846712958029866, 0.81890756569965895,
+  0.8193475200767969, 0.81978699245289899, 0.82022598256943469,
+  0.82066449016815746, 0.82110251499110465, 0.82154005678059761,
+  0.82197711527924155, 0.82241369022992639, 0.82284978137582632,
+  0.82328538846040011, 0.82372051122739132, 0.82415514942082857,
+  0.82458930278502529, 0.82502297106458022, 0.82545615400437744,
+  0.82588885134958678, 0.82632106284566342, 0.82675278823834852,
+  0.82718402727366902, 0.8276147796979384, 0.8280450452577558,
+  0.82847482370000713, 0.82890411477186487, 0.82933291822078825,
+  0.82976123379452305, 0.83018906124110237, 0.8306164003088462,
+  0.83104325074636232, 0.83146961230254524, 0.83189548472657759,
+  0.83232086776792968, 0.83274576117635946, 0.83317016470191319,
+  0.83359407809492514, 0.83401750110601813, 0.83444043348610319,
+  0.83486287498638001, 0.83528482535833737, 0.8357062843537526,
+  0.83612725172469216, 0.83654772722351189, 0.83696771060285702,
+  0.83738720161566194, 0.83780620001515094, 0.83822470555483797,
+  0.8386427179885273, 0.83906023707031263, 0.83947726255457855,
+  0.83989379419599941, 0.84030983174954077, 0.84072537497045807,
+  0.84114042361429808, 0.84155497743689833, 0.84196903619438768,
+  0.84238259964318596, 0.84279566754000412, 0.84320823964184544,
+  0.84362031570600404, 0.84403189549006641, 0.84444297875191066,
+  0.84485356524970701, 0.84526365474191822, 0.84567324698729907,
+  0.84608234174489694, 0.84649093877405202, 0.84689903783439735,
+  0.84730663868585832, 0.84771374108865427, 0.84812034480329712,
+  0.84852644959059265, 0.84893205521163961, 0.84933716142783067,
+  0.84974176800085244, 0.85014587469268521, 0.85054948126560337,
+  0.85095258748217573, 0.8513551931052652, 0.85175729789802912,
+  0.85215890162391983, 0.85256000404668397, 0.85296060493036363,
+  0.85336070403929543, 0.8537603011381113, 0.85415939599173873,
+  0.85455798836540053, 0.85495607802461482, 0.85535366473519603,
+  0.85575074826325392, 0.85614732837519447, 0.85654340483771996,
+  0.85693897741782865, 0.85733404588281559, 0.85772861000027212,
+  0.85812266953808602, 0.85851622426444274, 0.8589092739478239,
+  0.85930181835700836, 0.85969385726107261, 0.86008539042939014,
+  0.86047641763163207, 0.86086693863776731, 0.86125695321806206,
+  0.8616464611430813, 0.86203546218368721, 0.8624239561110405,
+  0.86281194269660033, 0.86319942171212416, 0.86358639292966799,
+  0.8639728561215867, 0.86435881106053403, 0.86474425751946238,
+  0.86512919527162369, 0.86551362409056898, 0.86589754375014882,
+  0.86628095402451299, 0.86666385468811102, 0.86704624551569265,
+  0.86742812628230692, 0.86780949676330321, 0.86819035673433131,
+  0.8685707059713409, 0.86895054425058238, 0.86932987134860673,
+  0.86970868704226556, 0.87008699110871135, 0.87046478332539767,
+  0.87084206347007886, 0.8712188313208109, 0.87159508665595109,
+  0.8719708292541577, 0.87234605889439154, 0.8727207753559143,
+  0.87309497841829009, 0.87346866786138488, 0.87384184346536675,
+  0.8742145050107063, 0.87458665227817611, 0.87495828504885154,
+  0.87532940310411078, 0.8757000062256346, 0.8760700941954066,
+  0.87643966679571361, 0.87680872380914576, 0.87717726501859594,
+  0.87754529020726124, 0.87791279915864173, 0.87827979165654146,
+  0.87864626748506813, 0.87901222642863341, 0.87937766827195318,
+  0.87974259280004741, 0.88010699979824036, 0.88047088905216075,
+  0.88083426034774204, 0.88119711347122198, 0.88155944820914378,
+  0.88192126434835494, 0.8822825616760086, 0.88264333997956279,
+  0.88300359904678072, 0.88336333866573158, 0.88372255862478966,
+  0.88408125871263499, 0.8844394387182537, 0.88479709843093779,
+  0.88515423764028511, 0.88551085613619995, 0.88586695370889279,
+  0.88622253014888064, 0.88657758524698704, 0.88693211879434208,
+  0.88728613058238315, 0.88763962040285393, 0.88799258804780556,
+  0.88834503330959624, 0.88869695598089171, 0.88904835585466457,
+  0.88939923272419552, 0.88974958638307289, 0.89009941662519221,
+  0.89044872324475788, 0.89079750603628149, 0.89114576479458318,
+  0.89149349931479138, 0.89184070939234272, 0.89218739482298248,
+  0.89253355540276469, 0.89287919092805168, 0.89322430119551532,
+  0.89356888600213602, 0.89391294514520325, 0.89425647842231604,
+  0.89459948563138258, 0.89494196657062075, 0.89528392103855758,
+  0.89562534883403, 0.89596624975618511, 0.89630662360447966,
+  0.89664647017868015, 0.89698578927886397, 0.89732458070541832,
+  0.89766284425904075, 0.89800057974073988, 0.89833778695183419,
+  0.89867446569395382, 0.89901061576903907, 0.89934623697934146,
+  0.89968132912742393, 0.90001589201616028, 0.9003499254487356,
+  0.90068342922864686, 0.90101640315970233, 0.90134884704602203,
+  0.90168076069203773, 0.90201214390249307, 0.9023429964824442,
+  0.90267331823725883, 0.90300310897261704, 0.90333236849451182,
+  0.90366109660924798, 0.90398929312344334, 0.90431695784402832,
+  0.90464409057824624, 0.90497069113365325, 0.90529675931811882,
+  0.90562229493982516, 0.90594729780726846, 0.90627176772925766,
+  0.90659570451491533, 0.90691910797367803, 0.90724197791529593,
+  0.90756431414983252, 0.90788611648766615, 0.9082073847394887,
+  0.90852811871630612, 0.90884831822943912, 0.90916798309052227,
+  0.90948711311150543, 0.90980570810465222, 0.91012376788254157,
+  0.91044129225806714, 0.91075828104443757, 0.91107473405517625,
+  0.91139065110412232, 0.91170603200542988, 0.91202087657356823,
+  0.91233518462332275, 0.9126489559697939, 0.9129621904283981,
+  0.91327488781486776, 0.91358704794525081, 0.91389867063591168,
+  0.91420975570353069, 0.91452030296510445, 0.91483031223794609,
+  0.91513978333968526, 0.91544871608826783, 0.91575711030195672,
+  0.91606496579933161, 0.91637228239928914, 0.9166790599210427,
+  0.91698529818412289, 0.91729099700837791, 0.91759615621397295,
+  0.91790077562139039, 0.9182048550514309, 0.91850839432521225,
+  0.91881139326416994, 0.91911385169005777, 0.91941576942494696,
+  0.91971714629122736, 0.92001798211160657, 0.92031827670911048,
+  0.92061802990708386, 0.92091724152918952, 0.92121591139940873,
+  0.9215140393420419, 0.92181162518170812, 0.92210866874334507,
+  0.92240516985220988, 0.92270112833387852, 0.92299654401424625,
+  0.92329141671952764, 0.92358574627625656, 0.92387953251128674,
+  0.9241727752517912, 0.9244654743252626, 0.92475762955951391,
+  0.92504924078267758, 0.9253403078232062, 0.92563083050987272,
+  0.92592080867176996, 0.92621024213831127, 0.92649913073923051,
+  0.92678747430458175, 0.9270752726647401, 0.92736252565040111,
+  0.92764923309258118, 0.92793539482261789, 0.92822101067216944,
+  0.92850608047321548, 0.92879060405805702, 0.92907458125931575,
+  0.9293580119099355, 0.92964089584318133, 0.92992323289263956,
+  0.93020502289221907, 0.93048626567614978, 0.93076696107898371,
+  0.93104710893559517, 0.93132670908118043, 0.93160576135125783,
+  0.93188426558166815, 0.93216222160857432, 0.93243962926846236,
+  0.93271648839814025, 0.93299279883473885, 0.93326856041571205,
+  0.93354377297883617, 0.93381843636221096, 0.93409255040425887,
+  0.9343661149437259, 0.93463912981968078, 0.93491159487151609,
+  0.9351835099389475, 0.93545487486201462, 0.93572568948108037,
+  0.9359959536368313, 0.93626566717027826, 0.9365348299227555,
+  0.93680344173592156, 0.93707150245175919, 0.93733901191257496,
+  0.93760596996099999, 0.93787237643998989, 0.93813823119282436,
+  0.93840353406310806, 0.93866828489477017, 0.93893248353206449,
+  0.9391961298195699, 0.93945922360218992, 0.93972176472515334,
+  0.93998375303401394, 0.94024518837465088, 0.9405060705932683,
+  0.94076639953639607, 0.94102617505088926, 0.94128539698392866,
+  0.94154406518302081, 0.94180217949599765, 0.94205973977101731,
+  0.94231674585656378, 0.94257319760144687, 0.94282909485480271,
+  0.94308443746609349, 0.94333922528510772, 0.94359345816196039,
+  0.94384713594709269, 0.94410025849127266, 0.94435282564559475,
+  0.94460483726148026, 0.94485629319067721, 0.94510719328526061,
+  0.94535753739763229, 0.94560732538052128, 0.94585655708698391,
+  0.94610523237040334, 0.94635335108449059, 0.94660091308328353,
+  0.946847918221148, 0.94709436635277722, 0.94734025733319194,
+  0.94758559101774109, 0.94783036726210101, 0.94807458592227623,
+  0.94831824685459909, 0.94856134991573027, 0.94880389496265838,
+  0.94904588185270056, 0.94928731044350201, 0.94952818059303667,
+  0.94976849215960668, 0.950008245001843, 0.95024743897870523,
+  0.9504860739494817, 0.95072414977378961, 0.95096166631157508,
+  0.95119862342311323, 0.95143502096900834, 0.95167085881019386,
+  0.95190613680793223, 0.95214085482381583, 0.95237501271976588,
+  0.95260861035803324, 0.95284164760119872, 0.9530741243121722,
+  0.95330604035419375, 0.95353739559083328, 0.95376818988599033,
+  0.95399842310389449, 0.95422809510910567, 0.95445720576651349,
+  0.95468575494133834, 0.95491374249913052, 0.95514116830577067,
+  0.95536803222747024, 0.95559433413077111, 0.95582007388254542,
+  0.95604525134999641, 0.95626986640065814, 0.95649391890239499,
+  0.95671740872340305, 0.95694033573220894, 0.9571626997976701,
+  0.95738450078897586, 0.95760573857564624, 0.95782641302753291,
+  0.9580465240148186, 0.95826607140801767, 0.9584850550779761,
+  0.9587034748958716, 0.95892133073321306, 0.95913862246184189,
+  0.95935534995393079, 0.95957151308198452, 0.9597871117188399,
+  0.96000214573766585, 0.96021661501196343, 0.96043051941556579,
+  0.96064385882263847, 0.96085663310767966, 0.96106884214551935,
+  0.96128048581132064, 0.961491563980579, 0.96170207652912254,
+  0.9619120233331121, 0.96212140426904158, 0.9623302192137374,
+  0.96253846804435916, 0.96274615063839941, 0.96295326687368388,
+  0.96315981662837136, 0.96336579978095405, 0.96357121621025721,
+  0.96377606579543984, 0.96398034841599411, 0.96418406395174572,
+  0.96438721228285429, 0.96458979328981265, 0.9647918068534479,
+  0.96499325285492032, 0.96519413117572472, 0.9653944416976894,
+  0.96559418430297683, 0.96579335887408357, 0.96599196529384057,
+  0.96619000344541262, 0.96638747321229879, 0.96658437447833312,
+  0.96678070712768327, 0.96697647104485207, 0.96717166611467664,
+  0.96736629222232851, 0.96756034925331436, 0.96775383709347551,
+  0.9679467556289878, 0.96813910474636233, 0.9683308843324453,
+  0.96852209427441727, 0.96871273445979478, 0.96890280477642887,
+  0.9690923051125061, 0.96928123535654853, 0.96946959539741295,
+  0.96965738512429245, 0.96984460442671483, 0.97003125319454397,
+  0.97021733131797916, 0.9704028386875555, 0.97058777519414363,
+  0.97077214072895035, 0.97095593518351797, 0.97113915844972509,
+  0.97132181041978616, 0.97150389098625178, 0.97168540004200854,
+  0.9718663374802794, 0.9720467031946235, 0.97222649707893627,
+  0.97240571902744977, 0.97258436893473221, 0.97276244669568857,
+  0.97293995220556007, 0.97311688535992513, 0.97329324605469825,
+  0.97346903418613095, 0.97364424965081187, 0.9738188923456661,
+  0.97399296216795583, 0.97416645901528032, 0.97433938278557586,
+  0.97451173337711572, 0.97468351068851067, 0.97485471461870843,
+  0.97502534506699412, 0.97519540193299037, 0.97536488511665687,
+  0.97553379451829136, 0.97570213003852857, 0.97586989157834103,
+  0.97603707903903902, 0.97620369232227056, 0.97636973133002114,
+  0.97653519596461447, 0.97670008612871184, 0.97686440172531264,
+  0.97702814265775439, 0.97719130882971228, 0.97735390014519996,
+  0.97751591650856928, 0.97767735782450993, 0.97783822399805043,
+  0.97799851493455714, 0.97815823053973505, 0.97831737071962765,
+  0.97847593538061683, 0.9786339244294231, 0.97879133777310567,
+  0.9789481753190622, 0.97910443697502925, 0.97926012264908202,
+  0.97941523224963478, 0.97956976568544052, 0.97972372286559117,
+  0.97987710369951764, 0.98002990809698998, 0.98018213596811732,
+  0.98033378722334796, 0.98048486177346938, 0.98063535952960812,
+  0.98078528040323043, 0.98093462430614164, 0.98108339115048659,
+  0.98123158084874973, 0.98137919331375456, 0.98152622845866466,
+  0.98167268619698311, 0.9818185664425525, 0.98196386910955524,
+  0.98210859411251361, 0.98225274136628937, 0.98239631078608469,
+  0.98253930228744124, 0.98268171578624086, 0.98282355119870524,
+  0.98296480844139644, 0.98310548743121629, 0.98324558808540707,
+  0.98338511032155118, 0.98352405405757126, 0.98366241921173025,
+  0.98380020570263149, 0.98393741344921892, 0.98407404237077645,
+  0.98421009238692903, 0.9843455634176419, 0.98448045538322093,
+  0.9846147682043126, 0.98474850180190421, 0.9848816560973237,
+  0.98501423101223984, 0.98514622646866223, 0.98527764238894122,
+  0.98540847869576842, 0.98553873531217606, 0.98566841216153755,
+  0.98579750916756737, 0.98592602625432113, 0.98605396334619544,
+  0.98618132036792827, 0.98630809724459867, 0.98643429390162707,
+  0.98655991026477541, 0.98668494626014669, 0.98680940181418542,
+  0.98693327685367771, 0.98705657130575097, 0.98717928509787434,
+  0.98730141815785843, 0.98742297041385541, 0.98754394179435923,
+  0.98766433222820571, 0.98778414164457218, 0.98790336997297779,
+  0.98802201714328353, 0.98814008308569257, 0.98825756773074946,
+  0.98837447100934128, 0.98849079285269659, 0.98860653319238645,
+  0.98872169196032378, 0.98883626908876354, 0.98895026451030299,
+  0.98906367815788154, 0.98917650996478101, 0.98928875986462517,
+  0.98940042779138038, 0.98951151367935519, 0.98962201746320078,
+  0.98973193907791057, 0.98984127845882053, 0.98995003554160899,
+  0.99005821026229712, 0.9901658025572484, 0.99027281236316911,
+  0.99037923961710816, 0.99048508425645698, 0.99059034621895015,
+  0.99069502544266463, 0.99079912186602037, 0.99090263542778001,
+  0.99100556606704937, 0.99110791372327678, 0.99120967833625406,
+  0.99131085984611544, 0.99141145819333854, 0.9915114733187439,
+  0.99161090516349537, 0.99170975366909953, 0.99180801877740643,
+  0.99190570043060933, 0.99200279857124452, 0.9920993131421918,
+  0.99219524408667392, 0.99229059134825737, 0.99238535487085167,
+  0.99247953459870997, 0.99257313047642881, 0.99266614244894802,
+  0.99275857046155114, 0.9928504144598651, 0.99294167438986047,
+  0.99303235019785141, 0.99312244183049558, 0.9932119492347945,
+  0.99330087235809328, 0.99338921114808065, 0.99347696555278919,
+  0.9935641355205953, 0.99365072100021912, 0.9937367219407246,
+  0.99382213829151966, 0.99390697000235606, 0.99399121702332938,
+  0.99407487930487937, 0.99415795679778973, 0.9942404494531879,
+  0.99432235722254581, 0.9944036800576791, 0.9944844179107476,
+  0.99456457073425542, 0.99464413848105071, 0.9947231211043257,
+  0.99480151855761711, 0.99487933079480562, 0.99495655777011638,
+  0.99503319943811863, 0.99510925575372611, 0.99518472667219682,
+  0.99525961214913339, 0.99533391214048228, 0.9954076266025349,
+  0.99548075549192694, 0.99555329876563847, 0.99562525638099431,
+  0.99569662829566352, 0.99576741446765982, 0.99583761485534161,
+  0.99590722941741172, 0.99597625811291779, 0.99604470090125197,
+  0.99611255774215113, 0.99617982859569687, 0.99624651342231552,
+  0.996312612182778, 0.99637812483820021, 0.99644305135004263,
+  0.99650739168011082, 0.99657114579055484, 0.9966343136438699,
+  0.99669689520289606, 0.996758890430818, 0.99682029929116567,
+  0.99688112174781385, 0.99694135776498216, 0.99700100730723529,
+  0.99706007033948296, 0.99711854682697998, 0.99717643673532619,
+  0.99723374003046616, 0.99729045667869021, 0.99734658664663323,
+  0.9974021299012753, 0.99745708640994191, 0.99751145614030345,
+  0.99756523906037575, 0.99761843513851955, 0.997671044343441,
+  0.99772306664419164, 0.99777450201016782, 0.99782535041111164,
+  0.99787561181711015, 0.997925286198596, 0.99797437352634699,
+  0.99802287377148624, 0.99807078690548234, 0.99811811290014918,
+  0.99816485172764624, 0.99821100336047819, 0.99825656777149518,
+  0.99830154493389289, 0.99834593482121237, 0.99838973740734016,
+  0.99843295266650844, 0.99847558057329477, 0.99851762110262221,
+  0.99855907422975931, 0.99859993993032037, 0.99864021818026527,
+  0.99867990895589909, 0.99871901223387294, 0.99875752799118334,
+  0.99879545620517241, 0.99883279685352799, 0.99886954991428356,
+  0.99890571536581829, 0.99894129318685687, 0.99897628335646982,
+  0.99901068585407338, 0.99904450065942929, 0.99907772775264536,
+  0.99911036711417489, 0.99914241872481691, 0.99917388256571638,
+  0.99920475861836389, 0.99923504686459585, 0.99926474728659442,
+  0.99929385986688779, 0.99932238458834954, 0.99935032143419944,
+  0.99937767038800285, 0.9994044314336713, 0.99943060455546173,
+  0.99945618973797734, 0.99948118696616695, 0.99950559622532531,
+  0.99952941750109314, 0.99955265077945699, 0.99957529604674922,
+  0.99959735328964838, 0.99961882249517864, 0.9996397036507102,
+  0.99965999674395922, 0.99967970176298793, 0.99969881869620425,
+  0.99971734753236219, 0.99973528826056168, 0.99975264087024884,
+  0.99976940535121528, 0.99978558169359921, 0.99980116988788426,
+  0.99981616992490041, 0.9998305817958234, 0.99984440549217524,
+  0.99985764100582386, 0.99987028832898295, 0.99988234745421256,
+  0.99989381837441849, 0.9999047010828529, 0.99991499557311347,
+  0.9999247018391445, 0.999933819875236, 0.99994234967602391,
+  0.99995029123649048, 0.9999576445519639, 0.99996440961811828,
+  0.99997058643097414, 0.99997617498689761, 0.99998117528260111,
+  0.9999855873151432, 0.9999894110819284, 0.99999264658070719,
+  0.99999529380957619, 0.99999735276697821, 0.99999882345170188,
+  0.99999970586288223, 1
+};
+
+static const double * const fft_static_sin[6] =
+{
+  fft_static_sin_256,
+  fft_static_sin_512,
+  fft_static_sin_1024,
+  fft_static_sin_2048,
+  fft_static_sin_4096,
+  fft_static_sin_8192
+};
+
+#endif /* RTA_DOUBLE_TYPE */
+
+#endif /* _RTA_FFT_STATIC_TABLES_H_ */
@@ -0,0 +1,329 @@
+/**
+ * @file   rta_istft.c
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 11:02:47 2026
+ *
+ * @brief  Streaming inverse short-time Fourier transform (overlap-add)
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_istft.h"
+#include "rta_fft.h"
+#include "rta_stdlib.h" /* memory management */
+
+/* -------  private (depends on implementation) ------ */
+
+struct rta_istft_setup
+{
+  unsigned int window_size;
+  unsigned int hop_size;
+  unsigned int fft_size;
+  unsigned int frame_size; /**< fft_size / 2 + 1 */
+  unsigned int channels_number;
+  rta_real_t * window;     /**< 'window_size' synthesis weights */
+  rta_real_t * normalisation; /**< 'hop_size' COLA factors */
+  rta_real_t * ring;       /**< 'ring_size' sums per channel */
+  unsigned int ring_size;  /**< max('window_size', 'hop_size') */
+  unsigned int ring_index; /**< next output sample */
+  unsigned int available;  /**< samples to output before the next frame */
+  rta_real_t * buffer;     /**< 'fft_size' reals per channel */
+  rta_real_t * nyquist;    /**< one per channel */
+  rta_real_t scale;
+  rta_fft_setup_t * fft_setup;
+};
+
+/* ------- end of private ---------------------------- */
+
+/* ------- Public functions -------------------------- */
+
+int
+rta_istft_setup_new(rta_istft_setup_t ** istft_setup,
+                    const rta_real_t * analysis_window,
+                    const rta_real_t * synthesis_window,
+                    const unsigned int window_size,
+                    const unsigned int hop_size, const unsigned int fft_size,
+                    const unsigned int channels_number)
+{
+  int ret = 1;
+  *istft_setup = (rta_istft_setup_t *) rta_malloc(sizeof(rta_istft_setup_t));
+
+  if(*istft_setup == NULL || window_size == 0 || hop_size == 0 ||
+     channels_number == 0)
+  {
+    if(*istft_setup != NULL)
+    {
+      rta_free(*istft_setup);
+      *istft_setup = NULL;
+    }
+    ret = 0;
+  }
+  else
+  {
+    (*istft_setup)->window_size = window_size;
+    (*istft_setup)->hop_size = hop_size;
+    (*istft_setup)->fft_size =
+      (fft_size > window_size ? fft_size : window_size);
+    (*istft_setup)->fft_size += (*istft_setup)->fft_size & 1;
+    (*istft_setup)->frame_size = (*istft_setup)->fft_size / 2 + 1;
+    (*istft_setup)->channels_number = channels_number;
+    (*istft_setup)->ring_size =
+      (window_size > hop_size ? window_size : hop_size);
+    (*istft_setup)->scale = 1. / (*istft_setup)->fft_size;
+
+    (*istft_setup)->window = NULL;
+    (*istft_setup)->normalisation = NULL;
+    (*istft_setup)->ring = NULL;
+    (*istft_setup)->buffer = NULL;
+    (*istft_setup)->nyquist = NULL;
+    (*istft_setup)->fft_setup = NULL;
+  }
+
+  if(ret != 0)
+  {
+    (*istft_setup)->window = (rta_real_t *) rta_malloc(
+      window_size * sizeof(rta_real_t));
+    (*istft_setup)->normalisation = (rta_real_t *) rta_malloc(
+      hop_size * sizeof(rta_real_t));
+    (*istft_setup)->ring = (rta_real_t *) rta_malloc(
+      (*istft_setup)->ring_size * channels_number * sizeof(rta_real_t));
+    (*istft_setup)->buffer = (rta_real_t *) rta_malloc(
+      (*istft_setup)->fft_size * channels_number * sizeof(rta_real_t));
+    (*istft_setup)->nyquist = (rta_real_t *) rta_malloc(
+      channels_number * sizeof(rta_real_t));
+
+    if((*istft_setup)->window == NULL ||
+       (*istft_setup)->normalisation == NULL ||
+       (*istft_setup)->ring == NULL || (*istft_setup)->buffer == NULL ||
+       (*istft_setup)->nyquist == NULL)
+    {
+      ret = 0;
+    }
+    else
+    {
+      unsigned int i, j;
+      for(i=0; i<window_size; i++)
+      {
+        (*istft_setup)->window[i] =
+          (synthesis_window != NULL ? synthesis_window[i] : 1.);
+      }
+
+      /* overlap-add of the product of the windows, for each sample */
+      /* position within a hop */
+      for(i=0; i<hop_size; i++)
+      {
+        rta_real_t sum = 0.;
+        for(j=i; j<window_size; j+=hop_size)
+        {
+          sum += (*istft_setup)->window[j] *
+            (analysis_window != NULL ? analysis_window[j] : 1.);
+        }
+        (*istft_setup)->normalisation[i] = (sum != 0. ? 1. / sum : 0.);
+      }
+      
+      rta_istft_reset(*istft_setup);
+    }
+  }
+
+  if(ret != 0)
+  {
+    ret = rta_fft_real_setup_new(&((*istft_setup)->fft_setup),
+                                 rta_fft_complex_to_real_1d,
+                                 &((*istft_setup)->scale),
+                                 (*istft_setup)->buffer,
+                                 (*istft_setup)->fft_size / 2,
+                                 (*istft_setup)->buffer,
+                                 (*istft_setup)->fft_size,
+                                 (*istft_setup)->nyquist);
+    if(ret == 0)
+    {
+      (*istft_setup)->fft_setup = NULL;
+    }
+  }
+
+  if(ret == 0 && *istft_setup != NULL)
+  {
+    rta_istft_setup_delete(*istft_setup);
+    *istft_setup = NULL;
+  }
+
+  return ret;
+}
+
+void
+rta_istft_setup_delete(rta_istft_setup_t * istft_setup)
+{
+  if(istft_setup != NULL)
+  {
+    if(istft_setup->fft_setup != NULL)
+    {
+      rta_fft_setup_delete(istft_setup->fft_setup);
+    }
+
+    if(istft_setup->window != NULL)
+    {
+      rta_free(istft_setup->window);
+    }
+
+    if(istft_setup->normalisation != NULL)
+    {
+      rta_free(istft_setup->normalisation);
+    }
+
+    if(istft_setup->ring != NULL)
+    {
+      rta_free(istft_setup->ring);
+    }
+
+    if(istft_setup->buffer != NULL)
+    {
+      rta_free(istft_setup->buffer);
+    }
+
+    if(istft_setup->nyquist != NULL)
+    {
+      rta_free(istft_setup->nyquist);
+    }
+
+    rta_free(istft_setup);
+  }
+
+  return;
+}
+
+unsigned int
+rta_istft_frame_size(const rta_istft_setup_t * istft_setup)
+{
+  return istft_setup->frame_size;
+}
+
+void
+rta_istft_reset(rta_istft_setup_t * istft_setup)
+{
+  unsigned int i;
+
+  for(i=0; i<istft_setup->ring_size * istft_setup->channels_number; i++)
+  {
+    istft_setup->ring[i] = 0.;
+  }
+  istft_setup->ring_index = 0;
+  istft_setup->available = 0;
+
+  return;
+}
+
+int
+rta_istft_input(rta_istft_setup_t * istft_setup, const rta_complex_t * input)
+{
+  int ret = 0;
+
+  if(istft_setup->available == 0)
+  {
+    const unsigned int frame_size = istft_setup->frame_size;
+    const unsigned int spectrum_size = frame_size - 1;
+    const unsigned int ring_size = istft_setup->ring_size;
+    unsigned int c, i, r;
+
+    for(c=0; c<istft_setup->channels_number; c++)
+    {
+      const rta_complex_t * frame = input + c * frame_size;
+      rta_complex_t * spectrum = (rta_complex_t *)
+        (istft_setup->buffer + c * istft_setup->fft_size);
+
+      for(i=0; i<spectrum_size; i++)
+      {
+        spectrum[i] = frame[i];
+      }
+      istft_setup->nyquist[c] = rta_creal(frame[spectrum_size]);
+    }
+
+    /* scale is applied by the FFT */
+    rta_fft_real_execute_batch(istft_setup->buffer, istft_setup->buffer,
+                               istft_setup->fft_size / 2,
+                               istft_setup->channels_number,
+                               istft_setup->fft_size,
+                               istft_setup->fft_setup, istft_setup->nyquist);
+
+    for(c=0; c<istft_setup->channels_number; c++)
+    {
+      const rta_real_t * signal = istft_setup->buffer + c * istft_setup->fft_size;
+      rta_real_t * ring = istft_setup->ring + c * ring_size;
+
+      for(i=0, r=istft_setup->ring_index; i<istft_setup->window_size; i++)
+      {
+        ring[r] += signal[i] * istft_setup->window[i];
+        if(++r == ring_size)
+        {
+          r = 0;
+        }
+      }
+    }
+
+    istft_setup->available = istft_setup->hop_size;
+    ret = 1;
+  }
+
+  return ret;
+}
+
+unsigned int
+rta_istft_output(rta_istft_setup_t * istft_setup,
+                 rta_real_t * output, const unsigned int output_size)
+{
+  const unsigned int channels_number = istft_setup->channels_number;
+  const unsigned int ring_size = istft_setup->ring_size;
+  const unsigned int n = (output_size < istft_setup->available ?
+                          output_size : istft_setup->available);
+  /* position within the hop of the first output sample */
+  unsigned int h = istft_setup->hop_size - istft_setup->available;
+  unsigned int ring_index = istft_setup->ring_index;
+  unsigned int i, c;
+
+  for(i=0; i<n; i++, h++)
+  {
+    for(c=0; c<channels_number; c++)
+    {
+      rta_real_t * sum = istft_setup->ring + c * ring_size + ring_index;
+      *(output++) = *sum * istft_setup->normalisation[h];
+      *sum = 0.;
+    }
+
+    if(++ring_index == ring_size)
+    {
+      ring_index = 0;
+    }
+  }
+
+  istft_setup->ring_index = ring_index;
+  istft_setup->available -= n;
+
+  return n;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file   rta_istft.h
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 11:02:47 2026
+ * @ingroup rta_signal
+ *
+ * @brief  Streaming inverse short-time Fourier transform (overlap-add)
+ *
+ * Complex frames, as output by rta_stft, are transformed back to real
+ * signal, windowed and overlap-added into a ring buffer, from which
+ * any number of samples can be pulled. Nothing is allocated after the
+ * setup.
+ *
+ * A typical audio callback is:
+ *
+ * \code
+ * while(output_size > 0)
+ * {
+ *   unsigned int n = rta_istft_output(istft_setup, output, output_size);
+ *   output += n * channels_number;
+ *   output_size -= n;
+ *
+ *   if(output_size > 0)
+ *   {
+ *     ... compute the next frames ...
+ *     rta_istft_input(istft_setup, frames);
+ *   }
+ * }
+ * \endcode
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_ISTFT_H_
+#define _RTA_ISTFT_H_ 1
+
+#include "rta.h"
+#include "rta_complex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* rta_istft_setup is private (depends on implementation) */
+typedef struct rta_istft_setup rta_istft_setup_t;
+
+/**
+ * Allocate and initialize a streaming inverse STFT setup.
+ *
+ * The output is normalised by the overlap-add of the product of the
+ * analysis and synthesis windows, at the hop size, so that the
+ * overlap-add of unmodified frames gives back the analysed signal,
+ * after the first 'window_size' - 'hop_size' samples. This constant
+ * overlap-add (COLA) normalisation is computed for each sample within
+ * a hop, so it is correct for any windows and hop size, as long as the
+ * windows cover every sample.
+ *
+ * \see rta_istft_setup_delete
+ * \see rta_istft_input
+ * \see rta_istft_output
+ * \see rta_stft_setup_new
+ *
+ * @param istft_setup is an address of a pointer to a private structure,
+ * which is allocated and filled by this function.
+ * @param analysis_window is an array of 'window_size' weights used by
+ * the analysis, or NULL for a rectangular window. It is only used for
+ * the normalisation.
+ * @param synthesis_window is an array of 'window_size' weights, which
+ * is copied, or NULL for a rectangular window.
+ * \see rta_window_hann_weights
+ * @param window_size is the number of output samples of a frame
+ * @param hop_size is the number of output samples between two frames
+ * @param fft_size is the transform size. It is rounded up to an even
+ * size, and to 'window_size'. The samples of the inverse transform
+ * after 'window_size' are dropped.
+ * @param channels_number is the number of interleaved output channels
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'istft_setup' (even a delete).
+ */
+int
+rta_istft_setup_new(rta_istft_setup_t ** istft_setup,
+                    const rta_real_t * analysis_window,
+                    const rta_real_t * synthesis_window,
+                    const unsigned int window_size,
+                    const unsigned int hop_size, const unsigned int fft_size,
+                    const unsigned int channels_number);
+
+/**
+ * Deallocate any (sucessfully) allocated inverse STFT setup.
+ *
+ * \see rta_istft_setup_new
+ *
+ * @param istft_setup is a pointer to the memory wich will be released.
+ */
+void
+rta_istft_setup_delete(rta_istft_setup_t * istft_setup);
+
+/**
+ * Number of bins of an input frame, for each channel.
+ *
+ * @param istft_setup is a previously allocated setup
+ *
+ * @return 'fft_size' / 2 + 1, 'fft_size' being the actual one.
+ */
+unsigned int
+rta_istft_frame_size(const rta_istft_setup_t * istft_setup);
+
+/**
+ * Forget any frame and output sample.
+ *
+ * @param istft_setup is a previously allocated setup
+ */
+void
+rta_istft_reset(rta_istft_setup_t * istft_setup);
+
+/**
+ * Overlap-add a frame, if the samples of the previous one are all
+ * output.
+ *
+ * \see rta_istft_output
+ *
+ * @param istft_setup is a previously allocated setup
+ * @param input is an array of 'channels_number' *
+ * rta_istft_frame_size(istft_setup) complex values, from 0 to the
+ * Nyquist frequency. The frame of each channel is contiguous. It is
+ * not modified.
+ *
+ * @return 1 if the frame was added, 0 if 'hop_size' samples must be
+ * output first.
+ */
+int
+rta_istft_input(rta_istft_setup_t * istft_setup, const rta_complex_t * input);
+
+/**
+ * Pull output samples, up to the next frame to input.
+ *
+ * \see rta_istft_input
+ *
+ * @param istft_setup is a previously allocated setup
+ * @param output is an array of 'output_size' * 'channels_number'
+ * samples, with interleaved channels.
+ * @param output_size is the number of requested samples per channel
+ *
+ * @return the number of samples per channel actually output, which
+ * may be less than 'output_size'. When it is, a new frame must be
+ * input before any other sample is output.
+ */
+unsigned int
+rta_istft_output(rta_istft_setup_t * istft_setup,
+                 rta_real_t * output, const unsigned int output_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_ISTFT_H_ */
@@ -0,0 +1,434 @@
+/**
+ * @file   rta_mfcc.c
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 18:20:31 2026
+ *
+ * @brief  Mel-frequency cepstral coefficients
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_mfcc.h"
+#include "rta_fft.h"
+#include "rta_window.h" /* rta_window_hamming_weights */
+#include "rta_int.h" /* rta_inextpow2 */
+#include "rta_float.h" /* RTA_REAL_MIN */
+#include "rta_stdlib.h" /* memory management */
+#include "rta_math.h" /* rta_log, rta_sqrt */
+
+/** alignment of the buffers of the workspace, in bytes */
+#define MFCC_ALIGNMENT 64
+
+/* -------  private (depends on implementation) ------ */
+
+struct rta_mfcc_setup
+{
+  unsigned int frame_size;
+  unsigned int fft_size;
+  unsigned int spectrum_size;  /**< fft_size / 2 + 1 */
+  unsigned int bands_number;
+  unsigned int cepstrum_order;
+  rta_real_t preemphasis_factor;
+  rta_integration_t integration;
+  rta_real_t * window;         /**< frame_size */
+  rta_real_t * windowed;       /**< frame_size, input of the FFT */
+  rta_real_t * spectrum_real;  /**< fft_size / 2 */
+  rta_real_t * spectrum_imag;  /**< fft_size / 2 */
+  rta_real_t * bands;          /**< bands_number, log of the bands */
+  rta_real_t * bands_weights;  /**< non-zero weights, band after band */
+  unsigned int * bands_bounds; /**< first and end bins, by band */
+  unsigned int * bands_offsets; /**< first weight of each band */
+  rta_real_t * dct_weights;    /**< liftered, cepstrum_order * bands_number */
+  rta_real_t nyquist;
+  rta_real_t scale;
+  rta_fft_setup_t * fft_setup;
+  void * workspace;            /**< allocated block of all the buffers */
+};
+
+/* size rounded to the alignment */
+static size_t
+mfcc_aligned_size(const size_t size)
+{
+  return (size + MFCC_ALIGNMENT - 1) & ~((size_t) MFCC_ALIGNMENT - 1);
+}
+
+/* one frame, from its first sample */
+static void
+mfcc_frame(rta_real_t * mfcc, const rta_real_t * frame,
+           const rta_real_t previous_sample, rta_mfcc_setup_t * mfcc_setup)
+{
+  const rta_real_t factor = mfcc_setup->preemphasis_factor;
+  const rta_real_t * window = mfcc_setup->window;
+  const rta_real_t * spectrum_real = mfcc_setup->spectrum_real;
+  const rta_real_t * spectrum_imag = mfcc_setup->spectrum_imag;
+  const unsigned int nyquist_bin = mfcc_setup->spectrum_size - 1;
+  rta_real_t * windowed = mfcc_setup->windowed;
+  rta_real_t * bands = mfcc_setup->bands;
+  unsigned int i, j;
+
+  /* preemphasis and window, in one pass */
+  windowed[0] = (frame[0] - factor * previous_sample) * window[0];
+  for(i=1; i<mfcc_setup->frame_size; i++)
+  {
+    windowed[i] = (frame[i] - factor * frame[i-1]) * window[i];
+  }
+
+  rta_fft_split_real_execute(mfcc_setup->spectrum_real,
+                             mfcc_setup->spectrum_imag,
+                             windowed, NULL, mfcc_setup->frame_size,
+                             mfcc_setup->fft_setup, &(mfcc_setup->nyquist));
+
+  /* power of the bins, integration into bands, and log */
+  for(i=0; i<mfcc_setup->bands_number; i++)
+  {
+    const unsigned int first = mfcc_setup->bands_bounds[2*i];
+    const unsigned int end = mfcc_setup->bands_bounds[2*i+1];
+    const unsigned int last = (end < nyquist_bin ? end : nyquist_bin);
+    const rta_real_t * weights =
+      mfcc_setup->bands_weights + mfcc_setup->bands_offsets[i] - first;
+    rta_real_t band = 0.;
+
+    if(mfcc_setup->integration == rta_bands_square_abs_integration)
+    {
+      for(j=first; j<last; j++)
+      {
+        band += weights[j] * rta_sqrt(spectrum_real[j] * spectrum_real[j] +
+                                      spectrum_imag[j] * spectrum_imag[j]);
+      }
+      if(last < end)
+      {
+        band += weights[last] * rta_abs(mfcc_setup->nyquist);
+      }
+      band *= band;
+    }
+    else
+    {
+      for(j=first; j<last; j++)
+      {
+        band += weights[j] * (spectrum_real[j] * spectrum_real[j] +
+                              spectrum_imag[j] * spectrum_imag[j]);
+      }
+      if(last < end)
+      {
+        band += weights[last] * mfcc_setup->nyquist * mfcc_setup->nyquist;
+      }
+    }
+
+    bands[i] = rta_log(band > RTA_REAL_MIN ? band : RTA_REAL_MIN);
+  }
+
+  /* the lifter is in the weights */
+  rta_dct(mfcc, bands, mfcc_setup->dct_weights,
+          mfcc_setup->bands_number, mfcc_setup->cepstrum_order);
+
+  return;
+}
+
+/* ------- end of private ---------------------------- */
+
+/* ------- Public functions -------------------------- */
+
+int
+rta_mfcc_setup_new(rta_mfcc_setup_t ** mfcc_setup,
+                   const unsigned int frame_size,
+                   const unsigned int fft_size,
+                   const rta_real_t sample_rate,
+                   const rta_real_t preemphasis_factor,
+                   const rta_real_t * window,
+                   const unsigned int bands_number,
+                   const rta_real_t min_freq, const rta_real_t max_freq,
+                   const rta_mel_t mel_type,
+                   const rta_integration_t integration,
+                   const unsigned int cepstrum_order,
+                   const rta_dct_t dct_type,
+                   const rta_real_t liftering_factor,
+                   const rta_lifter_t lifter_type)
+{
+  int ret = 1;
+  const unsigned int size = (fft_size > 0 ? fft_size :
+                             rta_inextpow2(frame_size > 2 ? frame_size : 2));
+  const unsigned int spectrum_size = size / 2 + 1;
+  rta_real_t * mel_weights = NULL;
+  unsigned int * mel_bounds = NULL;
+  rta_real_t * lifter_weights = NULL;
+  unsigned int weights_number = 0;
+  unsigned int i, j;
+
+  *mfcc_setup = NULL;
+
+  if(frame_size == 0 || size < frame_size || size % 2 != 0 ||
+     bands_number == 0 || cepstrum_order == 0 || sample_rate <= 0.)
+  {
+    ret = 0;
+  }
+
+  /* dense weights, to be packed */
+  if(ret != 0)
+  {
+    mel_weights = (rta_real_t *) rta_malloc(
+      bands_number * spectrum_size * sizeof(rta_real_t));
+    mel_bounds = (unsigned int *) rta_malloc(
+      2 * bands_number * sizeof(unsigned int));
+    lifter_weights = (rta_real_t *) rta_malloc(
+      cepstrum_order * sizeof(rta_real_t));
+
+    ret = (mel_weights != NULL && mel_bounds != NULL &&
+           lifter_weights != NULL);
+  }
+
+  if(ret != 0)
+  {
+    if(mel_type == rta_mel_htk)
+    {
+      ret = rta_spectrum_to_mel_bands_weights(
+        mel_weights, mel_bounds, spectrum_size, sample_rate, bands_number,
+        min_freq, max_freq, 1., rta_hz_to_mel_htk, rta_mel_to_hz_htk,
+        mel_type);
+    }
+    else
+    {
+      ret = rta_spectrum_to_mel_bands_weights(
+        mel_weights, mel_bounds, spectrum_size, sample_rate, bands_number,
+        min_freq, max_freq, 1., rta_hz_to_mel_slaney, rta_mel_to_hz_slaney,
+        mel_type);
+    }
+  }
+
+  if(ret != 0)
+  {
+    ret = rta_lifter_weights(lifter_weights, cepstrum_order,
+                             liftering_factor, lifter_type,
+                             rta_lifter_mode_normal);
+  }
+
+  if(ret != 0)
+  {
+    for(i=0; i<bands_number; i++)
+    {
+      weights_number += mel_bounds[2*i+1] - mel_bounds[2*i];
+    }
+
+    *mfcc_setup = (rta_mfcc_setup_t *) rta_malloc(sizeof(rta_mfcc_setup_t));
+    ret = (*mfcc_setup != NULL);
+  }
+
+  if(ret != 0)
+  {
+    const size_t reals = sizeof(rta_real_t);
+    const size_t window_bytes = mfcc_aligned_size(frame_size * reals);
+    const size_t spectrum_bytes = mfcc_aligned_size(size / 2 * reals);
+    const size_t bands_bytes = mfcc_aligned_size(bands_number * reals);
+    const size_t weights_bytes = mfcc_aligned_size(weights_number * reals);
+    const size_t bounds_bytes =
+      mfcc_aligned_size(2 * bands_number * sizeof(unsigned int));
+    const size_t offsets_bytes =
+      mfcc_aligned_size(bands_number * sizeof(unsigned int));
+    const size_t dct_bytes =
+      mfcc_aligned_size(cepstrum_order * bands_number * reals);
+    char * block;
+
+    (*mfcc_setup)->frame_size = frame_size;
+    (*mfcc_setup)->fft_size = size;
+    (*mfcc_setup)->spectrum_size = spectrum_size;
+    (*mfcc_setup)->bands_number = bands_number;
+    (*mfcc_setup)->cepstrum_order = cepstrum_order;
+    (*mfcc_setup)->preemphasis_factor = preemphasis_factor;
+    (*mfcc_setup)->integration = integration;
+    (*mfcc_setup)->scale = 1.;
+    (*mfcc_setup)->fft_setup = NULL;
+
+    (*mfcc_setup)->workspace = rta_malloc(
+      2 * window_bytes + 2 * spectrum_bytes + bands_bytes + weights_bytes +
+      bounds_bytes + offsets_bytes + dct_bytes + MFCC_ALIGNMENT);
+
+    if((*mfcc_setup)->workspace == NULL)
+    {
+      ret = 0;
+    }
+    else
+    {
+      block = (char *) (*mfcc_setup)->workspace;
+      block += (MFCC_ALIGNMENT - (size_t) block % MFCC_ALIGNMENT)
+        % MFCC_ALIGNMENT;
+
+      (*mfcc_setup)->window = (rta_real_t *) block;
+      block += window_bytes;
+      (*mfcc_setup)->windowed = (rta_real_t *) block;
+      block += window_bytes;
+      (*mfcc_setup)->spectrum_real = (rta_real_t *) block;
+      block += spectrum_bytes;
+      (*mfcc_setup)->spectrum_imag = (rta_real_t *) block;
+      block += spectrum_bytes;
+      (*mfcc_setup)->bands = (rta_real_t *) block;
+      block += bands_bytes;
+      (*mfcc_setup)->bands_weights = (rta_real_t *) block;
+      block += weights_bytes;
+      (*mfcc_setup)->bands_bounds = (unsigned int *) block;
+      block += bounds_bytes;
+      (*mfcc_setup)->bands_offsets = (unsigned int *) block;
+      block += offsets_bytes;
+      (*mfcc_setup)->dct_weights = (rta_real_t *) block;
+    }
+  }
+
+  if(ret != 0)
+  {
+    if(window != NULL)
+    {
+      for(i=0; i<frame_size; i++)
+      {
+        (*mfcc_setup)->window[i] = window[i];
+      }
+    }
+    else
+    {
+      ret = rta_window_hamming_weights((*mfcc_setup)->window, frame_size,
+                                       0.08);
+    }
+  }
+
+  if(ret != 0)
+  {
+    unsigned int offset = 0;
+
+    for(i=0; i<bands_number; i++)
+    {
+      (*mfcc_setup)->bands_bounds[2*i] = mel_bounds[2*i];
+      (*mfcc_setup)->bands_bounds[2*i+1] = mel_bounds[2*i+1];
+      (*mfcc_setup)->bands_offsets[i] = offset;
+      for(j=mel_bounds[2*i]; j<mel_bounds[2*i+1]; j++)
+      {
+        (*mfcc_setup)->bands_weights[offset++] =
+          mel_weights[i*spectrum_size+j];
+      }
+    }
+
+    ret = rta_dct_weights((*mfcc_setup)->dct_weights, bands_number,
+                          cepstrum_order, dct_type);
+  }
+
+  if(ret != 0)
+  {
+    for(i=0; i<cepstrum_order; i++)
+    {
+      for(j=0; j<bands_number; j++)
+      {
+        (*mfcc_setup)->dct_weights[i*bands_number+j] *= lifter_weights[i];
+      }
+    }
+
+    ret = rta_fft_split_setup_new(&((*mfcc_setup)->fft_setup),
+                                  rta_fft_real_to_complex_1d,
+                                  &((*mfcc_setup)->scale),
+                                  frame_size, size,
+                                  &((*mfcc_setup)->nyquist));
+  }
+
+  if(mel_weights != NULL)
+  {
+    rta_free(mel_weights);
+  }
+
+  if(mel_bounds != NULL)
+  {
+    rta_free(mel_bounds);
+  }
+
+  if(lifter_weights != NULL)
+  {
+    rta_free(lifter_weights);
+  }
+
+  if(ret == 0 && *mfcc_setup != NULL)
+  {
+    rta_mfcc_setup_delete(*mfcc_setup);
+    *mfcc_setup = NULL;
+  }
+
+  return ret;
+}
+
+void
+rta_mfcc_setup_delete(rta_mfcc_setup_t * mfcc_setup)
+{
+  if(mfcc_setup != NULL)
+  {
+    if(mfcc_setup->fft_setup != NULL)
+    {
+      rta_fft_setup_delete(mfcc_setup->fft_setup);
+    }
+
+    if(mfcc_setup->workspace != NULL)
+    {
+      rta_free(mfcc_setup->workspace);
+    }
+
+    rta_free(mfcc_setup);
+  }
+  return;
+}
+
+void
+rta_mfcc(rta_real_t * mfcc, const rta_real_t * frame,
+         const rta_real_t previous_sample, rta_mfcc_setup_t * mfcc_setup)
+{
+  mfcc_frame(mfcc, frame, previous_sample, mfcc_setup);
+  return;
+}
+
+void
+rta_mfcc_frames(rta_real_t * mfcc, const rta_real_t * signal,
+                const unsigned int frames_number,
+                const unsigned int hop_size,
+                rta_real_t * previous_sample,
+                rta_mfcc_setup_t * mfcc_setup)
+{
+  unsigned int f;
+
+  if(frames_number > 0)
+  {
+    mfcc_frame(mfcc, signal, *previous_sample, mfcc_setup);
+
+    for(f=1; f<frames_number; f++)
+    {
+      mfcc_frame(mfcc + f * mfcc_setup->cepstrum_order,
+                 signal + f * hop_size,
+                 (hop_size > 0 ? signal[f * hop_size - 1] : *previous_sample),
+                 mfcc_setup);
+    }
+
+    if(hop_size > 0)
+    {
+      *previous_sample = signal[frames_number * hop_size - 1];
+    }
+  }
+  return;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file   rta_mfcc.h
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 18:20:31 2026
+ * @ingroup rta_signal
+ *
+ * @brief  Mel-frequency cepstral coefficients
+ *
+ * MFCC of frames, as computed by the chain of rta_preemphasis_signal,
+ * rta_window_apply, rta_fft_real_execute, rta_spectrum_to_bands_abs
+ * (or rta_spectrum_to_bands_square_abs) of the power spectrum, a log,
+ * rta_dct and rta_lifter_cepstrum, in one setup which owns all the
+ * weights and intermediate buffers.
+ *
+ * Some stages are fused, to avoid writing and reading back full
+ * intermediate buffers:
+ * - the preemphasis and the window are applied in the same pass, to
+ *   the input of the FFT
+ * - the power of each bin is computed in the band integration, from
+ *   the split complex spectrum (see rta_fft_split_execute), and the
+ *   band weights are stored without their zeros
+ * - the liftering is folded into the DCT weights
+ *
+ * No memory is allocated after the setup, whose buffers are aligned
+ * on 64 bytes, in one block.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_MFCC_H_
+#define _RTA_MFCC_H_ 1
+
+#include "rta.h"
+#include "rta_mel.h"
+#include "rta_bands.h"
+#include "rta_dct.h"
+#include "rta_lifter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* rta_mfcc_setup is private (depends on implementation) */
+typedef struct rta_mfcc_setup rta_mfcc_setup_t;
+
+/**
+ * Allocate and initialize a MFCC setup: the window, the mel bands
+ * weights, the DCT and lifter weights, the FFT setup and the
+ * workspace.
+ *
+ * For instance, HTK like MFCC of 25 ms frames at 16 kHz are given by
+ * ret = rta_mfcc_setup_new(&mfcc_setup, 400, 512, 16000., 0.97, NULL,
+ *        26, 0., 8000., rta_mel_htk, rta_bands_abs_integration,
+ *        13, rta_dct_htk, 22., rta_lifter_sinusoidal);
+ *
+ * \see rta_mfcc_setup_delete
+ * \see rta_mfcc
+ * \see rta_spectrum_to_mel_bands_weights
+ * \see rta_dct_weights
+ * \see rta_lifter_weights
+ *
+ * @param mfcc_setup is an address of a pointer to a private structure,
+ * which is allocated and filled by this function.
+ * @param frame_size is the number of samples of a frame
+ * @param fft_size is the size of the FFT, an even number not less than
+ * 'frame_size' (powers of 2 and products of 2, 3 and 5 being the
+ * fastest, see rta_fft_split_setup_new). If it is 0, it is the next
+ * power of 2 of 'frame_size'.
+ * @param sample_rate of the signal, in Hz
+ * @param preemphasis_factor is generally 0.97 for voice analysis, and 0
+ * for no preemphasis (see rta_preemphasis_signal)
+ * @param window is an array of 'frame_size' weights, which is copied.
+ * If it is NULL, the window is a Hamming one (see
+ * rta_window_hamming_weights).
+ * @param bands_number is the number of mel bands
+ * @param min_freq is the frequency of the first band, in Hz
+ * @param max_freq is the frequency of the last band, in Hz
+ * @param mel_type is the mel scale and bands weighting (see
+ * rta_spectrum_to_mel_bands_weights)
+ * @param integration of the power spectrum into bands:
+ * rta_bands_abs_integration is 'weights' * power (as
+ * rta_spectrum_to_bands_abs), and rta_bands_square_abs_integration is
+ * ('weights' * sqrt(power))^2 (as rta_spectrum_to_bands_square_abs)
+ * @param cepstrum_order is the number of output coefficients
+ * @param dct_type (see rta_dct_weights)
+ * @param liftering_factor (see rta_lifter_weights). 0 is neutral for
+ * exponential liftering, and 1 for sinusoidal liftering.
+ * @param lifter_type (see rta_lifter_weights)
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'mfcc_setup' (even a delete).
+ */
+int
+rta_mfcc_setup_new(rta_mfcc_setup_t ** mfcc_setup,
+                   const unsigned int frame_size,
+                   const unsigned int fft_size,
+                   const rta_real_t sample_rate,
+                   const rta_real_t preemphasis_factor,
+                   const rta_real_t * window,
+                   const unsigned int bands_number,
+                   const rta_real_t min_freq, const rta_real_t max_freq,
+                   const rta_mel_t mel_type,
+                   const rta_integration_t integration,
+                   const unsigned int cepstrum_order,
+                   const rta_dct_t dct_type,
+                   const rta_real_t liftering_factor,
+                   const rta_lifter_t lifter_type);
+
+/**
+ * Deallocate any (sucessfully) allocated MFCC setup.
+ *
+ * \see rta_mfcc_setup_new
+ *
+ * @param mfcc_setup is a pointer to the memory wich will be released.
+ */
+void
+rta_mfcc_setup_delete(rta_mfcc_setup_t * mfcc_setup);
+
+/**
+ * MFCC of a frame. The bands are floored at RTA_REAL_MIN before their
+ * log.
+ *
+ * @param mfcc size is 'cepstrum_order'
+ * @param frame size is 'frame_size'
+ * @param previous_sample is the sample before the frame, for the
+ * preemphasis (0 if there is none)
+ * @param mfcc_setup is a previously allocated setup
+ */
+void
+rta_mfcc(rta_real_t * mfcc, const rta_real_t * frame,
+         const rta_real_t previous_sample, rta_mfcc_setup_t * mfcc_setup);
+
+/**
+ * MFCC of the successive frames of a signal.
+ *
+ * \see rta_mfcc
+ *
+ * @param mfcc size is 'frames_number' * 'cepstrum_order', frame after
+ * frame
+ * @param signal size is ('frames_number' - 1) * 'hop_size' +
+ * 'frame_size'. Frame 'f' starts at 'signal'['f' * 'hop_size'].
+ * @param frames_number is the number of frames
+ * @param hop_size is the number of samples between two frames
+ * @param previous_sample is the sample before 'signal' (0 if there is
+ * none). It is updated as
+ * (*'previous_sample') = 'signal'['frames_number' * 'hop_size' - 1],
+ * the sample before the next frame of a stream.
+ * @param mfcc_setup is a previously allocated setup
+ */
+void
+rta_mfcc_frames(rta_real_t * mfcc, const rta_real_t * signal,
+                const unsigned int frames_number,
+                const unsigned int hop_size,
+                rta_real_t * previous_sample,
+                rta_mfcc_setup_t * mfcc_setup);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_MFCC_H_ */
@@ -0,0 +1,645 @@
+/**
+ * @file   rta_sdft.c
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 15:40:12 2026
+ *
+ * @brief  Sliding DFT and Goertzel filter banks
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_sdft.h"
+#include "rta_stdlib.h" /* memory management */
+#include "rta_math.h" /* M_PI, cos, sin, rta_sqrt */
+#include "rta_simd.h" /* rta_simd_level */
+
+/* x86 vector updates, selected according to the CPU */
+#if defined(RTA_SIMD_X86) && \
+  (RTA_REAL_TYPE == RTA_FLOAT_TYPE || RTA_REAL_TYPE == RTA_DOUBLE_TYPE)
+#define RTA_SDFT_SIMD 1
+#include <immintrin.h>
+#endif
+
+/* -------  private (depends on implementation) ------ */
+
+/* bins are padded to the widest vector: 16 floats of AVX-512 */
+#define SDFT_PAD 16
+
+/* 'bins' of 'state' ('padded' values by array): y_re, y_im, m_re, */
+/* m_im, w_re, w_im. Update over 'block_size' differences. */
+typedef void (*sdft_update_function)
+(rta_real_t * state, const unsigned int padded,
+ const rta_real_t * delta, const unsigned int block_size);
+
+/* 'padded' filters of 'weights' (lambda, then sigma) */
+typedef void (*goertzel_function)
+(rta_real_t * power, const rta_real_t * input, const unsigned int input_size,
+ const rta_real_t * weights, const unsigned int padded,
+ const unsigned int frequencies_number);
+
+struct rta_sdft_setup
+{
+  unsigned int window_size;
+  unsigned int bins_number;
+  unsigned int padded;     /**< bins_number rounded up to SDFT_PAD */
+  unsigned int * bins;     /**< 'padded' bins, the padding ones are 0 */
+  rta_real_t * state;      /**< 6 arrays of 'padded' values */
+  rta_real_t * cos;        /**< cos(2 pi i / window_size) */
+  rta_real_t * sin;        /**< sin(2 pi i / window_size) */
+  rta_real_t * ring;       /**< 'window_size' last samples */
+  unsigned int position;   /**< next written sample, and oldest one */
+  unsigned int resync_period;  /**< samples between two bin resyncs */
+  unsigned int resync_samples; /**< since the last bin resync */
+  unsigned int resync_bin;     /**< next bin to resync */
+  rta_real_t delta[RTA_SDFT_BLOCK_SIZE]; /**< x(n) - x(n-N) */
+  sdft_update_function update;
+};
+
+/*
+ * y(k) += m(k) * (x(n) - x(n-N)) and m(k) *= w(k), with
+ * m(k) = exp(-2j pi k n / N) and w(k) = exp(-2j pi k / N)
+ */
+static void
+sdft_update(rta_real_t * state, const unsigned int padded,
+            const rta_real_t * delta, const unsigned int block_size)
+{
+  rta_real_t * y_re = state;
+  rta_real_t * y_im = state + padded;
+  const rta_real_t * m_re = state + 2 * padded;
+  const rta_real_t * m_im = state + 3 * padded;
+  const rta_real_t * w_re = state + 4 * padded;
+  const rta_real_t * w_im = state + 5 * padded;
+  unsigned int b, i;
+
+  for(b=0; b<padded; b++)
+  {
+    rta_real_t yr = y_re[b];
+    rta_real_t yi = y_im[b];
+    rta_real_t mr = m_re[b];
+    rta_real_t mi = m_im[b];
+
+    for(i=0; i<block_size; i++)
+    {
+      const rta_real_t t = mr * w_re[b] - mi * w_im[b];
+      yr += mr * delta[i];
+      yi += mi * delta[i];
+      mi = mr * w_im[b] + mi * w_re[b];
+      mr = t;
+    }
+    y_re[b] = yr;
+    y_im[b] = yi;
+  }
+  return;
+}
+
+/*
+ * Reinsch recursion, with sigma = 1 for cos(w) >= 0, -1 otherwise,
+ * and lambda = 2 cos(w) - 2 sigma:
+ *    d(n) = x(n) + lambda s(n-1) + sigma d(n-1)
+ *    s(n) = sigma s(n-1) + d(n)
+ * d is s(n) - sigma s(n-1), which keeps the precision when s(n) and
+ * s(n-1) are close. Then, |X|^2 = d^2 - lambda s(N-1) s(N-2).
+ */
+static void
+goertzel_scalar(rta_real_t * power,
+                const rta_real_t * input, const unsigned int input_size,
+                const rta_real_t * weights, const unsigned int padded,
+                const unsigned int frequencies_number)
+{
+  unsigned int f, i;
+
+  for(f=0; f<frequencies_number; f++)
+  {
+    const rta_real_t lambda = weights[f];
+    const rta_real_t sigma = weights[padded + f];
+    rta_real_t s = 0.;
+    rta_real_t d = 0.;
+
+    for(i=0; i<input_size; i++)
+    {
+      d = input[i] + lambda * s + sigma * d;
+      s = sigma * s + d;
+    }
+    power[f] = d * d - lambda * s * (sigma * (s - d));
+  }
+  return;
+}
+
+#if defined(RTA_SDFT_SIMD)
+
+/* see sdft_update */
+#define SDFT_SIMD_UPDATE(name, isa, vector_t, width, \
+                         loadu, storeu, set1, add, sub, mul) \
+static void __attribute__((target(isa))) \
+name(rta_real_t * state, const unsigned int padded, \
+     const rta_real_t * delta, const unsigned int block_size) \
+{ \
+  unsigned int b, i; \
+  \
+  for(b=0; b<padded; b+=(width)) \
+  { \
+    vector_t y_re = loadu(state + b); \
+    vector_t y_im = loadu(state + padded + b); \
+    vector_t m_re = loadu(state + 2*padded + b); \
+    vector_t m_im = loadu(state + 3*padded + b); \
+    const vector_t w_re = loadu(state + 4*padded + b); \
+    const vector_t w_im = loadu(state + 5*padded + b); \
+    \
+    for(i=0; i<block_size; i++) \
+    { \
+      const vector_t d = set1(delta[i]); \
+      const vector_t t = sub(mul(m_re, w_re), mul(m_im, w_im)); \
+      y_re = add(y_re, mul(m_re, d)); \
+      y_im = add(y_im, mul(m_im, d)); \
+      m_im = add(mul(m_re, w_im), mul(m_im, w_re)); \
+      m_re = t; \
+    } \
+    storeu(state + b, y_re); \
+    storeu(state + padded + b, y_im); \
+  } \
+  return; \
+}
+
+/* see goertzel_scalar */
+#define GOERTZEL_SIMD(name, isa, vector_t, width, \
+                      loadu, storeu, set1, add, sub, mul) \
+static void __attribute__((target(isa))) \
+name(rta_real_t * power, \
+     const rta_real_t * input, const unsigned int input_size, \
+     const rta_real_t * weights, const unsigned int padded, \
+     const unsigned int frequencies_number) \
+{ \
+  rta_real_t p[width]; \
+  unsigned int f, i, j; \
+  \
+  for(f=0; f<frequencies_number; f+=(width)) \
+  { \
+    const vector_t lambda = loadu(weights + f); \
+    const vector_t sigma = loadu(weights + padded + f); \
+    vector_t s = set1(0.); \
+    vector_t d = set1(0.); \
+    \
+    for(i=0; i<input_size; i++) \
+    { \
+      d = add(add(set1(input[i]), mul(lambda, s)), mul(sigma, d)); \
+      s = add(mul(sigma, s), d); \
+    } \
+    storeu(p, sub(mul(d, d), \
+                  mul(mul(lambda, s), mul(sigma, sub(s, d))))); \
+    for(j=0; j<(width) && f+j<frequencies_number; j++) \
+    { \
+      power[f+j] = p[j]; \
+    } \
+  } \
+  return; \
+}
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE)
+
+SDFT_SIMD_UPDATE(sdft_update_sse2, "sse2", __m128, 4,
+                 _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps,
+                 _mm_add_ps, _mm_sub_ps, _mm_mul_ps)
+SDFT_SIMD_UPDATE(sdft_update_avx2, "avx2", __m256, 8,
+                 _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps,
+                 _mm256_add_ps, _mm256_sub_ps, _mm256_mul_ps)
+SDFT_SIMD_UPDATE(sdft_update_avx512, "avx512f", __m512, 16,
+                 _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps,
+                 _mm512_add_ps, _mm512_sub_ps, _mm512_mul_ps)
+
+GOERTZEL_SIMD(goertzel_sse2, "sse2", __m128, 4,
+              _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps,
+              _mm_add_ps, _mm_sub_ps, _mm_mul_ps)
+GOERTZEL_SIMD(goertzel_avx2, "avx2", __m256, 8,
+              _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps,
+              _mm256_add_ps, _mm256_sub_ps, _mm256_mul_ps)
+GOERTZEL_SIMD(goertzel_avx512, "avx512f", __m512, 16,
+              _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps,
+              _mm512_add_ps, _mm512_sub_ps, _mm512_mul_ps)
+
+#else /* double */
+
+SDFT_SIMD_UPDATE(sdft_update_sse2, "sse2", __m128d, 2,
+                 _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd,
+                 _mm_add_pd, _mm_sub_pd, _mm_mul_pd)
+SDFT_SIMD_UPDATE(sdft_update_avx2, "avx2", __m256d, 4,
+                 _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd,
+                 _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd)
+SDFT_SIMD_UPDATE(sdft_update_avx512, "avx512f", __m512d, 8,
+                 _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd,
+                 _mm512_add_pd, _mm512_sub_pd, _mm512_mul_pd)
+
+GOERTZEL_SIMD(goertzel_sse2, "sse2", __m128d, 2,
+              _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd,
+              _mm_add_pd, _mm_sub_pd, _mm_mul_pd)
+GOERTZEL_SIMD(goertzel_avx2, "avx2", __m256d, 4,
+              _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd,
+              _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd)
+GOERTZEL_SIMD(goertzel_avx512, "avx512f", __m512d, 8,
+              _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd,
+              _mm512_add_pd, _mm512_sub_pd, _mm512_mul_pd)
+
+#endif /* RTA_REAL_TYPE */
+
+#endif /* RTA_SDFT_SIMD */
+
+static sdft_update_function
+sdft_update_select(void)
+{
+  sdft_update_function update = sdft_update;
+#if defined(RTA_SDFT_SIMD)
+  switch(rta_simd_level())
+  {
+    case rta_simd_avx512:
+      update = sdft_update_avx512;
+      break;
+    case rta_simd_avx2:
+      update = sdft_update_avx2;
+      break;
+    case rta_simd_sse2:
+      update = sdft_update_sse2;
+      break;
+    default:
+      break;
+  }
+#endif
+  return update;
+}
+
+static goertzel_function
+goertzel_select(void)
+{
+  goertzel_function goertzel = goertzel_scalar;
+#if defined(RTA_SDFT_SIMD)
+  switch(rta_simd_level())
+  {
+    case rta_simd_avx512:
+      goertzel = goertzel_avx512;
+      break;
+    case rta_simd_avx2:
+      goertzel = goertzel_avx2;
+      break;
+    case rta_simd_sse2:
+      goertzel = goertzel_sse2;
+      break;
+    default:
+      break;
+  }
+#endif
+  return goertzel;
+}
+
+/* exact phasors exp(-2j pi k n / N) at 'position' n */
+static void
+sdft_phasors(rta_sdft_setup_t * sdft_setup)
+{
+  const unsigned int padded = sdft_setup->padded;
+  rta_real_t * m_re = sdft_setup->state + 2 * padded;
+  rta_real_t * m_im = sdft_setup->state + 3 * padded;
+  unsigned int b;
+
+  for(b=0; b<padded; b++)
+  {
+    const unsigned int i = (unsigned int)
+      (((unsigned long long) sdft_setup->bins[b] * sdft_setup->position) %
+       sdft_setup->window_size);
+    m_re[b] = sdft_setup->cos[i];
+    m_im[b] = - sdft_setup->sin[i];
+  }
+  return;
+}
+
+/* exact accumulator of bin 'b': the DFT of the ring, as each sample */
+/* was accumulated with the phasor of its position */
+static void
+sdft_resync(rta_sdft_setup_t * sdft_setup, const unsigned int b)
+{
+  const unsigned int window_size = sdft_setup->window_size;
+  const unsigned int bin = sdft_setup->bins[b];
+  double y_re = 0.;
+  double y_im = 0.;
+  unsigned int p, i;
+
+  for(p=0, i=0; p<window_size; p++)
+  {
+    y_re += sdft_setup->ring[p] * sdft_setup->cos[i];
+    y_im -= sdft_setup->ring[p] * sdft_setup->sin[i];
+    i += bin;
+    if(i >= window_size)
+    {
+      i -= window_size;
+    }
+  }
+
+  sdft_setup->state[b] = y_re;
+  sdft_setup->state[sdft_setup->padded + b] = y_im;
+  return;
+}
+
+/* ------- end of private ---------------------------- */
+
+/* ------- Public functions -------------------------- */
+
+int
+rta_sdft_setup_new(rta_sdft_setup_t ** sdft_setup,
+                   const unsigned int window_size,
+                   const unsigned int * bins, const unsigned int bins_number)
+{
+  int ret = 1;
+  unsigned int i;
+
+  for(i=0; i<bins_number; i++)
+  {
+    if(bins[i] >= window_size)
+    {
+      ret = 0;
+    }
+  }
+
+  *sdft_setup = (rta_sdft_setup_t *) rta_malloc(sizeof(rta_sdft_setup_t));
+
+  if(*sdft_setup == NULL || ret == 0 || window_size == 0 || bins_number == 0)
+  {
+    if(*sdft_setup != NULL)
+    {
+      rta_free(*sdft_setup);
+      *sdft_setup = NULL;
+    }
+    ret = 0;
+  }
+  else
+  {
+    (*sdft_setup)->window_size = window_size;
+    (*sdft_setup)->bins_number = bins_number;
+    (*sdft_setup)->padded =
+      (bins_number + SDFT_PAD - 1) / SDFT_PAD * SDFT_PAD;
+    (*sdft_setup)->update = sdft_update_select();
+    (*sdft_setup)->resync_period = (unsigned int)
+      ((unsigned long long) RTA_SDFT_RESYNC_WINDOWS * window_size
+       / bins_number);
+    (*sdft_setup)->resync_period += ((*sdft_setup)->resync_period == 0);
+
+    (*sdft_setup)->bins = (unsigned int *) rta_malloc(
+      (*sdft_setup)->padded * sizeof(unsigned int));
+    (*sdft_setup)->state = (rta_real_t *) rta_malloc(
+      6 * (*sdft_setup)->padded * sizeof(rta_real_t));
+    (*sdft_setup)->cos = (rta_real_t *) rta_malloc(
+      2 * window_size * sizeof(rta_real_t));
+    (*sdft_setup)->ring = (rta_real_t *) rta_malloc(
+      window_size * sizeof(rta_real_t));
+
+    if((*sdft_setup)->bins == NULL || (*sdft_setup)->state == NULL ||
+       (*sdft_setup)->cos == NULL || (*sdft_setup)->ring == NULL)
+    {
+      rta_sdft_setup_delete(*sdft_setup);
+      *sdft_setup = NULL;
+      ret = 0;
+    }
+  }
+
+  if(ret != 0)
+  {
+    const unsigned int padded = (*sdft_setup)->padded;
+    rta_real_t * w_re = (*sdft_setup)->state + 4 * padded;
+    rta_real_t * w_im = (*sdft_setup)->state + 5 * padded;
+
+    /* in double precision, as the phasors are rounded once */
+    (*sdft_setup)->sin = (*sdft_setup)->cos + window_size;
+    for(i=0; i<window_size; i++)
+    {
+      (*sdft_setup)->cos[i] = cos(2. * M_PI * i / window_size);
+      (*sdft_setup)->sin[i] = sin(2. * M_PI * i / window_size);
+    }
+
+    for(i=0; i<padded; i++)
+    {
+      (*sdft_setup)->bins[i] = (i < bins_number ? bins[i] : 0);
+      w_re[i] = (*sdft_setup)->cos[(*sdft_setup)->bins[i]];
+      w_im[i] = - (*sdft_setup)->sin[(*sdft_setup)->bins[i]];
+    }
+
+    rta_sdft_reset(*sdft_setup);
+  }
+
+  return ret;
+}
+
+void
+rta_sdft_setup_delete(rta_sdft_setup_t * sdft_setup)
+{
+  if(sdft_setup != NULL)
+  {
+    if(sdft_setup->bins != NULL)
+    {
+      rta_free(sdft_setup->bins);
+    }
+
+    if(sdft_setup->state != NULL)
+    {
+      rta_free(sdft_setup->state);
+    }
+
+    if(sdft_setup->cos != NULL)
+    {
+      rta_free(sdft_setup->cos);
+    }
+
+    if(sdft_setup->ring != NULL)
+    {
+      rta_free(sdft_setup->ring);
+    }
+
+    rta_free(sdft_setup);
+  }
+  return;
+}
+
+void
+rta_sdft_reset(rta_sdft_setup_t * sdft_setup)
+{
+  unsigned int i;
+
+  for(i=0; i<2*sdft_setup->padded; i++)
+  {
+    sdft_setup->state[i] = 0.;
+  }
+
+  for(i=0; i<sdft_setup->window_size; i++)
+  {
+    sdft_setup->ring[i] = 0.;
+  }
+
+  sdft_setup->position = 0;
+  sdft_setup->resync_samples = 0;
+  sdft_setup->resync_bin = 0;
+  return;
+}
+
+void
+rta_sdft_input(rta_sdft_setup_t * sdft_setup,
+               const rta_real_t * input, const unsigned int input_size)
+{
+  const unsigned int window_size = sdft_setup->window_size;
+  unsigned int done = 0;
+
+  while(done < input_size)
+  {
+    const unsigned int block_size =
+      (input_size - done < RTA_SDFT_BLOCK_SIZE ?
+       input_size - done : RTA_SDFT_BLOCK_SIZE);
+    unsigned int position = sdft_setup->position;
+    unsigned int i;
+
+    sdft_phasors(sdft_setup);
+
+    for(i=0; i<block_size; i++)
+    {
+      sdft_setup->delta[i] = input[done + i] - sdft_setup->ring[position];
+      sdft_setup->ring[position] = input[done + i];
+      position = (position + 1 < window_size ? position + 1 : 0);
+    }
+
+    sdft_setup->update(sdft_setup->state, sdft_setup->padded,
+                       sdft_setup->delta, block_size);
+
+    sdft_setup->position = position;
+    done += block_size;
+
+    /* recompute the bins in turn, amortised over the blocks */
+    sdft_setup->resync_samples += block_size;
+    while(sdft_setup->resync_samples >= sdft_setup->resync_period)
+    {
+      sdft_resync(sdft_setup, sdft_setup->resync_bin);
+      sdft_setup->resync_bin = (sdft_setup->resync_bin + 1 <
+                                sdft_setup->bins_number ?
+                                sdft_setup->resync_bin + 1 : 0);
+      sdft_setup->resync_samples -= sdft_setup->resync_period;
+    }
+  }
+  return;
+}
+
+/* X(k) = exp(2j pi k (n+1) / N) y(k), with the oldest sample first */
+void
+rta_sdft_output(const rta_sdft_setup_t * sdft_setup, rta_complex_t * output)
+{
+  const rta_real_t * y_re = sdft_setup->state;
+  const rta_real_t * y_im = sdft_setup->state + sdft_setup->padded;
+  unsigned int b;
+
+  for(b=0; b<sdft_setup->bins_number; b++)
+  {
+    const unsigned int i = (unsigned int)
+      (((unsigned long long) sdft_setup->bins[b] * sdft_setup->position) %
+       sdft_setup->window_size);
+    const rta_real_t c = sdft_setup->cos[i];
+    const rta_real_t s = sdft_setup->sin[i];
+
+    output[b] = rta_make_complex(y_re[b] * c - y_im[b] * s,
+                                 y_re[b] * s + y_im[b] * c);
+  }
+  return;
+}
+
+void
+rta_sdft_output_magnitude(const rta_sdft_setup_t * sdft_setup,
+                          rta_real_t * magnitude)
+{
+  const rta_real_t * y_re = sdft_setup->state;
+  const rta_real_t * y_im = sdft_setup->state + sdft_setup->padded;
+  unsigned int b;
+
+  for(b=0; b<sdft_setup->bins_number; b++)
+  {
+    magnitude[b] = rta_sqrt(y_re[b] * y_re[b] + y_im[b] * y_im[b]);
+  }
+  return;
+}
+
+void
+rta_goertzel_weights(rta_real_t * weights, const rta_real_t * frequencies,
+                     const unsigned int frequencies_number)
+{
+  unsigned int f;
+
+  for(f=0; f<frequencies_number; f++)
+  {
+    const double half_angle = M_PI * frequencies[f];
+
+    /* lambda = 2 cos(w) - 2 sigma, without cancellation */
+    if(frequencies[f] <= 0.25)
+    {
+      const double s = sin(half_angle);
+      weights[f] = -4. * s * s;
+      weights[frequencies_number + f] = 1.;
+    }
+    else
+    {
+      const double c = cos(half_angle);
+      weights[f] = 4. * c * c;
+      weights[frequencies_number + f] = -1.;
+    }
+  }
+  return;
+}
+
+void
+rta_goertzel_power(rta_real_t * power,
+                   const rta_real_t * input, const unsigned int input_size,
+                   const rta_real_t * weights,
+                   const unsigned int frequencies_number)
+{
+  goertzel_function goertzel = goertzel_select();
+  rta_real_t padded_weights[2 * SDFT_PAD];
+  unsigned int f, i;
+
+  /* full vectors, then the last ones from padded weights */
+  const unsigned int full = frequencies_number / SDFT_PAD * SDFT_PAD;
+
+  if(full > 0)
+  {
+    goertzel(power, input, input_size, weights, frequencies_number, full);
+  }
+
+  if(full < frequencies_number)
+  {
+    for(i=0; i<SDFT_PAD; i++)
+    {
+      f = full + i;
+      padded_weights[i] = (f < frequencies_number ? weights[f] : 0.);
+      padded_weights[SDFT_PAD + i] =
+        (f < frequencies_number ? weights[frequencies_number + f] : 1.);
+    }
+
+    goertzel(power + full, input, input_size, padded_weights, SDFT_PAD,
+             frequencies_number - full);
+  }
+  return;
+}
@@ -0,0 +1,213 @@
+/**
+ * @file   rta_sdft.h
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 15:40:12 2026
+ * @ingroup rta_signal
+ *
+ * @brief  Sliding DFT and Goertzel filter banks
+ *
+ * A few bins of the spectrum, updated at every sample, or over a
+ * block of samples, for less than a full FFT when only 5 to 50 bins
+ * are needed (tone detection, partial tracking).
+ *
+ * The sliding DFT is the modulated one: each bin accumulates the
+ * input difference x(n) - x(n-N) times a phasor, which is read from a
+ * table at the beginning of every block of samples (see
+ * RTA_SDFT_BLOCK_SIZE). There is no pole on the unit circle, and the
+ * rounding errors do not grow exponentially.
+ *
+ * The Goertzel filters use the Reinsch recursion, which is accurate
+ * for the frequencies close to 0 and to the Nyquist frequency.
+ *
+ * The bins are computed by vectors (see rta_simd.h).
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_SDFT_H_
+#define _RTA_SDFT_H_ 1
+
+#include "rta.h"
+#include "rta_complex.h"
+
+/** number of samples of the blocks of rta_sdft_input, over which the
+ * phasors are updated by recursion */
+#ifndef RTA_SDFT_BLOCK_SIZE
+#define RTA_SDFT_BLOCK_SIZE 64
+#endif
+
+/** number of windows over which every bin accumulator is recomputed
+ * exactly from the samples of the window, see rta_sdft_input */
+#ifndef RTA_SDFT_RESYNC_WINDOWS
+#define RTA_SDFT_RESYNC_WINDOWS 16
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* rta_sdft_setup is private (depends on implementation) */
+typedef struct rta_sdft_setup rta_sdft_setup_t;
+
+/**
+ * Allocate and initialize a sliding DFT setup.
+ *
+ * The bins are those of a DFT of 'window_size' points: bin k is at
+ * the frequency k * sample_rate / 'window_size'. After each input
+ * sample, they are the DFT of the last 'window_size' samples (with a
+ * rectangular window, the oldest sample first), as computed by
+ * rta_fft_real_execute.
+ *
+ * \see rta_sdft_setup_delete
+ * \see rta_sdft_input
+ * \see rta_sdft_output
+ *
+ * @param sdft_setup is an address of a pointer to a private structure,
+ * which is allocated and filled by this function.
+ * @param window_size is the number of samples of the DFT
+ * @param bins is an array of 'bins_number' bin indexes, each one lower
+ * than 'window_size'. It is copied.
+ * @param bins_number is the number of bins to update
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'sdft_setup' (even a delete).
+ */
+int
+rta_sdft_setup_new(rta_sdft_setup_t ** sdft_setup,
+                   const unsigned int window_size,
+                   const unsigned int * bins, const unsigned int bins_number);
+
+/**
+ * Deallocate any (sucessfully) allocated sliding DFT setup.
+ *
+ * \see rta_sdft_setup_new
+ *
+ * @param sdft_setup is a pointer to the memory wich will be released.
+ */
+void
+rta_sdft_setup_delete(rta_sdft_setup_t * sdft_setup);
+
+/**
+ * Forget any input sample: the window is filled with zeros.
+ *
+ * @param sdft_setup is a previously allocated setup
+ */
+void
+rta_sdft_reset(rta_sdft_setup_t * sdft_setup);
+
+/**
+ * Slide the DFT by 'input_size' samples. The samples are processed by
+ * blocks of RTA_SDFT_BLOCK_SIZE, and each vector of bins is updated
+ * over a block, in registers.
+ *
+ * The rounding errors of the updates accumulate, so the bins are
+ * recomputed exactly from the samples of the window, in turn: one bin
+ * every RTA_SDFT_RESYNC_WINDOWS * 'window_size' / 'bins_number'
+ * samples, which costs 1 / RTA_SDFT_RESYNC_WINDOWS of the updates. The
+ * error of a bin is thus bounded by the one of the updates of
+ * RTA_SDFT_RESYNC_WINDOWS + 1 windows, whatever the number of input
+ * samples: at most (RTA_SDFT_RESYNC_WINDOWS + 1) * 'window_size' *
+ * RTA_REAL_EPSILON times the largest magnitude of the bins, and
+ * typically the square root of this number of updates instead. For
+ * example, in single precision and with an input within [-1, 1], the
+ * error stays about 1e-5 for a window of 64 samples and 4e-4 for a
+ * window of 4096 samples.
+ *
+ * @param sdft_setup is a previously allocated setup
+ * @param input is an array of 'input_size' samples
+ * @param input_size is the number of samples, of any size
+ */
+void
+rta_sdft_input(rta_sdft_setup_t * sdft_setup,
+               const rta_real_t * input, const unsigned int input_size);
+
+/**
+ * Output the current bins.
+ *
+ * @param sdft_setup is a previously allocated setup
+ * @param output is an array of 'bins_number' values, in the order of
+ * 'bins' given to rta_sdft_setup_new.
+ */
+void
+rta_sdft_output(const rta_sdft_setup_t * sdft_setup, rta_complex_t * output);
+
+/**
+ * Output the magnitudes of the current bins.
+ *
+ * \see rta_sdft_output
+ *
+ * @param sdft_setup is a previously allocated setup
+ * @param magnitude is an array of 'bins_number' values, in the order
+ * of 'bins' given to rta_sdft_setup_new.
+ */
+void
+rta_sdft_output_magnitude(const rta_sdft_setup_t * sdft_setup,
+                          rta_real_t * magnitude);
+
+/**
+ * Generate the weights of a bank of Goertzel filters, for
+ * rta_goertzel_power.
+ *
+ * @param weights size is 2 * 'frequencies_number'
+ * @param frequencies is an array of 'frequencies_number' normalised
+ * frequencies, in cycles per sample: a frequency in Hz divided by the
+ * sample rate, from 0 to 0.5
+ * @param frequencies_number is the number of filters
+ */
+void
+rta_goertzel_weights(rta_real_t * weights, const rta_real_t * frequencies,
+                     const unsigned int frequencies_number);
+
+/**
+ * Power of a block of samples at a few frequencies, by a bank of
+ * Goertzel filters (Reinsch recursion). This is the squared magnitude
+ * of the DFT of 'input' at these frequencies, which do not need to be
+ * bins of a DFT of 'input_size' points.
+ *
+ * \f$P(f) = \left|\sum_{n=0}^{N-1} x(n) e^{-2j\pi f n}\right|^2\f$
+ *
+ * @param power is an array of 'frequencies_number' values
+ * @param input is an array of 'input_size' samples
+ * @param input_size is the number of samples of the block
+ * @param weights are generated by rta_goertzel_weights
+ * @param frequencies_number is the number of filters
+ */
+void
+rta_goertzel_power(rta_real_t * power,
+                   const rta_real_t * input, const unsigned int input_size,
+                   const rta_real_t * weights,
+                   const unsigned int frequencies_number);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_SDFT_H_ */
@@ -0,0 +1,332 @@
+/**
+ * @file   rta_stft.c
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 10:12:31 2026
+ *
+ * @brief  Streaming short-time Fourier transform analysis
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_stft.h"
+#include "rta_fft.h"
+#include "rta_stdlib.h" /* memory management */
+#include "rta_math.h" /* rta_sqrt, rta_abs */
+
+/* -------  private (depends on implementation) ------ */
+
+struct rta_stft_setup
+{
+  rta_stft_t stft_type;
+  unsigned int window_size;
+  unsigned int hop_size;
+  unsigned int fft_size;
+  unsigned int frame_size; /**< fft_size / 2 + 1 */
+  unsigned int channels_number;
+  rta_real_t * window;     /**< 'window_size' weights */
+  rta_real_t * ring;       /**< 'window_size' samples per channel */
+  unsigned int ring_index; /**< next written sample, and oldest one */
+  unsigned int needed;     /**< samples to input before the next frame */
+  rta_real_t * buffer;     /**< transforms, for magnitude frames */
+  rta_real_t * nyquist;    /**< one per channel */
+  rta_real_t scale;
+  rta_fft_setup_t * fft_setup;
+};
+
+/* windowed ring of a channel, from the oldest sample, into 'output' */
+static void
+window_ring(rta_real_t * output, const rta_real_t * ring,
+            const unsigned int ring_index,
+            const rta_real_t * window, const unsigned int window_size)
+{
+  const unsigned int first_size = window_size - ring_index;
+  unsigned int i;
+
+  for(i=0; i<first_size; i++)
+  {
+    output[i] = ring[ring_index + i] * window[i];
+  }
+
+  for(i=0; i<ring_index; i++)
+  {
+    output[first_size + i] = ring[i] * window[first_size + i];
+  }
+  return;
+}
+
+/* ------- end of private ---------------------------- */
+
+/* ------- Public functions -------------------------- */
+
+int
+rta_stft_setup_new(rta_stft_setup_t ** stft_setup, const rta_stft_t stft_type,
+                   const rta_real_t * window, const unsigned int window_size,
+                   const unsigned int hop_size, const unsigned int fft_size,
+                   const unsigned int channels_number)
+{
+  int ret = 1;
+  *stft_setup = (rta_stft_setup_t *) rta_malloc(sizeof(rta_stft_setup_t));
+
+  if(*stft_setup == NULL || window_size == 0 || hop_size == 0 ||
+     channels_number == 0)
+  {
+    if(*stft_setup != NULL)
+    {
+      rta_free(*stft_setup);
+      *stft_setup = NULL;
+    }
+    ret = 0;
+  }
+  else
+  {
+    (*stft_setup)->stft_type = stft_type;
+    (*stft_setup)->window_size = window_size;
+    (*stft_setup)->hop_size = hop_size;
+    (*stft_setup)->fft_size = (fft_size > window_size ? fft_size : window_size);
+    (*stft_setup)->fft_size += (*stft_setup)->fft_size & 1;
+    (*stft_setup)->frame_size = (*stft_setup)->fft_size / 2 + 1;
+    (*stft_setup)->channels_number = channels_number;
+    (*stft_setup)->scale = 1.;
+
+    (*stft_setup)->window = NULL;
+    (*stft_setup)->ring = NULL;
+    (*stft_setup)->buffer = NULL;
+    (*stft_setup)->nyquist = NULL;
+    (*stft_setup)->fft_setup = NULL;
+  }
+
+  if(ret != 0)
+  {
+    (*stft_setup)->window = (rta_real_t *) rta_malloc(
+      window_size * sizeof(rta_real_t));
+    (*stft_setup)->ring = (rta_real_t *) rta_malloc(
+      window_size * channels_number * sizeof(rta_real_t));
+    (*stft_setup)->nyquist = (rta_real_t *) rta_malloc(
+      channels_number * sizeof(rta_real_t));
+
+    if((*stft_setup)->window == NULL || (*stft_setup)->ring == NULL ||
+       (*stft_setup)->nyquist == NULL)
+    {
+      ret = 0;
+    }
+    else
+    {
+      unsigned int i;
+      for(i=0; i<window_size; i++)
+      {
+        (*stft_setup)->window[i] = (window != NULL ? window[i] : 1.);
+      }
+      rta_stft_reset(*stft_setup);
+    }
+  }
+
+  /* transform buffer of 'frame_size' complex values per channel */
+  if(ret != 0 && stft_type == rta_stft_magnitude)
+  {
+    (*stft_setup)->buffer = (rta_real_t *) rta_malloc(
+      2 * (*stft_setup)->frame_size * channels_number * sizeof(rta_real_t));
+    if((*stft_setup)->buffer == NULL)
+    {
+      ret = 0;
+    }
+  }
+
+  if(ret != 0)
+  {
+    /* in place, the output frame is used as the buffer of the */
+    /* complex frames */
+    ret = rta_fft_real_setup_new(&((*stft_setup)->fft_setup),
+                                 rta_fft_real_to_complex_1d,
+                                 &((*stft_setup)->scale),
+                                 (*stft_setup)->buffer, window_size,
+                                 (*stft_setup)->buffer,
+                                 (*stft_setup)->fft_size,
+                                 (*stft_setup)->nyquist);
+    if(ret == 0)
+    {
+      (*stft_setup)->fft_setup = NULL;
+    }
+  }
+
+  if(ret == 0 && *stft_setup != NULL)
+  {
+    rta_stft_setup_delete(*stft_setup);
+    *stft_setup = NULL;
+  }
+
+  return ret;
+}
+
+void
+rta_stft_setup_delete(rta_stft_setup_t * stft_setup)
+{
+  if(stft_setup != NULL)
+  {
+    if(stft_setup->fft_setup != NULL)
+    {
+      rta_fft_setup_delete(stft_setup->fft_setup);
+    }
+
+    if(stft_setup->window != NULL)
+    {
+      rta_free(stft_setup->window);
+    }
+
+    if(stft_setup->ring != NULL)
+    {
+      rta_free(stft_setup->ring);
+    }
+
+    if(stft_setup->buffer != NULL)
+    {
+      rta_free(stft_setup->buffer);
+    }
+
+    if(stft_setup->nyquist != NULL)
+    {
+      rta_free(stft_setup->nyquist);
+    }
+
+    rta_free(stft_setup);
+  }
+
+  return;
+}
+
+unsigned int
+rta_stft_frame_size(const rta_stft_setup_t * stft_setup)
+{
+  return stft_setup->frame_size;
+}
+
+void
+rta_stft_reset(rta_stft_setup_t * stft_setup)
+{
+  unsigned int i;
+
+  for(i=0; i<stft_setup->window_size * stft_setup->channels_number; i++)
+  {
+    stft_setup->ring[i] = 0.;
+  }
+  stft_setup->ring_index = 0;
+  stft_setup->needed = stft_setup->window_size;
+
+  return;
+}
+
+unsigned int
+rta_stft_input(rta_stft_setup_t * stft_setup,
+               const rta_real_t * input, const unsigned int input_size)
+{
+  const unsigned int channels_number = stft_setup->channels_number;
+  const unsigned int window_size = stft_setup->window_size;
+  const unsigned int n = (input_size < stft_setup->needed ?
+                          input_size : stft_setup->needed);
+  unsigned int ring_index = stft_setup->ring_index;
+  unsigned int i, c;
+
+  for(i=0; i<n; i++)
+  {
+    for(c=0; c<channels_number; c++)
+    {
+      stft_setup->ring[c * window_size + ring_index] = *(input++);
+    }
+
+    if(++ring_index == window_size)
+    {
+      ring_index = 0;
+    }
+  }
+
+  stft_setup->ring_index = ring_index;
+  stft_setup->needed -= n;
+
+  return n;
+}
+
+int
+rta_stft_output(rta_stft_setup_t * stft_setup, void * output)
+{
+  int ret = 0;
+  
+  if(stft_setup->needed == 0)
+  {
+    const unsigned int frame_size = stft_setup->frame_size;
+    const unsigned int spectrum_size = frame_size - 1;
+    /* transforms of the channels, in place, of 2 * 'frame_size' reals */
+    rta_real_t * frames = (stft_setup->stft_type == rta_stft_complex ?
+                           (rta_real_t *) output : stft_setup->buffer);
+    unsigned int c, k;
+
+    for(c=0; c<stft_setup->channels_number; c++)
+    {
+      window_ring(frames + 2 * c * frame_size,
+                  stft_setup->ring + c * stft_setup->window_size,
+                  stft_setup->ring_index,
+                  stft_setup->window, stft_setup->window_size);
+    }
+
+    /* zero-padding is done by the FFT */
+    rta_fft_real_execute_batch(frames, frames, stft_setup->window_size,
+                               stft_setup->channels_number, 2 * frame_size,
+                               stft_setup->fft_setup, stft_setup->nyquist);
+
+    for(c=0; c<stft_setup->channels_number; c++)
+    {
+      rta_complex_t * spectrum = (rta_complex_t *) (frames + 2 * c * frame_size);
+
+      if(stft_setup->stft_type == rta_stft_complex)
+      {
+        /* real DC and Nyquist bins */
+        spectrum[0] = rta_make_complex(rta_creal(spectrum[0]), 0.);
+        spectrum[spectrum_size] =
+          rta_make_complex(stft_setup->nyquist[c], 0.);
+      }
+      else
+      {
+        rta_real_t * magnitude = (rta_real_t *) output + c * frame_size;
+
+        magnitude[0] = rta_abs(rta_creal(spectrum[0]));
+        for(k=1; k<spectrum_size; k++)
+        {
+          magnitude[k] = rta_sqrt(rta_creal(spectrum[k]) * rta_creal(spectrum[k])
+                                  + rta_cimag(spectrum[k]) * rta_cimag(spectrum[k]));
+        }
+        magnitude[spectrum_size] = rta_abs(stft_setup->nyquist[c]);
+      }
+    }
+
+    stft_setup->needed = stft_setup->hop_size;
+    ret = 1;
+  }
+
+  return ret;
+}
@@ -0,0 +1,182 @@
+/**
+ * @file   rta_stft.h
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 10:12:31 2026
+ * @ingroup rta_signal
+ *
+ * @brief  Streaming short-time Fourier transform analysis
+ *
+ * Input blocks of any size are written into a ring buffer, and a
+ * windowed and zero-padded real FFT frame is computed every hop
+ * size. Each sample is copied once, into the ring buffer, and
+ * nothing is allocated after the setup.
+ *
+ * A typical audio callback is:
+ *
+ * \code
+ * while(input_size > 0)
+ * {
+ *   unsigned int n = rta_stft_input(stft_setup, input, input_size);
+ *   input += n * channels_number;
+ *   input_size -= n;
+ *
+ *   if(rta_stft_output(stft_setup, frames))
+ *   {
+ *     ... use frames ...
+ *   }
+ * }
+ * \endcode
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_STFT_H_
+#define _RTA_STFT_H_ 1
+
+#include "rta.h"
+#include "rta_complex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+  rta_stft_complex = 1,  /**< complex spectrum frames */
+  rta_stft_magnitude = 2 /**< magnitude spectrum frames */
+} rta_stft_t;
+
+/* rta_stft_setup is private (depends on implementation) */
+typedef struct rta_stft_setup rta_stft_setup_t;
+
+/**
+ * Allocate and initialize a streaming STFT analysis setup.
+ *
+ * A frame holds 'fft_size' / 2 + 1 bins per channel, from 0 to the
+ * Nyquist frequency. The first frame is output when 'window_size'
+ * samples have been input, and then every 'hop_size' samples.
+ *
+ * \see rta_stft_setup_delete
+ * \see rta_stft_input
+ * \see rta_stft_output
+ *
+ * @param stft_setup is an address of a pointer to a private structure,
+ * which is allocated and filled by this function.
+ * @param stft_type can be 'rta_stft_complex' for frames of
+ * rta_complex_t or 'rta_stft_magnitude' for frames of rta_real_t.
+ * @param window is an array of 'window_size' weights, which is copied,
+ * or NULL for a rectangular window. \see rta_window_hann_weights
+ * @param window_size is the number of input samples of a frame
+ * @param hop_size is the number of input samples between two frames.
+ * It may be larger than 'window_size'.
+ * @param fft_size is the transform size. The windowed input is
+ * zero-padded if 'fft_size' > 'window_size'. It is rounded up to an
+ * even size, and to 'window_size'.
+ * @param channels_number is the number of interleaved input channels
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'stft_setup' (even a delete).
+ */
+int
+rta_stft_setup_new(rta_stft_setup_t ** stft_setup, const rta_stft_t stft_type,
+                   const rta_real_t * window, const unsigned int window_size,
+                   const unsigned int hop_size, const unsigned int fft_size,
+                   const unsigned int channels_number);
+
+/**
+ * Deallocate any (sucessfully) allocated STFT setup.
+ *
+ * \see rta_stft_setup_new
+ *
+ * @param stft_setup is a pointer to the memory wich will be released.
+ */
+void
+rta_stft_setup_delete(rta_stft_setup_t * stft_setup);
+
+/**
+ * Number of bins of a frame, for each channel.
+ *
+ * @param stft_setup is a previously allocated setup
+ *
+ * @return 'fft_size' / 2 + 1, 'fft_size' being the actual one.
+ */
+unsigned int
+rta_stft_frame_size(const rta_stft_setup_t * stft_setup);
+
+/**
+ * Forget any input sample. The next frame will be output after
+ * 'window_size' new samples.
+ *
+ * @param stft_setup is a previously allocated setup
+ */
+void
+rta_stft_reset(rta_stft_setup_t * stft_setup);
+
+/**
+ * Write input samples into the ring buffer, until a frame is
+ * ready. Then, no more sample is accepted before the frame is read
+ * by rta_stft_output.
+ *
+ * \see rta_stft_output
+ *
+ * @param stft_setup is a previously allocated setup
+ * @param input is an array of 'input_size' * 'channels_number'
+ * samples, with interleaved channels.
+ * @param input_size is the number of samples per channel
+ *
+ * @return the number of samples per channel actually written, which
+ * may be less than 'input_size'.
+ */
+unsigned int
+rta_stft_input(rta_stft_setup_t * stft_setup,
+               const rta_real_t * input, const unsigned int input_size);
+
+/**
+ * Compute and output the frame, if it is ready.
+ *
+ * \see rta_stft_input
+ *
+ * @param stft_setup is a previously allocated setup
+ * @param output is an array of rta_complex_t or rta_real_t, according
+ * to the type of the setup, of size 'channels_number' *
+ * rta_stft_frame_size(stft_setup). The frame of each channel is
+ * contiguous.
+ *
+ * @return 1 if a frame was output, 0 otherwise.
+ */
+int
+rta_stft_output(rta_stft_setup_t * stft_setup, void * output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_STFT_H_ */
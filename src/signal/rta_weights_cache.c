@@ -0,0 +1,464 @@
+/**
+ * @file   rta_weights_cache.c
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 19:02:17 2026
+ *
+ * @brief  Cache of bands, DCT and lifter weights
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_weights_cache.h"
+#include "rta_stdlib.h" /* memory management */
+#include "rta_thread.h" /* cache lock */
+
+/* -------  private (depends on implementation) ------ */
+
+typedef enum
+{
+  weights_mel_bands = 0,
+  weights_mel_bands_packed = 1,
+  weights_dct = 2,
+  weights_lifter = 3
+} weights_kind_t;
+
+/* generation parameters, unused ones are 0 */
+typedef struct weights_key weights_key_t;
+struct weights_key
+{
+  weights_kind_t kind;
+  unsigned int sizes[2];  /**< spectrum_size and filters_number, */
+                          /**< input_size and dct_order, or cepstrum_order */
+  rta_real_t reals[4];    /**< sample_rate, min_freq, max_freq and */
+                          /**< scale_width, or liftering_factor */
+  int types[2];           /**< mel_type, dct_type, or lifter_t and lifter_m */
+  rta_hz_to_mel_function hz_to_mel;
+  rta_mel_to_hz_function mel_to_hz;
+};
+
+/* an entry is pending while its weights are generated, without the */
+/* cache lock */
+typedef enum
+{
+  weights_pending = 0,
+  weights_ready = 1,
+  weights_failed = 2
+} weights_state_t;
+
+/* weights shared by all the users of the same parameters, */
+/* see weights_acquire and rta_weights_cache_release */
+typedef struct weights_entry weights_entry_t;
+struct weights_entry
+{
+  weights_key_t key;
+  weights_state_t state;
+  unsigned int references; /**< number of acquisitions, and waits */
+  void * weights;          /**< matrix, vector, or packed bands weights */
+  unsigned int * bounds;   /**< bounds of the mel bands matrix */
+  weights_entry_t * next;
+};
+
+static weights_entry_t * weights_cache = NULL;
+
+static rta_mutex_t weights_cache_mutex = RTA_MUTEX_INITIALIZER;
+
+/* signaled when a pending entry is ready or failed */
+static rta_condition_t weights_cache_condition = RTA_CONDITION_INITIALIZER;
+
+static void
+weights_key_init(weights_key_t * key, const weights_kind_t kind)
+{
+  unsigned int i;
+
+  key->kind = kind;
+  for(i=0; i<2; i++)
+  {
+    key->sizes[i] = 0;
+    key->types[i] = 0;
+  }
+  for(i=0; i<4; i++)
+  {
+    key->reals[i] = 0.;
+  }
+  key->hz_to_mel = NULL;
+  key->mel_to_hz = NULL;
+  return;
+}
+
+static int
+weights_key_equal(const weights_key_t * a, const weights_key_t * b)
+{
+  return (a->kind == b->kind &&
+          a->sizes[0] == b->sizes[0] && a->sizes[1] == b->sizes[1] &&
+          a->reals[0] == b->reals[0] && a->reals[1] == b->reals[1] &&
+          a->reals[2] == b->reals[2] && a->reals[3] == b->reals[3] &&
+          a->types[0] == b->types[0] && a->types[1] == b->types[1] &&
+          a->hz_to_mel == b->hz_to_mel && a->mel_to_hz == b->mel_to_hz);
+}
+
+/* delete the weights of an entry, according to their kind */
+static void
+weights_delete(weights_entry_t * entry)
+{
+  if(entry->key.kind == weights_mel_bands_packed)
+  {
+    rta_bands_weights_delete((rta_bands_weights_t *) entry->weights);
+  }
+  else if(entry->weights != NULL)
+  {
+    rta_free(entry->weights);
+  }
+
+  if(entry->bounds != NULL)
+  {
+    rta_free(entry->bounds);
+  }
+  return;
+}
+
+/* generate the weights of an entry, according to its key */
+/* return 1 on success, 0 on fail */
+static int
+weights_new(weights_entry_t * entry)
+{
+  const weights_key_t * key = &(entry->key);
+  int ret = 0;
+
+  entry->weights = NULL;
+  entry->bounds = NULL;
+
+  switch(key->kind)
+  {
+    case weights_mel_bands:
+    {
+      entry->weights = rta_malloc(key->sizes[0] * key->sizes[1] *
+                                  sizeof(rta_real_t));
+      entry->bounds = (unsigned int *) rta_malloc(2 * key->sizes[1] *
+                                                  sizeof(unsigned int));
+      if(entry->weights != NULL && entry->bounds != NULL)
+      {
+        ret = rta_spectrum_to_mel_bands_weights(
+          (rta_real_t *) entry->weights, entry->bounds,
+          key->sizes[0], key->reals[0], key->sizes[1],
+          key->reals[1], key->reals[2], key->reals[3],
+          key->hz_to_mel, key->mel_to_hz, (rta_mel_t) key->types[0]);
+      }
+      break;
+    }
+
+    case weights_mel_bands_packed:
+    {
+      rta_bands_weights_t * bands_weights = NULL;
+      ret = rta_spectrum_to_mel_bands_weights_new(
+        &bands_weights,
+        key->sizes[0], key->reals[0], key->sizes[1],
+        key->reals[1], key->reals[2], key->reals[3],
+        key->hz_to_mel, key->mel_to_hz, (rta_mel_t) key->types[0]);
+      entry->weights = bands_weights;
+      break;
+    }
+
+    case weights_dct:
+    {
+      entry->weights = rta_malloc(key->sizes[0] * key->sizes[1] *
+                                  sizeof(rta_real_t));
+      if(entry->weights != NULL)
+      {
+        ret = rta_dct_weights((rta_real_t *) entry->weights,
+                              key->sizes[0], key->sizes[1],
+                              (rta_dct_t) key->types[0]);
+      }
+      break;
+    }
+
+    case weights_lifter:
+    {
+      entry->weights = rta_malloc(key->sizes[0] * sizeof(rta_real_t));
+      if(entry->weights != NULL)
+      {
+        ret = rta_lifter_weights((rta_real_t *) entry->weights,
+                                 key->sizes[0], key->reals[0],
+                                 (rta_lifter_t) key->types[0],
+                                 (rta_lifter_mode_t) key->types[1]);
+      }
+      break;
+    }
+  }
+
+  if(ret == 0)
+  {
+    weights_delete(entry);
+  }
+
+  return ret;
+}
+
+/* unlink an entry from the cache, with the lock */
+static void
+weights_unlink(const weights_entry_t * entry)
+{
+  weights_entry_t ** previous;
+
+  for(previous = &weights_cache; *previous != NULL;
+      previous = &((*previous)->next))
+  {
+    if(*previous == entry)
+    {
+      *previous = entry->next;
+      break;
+    }
+  }
+  return;
+}
+
+/* get the weights from the cache, or generate them: the first */
+/* acquisition of a key inserts a pending entry and generates its */
+/* weights without the lock, and the next ones wait for them */
+/* return the entry on success, NULL on fail */
+static weights_entry_t *
+weights_acquire(const weights_key_t * key)
+{
+  weights_entry_t * entry;
+
+  rta_mutex_lock(&weights_cache_mutex);
+
+  for(entry = weights_cache; entry != NULL; entry = entry->next)
+  {
+    if(weights_key_equal(&(entry->key), key))
+    {
+      break;
+    }
+  }
+
+  if(entry != NULL)
+  {
+    entry->references++;
+    while(entry->state == weights_pending)
+    {
+      rta_condition_wait(&weights_cache_condition, &weights_cache_mutex);
+    }
+  }
+  else
+  {
+    entry = (weights_entry_t *) rta_malloc(sizeof(weights_entry_t));
+    if(entry != NULL)
+    {
+      weights_entry_t generated;
+      int ret;
+
+      entry->key = *key;
+      entry->state = weights_pending;
+      entry->references = 1;
+      entry->weights = NULL;
+      entry->bounds = NULL;
+      entry->next = weights_cache;
+      weights_cache = entry;
+
+      rta_mutex_unlock(&weights_cache_mutex);
+      generated.key = *key;
+      ret = weights_new(&generated);
+      rta_mutex_lock(&weights_cache_mutex);
+
+      if(ret != 0)
+      {
+        entry->weights = generated.weights;
+        entry->bounds = generated.bounds;
+        entry->state = weights_ready;
+      }
+      else
+      {
+        entry->state = weights_failed;
+        weights_unlink(entry);
+      }
+      rta_condition_broadcast(&weights_cache_condition);
+    }
+  }
+
+  /* the last one to see a failed entry deletes it */
+  if(entry != NULL && entry->state == weights_failed)
+  {
+    entry->references--;
+    if(entry->references == 0)
+    {
+      rta_free(entry);
+    }
+    entry = NULL;
+  }
+
+  rta_mutex_unlock(&weights_cache_mutex);
+
+  return entry;
+}
+
+/* ------- end of private ---------------------------- */
+
+/* ------- Public functions -------------------------- */
+
+int rta_weights_cache_mel_bands_acquire(
+  const rta_real_t ** weights_matrix, const unsigned int ** weights_bounds,
+  const unsigned int spectrum_size,
+  const rta_real_t sample_rate, const unsigned int filters_number,
+  const rta_real_t min_freq, const rta_real_t max_freq, const rta_real_t scale_width,
+  const rta_hz_to_mel_function hz_to_mel,
+  const rta_mel_to_hz_function mel_to_hz,
+  const rta_mel_t mel_type)
+{
+  weights_key_t key;
+  weights_entry_t * entry;
+
+  weights_key_init(&key, weights_mel_bands);
+  key.sizes[0] = spectrum_size;
+  key.sizes[1] = filters_number;
+  key.reals[0] = sample_rate;
+  key.reals[1] = min_freq;
+  key.reals[2] = max_freq;
+  key.reals[3] = scale_width;
+  key.types[0] = mel_type;
+  key.hz_to_mel = hz_to_mel;
+  key.mel_to_hz = mel_to_hz;
+
+  entry = weights_acquire(&key);
+  if(entry != NULL)
+  {
+    *weights_matrix = (const rta_real_t *) entry->weights;
+    *weights_bounds = entry->bounds;
+  }
+
+  return (entry != NULL);
+}
+
+int rta_weights_cache_mel_bands_packed_acquire(
+  const rta_bands_weights_t ** bands_weights,
+  const unsigned int spectrum_size,
+  const rta_real_t sample_rate, const unsigned int filters_number,
+  const rta_real_t min_freq, const rta_real_t max_freq, const rta_real_t scale_width,
+  const rta_hz_to_mel_function hz_to_mel,
+  const rta_mel_to_hz_function mel_to_hz,
+  const rta_mel_t mel_type)
+{
+  weights_key_t key;
+  weights_entry_t * entry;
+
+  weights_key_init(&key, weights_mel_bands_packed);
+  key.sizes[0] = spectrum_size;
+  key.sizes[1] = filters_number;
+  key.reals[0] = sample_rate;
+  key.reals[1] = min_freq;
+  key.reals[2] = max_freq;
+  key.reals[3] = scale_width;
+  key.types[0] = mel_type;
+  key.hz_to_mel = hz_to_mel;
+  key.mel_to_hz = mel_to_hz;
+
+  entry = weights_acquire(&key);
+  if(entry != NULL)
+  {
+    *bands_weights = (const rta_bands_weights_t *) entry->weights;
+  }
+
+  return (entry != NULL);
+}
+
+int rta_weights_cache_dct_acquire(const rta_real_t ** weights_matrix,
+                                  const unsigned int input_size,
+                                  const unsigned int dct_order,
+                                  const rta_dct_t dct_type)
+{
+  weights_key_t key;
+  weights_entry_t * entry;
+
+  weights_key_init(&key, weights_dct);
+  key.sizes[0] = input_size;
+  key.sizes[1] = dct_order;
+  key.types[0] = dct_type;
+
+  entry = weights_acquire(&key);
+  if(entry != NULL)
+  {
+    *weights_matrix = (const rta_real_t *) entry->weights;
+  }
+
+  return (entry != NULL);
+}
+
+int rta_weights_cache_lifter_acquire(const rta_real_t ** weights_vector,
+                                     const unsigned int cepstrum_order,
+                                     const rta_real_t liftering_factor,
+                                     const rta_lifter_t lifter_t,
+                                     const rta_lifter_mode_t lifter_m)
+{
+  weights_key_t key;
+  weights_entry_t * entry;
+
+  weights_key_init(&key, weights_lifter);
+  key.sizes[0] = cepstrum_order;
+  key.reals[0] = liftering_factor;
+  key.types[0] = lifter_t;
+  key.types[1] = lifter_m;
+
+  entry = weights_acquire(&key);
+  if(entry != NULL)
+  {
+    *weights_vector = (const rta_real_t *) entry->weights;
+  }
+
+  return (entry != NULL);
+}
+
+void rta_weights_cache_release(const void * weights)
+{
+  weights_entry_t ** previous;
+
+  rta_mutex_lock(&weights_cache_mutex);
+
+  for(previous = &weights_cache; *previous != NULL;
+      previous = &((*previous)->next))
+  {
+    if((*previous)->state == weights_ready &&
+       (*previous)->weights == weights)
+    {
+      weights_entry_t * entry = *previous;
+
+      entry->references--;
+      if(entry->references == 0)
+      {
+        *previous = entry->next;
+        weights_delete(entry);
+        rta_free(entry);
+      }
+      break;
+    }
+  }
+
+  rta_mutex_unlock(&weights_cache_mutex);
+
+  return;
+}
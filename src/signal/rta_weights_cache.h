@@ -0,0 +1,172 @@
+/**
+ * @file   rta_weights_cache.h
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 19:02:17 2026
+ * @ingroup rta_signal
+ *
+ * @brief  Cache of bands, DCT and lifter weights
+ *
+ * The weights generated by rta_spectrum_to_mel_bands_weights,
+ * rta_spectrum_to_mel_bands_weights_new, rta_dct_weights and
+ * rta_lifter_weights, shared by all their users with the same
+ * parameters. The first acquisition generates them, and the next ones
+ * only count a reference, until the last release deletes them.
+ *
+ * The shared weights are read-only. Acquisitions and releases are
+ * thread-safe (a mutex protects the cache), but they may allocate
+ * memory, so they are not meant for a real-time thread. The weights
+ * are generated without the lock: the acquisitions of other weights
+ * do not wait for them, and the concurrent acquisitions of the same
+ * weights wait until the first one has generated them.
+ *
+ * The parameters of an acquisition must be exactly equal to the ones
+ * of cached weights to share them: the real parameters are compared
+ * with ==, so a frequency computed in another way (even 0.1 + 0.2
+ * instead of 0.3) generates other weights, and the functions of the
+ * mel scale are compared by address.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_WEIGHTS_CACHE_H_
+#define _RTA_WEIGHTS_CACHE_H_ 1
+
+#include "rta.h"
+#include "rta_mel.h"
+#include "rta_bands.h"
+#include "rta_dct.h"
+#include "rta_lifter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Acquire a matrix of weights and its bounds to combine a power
+ * spectrum into mel bands, as generated by
+ * rta_spectrum_to_mel_bands_weights with the same parameters.
+ *
+ * \see rta_spectrum_to_mel_bands_weights
+ * \see rta_weights_cache_release
+ *
+ * @param weights_matrix is an address of a pointer to the shared
+ * weights, whose size is 'filters_number'*'spectrum_size'
+ * @param weights_bounds is an address of a pointer to the shared
+ * bounds, whose size is 'filters_number'*2. They are released with
+ * the weights.
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'weights_matrix' (even a release).
+ */
+int rta_weights_cache_mel_bands_acquire(
+  const rta_real_t ** weights_matrix, const unsigned int ** weights_bounds,
+  const unsigned int spectrum_size,
+  const rta_real_t sample_rate, const unsigned int filters_number,
+  const rta_real_t min_freq, const rta_real_t max_freq, const rta_real_t scale_width,
+  const rta_hz_to_mel_function hz_to_mel,
+  const rta_mel_to_hz_function mel_to_hz,
+  const rta_mel_t mel_type);
+
+/**
+ * Acquire packed weights to combine a power spectrum into mel bands,
+ * as generated by rta_spectrum_to_mel_bands_weights_new with the same
+ * parameters.
+ *
+ * \see rta_spectrum_to_mel_bands_weights_new
+ * \see rta_weights_cache_release
+ *
+ * @param bands_weights is an address of a pointer to the shared
+ * packed weights, which must not be deleted.
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'bands_weights' (even a release).
+ */
+int rta_weights_cache_mel_bands_packed_acquire(
+  const rta_bands_weights_t ** bands_weights,
+  const unsigned int spectrum_size,
+  const rta_real_t sample_rate, const unsigned int filters_number,
+  const rta_real_t min_freq, const rta_real_t max_freq, const rta_real_t scale_width,
+  const rta_hz_to_mel_function hz_to_mel,
+  const rta_mel_to_hz_function mel_to_hz,
+  const rta_mel_t mel_type);
+
+/**
+ * Acquire a matrix of weights to perform a discrete cosine
+ * transform, as generated by rta_dct_weights with the same
+ * parameters.
+ *
+ * \see rta_dct_weights
+ * \see rta_weights_cache_release
+ *
+ * @param weights_matrix is an address of a pointer to the shared
+ * weights, whose size is 'input_size'*'dct_order'
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'weights_matrix' (even a release).
+ */
+int rta_weights_cache_dct_acquire(const rta_real_t ** weights_matrix,
+                                  const unsigned int input_size,
+                                  const unsigned int dct_order,
+                                  const rta_dct_t dct_type);
+
+/**
+ * Acquire a vector of weights to lifter a cepstrum, as generated by
+ * rta_lifter_weights with the same parameters.
+ *
+ * \see rta_lifter_weights
+ * \see rta_weights_cache_release
+ *
+ * @param weights_vector is an address of a pointer to the shared
+ * weights, whose size is 'cepstrum_order'
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'weights_vector' (even a release).
+ */
+int rta_weights_cache_lifter_acquire(const rta_real_t ** weights_vector,
+                                     const unsigned int cepstrum_order,
+                                     const rta_real_t liftering_factor,
+                                     const rta_lifter_t lifter_t,
+                                     const rta_lifter_mode_t lifter_m);
+
+/**
+ * Release any (successfully) acquired weights. They are deleted when
+ * they are not used any more.
+ *
+ * @param weights is the pointer given by an acquisition: the weights
+ * matrix or vector, or the packed bands weights.
+ */
+void rta_weights_cache_release(const void * weights);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_WEIGHTS_CACHE_H_ */
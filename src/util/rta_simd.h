@@ -0,0 +1,84 @@
+/**
+ * @file   rta_simd.h
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 18:40:27 2026
+ * @ingroup rta_util
+ *
+ * @brief  Vector instructions of the CPU
+ *
+ * On x86 with GCC or Clang, some functions of the library have
+ * versions with SSE2, AVX2 and AVX-512 instructions, compiled with
+ * the target attributes of the compiler, whatever the compilation
+ * flags. They are selected at run-time according to rta_simd_level,
+ * usually once at setup time. Define RTA_NO_SIMD to compile the
+ * scalar code only.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_SIMD_H_
+#define _RTA_SIMD_H_ 1
+
+#include "rta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** defined when the vector versions are compiled */
+#if !defined(RTA_NO_SIMD) && defined(__GNUC__) && \
+  (defined(__x86_64__) || defined(__i386__))
+#define RTA_SIMD_X86 1
+#endif
+
+/** widest vector instructions supported by the CPU */
+typedef enum
+{
+  rta_simd_none = 0,  /**< scalar code only */
+  rta_simd_sse2 = 1,  /**< 128 bits */
+  rta_simd_avx2 = 2,  /**< 256 bits */
+  rta_simd_avx512 = 3 /**< 512 bits (AVX-512 F) */
+} rta_simd_level_t;
+
+/**
+ * Widest vector instructions supported by the CPU, and compiled in the
+ * library.
+ *
+ * @return rta_simd_none when RTA_SIMD_X86 is not defined, the widest
+ * level supported otherwise. Any lower level is also supported.
+ */
+rta_simd_level_t rta_simd_level(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_SIMD_H_ */
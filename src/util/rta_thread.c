@@ -0,0 +1,264 @@
+/**
+ * @file   rta_thread.c
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 16:05:12 2026
+ *
+ * @brief  Pool of worker threads
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_thread.h"
+#include "rta_stdlib.h" /* memory management */
+
+/* -------  private (depends on implementation) ------ */
+
+typedef struct thread_pool_worker
+{
+  rta_thread_pool_t * pool;
+  unsigned int index;
+  rta_thread_t thread;
+} thread_pool_worker_t;
+
+struct rta_thread_pool
+{
+  unsigned int threads_number;     /**< including the calling one */
+  thread_pool_worker_t * workers;  /**< 'threads_number' - 1 */
+  unsigned int started;            /**< workers */
+
+  /* current run */
+  rta_thread_pool_function_t function;
+  void * argument;
+  unsigned long generation;        /**< of the run */
+  unsigned int pending;            /**< workers */
+  int quit;
+
+  rta_mutex_t mutex;
+  rta_condition_t start;           /**< to the workers */
+  rta_condition_t done;            /**< to the caller */
+};
+
+static RTA_THREAD_RETURN
+thread_pool_worker_run(void * argument)
+{
+  thread_pool_worker_t * worker = (thread_pool_worker_t *) argument;
+  rta_thread_pool_t * pool = worker->pool;
+  unsigned long generation = 0;
+
+  rta_mutex_lock(&pool->mutex);
+  while(1)
+  {
+    while(pool->quit == 0 && pool->generation == generation)
+    {
+      rta_condition_wait(&pool->start, &pool->mutex);
+    }
+
+    if(pool->quit != 0)
+    {
+      break;
+    }
+
+    generation = pool->generation;
+    rta_mutex_unlock(&pool->mutex);
+
+    pool->function(pool->argument, worker->index, pool->threads_number);
+
+    rta_mutex_lock(&pool->mutex);
+    pool->pending--;
+    if(pool->pending == 0)
+    {
+      rta_condition_signal(&pool->done);
+    }
+  }
+  rta_mutex_unlock(&pool->mutex);
+
+  return 0;
+}
+
+/* -------  public ------ */
+
+int
+rta_thread_pool_new(rta_thread_pool_t ** pool,
+                    const unsigned int threads_number)
+{
+  int ret = 1;
+  unsigned int i;
+  *pool = (rta_thread_pool_t *) rta_malloc(sizeof(rta_thread_pool_t));
+
+  if(*pool == NULL)
+  {
+    ret = 0;
+  }
+  else
+  {
+    (*pool)->threads_number = (threads_number > 1 ? threads_number : 1);
+    (*pool)->workers = NULL;
+    (*pool)->started = 0;
+    (*pool)->function = NULL;
+    (*pool)->argument = NULL;
+    (*pool)->generation = 0;
+    (*pool)->pending = 0;
+    (*pool)->quit = 0;
+  }
+
+  if(ret != 0 && (*pool)->threads_number > 1)
+  {
+    (*pool)->workers = (thread_pool_worker_t *) rta_malloc(
+      sizeof(thread_pool_worker_t) * ((*pool)->threads_number - 1));
+
+    if((*pool)->workers == NULL)
+    {
+      ret = 0;
+    }
+    else if(rta_mutex_init(&((*pool)->mutex)) == 0)
+    {
+      rta_free((*pool)->workers);
+      (*pool)->workers = NULL;
+      ret = 0;
+    }
+    else if(rta_condition_init(&((*pool)->start)) == 0)
+    {
+      rta_mutex_destroy(&((*pool)->mutex));
+      rta_free((*pool)->workers);
+      (*pool)->workers = NULL;
+      ret = 0;
+    }
+    else if(rta_condition_init(&((*pool)->done)) == 0)
+    {
+      rta_condition_destroy(&((*pool)->start));
+      rta_mutex_destroy(&((*pool)->mutex));
+      rta_free((*pool)->workers);
+      (*pool)->workers = NULL;
+      ret = 0;
+    }
+    else
+    {
+      for(i=0; ret != 0 && i<(*pool)->threads_number - 1; i++)
+      {
+        thread_pool_worker_t * worker = (*pool)->workers + i;
+        worker->pool = *pool;
+        worker->index = i + 1;
+        ret = rta_thread_create(&(worker->thread), thread_pool_worker_run,
+                                worker);
+        if(ret != 0)
+        {
+          (*pool)->started++;
+        }
+      }
+    }
+  }
+
+  if(ret == 0 && *pool != NULL)
+  {
+    rta_thread_pool_delete(*pool);
+    *pool = NULL;
+  }
+
+  return ret;
+}
+
+void
+rta_thread_pool_delete(rta_thread_pool_t * pool)
+{
+  unsigned int t;
+
+  if(pool != NULL)
+  {
+    if(pool->started > 0)
+    {
+      rta_mutex_lock(&pool->mutex);
+      pool->quit = 1;
+      rta_condition_broadcast(&pool->start);
+      rta_mutex_unlock(&pool->mutex);
+
+      for(t=0; t<pool->started; t++)
+      {
+        rta_thread_join(pool->workers[t].thread);
+      }
+    }
+
+    if(pool->workers != NULL)
+    {
+      rta_condition_destroy(&pool->done);
+      rta_condition_destroy(&pool->start);
+      rta_mutex_destroy(&pool->mutex);
+      rta_free(pool->workers);
+    }
+
+    rta_free(pool);
+  }
+
+  return;
+}
+
+unsigned int
+rta_thread_pool_threads_number(const rta_thread_pool_t * pool)
+{
+  return (pool != NULL ? pool->threads_number : 1);
+}
+
+void
+rta_thread_pool_run(rta_thread_pool_t * pool,
+                    rta_thread_pool_function_t function, void * argument)
+{
+  if(pool != NULL && pool->threads_number > 1)
+  {
+    rta_mutex_lock(&pool->mutex);
+    pool->function = function;
+    pool->argument = argument;
+    pool->pending = pool->threads_number - 1;
+    pool->generation++;
+    rta_condition_broadcast(&pool->start);
+    rta_mutex_unlock(&pool->mutex);
+
+    function(argument, 0, pool->threads_number);
+
+    rta_mutex_lock(&pool->mutex);
+    while(pool->pending > 0)
+    {
+      rta_condition_wait(&pool->done, &pool->mutex);
+    }
+    rta_mutex_unlock(&pool->mutex);
+  }
+  else
+  {
+    function(argument, 0, 1);
+  }
+
+  return;
+}
+
+unsigned int
+rta_thread_part_begin(const unsigned int count, const unsigned int index,
+                      const unsigned int threads_number)
+{
+  return (unsigned int) ((unsigned long) count * index / threads_number);
+}
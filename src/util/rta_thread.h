@@ -0,0 +1,217 @@
+/**
+ * @file   rta_thread.h
+ * @author IRCAM-Centre Georges Pompidou
+ * @date   Sat Oct 17 16:05:12 2026
+ * @ingroup rta_util
+ *
+ * @brief  Mutexes, conditions, threads and pool of worker threads
+ *
+ * The mutex, condition and thread macros wrap the POSIX threads, or
+ * the slim reader/writer locks and condition variables of Windows
+ * (Vista and later). The mutex and condition macros return 1 on
+ * success and 0 on failure for the initialisations.
+ *
+ * A pool of worker threads runs a function on 'threads_number'
+ * threads, including the calling one, each one with its index. The
+ * workers live until the pool is deleted. This is how the library
+ * spreads a computation on several threads: the functions that can
+ * use threads take a pool, which may be shared by several setups, as
+ * long as they do not run at the same time.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_THREAD_H_
+#define _RTA_THREAD_H_ 1
+
+#include "rta.h"
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef WIN32
+
+typedef SRWLOCK rta_mutex_t;
+typedef CONDITION_VARIABLE rta_condition_t;
+typedef HANDLE rta_thread_t;
+
+/** static initialiser of a mutex */
+#define RTA_MUTEX_INITIALIZER SRWLOCK_INIT
+/** static initialiser of a condition */
+#define RTA_CONDITION_INITIALIZER CONDITION_VARIABLE_INIT
+
+#define rta_mutex_init(m) (InitializeSRWLock(m), 1)
+#define rta_mutex_destroy(m)
+#define rta_mutex_lock(m) AcquireSRWLockExclusive(m)
+#define rta_mutex_unlock(m) ReleaseSRWLockExclusive(m)
+
+#define rta_condition_init(c) (InitializeConditionVariable(c), 1)
+#define rta_condition_destroy(c)
+#define rta_condition_wait(c, m) SleepConditionVariableSRW(c, m, INFINITE, 0)
+#define rta_condition_signal(c) WakeConditionVariable(c)
+#define rta_condition_broadcast(c) WakeAllConditionVariable(c)
+
+/** return type of a thread function, which returns 0 */
+#define RTA_THREAD_RETURN DWORD WINAPI
+
+#define rta_thread_create(t, function, argument) \
+  ((*(t) = CreateThread(NULL, 0, (function), (argument), 0, NULL)) != NULL)
+#define rta_thread_join(t) \
+  (WaitForSingleObject((t), INFINITE), CloseHandle(t))
+
+#else /* POSIX threads */
+
+typedef pthread_mutex_t rta_mutex_t;
+typedef pthread_cond_t rta_condition_t;
+typedef pthread_t rta_thread_t;
+
+/** static initialiser of a mutex */
+#define RTA_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+/** static initialiser of a condition */
+#define RTA_CONDITION_INITIALIZER PTHREAD_COND_INITIALIZER
+
+#define rta_mutex_init(m) (pthread_mutex_init(m, NULL) == 0)
+#define rta_mutex_destroy(m) pthread_mutex_destroy(m)
+#define rta_mutex_lock(m) pthread_mutex_lock(m)
+#define rta_mutex_unlock(m) pthread_mutex_unlock(m)
+
+#define rta_condition_init(c) (pthread_cond_init(c, NULL) == 0)
+#define rta_condition_destroy(c) pthread_cond_destroy(c)
+#define rta_condition_wait(c, m) pthread_cond_wait(c, m)
+#define rta_condition_signal(c) pthread_cond_signal(c)
+#define rta_condition_broadcast(c) pthread_cond_broadcast(c)
+
+/** return type of a thread function, which returns 0 */
+#define RTA_THREAD_RETURN void *
+
+#define rta_thread_create(t, function, argument) \
+  (pthread_create((t), NULL, (function), (argument)) == 0)
+#define rta_thread_join(t) pthread_join((t), NULL)
+
+#endif /* WIN32 */
+
+
+/* rta_thread_pool is private (depends on implementation) */
+typedef struct rta_thread_pool rta_thread_pool_t;
+
+/**
+ * Function run by each thread of a pool.
+ *
+ * @param argument is the argument given to rta_thread_pool_run
+ * @param index is the index of the thread, from 0 (the calling
+ * thread) to 'threads_number' - 1
+ * @param threads_number is the number of threads of the pool
+ */
+typedef void (*rta_thread_pool_function_t)(void * argument,
+                                           const unsigned int index,
+                                           const unsigned int threads_number);
+
+/**
+ * Allocate a pool and start its worker threads.
+ *
+ * \see rta_thread_pool_delete
+ *
+ * @param pool is an address of a pointer to a private structure,
+ * which is allocated and filled by this function.
+ * @param threads_number is the number of threads, including the
+ * calling one. With 0 or 1, no worker is started and the functions
+ * run in the calling thread only.
+ *
+ * @return 1 on success 0 on fail. If it fails, nothing should be done
+ * with 'pool' (even a delete).
+ */
+int
+rta_thread_pool_new(rta_thread_pool_t ** pool,
+                    const unsigned int threads_number);
+
+/**
+ * Stop the worker threads and deallocate any (sucessfully) allocated
+ * pool.
+ *
+ * \see rta_thread_pool_new
+ *
+ * @param pool is a pointer to the memory wich will be released.
+ */
+void
+rta_thread_pool_delete(rta_thread_pool_t * pool);
+
+/**
+ * Number of threads of a pool, including the calling one.
+ *
+ * @param pool is a previously allocated pool, or NULL
+ *
+ * @return the number of threads, 1 for NULL
+ */
+unsigned int
+rta_thread_pool_threads_number(const rta_thread_pool_t * pool);
+
+/**
+ * Run a function on every thread of a pool, and wait for all of them
+ * to return. The calling thread runs the index 0. A pool must not be
+ * run by several threads at the same time.
+ *
+ * @param pool is a previously allocated pool, or NULL to run the
+ * function in the calling thread only
+ * @param function is called with 'argument', the index of the thread
+ * and the number of threads
+ * @param argument is passed to 'function'
+ */
+void
+rta_thread_pool_run(rta_thread_pool_t * pool,
+                    rta_thread_pool_function_t function, void * argument);
+
+/**
+ * First item of the part 'index' of 'count' items, split among
+ * 'threads_number' threads. The part ends where the part 'index' + 1
+ * begins.
+ *
+ * @param count is the number of items
+ * @param index is the index of the thread
+ * @param threads_number is the number of threads
+ *
+ * @return the first item of the part
+ */
+unsigned int
+rta_thread_part_begin(const unsigned int count, const unsigned int index,
+                      const unsigned int threads_number);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_THREAD_H_ */
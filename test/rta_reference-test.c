@@ -0,0 +1,2057 @@
+/*
+
+- compile
+
+cc -g -std=gnu99 rta_reference-test.c ../src/signal/rta_fft.c ../src/signal/rta_stft.c ../src/signal/rta_istft.c ../src/signal/rta_convolution.c ../src/signal/rta_convolution_nonuniform.c ../src/signal/rta_correlation.c ../src/signal/rta_sdft.c ../src/signal/rta_cqt.c ../src/signal/rta_window.c ../src/signal/rta_resample.c ../src/signal/rta_cubic.c ../src/signal/rta_mfcc.c ../src/signal/rta_mel.c ../src/signal/rta_bands.c ../src/signal/rta_dct.c ../src/signal/rta_lifter.c ../src/signal/rta_weights_cache.c ../src/signal/rta_delta.c ../src/util/rta_int.c ../src/util/rta_simd.c ../src/util/rta_thread.c -DRTA_FFT_STOCKHAM_MIN_SIZE=2048 -DRTA_FFT_STOCKHAM_SIMD_MIN_SIZE=2048 -DRTA_FFT_FOUR_STEP_MIN_SIZE=2048 -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/signal/ -lm -lpthread -o rta_reference-test
+
+- run (from this directory, as data paths are relative)
+
+./rta_reference-test
+
+- check
+
+valgrind --error-limit=no ./rta_reference-test
+
+Each test reads the input*.txt files of a test/rta_<module>/
+directory, described by its parameters.txt, and compares the outputs
+to its output*.txt reference files. A computed value v matches its
+reference r when |v - r| <= tolerance * max(1, max |r|) over the
+whole output. The reference files are written with 8 significant
+digits, which bounds the tolerances in double precision.
+
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "rta_configuration.h"
+#include "rta.h"
+#include "rta_complex.h"
+#include "rta_fft.h"
+#include "rta_stft.h"
+#include "rta_istft.h"
+#include "rta_convolution.h"
+#include "rta_convolution_nonuniform.h"
+#include "rta_correlation.h"
+#include "rta_sdft.h"
+#include "rta_cqt.h"
+#include "rta_mfcc.h"
+#include "rta_bands.h"
+#include "rta_delta.h"
+#include "rta_mel.h"
+#include "rta_dct.h"
+#include "rta_lifter.h"
+#include "rta_weights_cache.h"
+#include "rta_thread.h"
+
+/* the transforms of 2048 points must use the Stockham passes, and
+ * the four-step transform with threads */
+#if RTA_FFT_STOCKHAM_MIN_SIZE > 2048 || RTA_FFT_STOCKHAM_SIMD_MIN_SIZE > 2048 \
+  || RTA_FFT_FOUR_STEP_MIN_SIZE > 2048
+#error "compile with the RTA_FFT_* definitions above"
+#endif
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE)
+#define TOLERANCE 1e-5
+#else
+#define TOLERANCE 1e-6
+#endif
+
+/* read 'size' values of a reference file, 0 on failure */
+static int read_values(const char * path, rta_real_t * values,
+                       const unsigned int size)
+{
+  FILE * file = fopen(path, "r");
+  unsigned int i;
+  double value;
+  int ret = (file != NULL);
+
+  for(i = 0; i < size && ret != 0; i++)
+  {
+    ret = (fscanf(file, "%lf", &value) == 1);
+    values[i] = (rta_real_t) value;
+  }
+
+  if(file != NULL)
+  {
+    fclose(file);
+  }
+
+  if(ret == 0)
+  {
+    fprintf(stderr, "%s: cannot read %u values\n", path, size);
+  }
+  return ret;
+}
+
+/* compare 'size' values to reference values, 0 on failure */
+static int compare_values(const char * name, const rta_real_t * computed,
+                          const unsigned int c_stride,
+                          const rta_real_t * reference,
+                          const unsigned int size, const double tolerance)
+{
+  double error = 0.;
+  double range = 1.;
+  unsigned int i;
+  int ret;
+
+  for(i = 0; i < size; i++)
+  {
+    const double difference = fabs(computed[i * c_stride] - reference[i]);
+
+    if(isnan(difference) || difference > error)
+    {
+      error = (isnan(difference) ? HUGE_VAL : difference);
+    }
+    if(fabs(reference[i]) > range)
+    {
+      range = fabs(reference[i]);
+    }
+  }
+
+  ret = error <= tolerance * range;
+  printf("%-40s %-4s (error %g)\n", name, (ret ? "ok" : "FAIL"), error);
+  return ret;
+}
+
+/* compare 'size' values to a reference file, 0 on failure */
+static int compare(const char * name, const rta_real_t * computed,
+                   const unsigned int c_stride, const char * path,
+                   const unsigned int size, const double tolerance)
+{
+  rta_real_t * reference = malloc(size * sizeof(rta_real_t));
+  int ret = (reference != NULL && read_values(path, reference, size));
+
+  if(ret != 0)
+  {
+    ret = compare_values(name, computed, c_stride, reference, size,
+                         tolerance);
+  }
+  else
+  {
+    printf("%-40s %-4s\n", name, "FAIL");
+  }
+  free(reference);
+  return ret;
+}
+
+/* split complex values into real and imaginary parts */
+static void complex_split(rta_real_t * real, rta_real_t * imag,
+                          const rta_complex_t * values,
+                          const unsigned int size)
+{
+  unsigned int i;
+
+  for(i = 0; i < size; i++)
+  {
+    real[i] = rta_creal(values[i]);
+    imag[i] = rta_cimag(values[i]);
+  }
+}
+
+/* split real transform spectra of 'channels_number' frames of
+ * 'spectra', with their Nyquist values, into real and imaginary parts
+ * of 'fft_size' / 2 + 1 values per channel */
+static void spectra_split(rta_real_t * real, rta_real_t * imag,
+                          const rta_real_t * spectra,
+                          const unsigned int s_stride,
+                          const rta_real_t * nyquists,
+                          const unsigned int channels_number,
+                          const unsigned int fft_size)
+{
+  const unsigned int spectrum_size = fft_size / 2;
+  unsigned int c;
+
+  for(c = 0; c < channels_number; c++)
+  {
+    rta_real_t * r = real + c * (spectrum_size + 1);
+    rta_real_t * i = imag + c * (spectrum_size + 1);
+
+    complex_split(r, i, (const rta_complex_t *) (spectra + c * s_stride),
+                  spectrum_size);
+    r[spectrum_size] = nyquists[c];
+    i[spectrum_size] = 0.;
+  }
+}
+
+/* rta_fft_complex: direct and inverse complex transforms, with and
+ * without stride (regression of the 2-point and strided transforms) */
+static int test_fft_complex(void)
+{
+  const unsigned int sizes[] = {2, 8, 64};
+  const int strides[] = {1, 2};
+  rta_real_t input_re[64];
+  rta_real_t input_im[64];
+  rta_real_t output_re[64];
+  rta_real_t output_im[64];
+  rta_complex_t input[128];
+  rta_complex_t output[128];
+  rta_real_t scale = 1.;
+  char name[64];
+  char path[64];
+  int ret = read_values("rta_fft_complex/input_re.txt", input_re, 64)
+    && read_values("rta_fft_complex/input_im.txt", input_im, 64);
+  unsigned int s, t, i;
+  int inverse;
+
+  for(s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && ret != 0; s++)
+  {
+    for(t = 0; t < sizeof(strides) / sizeof(strides[0]); t++)
+    {
+      for(inverse = 0; inverse <= 1; inverse++)
+      {
+        const unsigned int n = sizes[s];
+        const int stride = strides[t];
+        rta_fft_setup_t * setup;
+
+        for(i = 0; i < n; i++)
+        {
+          input[i * stride] = rta_make_complex(input_re[i], input_im[i]);
+        }
+
+        if(rta_fft_setup_new_stride(
+             &setup, (inverse ? rta_fft_complex_inverse_1d : rta_fft_complex_1d),
+             &scale, input, stride, n, output, stride, n) == 0)
+        {
+          fprintf(stderr, "rta_fft_setup_new_stride failed\n");
+          return 0;
+        }
+        rta_fft_execute(output, input, n, setup);
+        rta_fft_setup_delete(setup);
+
+        for(i = 0; i < n; i++)
+        {
+          output_re[i] = rta_creal(output[i * stride]);
+          output_im[i] = rta_cimag(output[i * stride]);
+        }
+
+        sprintf(name, "rta_fft_complex %s%u stride %d (re)",
+                (inverse ? "inverse " : ""), n, stride);
+        sprintf(path, "rta_fft_complex/output_%s%u_re.txt",
+                (inverse ? "inverse_" : ""), n);
+        ret &= compare(name, output_re, 1, path, n, TOLERANCE);
+        sprintf(name, "rta_fft_complex %s%u stride %d (im)",
+                (inverse ? "inverse " : ""), n, stride);
+        sprintf(path, "rta_fft_complex/output_%s%u_im.txt",
+                (inverse ? "inverse_" : ""), n);
+        ret &= compare(name, output_im, 1, path, n, TOLERANCE);
+      }
+    }
+  }
+  return ret;
+}
+
+/* rta_fft: real transform of 2048 points */
+static int test_fft_real(void)
+{
+  const unsigned int n = 2048;
+  rta_real_t * input = malloc(n * sizeof(rta_real_t));
+  rta_complex_t * output = malloc(n / 2 * sizeof(rta_complex_t));
+  rta_real_t * output_re = malloc((n / 2 + 1) * sizeof(rta_real_t));
+  rta_real_t * output_im = malloc(n / 2 * sizeof(rta_real_t));
+  rta_real_t scale = 1.;
+  rta_real_t nyquist;
+  rta_fft_setup_t * setup;
+  int ret = input != NULL && output != NULL
+    && output_re != NULL && output_im != NULL
+    && read_values("rta_fft/input.txt", input, n)
+    && rta_fft_real_setup_new(&setup, rta_fft_real_to_complex_1d, &scale,
+                              input, n, output, n, &nyquist);
+
+  if(ret != 0)
+  {
+    rta_fft_real_execute(output, input, n, setup, &nyquist);
+    rta_fft_setup_delete(setup);
+
+    complex_split(output_re, output_im, output, n / 2);
+    output_re[n / 2] = nyquist;
+    /* the imaginary part of the first point is 0 */
+    ret = compare("rta_fft real 2048 (re)", output_re, 1,
+                  "rta_fft/output_re.txt", n / 2 + 1, TOLERANCE)
+      & compare("rta_fft real 2048 (im)", output_im, 1,
+                "rta_fft/output_im.txt", n / 2, TOLERANCE);
+  }
+
+  free(input);
+  free(output);
+  free(output_re);
+  free(output_im);
+  return ret;
+}
+
+/* rta_fft: complex transform of the 2048 real points, out of place,
+ * by the Stockham passes (RTA_FFT_STOCKHAM_MIN_SIZE of the compile
+ * line), and its inverse back to the input */
+static int test_fft_stockham(void)
+{
+  const unsigned int n = 2048;
+  rta_real_t * input = malloc(n * sizeof(rta_real_t));
+  rta_real_t * zeros = calloc(n, sizeof(rta_real_t));
+  rta_complex_t * samples = malloc(n * sizeof(rta_complex_t));
+  rta_complex_t * spectrum = malloc(n * sizeof(rta_complex_t));
+  rta_real_t * output_re = malloc(n * sizeof(rta_real_t));
+  rta_real_t * output_im = malloc(n * sizeof(rta_real_t));
+  rta_real_t scale = 1.;
+  rta_real_t inverse_scale = 1. / n;
+  rta_fft_setup_t * setup;
+  rta_fft_setup_t * inverse_setup;
+  unsigned int i;
+  int ret = input != NULL && zeros != NULL && samples != NULL
+    && spectrum != NULL && output_re != NULL && output_im != NULL
+    && read_values("rta_fft/input.txt", input, n)
+    && rta_fft_setup_new(&setup, rta_fft_complex_1d, &scale,
+                         samples, n, spectrum, n)
+    && rta_fft_setup_new(&inverse_setup, rta_fft_complex_inverse_1d,
+                         &inverse_scale, spectrum, n, samples, n);
+
+  if(ret != 0)
+  {
+    for(i = 0; i < n; i++)
+    {
+      samples[i] = rta_make_complex(input[i], 0.);
+    }
+
+    rta_fft_execute(spectrum, samples, n, setup);
+    complex_split(output_re, output_im, spectrum, n);
+    ret = compare("rta_fft stockham 2048 (re)", output_re, 1,
+                  "rta_fft/output_re.txt", n, TOLERANCE)
+      & compare("rta_fft stockham 2048 (im)", output_im, 1,
+                "rta_fft/output_im.txt", n, TOLERANCE);
+
+    rta_fft_execute(samples, spectrum, n, inverse_setup);
+    complex_split(output_re, output_im, samples, n);
+    ret &= compare_values("rta_fft stockham inverse 2048 (re)", output_re, 1,
+                          input, n, TOLERANCE)
+      & compare_values("rta_fft stockham inverse 2048 (im)", output_im, 1,
+                       zeros, n, TOLERANCE);
+
+    rta_fft_setup_delete(setup);
+    rta_fft_setup_delete(inverse_setup);
+  }
+
+  free(input);
+  free(zeros);
+  free(samples);
+  free(spectrum);
+  free(output_re);
+  free(output_im);
+  return ret;
+}
+
+/* rta_fft: complex transform of the 2048 real points, in place and out
+ * of place, by the four-step transform on 2 and 3 threads
+ * (RTA_FFT_FOUR_STEP_MIN_SIZE of the compile line), and its inverse
+ * back to the input */
+static int test_fft_four_step(void)
+{
+  const unsigned int n = 2048;
+  const unsigned int threads[] = {2, 3};
+  rta_real_t * input = malloc(n * sizeof(rta_real_t));
+  rta_real_t * zeros = calloc(n, sizeof(rta_real_t));
+  rta_complex_t * samples = malloc(n * sizeof(rta_complex_t));
+  rta_complex_t * spectrum = malloc(n * sizeof(rta_complex_t));
+  rta_real_t * output_re = malloc(n * sizeof(rta_real_t));
+  rta_real_t * output_im = malloc(n * sizeof(rta_real_t));
+  rta_real_t scale = 1.;
+  rta_real_t inverse_scale = 1. / n;
+  char name[64];
+  unsigned int t, i;
+  int in_place;
+  int ret = input != NULL && zeros != NULL && samples != NULL
+    && spectrum != NULL && output_re != NULL && output_im != NULL
+    && read_values("rta_fft/input.txt", input, n);
+
+  for(t = 0; t < sizeof(threads) / sizeof(threads[0]) && ret != 0; t++)
+  {
+    for(in_place = 0; in_place <= 1 && ret != 0; in_place++)
+    {
+      /* in place in 'spectrum', then in 'samples' for the inverse */
+      rta_complex_t * forward_input = (in_place ? spectrum : samples);
+      rta_complex_t * inverse_input = (in_place ? samples : spectrum);
+      rta_fft_setup_t * setup;
+      rta_fft_setup_t * inverse_setup;
+
+      if(rta_fft_setup_new(&setup, rta_fft_complex_1d, &scale,
+                           forward_input, n, spectrum, n) == 0 ||
+         rta_fft_setup_threads_set(setup, threads[t]) == 0 ||
+         rta_fft_setup_new(&inverse_setup, rta_fft_complex_inverse_1d,
+                           &inverse_scale, inverse_input, n, samples, n) == 0 ||
+         rta_fft_setup_threads_set(inverse_setup, threads[t]) == 0)
+      {
+        fprintf(stderr, "rta_fft_setup_new failed\n");
+        return 0;
+      }
+
+      for(i = 0; i < n; i++)
+      {
+        forward_input[i] = rta_make_complex(input[i], 0.);
+      }
+
+      rta_fft_execute(spectrum, forward_input, n, setup);
+      complex_split(output_re, output_im, spectrum, n);
+      sprintf(name, "rta_fft four-step 2048 threads %u%s (re)", threads[t],
+              (in_place ? " in place" : ""));
+      ret = compare(name, output_re, 1, "rta_fft/output_re.txt", n,
+                    TOLERANCE);
+      sprintf(name, "rta_fft four-step 2048 threads %u%s (im)", threads[t],
+              (in_place ? " in place" : ""));
+      ret &= compare(name, output_im, 1, "rta_fft/output_im.txt", n,
+                     TOLERANCE);
+
+      if(in_place)
+      {
+        for(i = 0; i < n; i++)
+        {
+          samples[i] = spectrum[i];
+        }
+      }
+
+      rta_fft_execute(samples, inverse_input, n, inverse_setup);
+      complex_split(output_re, output_im, samples, n);
+      sprintf(name, "rta_fft four-step inverse 2048 threads %u%s (re)",
+              threads[t], (in_place ? " in place" : ""));
+      ret &= compare_values(name, output_re, 1, input, n, TOLERANCE);
+      sprintf(name, "rta_fft four-step inverse 2048 threads %u%s (im)",
+              threads[t], (in_place ? " in place" : ""));
+      ret &= compare_values(name, output_im, 1, zeros, n, TOLERANCE);
+
+      rta_fft_setup_delete(setup);
+      rta_fft_setup_delete(inverse_setup);
+    }
+  }
+
+  free(input);
+  free(zeros);
+  free(samples);
+  free(spectrum);
+  free(output_re);
+  free(output_im);
+  return ret;
+}
+
+/* rta_fft_setup_input_pruning_set: the transforms of rta_fft_complex
+ * and rta_fft_real zero-padded to 16 and 8 times their size, whose
+ * bins 16 k and 8 k are the reference bins k, and whose other bins are
+ * those of the transforms without pruning */
+static int test_fft_input_pruning(void)
+{
+  const unsigned int complex_size = 1024;
+  const unsigned int real_size = 512;
+  const unsigned int channels_number = 4;
+  const unsigned int input_size = 48;
+  const unsigned int bins = 64 / 2 + 1;
+  rta_real_t input_re[64];
+  rta_real_t input_im[64];
+  rta_real_t real_input[4 * 48];
+  rta_complex_t samples[1024];
+  rta_complex_t spectrum[1024];
+  rta_real_t frame[512];
+  rta_real_t unpruned[2 * 1024];
+  rta_real_t output_re[4 * 33];
+  rta_real_t output_im[4 * 33];
+  rta_real_t scale = 1.;
+  rta_real_t nyquist;
+  rta_fft_setup_t * setup;
+  char name[64];
+  char path[64];
+  int ret = read_values("rta_fft_complex/input_re.txt", input_re, 64)
+    && read_values("rta_fft_complex/input_im.txt", input_im, 64)
+    && read_values("rta_fft_real/input.txt", real_input,
+                   channels_number * input_size);
+  unsigned int c, i;
+  int inverse;
+
+  for(inverse = 0; inverse <= 1 && ret != 0; inverse++)
+  {
+    if(rta_fft_setup_new(&setup, (inverse ? rta_fft_complex_inverse_1d :
+                                  rta_fft_complex_1d),
+                         &scale, samples, 64, spectrum, complex_size) == 0)
+    {
+      fprintf(stderr, "rta_fft_setup_new failed\n");
+      return 0;
+    }
+
+    for(i = 0; i < 64; i++)
+    {
+      samples[i] = rta_make_complex(input_re[i], input_im[i]);
+    }
+    rta_fft_execute(spectrum, samples, 64, setup);
+    for(i = 0; i < complex_size; i++)
+    {
+      unpruned[2 * i] = rta_creal(spectrum[i]);
+      unpruned[2 * i + 1] = rta_cimag(spectrum[i]);
+    }
+
+    rta_fft_setup_input_pruning_set(setup, 1);
+    rta_fft_execute(spectrum, samples, 64, setup);
+    rta_fft_setup_delete(setup);
+
+    sprintf(name, "rta_fft input pruning %s%u",
+            (inverse ? "inverse " : ""), complex_size);
+    ret &= compare_values(name, (const rta_real_t *) spectrum, 1, unpruned,
+                          2 * complex_size, TOLERANCE);
+
+    for(i = 0; i < 64; i++)
+    {
+      output_re[i] = rta_creal(spectrum[16 * i]);
+      output_im[i] = rta_cimag(spectrum[16 * i]);
+    }
+
+    sprintf(name, "rta_fft input pruning %s%u (re)",
+            (inverse ? "inverse " : ""), complex_size);
+    sprintf(path, "rta_fft_complex/output_%s64_re.txt",
+            (inverse ? "inverse_" : ""));
+    ret &= compare(name, output_re, 1, path, 64, TOLERANCE);
+    sprintf(name, "rta_fft input pruning %s%u (im)",
+            (inverse ? "inverse " : ""), complex_size);
+    sprintf(path, "rta_fft_complex/output_%s64_im.txt",
+            (inverse ? "inverse_" : ""));
+    ret &= compare(name, output_im, 1, path, 64, TOLERANCE);
+  }
+
+  if(ret == 0)
+  {
+    return 0;
+  }
+
+  if(rta_fft_real_setup_new(&setup, rta_fft_real_to_complex_1d, &scale,
+                            real_input, input_size, frame, real_size,
+                            &nyquist) == 0)
+  {
+    fprintf(stderr, "rta_fft_real_setup_new failed\n");
+    return 0;
+  }
+
+  for(c = 0; c < channels_number; c++)
+  {
+    const rta_complex_t * bin = (const rta_complex_t *) frame;
+
+    rta_fft_setup_input_pruning_set(setup, 0);
+    rta_fft_real_execute(unpruned, real_input + c * input_size, input_size,
+                         setup, &nyquist);
+    rta_fft_setup_input_pruning_set(setup, 1);
+    rta_fft_real_execute(frame, real_input + c * input_size, input_size,
+                         setup, &nyquist);
+
+    sprintf(name, "rta_fft input pruning real %u channel %u", real_size, c);
+    ret &= compare_values(name, frame, 1, unpruned, real_size, TOLERANCE);
+
+    for(i = 0; i + 1 < bins; i++)
+    {
+      output_re[c * bins + i] = rta_creal(bin[8 * i]);
+      output_im[c * bins + i] = rta_cimag(bin[8 * i]);
+    }
+    output_re[c * bins + bins - 1] = nyquist;
+    output_im[c * bins + bins - 1] = 0.;
+  }
+  rta_fft_setup_delete(setup);
+
+  sprintf(name, "rta_fft input pruning real %u (re)", real_size);
+  ret &= compare(name, output_re, 1, "rta_fft_real/output_64_re.txt",
+                 channels_number * bins, TOLERANCE);
+  sprintf(name, "rta_fft input pruning real %u (im)", real_size);
+  ret &= compare(name, output_im, 1, "rta_fft_real/output_64_im.txt",
+                 channels_number * bins, TOLERANCE);
+  return ret;
+}
+
+/* rta_fft_setup_output_pruning_set: the first 100 bins of the complex
+ * and real transforms of the 2048 points of rta_fft, and the first 100
+ * samples of their inverses, and the first 64 bins of the transform of
+ * rta_fft_complex zero-padded to 1024, with input pruning too */
+static int test_fft_output_pruning(void)
+{
+  const unsigned int n = 2048;
+  const unsigned int output_size = 100;
+  rta_real_t * input = malloc(n * sizeof(rta_real_t));
+  rta_real_t * zeros = calloc(n, sizeof(rta_real_t));
+  rta_real_t * reference_re = malloc(n * sizeof(rta_real_t));
+  rta_real_t * reference_im = malloc(n * sizeof(rta_real_t));
+  rta_complex_t * samples = malloc(n * sizeof(rta_complex_t));
+  rta_complex_t * spectrum = malloc(n * sizeof(rta_complex_t));
+  rta_real_t * output_re = malloc(n * sizeof(rta_real_t));
+  rta_real_t * output_im = malloc(n * sizeof(rta_real_t));
+  rta_real_t scale = 1.;
+  rta_real_t inverse_scale = 1. / n;
+  rta_real_t nyquist;
+  rta_fft_setup_t * setup;
+  char name[64];
+  unsigned int i;
+  int inverse;
+  int ret = input != NULL && zeros != NULL && reference_re != NULL
+    && reference_im != NULL && samples != NULL && spectrum != NULL
+    && output_re != NULL && output_im != NULL
+    && read_values("rta_fft/input.txt", input, n)
+    && read_values("rta_fft/output_re.txt", reference_re, n)
+    && read_values("rta_fft/output_im.txt", reference_im, n);
+
+  /* complex transforms */
+  for(inverse = 0; inverse <= 1 && ret != 0; inverse++)
+  {
+    ret = rta_fft_setup_new(&setup, (inverse ? rta_fft_complex_inverse_1d :
+                                     rta_fft_complex_1d),
+                            (inverse ? &inverse_scale : &scale),
+                            samples, n, spectrum, n);
+    if(ret != 0)
+    {
+      rta_fft_setup_output_pruning_set(setup, output_size);
+
+      for(i = 0; i < n; i++)
+      {
+        samples[i] = (inverse ?
+                      rta_make_complex(reference_re[i], reference_im[i]) :
+                      rta_make_complex(input[i], 0.));
+      }
+      rta_fft_execute(spectrum, samples, n, setup);
+      rta_fft_setup_delete(setup);
+
+      complex_split(output_re, output_im, spectrum, output_size);
+      sprintf(name, "rta_fft output pruning %s%u (re)",
+              (inverse ? "inverse " : ""), n);
+      ret = compare_values(name, output_re, 1,
+                           (inverse ? input : reference_re), output_size,
+                           TOLERANCE);
+      sprintf(name, "rta_fft output pruning %s%u (im)",
+              (inverse ? "inverse " : ""), n);
+      ret &= compare_values(name, output_im, 1,
+                            (inverse ? zeros : reference_im), output_size,
+                            TOLERANCE);
+    }
+  }
+
+  /* real transform, and its inverse from the reference spectrum */
+  if(ret != 0 &&
+     rta_fft_real_setup_new(&setup, rta_fft_real_to_complex_1d, &scale,
+                            input, n, spectrum, n, &nyquist) != 0)
+  {
+    rta_fft_setup_output_pruning_set(setup, output_size);
+    rta_fft_real_execute(spectrum, input, n, setup, &nyquist);
+    rta_fft_setup_delete(setup);
+
+    complex_split(output_re, output_im, spectrum, output_size);
+    sprintf(name, "rta_fft output pruning real %u (re)", n);
+    ret = compare_values(name, output_re, 1, reference_re, output_size,
+                         TOLERANCE);
+    sprintf(name, "rta_fft output pruning real %u (im)", n);
+    ret &= compare_values(name, output_im, 1, reference_im, output_size,
+                          TOLERANCE);
+    sprintf(name, "rta_fft output pruning real %u nyquist", n);
+    ret &= compare_values(name, &nyquist, 1, reference_re + n / 2, 1,
+                          TOLERANCE);
+
+    for(i = 0; i < n / 2; i++)
+    {
+      spectrum[i] = rta_make_complex(reference_re[i], reference_im[i]);
+    }
+    nyquist = reference_re[n / 2];
+
+    ret &= rta_fft_real_setup_new(&setup, rta_fft_complex_to_real_1d,
+                                  &inverse_scale, spectrum, n / 2,
+                                  output_re, n, &nyquist);
+    if(ret != 0)
+    {
+      rta_fft_setup_output_pruning_set(setup, output_size);
+      rta_fft_real_execute(output_re, spectrum, n / 2, setup, &nyquist);
+      rta_fft_setup_delete(setup);
+
+      sprintf(name, "rta_fft output pruning real inverse %u", n);
+      ret &= compare_values(name, output_re, 1, input, output_size,
+                            TOLERANCE);
+    }
+  }
+
+  /* with input pruning, against the transform without pruning */
+  if(ret != 0)
+  {
+    const unsigned int size = 1024;
+
+    ret = read_values("rta_fft_complex/input_re.txt", output_re, 64)
+      && read_values("rta_fft_complex/input_im.txt", output_im, 64)
+      && rta_fft_setup_new(&setup, rta_fft_complex_1d, &scale,
+                           samples, 64, spectrum, size);
+    if(ret != 0)
+    {
+      for(i = 0; i < 64; i++)
+      {
+        samples[i] = rta_make_complex(output_re[i], output_im[i]);
+      }
+      rta_fft_execute(spectrum, samples, 64, setup);
+      complex_split(reference_re, reference_im, spectrum, 64);
+
+      rta_fft_setup_input_pruning_set(setup, 1);
+      rta_fft_setup_output_pruning_set(setup, 64);
+      rta_fft_execute(spectrum, samples, 64, setup);
+      rta_fft_setup_delete(setup);
+
+      complex_split(output_re, output_im, spectrum, 64);
+      sprintf(name, "rta_fft input and output pruning %u (re)", size);
+      ret = compare_values(name, output_re, 1, reference_re, 64, TOLERANCE);
+      sprintf(name, "rta_fft input and output pruning %u (im)", size);
+      ret &= compare_values(name, output_im, 1, reference_im, 64,
+                            TOLERANCE);
+    }
+  }
+
+  free(input);
+  free(zeros);
+  free(reference_re);
+  free(reference_im);
+  free(samples);
+  free(spectrum);
+  free(output_re);
+  free(output_im);
+  return ret;
+}
+
+/* rta_stft: streaming analysis of 2 channels, by blocks of 7 samples */
+static int test_stft(const rta_stft_t stft_type)
+{
+  const unsigned int window_size = 64;
+  const unsigned int input_size = 256;
+  const unsigned int channels_number = 2;
+  const unsigned int frames_number = 13;
+  const unsigned int frame_size = 65;
+  const unsigned int output_size = frames_number * channels_number * frame_size;
+  rta_real_t window[64];
+  rta_real_t * input = malloc(input_size * channels_number * sizeof(rta_real_t));
+  rta_complex_t * frames = malloc(output_size * sizeof(rta_complex_t));
+  rta_real_t * output_re = malloc(output_size * sizeof(rta_real_t));
+  rta_real_t * output_im = malloc(output_size * sizeof(rta_real_t));
+  rta_stft_setup_t * setup;
+  unsigned int f = 0;
+  unsigned int i = 0;
+  int ret = input != NULL && frames != NULL
+    && output_re != NULL && output_im != NULL
+    && read_values("rta_stft/window.txt", window, window_size)
+    && read_values("rta_stft/input.txt", input, input_size * channels_number)
+    && rta_stft_setup_new(&setup, stft_type, window, window_size, 16, 128,
+                          channels_number)
+    && rta_stft_frame_size(setup) == frame_size;
+
+  while(ret != 0 && i < input_size)
+  {
+    const unsigned int block = (input_size - i < 7 ? input_size - i : 7);
+
+    i += rta_stft_input(setup, input + i * channels_number, block);
+    if(f < frames_number &&
+       rta_stft_output(setup, (stft_type == rta_stft_complex ?
+                               (void *) (frames + f * channels_number * frame_size) :
+                               (void *) (output_re + f * channels_number * frame_size))))
+    {
+      f++;
+    }
+  }
+
+  if(ret != 0)
+  {
+    rta_stft_setup_delete(setup);
+
+    if(stft_type == rta_stft_complex)
+    {
+      complex_split(output_re, output_im, frames, output_size);
+      ret = compare("rta_stft complex (re)", output_re, 1,
+                    "rta_stft/output_re.txt", output_size, TOLERANCE)
+        & compare("rta_stft complex (im)", output_im, 1,
+                  "rta_stft/output_im.txt", output_size, TOLERANCE);
+    }
+    else
+    {
+      ret = compare("rta_stft magnitude", output_re, 1,
+                    "rta_stft/output_magnitude.txt", output_size, TOLERANCE);
+    }
+    ret &= (f == frames_number);
+  }
+
+  free(input);
+  free(frames);
+  free(output_re);
+  free(output_im);
+  return ret;
+}
+
+/* rta_istft: overlap-add of the reference frames of rta_stft */
+static int test_istft(void)
+{
+  const unsigned int window_size = 64;
+  const unsigned int hop_size = 16;
+  const unsigned int channels_number = 2;
+  const unsigned int frames_number = 13;
+  const unsigned int frame_size = 65;
+  const unsigned int input_size = frames_number * channels_number * frame_size;
+  const unsigned int output_size = frames_number * hop_size;
+  rta_real_t window[64];
+  rta_real_t * input_re = malloc(input_size * sizeof(rta_real_t));
+  rta_real_t * input_im = malloc(input_size * sizeof(rta_real_t));
+  rta_complex_t * frames = malloc(input_size * sizeof(rta_complex_t));
+  rta_real_t * output = malloc(output_size * channels_number * sizeof(rta_real_t));
+  rta_istft_setup_t * setup;
+  unsigned int f = 0;
+  unsigned int o = 0;
+  unsigned int i;
+  int ret = input_re != NULL && input_im != NULL
+    && frames != NULL && output != NULL
+    && read_values("rta_stft/window.txt", window, window_size)
+    && read_values("rta_stft/output_re.txt", input_re, input_size)
+    && read_values("rta_stft/output_im.txt", input_im, input_size)
+    && rta_istft_setup_new(&setup, window, window, window_size, hop_size, 128,
+                           channels_number);
+
+  if(ret != 0)
+  {
+    for(i = 0; i < input_size; i++)
+    {
+      frames[i] = rta_make_complex(input_re[i], input_im[i]);
+    }
+
+    /* pull by blocks of 5 samples */
+    while(o < output_size)
+    {
+      const unsigned int block = (output_size - o < 5 ? output_size - o : 5);
+
+      o += rta_istft_output(setup, output + o * channels_number, block);
+      if(o < output_size && f < frames_number &&
+         rta_istft_input(setup, frames + f * channels_number * frame_size))
+      {
+        f++;
+      }
+    }
+    rta_istft_setup_delete(setup);
+
+    ret = compare("rta_istft", output, 1, "rta_istft/output.txt",
+                  output_size * channels_number, TOLERANCE);
+  }
+
+  free(input_re);
+  free(input_im);
+  free(frames);
+  free(output);
+  return ret;
+}
+
+/* rta_convolution: 2 channels with their own filter, in place */
+static int test_convolution(void)
+{
+  const unsigned int filter_size = 300;
+  const unsigned int block_size = 64;
+  const unsigned int channels_number = 2;
+  const unsigned int input_size = 1024 * channels_number;
+  rta_real_t * filters = malloc(2 * filter_size * sizeof(rta_real_t));
+  rta_real_t * signal = malloc(input_size * sizeof(rta_real_t));
+  rta_convolution_setup_t * setup;
+  unsigned int i;
+  int ret = filters != NULL && signal != NULL
+    && read_values("rta_convolution/filters.txt", filters, 2 * filter_size)
+    && read_values("rta_convolution/input.txt", signal, input_size)
+    && rta_convolution_setup_new(&setup, filters, filter_size, 2, block_size,
+                                 channels_number);
+
+  if(ret != 0)
+  {
+    for(i = 0; i < input_size; i += block_size * channels_number)
+    {
+      rta_convolution_execute(signal + i, signal + i, setup);
+    }
+    rta_convolution_setup_delete(setup);
+
+    ret = compare("rta_convolution", signal, 1, "rta_convolution/output.txt",
+                  input_size, TOLERANCE);
+  }
+
+  free(filters);
+  free(signal);
+  return ret;
+}
+
+/* rta_convolution_nonuniform: 2 channels with the same filter, with
+ * the tail stages in the caller thread or in background */
+static int test_convolution_nonuniform(const int background)
+{
+  const unsigned int filter_size = 2000;
+  const unsigned int block_size = 32;
+  const unsigned int channels_number = 2;
+  const unsigned int input_size = 4096 * channels_number;
+  rta_real_t * filter = malloc(filter_size * sizeof(rta_real_t));
+  rta_real_t * input = malloc(input_size * sizeof(rta_real_t));
+  rta_real_t * output = malloc(input_size * sizeof(rta_real_t));
+  rta_convolution_nonuniform_setup_t * setup;
+  unsigned int i;
+  int ret = filter != NULL && input != NULL && output != NULL
+    && read_values("rta_convolution_nonuniform/filter.txt", filter, filter_size)
+    && read_values("rta_convolution_nonuniform/input.txt", input, input_size)
+    && rta_convolution_nonuniform_setup_new(&setup, filter, filter_size, 1,
+                                            block_size, channels_number,
+                                            background);
+
+  if(ret != 0)
+  {
+    for(i = 0; i < input_size; i += block_size * channels_number)
+    {
+      rta_convolution_nonuniform_execute(output + i, input + i, setup);
+    }
+    rta_convolution_nonuniform_setup_delete(setup);
+
+    ret = compare((background ? "rta_convolution_nonuniform background" :
+                   "rta_convolution_nonuniform"), output, 1,
+                  "rta_convolution_nonuniform/output.txt", input_size,
+                  TOLERANCE);
+  }
+
+  free(filter);
+  free(input);
+  free(output);
+  return ret;
+}
+
+/* rta_correlation: FFT correlations with a setup of 64 and 256
+ * values, and calls exceeding these sizes, which fall back to the
+ * direct algorithms */
+static int test_correlation(void)
+{
+  const unsigned int input_size = 4096;
+  rta_real_t * a = malloc(input_size * sizeof(rta_real_t));
+  rta_real_t * b = malloc(input_size * sizeof(rta_real_t));
+  rta_real_t * correlation = malloc(1024 * sizeof(rta_real_t));
+  rta_correlation_setup_t * setup;
+  int ret = a != NULL && b != NULL && correlation != NULL
+    && read_values("rta_correlation/input_a.txt", a, input_size)
+    && read_values("rta_correlation/input_b.txt", b, input_size)
+    && rta_correlation_setup_new(&setup, 64, 256);
+
+  if(ret != 0)
+  {
+    rta_correlation_fast_fft(correlation, 64, a, b, 256, setup);
+    ret &= compare("rta_correlation_fast_fft 64 256", correlation, 1,
+                   "rta_correlation/output_fast_64_256.txt", 64, TOLERANCE);
+    rta_correlation_raw_fft(correlation, 64, a, b, 256, setup);
+    ret &= compare("rta_correlation_raw_fft 64 256", correlation, 1,
+                   "rta_correlation/output_raw_64_256.txt", 64, TOLERANCE);
+    rta_correlation_unbiased_fft(correlation, 64, a, b, 256, setup);
+    ret &= compare("rta_correlation_unbiased_fft 64 256", correlation, 1,
+                   "rta_correlation/output_unbiased_64_256.txt", 64,
+                   TOLERANCE);
+
+    /* oversized calls */
+    rta_correlation_fast_fft(correlation, 1024, a, b, 3072, setup);
+    ret &= compare("rta_correlation_fast_fft 1024 3072", correlation, 1,
+                   "rta_correlation/output_fast_1024_3072.txt", 1024,
+                   TOLERANCE);
+    rta_correlation_raw_fft(correlation, 1024, a, b, 4096, setup);
+    ret &= compare("rta_correlation_raw_fft 1024 4096", correlation, 1,
+                   "rta_correlation/output_raw_1024_4096.txt", 1024,
+                   TOLERANCE);
+    rta_correlation_unbiased_fft(correlation, 1024, a, b, 4096, setup);
+    ret &= compare("rta_correlation_unbiased_fft 1024 4096", correlation, 1,
+                   "rta_correlation/output_unbiased_1024_4096.txt", 1024,
+                   TOLERANCE);
+    rta_correlation_setup_delete(setup);
+  }
+
+  free(a);
+  free(b);
+  free(correlation);
+  return ret;
+}
+
+/* rta_fft_real: real transforms of 4 channels, zero-padded from 48
+ * samples, as a batch */
+static int test_fft_real_batch(void)
+{
+  const unsigned int sizes[] = {64, 96};
+  const unsigned int channels_number = 4;
+  const unsigned int input_size = 48;
+  rta_real_t input[4 * 48];
+  rta_real_t frames[4 * 96];
+  rta_real_t nyquists[4];
+  rta_real_t output_re[4 * 49];
+  rta_real_t output_im[4 * 49];
+  rta_real_t scale = 1.;
+  char name[64];
+  char path[64];
+  int ret = read_values("rta_fft_real/input.txt", input,
+                        channels_number * input_size);
+  unsigned int s, c, i;
+
+  for(s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && ret != 0; s++)
+  {
+    const unsigned int n = sizes[s];
+    rta_fft_setup_t * setup;
+
+    for(c = 0; c < channels_number; c++)
+    {
+      for(i = 0; i < input_size; i++)
+      {
+        frames[c * n + i] = input[c * input_size + i];
+      }
+    }
+
+    if(rta_fft_real_setup_new(&setup, rta_fft_real_to_complex_1d, &scale,
+                              frames, input_size, frames, n, nyquists) == 0)
+    {
+      fprintf(stderr, "rta_fft_real_setup_new failed\n");
+      return 0;
+    }
+    rta_fft_real_execute_batch(frames, frames, input_size, channels_number, n,
+                               setup, nyquists);
+    rta_fft_setup_delete(setup);
+
+    spectra_split(output_re, output_im, frames, n, nyquists,
+                  channels_number, n);
+    sprintf(name, "rta_fft_real_execute_batch %u (re)", n);
+    sprintf(path, "rta_fft_real/output_%u_re.txt", n);
+    ret &= compare(name, output_re, 1, path, channels_number * (n / 2 + 1),
+                   TOLERANCE);
+    sprintf(name, "rta_fft_real_execute_batch %u (im)", n);
+    sprintf(path, "rta_fft_real/output_%u_im.txt", n);
+    ret &= compare(name, output_im, 1, path, channels_number * (n / 2 + 1),
+                   TOLERANCE);
+  }
+  return ret;
+}
+
+/* rta_fft_execute_batch and rta_fft_real_execute_batch: channels c of
+ * rta_fft_complex times c + 1, and channels c modulo 4 of rta_fft_real,
+ * with a channel stride bigger than the transform, on 1 and 2 threads,
+ * compared with rta_fft_execute of each channel and with the reference
+ * data. The 11 channels make 3 tiles, and a last real one alone after
+ * 5 pairs. */
+static int test_fft_batch(void)
+{
+  const unsigned int complex_sizes[] = {8, 64};
+  const unsigned int real_sizes[] = {64, 96};
+  const unsigned int threads[] = {1, 2};
+  const unsigned int channels_number = 11;
+  const unsigned int real_channels = 4;
+  const unsigned int input_size = 48;
+  rta_real_t input_re[64];
+  rta_real_t input_im[64];
+  rta_real_t real_input[4 * 48];
+  rta_complex_t inputs[11 * 67];
+  rta_complex_t outputs[11 * 67];
+  rta_complex_t single[64];
+  rta_real_t real_inputs[11 * 98];
+  rta_real_t frames[11 * 98];
+  rta_real_t nyquists[11];
+  rta_real_t nyquist;
+  rta_real_t output_re[11 * 64];
+  rta_real_t output_im[11 * 64];
+  rta_real_t reference_re[11 * 64];
+  rta_real_t reference_im[11 * 64];
+  rta_real_t scale = 1.;
+  char name[80];
+  char path[64];
+  int ret = read_values("rta_fft_complex/input_re.txt", input_re, 64)
+    && read_values("rta_fft_complex/input_im.txt", input_im, 64)
+    && read_values("rta_fft_real/input.txt", real_input,
+                   real_channels * input_size);
+  unsigned int s, t, c, i;
+  int inverse, pairs;
+
+  /* complex transforms, with 'n' + 3 points by channel */
+  for(s = 0; s < sizeof(complex_sizes) / sizeof(complex_sizes[0]) && ret != 0;
+      s++)
+  {
+    for(inverse = 0; inverse <= 1 && ret != 0; inverse++)
+    {
+      const unsigned int n = complex_sizes[s];
+      const unsigned int stride = n + 3;
+
+      sprintf(path, "rta_fft_complex/output_%s%u_re.txt",
+              (inverse ? "inverse_" : ""), n);
+      ret = read_values(path, reference_re, n);
+      sprintf(path, "rta_fft_complex/output_%s%u_im.txt",
+              (inverse ? "inverse_" : ""), n);
+      ret &= read_values(path, reference_im, n);
+
+      for(c = 1; c < channels_number; c++)
+      {
+        for(i = 0; i < n; i++)
+        {
+          reference_re[c * n + i] = reference_re[i];
+          reference_im[c * n + i] = reference_im[i];
+        }
+      }
+
+      for(c = 0; c < channels_number; c++)
+      {
+        for(i = 0; i < n; i++)
+        {
+          inputs[c * stride + i] = rta_make_complex(
+            (c + 1) * input_re[i], (c + 1) * input_im[i]);
+        }
+      }
+
+      for(t = 0; t < sizeof(threads) / sizeof(threads[0]) && ret != 0; t++)
+      {
+        double error = 0.;
+        rta_fft_setup_t * setup;
+
+        if(rta_fft_setup_new(&setup, (inverse ? rta_fft_complex_inverse_1d :
+                                      rta_fft_complex_1d),
+                             &scale, inputs, n, outputs, n) == 0 ||
+           rta_fft_setup_threads_set(setup, threads[t]) == 0)
+        {
+          fprintf(stderr, "rta_fft_setup_new failed\n");
+          return 0;
+        }
+        rta_fft_execute_batch(outputs, inputs, n, channels_number, stride,
+                              setup);
+
+        for(c = 0; c < channels_number; c++)
+        {
+          rta_fft_execute(single, inputs + c * stride, n, setup);
+          for(i = 0; i < n; i++)
+          {
+            const rta_complex_t z = outputs[c * stride + i];
+
+            error = fmax(error, fabs(rta_creal(z) - rta_creal(single[i])));
+            error = fmax(error, fabs(rta_cimag(z) - rta_cimag(single[i])));
+            output_re[c * n + i] = rta_creal(z) / (c + 1);
+            output_im[c * n + i] = rta_cimag(z) / (c + 1);
+          }
+        }
+        rta_fft_setup_delete(setup);
+
+        /* same passes as a single channel */
+        sprintf(name, "rta_fft_execute_batch %s%u threads %u",
+                (inverse ? "inverse " : ""), n, threads[t]);
+        printf("%-40s %-4s (error %g)\n", name,
+               (error == 0. ? "ok" : "FAIL"), error);
+        ret &= (error == 0.);
+
+        sprintf(name, "rta_fft_execute_batch %s%u threads %u (re)",
+                (inverse ? "inverse " : ""), n, threads[t]);
+        ret &= compare_values(name, output_re, 1, reference_re,
+                              channels_number * n, TOLERANCE);
+        sprintf(name, "rta_fft_execute_batch %s%u threads %u (im)",
+                (inverse ? "inverse " : ""), n, threads[t]);
+        ret &= compare_values(name, output_im, 1, reference_im,
+                              channels_number * n, TOLERANCE);
+      }
+    }
+  }
+
+  /* real transforms, out of place, with 'n' + 2 values by channel, or
+   * 'n' for the pairs */
+  for(s = 0; s < sizeof(real_sizes) / sizeof(real_sizes[0]) && ret != 0; s++)
+  {
+    const unsigned int n = real_sizes[s];
+    const unsigned int bins = n / 2 + 1;
+
+    sprintf(path, "rta_fft_real/output_%u_re.txt", n);
+    ret = read_values(path, reference_re, real_channels * bins);
+    sprintf(path, "rta_fft_real/output_%u_im.txt", n);
+    ret &= read_values(path, reference_im, real_channels * bins);
+
+    for(c = real_channels; c < channels_number; c++)
+    {
+      for(i = 0; i < bins; i++)
+      {
+        reference_re[c * bins + i] =
+          reference_re[(c % real_channels) * bins + i];
+        reference_im[c * bins + i] =
+          reference_im[(c % real_channels) * bins + i];
+      }
+    }
+
+    for(t = 0; t < sizeof(threads) / sizeof(threads[0]) && ret != 0; t++)
+    {
+      for(pairs = 0; pairs <= 1 && ret != 0; pairs++)
+      {
+        const unsigned int stride = (pairs ? n : n + 2);
+        double error = 0.;
+        rta_fft_setup_t * setup;
+
+        for(c = 0; c < channels_number; c++)
+        {
+          for(i = 0; i < input_size; i++)
+          {
+            real_inputs[c * stride + i] =
+              real_input[(c % real_channels) * input_size + i];
+          }
+        }
+
+        if(rta_fft_real_setup_new(&setup, rta_fft_real_to_complex_1d, &scale,
+                                  real_inputs, input_size, frames, n,
+                                  nyquists) == 0 ||
+           rta_fft_setup_threads_set(setup, threads[t]) == 0 ||
+           rta_fft_setup_real_pairs_set(setup, pairs) == 0)
+        {
+          fprintf(stderr, "rta_fft_real_setup_new failed\n");
+          return 0;
+        }
+        rta_fft_real_execute_batch(frames, real_inputs, input_size,
+                                   channels_number, stride, setup, nyquists);
+
+        /* the pairs are rounded differently */
+        rta_fft_setup_real_pairs_set(setup, 0);
+        for(c = 0; c < channels_number; c++)
+        {
+          const rta_real_t * spectrum = frames + c * stride;
+
+          rta_fft_real_execute(single, real_inputs + c * stride, input_size,
+                               setup, &nyquist);
+          for(i = 0; i < n / 2; i++)
+          {
+            error = fmax(error, fabs(spectrum[2 * i] - rta_creal(single[i])));
+            error = fmax(error,
+                         fabs(spectrum[2 * i + 1] - rta_cimag(single[i])));
+          }
+          error = fmax(error, fabs(nyquists[c] - nyquist));
+        }
+        rta_fft_setup_delete(setup);
+
+        sprintf(name, "rta_fft_real_execute_batch %u threads %u%s",
+                n, threads[t], (pairs ? " pairs" : ""));
+        printf("%-40s %-4s (error %g)\n", name,
+               (error <= (pairs ? TOLERANCE : 0.) ? "ok" : "FAIL"), error);
+        ret &= (error <= (pairs ? TOLERANCE : 0.));
+
+        spectra_split(output_re, output_im, frames, stride, nyquists,
+                      channels_number, n);
+        sprintf(name, "rta_fft_real_execute_batch %u threads %u%s (re)",
+                n, threads[t], (pairs ? " pairs" : ""));
+        ret &= compare_values(name, output_re, 1, reference_re,
+                              channels_number * bins, TOLERANCE);
+        sprintf(name, "rta_fft_real_execute_batch %u threads %u%s (im)",
+                n, threads[t], (pairs ? " pairs" : ""));
+        ret &= compare_values(name, output_im, 1, reference_im,
+                              channels_number * bins, TOLERANCE);
+      }
+    }
+  }
+  return ret;
+}
+
+/* rta_fft_split: complex transforms of rta_fft_complex, and real
+ * transforms of the first channel of rta_fft_real, in split format */
+static int test_fft_split(void)
+{
+  const unsigned int complex_sizes[] = {8, 64};
+  const unsigned int real_sizes[] = {64, 96};
+  rta_real_t input_re[64];
+  rta_real_t input_im[64];
+  rta_real_t output_re[96];
+  rta_real_t output_im[96];
+  rta_real_t scale = 1.;
+  rta_real_t nyquist;
+  char name[64];
+  char path[64];
+  int ret = read_values("rta_fft_complex/input_re.txt", input_re, 64)
+    && read_values("rta_fft_complex/input_im.txt", input_im, 64);
+  unsigned int s;
+
+  for(s = 0; s < sizeof(complex_sizes) / sizeof(complex_sizes[0]) && ret != 0;
+      s++)
+  {
+    const unsigned int n = complex_sizes[s];
+    rta_fft_setup_t * setup;
+
+    if(rta_fft_split_setup_new(&setup, rta_fft_complex_1d, &scale, n, n,
+                               NULL) == 0)
+    {
+      fprintf(stderr, "rta_fft_split_setup_new failed\n");
+      return 0;
+    }
+    rta_fft_split_execute(output_re, output_im, input_re, input_im, n, setup);
+    rta_fft_setup_delete(setup);
+
+    sprintf(name, "rta_fft_split_execute %u (re)", n);
+    sprintf(path, "rta_fft_complex/output_%u_re.txt", n);
+    ret &= compare(name, output_re, 1, path, n, TOLERANCE);
+    sprintf(name, "rta_fft_split_execute %u (im)", n);
+    sprintf(path, "rta_fft_complex/output_%u_im.txt", n);
+    ret &= compare(name, output_im, 1, path, n, TOLERANCE);
+  }
+
+  ret = ret && read_values("rta_fft_real/input.txt", input_re, 48);
+  for(s = 0; s < sizeof(real_sizes) / sizeof(real_sizes[0]) && ret != 0; s++)
+  {
+    const unsigned int n = real_sizes[s];
+    rta_fft_setup_t * setup;
+
+    if(rta_fft_split_setup_new(&setup, rta_fft_real_to_complex_1d, &scale,
+                               48, n, &nyquist) == 0)
+    {
+      fprintf(stderr, "rta_fft_split_setup_new failed\n");
+      return 0;
+    }
+    rta_fft_split_real_execute(output_re, output_im, input_re, NULL, 48,
+                               setup, &nyquist);
+    rta_fft_setup_delete(setup);
+
+    output_re[n / 2] = nyquist;
+    output_im[n / 2] = 0.;
+    sprintf(name, "rta_fft_split_real_execute %u (re)", n);
+    sprintf(path, "rta_fft_real/output_%u_re.txt", n);
+    ret &= compare(name, output_re, 1, path, n / 2 + 1, TOLERANCE);
+    sprintf(name, "rta_fft_split_real_execute %u (im)", n);
+    sprintf(path, "rta_fft_real/output_%u_im.txt", n);
+    ret &= compare(name, output_im, 1, path, n / 2 + 1, TOLERANCE);
+  }
+  return ret;
+}
+
+/* rta_fft_real_execute_pair: real transforms of the channels of
+ * rta_fft_real two by two, with and without the pair transform */
+static int test_fft_real_pair(void)
+{
+  const unsigned int sizes[] = {64, 96};
+  const unsigned int channels_number = 4;
+  const unsigned int input_size = 48;
+  rta_real_t input[4 * 48];
+  rta_real_t spectra[4 * 96];
+  rta_real_t nyquists[4];
+  rta_real_t output_re[4 * 49];
+  rta_real_t output_im[4 * 49];
+  rta_real_t scale = 1.;
+  char name[64];
+  char path[64];
+  int ret = read_values("rta_fft_real/input.txt", input,
+                        channels_number * input_size);
+  unsigned int s, c;
+  int pairs;
+
+  for(s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && ret != 0; s++)
+  {
+    for(pairs = 0; pairs <= 1; pairs++)
+    {
+      const unsigned int n = sizes[s];
+      rta_fft_setup_t * setup;
+
+      if(rta_fft_real_setup_new(&setup, rta_fft_real_to_complex_1d, &scale,
+                                input, input_size, spectra, n,
+                                nyquists) == 0 ||
+         rta_fft_setup_real_pairs_set(setup, pairs) == 0)
+      {
+        fprintf(stderr, "rta_fft_setup_real_pairs_set failed\n");
+        return 0;
+      }
+      for(c = 0; c < channels_number; c += 2)
+      {
+        rta_fft_real_execute_pair(spectra + c * n, input + c * input_size,
+                                  input + (c + 1) * input_size, input_size,
+                                  setup, nyquists + c, nyquists + c + 1);
+      }
+      rta_fft_setup_delete(setup);
+
+      spectra_split(output_re, output_im, spectra, n, nyquists,
+                    channels_number, n);
+      sprintf(name, "rta_fft_real_execute_pair %u%s (re)", n,
+              (pairs ? " pairs" : ""));
+      sprintf(path, "rta_fft_real/output_%u_re.txt", n);
+      ret &= compare(name, output_re, 1, path, channels_number * (n / 2 + 1),
+                     TOLERANCE);
+      sprintf(name, "rta_fft_real_execute_pair %u%s (im)", n,
+              (pairs ? " pairs" : ""));
+      sprintf(path, "rta_fft_real/output_%u_im.txt", n);
+      ret &= compare(name, output_im, 1, path, channels_number * (n / 2 + 1),
+                     TOLERANCE);
+    }
+  }
+  return ret;
+}
+
+/* rta_sdft: bins after irregular blocks of input, across several
+ * exact recomputations, and Goertzel power at any frequencies */
+static int test_sdft(void)
+{
+  const unsigned int bins[] = {0, 1, 5, 17, 31, 32, 63};
+  const unsigned int bins_number = sizeof(bins) / sizeof(bins[0]);
+  const unsigned int blocks[] = {1, 37, 100, 64, 250};
+  const unsigned int outputs[] = {50, 1000, 3000};
+  const unsigned int input_size = 3000;
+  const unsigned int frequencies_number = 21;
+  rta_real_t * input = malloc(input_size * sizeof(rta_real_t));
+  rta_complex_t bins_output[7];
+  rta_real_t output_re[7];
+  rta_real_t output_im[7];
+  rta_real_t magnitude[7];
+  rta_real_t frequencies[21];
+  rta_real_t weights[2 * 21];
+  rta_real_t power[21];
+  rta_sdft_setup_t * setup;
+  char name[64];
+  char path[64];
+  unsigned int done = 0;
+  unsigned int b = 0;
+  unsigned int o;
+  int ret = input != NULL
+    && read_values("rta_sdft/input.txt", input, input_size)
+    && read_values("rta_sdft/frequencies.txt", frequencies,
+                   frequencies_number)
+    && rta_sdft_setup_new(&setup, 64, bins, bins_number);
+
+  if(ret != 0)
+  {
+    for(o = 0; o < sizeof(outputs) / sizeof(outputs[0]); o++)
+    {
+      while(done < outputs[o])
+      {
+        const unsigned int size = (outputs[o] - done < blocks[b] ?
+                                   outputs[o] - done : blocks[b]);
+
+        rta_sdft_input(setup, input + done, size);
+        done += size;
+        b = (b + 1) % (sizeof(blocks) / sizeof(blocks[0]));
+      }
+
+      rta_sdft_output(setup, bins_output);
+      complex_split(output_re, output_im, bins_output, bins_number);
+      rta_sdft_output_magnitude(setup, magnitude);
+
+      sprintf(name, "rta_sdft %u (re)", done);
+      sprintf(path, "rta_sdft/output_%u_re.txt", done);
+      ret &= compare(name, output_re, 1, path, bins_number, TOLERANCE);
+      sprintf(name, "rta_sdft %u (im)", done);
+      sprintf(path, "rta_sdft/output_%u_im.txt", done);
+      ret &= compare(name, output_im, 1, path, bins_number, TOLERANCE);
+      sprintf(name, "rta_sdft %u magnitude", done);
+      sprintf(path, "rta_sdft/output_%u_magnitude.txt", done);
+      ret &= compare(name, magnitude, 1, path, bins_number, TOLERANCE);
+    }
+    rta_sdft_setup_delete(setup);
+
+    rta_goertzel_weights(weights, frequencies, frequencies_number);
+    rta_goertzel_power(power, input, 256, weights, frequencies_number);
+    ret &= compare("rta_goertzel_power", power, 1,
+                   "rta_sdft/output_goertzel.txt", frequencies_number,
+                   TOLERANCE);
+  }
+
+  free(input);
+  return ret;
+}
+
+/* rta_cqt: 4 octaves, without decimation and with a null threshold,
+ * then with decimation, at the tolerances documented in rta_cqt.h */
+static int test_cqt(void)
+{
+  const unsigned int bins_number = 48;
+  const unsigned int frame_size = 2048;
+  const double tolerances[] = {1e-4, 3e-2};
+  rta_real_t * frame = malloc(frame_size * sizeof(rta_real_t));
+  rta_complex_t cqt[48];
+  rta_real_t output_re[48];
+  rta_real_t output_im[48];
+  rta_real_t magnitude[48];
+  char name[64];
+  int ret = frame != NULL
+    && read_values("rta_cqt/input.txt", frame, frame_size);
+  int decimation;
+
+  for(decimation = 0; decimation <= 1 && ret != 0; decimation++)
+  {
+    rta_cqt_setup_t * setup;
+
+    if(rta_cqt_setup_new(&setup, 8000., 100., 12, bins_number,
+                         (decimation ? 0.0054 : 0.), decimation) == 0 ||
+       rta_cqt_frame_size(setup) != frame_size)
+    {
+      fprintf(stderr, "rta_cqt_setup_new failed\n");
+      free(frame);
+      return 0;
+    }
+
+    rta_cqt(cqt, frame, setup);
+    complex_split(output_re, output_im, cqt, bins_number);
+    rta_cqt_magnitude(magnitude, frame, setup);
+    rta_cqt_setup_delete(setup);
+
+    sprintf(name, "rta_cqt%s (re)", (decimation ? " decimation" : ""));
+    ret &= compare(name, output_re, 1, "rta_cqt/output_re.txt",
+                   bins_number, tolerances[decimation]);
+    sprintf(name, "rta_cqt%s (im)", (decimation ? " decimation" : ""));
+    ret &= compare(name, output_im, 1, "rta_cqt/output_im.txt",
+                   bins_number, tolerances[decimation]);
+    sprintf(name, "rta_cqt_magnitude%s", (decimation ? " decimation" : ""));
+    ret &= compare(name, magnitude, 1, "rta_cqt/output_magnitude.txt",
+                   bins_number, tolerances[decimation]);
+  }
+
+  free(frame);
+  return ret;
+}
+
+/* rta_mfcc: HTK like MFCC of 4 frames, and Auditory Toolbox like MFCC
+ * of one frame with a FFT of 480 points */
+static int test_mfcc(void)
+{
+  const unsigned int frame_size = 400;
+  const unsigned int hop_size = 160;
+  const unsigned int frames_number = 4;
+  const unsigned int input_size = (frames_number - 1) * hop_size + frame_size;
+  rta_real_t * input = malloc(input_size * sizeof(rta_real_t));
+  rta_real_t mfcc[4 * 13];
+  rta_real_t previous_sample = 0.;
+  rta_mfcc_setup_t * setup;
+  int ret = input != NULL
+    && read_values("rta_mfcc/input.txt", input, input_size)
+    && rta_mfcc_setup_new(&setup, frame_size, 512, 16000., 0.97, NULL,
+                          26, 0., 8000., rta_mel_htk,
+                          rta_bands_abs_integration, 13, rta_dct_htk,
+                          22., rta_lifter_sinusoidal);
+
+  if(ret != 0)
+  {
+    rta_mfcc_frames(mfcc, input, frames_number, hop_size, &previous_sample,
+                    setup);
+    rta_mfcc_setup_delete(setup);
+
+    ret &= compare("rta_mfcc_frames htk", mfcc, 1, "rta_mfcc/output_htk.txt",
+                   frames_number * 13, TOLERANCE);
+    ret &= (previous_sample == input[frames_number * hop_size - 1]);
+
+    ret = ret
+      && rta_mfcc_setup_new(&setup, frame_size, 480, 16000., 0., NULL,
+                            40, 133.33, 6855.5, rta_mel_slaney,
+                            rta_bands_square_abs_integration, 20,
+                            rta_dct_slaney, 0.6, rta_lifter_exponential);
+    if(ret != 0)
+    {
+      rta_mfcc(mfcc, input + hop_size, input[hop_size - 1], setup);
+      rta_mfcc_setup_delete(setup);
+
+      ret &= compare("rta_mfcc slaney 480", mfcc, 1,
+                     "rta_mfcc/output_slaney_480.txt", 20, TOLERANCE);
+    }
+  }
+
+  free(input);
+  return ret;
+}
+
+/* rta_bands: mel bands of the data of test/rta_bands, with the
+ * weights of rta_spectrum_to_mel_bands_weights, its stride variant and
+ * the packed weights, which share their computation */
+static int test_bands(const rta_mel_t mel_type)
+{
+  const unsigned int spectrum_size = 1025;
+  const unsigned int filters_number = 20;
+  const char * type = (mel_type == rta_mel_slaney ? "slaney" : "htk");
+  const rta_hz_to_mel_function hz_to_mel =
+    (mel_type == rta_mel_slaney ? rta_hz_to_mel_slaney : rta_hz_to_mel_htk);
+  const rta_mel_to_hz_function mel_to_hz =
+    (mel_type == rta_mel_slaney ? rta_mel_to_hz_slaney : rta_mel_to_hz_htk);
+  rta_real_t * spectrum = malloc(spectrum_size * sizeof(rta_real_t));
+  rta_real_t * weights = malloc(2 * filters_number * spectrum_size *
+                                sizeof(rta_real_t));
+  unsigned int bounds[4 * 20];
+  rta_real_t bands[2 * 20];
+  rta_bands_weights_t * bands_weights;
+  char name[64];
+  char abs_path[64];
+  char sqrabs_path[64];
+  int ret = spectrum != NULL && weights != NULL
+    && read_values("rta_bands/input.txt", spectrum, spectrum_size);
+
+  sprintf(abs_path, "rta_bands/output_%s_abs.txt", type);
+  sprintf(sqrabs_path, "rta_bands/output_%s_sqrabs.txt", type);
+
+  if(ret != 0 &&
+     rta_spectrum_to_mel_bands_weights(weights, bounds, spectrum_size,
+                                       44100., filters_number, 0., 22050.,
+                                       1., hz_to_mel, mel_to_hz, mel_type))
+  {
+    rta_spectrum_to_bands_abs(bands, spectrum, weights, bounds,
+                              spectrum_size, filters_number);
+    sprintf(name, "rta_spectrum_to_bands_abs %s", type);
+    ret &= compare(name, bands, 1, abs_path, filters_number, TOLERANCE);
+    rta_spectrum_to_bands_square_abs(bands, spectrum, weights, bounds,
+                                     spectrum_size, filters_number);
+    sprintf(name, "rta_spectrum_to_bands_square_abs %s", type);
+    ret &= compare(name, bands, 1, sqrabs_path, filters_number, TOLERANCE);
+  }
+  else
+  {
+    ret = 0;
+  }
+
+  if(ret != 0 &&
+     rta_spectrum_to_mel_bands_weights_stride(
+       weights, 2, bounds, 2, spectrum_size, 44100., filters_number, 0.,
+       22050., 1., hz_to_mel, mel_to_hz, mel_type))
+  {
+    rta_spectrum_to_bands_abs_stride(bands, 2, spectrum, 1, weights, 2,
+                                     bounds, 2, spectrum_size,
+                                     filters_number);
+    sprintf(name, "rta_spectrum_to_bands_abs_stride %s", type);
+    ret &= compare(name, bands, 2, abs_path, filters_number, TOLERANCE);
+  }
+  else
+  {
+    ret = 0;
+  }
+
+  /* packed weights of a matrix whose last bin is not zero */
+  if(ret != 0 &&
+     rta_spectrum_to_mel_bands_weights(weights, bounds, spectrum_size,
+                                       44100., filters_number, 0., 22050.,
+                                       1., hz_to_mel, mel_to_hz, mel_type))
+  {
+    const rta_real_t last = spectrum[spectrum_size - 1];
+
+    weights[filters_number * spectrum_size - 1] = 0.5;
+    bounds[filters_number * 2 - 1] = spectrum_size;
+    spectrum[spectrum_size - 1] = 1.;
+    rta_spectrum_to_bands_abs(bands + filters_number, spectrum, weights,
+                              bounds, spectrum_size, filters_number);
+    if(rta_bands_weights_new(&bands_weights, weights, bounds, spectrum_size,
+                             filters_number))
+    {
+      rta_spectrum_to_bands_abs_packed(bands, spectrum, bands_weights);
+      sprintf(name, "rta_bands_weights_new %s", type);
+      ret &= compare_values(name, bands, 1, bands + filters_number,
+                            filters_number, TOLERANCE);
+      rta_bands_weights_delete(bands_weights);
+    }
+    else
+    {
+      ret = 0;
+    }
+    spectrum[spectrum_size - 1] = last;
+  }
+  else
+  {
+    ret = 0;
+  }
+
+  if(ret != 0 &&
+     rta_spectrum_to_mel_bands_weights_new(
+       &bands_weights, spectrum_size, 44100., filters_number, 0., 22050.,
+       1., hz_to_mel, mel_to_hz, mel_type))
+  {
+    rta_spectrum_to_bands_abs_packed(bands, spectrum, bands_weights);
+    sprintf(name, "rta_spectrum_to_bands_abs_packed %s", type);
+    ret &= compare(name, bands, 1, abs_path, filters_number, TOLERANCE);
+    rta_spectrum_to_bands_square_abs_packed(bands, spectrum, bands_weights);
+    sprintf(name, "rta_spectrum_to_bands_square_abs_packed %s", type);
+    ret &= compare(name, bands, 1, sqrabs_path, filters_number, TOLERANCE);
+    rta_bands_weights_delete(bands_weights);
+  }
+  else
+  {
+    ret = 0;
+  }
+
+  free(spectrum);
+  free(weights);
+  return ret;
+}
+
+/* acquisitions of the same mel bands weights by several threads */
+typedef struct
+{
+  const rta_bands_weights_t * weights[4];
+  int ret[4];
+} weights_cache_threads_t;
+
+static void weights_cache_thread(void * argument, const unsigned int index,
+                                 const unsigned int threads_number)
+{
+  weights_cache_threads_t * threads = (weights_cache_threads_t *) argument;
+
+  threads->ret[index] = rta_weights_cache_mel_bands_packed_acquire(
+    &(threads->weights[index]), 1025, 44100., 20, 0., 22050., 1.,
+    rta_hz_to_mel_slaney, rta_mel_to_hz_slaney, rta_mel_slaney);
+}
+
+/* rta_weights_cache: shared weights against the data of test/rta_bands,
+ * test/rta_dct and test/rta_lifter, and concurrent acquisitions */
+static int test_weights_cache(void)
+{
+  const unsigned int spectrum_size = 1025;
+  const unsigned int filters_number = 20;
+  rta_real_t * spectrum = malloc(spectrum_size * sizeof(rta_real_t));
+  rta_real_t input[20];
+  rta_real_t output[20];
+  const rta_real_t * weights_matrix;
+  const rta_real_t * other_matrix;
+  const unsigned int * weights_bounds;
+  const unsigned int * other_bounds;
+  const rta_real_t * weights_vector;
+  weights_cache_threads_t threads;
+  rta_thread_pool_t * pool;
+  unsigned int t;
+  int ret = spectrum != NULL
+    && read_values("rta_bands/input.txt", spectrum, spectrum_size)
+    && rta_weights_cache_mel_bands_acquire(
+      &weights_matrix, &weights_bounds, spectrum_size, 44100.,
+      filters_number, 0., 22050., 1., rta_hz_to_mel_htk, rta_mel_to_hz_htk,
+      rta_mel_htk);
+
+  if(ret != 0)
+  {
+    rta_spectrum_to_bands_abs(output, spectrum, weights_matrix,
+                              weights_bounds, spectrum_size, filters_number);
+    ret &= compare("rta_weights_cache_mel_bands_acquire", output, 1,
+                   "rta_bands/output_htk_abs.txt", filters_number,
+                   TOLERANCE);
+
+    /* the same weights are shared, not other ones */
+    if(rta_weights_cache_mel_bands_acquire(
+         &other_matrix, &other_bounds, spectrum_size, 44100.,
+         filters_number, 0., 22050., 1., rta_hz_to_mel_htk,
+         rta_mel_to_hz_htk, rta_mel_htk))
+    {
+      ret &= (other_matrix == weights_matrix &&
+              other_bounds == weights_bounds);
+      rta_weights_cache_release(other_matrix);
+    }
+    else
+    {
+      ret = 0;
+    }
+    if(rta_weights_cache_mel_bands_acquire(
+         &other_matrix, &other_bounds, spectrum_size, 44100.,
+         filters_number, 0., 11025., 1., rta_hz_to_mel_htk,
+         rta_mel_to_hz_htk, rta_mel_htk))
+    {
+      ret &= (other_matrix != weights_matrix);
+      rta_weights_cache_release(other_matrix);
+    }
+    else
+    {
+      ret = 0;
+    }
+    rta_weights_cache_release(weights_matrix);
+  }
+
+  if(ret != 0 &&
+     read_values("rta_dct/input.txt", input, 20) &&
+     rta_weights_cache_dct_acquire(&weights_matrix, 20, 13, rta_dct_htk))
+  {
+    rta_dct(output, input, weights_matrix, 20, 13);
+    rta_weights_cache_release(weights_matrix);
+    ret &= compare("rta_weights_cache_dct_acquire", output, 1,
+                   "rta_dct/output_htk.txt", 13, TOLERANCE);
+  }
+  else
+  {
+    ret = 0;
+  }
+
+  if(ret != 0 &&
+     read_values("rta_lifter/input.txt", input, 13) &&
+     rta_weights_cache_lifter_acquire(&weights_vector, 13, 22.,
+                                      rta_lifter_sinusoidal,
+                                      rta_lifter_mode_normal))
+  {
+    rta_lifter_cepstrum(output, input, weights_vector, 13);
+    rta_weights_cache_release(weights_vector);
+    ret &= compare("rta_weights_cache_lifter_acquire", output, 1,
+                   "rta_lifter/output_htk.txt", 13, TOLERANCE);
+  }
+  else
+  {
+    ret = 0;
+  }
+
+  /* the first acquisition generates the weights, the others wait */
+  if(ret != 0 && rta_thread_pool_new(&pool, 4))
+  {
+    rta_thread_pool_run(pool, weights_cache_thread, &threads);
+    rta_thread_pool_delete(pool);
+
+    for(t = 0; t < 4; t++)
+    {
+      ret &= (threads.ret[t] != 0 && threads.weights[t] == threads.weights[0]);
+    }
+    if(ret != 0)
+    {
+      rta_spectrum_to_bands_abs_packed(output, spectrum, threads.weights[0]);
+      ret &= compare("rta_weights_cache_mel_bands_packed_acquire", output, 1,
+                     "rta_bands/output_slaney_abs.txt", filters_number,
+                     TOLERANCE);
+    }
+    for(t = 0; t < 4; t++)
+    {
+      if(threads.ret[t] != 0)
+      {
+        rta_weights_cache_release(threads.weights[t]);
+      }
+    }
+  }
+  else
+  {
+    ret = 0;
+  }
+
+  free(spectrum);
+  printf("%-40s %s\n", "rta_weights_cache", (ret ? "ok" : "FAIL"));
+  return ret;
+}
+
+/* rta_dct_setup: DCT of the 4 types by the matrix and FFT methods,
+ * and inverse DCT */
+static int test_dct_setup(void)
+{
+  const rta_dct_t types[] = {rta_dct_slaney, rta_dct_htk, rta_dct_plp,
+                             rta_dct_feacalc};
+  const char * names[] = {"slaney", "htk", "plp", "feacalc"};
+  const rta_dct_method_t methods[] = {rta_dct_method_matrix,
+                                      rta_dct_method_fft,
+                                      rta_dct_method_auto};
+  const char * method_names[] = {"matrix", "fft", "auto"};
+  const unsigned int sizes[][2] = {{20, 13}, {64, 64}, {64, 24}};
+  rta_real_t input[64];
+  rta_real_t output[64];
+  char name[64];
+  char path[64];
+  rta_dct_setup_t * setup;
+  int ret = read_values("rta_dct_setup/input.txt", input, 64);
+  int feacalc_inverse;
+  unsigned int t, m, s;
+
+  for(t = 0; t < 4 && ret != 0; t++)
+  {
+    for(m = 0; m < 3; m++)
+    {
+      for(s = 0; s < 3; s++)
+      {
+        const unsigned int input_size = sizes[s][0];
+        const unsigned int dct_order = sizes[s][1];
+
+        /* the feacalc type has no inverse */
+        const int inverse = (types[t] != rta_dct_feacalc);
+
+        if((inverse ?
+            rta_dct_inverse_setup_new(&setup, input_size, dct_order,
+                                      types[t], methods[m]) :
+            rta_dct_setup_new(&setup, input_size, dct_order, types[t],
+                              methods[m])) == 0 ||
+           (methods[m] != rta_dct_method_auto &&
+            rta_dct_setup_method(setup) != methods[m]))
+        {
+          fprintf(stderr, "rta_dct_setup_new failed\n");
+          return 0;
+        }
+
+        if(dct_order != 24)
+        {
+          rta_dct_execute(output, input, setup);
+          sprintf(name, "rta_dct_execute %s %s %u %u", names[t],
+                  method_names[m], input_size, dct_order);
+          sprintf(path, "rta_dct_setup/output_%s_%u_%u.txt", names[t],
+                  input_size, dct_order);
+          ret &= compare(name, output, 1, path, dct_order, TOLERANCE);
+        }
+
+        if(input_size == 64 && inverse)
+        {
+          rta_dct_inverse_execute(output, input, setup);
+          sprintf(name, "rta_dct_inverse_execute %s %s %u", names[t],
+                  method_names[m], dct_order);
+          sprintf(path, "rta_dct_setup/inverse_%s_64_%u.txt", names[t],
+                  dct_order);
+          ret &= compare(name, output, 1, path, input_size, TOLERANCE);
+        }
+        rta_dct_setup_delete(setup);
+      }
+    }
+  }
+
+  /* the feacalc type has no inverse */
+  feacalc_inverse = rta_dct_inverse_setup_new(&setup, 20, 13, rta_dct_feacalc,
+                                              rta_dct_method_auto);
+  if(feacalc_inverse != 0)
+  {
+    rta_dct_setup_delete(setup);
+  }
+  printf("%-40s %s\n", "rta_dct_inverse_setup_new feacalc",
+         (feacalc_inverse == 0 ? "ok" : "FAIL"));
+  return ret && feacalc_inverse == 0;
+}
+
+/* the _frames functions of rta_bands and rta_dct, in the calling
+ * thread and on a pool of 3 threads */
+static int test_frames(void)
+{
+  const unsigned int spectrum_size = 257;
+  const unsigned int frames_number = 37;
+  const unsigned int filters_number = 26;
+  const unsigned int dct_order = 13;
+  rta_real_t * spectra = malloc(frames_number * spectrum_size *
+                                sizeof(rta_real_t));
+  rta_real_t * weights = malloc(filters_number * spectrum_size *
+                                sizeof(rta_real_t));
+  rta_real_t input[37 * 26];
+  rta_real_t output[37 * 26];
+  rta_real_t dct_weights[13 * 26];
+  unsigned int bounds[2 * 26];
+  rta_bands_weights_t * bands_weights = NULL;
+  rta_thread_pool_t * pools[2] = {NULL, NULL};
+  const char * pool_names[2] = {"", " pool"};
+  char name[64];
+  unsigned int p;
+  int ret = spectra != NULL && weights != NULL
+    && read_values("rta_frames/spectra.txt", spectra,
+                   frames_number * spectrum_size)
+    && read_values("rta_frames/input_dct.txt", input,
+                   frames_number * filters_number)
+    && rta_spectrum_to_mel_bands_weights(
+      weights, bounds, spectrum_size, 16000., filters_number, 0., 8000.,
+      1., rta_hz_to_mel_htk, rta_mel_to_hz_htk, rta_mel_htk)
+    && rta_spectrum_to_mel_bands_weights_new(
+      &bands_weights, spectrum_size, 16000., filters_number, 0., 8000.,
+      1., rta_hz_to_mel_htk, rta_mel_to_hz_htk, rta_mel_htk)
+    && rta_dct_weights(dct_weights, filters_number, dct_order,
+                       rta_dct_slaney)
+    && rta_thread_pool_new(&pools[1], 3);
+
+  for(p = 0; p < 2 && ret != 0; p++)
+  {
+    rta_spectrum_to_bands_abs_frames(
+      output, filters_number, spectra, spectrum_size, frames_number,
+      weights, bounds, spectrum_size, filters_number, pools[p]);
+    sprintf(name, "rta_spectrum_to_bands_abs_frames%s", pool_names[p]);
+    ret &= compare(name, output, 1, "rta_frames/output_bands_abs.txt",
+                   frames_number * filters_number, TOLERANCE);
+
+    rta_spectrum_to_bands_square_abs_frames(
+      output, filters_number, spectra, spectrum_size, frames_number,
+      weights, bounds, spectrum_size, filters_number, pools[p]);
+    sprintf(name, "rta_spectrum_to_bands_square_abs_frames%s",
+            pool_names[p]);
+    ret &= compare(name, output, 1, "rta_frames/output_bands_square_abs.txt",
+                   frames_number * filters_number, TOLERANCE);
+
+    rta_spectrum_to_bands_abs_packed_frames(
+      output, filters_number, spectra, spectrum_size, frames_number,
+      bands_weights, pools[p]);
+    sprintf(name, "rta_spectrum_to_bands_abs_packed_frames%s",
+            pool_names[p]);
+    ret &= compare(name, output, 1, "rta_frames/output_bands_abs.txt",
+                   frames_number * filters_number, TOLERANCE);
+
+    rta_spectrum_to_bands_square_abs_packed_frames(
+      output, filters_number, spectra, spectrum_size, frames_number,
+      bands_weights, pools[p]);
+    sprintf(name, "rta_spectrum_to_bands_square_abs_packed_frames%s",
+            pool_names[p]);
+    ret &= compare(name, output, 1, "rta_frames/output_bands_square_abs.txt",
+                   frames_number * filters_number, TOLERANCE);
+
+    rta_dct_frames(output, dct_order, input, filters_number, frames_number,
+                   dct_weights, filters_number, dct_order, pools[p]);
+    sprintf(name, "rta_dct_frames%s", pool_names[p]);
+    ret &= compare(name, output, 1, "rta_frames/output_dct.txt",
+                   frames_number * dct_order, TOLERANCE);
+  }
+
+  if(pools[1] != NULL)
+  {
+    rta_thread_pool_delete(pools[1]);
+  }
+  if(bands_weights != NULL)
+  {
+    rta_bands_weights_delete(bands_weights);
+  }
+  free(spectra);
+  free(weights);
+  return ret;
+}
+
+/* rta_delta_stream: deltas and accelerations of a sequence, the
+ * last vector being input again to output the last deltas, then the
+ * same sequence after a reset */
+static int test_delta_stream(const unsigned int delta_filter_size,
+                             const unsigned int acceleration_filter_size)
+{
+  const unsigned int input_size = 13;
+  const unsigned int frames_number = 60;
+  rta_real_t input[60 * 13];
+  rta_real_t delta[60 * 13];
+  rta_real_t acceleration[60 * 13];
+  rta_delta_stream_t * delta_stream;
+  char name[64];
+  char path[64];
+  unsigned int delay, f, o, r;
+  int ret = read_values("rta_delta_stream/input.txt", input,
+                        frames_number * input_size)
+    && rta_delta_stream_new(&delta_stream, input_size, delta_filter_size,
+                            acceleration_filter_size);
+
+  if(ret == 0)
+  {
+    fprintf(stderr, "rta_delta_stream_new failed\n");
+    return 0;
+  }
+
+  delay = rta_delta_stream_delay(delta_stream);
+  ret &= (delay == (delta_filter_size - 1) / 2 +
+          (acceleration_filter_size > 0 ?
+           (acceleration_filter_size - 1) / 2 : 0));
+
+  for(r = 0; r < 2 && ret != 0; r++)
+  {
+    o = 0;
+    for(f = 0; f < frames_number + delay && o < frames_number; f++)
+    {
+      const unsigned int i = (f < frames_number ? f : frames_number - 1);
+
+      o += rta_delta_stream_input(
+        delta_stream, input + i * input_size, delta + o * input_size,
+        (acceleration_filter_size > 0 ? acceleration + o * input_size :
+         NULL));
+    }
+    ret &= (o == frames_number);
+
+    sprintf(name, "rta_delta_stream_input %u %u%s", delta_filter_size,
+            acceleration_filter_size, (r > 0 ? " reset" : ""));
+    sprintf(path, "rta_delta_stream/output_delta_%u_%u.txt",
+            delta_filter_size, acceleration_filter_size);
+    ret &= compare(name, delta, 1, path, frames_number * input_size,
+                   TOLERANCE);
+    if(acceleration_filter_size > 0)
+    {
+      sprintf(name, "rta_delta_stream_input %u %u%s (acceleration)",
+              delta_filter_size, acceleration_filter_size,
+              (r > 0 ? " reset" : ""));
+      sprintf(path, "rta_delta_stream/output_acceleration_%u_%u.txt",
+              delta_filter_size, acceleration_filter_size);
+      ret &= compare(name, acceleration, 1, path,
+                     frames_number * input_size, TOLERANCE);
+    }
+    rta_delta_stream_reset(delta_stream);
+  }
+
+  rta_delta_stream_delete(delta_stream);
+  return ret;
+}
+
+int main (int argc, char *argv[])
+{
+  int ret = 1;
+
+  ret &= test_fft_complex();
+  ret &= test_fft_real();
+  ret &= test_fft_stockham();
+  ret &= test_fft_four_step();
+  ret &= test_fft_input_pruning();
+  ret &= test_fft_output_pruning();
+  ret &= test_fft_real_batch();
+  ret &= test_fft_batch();
+  ret &= test_fft_split();
+  ret &= test_fft_real_pair();
+  ret &= test_stft(rta_stft_complex);
+  ret &= test_stft(rta_stft_magnitude);
+  ret &= test_istft();
+  ret &= test_convolution();
+  ret &= test_convolution_nonuniform(0);
+  ret &= test_convolution_nonuniform(1);
+  ret &= test_correlation();
+  ret &= test_sdft();
+  ret &= test_cqt();
+  ret &= test_mfcc();
+  ret &= test_bands(rta_mel_htk);
+  ret &= test_bands(rta_mel_slaney);
+  ret &= test_weights_cache();
+  ret &= test_dct_setup();
+  ret &= test_frames();
+  ret &= test_delta_stream(7, 5);
+  ret &= test_delta_stream(9, 0);
+
+  printf("%s\n", (ret ? "all tests passed" : "some tests FAILED"));
+  return (ret ? EXIT_SUCCESS : EXIT_FAILURE);
+}